@@ -24,6 +24,7 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 */
 
 #include "app_logger.hpp"
+#include "trace.hpp"
 #include <iostream>
 #include <cstring>
 
@@ -104,6 +105,7 @@ AppLogger::AppLogger(LogLevel levelIn, const std::string &sFileIn, const std::st
 
 void AppLogger::LogIt(LogLevel level, const std::string &sFile, const std::string sFunction, int iLine, const std::string &sMessage)
 {
+	TRACE_ZONE_CAT("AppLogger::LogIt", "log");
 	ASSERT(level >= ERROR && level < ALL);
 	std::lock_guard<std::mutex> lock(Mutex());
 	Logs().emplace_back(level, sFile, sFunction, iLine, sMessage);
@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+// Measures what Decompress(true) buys against a local server that gzips its JSON responses when asked to.  Each
+// mode fetches the same document over one keep-alive connection and reports bytes on the wire, time spent inflating,
+// and the round trip time.  Loopback hides the cost of the wire, so the time the same bytes would take on a link of
+// the given speed is shown as well.
+//
+// usage: http_decompress [requests=50] [document KiB=1024] [link Mbit/s=20]
+
+#include "network.hpp"
+#include "utils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <zlib.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	namespace http = boost::beast::http;
+
+	// API-shaped JSON: many records with repeated keys and similar values, which is what compression is good at.
+	std::string MakeDocument(size_t iSize)
+	{
+		std::string sRet = "[";
+		for (int i = 0; sRet.size() < iSize; ++i) {
+			if (i) {
+				sRet += ",";
+			}
+			sRet += "{\"id\":" + std::to_string(i) + ",\"name\":\"station-" + std::to_string(i % 977) + "\",\"status\":\"" + (i % 7 ? "online" : "offline") +
+					"\",\"frequency\":" + std::to_string(144000000 + (i * 12500) % 4000000) + ",\"tags\":[\"vhf\",\"repeater\",\"region-" + std::to_string(i % 13) + "\"]}";
+		}
+		return sRet + "]";
+	}
+
+	std::string Gzip(const std::string & sIn)
+	{
+		z_stream zs{};
+		deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+		std::string sRet(deflateBound(&zs, static_cast<uLong>(sIn.size())), '\0');
+		zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(sIn.data()));
+		zs.avail_in = static_cast<uInt>(sIn.size());
+		zs.next_out = reinterpret_cast<Bytef *>(sRet.data());
+		zs.avail_out = static_cast<uInt>(sRet.size());
+		deflate(&zs, Z_FINISH);
+		sRet.resize(zs.total_out);
+		deflateEnd(&zs);
+		return sRet;
+	}
+
+	struct Result
+	{
+		uint64_t iWireBytes = 0;
+		uint64_t iBodyBytes = 0;
+		std::chrono::microseconds decodeTime{0};
+		std::chrono::microseconds totalTime{0};
+		int iErrors = 0;
+	};
+
+	Result Run(const Network::HTTP::client_t & client, const std::string & sDocument, int iRequests, bool bStream)
+	{
+		Result ret;
+		for (int i = 0; i < iRequests; ++i) {
+			auto req = std::make_shared<http::request<http::string_body>>(http::verb::get, "/data", 11);
+			req->set(http::field::host, "127.0.0.1");
+			std::promise<Network::HTTP::response_t> done;
+			auto handler = [&done](Network::HTTP::request_t, Network::HTTP::response_t res, const std::string &, int)
+			{
+				done.set_value(res);
+			};
+			std::string sBody;
+			if (bStream) {
+				client->Stream(req, [&sBody](std::string_view sChunk)
+				{
+					sBody += sChunk;
+					return true;
+				}, handler, nullptr, 30s, true);
+			} else {
+				client->Request(req, handler, 30s, true);
+			}
+			auto res = done.get_future().get();
+			if (!bStream) {
+				sBody = std::move(res->body());
+			}
+			if (res->ec || res->result_int() != 200 || sBody != sDocument) {
+				++ret.iErrors;
+				continue;
+			}
+			ret.iWireBytes += res->iWireBytes;
+			ret.iBodyBytes += sBody.size();
+			ret.decodeTime += res->decodeTime;
+			ret.totalTime += res->timing.Total();
+		}
+		return ret;
+	}
+
+	void Print(const char * szMode, const Result & result, int iRequests, double dLinkMbps)
+	{
+		int iGood = std::max(1, iRequests - result.iErrors);
+		double dWireMs = static_cast<double>(result.iWireBytes) / iGood * 8.0 / (dLinkMbps * 1000.0);
+		double dDecodeMs = static_cast<double>(result.decodeTime.count()) / iGood / 1000.0;
+		printf("%-24s wire %9llu B  body %9llu B  decode %7.3f ms  loopback %7.3f ms  at %g Mbit/s %8.1f ms  errors %d\n",
+			   szMode,
+			   static_cast<unsigned long long>(result.iWireBytes / static_cast<uint64_t>(iGood)),
+			   static_cast<unsigned long long>(result.iBodyBytes / static_cast<uint64_t>(iGood)),
+			   dDecodeMs,
+			   static_cast<double>(result.totalTime.count()) / iGood / 1000.0,
+			   dLinkMbps,
+			   dWireMs + dDecodeMs,
+			   result.iErrors);
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	if (argc > 1 && std::strcmp(argv[1], "--help") == 0) {
+		printf("usage: %s [requests=50] [document KiB=1024] [link Mbit/s=20]\n", argv[0]);
+		return 0;
+	}
+	int iRequests = argc > 1 ? std::max(1, std::atoi(argv[1])) : 50;
+	size_t iDocumentSize = (argc > 2 ? static_cast<size_t>(std::max(1, std::atoi(argv[2]))) : 1024) * 1024;
+	double dLinkMbps = argc > 3 ? std::max(0.001, std::atof(argv[3])) : 20.0;
+
+	Network::Core(2);
+
+	const std::string sDocument = MakeDocument(iDocumentSize);
+	const std::string sCompressed = Gzip(sDocument);
+
+	auto server = Network::HTTP::Server("127.0.0.1", 0);
+	server->Route(Network::HTTP::verb::get, "/data", [&](Network::HTTP::request_t req, Network::HTTP::response_t res, const std::string &, int)
+	{
+		res->set(http::field::content_type, "application/json");
+		if (auto it = req->find(http::field::accept_encoding); it != req->end() && it->value().find("gzip") != boost::beast::string_view::npos) {
+			res->set(http::field::content_encoding, "gzip");
+			res->body() = sCompressed;
+		} else {
+			res->body() = sDocument;
+		}
+	});
+	if (!server->Start()) {
+		fprintf(stderr, "Could not start the server.\n");
+		return 1;
+	}
+
+	printf("%d requests for a %zu byte JSON document (%zu bytes gzipped, %.1f:1)\n", iRequests, sDocument.size(), sCompressed.size(),
+		   static_cast<double>(sDocument.size()) / static_cast<double>(sCompressed.size()));
+
+	int iErrors = 0;
+	for (bool bStream : {false, true}) {
+		for (bool bDecompress : {false, true}) {
+			auto client = Network::HTTP::Client("127.0.0.1", server->Port(), false);
+			client->KeepAlive(true);
+			client->Decompress(bDecompress);
+			client->BodyLimit(sDocument.size());
+			Run(client, sDocument, 1, bStream); // Warm up the connection.
+			auto result = Run(client, sDocument, iRequests, bStream);
+			iErrors += result.iErrors;
+			std::string sMode = std::string(bStream ? "streamed, " : "buffered, ") + (bDecompress ? "gzip" : "identity");
+			Print(sMode.c_str(), result, iRequests, dLinkMbps);
+		}
+	}
+
+	server->Stop();
+	Network::ExitAll();
+	return iErrors ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+// A wrk-style load test for HTTP::Server: one local server and a number of keep-alive clients, each keeping one
+// request in flight for the length of the run, like wrk's connections.  Prints requests/s and latency percentiles.
+//
+// usage: http_load [connections=64] [seconds=10] [threads=4] [body bytes=256]
+
+#include "network.hpp"
+#include "utils.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	struct Connection
+	{
+		Network::HTTP::client_t client;
+		Network::Histogram latency; // Only touched by this connection's single request in flight.
+		uint64_t iDone = 0;
+		uint64_t iErrors = 0;
+	};
+
+	std::atomic<bool> bRunning = true;
+
+	void Send(const std::shared_ptr<Connection> & conn)
+	{
+		auto start = SteadyNow();
+		conn->client->Get("/load", [conn, start](Network::HTTP::request_t, Network::HTTP::response_t res, const std::string &, int)
+		{
+			if (res->ec || res->result_int() != 200) {
+				++conn->iErrors;
+			} else {
+				++conn->iDone;
+				conn->latency.Record(std::chrono::duration_cast<std::chrono::microseconds>(SteadyNow() - start));
+			}
+			if (bRunning) {
+				Send(conn);
+			}
+		}, 30s, true);
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	if (argc > 1 && std::strcmp(argv[1], "--help") == 0) {
+		printf("usage: %s [connections=64] [seconds=10] [threads=4] [body bytes=256]\n", argv[0]);
+		return 0;
+	}
+	int iConnections = argc > 1 ? std::max(1, std::atoi(argv[1])) : 64;
+	int iSeconds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 10;
+	int iThreads = argc > 3 ? std::max(1, std::atoi(argv[3])) : 4;
+	size_t iBodySize = argc > 4 ? static_cast<size_t>(std::max(0, std::atoi(argv[4]))) : 256;
+
+	Network::Core(iThreads);
+
+	auto server = Network::HTTP::Server("127.0.0.1", 0);
+	server->MaxConnections(static_cast<size_t>(iConnections) * 2);
+	std::string sBody(iBodySize, 'x');
+	server->Route(Network::HTTP::verb::get, "/load", [&sBody](Network::HTTP::request_t, Network::HTTP::response_t res, const std::string &, int)
+	{
+		res->set(boost::beast::http::field::content_type, "text/plain");
+		res->body() = sBody;
+	});
+	if (!server->Start()) {
+		fprintf(stderr, "Could not start the server.\n");
+		return 1;
+	}
+
+	std::vector<std::shared_ptr<Connection>> vConnections;
+	for (int i = 0; i < iConnections; ++i) {
+		auto conn = std::make_shared<Connection>();
+		conn->client = Network::HTTP::Client("127.0.0.1", server->Port(), false);
+		conn->client->KeepAlive(true);
+		vConnections.push_back(conn);
+	}
+
+	printf("Running %ds against 127.0.0.1:%d with %d connections on %d threads, %zu byte bodies\n", iSeconds, server->Port(), iConnections, iThreads, iBodySize);
+	auto start = SteadyNow();
+	for (auto & conn : vConnections) {
+		Send(conn);
+	}
+	std::this_thread::sleep_for(std::chrono::seconds(iSeconds));
+	bRunning = false;
+
+	// Let the requests in flight finish so every connection's counters are final.
+	auto drainUntil = SteadyNow() + 5s;
+	for (auto & conn : vConnections) {
+		while (conn->client->Pending() && SteadyNow() < drainUntil) {
+			std::this_thread::sleep_for(1ms);
+		}
+	}
+	double dSeconds = std::chrono::duration<double>(SteadyNow() - start).count();
+
+	Network::Histogram latency;
+	uint64_t iDone = 0;
+	uint64_t iErrors = 0;
+	for (auto & conn : vConnections) {
+		latency.Merge(conn->latency);
+		iDone += conn->iDone;
+		iErrors += conn->iErrors;
+	}
+
+	printf("%llu requests in %.2fs, %llu errors\n", static_cast<unsigned long long>(iDone), dSeconds, static_cast<unsigned long long>(iErrors));
+	printf("Requests/s: %.0f\n", static_cast<double>(iDone) / dSeconds);
+	printf("Latency us: mean %lld  p50 %lld  p90 %lld  p99 %lld  p99.9 %lld  max %lld\n",
+		   static_cast<long long>(latency.Mean().count()),
+		   static_cast<long long>(latency.Percentile(50).count()),
+		   static_cast<long long>(latency.Percentile(90).count()),
+		   static_cast<long long>(latency.Percentile(99).count()),
+		   static_cast<long long>(latency.Percentile(99.9).count()),
+		   static_cast<long long>(latency.Max().count()));
+
+	vConnections.clear();
+	server->Stop();
+	Network::ExitAll();
+	return iErrors ? 1 : 0;
+}
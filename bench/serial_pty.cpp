@@ -0,0 +1,230 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+// Exercises SerialHub against pseudo-terminal pairs instead of real devices.  The hub opens the pty slaves; the
+// test writes frames into the masters and checks that each arrives once, on the right port, through OnFrame, then
+// writes through the hub and reads the bytes back from the masters.  Exits non-zero on any mismatch.
+//
+// usage: serial_pty [ports=8] [frames per port=1000]
+
+#include "network.hpp"
+#include "utils.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <util.h>
+#else
+#include <pty.h>
+#endif
+
+using namespace std::chrono_literals;
+
+namespace
+{
+	struct PtyPair
+	{
+		int iMaster = -1;
+		int iSlave = -1; // Held open so the master does not see a hangup between the hub's reads.
+		std::string sName;
+	};
+
+	bool WriteAll(int fd, std::string_view sData)
+	{
+		while (!sData.empty()) {
+			auto iWritten = write(fd, sData.data(), sData.size());
+			if (iWritten < 0) {
+				if (errno == EINTR || errno == EAGAIN) {
+					pollfd pfd{fd, POLLOUT, 0};
+					poll(&pfd, 1, 100);
+					continue;
+				}
+				return false;
+			}
+			sData.remove_prefix(static_cast<size_t>(iWritten));
+		}
+		return true;
+	}
+
+	std::string ReadFor(int fd, size_t iExpected, std::chrono::milliseconds timeout)
+	{
+		std::string sRet;
+		auto until = SteadyNow() + timeout;
+		char aBuffer[4096];
+		while (sRet.size() < iExpected && SteadyNow() < until) {
+			pollfd pfd{fd, POLLIN, 0};
+			if (poll(&pfd, 1, 10) <= 0) {
+				continue;
+			}
+			auto iRead = read(fd, aBuffer, sizeof(aBuffer));
+			if (iRead > 0) {
+				sRet.append(aBuffer, static_cast<size_t>(iRead));
+			}
+		}
+		return sRet;
+	}
+
+	std::string Frame(const std::string & sWho, size_t iPort, int iFrame)
+	{
+		return sWho + " " + std::to_string(iPort) + " frame " + std::to_string(iFrame) + "~";
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	if (argc > 1 && std::strcmp(argv[1], "--help") == 0) {
+		printf("usage: %s [ports=8] [frames per port=1000]\n", argv[0]);
+		return 0;
+	}
+	size_t iPorts = argc > 1 ? static_cast<size_t>(std::max(1, std::atoi(argv[1]))) : 8;
+	int iFrames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1000;
+
+	Network::Core(2);
+
+	std::vector<PtyPair> vPairs(iPorts);
+	for (auto & pair : vPairs) {
+		termios tio{};
+		cfmakeraw(&tio);
+		char szName[256] = {};
+		if (openpty(&pair.iMaster, &pair.iSlave, szName, &tio, nullptr) != 0) {
+			fprintf(stderr, "openpty failed: %s\n", strerror(errno));
+			return 1;
+		}
+		fcntl(pair.iMaster, F_SETFL, fcntl(pair.iMaster, F_GETFL) | O_NONBLOCK);
+		pair.sName = szName;
+	}
+
+	std::mutex mtx;
+	std::map<std::string, std::vector<std::string>> mReceived;
+	int iFailures = 0;
+	{
+		auto hub = std::make_shared<Network::SerialHub>(115200);
+		hub->OnFrame([] { return std::make_shared<Network::DelimiterFramer>(); }, [&](const std::string & sPort, std::string_view sFrame)
+		{
+			std::lock_guard lock(mtx);
+			mReceived[sPort].emplace_back(sFrame);
+		});
+		for (auto & pair : vPairs) {
+			if (!hub->Add(pair.sName)) {
+				fprintf(stderr, "SerialHub::Add(%s) failed\n", pair.sName.c_str());
+				return 1;
+			}
+		}
+
+		// Into the hub: every port at once, so the frames interleave on the shared core.
+		auto start = SteadyNow();
+		std::vector<std::jthread> vWriters;
+		for (size_t i = 0; i < iPorts; ++i) {
+			vWriters.emplace_back([&, i]
+			{
+				for (int j = 0; j < iFrames; ++j) {
+					WriteAll(vPairs[i].iMaster, Frame("in", i, j));
+				}
+			});
+		}
+		vWriters.clear();
+		auto until = SteadyNow() + 10s;
+		while (SteadyNow() < until) {
+			std::lock_guard lock(mtx);
+			size_t iTotal = 0;
+			for (auto & [sPort, vFrames] : mReceived) {
+				iTotal += vFrames.size();
+			}
+			if (iTotal >= iPorts * static_cast<size_t>(iFrames)) {
+				break;
+			}
+			std::this_thread::sleep_for(1ms);
+		}
+		double dIn = std::chrono::duration<double>(SteadyNow() - start).count();
+
+		{
+			std::lock_guard lock(mtx);
+			for (size_t i = 0; i < iPorts; ++i) {
+				auto & vFrames = mReceived[vPairs[i].sName];
+				if (vFrames.size() != static_cast<size_t>(iFrames)) {
+					fprintf(stderr, "%s: received %zu frames, expected %d\n", vPairs[i].sName.c_str(), vFrames.size(), iFrames);
+					++iFailures;
+					continue;
+				}
+				for (int j = 0; j < iFrames; ++j) {
+					if (vFrames[static_cast<size_t>(j)] != Frame("in", i, j)) {
+						fprintf(stderr, "%s: frame %d is \"%s\"\n", vPairs[i].sName.c_str(), j, vFrames[static_cast<size_t>(j)].c_str());
+						++iFailures;
+						break;
+					}
+				}
+			}
+		}
+
+		// Out of the hub: queue everything first so the writes batch, then read it all back from the masters.
+		start = SteadyNow();
+		std::vector<std::string> vExpected(iPorts);
+		for (size_t i = 0; i < iPorts; ++i) {
+			for (int j = 0; j < iFrames; ++j) {
+				auto sFrame = Frame("out", i, j);
+				vExpected[i] += sFrame;
+				hub->Write(vPairs[i].sName, std::move(sFrame));
+			}
+		}
+		for (size_t i = 0; i < iPorts; ++i) {
+			auto sRead = ReadFor(vPairs[i].iMaster, vExpected[i].size(), 10s);
+			if (sRead != vExpected[i]) {
+				fprintf(stderr, "%s: read back %zu bytes, expected %zu\n", vPairs[i].sName.c_str(), sRead.size(), vExpected[i].size());
+				++iFailures;
+			}
+		}
+		double dOut = std::chrono::duration<double>(SteadyNow() - start).count();
+
+		printf("%zu ports x %d frames: in %.3fs, out %.3fs\n", iPorts, iFrames, dIn, dOut);
+		for (auto & [sPort, stats] : hub->Stats()) {
+			printf("%s: read %llu bytes, %llu frames, %llu read errors; wrote %llu bytes in %llu writes, %llu write errors; write latency avg %lldus max %lldus\n",
+				   sPort.c_str(),
+				   static_cast<unsigned long long>(stats.iBytesRead),
+				   static_cast<unsigned long long>(stats.iFrames),
+				   static_cast<unsigned long long>(stats.iReadErrors),
+				   static_cast<unsigned long long>(stats.iBytesWritten),
+				   static_cast<unsigned long long>(stats.iWrites),
+				   static_cast<unsigned long long>(stats.iWriteErrors),
+				   static_cast<long long>(stats.writeLatencyAvg.count()),
+				   static_cast<long long>(stats.writeLatencyMax.count()));
+		}
+	}
+
+	for (auto & pair : vPairs) {
+		close(pair.iSlave);
+		close(pair.iMaster);
+	}
+	Network::ExitAll();
+
+	printf(iFailures ? "FAILED\n" : "OK\n");
+	return iFailures ? 1 : 0;
+}
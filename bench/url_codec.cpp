@@ -0,0 +1,205 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+// Microbenchmark of URLEncode, URLDecode and URLDecodeInPlace on query-string-heavy paths, against the plain
+// byte-at-a-time loops they replaced.  Every output is checked against the reference first, including on random
+// bytes with stray '%'s, so a fast wrong answer fails instead of being timed.
+//
+// usage: url_codec [paths=100000] [rounds=20]
+
+#include "network.hpp"
+#include "utils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+namespace
+{
+	std::string ReferenceEncode(std::string_view in)
+	{
+		std::string out;
+		for (size_t i = 0; i < in.size(); ++i) {
+			auto c = static_cast<unsigned char>(in[i]);
+			if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+				out += static_cast<char>(c);
+			} else if (c == '%' && i + 2 < in.size() && std::isxdigit(static_cast<unsigned char>(in[i + 1])) && std::isxdigit(static_cast<unsigned char>(in[i + 2]))) {
+				out += in.substr(i, 3);
+				i += 2;
+			} else if (c == '%') {
+				out += "%25";
+			} else if (c == ' ') {
+				out += '+';
+			} else {
+				out += '%';
+				out += "0123456789ABCDEF"[c >> 4];
+				out += "0123456789ABCDEF"[c & 15];
+			}
+		}
+		return out;
+	}
+
+	std::string ReferenceDecode(std::string_view in)
+	{
+		auto Hex = [](char c) { return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1; };
+		std::string out;
+		for (size_t i = 0; i < in.size(); ++i) {
+			if (in[i] == '+') {
+				out += ' ';
+			} else if (in[i] == '%' && i + 2 < in.size() && Hex(in[i + 1]) >= 0 && Hex(in[i + 2]) >= 0) {
+				out += static_cast<char>(Hex(in[i + 1]) << 4 | Hex(in[i + 2]));
+				i += 2;
+			} else {
+				out += in[i];
+			}
+		}
+		return out;
+	}
+
+	std::vector<std::string> MakePaths(size_t iCount, std::mt19937 & rng)
+	{
+		static const char * aKeys[] = {"q", "filter", "sort", "page", "per_page", "fields", "callsign", "grid", "since", "tags", "redirect_uri", "state"};
+		static const char * aValues[] = {"hello world", "VA7ODR", "CN89", "2024-06-01T12:00:00Z", "name,asc", "a+b=c&d", "100%", "Zo\xc3\xab M\xc3\xbcller",
+										 "https://example.com/cb?x=1&y=2", "repeater/vhf", "~user.name_1-2", "%E2%9C%93 done", "0123456789abcdef0123456789abcdef"};
+		std::vector<std::string> vRet;
+		vRet.reserve(iCount);
+		for (size_t i = 0; i < iCount; ++i) {
+			std::string sPath = "/api/v1/stations/" + std::to_string(rng() % 100000) + "/log?";
+			auto iParams = 2 + rng() % 8;
+			for (size_t j = 0; j < iParams; ++j) {
+				sPath += j ? "&" : "";
+				sPath += aKeys[rng() % std::size(aKeys)];
+				sPath += "=";
+				sPath += aValues[rng() % std::size(aValues)];
+			}
+			vRet.push_back(std::move(sPath));
+		}
+		return vRet;
+	}
+
+	int Check(const std::vector<std::string> & vInputs, const char * szWhat)
+	{
+		int iFailures = 0;
+		for (auto & sIn : vInputs) {
+			auto sEncoded = Network::URLEncode(sIn);
+			auto sDecoded = Network::URLDecode(sIn);
+			std::string sInPlace = sIn;
+			Network::URLDecodeInPlace(sInPlace);
+			std::string sSpan = sIn;
+			sSpan.resize(Network::URLDecodeInPlace(std::span<char>(sSpan.data(), sSpan.size())));
+			auto sDecodedReference = ReferenceDecode(sIn);
+			if (sEncoded != ReferenceEncode(sIn) || sDecoded != sDecodedReference || sInPlace != sDecodedReference || sSpan != sDecodedReference) {
+				if (++iFailures <= 5) {
+					fprintf(stderr, "%s mismatch on \"%s\"\n", szWhat, sIn.c_str());
+				}
+			}
+		}
+		return iFailures;
+	}
+
+	template <typename F>
+	void Time(const char * szWhat, size_t iBytes, int iRounds, F && f)
+	{
+		size_t iSink = 0;
+		auto start = SteadyNow();
+		for (int i = 0; i < iRounds; ++i) {
+			iSink += f();
+		}
+		double dSeconds = std::chrono::duration<double>(SteadyNow() - start).count();
+		printf("%-32s %8.1f MB/s  %8.2f ns/byte  (%zu)\n", szWhat, static_cast<double>(iBytes) * iRounds / dSeconds / 1e6, dSeconds * 1e9 / (static_cast<double>(iBytes) * iRounds), iSink);
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	if (argc > 1 && std::strcmp(argv[1], "--help") == 0) {
+		printf("usage: %s [paths=100000] [rounds=20]\n", argv[0]);
+		return 0;
+	}
+	size_t iPaths = argc > 1 ? static_cast<size_t>(std::max(1, std::atoi(argv[1]))) : 100000;
+	int iRounds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 20;
+
+	std::mt19937 rng(38);
+	auto vPaths = MakePaths(iPaths, rng);
+	std::vector<std::string> vEncoded;
+	vEncoded.reserve(vPaths.size());
+	for (auto & sPath : vPaths) {
+		vEncoded.push_back(ReferenceEncode(sPath));
+	}
+
+	// Random bytes from a small alphabet heavy in '%', '+' and hex digits, at lengths either side of the vector widths.
+	std::vector<std::string> vRandom;
+	static constexpr char szAlphabet[] = "%%%++aF09gZ~-_. /\x80\xff";
+	for (size_t i = 0; i < 20000; ++i) {
+		std::string s(rng() % 100, '\0');
+		for (auto & c : s) {
+			c = szAlphabet[rng() % (sizeof(szAlphabet) - 1)];
+		}
+		vRandom.push_back(std::move(s));
+	}
+
+	int iFailures = Check(vPaths, "path") + Check(vEncoded, "encoded path") + Check(vRandom, "random");
+	if (iFailures) {
+		fprintf(stderr, "%d mismatches\n", iFailures);
+		return 1;
+	}
+
+	size_t iPathBytes = 0;
+	size_t iEncodedBytes = 0;
+	for (size_t i = 0; i < vPaths.size(); ++i) {
+		iPathBytes += vPaths[i].size();
+		iEncodedBytes += vEncoded[i].size();
+	}
+	printf("%zu paths, %zu bytes raw, %zu bytes encoded, %d rounds\n", vPaths.size(), iPathBytes, iEncodedBytes, iRounds);
+
+	Time("encode, reference", iPathBytes, iRounds, [&] { size_t n = 0; for (auto & s : vPaths) n += ReferenceEncode(s).size(); return n; });
+	Time("URLEncode", iPathBytes, iRounds, [&] { size_t n = 0; for (auto & s : vPaths) n += Network::URLEncode(s).size(); return n; });
+	Time("decode, reference", iEncodedBytes, iRounds, [&] { size_t n = 0; for (auto & s : vEncoded) n += ReferenceDecode(s).size(); return n; });
+	Time("URLDecode", iEncodedBytes, iRounds, [&] { size_t n = 0; for (auto & s : vEncoded) n += Network::URLDecode(s).size(); return n; });
+
+	// The in-place forms are timed on a copy of each input, which is what a caller decoding a request target pays.
+	std::vector<std::string> vWork(vEncoded.size());
+	Time("URLDecodeInPlace(std::string&)", iEncodedBytes, iRounds, [&]
+	{
+		size_t n = 0;
+		for (size_t i = 0; i < vEncoded.size(); ++i) {
+			vWork[i].assign(vEncoded[i]);
+			Network::URLDecodeInPlace(vWork[i]);
+			n += vWork[i].size();
+		}
+		return n;
+	});
+	Time("URLDecodeInPlace(std::span)", iEncodedBytes, iRounds, [&]
+	{
+		size_t n = 0;
+		for (size_t i = 0; i < vEncoded.size(); ++i) {
+			vWork[i].assign(vEncoded[i]);
+			n += Network::URLDecodeInPlace(std::span<char>(vWork[i].data(), vWork[i].size()));
+		}
+		return n;
+	});
+	return 0;
+}
@@ -45,10 +45,14 @@ class SampleWindow : public EasyAppBase
 		virtual bool BuildsOwnWindow() override { return false; }  // Set this to true, if you want to have tighter control over the ImGui::Begin and ImGui::End calls. If set to False, EasyAppBase will handle it for you.
 
 	private:
+		struct SampleState
+		{
+			int iCount = 0;
+			int iButtonCount = 0;
+		};
+
 		Thread sampleThread;
-		SharedRecursiveMutex m_mutex;
-		int iCount = 0;
-		int iButtonCount = 0;
+		Snapshot<SampleState> state;  // Written by SampleThread, read by Render.  No locks on either side.
 		EventHandler::Event buttonEvent = CreateEvent("ButtonEvent", EventHandler::auto_reset);
 		EventHandler::Event stopEvent = CreateEvent("ButtonEvent", EventHandler::manual_reset);
 };
@@ -57,15 +61,17 @@ void SampleWindow::Start()
 {
 	sampleThread = THREAD("SampleThread", [&](std::stop_token stoken)
 	{
+		SampleState working;  // Owned by this thread; copies go to Render through state.Publish().
 		bool bRun = true;
 		while (!stoken.stop_requested() && bRun) {
 			int iEventIndex = EventHandlerWait({buttonEvent, stopEvent}, 1000ms);
 			switch (iEventIndex) {
 				case 0:
 				{
-					RecursiveSharedLock lock(m_mutex);
-					iButtonCount++;
-					Log(AppLogger::INFO) << "Button Count: " << iButtonCount;
+					working.iButtonCount++;
+					state.Publish(working);
+					EasyAppBase::RequestRedraw();
+					Log(AppLogger::INFO) << "Button Count: " << working.iButtonCount;
 					break;
 				}
 
@@ -78,9 +84,10 @@ void SampleWindow::Start()
 
 			   case EventHandler::TIMEOUT:
 			   {
-				   RecursiveExclusiveLock lock(m_mutex);
-				   iCount++;
-				   Log(AppLogger::INFO) << "Timeout Count: " << iCount;
+				   working.iCount++;
+				   state.Publish(working);
+				   EasyAppBase::RequestRedraw();
+				   Log(AppLogger::INFO) << "Timeout Count: " << working.iCount;
 				   break;
 			   }
 
@@ -104,9 +111,10 @@ void SampleWindow::Stop()
 // Sample Window Render
 void SampleWindow::Render(bool * bShow)
 {
+	const SampleState & current = state.Latest();
 	ImGui::Text("Sample Window");
-	ImGui::Text("Button Count: %d", iButtonCount);
-	ImGui::Text("Timeout Count: %d", iCount);
+	ImGui::Text("Button Count: %d", current.iButtonCount);
+	ImGui::Text("Timeout Count: %d", current.iCount);
 	if (ImGui::Button("Button")) {
 		EventHandler::Set(buttonEvent);
 	}
@@ -24,7 +24,12 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 */
 
 #include "easyappbase.hpp"
+#include "fonts.hpp"
+#include "frame_profiler.hpp"
+#include "trace.hpp"
+#include <algorithm>
 #include <filesystem>
+#include <mutex>
 #include <ranges>
 
 using namespace std::chrono_literals;
@@ -46,24 +51,108 @@ using namespace std::chrono_literals;
 #include <cstdio>
 #include <utility>
 
-extern const int HackFont_compressed_size;
-extern const unsigned int HackFont_compressed_data[];
-
 EventHandler::Event EasyAppBase::eQuit = EventHandler::CreateEvent("Application Quit", EventHandler::manual_reset);
 bool EasyAppBase::bShowEasyAbout = false;
+bool EasyAppBase::bShowFrameProfiler = false;
+std::string EasyAppBase::sTraceFile;
 bool EasyAppBase::bDisableDemo = false;
 bool EasyAppBase::bDisableDocking = false;
 bool EasyAppBase::bDisableViewports = false;
 bool EasyAppBase::bDisableGUI = false;
 int EasyAppBase::iNetworkThreads = 0;
+Uint32 EasyAppBase::iSDLSubsystems = 0;
+
+bool EasyAppBase::bIdleRendering = false;
+double EasyAppBase::dIdleFPS = 1.0;
+std::atomic<int> EasyAppBase::iRedrawFrames = 0;
+std::atomic<Uint32> EasyAppBase::iRedrawEventType = 0;
+std::atomic<int64_t> EasyAppBase::iAnimateUntil = 0;
+std::mutex EasyAppBase::redrawMutex;
+std::vector<EventHandler::Event> EasyAppBase::vRedrawEvents;
+EventHandler::Event EasyAppBase::eRedrawEventsChanged = EventHandler::CreateEvent("Redraw Events Changed", EventHandler::auto_reset);
 
 std::function<void()> EasyAppBase::mainRenderer = nullptr;
 
 SharedRecursiveMutex EasyAppBase::mtx;
 json::document EasyAppBase::jSaveData;
+std::string EasyAppBase::sSettingsFile;
+size_t EasyAppBase::iSettingsHash = 0;
+EventHandler::Event EasyAppBase::eSettingsChanged = EventHandler::CreateEvent("Settings Changed", EventHandler::auto_reset);
 SDL_Window* EasyAppBase::window = nullptr;
 std::map<std::string, std::shared_ptr<EasyAppBase>> EasyAppBase::registry;
 
+// A drag or resize produces a burst of changes; write once things have been quiet this long, but at least this often.
+static constexpr auto settingsQuietTime = 500ms;
+static constexpr auto settingsMaxDelay = 5s;
+
+namespace
+{
+	// Where the time to first frame goes.  Run() marks each step on the main thread; work moved to other threads adds
+	// its own span, so overlapping stages show up as such.  Spans also go to a running Trace capture.
+	class StartupTimeline
+	{
+		public:
+			void Begin()
+			{
+				std::lock_guard lock(mtx);
+				vSpans.clear();
+				start = last = SteadyNow();
+			}
+
+			// Main thread: the stage that ran from the previous Mark() until now.
+			void Mark(const char * sStage)
+			{
+				auto now = SteadyNow();
+				Add(sStage, last, now);
+				last = now;
+			}
+
+			// Any thread.  sStage must be a literal.
+			void Add(const char * sStage, std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+			{
+				if (Trace::Active()) {
+					Trace::Complete(sStage, "startup", Trace::ToTrace(from), Trace::ToTrace(to) - Trace::ToTrace(from));
+				}
+				std::lock_guard lock(mtx);
+				vSpans.push_back({sStage, from, to});
+			}
+
+			void Report(const char * sMilestone)
+			{
+				std::vector<Span> vSorted;
+				{
+					std::lock_guard lock(mtx);
+					vSorted = vSpans;
+				}
+				std::ranges::stable_sort(vSorted, {}, &Span::from);
+				auto Ms = [](auto duration) { return std::chrono::duration<double, std::milli>(duration).count(); };
+				std::string sReport;
+				char szLine[160];
+				for (auto & span : vSorted) {
+					snprintf(szLine, sizeof(szLine), "\n\t%8.1f ms %8.1f ms  %s", Ms(span.from - start), Ms(span.to - span.from), span.sStage);
+					sReport += szLine;
+				}
+				snprintf(szLine, sizeof(szLine), "%.1f ms", Ms(SteadyNow() - start));
+				Log(AppLogger::INFO) << "Startup: " << sMilestone << " after " << szLine << " (start, duration, stage):" << sReport;
+			}
+
+		private:
+			struct Span
+			{
+				const char * sStage;
+				std::chrono::steady_clock::time_point from;
+				std::chrono::steady_clock::time_point to;
+			};
+
+			std::mutex mtx;
+			std::vector<Span> vSpans;
+			std::chrono::steady_clock::time_point start;
+			std::chrono::steady_clock::time_point last;
+	};
+
+	StartupTimeline startupTimeline;
+}
+
 EasyAppBase::EasyAppBase(const std::string & sNameIn, const std::string & sTitleIn) : sName(sNameIn), sTitle(sTitleIn)
 {
 
@@ -74,6 +163,25 @@ EasyAppBase::EasyAppBase(std::string && sNameIn, std::string && sTitleIn) : sNam
 
 }
 
+void EasyAppBase::Show(bool bShow)
+{
+	if (bShown.exchange(bShow) == bShow) {
+		return;
+	}
+	{
+		RecursiveExclusiveLock lock(mtx);
+		jSaveData["show"][sName] = bShow;
+	}
+	SaveSettings();
+	RequestRedraw();
+}
+
+void EasyAppBase::LoadWindowState()
+{
+	RecursiveExclusiveLock lock(mtx);
+	bShown = jSaveData["show"][sName].boolean();
+}
+
 bool EasyAppBase::SettingsTreeEntry::operator<(const SettingsTreeEntry & rhs) const
 {
 	return sName < rhs.sName;
@@ -104,8 +212,123 @@ void EasyAppBase::SetNetworkThreads(int iSetTo)
 	iNetworkThreads = iSetTo;
 }
 
+void EasyAppBase::AddSDLSubsystems(Uint32 iFlags)
+{
+	iSDLSubsystems |= iFlags;
+}
+
+void EasyAppBase::SetIdleRendering(bool bEnable, double dIdleFPSIn)
+{
+	bIdleRendering = bEnable;
+	dIdleFPS = std::max(dIdleFPSIn, 0.0);
+	RequestRedraw();
+}
+
+void EasyAppBase::KeepRendering(int iFrames)
+{
+	int iCurrent = iRedrawFrames;
+	while (iCurrent < iFrames && !iRedrawFrames.compare_exchange_weak(iCurrent, iFrames)) {
+	}
+}
+
+void EasyAppBase::RequestRedraw(int iFrames)
+{
+	KeepRendering(iFrames);
+	Uint32 iType = iRedrawEventType;
+	if (iType) {
+		SDL_Event event = {};
+		event.type = iType;
+		SDL_PushEvent(&event);
+	}
+}
+
+void EasyAppBase::RedrawOn(EventHandler::Event e)
+{
+	if (!e || e->Type() != EventHandler::auto_reset) {
+		// A manual_reset event stays set after the wait, so the watcher would never block again.
+		Log(AppLogger::ERROR) << "EasyAppBase::RedrawOn Ignoring " << (e ? e->Name() : std::string("null event")) << ": only auto_reset events can trigger redraws.";
+		return;
+	}
+	{
+		std::lock_guard lock(redrawMutex);
+		vRedrawEvents.push_back(std::move(e));
+	}
+	EventHandlerSet(eRedrawEventsChanged);
+}
+
+void EasyAppBase::Animate(std::chrono::milliseconds duration)
+{
+	int64_t iUntil = (std::chrono::steady_clock::now() + duration).time_since_epoch().count();
+	int64_t iCurrent = iAnimateUntil;
+	while (iCurrent < iUntil && !iAnimateUntil.compare_exchange_weak(iCurrent, iUntil)) {
+	}
+	RequestRedraw();
+}
+
+bool EasyAppBase::WaitForWork(SDL_Event & event)
+{
+	// ImGui needs a couple of frames to settle after any change, and an active widget (text cursor, drag) keeps animating.
+	if (!bIdleRendering || iRedrawFrames > 0 || ImGui::IsAnyItemActive() || std::chrono::steady_clock::now().time_since_epoch().count() < iAnimateUntil) {
+		return false;
+	}
+	if (dIdleFPS <= 0.0) {
+		return SDL_WaitEvent(&event) == 1;
+	}
+	return SDL_WaitEventTimeout(&event, std::max(1, static_cast<int>(1000.0 / dIdleFPS))) == 1;
+}
+
+void EasyAppBase::SaveSettings()
+{
+	EventHandlerSet(eSettingsChanged);
+}
+
+bool EasyAppBase::WriteSettings()
+{
+	TRACE_ZONE_CAT("Write Settings", "settings");
+	std::string sData;
+	{
+		RecursiveSharedLock lock(mtx);
+		sData = jSaveData.write(true);
+	}
+	size_t iHash = std::hash<std::string>{}(sData);
+	if (iHash == iSettingsHash) {
+		return true;
+	}
+	if (!WriteFileAtomic(sSettingsFile, sData)) {
+		Log(AppLogger::WARNING) << "Failed to save settings: " << sSettingsFile;
+		return false;
+	}
+	iSettingsHash = iHash;
+	Log(AppLogger::DEBUG) << "Saved settings: " << sSettingsFile;
+	return true;
+}
+
+void EasyAppBase::SettingsWriter(std::stop_token stoken)
+{
+	while (!stoken.stop_requested()) {
+		if (EventHandlerWait({eQuit, eSettingsChanged}, EventHandler::INFINITE) != 1) {
+			return;
+		}
+		auto deadline = SteadyNow() + settingsMaxDelay;
+		int iRet = 1;
+		while (iRet == 1 && SteadyNow() < deadline) {
+			iRet = EventHandlerWait({eQuit, eSettingsChanged}, settingsQuietTime);
+		}
+		if (iRet == 0 || iRet == EventHandler::EXIT_ALL) {
+			return; // Run() writes the final copy.
+		}
+		WriteSettings();
+	}
+}
+
 int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 {
+	// EASYAPPBASE_TRACE=<file.json|file.pftrace> captures everything from startup until exit.
+	if (const char * szTrace = std::getenv("EASYAPPBASE_TRACE"); szTrace && *szTrace) {
+		Trace::Start(szTrace);
+	}
+	startupTimeline.Begin();
+	sTraceFile = GetAppDataFolder() + sAppName + "/trace.json";
 	if (bDisableGUI) {
 		AppLogger::CloneToCout(true);
 	}
@@ -124,26 +347,70 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 		}
 	}
 
+	startupTimeline.Mark("App data folder");
+
+	// settings.json is parsed while the network core and SDL start up.  Nothing touches jSaveData until
+	// WaitForSettings(), which also starts the writer, since it needs the loaded content's hash.
+	sSettingsFile = GetAppDataFolder() + sAppName + "/settings.json";
+	Thread settingsLoader = THREAD("EasyAppBase::LoadSettings", [](std::stop_token /*stoken*/)
 	{
+		auto start = SteadyNow();
 		RecursiveExclusiveLock lock(mtx);
-		if (jSaveData.parseFile(GetAppDataFolder() + sAppName + "/settings.json")) {
-			Log(AppLogger::INFO) << "Opened settings: " << GetAppDataFolder() << sAppName << "/settings.json";
+		if (jSaveData.parseFile(sSettingsFile)) {
+			Log(AppLogger::INFO) << "Opened settings: " << sSettingsFile;
 		} else {
-			Log(AppLogger::WARNING) << "Failed toopen settings: " << GetAppDataFolder() << sAppName << "/settings.json";
+			Log(AppLogger::WARNING) << "Failed toopen settings: " << sSettingsFile;
 		}
-	}
+		iSettingsHash = std::hash<std::string>{}(jSaveData.write(true));
+		// Windows registered before Run() cached their flags from an empty document.
+		for (auto & window : registry | std::views::values) {
+			window->LoadWindowState();
+		}
+		startupTimeline.Add("Load settings", start, SteadyNow());
+	});
+	Thread settingsWriter;
+	auto WaitForSettings = [&]()
+	{
+		if (settingsLoader.joinable()) {
+			settingsLoader.join();
+			settingsWriter = THREAD("EasyAppBase::SettingsWriter", SettingsWriter);
+			startupTimeline.Mark("Wait for settings");
+		}
+	};
+	// Early returns join both first.  A Thread that goes out of scope while its function still runs leaves the last
+	// reference with the thread itself, which then cannot join itself.  ExitAll() has already woken the writer.
+	auto JoinSettingsThreads = [&]()
+	{
+		if (settingsLoader.joinable()) {
+			settingsLoader.join();
+		}
+		if (settingsWriter.joinable()) {
+			settingsWriter.request_stop();
+			settingsWriter.join();
+		}
+	};
 
-	Network::Core(iNetworkThreads);
+	Network::Core(iNetworkThreads); // The CA bundle is read on a worker thread.
+	startupTimeline.Mark("Network::Core");
 
 	if (bDisableGUI) {
+		WaitForSettings();
+		startupTimeline.Report("Ready");
 		EventHandlerWait({eQuit}, EventHandler::INFINITE);
 	} else {
-		// Setup SDL
-		if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
+		// Setup SDL.  Game controllers are only used for ImGui's gamepad navigation, and scanning for them can take
+		// longer than everything else here, so they start after the first frame.
+		if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS | SDL_INIT_TIMER | iSDLSubsystems) != 0)
 		{
 			printf("Error: %s\n", SDL_GetError());
+			ExitAll();
+			JoinSettingsThreads();
 			return -1;
 		}
+		Uint32 iEventType = SDL_RegisterEvents(1);
+		if (iEventType != static_cast<Uint32>(-1)) {
+			iRedrawEventType = iEventType;
+		}
 
 		// Decide GL+GLSL versions
 	#if defined(IMGUI_IMPL_OPENGL_ES2)
@@ -178,6 +445,9 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 		SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
 		SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
 		SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+		startupTimeline.Mark("SDL_Init");
+
+		WaitForSettings();
 
 		int iX = SDL_WINDOWPOS_CENTERED;
 		int iY = SDL_WINDOWPOS_CENTERED;
@@ -186,7 +456,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 
 		auto window_flags = static_cast<SDL_WindowFlags>(SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
 		{
-			RecursiveSharedLock lock(mtx);
+			RecursiveExclusiveLock lock(mtx); // operator[] adds missing keys, and the settings writer may be serialising.
 			if (jSaveData["main_window"].exists("x")) {
 				iX = jSaveData["main_window"]["x"]._int();
 			}
@@ -212,12 +482,16 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 		if (window == nullptr)
 		{
 			printf("Error: SDL_CreateWindow(): %s\n", SDL_GetError());
+			ExitAll();
+			JoinSettingsThreads();
 			return -1;
 		}
+		startupTimeline.Mark("SDL_CreateWindow");
 
 		SDL_GLContext gl_context = SDL_GL_CreateContext(window);
 		SDL_GL_MakeCurrent(window, gl_context);
 		SDL_GL_SetSwapInterval(1); // Enable vsync
+		startupTimeline.Mark("GL context");
 
 		// Setup Dear ImGui context
 		IMGUI_CHECKVERSION();
@@ -226,18 +500,26 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 		std::string sIniFileName = GetAppDataFolder() + sAppName + "/imgui.ini";
 		io.IniFilename = sIniFileName.c_str();
 		Log(AppLogger::DEBUG) << "Set ImGui ini file to: " << sIniFileName;
+		startupTimeline.Mark("ImGui context");
 
-		io.Fonts->AddFontFromMemoryCompressedTTF(HackFont_compressed_data, HackFont_compressed_size, 12);
-		io.Fonts->AddFontFromMemoryCompressedTTF(HackFont_compressed_data, HackFont_compressed_size, 18);
-		io.Fonts->AddFontFromMemoryCompressedTTF(HackFont_compressed_data, HackFont_compressed_size, 27);
-		io.Fonts->AddFontFromMemoryCompressedTTF(HackFont_compressed_data, HackFont_compressed_size, 36);
-		io.Fonts->AddFontFromMemoryCompressedTTF(HackFont_compressed_data, HackFont_compressed_size, 45);
-
-		if (!jSaveData.exists("font_size")) {
-			jSaveData["font_size"] = 1;
+		int iFontSize;
+		{
+			RecursiveExclusiveLock lock(mtx);
+			if (!jSaveData.exists("font_size")) {
+				jSaveData["font_size"] = 1;
+				SaveSettings();
+			}
+			iFontSize = jSaveData["font_size"]._int();
 		}
 
-		io.FontDefault = io.Fonts->Fonts[*jsonTypedRefTSSh<int>(jSaveData["font_size"], mtx)];
+		// Rasterise at the framebuffer's density so text stays sharp on HiDPI displays.
+		int iWindowWidth = 0;
+		int iDrawableWidth = 0;
+		SDL_GetWindowSize(window, &iWindowWidth, nullptr);
+		SDL_GL_GetDrawableSize(window, &iDrawableWidth, nullptr);
+		Fonts::CacheFolder(GetAppDataFolder() + sAppName);
+		Fonts::Init(iFontSize, iWindowWidth > 0 ? static_cast<float>(iDrawableWidth) / static_cast<float>(iWindowWidth) : 1.0f);
+		startupTimeline.Mark("Fonts");
 
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
@@ -252,7 +534,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 
 		// Setup Dear ImGui style
 		{
-			RecursiveSharedLock lock(mtx);
+			RecursiveExclusiveLock lock(mtx);
 			switch(jSaveData["style"]._int()) {
 				case 0:
 				default:
@@ -298,6 +580,9 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 		// Setup Platform/Renderer backends
 		ImGui_ImplSDL2_InitForOpenGL(window, gl_context);
 		ImGui_ImplOpenGL3_Init(glsl_version);
+		FrameProfiler::Init();
+		FrameProfiler::TraceFile(GetAppDataFolder() + sAppName + "/frame_trace.json");
+		startupTimeline.Mark("ImGui style and backends");
 
 		// Our state
 		ImVec4 clear_color = ImVec4(0.0, 0.0, 0.0, 1.0);
@@ -308,6 +593,27 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 		}
 
 		StartAll();
+		startupTimeline.Mark("StartAll");
+
+		bool bFirstFrame = true;
+		// Runs whether or not idle rendering is on yet; SetIdleRendering() can be called at any time.
+		Thread redrawWatcher = THREAD("EasyAppBase::RedrawWatcher", [](std::stop_token stoken)
+		{
+			while (!stoken.stop_requested()) {
+				std::vector<EventHandler::Event> vEvents = {eQuit, eRedrawEventsChanged};
+				{
+					std::lock_guard lock(redrawMutex);
+					vEvents.insert(vEvents.end(), vRedrawEvents.begin(), vRedrawEvents.end());
+				}
+				int iRet = EventHandlerWait(vEvents, EventHandler::INFINITE);
+				if (iRet == 0 || iRet == EventHandler::EXIT_ALL) {
+					break;
+				}
+				if (iRet > 1) {
+					RequestRedraw();
+				}
+			}
+		});
 
 		// ImGui::LoadIniSettingsFromDisk(io.IniFilename);
 
@@ -321,8 +627,14 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 	#endif
 		{
 			SDL_Event event;
-			while (SDL_PollEvent(&event))
+			bool bWaited = WaitForWork(event);
+			while (bWaited || SDL_PollEvent(&event))
 			{
+				bWaited = false;
+				KeepRendering(3);
+				if (event.type == iRedrawEventType) {
+					continue;
+				}
 				ImGui_ImplSDL2_ProcessEvent(&event);
 
 				if (event.type == SDL_QUIT) {
@@ -338,6 +650,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 							RecursiveExclusiveLock lock(mtx);
 							jSaveData["main_window"]["x"] = event.window.data1;
 							jSaveData["main_window"]["y"] = event.window.data2;
+							SaveSettings();
 							break;
 						}
 
@@ -347,6 +660,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 							RecursiveExclusiveLock lock(mtx);
 							jSaveData["main_window"]["w"] = event.window.data1;
 							jSaveData["main_window"]["h"] = event.window.data2;
+							SaveSettings();
 							break;
 						}
 
@@ -354,6 +668,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 						{
 							RecursiveExclusiveLock lock(mtx);
 							jSaveData["main_window"]["state"] = "maximized";
+							SaveSettings();
 							break;
 						}
 
@@ -361,6 +676,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 						{
 							RecursiveExclusiveLock lock(mtx);
 							jSaveData["main_window"]["state"] = "minimized";
+							SaveSettings();
 							break;
 						}
 
@@ -371,6 +687,7 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 							SDL_SetWindowPosition(window, jSaveData["main_window"]["x"]._int(), jSaveData["main_window"]["y"]._int());
 							SDL_SetWindowSize(window, jSaveData["main_window"]["w"]._int(), jSaveData["main_window"]["h"]._int());
 							jSaveData["main_window"]["state"] = "";
+							SaveSettings();
 							break;
 						}
 
@@ -404,20 +721,37 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 				}*/
 			}
 
+			FrameProfiler::BeginFrame();
+			if (Fonts::Update()) {
+				ImGui_ImplOpenGL3_DestroyFontsTexture();
+				ImGui_ImplOpenGL3_CreateFontsTexture();
+			}
 			ImGui_ImplOpenGL3_NewFrame();
 			ImGui_ImplSDL2_NewFrame();
 			ImGui::NewFrame();
 
-			Render();
+			{
+				FrameProfiler::Scope scope("EasyAppBase::Render");
+				Render();
+			}
 
-			ImGui::Render();
+			{
+				FrameProfiler::Scope scope("ImGui::Render");
+				ImGui::Render();
+			}
 			glViewport(0, 0, static_cast<int>(io.DisplaySize.x), static_cast<int>(io.DisplaySize.y));
 			glClearColor(clear_color.x * clear_color.w, clear_color.y * clear_color.w, clear_color.z * clear_color.w, clear_color.w);
 			glClear(GL_COLOR_BUFFER_BIT);
-			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+			{
+				FrameProfiler::Scope scope("ImGui_ImplOpenGL3_RenderDrawData");
+				FrameProfiler::GPUBegin("RenderDrawData");
+				ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+				FrameProfiler::GPUEnd();
+			}
 
 			if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 			{
+				FrameProfiler::Scope scope("Platform Windows");
 				SDL_Window* backup_current_window = SDL_GL_GetCurrentWindow();
 				SDL_GLContext backup_current_context = SDL_GL_GetCurrentContext();
 				ImGui::UpdatePlatformWindows();
@@ -425,36 +759,60 @@ int EasyAppBase::Run(const std::string & sAppName, const std::string & sTitle)
 				SDL_GL_MakeCurrent(backup_current_window, backup_current_context);
 			}
 
-			SDL_GL_SwapWindow(window);
+			{
+				FrameProfiler::Scope scope("SDL_GL_SwapWindow");
+				SDL_GL_SwapWindow(window);
+			}
+			FrameProfiler::EndFrame();
+			if (iRedrawFrames > 0) {
+				--iRedrawFrames;
+			}
+			if (bFirstFrame) {
+				bFirstFrame = false;
+				startupTimeline.Mark("First frame");
+				startupTimeline.Report("First frame");
+				if (!(iSDLSubsystems & SDL_INIT_GAMECONTROLLER) && SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) != 0) {
+					Log(AppLogger::WARNING) << "Game controller support unavailable: " << SDL_GetError();
+				}
+			}
 		}
 
 	#ifdef __EMSCRIPTEN__
 		EMSCRIPTEN_MAINLOOP_END;
 	#endif
 
+		// Joined here, before SDL goes away: left to ~Thread, a watcher still in EventHandlerWait would drop the last
+		// reference on its own thread and join itself.  The loop may have ended without eQuit, so wake it directly.
+		redrawWatcher.request_stop();
+		EventHandlerSet(eRedrawEventsChanged);
+		redrawWatcher.join();
+
 		StopAll();
 
 		// Cleanup
 		ImGui::SaveIniSettingsToDisk(io.IniFilename);
+		FrameProfiler::Shutdown();
 		ImGui_ImplOpenGL3_Shutdown();
 		ImGui_ImplSDL2_Shutdown();
 		ImGui::DestroyContext();
 
 		SDL_GL_DeleteContext(gl_context);
 		SDL_DestroyWindow(window);
+		iRedrawEventType = 0;
 		SDL_Quit();
 	}
 
 	Network::ExitAll();
 	EventHandler::ExitAll();
 
-	RecursiveExclusiveLock lock(mtx);
-	if (jSaveData.writeFile(GetAppDataFolder() + sAppName + "/settings.json", true)) {
-		Log(AppLogger::INFO) << "Saved settings: " << GetAppDataFolder() << sAppName << "/settings.json";
-	} else {
-		Log(AppLogger::WARNING) << "Failed to save settings: " << GetAppDataFolder() << sAppName << "/settings.json";
+	if (settingsWriter.joinable()) {
+		settingsWriter.join();
+	}
+	if (WriteSettings()) {
+		Log(AppLogger::INFO) << "Saved settings: " << sSettingsFile;
 	}
 
+	Trace::Stop();
 	return 0;
 }
 
@@ -472,9 +830,17 @@ void EasyAppBase::Render()
 	ImGui::PopStyleVar(2);
 
 	if (mainRenderer) {
+		FrameProfiler::Scope scope("Main Renderer");
 		mainRenderer();
 	}
 
+	if (bShowFrameProfiler) {
+		FrameProfiler::RenderOverlay(&bShowFrameProfiler);
+		if (!bShowFrameProfiler) {
+			FrameProfiler::Enable(false);
+		}
+	}
+
 	if (bShowEasyAbout) {
 		ImGui::OpenPopup("About EasyAppBase");
 		auto size = viewport->Size;
@@ -490,9 +856,15 @@ void EasyAppBase::Render()
 	}
 
 	if (ImGui::BeginPopupModal("About EasyAppBase", nullptr, ImGuiWindowFlags_AlwaysAutoResize)) {
-		ImGui::PushFont(io.Fonts->Fonts[4]);
+		// The largest size may not be in the atlas yet; asking for it queues it for the next frame.
+		ImFont * titleFont = Fonts::Get(static_cast<int>(Fonts::vSizes.size()) - 1);
+		if (titleFont) {
+			ImGui::PushFont(titleFont);
+		}
 		ImGui::Text("EasyAppBase v%s (%s)", EASY_APP_VERSION_STRING, EASY_APP_BUILD_DATE);
-		ImGui::PopFont();
+		if (titleFont) {
+			ImGui::PopFont();
+		}
 		ImGui::BeginChild("##EasyLicence", {0, 0}, ImGuiChildFlags_FrameStyle | ImGuiChildFlags_AutoResizeY);
 		ImGui::TextWrapped(EASY_APP_LICENSE);
 		ImGui::EndChild();
@@ -593,7 +965,8 @@ void EasyAppBase::Render()
 			}
 		}
 		for (auto & window : registry) {
-			bool bShow = jSaveData["show"][window.first].boolean();
+			bool bShow = window.second->Shown();
+			FrameProfiler::Scope scope(window.second->Title());
 			if (window.second->BuildsOwnWindow()) {
 				window.second->Render(&bShow);
 			} else {
@@ -609,7 +982,7 @@ void EasyAppBase::Render()
 					ImGui::End();
 				}
 			}
-			jSaveData["show"][window.first] = bShow;
+			window.second->Show(bShow);
 		}
 		if (!bDisableDocking) {
 			ImGui::EndChild();
@@ -646,6 +1019,7 @@ refTSEx<json::value> EasyAppBase::SharedGlobalSettings()
 
 void EasyAppBase::ExitAll() {
 	EventHandlerSet(eQuit);
+	RequestRedraw(); // Wake Run() if it is sleeping in SDL_WaitEvent.
 }
 
 void EasyAppBase::StopAll()
@@ -680,6 +1054,7 @@ void EasyAppBase::Menu()
 
 		if (ImGui::MenuItem("Fullscreen", "F11", jSaveData["main_window"]["fullscreen"].boolean())) {
 			jSaveData["main_window"]["fullscreen"] = !jSaveData["main_window"]["fullscreen"].boolean();
+			SaveSettings();
 			if (jSaveData["main_window"]["fullscreen"].boolean()) {
 				SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN_DESKTOP);
 			} else {
@@ -692,29 +1067,29 @@ void EasyAppBase::Menu()
 		ImGui::Separator();
 
 		if (ImGui::MenuItem("Scale: Extra Small", nullptr, jSaveData["font_size"] == 0)) {
-			ImGuiIO& io = ImGui::GetIO(); (void)io;
-			io.FontDefault = io.Fonts->Fonts[0];
+			Fonts::Select(0);
 			jSaveData["font_size"] = 0;
+			SaveSettings();
 		}
 		if (ImGui::MenuItem("Scale: Small", nullptr, jSaveData["font_size"] == 1)) {
-			ImGuiIO& io = ImGui::GetIO(); (void)io;
-			io.FontDefault = io.Fonts->Fonts[1];
+			Fonts::Select(1);
 			jSaveData["font_size"] = 1;
+			SaveSettings();
 		}
 		if (ImGui::MenuItem("Scale: Default", nullptr, jSaveData["font_size"] == 2)) {
-			ImGuiIO& io = ImGui::GetIO(); (void)io;
-			io.FontDefault = io.Fonts->Fonts[2];
+			Fonts::Select(2);
 			jSaveData["font_size"] = 2;
+			SaveSettings();
 		}
 		if (ImGui::MenuItem("Scale: Large", nullptr, jSaveData["font_size"] == 3)) {
-			ImGuiIO& io = ImGui::GetIO(); (void)io;
-			io.FontDefault = io.Fonts->Fonts[3];
+			Fonts::Select(3);
 			jSaveData["font_size"] = 3;
+			SaveSettings();
 		}
 		if (ImGui::MenuItem("Scale: Extra Large", nullptr, jSaveData["font_size"] == 4)) {
-			ImGuiIO& io = ImGui::GetIO(); (void)io;
-			io.FontDefault = io.Fonts->Fonts[4];
+			Fonts::Select(4);
 			jSaveData["font_size"] = 4;
+			SaveSettings();
 		}
 
 		ImGui::Separator();
@@ -723,16 +1098,34 @@ void EasyAppBase::Menu()
 			ImGuiIO& io = ImGui::GetIO(); (void)io;
 			ImGui::StyleColorsDark();
 			jSaveData["style"] = 0;
+			SaveSettings();
 		}
 		if (ImGui::MenuItem("Style: Light", nullptr, jSaveData["style"] == 1)) {
 			ImGuiIO& io = ImGui::GetIO(); (void)io;
 			ImGui::StyleColorsLight();
 			jSaveData["style"] = 1;
+			SaveSettings();
 		}
 		if (ImGui::MenuItem("Style: Dark", nullptr, jSaveData["style"] == 2)) {
 			ImGuiIO& io = ImGui::GetIO(); (void)io;
 			ImGui::StyleColorsClassic();
 			jSaveData["style"] = 2;
+			SaveSettings();
+		}
+
+		ImGui::Separator();
+
+		if (ImGui::MenuItem("Frame Profiler", nullptr, bShowFrameProfiler)) {
+			bShowFrameProfiler = !bShowFrameProfiler;
+			FrameProfiler::Enable(bShowFrameProfiler);
+		}
+
+		if (ImGui::MenuItem("Capture Trace", nullptr, Trace::Active())) {
+			if (Trace::Active()) {
+				Trace::Stop();
+			} else {
+				Trace::Start(sTraceFile);
+			}
 		}
 
 		ImGui::End();
@@ -743,11 +1136,10 @@ void EasyAppBase::Menu()
 		if (!registry.empty()) {
 			if (ImGui::BeginMenu("Windows"))	{
 				for (auto & window : registry) {
-					bool bShow = jSaveData["show"][window.first].boolean();
+					bool bShow = window.second->Shown();
 					if (ImGui::MenuItem(window.second->Name().c_str(), "", bShow)) {
-						bShow = !bShow;
+						window.second->Show(!bShow);
 					}
-					jSaveData["show"][window.first] = bShow;
 				}
 				ImGui::EndMenu();
 			}
@@ -773,10 +1165,17 @@ void EasyAppBase::Menu()
 
 refTSSh<json::value> EasyAppBase::SharedSettings(const std::string & sName)
 {
-	return {jSaveData["sub"][sName], mtx};
+	json::value * pSettings;
+	{
+		RecursiveExclusiveLock lock(mtx); // operator[] adds the entry the first time.
+		pSettings = &jSaveData["sub"][sName];
+	}
+	return {*pSettings, mtx};
 }
 
 refTSEx<json::value> EasyAppBase::ExclusiveSettings(const std::string & sName)
 {
+	RecursiveExclusiveLock lock(mtx); // Held until the returned reference has taken its own.
+	SaveSettings(); // The writer waits for this lock to be released, so it sees whatever the caller changes.
 	return {jSaveData["sub"][sName], mtx};
 }
@@ -29,6 +29,7 @@
 #include "utils.hpp"
 #include "data.hpp"
 #include "eventhandler.hpp"
+#include "fonts.hpp"
 #include "network.hpp"
 #include "thread.hpp"
 #include "shared_recursive_mutex.hpp"
@@ -68,12 +69,22 @@ class EasyAppBase
 
 		[[nodiscard]] const std::string & Name() const { return sName; }
 		[[nodiscard]] const std::string & Title() const { return sTitle; }
+		[[nodiscard]] bool Shown() const { return bShown; }
+		void Show(bool bShow); // Any thread.  Persisted with the rest of the settings.
 
 		static void DisableDemo(bool bDisable);
 		static void DisableDocking(bool bDisable);
 		static void DisableViewports(bool bDisable);
 		static void DisableGUI(bool bDisable);
 		static void SetNetworkThreads(int iSetTo);
+		static void AddSDLSubsystems(Uint32 iFlags); // SDL_INIT_* beyond video, events and timer (e.g. SDL_INIT_AUDIO) for Run() to initialise.
+
+		// Idle rendering: rather than drawing every vsync, Run() sleeps until input arrives, a redraw is requested,
+		// an animation is running or a RedrawOn() event is set.  Otherwise it draws at dIdleFPS (0 = only on demand).
+		static void SetIdleRendering(bool bEnable, double dIdleFPSIn = 1.0);
+		static void RequestRedraw(int iFrames = 2); // Any thread.
+		static void RedrawOn(EventHandler::Event e); // Redraw when e is set from a background thread.  e must be auto_reset; it is consumed.
+		static void Animate(std::chrono::milliseconds duration); // Draw at full rate for this long.
 
 		static int Run(const std::string & sAppName, const std::string & sTitle = "");
 		static void SetMainRenderer(std::function<void ()> render);
@@ -84,17 +95,25 @@ class EasyAppBase
 		[[nodiscard]] static refTSEx<json::value> ExclusiveGlobalSettings();
 		[[nodiscard]] static refTSEx<json::value> SharedGlobalSettings();
 
+		// Settings are saved by a background thread shortly after they change, not only at exit.  Taking
+		// ExclusiveSettings() schedules a save already; call this after changing settings some other way.  Any thread.
+		static void SaveSettings();
+
 		template <typename T>
 		static std::shared_ptr<EasyAppBase> GenerateWindow()
 			requires(std::derived_from<T, EasyAppBase>)
 		{
 			auto ret = std::make_shared<T>();
-			auto registry = EasyAppBase::Registry();
-			auto it = (*registry).find(ret->Name());
-			if (it == (*registry).end()) {
-				return (*registry)[ret->Name()] = ret;
+			{
+				auto registry = EasyAppBase::Registry();
+				auto it = (*registry).find(ret->Name());
+				if (it != (*registry).end()) {
+					return it->second;
+				}
+				(*registry)[ret->Name()] = ret;
 			}
-			return it->second;
+			ret->LoadWindowState();
+			return ret;
 		}
 
 		static void ExitAll();
@@ -107,27 +126,49 @@ class EasyAppBase
 		static void Render();
 		static void Menu();
 		static void StopAll();
+		static bool WaitForWork(SDL_Event & event);
+		static void KeepRendering(int iFrames);
+		static void SettingsWriter(std::stop_token stoken);
+		static bool WriteSettings();
 
 		static refTSEx<json::value> ExclusiveSettings(const std::string & sName);
 		static refTSSh<json::value> SharedSettings(const std::string & sName);
 
+		void LoadWindowState();
+
 		static EventHandler::Event eQuit;
 		static bool bShowEasyAbout;
+		static bool bShowFrameProfiler;
+		static std::string sTraceFile;
 
 		static bool bDisableDemo;
 		static bool bDisableDocking;
 		static bool bDisableViewports;
 		static bool bDisableGUI;
 		static int iNetworkThreads;
+		static Uint32 iSDLSubsystems;
+
+		static bool bIdleRendering;
+		static double dIdleFPS;
+		static std::atomic<int> iRedrawFrames;
+		static std::atomic<Uint32> iRedrawEventType;
+		static std::atomic<int64_t> iAnimateUntil; // steady_clock ticks.
+		static std::mutex redrawMutex;
+		static std::vector<EventHandler::Event> vRedrawEvents;
+		static EventHandler::Event eRedrawEventsChanged;
 
 		static SharedRecursiveMutex mtx;
 		static json::document jSaveData;
+		static std::string sSettingsFile;
+		static size_t iSettingsHash; // Of the last content written or loaded.  Only the writer touches it.
+		static EventHandler::Event eSettingsChanged;
 
 		static SDL_Window* window;
 		static std::map<std::string, std::shared_ptr<EasyAppBase>> registry;
 
 		std::string sName;
 		std::string sTitle;
+		std::atomic<bool> bShown = false; // Cached jSaveData["show"][sName]; the JSON is only touched when it changes.
 
 		static std::function<void()> mainRenderer;
 };
@@ -24,6 +24,7 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 */
 
 #include "eventhandler.hpp"
+#include "trace.hpp"
 #include <condition_variable>
 #include <map>
 
@@ -62,6 +63,11 @@ namespace EventHandler
 		return sName;
 	}
 
+	event_type EventBase::Type() const
+	{
+		return eType;
+	}
+
 	void EventBase::Waiting()
 	{
 		if (eType == auto_reset) {
@@ -199,15 +205,18 @@ namespace EventHandler
 
 	int Wait(const std::string & sFile, const std::string & sFunc, int iLine, std::vector<Event> vEvents, std::chrono::milliseconds timeout)
 	{
+		// Polls (timeout 0) are not worth a span; real waits show up as blocked time on the waiting thread.
+		Trace::Zone zone(timeout.count() ? "EventHandler::Wait" : nullptr, "wait", timeout.count() && Trace::Active() ? Trace::Intern(sFunc) : nullptr);
 		Map map(sFile, sFunc, iLine, vEvents);
 		std::unique_lock<std::mutex> lck(mtx());
 		while (ExitEvent()->bValue == false) {
 			CleanupAfterWait cleanup(vEvents);
-			size_t i = 0;
+			int i = 0;
 			for (auto & e : vEvents) {
 				if (e->bValue) {
 					return i;
 				}
+				++i;
 			}
 			if (timeout == std::chrono::milliseconds::max()) {
 				cv().wait(lck, [&vEvents] { if (ExitEvent()->bValue) return true; for (auto & e : vEvents) { if (e->bValue) { return true; } } return false; });
@@ -220,10 +229,12 @@ namespace EventHandler
 			if (ExitEvent()->bValue) {
 				return EXIT_ALL;
 			}
+			i = 0;
 			for (auto & e : vEvents) {
 				if (e->bValue) {
 					return i;
 				}
+				++i;
 			}
 			if (timeout.count() == 0) {
 				break;
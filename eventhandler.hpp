@@ -45,6 +45,7 @@ namespace EventHandler
 			void Reset();
 
 			const std::string & Name();
+			event_type Type() const;
 
 		protected:
 			friend class CleanupAfterWait;
@@ -0,0 +1,500 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+#include "fonts.hpp"
+#include "app_logger.hpp"
+#include "trace.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "imgui.h"
+#include "imgui_internal.h"
+
+EASYAPPBASE_EMBEDDED(HackFont_ttf); // fonts/Hack-Regular.ttf
+
+bool Fonts::bLazy = true;
+bool Fonts::bInitialized = false;
+std::string Fonts::sCacheFolder;
+float Fonts::fDensity = 1.0f;
+int Fonts::iSelected = 1;
+bool Fonts::bPending = false;
+std::array<bool, Fonts::vSizes.size()> Fonts::vRequested = {};
+
+namespace
+{
+	constexpr uint32_t iCacheMagic = 0x43464145; // "EAFC"
+	constexpr uint32_t iCacheVersion = 2;
+	constexpr int iMaxTextureSize = 16384;
+
+	template <typename T>
+	void Put(std::string & sOut, const T & value)
+	{
+		sOut.append(reinterpret_cast<const char *>(&value), sizeof(T));
+	}
+
+	void PutBytes(std::string & sOut, const void * pData, size_t iSize)
+	{
+		sOut.append(static_cast<const char *>(pData), iSize);
+	}
+
+	// Bounds-checked reads from a cache file.  Any short read marks the whole file bad.
+	class CacheReader
+	{
+		public:
+			explicit CacheReader(const std::string & sIn) : pNext(sIn.data()), pEnd(sIn.data() + sIn.size()) {}
+
+			template <typename T>
+			T Get()
+			{
+				T value{};
+				Bytes(&value, sizeof(T));
+				return value;
+			}
+
+			void Bytes(void * pOut, size_t iSize)
+			{
+				const char * pData = Take(iSize);
+				if (pData) {
+					memcpy(pOut, pData, iSize);
+				}
+			}
+
+			const char * Take(size_t iSize)
+			{
+				if (!bOK || static_cast<size_t>(pEnd - pNext) < iSize) {
+					bOK = false;
+					return nullptr;
+				}
+				const char * pRet = pNext;
+				pNext += iSize;
+				return pRet;
+			}
+
+			[[nodiscard]] bool OK() const { return bOK; }
+
+		private:
+			const char * pNext;
+			const char * pEnd;
+			bool bOK = true;
+	};
+
+	struct CachedFont
+	{
+		int iFace = 0;
+		int iSize = 0;
+		float fFontSize = 0.0f;
+		float fAscent = 0.0f;
+		float fDescent = 0.0f;
+		int iMetricsTotalSurface = 0;
+		std::vector<ImFontGlyph> vGlyphs;
+	};
+
+	uint64_t HashBytes(const void * pData, size_t iSize)
+	{
+		// FNV-1a.
+		uint64_t iRet = 0xcbf29ce484222325ull;
+		auto pBytes = static_cast<const unsigned char *>(pData);
+		for (size_t i = 0; i < iSize; ++i) {
+			iRet = (iRet ^ pBytes[i]) * 0x100000001b3ull;
+		}
+		return iRet ? iRet : 1;
+	}
+}
+
+std::vector<Fonts::Face> & Fonts::Faces()
+{
+	static std::vector<Face> vFaces = []()
+	{
+		std::vector<Face> vRet(1);
+		vRet[0].sName = "Hack";
+		vRet[0].pData = HackFont_ttf;
+		vRet[0].iSize = HackFont_ttf_size;
+		vRet[0].vSizes.assign(vSizes.begin(), vSizes.end());
+		vRet[0].vFonts.resize(vSizes.size(), nullptr);
+		return vRet;
+	}();
+	return vFaces;
+}
+
+void Fonts::Lazy(bool bLazyIn)
+{
+	bLazy = bLazyIn;
+}
+
+void Fonts::CacheFolder(const std::string & sFolder)
+{
+	sCacheFolder = sFolder;
+}
+
+void Fonts::Register(const std::string & sName, const void * pData, size_t iSize, std::vector<float> vPixelSizes)
+{
+	if (!pData || !iSize || vPixelSizes.empty()) {
+		Log(AppLogger::WARNING) << "Ignoring empty font registration: " << sName;
+		return;
+	}
+	auto & vFaces = Faces();
+	auto it = std::find_if(vFaces.begin(), vFaces.end(), [&](const Face & face) { return face.sName == sName; });
+	if (it == vFaces.end()) {
+		it = vFaces.insert(vFaces.end(), Face{});
+		it->sName = sName;
+	}
+	it->pData = pData;
+	it->iSize = iSize;
+	it->iHash = 0;
+	it->vSizes = std::move(vPixelSizes);
+	it->vFonts.assign(it->vSizes.size(), nullptr);
+	if (bInitialized) {
+		bPending = true;
+	}
+}
+
+ImFont * Fonts::Get(const std::string & sName, float fPixelSize)
+{
+	for (auto & face : Faces()) {
+		if (face.sName == sName) {
+			for (size_t i = 0; i < face.vSizes.size(); ++i) {
+				if (face.vSizes[i] == fPixelSize) {
+					return face.vFonts[i];
+				}
+			}
+		}
+	}
+	return nullptr;
+}
+
+int Fonts::Selected()
+{
+	return iSelected;
+}
+
+ImFont * Fonts::Get(int iSize)
+{
+	if (iSize < 0 || iSize >= static_cast<int>(vSizes.size())) {
+		return nullptr;
+	}
+	ImFont * font = Faces()[0].vFonts[iSize];
+	if (!font && !vRequested[iSize]) {
+		vRequested[iSize] = true;
+		bPending = true;
+	}
+	return font;
+}
+
+std::vector<Fonts::Slot> Fonts::Wanted()
+{
+	auto & vFaces = Faces();
+	std::vector<Slot> vRet;
+	for (int i = 0; i < static_cast<int>(vSizes.size()); ++i) {
+		if (!bLazy || i == iSelected || vRequested[i] || vFaces[0].vFonts[i]) {
+			vRet.push_back({0, i});
+		}
+	}
+	for (int iFace = 1; iFace < static_cast<int>(vFaces.size()); ++iFace) {
+		for (int i = 0; i < static_cast<int>(vFaces[iFace].vSizes.size()); ++i) {
+			vRet.push_back({iFace, i});
+		}
+	}
+	return vRet;
+}
+
+void Fonts::Init(int iSize, float fDensityIn)
+{
+	TRACE_ZONE_CAT("Fonts::Init", "fonts");
+	fDensity = fDensityIn > 0.0f ? fDensityIn : 1.0f;
+	iSelected = std::clamp(iSize, 0, static_cast<int>(vSizes.size()) - 1);
+	vRequested.fill(false);
+	bPending = false;
+	bInitialized = true;
+
+	std::vector<Slot> vWanted = Wanted();
+	ImFontAtlas * atlas = ImGui::GetIO().Fonts;
+	if (LoadCache(atlas, vWanted)) {
+		Log(AppLogger::DEBUG) << "Loaded font atlas from cache: " << CacheFile();
+	} else {
+		Build(atlas, vWanted);
+		SaveCache(atlas, vWanted);
+	}
+	ImGui::GetIO().FontDefault = Faces()[0].vFonts[iSelected];
+}
+
+void Fonts::Select(int iSize)
+{
+	iSelected = std::clamp(iSize, 0, static_cast<int>(vSizes.size()) - 1);
+	if (ImFont * font = Faces()[0].vFonts[iSelected]) {
+		ImGui::GetIO().FontDefault = font;
+	} else {
+		vRequested[iSelected] = true;
+		bPending = true;
+	}
+}
+
+bool Fonts::Update()
+{
+	if (!bPending) {
+		return false;
+	}
+	bPending = false;
+	std::vector<Slot> vWanted = Wanted();
+	vRequested.fill(false);
+	// The cache only holds what startup needs; sizes picked later are built on the spot.
+	Build(ImGui::GetIO().Fonts, vWanted);
+	ImGui::GetIO().FontDefault = Faces()[0].vFonts[iSelected];
+	return true;
+}
+
+void Fonts::Build(ImFontAtlas * atlas, const std::vector<Slot> & vWanted)
+{
+	TRACE_ZONE_CAT("Build Font Atlas", "fonts");
+	auto & vFaces = Faces();
+	atlas->Clear();
+	for (auto & face : vFaces) {
+		std::fill(face.vFonts.begin(), face.vFonts.end(), nullptr);
+	}
+	for (auto & slot : vWanted) {
+		Face & face = vFaces[slot.iFace];
+		ImFontConfig cfg;
+		cfg.FontDataOwnedByAtlas = false; // Embedded data lives in the binary; no decompression or copy.
+		cfg.RasterizerDensity = fDensity;
+		snprintf(cfg.Name, sizeof(cfg.Name), "%s, %.0fpx", face.sName.c_str(), face.vSizes[slot.iSize]);
+		face.vFonts[slot.iSize] = atlas->AddFontFromMemoryTTF(const_cast<void *>(face.pData), static_cast<int>(face.iSize), face.vSizes[slot.iSize], &cfg);
+	}
+	atlas->Build();
+}
+
+std::string Fonts::CacheKey(const ImFontAtlas * atlas, const std::vector<Slot> & vWanted)
+{
+	// Anything that changes the atlas layout or the cached structs' layout belongs in here.
+	std::string sKey = "imgui " IMGUI_VERSION;
+	sKey += " glyph " + std::to_string(sizeof(ImFontGlyph));
+	sKey += " lines " + std::to_string(sizeof(ImFontAtlas::TexUvLines));
+	sKey += " density " + std::to_string(fDensity);
+	sKey += " flags " + std::to_string(atlas->Flags);
+	sKey += " width " + std::to_string(atlas->TexDesiredWidth);
+	sKey += " padding " + std::to_string(atlas->TexGlyphPadding);
+	for (auto & face : Faces()) {
+		if (!face.iHash) {
+			face.iHash = HashBytes(face.pData, face.iSize);
+		}
+		char szHash[17];
+		snprintf(szHash, sizeof(szHash), "%016llx", static_cast<unsigned long long>(face.iHash));
+		sKey += " font " + face.sName + " " + szHash;
+	}
+	sKey += " sizes";
+	for (auto & slot : vWanted) {
+		sKey += " " + std::to_string(slot.iFace) + ":" + std::to_string(Faces()[slot.iFace].vSizes[slot.iSize]);
+	}
+	return sKey;
+}
+
+std::string Fonts::CacheFile()
+{
+	return sCacheFolder + "/font_atlas.bin";
+}
+
+void Fonts::SaveCache(ImFontAtlas * atlas, const std::vector<Slot> & vWanted)
+{
+	if (sCacheFolder.empty()) {
+		return;
+	}
+	TRACE_ZONE_CAT("Save Font Atlas Cache", "fonts");
+	unsigned char * pPixels = nullptr;
+	int iWidth = 0;
+	int iHeight = 0;
+	atlas->GetTexDataAsAlpha8(&pPixels, &iWidth, &iHeight);
+	if (!pPixels || atlas->TexPixelsUseColors) {
+		return; // Colour glyphs need the RGBA texture; not worth caching.
+	}
+
+	std::string sKey = CacheKey(atlas, vWanted);
+	std::string sOut;
+	sOut.reserve(static_cast<size_t>(iWidth) * iHeight + 64 * 1024);
+	Put(sOut, iCacheMagic);
+	Put(sOut, iCacheVersion);
+	Put(sOut, static_cast<uint32_t>(sKey.size()));
+	PutBytes(sOut, sKey.data(), sKey.size());
+
+	Put(sOut, static_cast<int32_t>(iWidth));
+	Put(sOut, static_cast<int32_t>(iHeight));
+	PutBytes(sOut, pPixels, static_cast<size_t>(iWidth) * iHeight);
+	Put(sOut, atlas->TexUvScale);
+	Put(sOut, atlas->TexUvWhitePixel);
+	PutBytes(sOut, atlas->TexUvLines, sizeof(atlas->TexUvLines));
+
+	Put(sOut, static_cast<int32_t>(atlas->PackIdMouseCursors));
+	Put(sOut, static_cast<int32_t>(atlas->PackIdLines));
+	Put(sOut, static_cast<uint32_t>(atlas->CustomRects.Size));
+	for (auto & rect : atlas->CustomRects) {
+		Put(sOut, rect.X);
+		Put(sOut, rect.Y);
+		Put(sOut, rect.Width);
+		Put(sOut, rect.Height);
+	}
+
+	Put(sOut, static_cast<uint32_t>(vWanted.size()));
+	for (auto & slot : vWanted) {
+		ImFont * font = Faces()[slot.iFace].vFonts[slot.iSize];
+		Put(sOut, static_cast<int32_t>(slot.iFace));
+		Put(sOut, static_cast<int32_t>(slot.iSize));
+		Put(sOut, font->FontSize);
+		Put(sOut, font->Ascent);
+		Put(sOut, font->Descent);
+		Put(sOut, static_cast<int32_t>(font->MetricsTotalSurface));
+		Put(sOut, static_cast<uint32_t>(font->Glyphs.Size));
+		PutBytes(sOut, font->Glyphs.Data, sizeof(ImFontGlyph) * font->Glyphs.Size);
+	}
+
+	if (WriteFileAtomic(CacheFile(), sOut)) {
+		Log(AppLogger::DEBUG) << "Saved font atlas cache: " << CacheFile();
+	} else {
+		Log(AppLogger::WARNING) << "Failed to save font atlas cache: " << CacheFile();
+	}
+}
+
+bool Fonts::LoadCache(ImFontAtlas * atlas, const std::vector<Slot> & vWanted)
+{
+	if (sCacheFolder.empty()) {
+		return false;
+	}
+	TRACE_ZONE_CAT("Load Font Atlas Cache", "fonts");
+	std::ifstream file(CacheFile(), std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	std::string sIn((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	CacheReader in(sIn);
+	if (in.Get<uint32_t>() != iCacheMagic || in.Get<uint32_t>() != iCacheVersion) {
+		return false;
+	}
+	std::string sKey = CacheKey(atlas, vWanted);
+	uint32_t iKeySize = in.Get<uint32_t>();
+	const char * pKey = in.Take(iKeySize);
+	if (!pKey || std::string_view(pKey, iKeySize) != sKey) {
+		return false;
+	}
+
+	int iWidth = in.Get<int32_t>();
+	int iHeight = in.Get<int32_t>();
+	if (iWidth <= 0 || iHeight <= 0 || iWidth > iMaxTextureSize || iHeight > iMaxTextureSize) {
+		return false;
+	}
+	const char * pPixels = in.Take(static_cast<size_t>(iWidth) * iHeight);
+	ImVec2 uvScale = in.Get<ImVec2>();
+	ImVec2 uvWhitePixel = in.Get<ImVec2>();
+	decltype(atlas->TexUvLines) vUvLines;
+	in.Bytes(vUvLines, sizeof(vUvLines));
+
+	int iPackIdMouseCursors = in.Get<int32_t>();
+	int iPackIdLines = in.Get<int32_t>();
+	uint32_t iRects = in.Get<uint32_t>();
+	if (!in.OK() || iRects > 1024) {
+		return false;
+	}
+	std::vector<ImFontAtlasCustomRect> vRects(iRects);
+	for (auto & rect : vRects) {
+		rect.X = in.Get<unsigned short>();
+		rect.Y = in.Get<unsigned short>();
+		rect.Width = in.Get<unsigned short>();
+		rect.Height = in.Get<unsigned short>();
+	}
+
+	auto & vFaces = Faces();
+	uint32_t iFonts = in.Get<uint32_t>();
+	if (!in.OK() || iFonts != vWanted.size()) {
+		return false;
+	}
+	std::vector<CachedFont> vCached(iFonts);
+	for (auto & cached : vCached) {
+		cached.iFace = in.Get<int32_t>();
+		cached.iSize = in.Get<int32_t>();
+		cached.fFontSize = in.Get<float>();
+		cached.fAscent = in.Get<float>();
+		cached.fDescent = in.Get<float>();
+		cached.iMetricsTotalSurface = in.Get<int32_t>();
+		uint32_t iGlyphs = in.Get<uint32_t>();
+		if (!in.OK() || iGlyphs >= 0xFFFF || cached.iFace < 0 || cached.iFace >= static_cast<int>(vFaces.size())
+			|| cached.iSize < 0 || cached.iSize >= static_cast<int>(vFaces[cached.iFace].vSizes.size())) {
+			return false;
+		}
+		cached.vGlyphs.resize(iGlyphs);
+		in.Bytes(cached.vGlyphs.data(), sizeof(ImFontGlyph) * iGlyphs);
+	}
+	if (!in.OK()) {
+		return false;
+	}
+
+	// Everything checked out; rebuild the atlas the way ImFontAtlas::Build() would have left it.  The configs carry no
+	// font data, so a later Build() must start from Clear(), which Fonts::Build() does.
+	atlas->Clear();
+	for (auto & face : vFaces) {
+		std::fill(face.vFonts.begin(), face.vFonts.end(), nullptr);
+	}
+	for (auto & cached : vCached) {
+		Face & face = vFaces[cached.iFace];
+		ImFont * font = IM_NEW(ImFont);
+		atlas->Fonts.push_back(font);
+		ImFontConfig cfg;
+		cfg.FontDataOwnedByAtlas = false;
+		cfg.SizePixels = face.vSizes[cached.iSize];
+		cfg.RasterizerDensity = fDensity;
+		cfg.DstFont = font;
+		snprintf(cfg.Name, sizeof(cfg.Name), "%s, %.0fpx", face.sName.c_str(), cfg.SizePixels);
+		atlas->ConfigData.push_back(cfg);
+
+		font->ContainerAtlas = atlas;
+		font->FontSize = cached.fFontSize;
+		font->Ascent = cached.fAscent;
+		font->Descent = cached.fDescent;
+		font->MetricsTotalSurface = cached.iMetricsTotalSurface;
+		font->Glyphs.resize(static_cast<int>(cached.vGlyphs.size()));
+		memcpy(font->Glyphs.Data, cached.vGlyphs.data(), sizeof(ImFontGlyph) * cached.vGlyphs.size());
+		face.vFonts[cached.iSize] = font;
+	}
+	ImFontAtlasUpdateConfigDataPointers(atlas);
+	for (ImFont * font : atlas->Fonts) {
+		font->BuildLookupTable();
+	}
+
+	atlas->TexWidth = iWidth;
+	atlas->TexHeight = iHeight;
+	atlas->TexPixelsAlpha8 = static_cast<unsigned char *>(IM_ALLOC(static_cast<size_t>(iWidth) * iHeight));
+	memcpy(atlas->TexPixelsAlpha8, pPixels, static_cast<size_t>(iWidth) * iHeight);
+	atlas->TexPixelsUseColors = false;
+	atlas->TexUvScale = uvScale;
+	atlas->TexUvWhitePixel = uvWhitePixel;
+	memcpy(atlas->TexUvLines, vUvLines, sizeof(vUvLines));
+	atlas->CustomRects.resize(static_cast<int>(vRects.size()));
+	for (size_t i = 0; i < vRects.size(); ++i) {
+		atlas->CustomRects[static_cast<int>(i)] = vRects[i];
+	}
+	atlas->PackIdMouseCursors = iPackIdMouseCursors;
+	atlas->PackIdLines = iPackIdLines;
+	atlas->TexReady = true;
+	return true;
+}
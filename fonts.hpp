@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct ImFont;
+struct ImFontAtlas;
+
+// Declares a file linked in with easyappbase_embed() in CMake: sym[] holds its bytes and sym_size their count.  Use at
+// global scope.
+#define EASYAPPBASE_EMBEDDED(sym) extern "C" const unsigned char sym[]; extern "C" const size_t sym##_size
+
+// The font atlas: the built-in Hack font at the five View > Scale sizes plus any fonts the app registers.  Rasterising
+// every size costs a few hundred ms at startup, so by default only the selected Hack size is built and the others are
+// added the first time they are selected.  The built atlas (pixels and glyph tables) is cached on disk, keyed by the
+// font data, the sizes and the rasterizer density, so a warm start does no rasterising at all.  Render thread only.
+class Fonts
+{
+	public:
+		static constexpr std::array<float, 5> vSizes = {12.0f, 18.0f, 27.0f, 36.0f, 45.0f};
+
+		static void Lazy(bool bLazyIn);                       // Default on.  Off builds every size up front.
+		static void CacheFolder(const std::string & sFolder); // Empty disables the atlas cache.
+
+		// Adds a TTF/OTF font to the atlas at each of vPixelSizes.  The data is not copied and must outlive the atlas,
+		// which anything from easyappbase_embed() does.  Call before Run().
+		static void Register(const std::string & sName, const void * pData, size_t iSize, std::vector<float> vPixelSizes);
+		[[nodiscard]] static ImFont * Get(const std::string & sName, float fPixelSize); // nullptr unless registered at that size.
+
+		static void Init(int iSize, float fDensityIn); // After ImGui::CreateContext().  fDensityIn is framebuffer pixels per window pixel.
+		static void Select(int iSize);                 // Make Hack at vSizes[iSize] the default font.  A size not built yet appears after the next Update().
+		[[nodiscard]] static int Selected();
+		[[nodiscard]] static ImFont * Get(int iSize);  // Hack at vSizes[iSize]; nullptr until built, and asking queues the build.
+
+		// Before ImGui::NewFrame().  Returns true if the atlas was rebuilt, in which case the font texture must be
+		// uploaded again and any ImFont pointers held from before are stale.
+		static bool Update();
+
+	private:
+		struct Face
+		{
+			std::string sName;
+			const void * pData = nullptr;
+			size_t iSize = 0;
+			std::vector<float> vSizes;
+			std::vector<ImFont *> vFonts; // Parallel to vSizes.
+			uint64_t iHash = 0;           // Of the font data, for the cache key.  0 until first needed.
+		};
+
+		struct Slot
+		{
+			int iFace;
+			int iSize;
+		};
+
+		static std::vector<Face> & Faces(); // [0] is Hack.
+		static std::vector<Slot> Wanted();
+		static void Build(ImFontAtlas * atlas, const std::vector<Slot> & vWanted);
+		static bool LoadCache(ImFontAtlas * atlas, const std::vector<Slot> & vWanted);
+		static void SaveCache(ImFontAtlas * atlas, const std::vector<Slot> & vWanted);
+		static std::string CacheKey(const ImFontAtlas * atlas, const std::vector<Slot> & vWanted);
+		static std::string CacheFile();
+
+		static bool bLazy;
+		static bool bInitialized;
+		static std::string sCacheFolder;
+		static float fDensity;
+		static int iSelected;
+		static bool bPending;
+		static std::array<bool, vSizes.size()> vRequested;
+};
@@ -0,0 +1,385 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+#include "frame_profiler.hpp"
+#include "app_logger.hpp"
+#include "trace.hpp"
+
+#include <algorithm>
+
+#include "imgui.h"
+#include <SDL.h>
+#if defined(IMGUI_IMPL_OPENGL_ES2)
+#include <SDL_opengles2.h>
+#else
+#include <SDL_opengl.h>
+#endif
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+#ifndef GL_MAJOR_VERSION
+#define GL_MAJOR_VERSION 0x821B
+#endif
+#ifndef GL_MINOR_VERSION
+#define GL_MINOR_VERSION 0x821C
+#endif
+
+namespace
+{
+	// Timer queries are GL 3.3 / ARB_timer_query, which the GL 3.0 context does not guarantee, so they are loaded by hand.
+	struct GLTimer
+	{
+		using gen_queries_t = void (APIENTRY *)(GLsizei, GLuint *);
+		using delete_queries_t = void (APIENTRY *)(GLsizei, const GLuint *);
+		using begin_query_t = void (APIENTRY *)(GLenum, GLuint);
+		using end_query_t = void (APIENTRY *)(GLenum);
+		using get_query_objectiv_t = void (APIENTRY *)(GLuint, GLenum, GLint *);
+		using get_query_objectui64v_t = void (APIENTRY *)(GLuint, GLenum, uint64_t *);
+
+		struct Query
+		{
+			GLuint id = 0;
+			size_t iSection = 0;
+			int64_t iStart = 0;
+			bool bPending = false;
+		};
+
+		gen_queries_t genQueries = nullptr;
+		delete_queries_t deleteQueries = nullptr;
+		begin_query_t beginQuery = nullptr;
+		end_query_t endQuery = nullptr;
+		get_query_objectiv_t getQueryObjectiv = nullptr;
+		get_query_objectui64v_t getQueryObjectui64v = nullptr;
+		bool bAvailable = false;
+		std::array<Query, 16> queries; // A few frames of latency for each GPU span.
+		Query * active = nullptr;
+	};
+
+	GLTimer & Timer()
+	{
+		static GLTimer ret;
+		return ret;
+	}
+}
+
+bool FrameProfiler::bEnabled = false;
+std::vector<FrameProfiler::Section> FrameProfiler::vSections;
+std::map<std::string, size_t, std::less<>> FrameProfiler::mSections;
+int64_t FrameProfiler::iFrameStart = 0;
+std::string FrameProfiler::sTraceFile;
+
+FrameProfiler::Scope::Scope(std::string_view sNameIn)
+{
+	bTrace = Trace::Active();
+	if (bEnabled || bTrace) {
+		iSection = SectionIndex(sNameIn, false);
+		iStart = Trace::Now();
+	}
+}
+
+FrameProfiler::Scope::~Scope()
+{
+	if (iSection == iNoSection) {
+		return;
+	}
+	auto iDuration = Trace::Now() - iStart;
+	if (bEnabled) {
+		Record(iSection, iDuration);
+	}
+	if (bTrace) {
+		Trace::Complete(vSections[iSection].sTraceName, "render", iStart, iDuration);
+	}
+}
+
+void FrameProfiler::Enable(bool bEnable)
+{
+	bEnabled = bEnable;
+	iFrameStart = 0;
+}
+
+bool FrameProfiler::Enabled()
+{
+	return bEnabled;
+}
+
+void FrameProfiler::Init()
+{
+	auto & timer = Timer();
+	#if !defined(IMGUI_IMPL_OPENGL_ES2)
+	GLint iMajor = 0;
+	GLint iMinor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &iMajor);
+	glGetIntegerv(GL_MINOR_VERSION, &iMinor);
+	if (iMajor * 10 + iMinor < 33 && !SDL_GL_ExtensionSupported("GL_ARB_timer_query")) {
+		Log(AppLogger::INFO) << "FrameProfiler::Init GL timer queries are not supported; GPU times are unavailable." << std::endl;
+		return;
+	}
+	timer.genQueries = reinterpret_cast<GLTimer::gen_queries_t>(SDL_GL_GetProcAddress("glGenQueries"));
+	timer.deleteQueries = reinterpret_cast<GLTimer::delete_queries_t>(SDL_GL_GetProcAddress("glDeleteQueries"));
+	timer.beginQuery = reinterpret_cast<GLTimer::begin_query_t>(SDL_GL_GetProcAddress("glBeginQuery"));
+	timer.endQuery = reinterpret_cast<GLTimer::end_query_t>(SDL_GL_GetProcAddress("glEndQuery"));
+	timer.getQueryObjectiv = reinterpret_cast<GLTimer::get_query_objectiv_t>(SDL_GL_GetProcAddress("glGetQueryObjectiv"));
+	timer.getQueryObjectui64v = reinterpret_cast<GLTimer::get_query_objectui64v_t>(SDL_GL_GetProcAddress("glGetQueryObjectui64v"));
+	timer.bAvailable = timer.genQueries && timer.deleteQueries && timer.beginQuery && timer.endQuery && timer.getQueryObjectiv && timer.getQueryObjectui64v;
+	if (timer.bAvailable) {
+		for (auto & query : timer.queries) {
+			timer.genQueries(1, &query.id);
+		}
+	}
+	#endif
+}
+
+void FrameProfiler::Shutdown()
+{
+	auto & timer = Timer();
+	if (timer.bAvailable) {
+		for (auto & query : timer.queries) {
+			timer.deleteQueries(1, &query.id);
+			query = {};
+		}
+	}
+	timer = {};
+}
+
+void FrameProfiler::BeginFrame()
+{
+	iFrameStart = bEnabled || Trace::Active() ? Trace::Now() : 0;
+}
+
+void FrameProfiler::EndFrame()
+{
+	if (iFrameStart) {
+		auto iDuration = Trace::Now() - iFrameStart;
+		Trace::Complete("Frame", "render", iFrameStart, iDuration);
+		if (bEnabled) {
+			Record(SectionIndex("Frame", false), iDuration);
+		}
+		iFrameStart = 0;
+	}
+	if (!bEnabled) {
+		return;
+	}
+	for (auto & section : vSections) {
+		if (section.bTouched && !section.bGPU) {
+			section.vSamples[section.iNext] = section.fFrameTotal;
+			section.iNext = (section.iNext + 1) % iHistory;
+			section.iCount = std::min(section.iCount + 1, iHistory);
+		}
+		section.fFrameTotal = 0.0f;
+		section.bTouched = false;
+	}
+	PollGPU();
+}
+
+void FrameProfiler::GPUBegin(std::string_view sName)
+{
+	auto & timer = Timer();
+	if (!bEnabled || !timer.bAvailable || timer.active) {
+		return;
+	}
+	for (auto & query : timer.queries) {
+		if (!query.bPending) {
+			query.iSection = SectionIndex(sName, true);
+			query.iStart = Trace::Now();
+			query.bPending = true;
+			timer.beginQuery(GL_TIME_ELAPSED, query.id);
+			timer.active = &query;
+			return;
+		}
+	}
+}
+
+void FrameProfiler::GPUEnd()
+{
+	auto & timer = Timer();
+	if (timer.active) {
+		timer.endQuery(GL_TIME_ELAPSED);
+		timer.active = nullptr;
+	}
+}
+
+void FrameProfiler::PollGPU()
+{
+	auto & timer = Timer();
+	if (!timer.bAvailable) {
+		return;
+	}
+	for (auto & query : timer.queries) {
+		if (!query.bPending || &query == timer.active) {
+			continue;
+		}
+		GLint iReady = 0;
+		timer.getQueryObjectiv(query.id, GL_QUERY_RESULT_AVAILABLE, &iReady);
+		if (!iReady) {
+			continue;
+		}
+		uint64_t iNanoseconds = 0;
+		timer.getQueryObjectui64v(query.id, GL_QUERY_RESULT, &iNanoseconds);
+		query.bPending = false;
+		auto & section = vSections[query.iSection];
+		// The GPU clock is not the CPU clock; the span is placed where it was submitted.
+		Trace::CompleteOn("GPU", section.sTraceName, "gpu", query.iStart, static_cast<int64_t>(iNanoseconds / 1000));
+		section.vSamples[section.iNext] = static_cast<float>(iNanoseconds) / 1000000.0f;
+		section.iNext = (section.iNext + 1) % iHistory;
+		section.iCount = std::min(section.iCount + 1, iHistory);
+	}
+}
+
+size_t FrameProfiler::SectionIndex(std::string_view sName, bool bGPU)
+{
+	auto it = mSections.find(sName);
+	if (it != mSections.end()) {
+		return it->second;
+	}
+	size_t iIndex = vSections.size();
+	auto & section = vSections.emplace_back();
+	section.sName = sName;
+	section.sTraceName = Trace::Intern(sName);
+	section.bGPU = bGPU;
+	mSections.emplace(section.sName, iIndex);
+	return iIndex;
+}
+
+void FrameProfiler::Record(size_t iSection, int64_t iDuration)
+{
+	auto & section = vSections[iSection];
+	section.fFrameTotal += static_cast<float>(iDuration) / 1000.0f;
+	section.bTouched = true;
+}
+
+void FrameProfiler::Reset()
+{
+	// Sections stay registered; GPU queries still in flight refer to them.
+	for (auto & section : vSections) {
+		section.iNext = 0;
+		section.iCount = 0;
+		section.fFrameTotal = 0.0f;
+		section.bTouched = false;
+	}
+}
+
+void FrameProfiler::TraceFile(const std::string & sFile)
+{
+	sTraceFile = sFile;
+}
+
+void FrameProfiler::RenderOverlay(bool * bShow)
+{
+	ImGui::SetNextWindowSize(ImVec2(640, 420), ImGuiCond_FirstUseEver);
+	if (!ImGui::Begin("Frame Profiler", bShow)) {
+		ImGui::End();
+		return;
+	}
+
+	auto Ordered = [](const Section & section)
+	{
+		std::vector<float> vRet;
+		vRet.reserve(section.iCount);
+		size_t iOldest = section.iCount < iHistory ? 0 : section.iNext;
+		for (size_t i = 0; i < section.iCount; ++i) {
+			vRet.push_back(section.vSamples[(iOldest + i) % iHistory]);
+		}
+		return vRet;
+	};
+
+	auto itFrame = mSections.find("Frame");
+	if (itFrame != mSections.end()) {
+		auto vFrames = Ordered(vSections[itFrame->second]);
+		if (!vFrames.empty()) {
+			float fMax = *std::max_element(vFrames.begin(), vFrames.end());
+			char szOverlay[64];
+			snprintf(szOverlay, sizeof(szOverlay), "%.2f ms (%.0f fps)", vFrames.back(), vFrames.back() > 0.0f ? 1000.0f / vFrames.back() : 0.0f);
+			ImGui::PlotHistogram("##FrameTimes", vFrames.data(), static_cast<int>(vFrames.size()), 0, szOverlay, 0.0f, std::max(fMax, 16.7f), ImVec2(-1, 80));
+		}
+	}
+
+	if (ImGui::Button("Reset")) {
+		Reset();
+	}
+	if (!sTraceFile.empty()) {
+		ImGui::SameLine();
+		if (Trace::Active()) {
+			if (ImGui::Button("Stop Trace")) {
+				Trace::Stop();
+			}
+		} else if (ImGui::Button("Start Trace")) {
+			Trace::Start(sTraceFile);
+		}
+		ImGui::SameLine();
+		ImGui::TextDisabled("%s", sTraceFile.c_str());
+	}
+
+	if (ImGui::BeginTable("##FrameProfilerSections", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY)) {
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Section");
+		ImGui::TableSetupColumn("Last ms");
+		ImGui::TableSetupColumn("Avg ms");
+		ImGui::TableSetupColumn("P95 ms");
+		ImGui::TableSetupColumn("Max ms");
+		ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthStretch);
+		ImGui::TableHeadersRow();
+		for (auto & section : vSections) {
+			auto vSamples = Ordered(section);
+			if (vSamples.empty()) {
+				continue;
+			}
+			float fLast = vSamples.back();
+			float fSum = 0.0f;
+			for (float f : vSamples) {
+				fSum += f;
+			}
+			auto vSorted = vSamples;
+			auto itP95 = vSorted.begin() + static_cast<std::ptrdiff_t>((vSorted.size() - 1) * 95 / 100);
+			std::nth_element(vSorted.begin(), itP95, vSorted.end());
+			float fP95 = *itP95;
+			float fMax = *std::max_element(vSamples.begin(), vSamples.end());
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s%s", section.sName.c_str(), section.bGPU ? " (GPU)" : "");
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", fLast);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", fSum / static_cast<float>(vSamples.size()));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", fP95);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", fMax);
+			ImGui::TableNextColumn();
+			ImGui::PushID(section.sName.c_str());
+			ImGui::PlotLines("##History", vSamples.data(), static_cast<int>(vSamples.size()), 0, nullptr, 0.0f, fMax, ImVec2(-1, ImGui::GetTextLineHeight()));
+			ImGui::PopID();
+		}
+		ImGui::EndTable();
+	}
+	ImGui::End();
+}
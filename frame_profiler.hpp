@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Per-frame CPU and GPU timings for the render loop.  Scopes are recorded into fixed rolling histories shown by
+// RenderOverlay().  While a Trace capture runs, the frame, the scopes and the GPU spans are also recorded into it, on
+// the render thread's track and a "GPU" track; the overlay can start and stop a capture.  Everything here is for the
+// render thread only.
+class FrameProfiler
+{
+	public:
+		class Scope
+		{
+			public:
+				explicit Scope(std::string_view sNameIn);
+				~Scope();
+
+				Scope(const Scope &) = delete;
+				Scope & operator=(const Scope &) = delete;
+
+			private:
+				size_t iSection = iNoSection;
+				int64_t iStart = 0; // Trace clock.
+				bool bTrace = false;
+		};
+
+		static void Enable(bool bEnable);
+		static bool Enabled();
+
+		static void Init();     // After the GL context is current; loads the timer query entry points.
+		static void Shutdown(); // Before the GL context is destroyed.
+
+		static void BeginFrame();
+		static void EndFrame();
+
+		// GL_TIME_ELAPSED queries cannot nest, so GPU spans must not overlap.  Results arrive a few frames later.
+		static void GPUBegin(std::string_view sName);
+		static void GPUEnd();
+
+		static void RenderOverlay(bool * bShow);
+		static void TraceFile(const std::string & sFile); // Where a capture started from the overlay is saved.
+		static void Reset(); // Clears the histories.
+
+		static constexpr size_t iHistory = 240; // Frames of history per section.
+
+	private:
+		static constexpr size_t iNoSection = static_cast<size_t>(-1);
+
+		struct Section
+		{
+			std::string sName;
+			const char * sTraceName = nullptr; // sName interned for Trace.
+			bool bGPU = false;
+			std::array<float, iHistory> vSamples{}; // Milliseconds.
+			size_t iNext = 0;
+			size_t iCount = 0;
+			float fFrameTotal = 0.0f; // Accumulated this frame, for sections entered more than once.
+			bool bTouched = false;
+		};
+
+		static size_t SectionIndex(std::string_view sName, bool bGPU);
+		static void Record(size_t iSection, int64_t iDuration);
+		static void PollGPU();
+
+		static bool bEnabled;
+		static std::vector<Section> vSections;
+		static std::map<std::string, size_t, std::less<>> mSections;
+		static int64_t iFrameStart;
+		static std::string sTraceFile;
+};
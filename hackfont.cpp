@@ -1,4621 +0,0 @@
-/*
-Copyright (c) 2024 James Baker
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in
-all copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-THE SOFTWARE.
-
-The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
-
-*/
-
-// File: 'fonts/Hack-Regular.ttf' (383104 bytes)
-// Exported using binary_to_compressed_c.cpp
-extern const int HackFont_compressed_size = 220265;
-extern const unsigned int HackFont_compressed_data[220268/4] =
-{
-    0x0000bc57, 0x00000000, 0x80d80500, 0x00000400, 0x00010025, 0x82100000, 0x00043e04, 0x55534700, 0x292d2642, 0x0100005e, 0x0500000c, 0x2f534fc0, 
-    0x495e5632, 0x06000010, 0x2c2582cc, 0x46545460, 0xaccda641, 0xd60500f7, 0x3c2382d0, 0x616d63ad, 0xd131b170, 0x07000027, 0x1b00002c, 0x74766392, 
-    0x5fb91520, 0xca050044, 0x282f8214, 0x67706692, 0xe23c8a6d, 0x280f824d, 0x0b0000a8, 0x73616788, 0x20178270, 0x820f8210, 0x08003d5f, 0x66796c67, 
-    0x96e30bd8, 0xc0220000, 0x2efa0400, 0x64616568, 0x0f9d3d81, 0xf01c0500, 0x36212782, 0x27108268, 0x73080109, 0x281d0500, 0x24280f82, 0x78746d68, 
-    0x472f2dbb, 0x4c300f82, 0xf8170000, 0x61636f6c, 0x92931f11, 0x44350500, 0xfc2c0f82, 0x7078616d, 0xdd0c9008, 0x404d0500, 0x20282f82, 0x656d616e, 
-    0x6505719d, 0x60200f82, 0x6738dd82, 0x74736f70, 0x5946234c, 0xc8940500, 0x42350000, 0x70657270, 0xa200e903, 0x3020cf82, 0xa0222f82, 0x05820100, 
-    0x80000a34, 0x02001602, 0x544c4644, 0x616c0e00, 0x26006e74, 0x17820400, 0xffff0024, 0x07820700, 0x0800043b, 0x12000e00, 0x1a001600, 0x02001000, 
-    0x204c4f4d, 0x4f522400, 0x3a00204d, 0x2c238500, 0x00050001, 0x000f0009, 0x00170013, 0x2813841b, 0x00020008, 0x000a0006, 0x2431820c, 0x00180014, 
-    0x2015861c, 0x32518203, 0x000d000b, 0x00150011, 0x001d0019, 0x6c61611e, 0x84b60074, 0x84be2005, 0x84c62005, 0x63ce2605, 0x00657361, 0x200584d6, 
-    0x200584dc, 0x260584e4, 0x617266ec, 0x84f40063, 0x83fa2005, 0x02012105, 0x0a260584, 0x6c636f6c, 0x05841201, 0x726f1826, 0x1e016e64, 0x24200584, 
-    0x2c200584, 0x34260584, 0x666e6973, 0x05843c01, 0x05844220, 0x05844a20, 0x75735226, 0x5a017362, 0x60200584, 0x68200584, 0x70260584, 0x73707573, 
-    0x05847801, 0x05847e20, 0x05848620, 0x00008e24, 0x03820200, 0x079a0120, 0x0e000122, 0x0e221d84, 0x07920f00, 0x0a000122, 0x0a221584, 0x07920b00, 
-    0x5d860120, 0x63840320, 0x05820c20, 0x0c000224, 0x07920d00, 0x06000122, 0x06221584, 0x07920700, 0x04000122, 0x04221584, 0x07920500, 0x08000122, 
-    0x08221584, 0x07900900, 0x00112408, 0x002c0024, 0x003c0034, 0x004c0044, 0x005c0054, 0x006c0064, 0x007c0074, 0x008e0084, 0x00a00098, 0x820100a8, 
-    0x02012335, 0xa58400ac, 0x85bc0221, 0x8421820f, 0x7a002117, 0x78200f86, 0x76200786, 0x74200786, 0x72200786, 0x70200786, 0x82200786, 0x0122ab84, 
-    0x07859400, 0x85400121, 0xec0123d9, 0x0985fe01, 0x02060223, 0x212b8518, 0x07862002, 0x07862420, 0x01009624, 0x0b829c02, 0x82020121, 0x220b8209, 
-    0x82b60398, 0x84922005, 0x848c2005, 0x82862005, 0x02023c05, 0x020a0080, 0x023b023a, 0x05ed053c, 0x05ef05ee, 0x05f105f0, 0x00f305f2, 0x96660202, 
-    0x02012219, 0x287d8256, 0x00500012, 0x00860066, 0x36f58292, 0x000e0006, 0x001e0016, 0x002e0026, 0x00310236, 0x024f0203, 0x84320227, 0x02282207, 
-    0x22078434, 0x84e50529, 0x052a2207, 0x220784e9, 0x8436022b, 0x002d2207, 0x224d8202, 0x8433020e, 0x0528220d, 0x2a0784e6, 0x0003002a, 0x00100008, 
-    0x84350218, 0x0529220f, 0x220784e7, 0x8437022a, 0x822d2007, 0x050422d9, 0x200b84e8, 0x2141852a, 0x0d84ea05, 0x38022b22, 0x02212189, 0x210b8739, 
-    0xb340a201, 0x820320b0, 0x82e420e3, 0x00fe2403, 0x82010000, 0x00102103, 0xd2201183, 0xf4200b82, 0xc024118c, 0xda000100, 0xae24118c, 0xd0000100, 
-    0x022e1188, 0x0300c600, 0x61025f02, 0x02006002, 0x0b8aba00, 0x0900b828, 0x5700ee00, 0x0582ed00, 0x2186cc20, 0x00ed2008, 0x006c0001, 0x001a000a, 
-    0x00260020, 0x0032002c, 0x003e0038, 0x004a0044, 0x05020050, 0x823a02db, 0x02dc2205, 0x2205823b, 0x823c02dd, 0x05de2205, 0x220582ed, 0x82ee05df, 
-    0x05e02205, 0x220582ef, 0x82f005e1, 0x05e22205, 0x220582f1, 0x82f205e3, 0x05e42205, 0x227982f3, 0x82040060, 0x836b8367, 0x00022463, 0x82cb0056, 
-    0x02012415, 0x822e0225, 0x00022eab, 0x02260202, 0x0200002a, 0x002c022c, 0x24858205, 0x05770002, 0x22078486, 0x82b50040, 0x02032607, 0x024b0246, 
-    0x2209825c, 0x82400009, 0x8277203d, 0x85cb2015, 0x20278413, 0x82158204, 0x240b8213, 0x01d10403, 0x24438290, 0x04330508, 0x205b82cc, 0x25078599, 
-    0x6600cc02, 0x61821202, 0x09060b24, 0x00820203, 0x00a50428, 0x0010ef06, 0x2382fbb8, 0x03822020, 0x69730024, 0x4582706d, 0xfffe0038, 0x14fe1406, 
-    0x6d079a01, 0x0020e301, 0xd7df9f01, 0x60040000, 0x2784d505, 0x05820320, 0x0e210386, 0x828d82dc, 0x1c00230e, 0x09830300, 0x00260225, 0x830a0206, 
-    0x00012110, 0x0c831986, 0x01230385, 0x85000200, 0x20078700, 0x20009600, 0x09178401, 0x44020353, 0x47024c02, 0xfa02bc02, 0x4d026805, 0x6d026c02, 
-    0xfd023d02, 0x87024202, 0x4f024802, 0x26022502, 0x28022702, 0x2a022902, 0x2c022b02, 0x2e022d02, 0x4e024102, 0xe302ee02, 0x4902e702, 0x86056705, 
-    0x0e000d00, 0x17001300, 0x21002000, 0x28002600, 0x32003100, 0x39003400, 0x40003a00, 0x4e004c00, 0x53004f00, 0x5c005800, 0x68006700, 0x6e006d00, 
-    0x66027300, 0x67023e02, 0x50026f05, 0x77007f05, 0x83008200, 0x8c008800, 0x96009500, 0x9d009b00, 0xa700a600, 0xae00a900, 0xb500af00, 0xc300c100, 
-    0xc800c400, 0xd200ce00, 0xde00dd00, 0xe400e300, 0x6402e900, 0x65026505, 0x0000db02, 0x0a000600, 0x18001100, 0x43003f00, 0x78005f00, 0x7a007c00, 
-    0x80007b00, 0x86007f00, 0x92008d00, 0x90008f00, 0xa2009f00, 0xa100a000, 0xb600b400, 0xb700b900, 0xbf00b800, 0xd600d300, 0xd500d400, 0x6e057005, 
-    0xc302b902, 0x40026c05, 0xcd006905, 0x6a056b05, 0x78056d05, 0xf6027d05, 0x48000c00, 0xfe02e902, 0xe802ef02, 0xf605d702, 0x0903f902, 0xc605ff02, 
-    0xed00ea02, 0x1203ee00, 0xbd008100, 0x46024b02, 0x0303f102, 0xd902bf02, 0xf405f705, 0x4302f505, 0x05694700, 0x004a2008, 0x02c0004b, 0x02840285, 
-    0x0290028f, 0x02930291, 0x00a504df, 0x057100e7, 0x02be02fc, 0x828d028c, 0x002008bd, 0xfb057105, 0x8e029402, 0x0500fc02, 0xfd051a00, 0x1d001b00, 
-    0x2a002900, 0x2d002b00, 0x42004100, 0x2a082382, 0x005d0044, 0x0060005e, 0x057c059e, 0x05810584, 0x057e0579, 0x057b0583, 0x05820580, 0x0c04007a, 
-    0x010000b6, 0x00000166, 0x82660007, 0x0d63092d, 0x39002f00, 0x07017e00, 0x1b011301, 0x2b012301, 0x37013101, 0x48013e01, 0x5b014d01, 0x6b016101, 
-    0x92017e01, 0xb001a101, 0xff01e701, 0xc7021b02, 0x0103dd02, 0x09030303, 0x86032303, 0x8c038a03, 0xa1039403, 0xb003a903, 0xbc03bb03, 0xce03c903, 
-    0xf603f403, 0x23041a04, 0x43043a04, 0x63045f04, 0x9b047304, 0xb304a504, 0xc404bb04, 0xcc04c804, 0x1105f904, 0x56051d05, 0x5f055905, 0x8a058705, 
-    0xfa103f0e, 0x851efc10, 0x0a20f31e, 0x26202320, 0x37203120, 0x3f203a20, 0x4b204920, 0x70205f20, 0x7c207920, 0x8c207e20, 0xac208e20, 0xb920b520, 
-    0x26212221, 0x5f215121, 0xa8219d21, 0xb821ae21, 0xc321b921, 0xdd21d921, 0xe921e321, 0x1322f021, 0x20221522, 0x2d222322, 0x44223d22, 0x5f224822, 
-    0x69226522, 0x87228122, 0x94228b22, 0xa4229722, 0xb822b522, 0xd122c622, 0xef22e922, 0x0b230423, 0x21231023, 0x0225ae23, 0x3c250b25, 0x6c254f25, 
-    0x80257f25, 0x94258825, 0xa3259f25, 0xff25ab25, 0x75275627, 0xa0279427, 0xaf27a127, 0xbe27b927, 0xc627c227, 0xe027dc27, 0xf727eb27, 0x98298829, 
-    0xfb29eb29, 0x2f2a002a, 0x0d2b6b2a, 0x1a2b192b, 0x1f2e182e, 0x252e232e, 0xa2e02e2e, 0xfffeb3e0, 0x8300ffff, 0x0d340800, 0x30002000, 0xa0003a00, 
-    0x16010a01, 0x26011e01, 0x36012e01, 0x41013901, 0x50014a01, 0x64015e01, 0x92016e01, 0xaf01a001, 0xfe01e601, 0xc6021802, 0x0003d802, 0x08066741, 
-    0x8803845e, 0x8e038c03, 0xa3039503, 0xb103aa03, 0xbd03bc03, 0xf403ca03, 0x0004f603, 0x24041b04, 0x44043b04, 0x72046204, 0xa2049004, 0xba04aa04, 
-    0xc704c004, 0xcf04cb04, 0x1a051005, 0x59053105, 0x61055a05, 0x3f0e8905, 0xfb10d010, 0xf21e801e, 0x10200020, 0x2f202620, 0x39203420, 0x44203c20, 
-    0x08066741, 0x7a2074ac, 0x8a207d20, 0xa0208d20, 0xb820ad20, 0x26212221, 0x53215021, 0x9e219021, 0xaf21a921, 0xba21b921, 0xda21c421, 0xe421e021, 
-    0xf121eb21, 0x17221522, 0x27222322, 0x41223422, 0x49224522, 0x66226022, 0x82226d22, 0x8d228822, 0x98229522, 0xb822b222, 0xcd22c222, 0xef22da22, 
-    0x08230423, 0x20231023, 0x00259b23, 0x0c250325, 0x50253d25, 0x80256d25, 0x89258125, 0xa0259525, 0xac25a425, 0x68275627, 0x98279427, 0xa227a127, 
-    0xba27b127, 0xc527c227, 0xe027dc27, 0xf527e627, 0x97298729, 0xfa29eb29, 0x2f2a002a, 0x052b6a2a, 0x6741162b, 0x2e223306, 0xe02e2e24, 0xfeb0e0a0, 
-    0x00ffffff, 0x00f5ff01, 0x03820100, 0x009a0020, 0x8f2d0121, 0x74022b1c, 0x51026d02, 0x28020000, 0x05822702, 0x05020622, 0x07200582, 0x062a0382, 
-    0xb6fd0000, 0x00007c01, 0x0982e5fc, 0x378f2020, 0xfc210f89, 0x281f827b, 0xfd71fc47, 0xf185f41e, 0x25178529, 0x0000abe2, 0x03821de2, 0x53e26222, 
-    0xe23b1183, 0xe54ae210, 0xe27ae57d, 0xe2f1e192, 0x00d5e185, 0xe21fe200, 0xe14be41d, 0x849be4ec, 0x0037241f, 0x8238e200, 0x83392003, 0x83e22003, 
-    0x0034240d, 0x821ae000, 0x83fb2003, 0xe8e0251f, 0xe6e00000, 0xe2220382, 0x0582dfe0, 0xd9e0da22, 0xd7240582, 0xc8e0cae0, 0xb82a0782, 0xabe0b0e0, 
-    0x93e027e1, 0x0d82f6df, 0x03820420, 0x03820b20, 0x00000223, 0x25b982df, 0x0000dede, 0x0b82dcde, 0x0000352e, 0x08db4edd, 0x95dc98dc, 0x9ddc0000, 
-    0x26080382, 0xda39db9c, 0xdbd7dbb9, 0xdcb4dad4, 0xd8f9d866, 0xd9cad9eb, 0xd9b8d9bc, 0x0050d98a, 0xd989d900, 0xd444d4be, 0x8248d43e, 0x24302605, 
-    0x03e424f1, 0x053f46b9, 0x62013408, 0x7e010000, 0xd4020602, 0xf002e602, 0x0403fa02, 0x0c030a03, 0x24031603, 0x40032a03, 0x54034603, 0x72030000, 
-    0x76037403, 0x7a037803, 0x82038003, 0x84008c03, 0x88032100, 0x05860683, 0x00009024, 0x03829a03, 0x13849820, 0x00009c24, 0x0382ce03, 0x2e04f83b, 
-    0x32043004, 0x4e044804, 0x62046004, 0x6c046a04, 0xc2046e04, 0x0000c404, 0x83eb8204, 0x2703832b, 0xc004be04, 0x0000ca04, 0xee200384, 0xee221184, 
-    0x0783f404, 0x0420038b, 0x11851984, 0x05fc0427, 0x05000014, 0x2003822c, 0x20038234, 0x25158332, 0x00005805, 0x03826005, 0x0382a220, 0xbe05b222, 
-    0x83820582, 0x84d20521, 0x84d8201b, 0x83de2005, 0x00002305, 0x0785dc05, 0x05200585, 0x03841b82, 0x0000da24, 0x03823806, 0x03826e20, 0x03826c20, 
-    0x03828020, 0x23858420, 0x07000023, 0x42038222, 0x1d821a37, 0x2b871420, 0x6747078e, 0x8853471f, 0xaa025908, 0xb9024602, 0xbb02c302, 0x6605d702, 
-    0x7d056c05, 0xed006a05, 0xf102f405, 0x6b058802, 0x6e058105, 0x3b02fe02, 0x78053c02, 0x6905f605, 0x7b05fb05, 0xee003a02, 0x3402f505, 0x35023102, 
-    0x07004b02, 0x0500fd05, 0x06000b00, 0x0c000a00, 0x1d001100, 0x1a001800, 0x2d001b00, 0x0906d746, 0x3f001444, 0x41004400, 0x4a004200, 0xf4024300, 
-    0x60004800, 0x5e005d00, 0x6f005f00, 0xcd004d00, 0x78007c00, 0x80007a00, 0x7f007b00, 0x86008100, 0x8d009200, 0x90008f00, 0x9f00a200, 0xa100a000, 
-    0xb4008900, 0xb600b900, 0xbf00b700, 0xdf02b800, 0xd600bd00, 0xd400d300, 0xe500d500, 0xe700c200, 0x7d000800, 0x79000400, 0x7e000900, 0x84000f00, 
-    0x87001200, 0x85001000, 0x8a001500, 0x8b001600, 0x93001e00, 0x91001c00, 0x94001f00, 0x8e001900, 0x97002200, 0x9a002500, 0x99002400, 0x9c002700, 
-    0xa5003000, 0xa3002e00, 0xa4002f00, 0x9e002c00, 0xa8003300, 0xaa003500, 0xac003700, 0xab003600, 0xad003800, 0xb0003b00, 0xb2003d00, 0xb1003c00, 
-    0xb3003e00, 0xbc004700, 0xbb004600, 0xc0004b00, 0xc5005000, 0xc7005200, 0xc6005100, 0xc9005400, 0xcb005600, 0xca005500, 0xd0005a00, 0xcf005900, 
-    0xdc006600, 0xd9006300, 0xdb006500, 0xd8006200, 0xda006400, 0xe0006a00, 0xe6007000, 0x74007100, 0x7600ea00, 0x7500ec00, 0x4500eb00, 0x6100ba00, 
-    0x2300d700, 0x49009800, 0x5700be00, 0x5b00cc00, 0x7c05d100, 0x05487a05, 0x82b60c06, 0x80058405, 0x73057505, 0xf905f805, 0xb405af05, 0xd205b505, 
-    0x99059805, 0xa9019a05, 0xb705b605, 0xd905d805, 0xd005da05, 0xab01d505, 0xd405d105, 0xd305d605, 0xf700d705, 0x1f01f800, 0x1801f300, 0x1a011701, 
-    0x1c011b01, 0x16011501, 0xff001d01, 0x0901fd00, 0xef001001, 0xf100f000, 0xf500f200, 0xf900f600, 0xfb00fa00, 0xfe00fc00, 0x0b010a01, 0x0c010d01, 
-    0x0f010e01, 0x14011301, 0x19011201, 0x11011e01, 0x4b014a01, 0x4d014c01, 0x51015001, 0x55015401, 0x57015601, 0x65015901, 0x68016601, 0x69016701, 
-    0x6e016a01, 0x6d016f01, 0x79017401, 0x52016c01, 0x7a015301, 0x73014e01, 0x75017201, 0x77017601, 0x71017001, 0x5a017801, 0x64015801, 0x20016b01, 
-    0x21017b01, 0xf4007c01, 0x22014f01, 0x23017d01, 0x24017e01, 0x25017f01, 0x26018001, 0x27018101, 0xa5018201, 0x2801a601, 0x29018301, 0x2a018401, 
-    0x2b018501, 0x2c018601, 0x2d018701, 0x2e018801, 0x8a012f01, 0x8b013001, 0x8c013101, 0x8d013201, 0x33018901, 0x34018e01, 0xa7018f01, 0x3501a801, 
-    0x36019001, 0x37019101, 0x38019201, 0x39019301, 0x3a019401, 0x3b019501, 0x3c019601, 0x3d019701, 0x3e019801, 0x3f019901, 0x40019a01, 0x41019b01, 
-    0x42019c01, 0x43019d01, 0x44019e01, 0x45019f01, 0x4601a001, 0x4701a101, 0x4801a201, 0x4901a301, 0x8505a401, 0x2402a002, 0xe2006c00, 0xdf006900, 
-    0xe1006b00, 0xe8007200, 0x8a028902, 0x85028602, 0x8b028402, 0x51025202, 0x93029102, 0x92029402, 0x90028f02, 0x95028e02, 0x71057005, 0x53024002, 
-    0xfc02b602, 0x45020b03, 0x55025402, 0xfc055602, 0x58025702, 0x59024a02, 0xc5025a02, 0xc602ba02, 0xc102c002, 0xc802c702, 0xc902c202, 0xcb02ca02, 
-    0xbe02bd02, 0x33023202, 0xe605e505, 0xe805e705, 0xea05e905, 0x37023602, 0x39023802, 0xc4033002, 0xc003be03, 0xc603c203, 0xc503c703, 0xc103bf03, 
-    0xc903c303, 0xd203ca03, 0xe303d303, 0xe503e403, 0xd403e603, 0xe203d003, 0x0004ff03, 0x05040104, 0x03040204, 0xfd030404, 0x1004fe03, 0x12041104, 
-    0x06040c04, 0x0a040804, 0x0f040e04, 0x07040d04, 0x0b040904, 0xe103e003, 0x1b041e04, 0x1d041c04, 0xf203f103, 0x26042504, 0x2704c803, 0xcc03cb03, 
-    0xce03cd03, 0xd103cf03, 0x29042804, 0xbd032a04, 0xf9021303, 0x1403e502, 0xf705e202, 0xe102e602, 0x1503f502, 0x16030803, 0x18031703, 0x1903ff02, 
-    0xf3020903, 0xda021a03, 0x3f021b03, 0x1c030303, 0x02031d03, 0xf802e902, 0xf002d802, 0xed02f202, 0xea02bc03, 0x20031f03, 0x21030a03, 0x23032203, 
-    0x25032403, 0x27032603, 0x28030703, 0x2d03de02, 0xd9022e03, 0xe402f602, 0x47034603, 0xe802ef02, 0x01030003, 0x6103f702, 0x05030403, 0x6e03dd02, 
-    0x8103dc02, 0x83038203, 0x8403e002, 0xeb02ec02, 0x0d05b504, 0xac04b604, 0x18051705, 0xae041905, 0x1b051a05, 0xad041c05, 0x1e051d05, 0xaf041f05, 
-    0x21052005, 0xb3042205, 0x24052305, 0x26052505, 0x28052705, 0xb4042905, 0x2b052a05, 0x2d052c05, 0x2f052e05, 0xb1043005, 0x32053105, 0x34053305, 
-    0x36053505, 0xb2043705, 0x39053805, 0x3b053a05, 0x3d053c05, 0xb0043e05, 0xbc04c804, 0xd104d004, 0xba04c404, 0xbd04b904, 0xce04cf04, 0xc004c304, 
-    0xbe04bf04, 0xc204c104, 0xb704c704, 0xbb04b804, 0xcd04cc04, 0xca04c604, 0xc504cb04, 0xd204d304, 0x6704c904, 0x6e046f04, 0x6c046d04, 0x6a046b04, 
-    0x70046904, 0x7d047c04, 0x68047e04, 0xd504d404, 0xd704d604, 0xaa04a904, 0xab04a804, 0xa704a604, 0xf204ee04, 0x0105fd04, 0xf304ef04, 0x0205fe04, 
-    0xfb04f904, 0xf404f004, 0x0305ff04, 0xf504f104, 0x04050005, 0xfc04fa04, 0x9e049d04, 0x9004a304, 0x8004a504, 0x8e048f04, 0x7f049104, 0x83048204, 
-    0x85048404, 0x89048804, 0x87048604, 0x94049304, 0x96049504, 0x9a049904, 0x9c049b04, 0x98049704, 0x07050605, 0x05050805, 0xe1049204, 0xe304e204, 
-    0xe504e404, 0xf704f604, 0x8104f804, 0xe704e604, 0xe904e804, 0x8b048a04, 0x8d048c04, 0x09050c05, 0xea040b05, 0xec04eb04, 0x0a05ed04, 0x4d045e04, 
-    0x4f044e04, 0x51045204, 0x55045004, 0x53045404, 0x36043b04, 0x37043904, 0x38043c04, 0x3d043a04, 0x0c103e04, 0x37b60cb5, 0x00020000, 0x0496fe68, 
-    0x00a40568, 0x00070003, 0x07b04b86, 0x13405850, 0x02820c82, 0x02005d30, 0x04590102, 0x39010101, 0x4b1b4c02, 0x1a820ab0, 0x0e821920, 0x03020025, 
-    0x84610201, 0x00552623, 0x59000303, 0x200b8200, 0x2020824d, 0x203b9715, 0x2a369940, 0x40595959, 0x0700000e, 0x82040506, 0x03210845, 0x15080511, 
-    0x2111012b, 0x11210511, 0xfc680421, 0xfc8e0300, 0x051b03e5, 0x07f2f8a4, 0xd7f9730e, 0x3a008200, 0x00250003, 0x07ac0400, 0x000b0027, 0x00160013, 
-    0x0115b5e0, 0x4a010408, 0x8217b04b, 0x03252380, 0xb7820101, 0x0200663d, 0x04000109, 0x0a640002, 0x06000801, 0x62060805, 0x39040400, 0x0501074b, 
-    0x83053a05, 0x823520ce, 0x8324202c, 0x7201212c, 0x3a202ba0, 0x40822b89, 0x73050622, 0x04243195, 0x2f401b4c, 0x04265286, 0x04000800, 0x2e917008, 
-    0x08060623, 0x08938255, 0x5a060875, 0x06080600, 0x5959594e, 0x14141d40, 0x16140001, 0x12131614, 0x0e0f1011, 0x08090c0d, 0x02030507, 0x0b010b00, 
-    0x2b14080b, 0x33272001, 0x3233011e, 0x010e3337, 0x23013305, 0x23032103, 0x02010b01, 0x17defe68, 0x55630c77, 0x0b771ea3, 0xf5f5fe9e, 0x6ed1c901, 
-    0xd16cf5fd, 0xd5d51803, 0x36f23506, 0x7a786f39, 0x012bfa60, 0x027bfe85, 0xfdfc0227, 0x41000004, 0x3c34073b, 0x0e000600, 0x1c011100, 0x01040a40, 
-    0x01100001, 0x4a020307, 0x2105fd41, 0x10820223, 0x0100033c, 0x01087003, 0x04050007, 0x00620507, 0x4b3f0000, 0x39030300, 0x0401064b, 0xe6823a04, 
-    0x25050d42, 0x01000020, 0x2f827200, 0x72010322, 0x278d2c89, 0x58501523, 0x2052a640, 0xa32a8235, 0x8e3a2052, 0x22948227, 0x8c730405, 0x4c032480, 
-    0x8a28401b, 0x0300249d, 0x88720307, 0x05052327, 0x2e825507, 0x5a050728, 0x05070500, 0x0083594e, 0x0f104027, 0x0f110f0f, 0x2e008311, 0x09101112, 
-    0x012b1b08, 0x27231333, 0x41172307, 0x0a270a72, 0xa68cd3bd, 0x41b78ca5, 0x07260c6b, 0xb2f6fe3c, 0x69415db2, 0x0000220d, 0x06a74204, 0x0b003a2c, 
-    0x1f001700, 0xad002200, 0xa94221b5, 0x2dea8306, 0x01010321, 0x0309020a, 0x00010400, 0xa5420b63, 0x20eb8316, 0x05444221, 0x04202e98, 0x2c20ec82, 
-    0x70426e82, 0x232b8e0a, 0x55080606, 0x73426182, 0x40300809, 0x0d202021, 0x2000010c, 0x1f222022, 0x1b1c1d1e, 0x1318191a, 0x0d170c10, 0x00040716, 
-    0x0c0a010b, 0x012b1408, 0x34013d22, 0x1d32013b, 0x33231401, 0x82420b8a, 0x5d012e0a, 0x1e8f1e1e, 0x1e1ef91e, 0xfe1e1e8e, 0x0c15417b, 0x836f0621, 
-    0x841d821a, 0x419a2002, 0x87420d1d, 0x39390807, 0x0b000300, 0x92000e00, 0x06010db5, 0x4b4a0102, 0x585035b0, 0x00001f40, 0x00720001, 0x72010201, 
-    0x00060107, 0x04060304, 0x02020062, 0x01054b39, 0x033a0303, 0xb04b1b4c, 0x82268d3a, 0x03042218, 0x242c8c73, 0x401b4c02, 0x24488927, 0x02060200, 
-    0x23268872, 0x55060404, 0x06322d82, 0x04005a04, 0x594e0406, 0x0c0f4059, 0x0c0e0c0c, 0x0083110e, 0x08081029, 0x33012b1a, 0x41072313, 0x012509fa, 
-    0x9ac5b866, 0x24e18c5b, 0xf8fe3907, 0x20d7955c, 0x20d78608, 0x21d78c8f, 0x8f82001d, 0x01000223, 0x8ea88c61, 0x851d20d5, 0x832a94a4, 0x002828d3, 
-    0x01060102, 0x90700602, 0x22d4a327, 0x42211521, 0x01260acf, 0xfd56023d, 0xd58db1aa, 0x9f940822, 0x023ad48c, 0x75fe2500, 0xd505d104, 0x22001f00, 
-    0x1340d400, 0x04060121, 0x03000103, 0x04820104, 0x01114a34, 0x4b490103, 0x585021b0, 0x01082040, 0x03020006, 0x6b450206, 0x2da08205, 0x074b3a03, 
-    0x01000001, 0x0101005b, 0x7645013e, 0x881d2007, 0x251c8427, 0x005f0100, 0xdd410404, 0x8220200f, 0x8202203e, 0x7000214d, 0x04292d94, 0x29401b4c, 
-    0x04060400, 0x82279472, 0x8457209a, 0x2979825c, 0x594f0100, 0x19405959, 0xf0422020, 0x1a750805, 0x16171819, 0x0a131415, 0x011f0008, 0x1408091f, 
-    0x3632012b, 0x030e1537, 0x35262223, 0x37023e34, 0x03210333, 0x01330123, 0x15010e23, 0x020b1614, 0x2f1f6404, 0x1c21161f, 0x7671111b, 0x1f29190b, 
-    0xf5fd6e04, 0xc901d16c, 0x5ec901f5, 0xf1382830, 0xf0fed5d5, 0x06850f0f, 0x55020507, 0x35311958, 0x8501233c, 0xd5057bfe, 0x55412bfa, 0x032e2a22, 
-    0xfdfc0237, 0x087b4504, 0x1c006d2e, 0x32002f00, 0x31b69700, 0x04060216, 0x4107f442, 0x2d08053c, 0x62020601, 0x00050500, 0x0000005b, 0x01074b3f, 
-    0x4b390404, 0x01010103, 0x1b4c013a, 0x5039b04b, 0x03204058, 0x01020101, 0x06010873, 0x2d920200, 0x1b4c0424, 0x37822340, 0x05060525, 0x97700604, 
-    0x0532082b, 0x4059594c, 0x1e303015, 0x3032301d, 0x1d272932, 0x112f1e2f, 0x092b1a11, 0x012b1808, 0x2e27012e, 0x36343501, 0x33013e37, 0x1e171632, 
-    0x07141501, 0x77460706, 0x36322606, 0x34353637, 0x08218226, 0x07222320, 0x17141506, 0x010b0116, 0x2d1ed101, 0x2b10110f, 0x39642525, 0x2325653a, 
-    0x3c1f202c, 0x8d46ac01, 0x02350805, 0x14362243, 0x1714182c, 0x2b3f1d39, 0x012c2c2c, 0x05d5d514, 0x1c301177, 0x3b23431f, 0x2a252565, 0x6423252b, 
-    0x3a3b483d, 0x0189fa25, 0x057bfe85, 0x2c1418c3, 0x2d33823f, 0x2c2b1517, 0x2c2c3f41, 0xf80264fc, 0xbb4608fd, 0x000e2d09, 0x0032002a, 0xb5bd0035, 
-    0x060a0134, 0x08073e41, 0x01022827, 0x03040000, 0x00630400, 0x02050b01, 0x03010603, 0x0a010c64, 0x0a070800, 0x06006208, 0x094b3906, 0x3a070701, 
-    0x073c4407, 0x0e822820, 0x73070822, 0x062c359f, 0x33401b4c, 0x0a030600, 0x700a0603, 0x0823329b, 0x82550a08, 0x080a3b6f, 0x0a08005a, 0x59594e08, 
-    0x33331c40, 0x35330000, 0x31323533, 0x2d2e2f30, 0xb7822b2c, 0x29292908, 0x24282323, 0x2b19080d, 0x37363401, 0x17323336, 0x011f011e, 0x33161716, 
-    0x3d363732, 0x07063301, 0x27222306, 0x012f012e, 0x82056141, 0x011d210f, 0x080bb043, 0x1c181f26, 0x22205633, 0x391a260f, 0x10101315, 0x7d14141f, 
-    0x55333401, 0x250e201f, 0x1217391f, 0x0f051008, 0x52140a1c, 0x080cd143, 0x30330623, 0x083b2050, 0x1e0e1104, 0x1a06060d, 0x6306281a, 0x04083c3c, 
-    0x0d21100f, 0x0c020307, 0x062c1a0d, 0x0cf1435e, 0x02000023, 0x29008200, 0xd5059c04, 0x13000f00, 0x9645a100, 0x82282005, 0x09033316, 0x0a610302, 
-    0x06000901, 0x61060904, 0x01010108, 0x2a825900, 0x004b3926, 0x59050404, 0x24095d49, 0x4058503a, 0x212f9025, 0x21820400, 0x5d050422, 0x012d3789, 
-    0x2b401b4c, 0x01080000, 0x01000201, 0x23309261, 0x55040505, 0x042e5b87, 0x59594d05, 0x10101240, 0x13101310, 0x00851112, 0x080b1029, 0x21012b1d, 
-    0x88112115, 0x032e0803, 0x23110123, 0x029a0103, 0x01aefeef, 0x01cdfe33, 0xfee1fd65, 0x02b865a0, 0x05ca6b7d, 0x46feaad5, 0xaae3fdaa, 0x81fe7f01, 
-    0x04032702, 0xbf82fcfc, 0xa6000334, 0x71040000, 0x1500d505, 0x2d002200, 0x0bb59200, 0x8f460501, 0x82062009, 0x0405299d, 0x00630502, 0x5b000303, 
-    0x0726ef84, 0x01040401, 0x9943005b, 0x20ef8307, 0x8226881c, 0x0100241c, 0x885f0104, 0x8203202e, 0x002328e6, 0x02030000, 0x8b630300, 0x01012326, 
-    0x4a875704, 0x4f010422, 0x2308de82, 0x17232416, 0x232a2c16, 0x212d242d, 0x1722161f, 0x20131522, 0x2b150808, 0x17322113, 0x06141516, 0x07010e07, 
-    0x22079443, 0x43010129, 0x262a078f, 0x1311012b, 0x35363732, 0x0a832734, 0x01a66c08, 0x7c7de4ba, 0x62201f22, 0x29539443, 0xfe86852a, 0x0146fefa, 
-    0x21674cb6, 0x41202041, 0xafefeb94, 0x504f4b4c, 0xd505efa7, 0x46b66363, 0x3326266b, 0x3366170a, 0x67ca5284, 0x1c6d0368, 0x3c79381d, 0xfe321951, 
-    0x3e39fd3e, 0x45928d3d, 0x00ddfd44, 0x8b000100, 0x3104e3ff, 0x2b00f005, 0x0f407900, 0x01020112, 0x03021326, 0x82012702, 0x06b947e6, 0x0200162a, 
-    0x005b0102, 0x4b410101, 0x0425fb84, 0x42000001, 0x07734300, 0x03001322, 0x03221082, 0x25885f00, 0x1b4c0224, 0x59821940, 0x0103022a, 0x03006302, 
-    0x57030000, 0x033f3787, 0x59594f00, 0x00010f40, 0x17192022, 0x2b000b0d, 0x08052b01, 0x22052b14, 0x02262726, 0x44123435, 0x1721089d, 0x082b4315, 
-    0x10116108, 0x32331617, 0x37363736, 0x0e070615, 0x8ce60201, 0x4f4f50e1, 0xe050504f, 0x2459308c, 0x49245624, 0x2d552b56, 0x62319361, 0x2dc56262, 
-    0x4a532b55, 0x5927504e, 0x6667641d, 0xb5b51f01, 0x67672001, 0x09090b65, 0x3dcf1421, 0x4c101020, 0xcdfe984c, 0x9898cefe, 0x3e1f1010, 0x0a1529cf, 
-    0x0200000a, 0x21050341, 0xab823c07, 0x44012f32, 0x01160f40, 0x172a0304, 0x2b040502, 0x03050201, 0x8207424b, 0x00032ed1, 0x00700301, 0x4b3f0000, 
-    0x03040400, 0x2bd5825b, 0x05004b41, 0x065b0205, 0x42020201, 0x4b2cf782, 0x585008b0, 0x00002140, 0x66000301, 0x01210482, 0x20289872, 0x08f04a0a, 
-    0x1520279d, 0x23202782, 0x6b4b7ba5, 0x20529d09, 0x2052823a, 0x0645491d, 0xa2820320, 0x82060521, 0x5f0221e7, 0x0420aa88, 0x2205d842, 0x85720001, 
-    0x00032c47, 0x04030504, 0x02050064, 0x87570502, 0x020523ef, 0x0084594f, 0x05114038, 0x1d252704, 0x040f111b, 0x112f052f, 0x16080710, 0x0333012b, 
-    0xd4411323, 0x011e231e, 0xd4413233, 0xbafa3408, 0x8fb19ae5, 0x4f4f4ee0, 0xdf4e504f, 0x27592d8f, 0x41265226, 0x2f2409d8, 0x55596691, 0x2705d841, 
-    0xf8fe3c07, 0x6467aff9, 0x2507dd41, 0x0a0a6864, 0xdd41200a, 0x5048220d, 0x08dd4120, 0x380bdf41, 0x01320006, 0x02134025, 0x19000201, 0x2d040501, 
-    0x0506021a, 0x0603012e, 0x06e34104, 0x0200242e, 0x02000400, 0x01017004, 0x4b3f0000, 0x0431ea82, 0x0404005b, 0x06004b41, 0x075b0306, 0x42030301, 
-    0x07354f03, 0x23822120, 0x72000222, 0x02212d82, 0x23289872, 0x40585015, 0x352054a7, 0x54a42b82, 0x28823a20, 0x7d8b1e20, 0x99820620, 0x5f030622, 
-    0x05248588, 0x24401b4c, 0x042c208b, 0x04060500, 0x06006305, 0x57060303, 0x0621cb87, 0x05c04103, 0x08124038, 0x20282a07, 0x0712141e, 0x11320832, 
-    0x08081012, 0x33012b17, 0xc3413717, 0x9101282e, 0x8ca6a58c, 0x4182bdd3, 0xb22526c6, 0xf9f6feb2, 0x2ac841b1, 0x00012608, 0x0475fe8b, 0x00f00531, 
-    0x40c60049, 0x00014418, 0x020e4505, 0x010f0001, 0x14240104, 0x23040302, 0x05030201, 0x06b64a4a, 0x0001063e, 0x005b0500, 0x4b410505, 0x04010100, 
-    0x0404005b, 0x03004b42, 0x005b0203, 0x023e0202, 0x2608b64a, 0x02000300, 0x935f0203, 0x4404202e, 0x1b2807e3, 0x04000100, 0x63040103, 0x00262c90, 
-    0x21401b4c, 0x3d820500, 0x00050123, 0x23268963, 0x57030202, 0x23086c86, 0x594f0203, 0x13405959, 0x3d3f0001, 0x282b3233, 0x090b1e20, 0x49014900, 
-    0x2b140807, 0x07062201, 0x17101106, 0x460b0b43, 0x062b0608, 0x23010e07, 0x27262722, 0x86011e35, 0x3435211f, 0x2e210e82, 0x142a4501, 0x61e50226, 
-    0x62623193, 0x3e082843, 0x29182f16, 0x1e0f0b14, 0x3e581d1e, 0x2a2e2b2c, 0x13132411, 0x1e40112b, 0x1f10161e, 0x4348cb81, 0x05211067, 0x071a454c, 
-    0x3f073c43, 0x32020905, 0x1e331728, 0x16174428, 0x0c060617, 0x040d0883, 0x18180304, 0x202b202c, 0x5c66082d, 0x45138043, 0x0b300a4b, 0x18012800, 
-    0x01190f40, 0x1a250304, 0x26040502, 0x290a4b45, 0x00010621, 0x005b0100, 0x49450101, 0x45072010, 0x0a2d0849, 0x1f405850, 0x01060100, 0x00010300, 
-    0x0e474563, 0x15202689, 0x4fa42682, 0x4fa53520, 0x26823a20, 0x76891c20, 0x69820520, 0x1b450520, 0x8922200e, 0x051a451e, 0x1a456320, 0x432f840a, 
-    0x172e0659, 0x00010c0d, 0x1c1e2123, 0x280c1517, 0x864f280d, 0x4f082005, 0x03270e86, 0x02012e22, 0x4b123435, 0x2f080598, 0x23012e15, 0x10110222, 
-    0x37363221, 0x02010e15, 0x911e1e6a, 0x90131e1e, 0x51519be1, 0x5990e19c, 0xa7494ea1, 0x01c4c25d, 0x49a95b86, 0x6f06a14e, 0x2d081d83, 0x74f91e91, 
-    0x1f01c668, 0x2001b8b7, 0x2a2869c8, 0xfe413ccf, 0xfdcdfed0, 0xcf3d409e, 0x0200282a, 0x00008900, 0xd5055204, 0x18000a00, 0xf7496700, 0x48162005, 
-    0x4b2208c6, 0xdf470104, 0x058f4c06, 0x58503a24, 0x13821340, 0x02010022, 0x220eec48, 0x4800001a, 0x1d8205ec, 0x02010123, 0x21388757, 0xef820102, 
-    0x0c0d403f, 0x0b15170b, 0x26180c18, 0x16080520, 0x2021132b, 0x10111617, 0x01290607, 0x3e373225, 0x055f4c01, 0x11012b28, 0x012f0189, 0x0082a256, 
-    0xaafe2608, 0x2b01d1fe, 0x323365ff, 0xb5333331, 0xd505607d, 0x80feb6b6, 0xb6b582fe, 0xe03f7ea6, 0x3fe3a5a8, 0x77fb3d40, 0x20bf8200, 0x20bf8208, 
-    0x24bf824e, 0x0026000f, 0x36bf858b, 0x01010620, 0x04000107, 0x00610001, 0x5b020505, 0x39020200, 0x4701084b, 0x4f500696, 0x891d2009, 0x241d8227, 
-    0x03040300, 0x242f885f, 0x401b4c05, 0x245e8224, 0x05020105, 0x23278c63, 0x57040303, 0x04214c87, 0x39dd8303, 0x25101113, 0x21222324, 0x1126101f, 
-    0x11212726, 0x18080910, 0x3523132b, 0xe7861133, 0x23010e27, 0x3e322521, 0x24ea8402, 0x2e27022e, 0x26eb8201, 0x11211521, 0x867d7d85, 0xfd5322f1, 
-    0x38f182a8, 0x566e452f, 0x32341941, 0x1926190d, 0x6082ad35, 0xf8fe0801, 0x0295c502, 0x3dfd827b, 0xb581fe81, 0x11a6595d, 0x411f2f20, 0x8c57aadc, 
-    0x4320536e, 0x952bfe3c, 0x0000e1fd, 0xc7410300, 0x3c072f05, 0x13000600, 0x16012000, 0x020102b5, 0xbb460100, 0x0003230a, 0xbb460302, 0x06062607, 
-    0x03005b03, 0x051d5503, 0x005b0422, 0x460be353, 0x03230866, 0x97007202, 0x07bb4628, 0xbb4654a3, 0x46549b0c, 0x28820cbb, 0x05010727, 0x04050400, 
-    0x2485885f, 0x401b4c06, 0x07bb4625, 0xf5822082, 0x03050624, 0x28826406, 0x05040423, 0x20068257, 0x21cc8305, 0x62430405, 0x15103206, 0x141d1f14, 
-    0x28201520, 0x10121121, 0x2b190808, 0x05ba4613, 0x32210528, 0x1512011e, 0x98410214, 0x34352707, 0x012b022e, 0xa546e911, 0xfe320805, 0xab2f01cd, 
-    0x5050a4fb, 0xfeabfba4, 0x802b01d1, 0x2f2f6baf, 0x607faf6c, 0xb2b23c07, 0x5a5df6fe, 0xbfe7feb8, 0xb8e7fec0, 0x873aa65a, 0xdfa5a4df, 0x8b423a87, 
-    0x0010220d, 0x788b4221, 0x2011122b, 0x1c1d1e1f, 0x1221111a, 0x42f78221, 0xf3950a8b, 0x22088642, 0x87a5faab, 0x882f20f1, 0x088042f1, 0xc021f383, 
-    0x42f38cbf, 0x0122077b, 0x8343c500, 0x000b2206, 0x05814377, 0x02001d29, 0x02040300, 0x4e006103, 0x00200d2f, 0x24078c57, 0x4058503a, 0x2524881a, 
-    0x04050004, 0x2b885d05, 0x1b4c0127, 0x00002040, 0x08224e00, 0x04204984, 0x8308194e, 0x594d252d, 0x11094059, 0x10250083, 0x2b1a0806, 0x080b4e13, 
-    0xc521152e, 0x54fd7603, 0x72fd8e02, 0x77fcbf02, 0x2008fe4d, 0x846d8200, 0x40072aa7, 0x0f000300, 0xb04bca00, 0x22848217, 0x8201002a, 0x02012318, 
-    0x08490070, 0x82612005, 0x4b3f3177, 0x02030300, 0x02020059, 0x06004b39, 0x00590706, 0x20074850, 0x54318235, 0x33870b63, 0xe5832e96, 0x92542420, 
-    0x252e870a, 0x06070006, 0x64885d07, 0xef820320, 0x268a2a20, 0x20053b41, 0x24918862, 0x06070706, 0x21888655, 0xf9820706, 0x0b405922, 0x112bfa84, 
-    0x08081011, 0x33012b1c, 0x41052303, 0x02260a00, 0x9ae5bab2, 0x0641d8fe, 0x4007250b, 0xaa63f8fe, 0x8205084f, 0x080b41e1, 0x06003c26, 0x3b011200, 
-    0x200c2d44, 0x2c1d822b, 0x03020003, 0x00050070, 0x06050706, 0x06f14a61, 0x03040423, 0x2bb38259, 0x07004b39, 0x00590807, 0x083a0808, 0x2007f04a, 
-    0x0b954328, 0x00203586, 0x15232f96, 0xae405850, 0x82352062, 0x2062ab32, 0x442f823a, 0x92870c28, 0x08000725, 0x885d0807, 0x4c042499, 0x442b401b, 
-    0x04240d50, 0x62040305, 0x0025f887, 0x07080807, 0x22ee8655, 0x4c4d0807, 0x0c2005d3, 0x24067b41, 0x08091012, 0x070d4b1d, 0x210b7f41, 0x47445b01, 
-    0x41972006, 0x3c440c82, 0x09844105, 0x37430220, 0x41072005, 0x04200783, 0xb1458982, 0x592b2007, 0x8b880894, 0x49000021, 0x83410510, 0x0bfe5818, 
-    0xad238341, 0x50352262, 0x0d615958, 0x3a20629e, 0x25202f82, 0x83419293, 0x0cb95913, 0x83410020, 0x11122129, 0x25068341, 0x07272313, 0x03430723, 
-    0x591c200b, 0x842005b9, 0x240d8241, 0xb2b2f6fe, 0x0982415d, 0x41030021, 0x3a280683, 0x17000b00, 0xb1002300, 0x0805bf44, 0x01032928, 0x0a020b01, 
-    0x01040003, 0x06006300, 0x06080700, 0x05006107, 0x00590405, 0x4b390404, 0x09080800, 0x09090059, 0x054c093a, 0x94262007, 0x00082530, 0x5d090809, 
-    0x05243788, 0x2c401b4c, 0x1044288c, 0x2461840a, 0x08090908, 0x2e5d8655, 0x594d0908, 0x0d1f4059, 0x2300010c, 0x59202122, 0x0c4130b5, 0x6f01210a, 
-    0x210ab659, 0x124140fd, 0x0eb5590b, 0x42071a41, 0x0b24099b, 0x31011700, 0x2005295c, 0x07914428, 0xa24b0820, 0x16fa440a, 0x58500a26, 0x01002640, 
-    0x02232982, 0x44630001, 0x2d9608ca, 0x2d821520, 0x35205dab, 0x3a205dac, 0x8f052651, 0x1285458b, 0xb1892920, 0x20058445, 0x1a844561, 0x40595929, 
-    0x17000117, 0x5d141516, 0xc44b07c6, 0x4b092005, 0x9a450ec4, 0x1e31270c, 0x1e1e911e, 0x834103fe, 0x2213820e, 0x449a1e91, 0xab46111b, 0x461320d2, 
-    0x01260cab, 0x9ac5b88b, 0xa54357fe, 0x16ab460c, 0x03000826, 0x91000f00, 0x2005a143, 0x081f4825, 0x20228347, 0x412c9022, 0x282012fb, 0x26117148, 
-    0x04060500, 0x47006105, 0x7e47107f, 0x1521220e, 0x0b7a4421, 0x024f0126, 0x8aaafd56, 0x0822d28c, 0xdc419f94, 0x00013408, 0x0475fec5, 0x00d5054e, 
-    0x40da0020, 0x0001080a, 0x82010902, 0x069d5004, 0xf1452920, 0x0b404708, 0x09590228, 0x02020208, 0xa5834b3a, 0x200d5d5b, 0x25308826, 0x00010000, 
-    0x78475f01, 0x2037870c, 0x07a94402, 0x2d882420, 0x51830720, 0x02070023, 0x8b528361, 0x4c042537, 0x002a401b, 0x2005be4e, 0x822e9361, 0x865720ad, 
-    0x066b5b87, 0x0e821120, 0x20002023, 0x33008311, 0x0a252417, 0x212b1c08, 0x1415010e, 0x37323316, 0x23010e15, 0x5706685b, 0x15320ab3, 0x2830b803, 
-    0x3e3e3638, 0x7025402a, 0x29190b76, 0xab45fd1f, 0x55412f0a, 0x1e2e2a22, 0x55090b85, 0x34311959, 0xc649233c, 0x01002d0a, 0x0000e900, 0xd5055804, 
-    0x6b000900, 0x20050d42, 0x146f4a18, 0xa4513a20, 0x00182508, 0x73040304, 0x01202490, 0x1d20e882, 0x6d4a1a85, 0x03033008, 0x02005502, 0x00590302, 
-    0x4d030203, 0x83b75959, 0x051023d2, 0x634a1908, 0xe9232a09, 0x5cfd6f03, 0x9bfd6502, 0x239783cb, 0x4bfdaa34, 0x9782fe82, 0xe3ff663d, 0xf0055004, 
-    0x98003100, 0x01111240, 0x01120102, 0x01290205, 0x012e0403, 0x57040300, 0x1e220632, 0x72820500, 0x61040522, 0x200e3a57, 0x0c3a5706, 0x25881b20, 
-    0x18820320, 0x200f4257, 0x246c8221, 0x02010502, 0x20258963, 0x074a5700, 0x4f352e84, 0x13405959, 0x2c2d0001, 0x22242a2b, 0x0b0d1719, 0x31013100, 
-    0x104e5707, 0x011e1732, 0x012e1517, 0x23012e27, 0x0e070622, 0x16141501, 0x08055057, 0x37013e63, 0x21352311, 0x06070611, 0xdd8fbc02, 0x524f4e4d, 
-    0x8cdf4e4e, 0x532c5464, 0x26552b27, 0x612d5c2c, 0x31323392, 0xc85e3030, 0x181a3b20, 0x01d9152e, 0x6665519a, 0x6664681d, 0xbab51e01, 0x64641f01, 
-    0x290e1a67, 0x3829cf1a, 0x4a111311, 0x9de34d4e, 0x964be19e, 0x17080808, 0xa6910111, 0x264b7dfd, 0x05874a27, 0xe3ff663f, 0x27075004, 0x3f000b00, 
-    0x12400801, 0x0506011e, 0x0609011f, 0x08070137, 0x0704013c, 0x06e66304, 0x01032e22, 0x3106e663, 0x0500010a, 0x00640002, 0x07080009, 0x00610809, 
-    0xca530606, 0x07072907, 0x010b5b04, 0x04420404, 0x2007c153, 0x2335832d, 0x02007201, 0x3a2434a7, 0x2a405850, 0x07203497, 0x07225c82, 0x71885f04, 
-    0x1b4c0624, 0x2c8f3040, 0x06000526, 0x63060509, 0x07259e88, 0x57070404, 0x239a8600, 0x594f0407, 0x2d07d447, 0x38393a3b, 0x24263032, 0x3f0c1719, 
-    0x01643f0d, 0x080c2109, 0x200d0164, 0x122b5703, 0x250eb241, 0x3233011e, 0xb3413736, 0x6490200b, 0x65300b2a, 0x4e4ddd8f, 0x4c504f4f, 0x5e2f8fde, 
-    0x24562c2c, 0x250cc141, 0x23639132, 0xc241183a, 0x64062008, 0xf9210648, 0x05cb41ae, 0x2001b52a, 0x0c6b6167, 0x192a0e0e, 0x210dcc41, 0xcd41484e, 
-    0x0002210e, 0x3d05cb41, 0x0006003c, 0x408f0128, 0x02010216, 0x05011400, 0x08011504, 0x06012105, 0x03012607, 0x92500506, 0x002c2f06, 0x00040002, 
-    0x00700402, 0x06070008, 0x644c0708, 0x05052107, 0x200b5657, 0x08565709, 0x58500826, 0x01012a40, 0x00213182, 0x05575766, 0xd9563786, 0x05885708, 
-    0x0a203189, 0x29203182, 0x9f0be956, 0x82152030, 0x2096af30, 0x2064af35, 0x2030823a, 0x20959326, 0x57b98206, 0x2c200fa8, 0x230ea857, 0x64050408, 
-    0x57072f41, 0x39840ab0, 0x3605f350, 0x08164059, 0x23242507, 0x191d1f22, 0x07101217, 0x11280828, 0x570a1012, 0x51540bb5, 0x33122313, 0xf0433632, 
-    0x010e2105, 0x3a07ab57, 0x9ade8d58, 0xdf9b5251, 0x51aa638d, 0xc860a951, 0x40c8c0c2, 0x01d92a64, 0x51ca519a, 0xf9210507, 0x095854b1, 0xcf36352e, 
-    0xcffe484e, 0xcdfec8fe, 0x211fd7fe, 0x0805e243, 0x00004d20, 0xfd660002, 0x055004c3, 0x002100f0, 0x40b30025, 0x02010d12, 0x05010e01, 0x03011a02, 
-    0x15451f04, 0x4425200a, 0x9a4708c9, 0x0d575c06, 0x1c450820, 0x4523200c, 0x1882091c, 0x4b030621, 0x062205a3, 0x675c5d07, 0x4529200c, 0x2d881124, 
-    0x3a0f514f, 0x00011740, 0x22232425, 0x1b1c1d1e, 0x10121618, 0x2100090b, 0x08092101, 0x55052b14, 0x30411482, 0x3307250b, 0xbc022303, 0x24192d41, 
-    0x92bbefbf, 0x1f2a411d, 0xa7fec722, 0x390b0f45, 0x000b003c, 0x404f012d, 0x04011912, 0x07011a03, 0x05012604, 0x02012b06, 0x3f430405, 0x00292806, 
-    0x05060007, 0x4b610607, 0x785c0b8b, 0x5709200d, 0x27220c2e, 0x2a820100, 0x00010323, 0x57398763, 0x2e890e36, 0x58501523, 0x205fac40, 0xaa308235, 
-    0x0516515f, 0x05208e90, 0x4e578182, 0x892a200f, 0x000325b5, 0x04030704, 0x715cbd89, 0x42378409, 0x403305ff, 0x010c0d1b, 0x28292a00, 0x1e222427, 
-    0x0c15171c, 0x4b2d0d2d, 0x0a200595, 0x570e954b, 0xd741155a, 0x5702200b, 0x3f20055f, 0x5719d941, 0x09431362, 0x00002e17, 0x00890001, 0x05480400, 
-    0x000b00d5, 0x05b74865, 0x155a1520, 0x02612406, 0x65000001, 0x1c880f10, 0x03010525, 0x84590003, 0x4c032422, 0x821b401b, 0x03012309, 0x3b8b5500, 
-    0x82590321, 0x03002124, 0x260f1553, 0x11211133, 0x82231133, 0x89233905, 0xcb2902cb, 0xcbd7fdcb, 0x9cfdd505, 0x2bfa6402, 0x39fdc702, 0x03000200, 
-    0xce209382, 0x13249382, 0x99001700, 0x22399585, 0x01020305, 0x0002060a, 0x6100010b, 0x000b010c, 0x080b0708, 0x02010461, 0x0f546302, 0x09252995, 
-    0x02070701, 0x202f8459, 0x20af8207, 0x23098228, 0x55020701, 0x07215598, 0x21318259, 0xbc830702, 0x14141628, 0x17141714, 0xee611516, 0x10112d08, 
-    0x2b1d080d, 0x33352313, 0x21153335, 0x33220382, 0xd1852315, 0x21350138, 0x86868915, 0xca2a02ca, 0xfdca8787, 0xf402cad6, 0x5104d6fd, 0x0082e0a4, 
-    0xaffba422, 0x0327df83, 0x00e0e071, 0x82c90001, 0x820620e3, 0x000b22e3, 0x24e18566, 0x01010317, 0x06e15301, 0x00010425, 0x54590500, 0x14200c99, 
-    0x00221384, 0x26895d05, 0xc8820120, 0x02001b22, 0x00231082, 0x82610102, 0x0505231f, 0x26845500, 0x00213a82, 0x0e784105, 0x11213723, 0x829d8221, 
-    0x21153605, 0xfe3901c9, 0xfe3d03c7, 0xfc3901c7, 0x8104aac3, 0x7ffbaaaa, 0x05eb43aa, 0x8f549784, 0x54b32006, 0x2420058f, 0x0423ae82, 0x60040100, 
-    0x0523054a, 0x50030301, 0x06230673, 0x54020201, 0x21210e89, 0x202c8200, 0x212c8272, 0x28997201, 0x58503a24, 0x28891e40, 0x00244682, 0x5d070207, 
-    0x03203089, 0x2520d982, 0x00212089, 0x231a8204, 0x62030402, 0x07232982, 0x87550207, 0x54022077, 0x01201678, 0x0226ea8a, 0x9ae5bab3, 0xf08bdbfe, 
-    0xfe400725, 0x8872faf8, 0x410220f5, 0xf352058b, 0xb5182106, 0x280bf352, 0x01010225, 0x01000500, 0x2efb8505, 0x04040106, 0x05005905, 0x074b3905, 
-    0x54030301, 0x22200e71, 0x3182b184, 0x72010522, 0x15202999, 0x56a8fc82, 0x2c823520, 0x8c6a56a5, 0x82808509, 0x0800249f, 0x895d0803, 0x4c042488, 
-    0x8a26401b, 0x050021a2, 0x03231b82, 0x82610405, 0x0808232a, 0xd1875503, 0x54540320, 0x0dd0520e, 0x5b410320, 0x5209200b, 0x6d2005d0, 0x260c5d41, 
-    0xb2f6fe3c, 0x4178fab2, 0x0320085f, 0x52065f41, 0xa02007cf, 0x2005ef42, 0x07755223, 0x0001062c, 0x05010763, 0x00590605, 0x145b0606, 0x0ec95205, 
-    0x2a8b2020, 0x04010827, 0x09040900, 0x2032895d, 0x20d88205, 0x21228b27, 0x1c820600, 0x05060423, 0x232b8261, 0x55040909, 0x04200682, 0x04205283, 
-    0x423dbe52, 0x756c0b56, 0x56fd210c, 0x520b0041, 0xfa210dbe, 0x0708413b, 0x24096742, 0x0117000b, 0x05bf520e, 0x2b472220, 0x1930430a, 0x58500a26, 
-    0x01002040, 0x04232b82, 0x99630001, 0x82152027, 0x2051a527, 0x2051a635, 0x2027823a, 0x4379881d, 0x242015a9, 0xa8431f88, 0x43612007, 0x9c5214a8, 
-    0x0cbe4327, 0x9c521f20, 0x41192005, 0x91200e61, 0x5b411683, 0x059b5211, 0x21b5b744, 0x60422313, 0xb874250c, 0x72fe9ac5, 0x440c5943, 0x082615b7, 
-    0x0f000300, 0x55438000, 0x001f2805, 0x04010000, 0x42610100, 0x31601924, 0x41268605, 0x232015d1, 0xd0414587, 0x1172521c, 0x520b1c44, 0x86200572, 
-    0x0823c08c, 0x4436fa94, 0x01370817, 0x75fec900, 0xd5050604, 0xc2002000, 0x010c0a40, 0x010d0102, 0x52020203, 0x23230673, 0x5a020809, 0x392306e8, 
-    0x8201054b, 0x045930af, 0x3a010101, 0x0202004b, 0x03005b03, 0x4f033e03, 0x20270752, 0x03000200, 0x965f0302, 0x52012031, 0x1e230767, 0x82000105, 
-    0x00022143, 0x8d05e569, 0x4c062631, 0x0024401b, 0x23438307, 0x61060700, 0x03232a8b, 0x86570203, 0x03022675, 0x5959594f, 0x095b5240, 0x2524172c, 
-    0x080a1111, 0x11012b1c, 0x5f521521, 0x45352014, 0x02250531, 0xfe3901cd, 0x0e5f52c7, 0x4173fe21, 0x0524051f, 0xaa7ffb2b, 0x250f6052, 0xaa8104aa, 
-    0xdb8200aa, 0x26059347, 0x002a003c, 0x444d0136, 0x2c370537, 0x050c0100, 0x01080302, 0x04006403, 0x025b0004, 0x3f000001, 0x5b01094b, 0x392c0606, 
-    0x06010a4b, 0x00590b06, 0x0b3a0b0b, 0x2007115b, 0x0a686c2a, 0x31993c87, 0xad057a4e, 0x50352365, 0x65ad4058, 0x31823a20, 0x97922720, 0x0024be82, 
-    0x5d0b060b, 0x07249f89, 0x2e401b4c, 0x00212992, 0x23238208, 0x61070806, 0x0b233282, 0x8755060b, 0x0b0622f8, 0x051b5b4d, 0x00001a26, 0x33343536, 
-    0x423f016d, 0x026d0cdb, 0x44d32025, 0x61200cb4, 0x2120016d, 0x1c4349fa, 0x00013707, 0x03e3ff6d, 0x00d505bc, 0x40740018, 0x0101050a, 0x00010402, 
-    0xe26a0201, 0x07f85c0a, 0x00010123, 0x0fe26a5b, 0x10820120, 0x5f000122, 0x21063354, 0xe26a3903, 0x00032d05, 0x02030102, 0x00010061, 0x00570100, 
-    0x01203786, 0x3307e26a, 0x0f101112, 0x1800080a, 0x08051801, 0x22052b14, 0x35272627, 0x08067953, 0x11353637, 0x11213521, 0x0e070614, 0x67f60101, 
-    0x5b65615c, 0x43676361, 0xfe381d67, 0x33470283, 0x1dab3737, 0xec2d1716, 0x24292851, 0x03cb4a27, 0x12fcaa44, 0x3d3dc190, 0x25678239, 0x00008900, 
-    0xc782c904, 0x55000b29, 0x08090940, 0x62040205, 0x35240503, 0x0d405850, 0x00278382, 0x01034b39, 0x563a0202, 0x0d20080c, 0x00210e83, 0x821a8459, 
-    0x13402114, 0x02230982, 0x82550002, 0x02002206, 0x081c8259, 0x4d02003c, 0x13b65959, 0x04101212, 0x132b1808, 0x33011133, 0x01230109, 0x89231107, 
-    0xed7702cb, 0x5602bbfd, 0x9a19fef4, 0xfdd505cb, 0xfd980268, 0x028dfc9e, 0xb8fda4ec, 0x89000200, 0x8b86e0fd, 0x6d000f22, 0x14278d90, 0x05000400, 
-    0x935d0504, 0x8e1b8794, 0x821a209b, 0x2412822b, 0x61020004, 0x140b6000, 0x0622a583, 0xa58c1a08, 0x03330522, 0x0124a98e, 0x92bbefd7, 0x7c4fae8e, 
-    0x00012c05, 0x040000d7, 0x00d50573, 0x454e0005, 0x102b05e1, 0x39000000, 0x0101004b, 0x41005a02, 0x00260c37, 0x01020001, 0x1e835e02, 0x1b4c0025, 
-    0x4b001540, 0x02230589, 0x86550102, 0x02012b2d, 0xb559594e, 0x03101111, 0x92831708, 0x2115212c, 0xd102cbd7, 0xd50564fc, 0xff4bd5fa, 0x276f8406, 
-    0x03004007, 0x94000900, 0x2005ff4b, 0x088f601d, 0x3f000023, 0x8274824b, 0x0303237e, 0xa3635a04, 0x50352408, 0x601a4058, 0x02200b2c, 0x3a20218f, 
-    0x17202182, 0x0325218a, 0x04030400, 0x204a835e, 0x75aa8202, 0x002b0a6b, 0x72020302, 0x04040300, 0x85005503, 0x04032163, 0xf256b482, 0x3301260a, 
-    0x33152303, 0x24bb8211, 0xe5ba9c01, 0x24bf849a, 0xf8fe4007, 0x20c28363, 0x0a2f4102, 0x60000922, 0x27053141, 0x04040016, 0x01035900, 0x20153741, 
-    0x07374113, 0x04202488, 0x19209282, 0x04262e83, 0x61040001, 0x41410100, 0x0a7e570f, 0x91828785, 0x26054741, 0x71c6f701, 0x82d5059a, 0xd3052b89, 
-    0x000088fe, 0xd7000200, 0xbf41e0fd, 0x66092006, 0x172107cb, 0x20fe8400, 0x16c8415d, 0x8b6e1520, 0x8a622006, 0x82002026, 0x411d2092, 0x0024063f, 
-    0x02010302, 0x23411c82, 0x00592407, 0x58040304, 0x96840d15, 0x96890520, 0xbbef8523, 0x27968492, 0x00a7fec7, 0x00f6ff01, 0x2f055342, 0x405d000d, 
-    0x0708090d, 0x01020306, 0x00010800, 0x4207c772, 0x31084162, 0x08031415, 0x07132b17, 0x33113727, 0x01172511, 0x21152111, 0xe15091d7, 0x4e3b01cb, 
-    0xd10277fe, 0x3b0264fc, 0x029e6e6a, 0xdb98fdf8, 0xfdeefe6f, 0xdc83aae3, 0x00005630, 0xd5057904, 0x6c000c00, 0x02070ab7, 0x91880303, 0x03001528, 
-    0x03000200, 0x9c437002, 0x44042005, 0x1c880c31, 0x39441683, 0x8a1b200a, 0x44032034, 0x24820841, 0x4d020029, 0x12b75959, 0x59121112, 0x2a080644, 
-    0x11210109, 0x23011123, 0x56231101, 0x02010e01, 0x0f010401, 0x99f6febb, 0x05baf5fe, 0x0208fdd5, 0x052bfaf8, 0x03edfc27, 0x83d9fa13, 0x828b20a7, 
-    0x824620a7, 0x000926a7, 0x0207b652, 0x45d04402, 0x04298d83, 0x132b1808, 0x33110121, 0x38048211, 0x00018b23, 0xffc3f801, 0xc308fe00, 0x33fbd505, 
-    0x2bfacd04, 0x33fbcd04, 0x21008200, 0x83840002, 0x82400721, 0x000d29e2, 0x060bb696, 0x01020402, 0x20069758, 0x0caf431a, 0x78010321, 0x506705b5, 
-    0x43352007, 0x1e8f0d8a, 0x250ea943, 0x04040105, 0x24845902, 0x83420420, 0x0102220a, 0x82138272, 0x8255201a, 0x04022206, 0x27268259, 0x594d0402, 
-    0x09405959, 0x1125c782, 0x08061011, 0x0603641a, 0x0226cd87, 0x9ae5badb, 0xd38975fe, 0xfe400724, 0xd68a63f8, 0x3c30d387, 0x10000600, 0x0b40e500, 
-    0x00020102, 0x0502090e, 0x2208167c, 0x8202001b, 0x083368ef, 0x7b010421, 0xc06505e6, 0x820a2007, 0x631820d9, 0x1f8f0a3a, 0x1f821520, 0x3520429e, 
-    0x3a20429e, 0x06251f8e, 0x03050501, 0x24688459, 0x401b4c05, 0x827d8d1e, 0x8355201b, 0x5905211b, 0x03222782, 0x8f484d05, 0x120a2a05, 0x11111211, 
-    0x08071012, 0x09a9631b, 0x63072541, 0x5d2008a7, 0x630a2841, 0x2a4105a5, 0x0200260a, 0xe0fd8b00, 0x05834204, 0x6a000d22, 0x460d8542, 0xb38253c8, 
-    0x08061023, 0x0a9d421a, 0x03330522, 0x240ba142, 0xbbef9501, 0x0ba64292, 0xfec72308, 0x010000a7, 0x56fe9300, 0xf2053d04, 0xcc001c00, 0x020112b5, 
-    0x4b4a0101, 0x585005b0, 0x03001f40, 0xea6e3903, 0x4b412208, 0x06485e00, 0x005b052b, 0x053e0505, 0xb04b1b4c, 0x27268211, 0x0101001b, 0x01045b03, 
-    0x22912c84, 0xa005246d, 0x051c5149, 0x8406566f, 0x073d496b, 0x88000021, 0x1b402970, 0x01000400, 0x63010402, 0x21063744, 0x1d890061, 0x00825920, 
-    0x24094027, 0x27131123, 0x05db4220, 0x3e324808, 0x34113502, 0x06222326, 0x11231115, 0x013e1733, 0x01192033, 0x012b0614, 0x2da71802, 0x74162d43, 
-    0xca978e7c, 0xb73612b8, 0xb274017f, 0xf2fecda6, 0x4967401e, 0xa9b4f103, 0x57fcccd9, 0x70c6d505, 0xfcf5fd73, 0x82d2c405, 0x02002165, 0x2d06cf43, 
-    0x002a003c, 0xb61a0134, 0x08022d32, 0x57570106, 0x00222306, 0x4d780a01, 0x0aeb4b06, 0x06010727, 0x094b3906, 0x0bf36601, 0x1f4b2020, 0x8f32870a, 
-    0x50152327, 0x51a54058, 0x29823520, 0x3a2051a3, 0x9b832796, 0x84590621, 0x4c08247f, 0x9526401b, 0x0808219c, 0x2105067d, 0x2f825908, 0x7b520620, 
-    0x00162807, 0x31333400, 0x782e2f30, 0x0b200ab2, 0x202db278, 0x08484505, 0xae4b0120, 0xeffe2125, 0x20097343, 0x21ad4b06, 0xbb448c20, 0xff752c0c, 
-    0x055c04e3, 0x001200f0, 0x48700022, 0x172e0577, 0x01030300, 0x0101005b, 0x01054b41, 0xa64b0202, 0x8214200f, 0x01042514, 0x5f000200, 0x032c2788, 
-    0x1b401b4c, 0x03000100, 0x63030102, 0x00231e82, 0x88570200, 0x0002373a, 0x4059594f, 0x01131413, 0x131a1c00, 0x0a221422, 0x01120008, 0xad4b0612, 
-    0x10112106, 0x08068d76, 0x10111659, 0x27010e07, 0x11363732, 0x23262710, 0x11060722, 0x02161710, 0x7b7bfd68, 0x80b93e7c, 0x7b40be7b, 0x7bbe407b, 
-    0x4343449a, 0x43999a44, 0x1d434444, 0x8901bebf, 0x60bf8801, 0xc0645c60, 0x7afe79fe, 0xa45c64c0, 0x4b018a8d, 0x8d8c4a01, 0xb8fe8e8d, 0x8d8eb9fe, 
-    0x84000300, 0x400721e3, 0x16240982, 0xbd002600, 0x76091d56, 0x05230a68, 0x825b0305, 0x4b4125cf, 0x04040107, 0x200b6976, 0x06697635, 0x9807a575, 
-    0x0b1d5628, 0x72010322, 0x06264782, 0x02040201, 0x3187005f, 0x1d560520, 0x8220820a, 0x0405248e, 0x82640503, 0x02022128, 0x8405c978, 0x02043a77, 
-    0x5959594f, 0x17181540, 0x1e200405, 0x26182617, 0x16040c0e, 0x10111605, 0x08f27508, 0x41262721, 0xbd241f36, 0x709ae5ba, 0x25193a41, 0xf8fe4007, 
-    0x3f41abf9, 0x003c282c, 0x00190006, 0x564e0129, 0x04201169, 0x22086557, 0x5e060600, 0x08210674, 0x20f78301, 0x0c755e07, 0x82002321, 0x66002728, 
-    0x04010102, 0x2a997201, 0x3d560a20, 0x56299c0b, 0x81a30894, 0x9c0c9456, 0x823a2056, 0x05dc4b80, 0x0828aa85, 0x01070501, 0x5f030503, 0x0620b388, 
-    0x830b9456, 0x0004264b, 0x06040506, 0x23298264, 0x57050303, 0x0521fc88, 0x084c5e03, 0x081a1b3f, 0x1a212307, 0x11291b29, 0x0819070f, 0x10111219, 
-    0x2b170809, 0x23133301, 0x01230727, 0x21d34122, 0x21068769, 0xd7411f01, 0xfe3c261a, 0xf9b2b2f6, 0x24d941b1, 0x04000022, 0x56061b43, 0x2a2405e3, 
-    0xa4003a00, 0x2c09e556, 0x03080209, 0x00010500, 0x07070063, 0x05e27505, 0x06010b27, 0x0a5b0406, 0x07186201, 0x547f3a20, 0x822a8806, 0x221d8220, 
-    0x885f0406, 0x56072033, 0x228806e5, 0x00050027, 0x07050607, 0x232a8263, 0x57060404, 0x063a5288, 0x59594f04, 0x2b2c2340, 0x0c0d1819, 0x32340001, 
-    0x3a2c3a2b, 0x2a182022, 0x43182a19, 0x4441275e, 0x0c005722, 0x41f5fe21, 0x0e571949, 0x74f9210d, 0x44245141, 0x1322cf6b, 0x97421323, 0x7e012521, 
-    0x079ac5b8, 0x44194941, 0x02342a6b, 0xe3ff0600, 0x1506a704, 0x2d001d00, 0x08b59000, 0x01030001, 0x2d063c52, 0x00030023, 0x00030600, 0x04010764, 
-    0x107c3b04, 0x02002d05, 0x004b4102, 0x5b010606, 0x42010100, 0x20083055, 0x262a8720, 0x01000600, 0x8e5f0106, 0x4c052c31, 0x001e401b, 0x03050002, 
-    0x93630502, 0x4c04212a, 0x23052b55, 0x23252b2d, 0x27088982, 0x2524231d, 0x18080825, 0x011e012b, 0x23061415, 0x11162722, 0x22230210, 0x12101102, 
-    0x1e173233, 0x36323301, 0x01273435, 0x3a0cb846, 0x93043233, 0x5955090b, 0xf83d2524, 0xf7f7fbfd, 0x2d78dcfc, 0x2e2a1b3f, 0x46c9fe1e, 0x993408c0, 
-    0x2a15069a, 0x76702540, 0xedfeb00c, 0x80fe7afe, 0x88017d01, 0x80290182, 0x38181d90, 0xfa3e3e36, 0x0fcc46ff, 0xb3430020, 0x82432009, 0x000731b9, 
-    0x00230013, 0x18b04bbe, 0x23405850, 0x01010103, 0x2105dc5e, 0xb3434b3f, 0x01092609, 0x5b040606, 0x0ccc6508, 0x0102212a, 0x01010300, 0x61010005, 
-    0x3a202899, 0x1e205382, 0x47822889, 0xda434482, 0x8925200f, 0x07d84320, 0x04232882, 0x88570604, 0x65062077, 0x173c05a9, 0x08091415, 0x23141b1d, 
-    0x0d0f2315, 0x13091308, 0x10111111, 0x2b18080a, 0x23033301, 0x03200383, 0x23065041, 0x02101112, 0x25100648, 0x9ae5ba1d, 0x04820402, 0xf7fb3028, 
-    0xf7fdfcf7, 0x0848fcf8, 0x4307290a, 0x0801f8fe, 0xa8f9f8fe, 0x27074041, 0x79fe80fe, 0x80fe7afe, 0x48110e48, 0x0820080f, 0x0f240982, 0x8a001f00, 
-    0x230a8158, 0x61010003, 0x4808af47, 0x8158100a, 0x47268308, 0x232415df, 0x01000000, 0x03264584, 0x03040500, 0xdd476305, 0x15403114, 0x04051011, 
-    0x1f101719, 0x090b1f11, 0x0f050f04, 0x2306dc47, 0x01211521, 0x271a0541, 0x56023d01, 0x2a01aafd, 0x23130241, 0x6ff99408, 0x0020fda2, 0x2a08f582, 
-    0x04baff08, 0x001706b0, 0x003d0026, 0x40840051, 0x0212141a, 0x4c4d0002, 0x03040115, 0x01012502, 0x134a0303, 0x26480001, 0x41470101, 0x1621051b, 
-    0x201f8200, 0x22da825b, 0x82044b41, 0x0e6d431d, 0x13821320, 0x0121f482, 0x2425885f, 0x401b4c02, 0x242e821a, 0x02000302, 0x821d8263, 0x87572052, 
-    0x01033d38, 0x4059594f, 0x3e3e3f0e, 0x2e513f51, 0x2c1f212c, 0x2b150805, 0x012e3733, 0x35012e27, 0x089b4018, 0x37171636, 0x011e0717, 0x15011e17, 
-    0x010e0710, 0x27262223, 0x01072726, 0x23282584, 0x0e070622, 0x011c1503, 0x17291f84, 0x37363201, 0x3435033e, 0x22408226, 0x82160127, 0x08320832, 
-    0x0a1711b2, 0x3f3d0a09, 0x3c7cba40, 0x3a552c63, 0x15a8648b, 0x0b0a0b1f, 0x86bb3c7b, 0x5a306639, 0xdb028f3d, 0x1d1a2b0d, 0x69542a4a, 0x10191120, 
-    0x00830108, 0x01059408, 0x206b5217, 0x09111910, 0x07020203, 0x1efefd06, 0xfc4a2242, 0x3f456027, 0x01cb5489, 0x5d636120, 0x51281415, 0x29ee4ac9, 
-    0x953a3d6c, 0xc07bfe56, 0x1613625e, 0x04cb5128, 0x143e2aec, 0x484c1416, 0xa07f6226, 0x1e221663, 0x240e101c, 0x4ab0fe23, 0x73572144, 0x59345b91, 
-    0x1a362122, 0x2d4e23fd, 0x00001617, 0xff080004, 0x07b004ba, 0x00030040, 0x0028001b, 0x40ce0036, 0x0201101a, 0x020f1101, 0x33340204, 0x05040512, 
-    0x03011a04, 0x1b4a0405, 0x4a470301, 0x232005ad, 0x2b0c1b51, 0x02040400, 0x0202005b, 0x01064b41, 0x20065d4a, 0x0a555a42, 0x08014a18, 0x1e5d2798, 
-    0x82278805, 0x03002445, 0x885f0305, 0x4c04232f, 0x6d75401b, 0x0002260b, 0x04020504, 0x23278264, 0x57050303, 0xdc487487, 0x0e402f05, 0x3629292a, 
-    0x2925362a, 0x07101129, 0xcf431908, 0x2e373505, 0x12103503, 0x37173233, 0x12160717, 0x23021015, 0x01072722, 0x27051c6b, 0x14150206, 0x32011716, 
-    0x2206b541, 0x60011e01, 0x680805ed, 0x1a10b21a, 0xfbf60912, 0x648b73e8, 0xf82a2aa8, 0x8f79eeff, 0x7018db02, 0x2067555b, 0x05051e25, 0x44971901, 
-    0x09111910, 0xfefd0a0a, 0x40078120, 0xc8f9f8fe, 0x806824fc, 0x87014e92, 0xc9a28101, 0xfe51ee4a, 0x7afea5ff, 0xcba281fe, 0x584eec04, 0xfe52464c, 
-    0x654cbafc, 0x8eb0fe22, 0x94735721, 0x2d88645f, 0x575123fd, 0x08034400, 0x2a003c28, 0x4d003d00, 0x9d5a5101, 0x050a2408, 0x5a070302, 0x00350d9d, 
-    0x5b070909, 0x41070700, 0x08010c4b, 0x0b5b0608, 0x42060601, 0x139d5a06, 0x31983c88, 0x58501524, 0x174f2c40, 0x5a65a805, 0x65a10f9d, 0x870f9d5a, 
-    0x82bf8231, 0x060822bc, 0x20d2885f, 0x0e9d5a09, 0x07265b88, 0x07080900, 0x31826309, 0x08060623, 0x21f88857, 0xcf4a0608, 0x1e403305, 0x2b2c3e3f, 
-    0x45470000, 0x4d3f4d3e, 0x3d2b3335, 0x47183d2c, 0x624837a3, 0x25094f23, 0x8448cc20, 0x22184f19, 0x4982f921, 0x022e24e3, 0x00004800, 0xd505c104, 
-    0x25001800, 0x21459700, 0x6f212005, 0x062007e3, 0x2e07e57d, 0x07094b39, 0x00050502, 0x0001085b, 0x5d003a00, 0x288708cb, 0x1a821d83, 0x5f000522, 
-    0x02263289, 0x26401b4c, 0x10820100, 0x02010323, 0x23298b63, 0x57050000, 0x05304f89, 0x59594f00, 0x19191b40, 0x25190001, 0x1a1c2419, 0x29083973, 
-    0x0118000d, 0x14080a18, 0xea6c212b, 0x023e2506, 0x33013e37, 0x2309c074, 0x22231125, 0x08089d6e, 0x9e640253, 0x3c403bc7, 0x1e2d2010, 0x029bca3c, 
-    0x019afe52, 0x01b8fe48, 0x3dcafd71, 0x242245b1, 0xb1452323, 0x01575057, 0xb26fd11c, 0x52296c8e, 0x46feaa54, 0xaae3fdaa, 0x738104aa, 0xb4b8de39, 
-    0x00733ade, 0x00020000, 0x040000ac, 0x00d5055c, 0x001a000e, 0x050f4176, 0x0105192e, 0x02010003, 0x00630103, 0x5b000404, 0x59053258, 0x19250bf6, 
-    0x02010200, 0x24259173, 0x401b4c04, 0x821b841f, 0x03042433, 0x82630400, 0x01012323, 0x06825703, 0x5b010324, 0x3f460100, 0x0f103606, 0x1a0f1719, 
-    0x28111a10, 0x17080620, 0x3221132b, 0x15011e17, 0x26da8214, 0x2311012b, 0x18363201, 0x0808ce47, 0xb401ac2d, 0x3e4382f9, 0x7fbe3f80, 0xb401caea, 
-    0x4e246c4b, 0xea8e4d4e, 0x3b71d505, 0x71dc6aa9, 0xa8fd3938, 0x2228fe02, 0x4a858649, 0x5ecffd49, 0x8d2007b7, 0x0f24cf82, 0x7f001c00, 0x1c31cf85, 
-    0x05000100, 0x63050104, 0x00040106, 0x02040302, 0x18d28563, 0x920b534f, 0x03032323, 0x28835900, 0xd5820320, 0x82002121, 0x550021bc, 0x03234893, 
-    0x68030059, 0x0f2d0571, 0x191b1011, 0x1c111c10, 0x10212711, 0x05275c07, 0x1720332a, 0x06141516, 0x23210607, 0xd883d983, 0xf77e2620, 0xcac92c05, 
-    0x7d0301fe, 0x7d3d3f7c, 0x82fefdfe, 0x509d27db, 0x2428264e, 0xdc825376, 0x69f2fe36, 0x9f70db69, 0x91fe6933, 0x42421402, 0x21653f83, 0xf3fd231e, 
-    0x02308c82, 0xf2fe7500, 0xf0056504, 0x2d001d00, 0x1bb57f00, 0x280a634b, 0x0002001b, 0x04007302, 0x08ff5104, 0x00030323, 0x2034825b, 0x08c04242, 
-    0x22841920, 0x03010528, 0x03020000, 0x2b886300, 0x8306b841, 0x0001263e, 0x04010304, 0x41238463, 0x438305b8, 0x4f00033c, 0x0e405959, 0x25271e1f, 
-    0x2d1f2d1e, 0x0670291a, 0x052b1708, 0x0607012a, 0xad422322, 0x0d0a5205, 0x23010723, 0x0f0d5201, 0x09048f2b, 0x02090707, 0x4040bb7d, 0x0715523c, 
-    0x68214428, 0xec1d0147, 0x114aeffe, 0x011b280a, 0x64645c01, 0x52c02201, 0xdb280a1e, 0x248058b4, 0x9501defe, 0x82102252, 0x008f30d2, 0x05d10400, 
-    0x001d00d5, 0xb584002b, 0x1802010b, 0x2c085c4e, 0x0401061a, 0x04010200, 0x05006302, 0x21c88305, 0x4e183900, 0x3a2a0a56, 0x1a405850, 0x02010103, 
-    0x27917301, 0x1b4c0522, 0x07734e18, 0x00000027, 0x05000405, 0x23248263, 0x57040202, 0x043d0682, 0x02005b02, 0x594f0204, 0x1f124059, 0x1e282a1e, 
-    0x1d2b1f2b, 0x13191b1c, 0x08072012, 0x08d14215, 0x06070622, 0x25050749, 0x03231317, 0xf841012e, 0x01232105, 0x0ceb4118, 0x018f5008, 0x4283f6a0, 
-    0x50282841, 0x19442893, 0xcb2c411c, 0x4527b2d9, 0x2f531f1e, 0xa801cbc1, 0x24234791, 0x6d242625, 0xd505d54b, 0x65a0386f, 0x5e2f774f, 0x1a270a15, 
-    0xfe58691d, 0x53790168, 0x16181766, 0x1d0389fd, 0x41642041, 0x20236441, 0x82eefd24, 0x030029ad, 0x00008f00, 0x4007d104, 0x1d290982, 0xd1002500, 
-    0x04010db5, 0x07ac5906, 0x90482720, 0x01082807, 0x03040006, 0x82630406, 0x4b3f2433, 0x83070700, 0x6f5218d6, 0x5035220c, 0x0b4c4858, 0x2b923089, 
-    0x250ee67d, 0x04030105, 0x31917303, 0x1b4c0723, 0x0ae67d40, 0x00272685, 0x06070002, 0x82640702, 0x0404232e, 0x06825706, 0x5b040625, 0x4c060400, 
-    0x112f057e, 0x22241e1f, 0x251f251e, 0x211d2511, 0x59091011, 0x323708e8, 0x1415021e, 0x031e0706, 0x03231317, 0x012b032e, 0x20012311, 0x82263411, 
-    0x02470808, 0x9ae5ba77, 0xa001ddfe, 0x4381bd7b, 0x412891a2, 0xcb29403c, 0x4327b2d9, 0xc1304c45, 0x01a801cb, 0xd590971f, 0xf8fe4007, 0x9e6d3963, 
-    0x16b6a064, 0x6a41220b, 0x0168fe51, 0x36645279, 0x0389fd12, 0x8803011d, 0x41eefd87, 0x3c33084b, 0x20000600, 0x3a012800, 0x01020a40, 0x01100002, 
-    0x57020705, 0x2820062d, 0x0338be82, 0x70030200, 0x00070109, 0x05070405, 0x00010163, 0x004b3f00, 0x5b030808, 0x12405618, 0x880b947d, 0x232c9332, 
-    0x40585015, 0x35205cab, 0x9c0ef17d, 0x0f1e7e5c, 0x04010625, 0x91730405, 0x7e082032, 0x27850e1e, 0x00030027, 0x08030708, 0x232f8264, 0x57070505, 
-    0x07260682, 0x05005b05, 0x64480507, 0x22123006, 0x21252721, 0x11282228, 0x11211d25, 0x5a0a1012, 0xb7410b7a, 0x0101291a, 0x8ca6a58c, 0xbbfebdd3, 
-    0x251eba41, 0xfeb2b23c, 0xbc415df6, 0x0000351e, 0x8f000300, 0xd104e0fd, 0x1900d505, 0x25002100, 0x09b5a000, 0x210a2144, 0x21440821, 0x06717108, 
-    0x29162844, 0x01010324, 0x01020602, 0x31987006, 0x1b4c0522, 0x84053575, 0x247a8226, 0x05000405, 0x202e8a63, 0xc0401807, 0x1340370e, 0x24251a1b, 
-    0x1e202223, 0x211b211a, 0x201d2511, 0x2b180809, 0x1e412113, 0x0333231b, 0x19418f23, 0x0e01261d, 0x0592bbef, 0x1d1941d5, 0x5b1cfc21, 0x8b3a052b, 
-    0x4a04e3ff, 0x4600f005, 0x0f407900, 0x02030129, 0x0102072a, 0x00010603, 0xf8630301, 0x03032208, 0x05b14c02, 0xc0630020, 0x46002006, 0x13230952, 
-    0x82040100, 0x5f00222c, 0x2c258700, 0x401b4c03, 0x00020019, 0x03020103, 0x16f86363, 0x252e3037, 0x000b0d23, 0x05460146, 0x052b1408, 0x2e272622, 
-    0x1e352701, 0x07757701, 0x2105104e, 0x1582012f, 0x53182620, 0x16220991, 0x10831517, 0xa3772320, 0x011e2308, 0x3483011f, 0x14158308, 0x010e0706, 
-    0x6c354802, 0x336e3434, 0x66346c3a, 0x2b794b67, 0x1d1d292c, 0x6c4b6120, 0x5e329765, 0xb3404146, 0x305a2b72, 0x5b306b5d, 0x445d5d2d, 0x282a2a76, 
-    0x611f1a1d, 0x966a6a4b, 0x3d466131, 0x0b1dc142, 0x15240b0b, 0x113525d7, 0x23222222, 0x50384062, 0x112a211d, 0x33441719, 0xa266a15e, 0x093e393a, 
-    0xcd28130a, 0x1e0f2b1f, 0x5e222220, 0x19453339, 0x18112a1d, 0x68354d18, 0x34a172b4, 0xf1823838, 0xe3ff8b3c, 0x40074a04, 0x35000300, 0x0f40c500, 
-    0x04050120, 0x03020821, 0x02010705, 0x285f0303, 0x6e232006, 0xb5750cd8, 0x0303210a, 0x200fb958, 0x067c6120, 0x18010421, 0x8d0b3d4d, 0x0b0c4e27, 
-    0x03212783, 0x206b8206, 0xe74c1802, 0x8a23200d, 0x00042847, 0x05040305, 0x18030064, 0x84087d4b, 0x594f3130, 0x11405959, 0x22240405, 0x0a0c1d1f, 
-    0x35053504, 0x0da44e18, 0x27533520, 0x2e7c0806, 0x2e012f02, 0x3e343503, 0x17323302, 0x22232615, 0x1415020e, 0x011f021e, 0x1415031e, 0xbabd0204, 
-    0x6e529ae5, 0xcc736cd2, 0x1ba9996a, 0x6c49653d, 0x2d609669, 0x6fb68146, 0xbbb9d2ab, 0x2b507247, 0x49633c1a, 0x62986a6a, 0x07f8fe2e, 0xf9f8fe40, 
-    0xd72d2dab, 0x87874449, 0x2d3d4f32, 0x47181911, 0x654e7d61, 0x4e3f73a4, 0x402277cd, 0x462d3d60, 0x18102a38, 0x8d6c4d18, 0x00e1d757, 0x02210082, 
-    0x05634100, 0x06003c24, 0x4e184f00, 0x322c07a7, 0x33050601, 0x0604020e, 0x0403010d, 0x28071874, 0x00020024, 0x05020005, 0x06894570, 0x21091e79, 
-    0x4e180404, 0x052218a7, 0xd5787202, 0x004b2108, 0x1523288d, 0xa7405850, 0x82352054, 0x4048182b, 0x20549b08, 0xa74e183a, 0x2128830b, 0xc3820704, 
-    0x5b790320, 0xa74e180d, 0x2c208308, 0x04060005, 0x00630605, 0x04030304, 0x21a28757, 0x4e180304, 0x392909a7, 0x152c2e37, 0x084f0713, 0xa74e184f, 
-    0x06644311, 0x27791e20, 0x0a654306, 0x0bf85618, 0x211e6643, 0xa0454701, 0x392e3e05, 0x6d35306c, 0x346c3a33, 0x4b326636, 0x2d282b78, 0x671f1b1f, 
-    0x97656c46, 0x47302e32, 0x076f4340, 0x2a5c3237, 0x734b5d5d, 0x172a2826, 0x4c621d20, 0x359b616a, 0x423d4661, 0x073c77c3, 0x36087643, 0x22221012, 
-    0x39455f20, 0x2b201c52, 0x44171910, 0x547c2f33, 0x4339a267, 0x203a0678, 0x231e0e2b, 0x3c5d201f, 0x1c1e4a29, 0x1618112b, 0xb468394b, 0x3934a172, 
-    0x00820037, 0x00012408, 0x0475fe8b, 0x00f0054a, 0x40be0069, 0x05015418, 0x02305504, 0x082f0503, 0x19030202, 0x18020101, 0x18010001, 0x2007f74e, 
-    0x0e75431f, 0x02020029, 0x01004b42, 0x825b0001, 0x003e2149, 0x2307e16b, 0x0001001c, 0x4b430282, 0x1a4f1809, 0x02422108, 0x2107114e, 0xe068001a, 
-    0x8f632005, 0x4c05252b, 0x0020401b, 0x20056d43, 0x69248c63, 0x59830505, 0x59594f37, 0x5b0f4059, 0x374e5059, 0x20282a35, 0x0613151d, 0x012b1408, 
-    0x05cd4416, 0x8505384a, 0xe44e180b, 0x012e2311, 0x35452327, 0x35d04109, 0x61e9032a, 0x7e2f3d46, 0x0a22164d, 0x14054f18, 0x0e180823, 0x37e34112, 
-    0x68b6022c, 0x34a172b4, 0x1a0c3328, 0x4f181431, 0x11221521, 0xfb411625, 0x060b4438, 0x04e2fd37, 0x00f0054a, 0x00350031, 0x1c0f4094, 0x1d020301, 
-    0x03010204, 0x0abd4603, 0x04001d27, 0x05040500, 0x089e465d, 0x2105e941, 0x55180106, 0x1b220ba0, 0x10820100, 0x00010423, 0x4d2d8f63, 0xcc4605fc, 
-    0x18258808, 0x2d108449, 0x35000113, 0x20323334, 0x08191b1e, 0x657e0006, 0x253a450a, 0x03330525, 0x454a0223, 0xfe25273a, 0x92bbefb4, 0x293a451d, 
-    0xeb47a820, 0x002f2a05, 0x05a20400, 0x000700d5, 0x05194f55, 0x0102112c, 0x59010000, 0x39010100, 0x0e4f004b, 0x0011250b, 0x73030003, 0x00241d89, 
-    0x16401b4c, 0x00201384, 0x55203183, 0x00333182, 0x00010259, 0x594d0001, 0x1111b659, 0x08041011, 0x75012b18, 0x233005ec, 0x2bfe0402, 0x2dfe7304, 
-    0xaa2b05cb, 0x00d5faaa, 0x00206382, 0x0f227b87, 0x7b857900, 0x01051b2e, 0x00010601, 0x61000107, 0x02020104, 0x09534918, 0x09ab5a18, 0xa9821b20, 
-    0x93730721, 0x82022027, 0x8421208f, 0x0300211d, 0x01233d82, 0x82610203, 0x20678226, 0x22068255, 0x82590001, 0x709a8458, 0x176f0f2e, 0x11212506, 
-    0x11211521, 0xf722a783, 0xab850901, 0xf72f0782, 0xaa4102cb, 0xaaaa4002, 0xfdaac0fd, 0x850200bf, 0x3c0727b3, 0x0e000600, 0x4a18f600, 0x1f200c1b, 
-    0x55181d82, 0xf8700a05, 0x0600230a, 0x5f543a06, 0x7c1c2008, 0x23930ab8, 0x58501523, 0x204aa240, 0x9f268235, 0x8e3a204a, 0x06002423, 0x76730603, 
-    0x55180ddd, 0x1e830c39, 0x0304002a, 0x00550403, 0x5a030404, 0x04222982, 0x2c664e03, 0x83112006, 0x0c2c6600, 0xd9410320, 0x3d012106, 0x2005fb45, 
-    0x0534410c, 0xc445cb20, 0xf9fe2105, 0x3906e641, 0x2f000100, 0xa20475fe, 0x1a00d505, 0x0f40a900, 0x0201010a, 0x01000109, 0x03824a02, 0x072d5f18, 
-    0x95891b20, 0x45068165, 0x1820107a, 0x02824882, 0x298e5f20, 0x28087645, 0x0302001b, 0x01020301, 0x43279070, 0x1d8606af, 0x40820420, 0x03040222, 
-    0x450b7e6e, 0x09200878, 0x1528e482, 0x08062624, 0x23212b1a, 0x43071b5c, 0x262307ac, 0x84112327, 0xcf0230f2, 0x78343913, 0x1f585678, 0x3e42254f, 
-    0x85423127, 0x663f31f8, 0x185a5537, 0x2f0f1183, 0x44531f2b, 0xaaaa2b05, 0x93245783, 0x3d04e3ff, 0x3222fb82, 0xe3425e00, 0x03122505, 0x39010101, 
-    0x8863e583, 0x000f220f, 0x05876302, 0x01242184, 0x17401b4c, 0x02290982, 0x02007201, 0x57020000, 0x06ba6300, 0x4f000232, 0x0f405959, 0x23240001, 
-    0x0f10181a, 0x32013200, 0x2b0a304b, 0x2e27012e, 0x33113503, 0x16171411, 0x33280183, 0x37363732, 0x3637013e, 0x0e241384, 0x010e0702, 0x5e080285, 
-    0x5d366802, 0x2053272a, 0x0811301f, 0xcb04070b, 0x200f0606, 0x57563c3d, 0x081f3e3c, 0xca06030a, 0x060b0704, 0x2122320e, 0x5e252751, 0x0e0e0f1d, 
-    0x4c1c1d2d, 0x4e3e1939, 0x98033e61, 0x2e6d0cfc, 0x1e3b192f, 0x3a1f1e1e, 0x2e18200f, 0xfcf6036c, 0x4d654268, 0x5032163a, 0x0e2c1e1f, 0x8200100d, 
-    0x840020b1, 0x400727fb, 0x36000300, 0xf758a600, 0x001f2205, 0x180e8201, 0x20070e5a, 0x054f6705, 0x2011a063, 0x069e4a1c, 0xbe790320, 0x4b392205, 
-    0x24238d00, 0x4058503a, 0x21238919, 0x9a630400, 0x414f8405, 0x678205ee, 0x01007222, 0x04283f85, 0x04007203, 0x57040202, 0x04204587, 0x2c059263, 
-    0x28040511, 0x141c1e27, 0x05360413, 0x0ddc4a36, 0x27012e22, 0x24294941, 0x9ae5baa0, 0x294d418d, 0xfe400725, 0x41abf9f8, 0x00213352, 0x06534102, 
-    0x06003c26, 0x01013900, 0x240cb963, 0x01010220, 0x09376300, 0x04010626, 0x004b3904, 0x200db463, 0xc25a180a, 0x202c8208, 0x051e7a04, 0x15202490, 
-    0xa0054767, 0xa335204c, 0x6f3a204c, 0x71850893, 0x79630020, 0x239e8406, 0x401b4c04, 0x8508567a, 0x0405288e, 0x03050072, 0x87570503, 0x05945ab9, 
-    0x40595933, 0x2b070812, 0x171f212a, 0x08390716, 0x10111239, 0x0b6c6308, 0x41272621, 0x0a202cb1, 0x2105307a, 0xb5413101, 0x0689632a, 0x2034b741, 
-    0x06b74103, 0x0b003a28, 0x4a001700, 0x0b449500, 0x031e2305, 0x47630101, 0x01072608, 0x4b390505, 0x11906300, 0x258b1b20, 0x63060021, 0x2d84058f, 
-    0x1b4c0524, 0x09822640, 0x00060025, 0x8d700605, 0x04042326, 0x4c875706, 0x4f040626, 0x1f405959, 0x29058863, 0x30323b3c, 0x4a182728, 0x86634a19, 
-    0x180b200b, 0x180e0340, 0x200be566, 0x05554a01, 0x63281043, 0x63410e93, 0x0fa36329, 0x43346b41, 0x03240923, 0xf3003600, 0x4405095c, 0x0a232277, 
-    0x44405850, 0x15201f77, 0x4aa22382, 0x4aa23520, 0xc2443a20, 0x05a14f43, 0x2211c444, 0x41132313, 0x79242fb3, 0x0c9ac5b8, 0x2529aa41, 0xf8fe3c07, 
-    0xa041aff9, 0x00013633, 0x04e3ff09, 0x001906c8, 0x4084003f, 0x0501370a, 0x00010902, 0x07537605, 0x05001e33, 0x05030000, 0x06006400, 0x044b3b06, 
-    0x39020201, 0x07986a4b, 0x20091164, 0x2025881b, 0x05aa6003, 0x022d2c88, 0x1e401b4c, 0x06020104, 0x05020605, 0x2f269270, 0x59594c06, 0x22140a40, 
-    0x2e192a18, 0x1b080725, 0x2a080564, 0x14112726, 0x0e07020e, 0x4d060703, 0x2e290647, 0x33113501, 0x1e171411, 0x05146403, 0x21074847, 0x21641615, 
-    0x33520805, 0x090bb404, 0x321a5955, 0x0b08031b, 0x42341007, 0x6657274c, 0x243caf6d, 0x0f0e0e30, 0x0e0306cb, 0x1d1e281b, 0x80552a4b, 0x030b061c, 
-    0x1d25ca06, 0x851e2e2a, 0x402a1906, 0x0b767025, 0x3f80fd0e, 0x193d4e62, 0x2a3c5035, 0x363e1d0d, 0x2f305221, 0x5c477b99, 0x2e152305, 0x4282262b, 
-    0x0c393e30, 0x6c2e1724, 0x0f97f603, 0x3e3e3638, 0x47440000, 0x823c2007, 0x00072409, 0x42f60034, 0x1e2005dd, 0x440b2964, 0x08200a47, 0x24082464, 
-    0x4058500a, 0x09da631c, 0x15202394, 0x49a12382, 0x49a23520, 0x23823a20, 0x6d891920, 0x82060021, 0x04062288, 0x08b3445f, 0x09822420, 0x01060125, 
-    0x8b700605, 0x08b14424, 0xbd502d84, 0x09133106, 0x1f272808, 0x0812131d, 0x11340934, 0x09101111, 0x450c6164, 0xa64106f7, 0x08ce4115, 0x6d640220, 
-    0x412d2008, 0xc241199d, 0x3c072209, 0x057e64fe, 0x9541af20, 0x68fc211d, 0x470ac041, 0x0826089b, 0x30000300, 0xe1457b00, 0x001a2505, 0x03010000, 
-    0x4806077d, 0x172014c6, 0xc4482187, 0x05222910, 0x04010301, 0x70040301, 0xc5482289, 0x11402d10, 0x23240405, 0x0e0f191b, 0x30053004, 0x2206c448, 
-    0x45211521, 0x1a4108b3, 0x6401201e, 0x17410582, 0x94082325, 0x12416ff9, 0x01003a2b, 0x65fe9300, 0xd5053d04, 0xaf004100, 0x01220e40, 0x01160400, 
-    0x01170001, 0x084a5602, 0x05061c28, 0x39030302, 0x575e004b, 0x4b422706, 0x02010100, 0x6018005b, 0x4048076d, 0x00042605, 0x00040100, 0x8c2b8763, 
-    0x50432421, 0x831a4058, 0x03042319, 0x28860072, 0x4021438b, 0x231c901f, 0x57010202, 0x01202286, 0x32050b4a, 0x00000010, 0x39410041, 0x242c2d37, 
-    0x08071d25, 0x42012b17, 0x0e21073e, 0x05605f01, 0x0daf4f18, 0x44066f48, 0x04211521, 0x084d423d, 0x26462034, 0x3638242c, 0x402a3e3e, 0x0a767025, 
-    0x561d2617, 0x2044328a, 0xd5052115, 0x250b5142, 0x3d020e0b, 0x4f182050, 0x182707ea, 0x2139332f, 0x442d3b08, 0x1f441b25, 0x006d2f09, 0x00270013, 
-    0x4b020154, 0x58501cb0, 0x40452440, 0x4b3f2d07, 0x00000108, 0x05075902, 0x02020309, 0x20106d48, 0x202b8235, 0x242b8928, 0x05050107, 0x21318539, 
-    0x8845095b, 0x0d9d4805, 0x2f823920, 0x91482520, 0x20379a07, 0x071b5300, 0x46822320, 0x06238182, 0x96630002, 0x07d24836, 0x03020325, 0x9a700205, 
-    0x4c03222e, 0x3d008259, 0x28291f40, 0x00011415, 0x3d3f4748, 0x54283233, 0x1d1f5429, 0x27152714, 0x1300090b, 0xd4481301, 0x022e2105, 0x28059c56, 
-    0x1415021e, 0x3227020e, 0x210f823e, 0xa756022e, 0x08284707, 0x291e2843, 0x643a7302, 0x4a2b2b4a, 0x07823a64, 0x4a2a2a2c, 0x37203b64, 0x29181829, 
-    0x07822037, 0x29171724, 0x5a441837, 0x48052623, 0x39654a2b, 0x25498539, 0x4a653939, 0x42837b2b, 0x28381f23, 0x26428218, 0x29382020, 0x4320fa17, 
-    0x77442c62, 0x003c2608, 0x014b001e, 0x05114633, 0x01002722, 0x2106fa63, 0x977f0063, 0x4b39220d, 0x11f46400, 0x01022529, 0x03040000, 0x89630400, 
-    0x01092337, 0x2c900707, 0x58501523, 0x205baa40, 0xa82e8235, 0x823a205b, 0x9222202c, 0x08002788, 0x0806010b, 0x90845f06, 0x1b4c0724, 0x09822d40, 
-    0x03080325, 0x94700807, 0x0606232d, 0xe3875708, 0x3808df64, 0x001f201a, 0x363e3f00, 0x1f292a34, 0x004b204b, 0x251d001e, 0x22242224, 0x05cc730c, 
-    0x16323331, 0x3316011f, 0x013d3632, 0x23030e33, 0x662f2622, 0x1d2105db, 0x271f4201, 0x651f013b, 0x263d285e, 0x1f1d2b39, 0x1a027d28, 0x202e4730, 
-    0x19392e3f, 0x28220e1e, 0x231942ce, 0x66610638, 0x1e141775, 0x062a3219, 0x20395131, 0x0e211813, 0x062d320b, 0x0d4282f9, 0x00012c2b, 0x04000039, 
-    0x00d50598, 0x52450006, 0x3524089d, 0x0c405850, 0x7d05b17a, 0x0c250caa, 0x02000200, 0x24188473, 0x401b4c00, 0x0799520a, 0x59690226, 0x1211b559, 
-    0x39069e7d, 0x01330109, 0x01d13923, 0xd15f015e, 0x05f54bfe, 0x05d5fad5, 0x002bfa2b, 0x00820001, 0x82d10421, 0x000c2e6b, 0x050ab77b, 0x01030302, 
-    0xb04b4a01, 0x216d821a, 0x1d820212, 0x004b3927, 0x4b3c0101, 0xa8721804, 0x21878308, 0x00500015, 0x89218506, 0x823a201c, 0x87142036, 0x2016831c, 
-    0x83218471, 0x82102098, 0x55691809, 0x82198307, 0xb759249e, 0x7b121112, 0x11230536, 0x83011b33, 0x03200802, 0x23010b23, 0xd3aa8fc5, 0xdfc58fac, 
-    0xbfcacbbf, 0x44fbd505, 0xdcfc2203, 0x2bfabe04, 0x89fc7703, 0x0221ae82, 0x2eb38400, 0x03004007, 0xce001000, 0x06090eb7, 0x61030503, 0x1f200703, 
-    0x4a0c9469, 0x3c22087a, 0x7718064b, 0xdc830829, 0x69001c21, 0x23940868, 0x0eb67318, 0x02030027, 0x05030205, 0x892b8570, 0x0b5f744a, 0x72010222, 
-    0x20832687, 0x2b847120, 0x1b4c0222, 0x820bce7e, 0x02032113, 0x05222682, 0x23837203, 0x82596921, 0x0a402700, 0x12121112, 0xc4791111, 0x23032206, 
-    0x0b0c4105, 0xbaa00226, 0x25fe9ae5, 0x240b1341, 0xf8fe4007, 0x10164163, 0x17410020, 0x003c3207, 0x01130006, 0x040c4028, 0x11000101, 0x0603090c, 
-    0x07cf6004, 0x82022021, 0x09607512, 0x2308ba51, 0x01074b3c, 0x200bdf54, 0xb05c181d, 0x5024940a, 0x4c9e085e, 0x5e501a20, 0x0b08520b, 0x3520718b, 
-    0x20202482, 0x0027718a, 0x03060304, 0x85700604, 0x74998979, 0x4c820c01, 0x21832787, 0x36527120, 0x8d1b2008, 0x030427bb, 0x06040072, 0x24837204, 
-    0x84596921, 0x0b402400, 0x82121112, 0x10112502, 0x2b1c0808, 0x4106eb73, 0x5b500d74, 0xc9fe2106, 0x250c7741, 0xb2f6fe3c, 0x79415db2, 0x4203200f, 
-    0x3c37068f, 0x1f000f00, 0x4f012c00, 0x141c0f40, 0x0104040c, 0x22252a00, 0x41050703, 0x0a25087c, 0x01030903, 0x5f451801, 0x08db5107, 0x084b3c23, 
-    0x80611801, 0x6f0a2007, 0x2a8406de, 0x01000423, 0x20259463, 0x20258215, 0x204da220, 0x204da41a, 0x2b258235, 0x04050021, 0x07050407, 0x00010270, 
-    0x9c897b8e, 0x28823a20, 0x28872020, 0x71201683, 0x04242d90, 0x2a401b4c, 0x012cb382, 0x05040105, 0x07050070, 0x6e070501, 0xfb822a87, 0x31825720, 
-    0x5b010022, 0x00216284, 0x051e4c01, 0x40593008, 0x0010101c, 0x292b2c00, 0x24262728, 0x10202123, 0x181e101f, 0x000f0016, 0x080b260e, 0x22012b15, 
-    0x34013d26, 0x32013b36, 0x14011d16, 0x8e332306, 0x0cb9410f, 0x0d5e0126, 0x8d0d1212, 0xfb200483, 0x8c200483, 0xfc210483, 0x0bc6418e, 0x12720623, 
-    0x8c16840d, 0x419d2004, 0x4f430fd6, 0x0003240a, 0x441b0110, 0x07200a67, 0x28064150, 0x02010002, 0x00000070, 0x09e24e3f, 0x200b6744, 0x0a41500a, 
-    0x72010222, 0x50146744, 0x4a9e078c, 0x218eb244, 0xb4445959, 0x4413200e, 0x01260db4, 0x9ac5b879, 0x3c43a4fd, 0x5ff8210e, 0x31106341, 0x00120001, 
-    0x05be0400, 0x000b00d5, 0x0609b753, 0x41180303, 0x12294600, 0x08041112, 0x01092b18, 0x08028433, 0x01092328, 0xfe060223, 0x4801d950, 0xfed94e01, 
-    0xd9df0141, 0x75fe92fe, 0x021703da, 0x02cdfdbe, 0xfc42fd33, 0xfd8302e9, 0x0082007d, 0x25000122, 0xac209382, 0x08269382, 0x06b74700, 0x938a0003, 
-    0x82308147, 0x08032287, 0x3e878617, 0x02231101, 0xd723fe02, 0x6b016c01, 0xcb21fed9, 0x37039e02, 0x93026dfd, 0x62fdc9fc, 0x85020000, 0x3c072e77, 
-    0x0c000300, 0x0ab7ca00, 0x04030407, 0x07b87d02, 0xd7461920, 0x4b03200c, 0x681805c9, 0x16200bd8, 0x8e09d146, 0x5015231d, 0x3e9c4058, 0x20823520, 
-    0x3a203e99, 0x00241d8d, 0x73040204, 0x02246184, 0x14401b4c, 0x0425758c, 0x04007202, 0x05664504, 0x8212b721, 0x051037fb, 0x012b1908, 0x13230333, 
-    0x01093301, 0x23110133, 0xe5baa002, 0x0441279a, 0x3c07250a, 0x6afcf8fe, 0x410a0841, 0x06240907, 0xd7000f00, 0x2305c746, 0x03070a0d, 0x09bc4118, 
-    0xc7461a20, 0x5804200d, 0x41180582, 0x17200bbb, 0x8e0a0546, 0x8215201e, 0x20409dcf, 0xd6421835, 0x22678208, 0x8e720103, 0xd6421840, 0x241e8509, 
-    0x05030500, 0x20238473, 0x2b471803, 0x25388808, 0x00720305, 0x12410505, 0x09402205, 0x18008212, 0x2307d042, 0x07272313, 0x460a1741, 0xcb200672, 
-    0x240d1a41, 0xfcb2b2f6, 0x0a1c416c, 0x00000023, 0x08274203, 0x17000b2d, 0xf2002000, 0x181b1eb7, 0x42040603, 0x1a240729, 0x03070208, 0x5b27fe82, 
-    0x01010103, 0x58054b3f, 0xde470543, 0x0318230b, 0x24840101, 0x00010423, 0x201f8e63, 0x9dfb8215, 0x82352041, 0x20419b21, 0x241f833a, 0x06040600, 
-    0x24669073, 0x401b4c04, 0x29708222, 0x04000600, 0x06007006, 0x22827106, 0x5720aa82, 0x01220682, 0x93845b00, 0x46000121, 0x402b0516, 0x010c0d19, 
-    0x1d1f2000, 0x56191a1c, 0x09200be4, 0x201ae456, 0x07654209, 0x200dbd56, 0x0a53418f, 0x18710621, 0x210bc67d, 0x5b412dfc, 0xda83430d, 0x03231322, 
-    0x24081d41, 0x9ac5b879, 0x0d68425a, 0x310d8343, 0x006e0001, 0x05630400, 0x000900d5, 0x050a4068, 0x01820001, 0x02020322, 0x21063a68, 0x5e600015, 
-    0x06e25f09, 0x09766e18, 0x02001227, 0x03020300, 0x2423885d, 0x401b4c00, 0x27408218, 0x00010200, 0x03020061, 0x0e816018, 0x11b62708, 0x04111112, 
-    0x372b1808, 0x21352101, 0x15210115, 0xf7026e21, 0xc9031ffd, 0x2203f4fc, 0x049a0bfc, 0xfb9aaa91, 0x4f82aa6f, 0x97845982, 0x003c0730, 0x010d0003, 
-    0x090a4007, 0x04030201, 0xe14a0501, 0x5c222008, 0x00200c9b, 0x21097f60, 0x57180404, 0x0a200a04, 0x24084b7e, 0x01030100, 0x20269772, 0xa5268215, 
-    0x0b2e4c50, 0x3a20509a, 0x210d5358, 0xc2620400, 0x20a58705, 0x084a5b02, 0x03269685, 0x03040200, 0x4c186202, 0x5926110e, 0x09405959, 0x01821211, 
-    0x081c4718, 0x3c410920, 0x8d022608, 0xfe9ae5ba, 0x0b4241a6, 0xfe3c0725, 0x4166faf8, 0x06311447, 0x12011000, 0x01020e40, 0x010c0002, 0x01070403, 
-    0xf6771806, 0x1276180a, 0x1803200d, 0x2407ab57, 0x06050500, 0x0c106159, 0x10612020, 0x9600200a, 0x82152027, 0x612320fc, 0x2a970d5f, 0x2a823520, 
-    0x3a2052a3, 0x1d202782, 0x0c8c7618, 0x05060024, 0x56885d06, 0x1b4c0324, 0x1f8b2340, 0x0300042c, 0x62030405, 0x06060500, 0xc6865505, 0x4d060522, 
-    0x2205164c, 0x8312110a, 0x06874d01, 0x33371724, 0x55412303, 0x09012209, 0x05be6c8c, 0x58419220, 0xb2b2250d, 0x68faf6fe, 0x20075a41, 0x05374302, 
-    0x003c072e, 0x0115000b, 0x110a4009, 0x0c030201, 0x200a9f42, 0xfe731820, 0x1a9d420b, 0x01001e22, 0x03232982, 0x42630001, 0x4da31b9c, 0x58503523, 
-    0x204da140, 0x6525823a, 0x7384052d, 0x20129842, 0x42918921, 0x61200597, 0x31159742, 0x15000113, 0x10121314, 0x070d0e0f, 0x010b0004, 0xb045070a, 
-    0x0953410e, 0x1e230228, 0x1e1e911e, 0x5241bafd, 0x6f06210b, 0x91231383, 0x422bfa1e, 0x883b0caf, 0x6104e3ff, 0x3c007b04, 0x5b014d00, 0x01160a40, 
-    0x01150302, 0x4a020201, 0x8208b04b, 0x242008bb, 0x06000100, 0x63060105, 0x03020200, 0x0303005b, 0x04004b44, 0x084b3a04, 0x00050501, 0x0001075b, 
-    0x2006da6c, 0x202b820a, 0x852b9120, 0x07042226, 0x20278702, 0x2053aa0f, 0x7153a611, 0xa7a50573, 0x7f843e20, 0x00050426, 0x70000405, 0xa582af87, 
-    0x0522c982, 0xe4885f00, 0x1b4c0225, 0x87002b40, 0x09b36826, 0x01050624, 0x2e826306, 0x05000423, 0x08024157, 0x59470520, 0x59260806, 0x3d3e1940, 
-    0x42440001, 0x4d3e4d3d, 0x1a1c2f31, 0x080a1012, 0x3c013c00, 0x2b140809, 0x2e272205, 0x37343501, 0x05823b36, 0x0b822620, 0x0722232f, 0x3e350706, 
-    0x33363701, 0x1e171632, 0x22028301, 0x85011d16, 0x20058208, 0x05445723, 0x07010e2a, 0x3227010e, 0x013d3637, 0x0808cc76, 0x02011e92, 0x3065ae01, 
-    0xf47c7e36, 0x212222f7, 0x605f486c, 0x662a5a61, 0x475c5b34, 0x532e3274, 0x071a151d, 0x05020210, 0x07050d05, 0x05b90212, 0x0905070f, 0x2c5b1d02, 
-    0x97176b30, 0xa0e95857, 0x20272b52, 0x1d531d1d, 0x587d2e61, 0x1d6162b9, 0x1e1f6440, 0x341b1b1e, 0x0b2010b8, 0x14151513, 0x401d283d, 0xe594491f, 
-    0x2a26583a, 0x371f134a, 0x1c2f0c05, 0x32102d16, 0x1719174e, 0xb76c6a9a, 0x551d3829, 0x1b4d3438, 0x03001e1a, 0xe3ff8800, 0x89066104, 0x402e0982, 
-    0xa3015100, 0x011a0a40, 0x01190504, 0x41420403, 0x002e2107, 0x22051152, 0x82720105, 0x07083a24, 0x00640803, 0x5b050404, 0x44050500, 0x0606004b, 
-    0x010a4b3a, 0x5b020707, 0x76601809, 0x9b2a200c, 0x24308535, 0x02020906, 0x055a6a02, 0x58500f23, 0x2067b140, 0xad358211, 0xb4352067, 0x8e3e2067, 
-    0x07062635, 0x02060702, 0x070d4170, 0xfb82cd82, 0x5f020722, 0x24081641, 0x401b4c04, 0x0a004135, 0x05263087, 0x05030400, 0x388a6304, 0x07020623, 
-    0x083e4157, 0x49020721, 0x230805e1, 0x421b4059, 0x48040541, 0x42514146, 0x20333551, 0x0e14161e, 0x0540040c, 0x0b101140, 0x012b1608, 0x13230133, 
-    0x254d8d42, 0xbbfec6f7, 0x9242239a, 0x89062541, 0xd2fa88fe, 0x324a9742, 0x000b002f, 0x02590048, 0x220a400c, 0x21070601, 0x42060501, 0x2d080797, 
-    0x0b020033, 0x02070001, 0x05006400, 0x05090a00, 0x0103630a, 0x4b3b0101, 0x07060600, 0x0707005b, 0x08004b44, 0x0d4b3a08, 0x04090901, 0x2c5e0c5b, 
-    0xa02f200c, 0x2e35853a, 0x04020c08, 0x4c044204, 0x0fb04b1b, 0xb6405850, 0x82112071, 0x2071b23a, 0x2071b925, 0x673a8335, 0x2441075e, 0x1e1e410e, 
-    0x3a8a3e20, 0x04090826, 0x70040809, 0x28102c41, 0x0c09010d, 0x04090401, 0x244b885f, 0x401b4c06, 0x9070863a, 0x00072635, 0x06070506, 0x07a54163, 
-    0x08233d82, 0x41570904, 0x09210897, 0x06f54204, 0x40592c08, 0x0d494a25, 0x5000010c, 0x4a59494e, 0x283b3d59, 0x161c1e26, 0x0d480c14, 0x07090a48, 
-    0x00020305, 0x0e0b010b, 0x012b1408, 0x6e330320, 0x33220501, 0x08430102, 0xfe6b2e4d, 0x0b7717de, 0x60565b5b, 0xfe17770e, 0x41114373, 0x0110052b, 
-    0x4a4e481f, 0xfae1fe4c, 0x4a1743d3, 0x00894908, 0x00430006, 0x40e80154, 0x0101040e, 0x05011d00, 0x04011c06, 0x4b4a0305, 0x585005b0, 0x00003040, 
-    0x66000601, 0x06010102, 0x04007201, 0x04080900, 0x05006309, 0x005b0605, 0x4b440606, 0x3a070700, 0x08010b4b, 0x0a5b0308, 0x0cf34a18, 0x37822f20, 
-    0xac720021, 0x820a2036, 0x9c2b206e, 0x22688536, 0x18020a07, 0x20072a81, 0xb232820f, 0xb1112069, 0xb5352069, 0x8f3e2069, 0x08072636, 0x03070803, 
-    0x07494170, 0x0a25d182, 0x03080301, 0x0852415f, 0x1b4c0524, 0x05413640, 0x2631870b, 0x04050006, 0x8a640506, 0x03072339, 0x7b415708, 0x72082008, 
-    0x593d06c8, 0x451c4059, 0x4b070844, 0x45544449, 0x23363854, 0x11171921, 0x0843070f, 0x10111243, 0x090c680c, 0x274ef745, 0x8bf69322, 0xd58bb4b5, 
-    0x2541e742, 0x88fe8906, 0xfb45f5f5, 0x48042044, 0x10310693, 0x17000b00, 0x65005400, 0x0a40c401, 0x0706012e, 0x0afd452d, 0x4e443220, 0x020c2207, 
-    0x08d4510b, 0x2610fc45, 0x0909010e, 0x450d5b04, 0x2e200cfc, 0x3485399f, 0x450d0821, 0x6fb50cfb, 0x58501123, 0x206fb140, 0xb5358235, 0x843e206f, 
-    0x07814539, 0x82061647, 0x010d25cf, 0x5f040904, 0x25162a41, 0x401b4c06, 0x34870030, 0x950ead45, 0x4c00223c, 0x23008459, 0x55562940, 0x31057869, 
-    0x65555a5c, 0x47496556, 0x282a3234, 0x54182022, 0x9b525419, 0x4c0f200b, 0x80690eea, 0x4b584b0d, 0x18600121, 0x210af276, 0xd8428bfe, 0x46052441, 
-    0x881e8e1e, 0x9dfa2102, 0x2142c445, 0x774b0000, 0x4b632035, 0x358a3477, 0x9f26774b, 0x15774b67, 0x774b679b, 0x4b679f15, 0x63201d77, 0x8337774b, 
-    0x37774b38, 0x6e480320, 0x1a01264c, 0x9a1901c6, 0x41a4425e, 0x214f774b, 0x0f4ed805, 0x4ed62006, 0x087f130f, 0x18632005, 0x4e0de37f, 0x359a200f, 
-    0x9a169742, 0x14774e31, 0x9a059742, 0x42679035, 0x319a0597, 0x3a256794, 0x2e405850, 0x0d054e00, 0x230a8d42, 0x59000101, 0x082a8f18, 0x05005b2a, 
-    0x4c044405, 0x3eb04b1b, 0x2c203582, 0x00263588, 0x00050100, 0x0a4e6101, 0x16cb4206, 0x2e903320, 0x420d414e, 0x424e19c9, 0x1521221f, 0x4d4a4821, 
-    0x02400126, 0xc1aafd56, 0x2441ca42, 0xfa94d805, 0x4464459f, 0x00022908, 0x0478fe88, 0x007b04b2, 0x00610050, 0x301640e9, 0x2f050401, 0x0e040301, 
-    0x02070201, 0x03020001, 0x05000101, 0x1eb04b4a, 0x24051968, 0x03070600, 0x0b934406, 0x02070729, 0x0202005b, 0x18084b42, 0x2211da94, 0x85030025, 
-    0x211b842f, 0xfc4f0100, 0x184b2009, 0x50075644, 0x3e2005da, 0x23205c82, 0x00272c87, 0x00020007, 0x90630207, 0x4c042534, 0x002a401b, 0x8509dd41, 
-    0x822d898a, 0x845720a9, 0x005b2234, 0x051f6001, 0x0117403a, 0x535c5e00, 0x2c343651, 0x1b22242a, 0x00050719, 0x09500150, 0x012b1408, 0x0c7a7918, 
-    0x200a8552, 0x30bc4423, 0x15010e25, 0x52031614, 0x33250ab7, 0x35363732, 0xbd791804, 0x29182408, 0x520e051e, 0x3d20089d, 0x2428fd41, 0x38272f43, 
-    0x08c85293, 0x57973a33, 0x1ef3fe58, 0x55090b85, 0x35301959, 0x2e0d233a, 0x07af521b, 0x26280942, 0x2a215440, 0x5240032e, 0x6a2608da, 0x0000b76c, 
-    0x4b4a0400, 0x06073205, 0x1f000f00, 0x6d005c00, 0x0a40e901, 0x07060136, 0x0a4b4a35, 0x0100362a, 0x01020300, 0x010c6303, 0x4e065250, 0x2d4f08ac, 
-    0x134f4a0e, 0x3da33220, 0xb914534a, 0x50112377, 0x77b54058, 0x39823520, 0x3e2077b9, 0x2a4a3d84, 0x18354107, 0x5008344a, 0x3d200c20, 0x9108634a, 
-    0x11754a38, 0x09040823, 0x086e4157, 0x08082350, 0x5e294027, 0x1120215d, 0x64000110, 0x5e6d5d62, 0x3c4f516d, 0x2a30323a, 0x215c2028, 0x1017195c, 
-    0x091f111f, 0x010f0007, 0x05704a0f, 0x3526273d, 0x33363734, 0x15161732, 0x27060714, 0x35363732, 0x23262734, 0x15060722, 0x47161714, 0x022f4dcb, 
-    0x5050726b, 0x75734f50, 0x504f4f4f, 0x822c4074, 0x3f412200, 0x2005822b, 0x2815432b, 0x2618e955, 0x5050e104, 0x82507373, 0x74742d59, 0x2c7b504f, 
-    0x2c3f402c, 0x402c2b2c, 0xfa216582, 0x28214387, 0x4a190556, 0x5532098f, 0x64002700, 0x35027500, 0x013e0a40, 0x013d0908, 0x6f530807, 0x02393807, 
-    0x04000001, 0x63040001, 0x0c000700, 0x630c070b, 0x0302050d, 0x7d5b0103, 0x0834054d, 0x005b0908, 0x4b440909, 0x3a0a0a00, 0x0b010f4b, 0x0e5b060b, 
-    0x0c7c5018, 0x40a63520, 0x0a223b85, 0x5018020e, 0x0f2307b9, 0xbc405850, 0x8211207d, 0x207db840, 0x207dbf25, 0x20408235, 0x28fb8937, 0x02050d01, 
-    0x03010903, 0x07464164, 0x3a410020, 0x833e201d, 0x0a00263e, 0x0a0b060b, 0x05136c06, 0x04000124, 0x46900063, 0x0b010f28, 0x0b06010e, 0x4f885f06, 
-    0x1b4c0824, 0x399b3e40, 0x08000925, 0x41080907, 0x418208cf, 0x0b060a23, 0x08bb4157, 0x53060b21, 0x27080899, 0x29656624, 0x6c000028, 0x6675656a, 
-    0x44575975, 0x32383a42, 0x29642830, 0x00270064, 0x13231a27, 0x0810231a, 0x36012b19, 0x20056d43, 0x0505591f, 0x3732332d, 0x06333736, 0x22230607, 
-    0x182f2627, 0x22070e55, 0x48070607, 0x22344e7a, 0x5a333202, 0x271e2127, 0x06150b39, 0x26080c0a, 0x7d021112, 0x0d241388, 0x0d090613, 0x13221382, 
-    0x89436301, 0x3b053041, 0x0e4a4987, 0x0a37220d, 0x0406040f, 0x86522425, 0x0e0c290e, 0x25040504, 0xa8fa4f27, 0x08448e43, 0x00030026, 0x04e3ff29, 
-    0x007b04b0, 0x0058004b, 0x40c80068, 0x02172014, 0x01160302, 0x3b470201, 0x3c050602, 0x04060001, 0x2d067560, 0x02090d26, 0x05010b01, 0x63050106, 
-    0x25820108, 0x01045b2f, 0x4b440303, 0x06020a0e, 0x075b0006, 0x08bd5b0c, 0x58503e24, 0x2d8a2340, 0x1e832183, 0x5f000622, 0x022e388a, 0x2b401b4c, 
-    0x08030104, 0x03010201, 0x2f8e6302, 0x06000023, 0x08598a57, 0x4f00062b, 0x27405959, 0x4c4c595a, 0x5f610001, 0x685a6859, 0x584c584c, 0x41435254, 
-    0x2a2b3638, 0x1b1d2325, 0x090b0f11, 0x4b014b00, 0x09465b0f, 0x475b3620, 0x26272705, 0x07062223, 0x475b010e, 0x16172207, 0x2f198217, 0x17163233, 
-    0x21151116, 0x14151406, 0x16141506, 0x080a9318, 0x0e272882, 0x26222301, 0x83272627, 0x0a885b35, 0x01011d26, 0x013e3732, 0x0808635b, 0x011617c9, 
-    0x2b519a66, 0x65352f27, 0x313175be, 0x1d411d5e, 0x261f431e, 0x3f402148, 0x263d3d5b, 0x5a424221, 0x48247d55, 0x010115fe, 0x521b181b, 0x41424b38, 
-    0x1d3f1d31, 0x3327481d, 0x204b255d, 0x51224227, 0x12147302, 0x572f3e11, 0xb2fe2626, 0x1411255e, 0x1e3ca931, 0x1d2d2d1e, 0x4d7d2d56, 0x592f8455, 
-    0x40407858, 0x1f0a0a0b, 0x1b11a814, 0x201f1008, 0x21213d40, 0xfe773c3a, 0x10085ace, 0x170d0308, 0x26227362, 0x321a1a21, 0x0a2015ac, 0x14150b0a, 
-    0x28504e29, 0xae021414, 0x206c4e34, 0x4444241e, 0xecfd2b9d, 0x66742043, 0x4f172d48, 0x31305b36, 0xc1000200, 0x5804e3ff, 0x18001406, 0xe1002800, 
-    0x02050ab6, 0x55010504, 0x212a06d1, 0x3b020200, 0x0505004b, 0xc45d5b03, 0x01012905, 0x01074b3a, 0x5b000404, 0x09da4318, 0x58501124, 0x288e1d40, 
-    0x01212385, 0x08034206, 0x24823520, 0x3e204da4, 0x1e202882, 0x5f823e82, 0x5f000422, 0x02217a8c, 0x25658359, 0x401b4c01, 0x5a18001c, 0x2886093b, 
-    0x87010121, 0x8259201e, 0x40240800, 0x01191a17, 0x19202200, 0x0f281a28, 0x0708090d, 0x01180006, 0x14080818, 0x2622052b, 0x07272627, 0x11331123, 
-    0x2306f441, 0x1015011e, 0x47062d5d, 0x023e0ba8, 0x295433a4, 0xa6122e4d, 0x4d4f2bb8, 0x3ba16068, 0x39743a3a, 0x438581a0, 0x86434444, 0x00824586, 
-    0x17151d3d, 0x068d522c, 0x52bdfd14, 0x4e4c2c2c, 0xfe88da4e, 0x504e9eee, 0xd56e6d9c, 0x836d6ed5, 0x6e6d3805, 0xa4000100, 0x0604e3ff, 0x2c007b04, 
-    0x0f407900, 0x01020111, 0x18021226, 0x2016d79a, 0xd79a1844, 0x503e230f, 0x9a184058, 0x442210d7, 0x9a184c02, 0x212921d7, 0x0d16181f, 0x012c000b, 
-    0xca40182c, 0xe34b1809, 0x06072112, 0x0b858318, 0x0e155708, 0x010e0701, 0xcd7dc802, 0x4d494948, 0x7dcb4a46, 0x4c264e2e, 0x2548254f, 0x5dae5b4b, 
-    0x5e322b5d, 0x235332b0, 0x221f412d, 0x53232650, 0x4e4d4f1d, 0xd88f89d9, 0x0a4d4e4a, 0xc12c150b, 0x1d0e3020, 0x60ce7170, 0x10713ca4, 0x1d2d110e, 
-    0x0b2214bf, 0x00000b0a, 0x03410200, 0x89062f05, 0x30000300, 0x0f409900, 0x03040115, 0x9a18162a, 0x746e0ad7, 0x309a1809, 0x4b44220c, 0xd49a1800, 
-    0x6e3e200d, 0x278508c1, 0x9a180520, 0x44200d30, 0x15309a18, 0x18006321, 0x2911309a, 0x04051140, 0x1a1c2325, 0xe5770f11, 0x0133220a, 0x059c7223, 
-    0x2b262941, 0xfec62f03, 0x7db29abb, 0x4a4848cd, 0x51202e41, 0x4f23052e, 0x41da4d4d, 0x06312d33, 0xa1003300, 0x01021340, 0x01180002, 0x192d0405, 
-    0x2b9a1802, 0x024b1809, 0x0204210c, 0x08c14c18, 0x9a184420, 0x3e200f28, 0x0b024b18, 0x99182883, 0x44220eaa, 0x99184c05, 0x402d28aa, 0x28070812, 
-    0x141d1f26, 0x08330712, 0xff4a1833, 0x263e4113, 0x8b640128, 0xf68bb5b4, 0x40416e93, 0xf5f52527, 0xd2fa88fe, 0x08274241, 0x00010022, 0x0475fea4, 
-    0x007b0406, 0x40c6004a, 0x00014518, 0x020f4605, 0x10160001, 0x26010402, 0x25040301, 0x14a79918, 0x004b4422, 0x2ba79918, 0x72512e8a, 0x001b2208, 
-    0xa7991801, 0x18442015, 0x332ca799, 0x34353f41, 0x20222a2d, 0x4a00080a, 0x08074a01, 0x22012b14, 0x1813b143, 0x1821a999, 0x2112794c, 0xd243ce02, 
-    0x2914240f, 0x18162817, 0x2414a44a, 0xb9701f10, 0x0fe34243, 0x43df0321, 0x05240fed, 0x2b300209, 0x15874a18, 0x062d2024, 0xfa42474e, 0x091b4410, 
-    0x0b001036, 0x9a002800, 0x01190f40, 0x1a260304, 0x27040502, 0x03050201, 0x18066c48, 0x24095799, 0x04004b3b, 0x078e4604, 0x02050523, 0x8099185b, 
-    0x503e2609, 0x001e4058, 0x22108205, 0x655f0205, 0x308a08d9, 0x3a460420, 0x05042406, 0x91630403, 0x4c002c28, 0x17405959, 0x00010c0d, 0x181e2224, 
-    0x791f2999, 0x33080601, 0x2e151716, 0x06222301, 0x33161415, 0x15373632, 0x1e4b0206, 0x1e1e911e, 0x8fcd820f, 0xcd8f4b4b, 0x4e9a5182, 0xae5d9349, 
-    0x61adbab9, 0x05954296, 0x1e901e44, 0x2b080282, 0x98509ffa, 0xda8a8ada, 0x2d295098, 0xdf3a41c1, 0x3ae0d0d1, 0x0056bf3f, 0x00020000, 0x04e3ff7b, 
-    0x00140612, 0x002b0019, 0x1015b6e1, 0x29138f47, 0x01005b01, 0x004b4401, 0x8f470303, 0x4728861e, 0x0320058f, 0x9b168f47, 0x108f474d, 0x70472c89, 
-    0x4c032c05, 0x001c401b, 0x04050001, 0x47630501, 0x032109b8, 0x471e8703, 0x1b33058f, 0x2400011a, 0x1b2b1a22, 0x1213142b, 0x000b0d11, 0x47190119, 
-    0x9c42078f, 0x16172909, 0x11331117, 0x010e2723, 0x2108394f, 0x3a4f012e, 0x1e470806, 0x6a2f0201, 0x3a3a36a0, 0xa43b3b39, 0x4d4c6661, 0x12a6b82c, 
-    0x4c293a17, 0x4545874b, 0x47642045, 0x44444386, 0x541d6623, 0x87db4f4a, 0x4e4edb85, 0x532c2b4d, 0xecf94302, 0x173f288d, 0x6d6e9c2c, 0x336ed5d5, 
-    0x826e6d3a, 0x39250806, 0x00020034, 0x04e3ff89, 0x00140648, 0x0049002f, 0x250d4088, 0x1f222324, 0x081c1d1e, 0x4a010201, 0x5025b04b, 0x26d68258, 
-    0x4b3b0202, 0x84040400, 0x4b3c28f3, 0x03030106, 0x66055c00, 0x352008be, 0x1a202382, 0x8308e943, 0x21218d2b, 0x1c871740, 0x36821782, 0x60000323, 
-    0x38258200, 0x59594c02, 0x30311540, 0x3f410001, 0x49314930, 0x0b112021, 0x2f012f00, 0xa4531807, 0x083f4508, 0x32163333, 0x2e173216, 0x012e2703, 
-    0x37270527, 0x25173327, 0x0aec4317, 0x18322721, 0x8308cf9a, 0x06d74a21, 0x17141529, 0x74690216, 0x823f3eb1, 0x3e470801, 0x0b127eb5, 0x03070b03, 
-    0x0f030804, 0x120a1514, 0xe9fe1325, 0xdbb6ed1e, 0x2121017f, 0x2e5cc4fa, 0x403f3e2d, 0x498a71b2, 0x0e0f2525, 0x1119280e, 0x26290e2d, 0x27277549, 
-    0x1d494a26, 0xd04b494b, 0x4ad28483, 0x8201494a, 0x04310800, 0x0c1c1a14, 0x5c162b17, 0x91c85062, 0xd450625e, 0x6cc160be, 0x4c4bce80, 0x366a9c48, 
-    0x693c5e96, 0x23553333, 0x06020b07, 0x9b363632, 0x6a6bc261, 0x36008200, 0xff5d0003, 0x062005e3, 0x00030015, 0x01240018, 0x1116b60d, 0x4a070602, 
-    0x272e0761, 0x00010100, 0x00010459, 0x004b3b00, 0xd8430707, 0x4b3a2809, 0x06060109, 0x65085b02, 0x112408e0, 0x23405850, 0x29852e94, 0x65080521, 
-    0x352008d9, 0xa705537b, 0x823e2059, 0x822a202e, 0x226b8244, 0x945f0206, 0x05002262, 0x24a68605, 0x401b4c05, 0x24cc8228, 0x07030607, 0x8a349463, 
-    0x8259202a, 0x40210800, 0x05191a19, 0x191e2004, 0x15241a24, 0x0f121314, 0x0518040d, 0x0a101118, 0x012b1608, 0x01230333, 0x074e7d22, 0x2508fc42, 
-    0x35363227, 0x56442634, 0x043f0805, 0x9a71c65a, 0xa064f9fd, 0x703d3c71, 0x986864a1, 0x12a6b82d, 0x8649992e, 0x86868a8a, 0x15068787, 0x46fb88fe, 
-    0x8ada9951, 0x5097da89, 0x43025456, 0x548decf9, 0xd6da9c56, 0xd7d9dad6, 0x4400d9d7, 0xd12e0853, 0x21001406, 0x1b013300, 0x02101db6, 0x81410908, 
-    0x052b3307, 0x01060301, 0x02030102, 0x04040061, 0x09004b3b, 0x5d440109, 0x07b06106, 0x0a5b0022, 0x2408f342, 0x40585011, 0x27329827, 0x0808010b, 
-    0x0a075b00, 0xae0cf74b, 0x823e2061, 0x89282061, 0x82528261, 0x0008227d, 0x21988c5f, 0xac835904, 0x1b4c0724, 0x2a892640, 0x00010027, 0x09010809, 
-    0x21328963, 0x28870707, 0x00825920, 0x231f4033, 0x2c000122, 0x2333222a, 0x1a1b1c33, 0x16171819, 0x068d4415, 0x21012123, 0x107e430c, 0x17161725, 
-    0x18352111, 0x44080686, 0xfe262695, 0xb83101cf, 0x9b44bfbf, 0x35012721, 0x79959579, 0x9f44fafa, 0xff7c3716, 0x045904e3, 0x0024007b, 0x4097002f, 
-    0x03011e0a, 0x00011f02, 0x12470203, 0x071f2a06, 0x02000501, 0x61020503, 0x06a04400, 0x3d4c4420, 0x09994d05, 0x58503e24, 0x26891c40, 0x19820320, 
-    0x5f000322, 0x042c2e88, 0x22401b4c, 0x04000100, 0x63040105, 0x0020268a, 0x10dc8f18, 0x25251734, 0x2f250001, 0x2a2c2f25, 0x1314191b, 0x24000b0d, 
-    0xbd452401, 0x17162811, 0x011d011e, 0x4f141521, 0x13220d3b, 0xb96a012e, 0x02530807, 0x48cd81a5, 0x434c4b48, 0x7071c449, 0x3f3c3ca9, 0x2e60e3fc, 
-    0x5e5b5b83, 0x64356c61, 0xcd603031, 0x24212902, 0x5587426a, 0x4f1d1056, 0x89d94d4d, 0x514bd58d, 0x46464a4f, 0x065a80c7, 0x343064b7, 0xb7381d1c, 
-    0x0b0b2016, 0x56b1020a, 0x2a2a267b, 0x829b5958, 0x7c0038ae, 0x5904e3ff, 0x03008906, 0x33002800, 0x0a40b700, 0x04050122, 0x18020123, 0x20080347, 
-    0xda4c1829, 0x01092209, 0x22f28207, 0x18620407, 0x4c07ea9d, 0x69440665, 0x503e2409, 0x93264058, 0x82052030, 0x02052223, 0x2438885f, 0x401b4c06, 
-    0x5928892c, 0x61890770, 0x8409774c, 0x594f3839, 0x29194059, 0x29040529, 0x30332933, 0x181d1f2e, 0x040f1117, 0x44280528, 0x7f4c070d, 0x1f514111, 
-    0xc6030326, 0xbb9abbfe, 0x21195641, 0x5641296c, 0x08854c0c, 0x21165b41, 0x5b410922, 0x00062617, 0x002b0024, 0x059d70bf, 0x06012127, 0x03012205, 
-    0x07a04906, 0x01012a3d, 0x72000200, 0x02040200, 0x08010a72, 0x08060500, 0x07006205, 0x005b0407, 0x4c440404, 0x0920058d, 0x2408f565, 0x4058503e, 
-    0x20319427, 0x22248206, 0x885f0306, 0x4c072439, 0x8a2d401b, 0x04002729, 0x04080700, 0x63896307, 0x094aa618, 0x4f3d3a84, 0x1a405959, 0x07082525, 
-    0x2b252b25, 0x1d1f2729, 0x10121718, 0x24082407, 0x0b101211, 0x4fa61808, 0x0774450a, 0x1d021e38, 0x14152101, 0x3233021e, 0x0e153736, 0x012e1301, 
-    0x07062223, 0x9b4c4d01, 0x62200805, 0x4b8fcd82, 0x75c0894b, 0x3f78ae6f, 0x5d31e3fc, 0xbf5a5688, 0x9ec16a6d, 0x88888f03, 0x890611ab, 0x3d05934c, 
-    0x87d89851, 0x539bdb87, 0x7ec88c4b, 0x8e5c065a, 0x39383362, 0x022b2bb7, 0xadae9db1, 0x0082009f, 0xa3420320, 0x00062608, 0x0036002b, 0x054367f3, 
-    0x06012524, 0x47412605, 0x50052f06, 0x002b4058, 0x00040100, 0x01010266, 0x48410104, 0x41612008, 0x35201848, 0xa7088c6c, 0x183e2031, 0x8f08549e, 
-    0x147a4131, 0x00218e82, 0x41298572, 0x6420067a, 0x20077a41, 0x14901861, 0x1a403713, 0x07082c2c, 0x362c362c, 0x20223133, 0x12141a1b, 0x2b082b07, 
-    0x7b411112, 0x23132806, 0x01230727, 0x49272622, 0x344409f2, 0x662e2022, 0x01210530, 0x2ce5426d, 0xfaf5f523, 0x194344d2, 0x200fe742, 0x069f4104, 
-    0x0b001034, 0x3c001700, 0xc9004700, 0x01360a40, 0x01370607, 0x73450704, 0x0d2d2c07, 0x06000901, 0x61060907, 0x660a020b, 0x08210b00, 0x079a6e08, 
-    0x6b070721, 0x3e240bf7, 0x2a405850, 0x00223488, 0x4c820c07, 0x965f0421, 0x4c082c3c, 0x0028401b, 0x09080005, 0x9d630805, 0x4c002734, 0x27405959, 
-    0x06653d3d, 0x473d2f05, 0x4244473d, 0x2b2c3133, 0x3c182325, 0x04653c19, 0x650e200b, 0x03201a04, 0x212e8841, 0xe6646c01, 0x41dd200a, 0xcc64288c, 
-    0x2894410f, 0x2c073343, 0x000b0010, 0x00300029, 0x260a40b8, 0x05184e01, 0x21079141, 0xcd450a2a, 0x5f612006, 0x3b20082e, 0x54056d44, 0x052105b0, 
-    0x0b237005, 0x58503e24, 0x31882740, 0x09050027, 0x02050201, 0x2339935f, 0x401b4c06, 0x9a086d5f, 0x00210831, 0x4059594c, 0x0d2a2a1f, 0x2a00010c, 
-    0x2e302a30, 0x1d22242c, 0x0c15171c, 0x07290d29, 0x010b0004, 0x0650180a, 0x4903200f, 0x794408ee, 0x2e022716, 0x1e911e1e, 0x78441a1e, 0x09494e1d, 
-    0x441d7a44, 0x1b470977, 0x260126f1, 0x9a1901c6, 0x28a8423a, 0x30361b47, 0x0300d805, 0x28002100, 0x0a40e200, 0x0405011e, 0x0b77481f, 0x20070b48, 
-    0x0ab86461, 0x4c060621, 0xe14c09e7, 0x503a240b, 0x89264058, 0x076d4830, 0xda630120, 0x20388708, 0x07da6306, 0x00002428, 0x00030100, 0x35916101, 
-    0x40212b8a, 0xee4c182a, 0x063f6208, 0xaf182e8a, 0xa148084a, 0x40593607, 0x05222219, 0x22282204, 0x1c242628, 0x0f14151a, 0x0521040d, 0x06a24821, 
-    0x21152122, 0x4209b04c, 0x012716c1, 0xfd560261, 0x424401aa, 0xd8231ec1, 0x429ffa94, 0xb6821dbc, 0x00023708, 0x0475fe7c, 0x007b0459, 0x003b0034, 
-    0x091340e8, 0x21050001, 0x0003020a, 0x03010115, 0x01020116, 0xb04b4a04, 0x40585021, 0x08070029, 0x07000501, 0x01096105, 0x78480606, 0x00002607, 
-    0x03005b03, 0x034d1803, 0x8235200f, 0x88262030, 0x01002630, 0x02010200, 0x2037935f, 0x096a4103, 0x95825e87, 0x00010324, 0x35906303, 0x1b4c0626, 
-    0x04002a40, 0x07234682, 0x89630604, 0x8583825d, 0x244d182f, 0x36162a11, 0x39000035, 0x363b3538, 0x2ae0823b, 0x24382834, 0x080a252b, 0x48012b19, 
-    0x4d180a91, 0x0e22132b, 0x47442301, 0x2201280c, 0x2e250706, 0x483c0101, 0x2e2406a0, 0x282f2b58, 0x08234d18, 0x21140926, 0x13261419, 0x2a0b8f41, 
-    0xab882efe, 0x035e0211, 0x4804028f, 0x132507ae, 0x54410b1c, 0x1e4d1822, 0x2d162607, 0x021e342f, 0x0ca04102, 0xaddb0127, 0xae9d019f, 0x08008200, 
-    0xa7000125, 0x0b040000, 0x16001406, 0xb04b7300, 0x40585035, 0x0303001c, 0x02005b02, 0x054b3b02, 0x01000001, 0x82010459, 0x7a4b2090, 0x3e20089a, 
-    0x06232384, 0x94730600, 0x4c002528, 0x001a401b, 0x37821e83, 0x00010526, 0x61000106, 0x033c2888, 0x4059594c, 0x1511110a, 0x10112421, 0x2b1b0807, 
-    0x21352101, 0x36373435, 0x2315013b, 0x4608fb82, 0x21011d06, 0x23112115, 0xd5fed201, 0x54552b01, 0x36d1ddb3, 0x01271241, 0xb87ffe81, 0x4e8fd103, 
-    0x995756b9, 0x67291315, 0x2ffc8f63, 0x97000200, 0x2e0448fe, 0x2a007b04, 0x97013b00, 0x12240f40, 0x07060502, 0x82020101, 0x03012173, 0x2406c478, 
-    0x04040026, 0x0a4b463c, 0x05010823, 0x24de8405, 0x01004b3a, 0x05c67801, 0xb4823e20, 0x0ab04b22, 0x2220d882, 0x0320e682, 0x9906025d, 0x820f2029, 
-    0x2057a929, 0x4257a811, 0xafa705ce, 0x57823e20, 0xa4822420, 0x01020025, 0x8e630205, 0x20db8ee6, 0x302b8249, 0x03040025, 0x06040306, 0x00030070, 
-    0x06030506, 0x413b8963, 0x40210b08, 0x23279a2a, 0x57010000, 0x40185a87, 0x593d0754, 0x2c194059, 0x3500012b, 0x2c3b2b33, 0x2025263b, 0x0d15171e, 
-    0x012a000b, 0x1408092a, 0x05264a2b, 0x09af6618, 0x013d3622, 0x3106d55f, 0x3e371011, 0x16323301, 0x37171617, 0x07141133, 0x64630306, 0x082a5405, 
-    0x02166b08, 0x2a4e2759, 0x312c5129, 0x494e265b, 0x4423684a, 0x6c4c4d2b, 0x757575c5, 0x34659b3b, 0x2e4c265b, 0x7677a612, 0x434382d3, 0x3e652343, 
-    0x48474786, 0x0748fe48, 0x0e140707, 0x0b2217b6, 0x502a2816, 0x2f5d85b0, 0x019d9d2e, 0x9e070107, 0x16154e4f, 0xfb91592c, 0x8283fbec, 0x6d6d4902, 
-    0x396bd0ce, 0xd16b6b32, 0x006d6dcd, 0x4b420300, 0x31063805, 0x3d001100, 0x59024e00, 0x25370f40, 0x190a0902, 0x18060501, 0x42050401, 0x3520074d, 
-    0x7607d074, 0x08260730, 0x004b3c08, 0x35760a0a, 0x010d2d06, 0x5c060909, 0x3a060600, 0x0505004b, 0x2305424a, 0x1b4c043e, 0x20055c42, 0x833c8f31, 
-    0x01082537, 0x4b440707, 0x0f233899, 0xb8405850, 0x82112075, 0x2075b43c, 0x2075bb23, 0x763c8335, 0x63210d42, 0x27284100, 0x670b4476, 0x0d280751, 
-    0x06000901, 0x64060905, 0x6341458e, 0x8249200e, 0x86342077, 0x07082577, 0x0a08070a, 0x27087f76, 0x00070063, 0x0a07090a, 0x8405904b, 0x0b9f414a, 
-    0xa9394021, 0x04042336, 0x78875705, 0x7f760520, 0x59240808, 0x3e3f2540, 0x00011213, 0x4e3e4648, 0x38394e3f, 0x282a3133, 0x3d121d1f, 0x0d0e3d13, 
-    0x0405080a, 0x11011100, 0x2605c54b, 0x33272627, 0x62161716, 0xbf4b08e1, 0x09214305, 0x43013e21, 0x84322b22, 0x0b4f4f90, 0x2f310a77, 0x312f5658, 
-    0x4f0b770d, 0x3443bb50, 0x2321210d, 0x2f203543, 0x48481205, 0x25264b8f, 0x8f4b2625, 0x36f94848, 0x220b4343, 0x435d7b28, 0x43432644, 0x00892807, 
-    0x00290006, 0x5cf60135, 0x242d05ed, 0x09080214, 0x0504010b, 0x0403010a, 0x06954504, 0x0c503120, 0x02062a07, 0x07070072, 0x09004b3c, 0x06607609, 
-    0x08010b22, 0x2005864d, 0x05235a3a, 0x03223682, 0x4343033e, 0x08455007, 0x33833883, 0x06010725, 0x994b4406, 0x500f2334, 0x6db44058, 0x38821120, 
-    0x35206db0, 0x3e206db7, 0x2f203882, 0x820a1441, 0x050025d0, 0x63050804, 0x220e1d41, 0x77040400, 0x12410578, 0x82492005, 0x41302036, 0x062d0c4b, 
-    0x09070609, 0x00060070, 0x09060809, 0x8b468963, 0x35402137, 0x032032a5, 0x07366918, 0x03010a23, 0x0a6d7604, 0x082a2b37, 0x2a2f3107, 0x26352b35, 
-    0x18202225, 0x070f1116, 0x11290829, 0x066d7612, 0x33371730, 0x22132303, 0x1e352726, 0x36323303, 0xe648013d, 0x05ec450b, 0x57030221, 0x01210a1b, 
-    0x05a45145, 0x4c1e2308, 0x593254a5, 0x91254b50, 0x6d962a86, 0x3d70a164, 0x65a1713c, 0x122e9767, 0x84d5eda6, 0x84858686, 0xa9518f8e, 0xf9270805, 
-    0xb61b1c37, 0x0b162217, 0x5b85ada5, 0xd696525f, 0x96d58484, 0x91595752, 0xfefeecfb, 0xd84902fe, 0xd5d6d0d0, 0x45d8d1d0, 0x6a2008d7, 0x262c0982, 
-    0xd9013200, 0x11210f40, 0x08080702, 0x0723d082, 0x45030201, 0x2e2e07d7, 0x01000000, 0x61010005, 0x3c060600, 0x0850004b, 0x010a2208, 0x05fc5207, 
-    0x004b3a24, 0x844e0303, 0x183e2005, 0x2008e9c8, 0x8335882a, 0x01062530, 0x4b440505, 0x0f233199, 0xb1405850, 0x52112067, 0x9d86051b, 0x987067a3, 
-    0x70cfaf05, 0x35860562, 0x0025c482, 0x04070304, 0x0e0e4163, 0x200e0341, 0x289b8249, 0x0506002d, 0x08060508, 0x080b4170, 0x08000526, 0x63080507, 
-    0x38414389, 0x3240210b, 0x02232fa2, 0x87570302, 0x7e03206a, 0x593807d8, 0x27281b40, 0x2c2e0405, 0x32283227, 0x1d1f2223, 0x0c0e1315, 0x26052604, 
-    0x4207d97e, 0x02252c73, 0xef5e92bd, 0x23704257, 0xa7fe6a22, 0x42286e42, 0x1034086f, 0x2e000b00, 0xef013a00, 0x19290f40, 0x10080702, 0x0f040301, 
-    0x270a6f42, 0x00010931, 0x005b0100, 0x4206747e, 0x0b200b72, 0x210e7242, 0x5918010a, 0x0a2407f1, 0x2d405850, 0x0d42388b, 0x20349909, 0xb434820f, 
-    0xb311206d, 0xb735206d, 0x823e206d, 0x822f2038, 0x057642c5, 0x24191d41, 0x02030300, 0x0912415b, 0x36824920, 0x51423020, 0x06794208, 0x378b4694, 
-    0xb4424020, 0x21328f09, 0x5c820300, 0x5f020322, 0xaf788189, 0x40593a07, 0x0d2f3021, 0x3600010c, 0x303a2f34, 0x272a2b3a, 0x161b1d25, 0x0d2e0c14, 
-    0x0fc9182e, 0x45032015, 0x02272901, 0x911e1e3b, 0x42731e1e, 0x3152228f, 0x04f92107, 0x33260245, 0xc3000100, 0x1b040000, 0x19001406, 0x02b56500, 
-    0x01030201, 0x24067c5a, 0x00000016, 0x4460183b, 0x4b442208, 0xb6911804, 0x503e2608, 0x00164058, 0x05a16d03, 0x00211885, 0x242d8359, 0x401b4c02, 
-    0x07b57014, 0x16872f83, 0xb759592c, 0x24152415, 0x19080510, 0x9567132b, 0x15162508, 0x34112311, 0x2005aa69, 0x080b8206, 0x32b8c32a, 0x5a735353, 
-    0xb954297e, 0x42723535, 0xb8462261, 0xa4fd1406, 0x3a313161, 0xfde47136, 0x97b6024a, 0x2d2e4747, 0x87fdac5b, 0x46216482, 0x25b78500, 0xb588001b, 
-    0x6e5e010a, 0x82352005, 0x03202d99, 0x01040101, 0x00010500, 0x02020061, 0x0721c182, 0x06b85507, 0x55180820, 0xc1830872, 0x228c278b, 0x2005d460, 
-    0x20cb8206, 0x264a8a1e, 0x06070005, 0x83630705, 0x28208743, 0x0c405959, 0x23132313, 0x22008211, 0x18080910, 0x260954a2, 0x3e112115, 0x85323301, 
-    0x232622df, 0x3ddc8422, 0x01b87d7d, 0x319ffe61, 0xa8ac73a8, 0x837169b9, 0xf604b88a, 0xa47a7aa4, 0x6261c2fe, 0xdd84e5e0, 0x83b68e21, 0x02002fda, 
-    0xf8ff0c01, 0x14064404, 0x1d000b00, 0x794f8900, 0x0c1e6305, 0x04030327, 0x04040059, 0x053b673c, 0x99410720, 0x141e630c, 0xc9613087, 0x00042605, 
-    0x03040503, 0x1b1e6361, 0x151a1c29, 0x0c121314, 0x421d0d1d, 0x082005bf, 0x080e6356, 0x2622132a, 0x11352627, 0x11213523, 0x011e1714, 0x0215013b, 
-    0x901e1e0b, 0x50c01e1e, 0xf55b307f, 0x182ead01, 0x05d72b43, 0x1ead1e2b, 0xfa320282, 0x6a3832cd, 0x904202c2, 0x3e7d2efd, 0x009c1e21, 0xe3850100, 
-    0x00600425, 0x85680012, 0x821620e1, 0x59022414, 0x82020200, 0x030324d6, 0x18045b00, 0x6908327e, 0x01210d22, 0x2e258501, 0x401b4c01, 0x00020019, 
-    0x01020301, 0x18030061, 0x2914fac3, 0x08090e10, 0x12000607, 0xc3181101, 0xb48c08fa, 0x5b032322, 0xe921af8b, 0x41a78f08, 0x6f20078b, 0x15226082, 
-    0xa9858800, 0x74182020, 0x8a410a07, 0x4106200d, 0x1d200c8a, 0xc668278a, 0x0b894107, 0x1f8a2320, 0x53089341, 0x4b8208ac, 0x4f02053d, 0x11405959, 
-    0x12140405, 0x0a0b0c0d, 0x15051504, 0x08071011, 0x33012b16, 0x41012301, 0x03271082, 0xbbfec61a, 0x8b5a019a, 0x6f0625d2, 0x01fb88fe, 0x6342d68f, 
-    0x00702608, 0x00180006, 0x13691893, 0x50352408, 0x18214058, 0x270b67a2, 0x59050404, 0x3c050500, 0x20096d68, 0x082f533a, 0x288b1e20, 0x01070627, 
-    0x5f030603, 0x24308700, 0x401b4c04, 0x25208b24, 0x06040005, 0x525a0405, 0x8331840b, 0x08122ce1, 0x10151707, 0x070d0e0f, 0x18180818, 0x4211a568, 
-    0x02200e68, 0x21052b5a, 0xe78c4f02, 0x88fe7026, 0x00fbf5f5, 0x0320e98e, 0x29056742, 0x0b001006, 0x29001700, 0xc1419a00, 0x09242305, 0xdc590802, 
-    0x0505230b, 0xce485906, 0x07072805, 0x010a5b04, 0x673a0404, 0x212208e8, 0x10820700, 0x5f040722, 0x05203396, 0x1f28e882, 0x05000600, 0x61050607, 
-    0x41582b94, 0x05c85905, 0x21262829, 0x181e1f20, 0x59291929, 0x41580bc2, 0x0bc77e0f, 0xe7410320, 0x48012110, 0x200aa459, 0x0b054103, 0x200e8759, 
-    0x0e0d41b2, 0x02000029, 0xf8ffda00, 0x42064404, 0xb22305cf, 0x4105b04b, 0x042806f0, 0x01006600, 0x00720104, 0x6b17d042, 0x279b0bbf, 0x830bbf6b, 
-    0x25f84227, 0xbf6b6220, 0x14f94212, 0xf9421320, 0xc6da2614, 0x019a1901, 0x0c10423c, 0x4314f842, 0x052a06cf, 0x000300bc, 0x4bab0015, 0xff8228b0, 
-    0xb8572020, 0x28fe9b0a, 0x0000001e, 0x01000401, 0x18244161, 0x1b20fc83, 0xfa932588, 0x1d882120, 0x9419f143, 0x210123f8, 0xf2432115, 0x0c012511, 
-    0xaafd5602, 0x240d0a43, 0xfa94bc05, 0x0ef941d0, 0x2208f782, 0x480480fe, 0x0b001406, 0xe8003100, 0x011a0e40, 0x010e0607, 0x010f0702, 0x4a030203, 
-    0x5018b04b, 0x5b2b4058, 0xf8430b26, 0x5907280b, 0x3a070700, 0x1801094b, 0x2010bda1, 0x20138228, 0x5b418200, 0x3a910c61, 0x62570720, 0x00262807, 
-    0x02070006, 0x9b610706, 0x053a4437, 0x97082f44, 0x4c003830, 0x40595959, 0x010c0d1b, 0x2a2b2c00, 0x21222328, 0x0c111320, 0x46310d31, 0x0a2005b2, 
-    0x7a0eb246, 0x564410be, 0x0e233c0d, 0x16141501, 0x21210e02, 0x0121218a, 0x2a3e3e34, 0x76702540, 0x1a241609, 0x46296a41, 0x9c2308d1, 0x46382228, 
-    0xf92107d5, 0x055a7ad0, 0x312e1727, 0x32062036, 0x0be14630, 0x204c3926, 0x00002e2a, 0x26086745, 0x00230005, 0x43130135, 0x2b2a056f, 0x050a0100, 
-    0x01080302, 0x62186303, 0x41260867, 0x0707004b, 0xc4525908, 0x09092405, 0x480b5c06, 0x352308ad, 0x93405850, 0x993b2032, 0x823e2032, 0x8a282032, 
-    0x82092065, 0x0609224d, 0x8a6d8860, 0x4c07253a, 0x43b04b1b, 0x26202f82, 0x08272f8a, 0x08090700, 0x90006107, 0x4c042437, 0x762c401b, 0xc7880a73, 
-    0x06243188, 0x00570906, 0x0923c086, 0x82595006, 0x40310800, 0x0024251a, 0x2d323400, 0x242a2b2c, 0x00352535, 0x25230023, 0x24251424, 0x2b19080c, 
-    0x023e3401, 0x1f163233, 0x33011e01, 0x36373632, 0x0e143337, 0x4b621802, 0x06072209, 0x13f54207, 0x49311a30, 0x2540262f, 0x0e201839, 0x11091c11, 
-    0x10877d02, 0x11201522, 0x13231082, 0x44d30101, 0x042e0b0c, 0x496941eb, 0x37211c27, 0x13121017, 0x0c865224, 0x12131427, 0xfb4f2713, 0x0f2b430d, 
-    0xfeee0033, 0x06440356, 0x000b0014, 0x4b5f001d, 0x58503eb0, 0xf9511840, 0x4b3b2109, 0x340afe43, 0x5b050202, 0x3e050500, 0x401b4c05, 0x0004001e, 
-    0x03040203, 0x0b986c61, 0x59272089, 0x00011340, 0x82151b1d, 0x0c0e2175, 0x15a95118, 0x32330123, 0xafa11837, 0x012b380b, 0x1e1e8c02, 0xfd1e1e90, 
-    0x2d5aead2, 0x01c3fe2d, 0x2d2d2cf5, 0x42fe5181, 0xc7360882, 0x037d3f3e, 0x8cfb8fe5, 0x3636985f, 0x01000033, 0x0000e200, 0xbb84a804, 0x09406229, 
-    0x02050809, 0x4b010204, 0x112b07d3, 0x3b000000, 0x0101004b, 0x48034b3c, 0x17200ca9, 0xad4b0e83, 0x21198405, 0x24835901, 0xd4820220, 0x82001221, 
-    0x55012128, 0x00211f89, 0xc0a1184c, 0xbee23c16, 0xfee0e301, 0xe1fe0147, 0xbe8962fe, 0x7bfc1406, 0x5afed101, 0x420246fd, 0x823ffe81, 0x02002578, 
-    0xe0fde200, 0x0f229b86, 0x9d907a00, 0x04001827, 0x05040500, 0x20a4975d, 0x981f861e, 0x851920ab, 0x832690ab, 0x094023b2, 0xa1181111, 0xb98d17d0, 
-    0xef900124, 0xbe8e92bb, 0xa7fec731, 0x00010000, 0x04f8ffb4, 0x0014061e, 0x4a460012, 0x3b200eb3, 0x4a059867, 0xd17307b3, 0x0ab5740a, 0x010f4023, 
-    0x14914a00, 0x464b2120, 0x03232f09, 0x307f5035, 0x01d9fe5b, 0x43182edf, 0x924ad72b, 0xf6032405, 0x4b7afb90, 0x0023063a, 0x82a00002, 0x070a2b87, 
-    0x00030058, 0x4b880010, 0x366b30b0, 0xc7721805, 0x07a1420a, 0x05239682, 0x4a5b0205, 0xc5470996, 0x20278e16, 0x1ab94a40, 0x4c033b22, 0x2905934a, 
-    0x0a0b0d0f, 0x10040809, 0x934a1005, 0x23032607, 0x35262201, 0x2bcd8411, 0x0215013b, 0x9ae5ba41, 0xb4a6a501, 0xb429cc83, 0xfe5807d7, 0xd3a8f9f8, 
-    0x22cb84c3, 0x86009cfa, 0x068524c7, 0x820c0014, 0x416220c7, 0x22280551, 0x02010100, 0x02010459, 0x88059576, 0x0303220a, 0x2bc68200, 0x003a0000, 
-    0x1f401b4c, 0x01060300, 0x5f20fd82, 0x05352c94, 0x1340594c, 0x0f100001, 0x090b0d0e, 0x04050607, 0x0c010c00, 0x05fa6907, 0x03259d89, 0x03230333, 
-    0x249c8721, 0x9a71c64b, 0x239b8808, 0x88fe1c06, 0xfd239f84, 0x860a04e0, 0x8559209f, 0x421d209f, 0x7984065d, 0x8c05604e, 0x841b209a, 0x0304229a, 
-    0x017b1800, 0x0b004208, 0x052096a1, 0xfd24968c, 0x92bbefe7, 0xbf2a9789, 0x0000a7fe, 0x4c000100, 0x9784f8ff, 0x55001a25, 0x82110d40, 0x080925e8, 
-    0x03080607, 0x4d08e743, 0x9642084a, 0x16182928, 0x0a0b0c0d, 0x19011a00, 0x2a0a284d, 0x11012705, 0x11213521, 0x4d011725, 0x233407e5, 0x7f502103, 
-    0xd5fe5b30, 0xfe7b0150, 0x01df01d9, 0x75fe503b, 0x300aa842, 0x6fd12401, 0x2c020801, 0xdbc1fd90, 0xfeedfe6e, 0x06b4425f, 0x6d000133, 0x6f040000, 
-    0x39007b04, 0x0ab6b800, 0x00040202, 0x06817801, 0xd2821920, 0x064b3c30, 0x01040401, 0x0101025b, 0x074b4401, 0x7b180205, 0x13240743, 0x15405850, 
-    0x00201b83, 0x02231b82, 0x8b3c0000, 0x8235201c, 0x203d9c1c, 0x9020833e, 0x59002259, 0x4f488200, 0x0024050a, 0x55000304, 0x24827582, 0x04010323, 
-    0x21188263, 0x7e835903, 0x4d030023, 0x2f008259, 0x28180b40, 0x26152816, 0x08081024, 0x33132b1c, 0x7a05457a, 0x19270a4d, 0x34112301, 0x1827022e, 
-    0x2008f0ba, 0x080f8c11, 0x11150368, 0x10976d23, 0x40313221, 0x1d31344a, 0x4a343423, 0x371a6045, 0x0a0703a8, 0x2a2e0b07, 0x110f3426, 0x0804a80e, 
-    0x310d060b, 0x0c2f2a27, 0x04080b07, 0x606004a7, 0x231f203c, 0x22494822, 0x68333522, 0x77fddefe, 0x60408102, 0x1a0f3147, 0x23201d1f, 0x7ffd7789, 
-    0x65498102, 0x1a0d2944, 0x0f1b211e, 0x4260452e, 0xb8827ffd, 0xcb510020, 0x7b042506, 0xa4001900, 0x2408cb51, 0x40585005, 0x201e8216, 0x14cb513c, 
-    0x1d821320, 0x0300122a, 0x015b0003, 0x3c000001, 0x200ae551, 0x52379c35, 0x3c2b1703, 0x401b4c02, 0x03000019, 0x52550002, 0x7c820709, 0x04590228, 
-    0x02000201, 0x0082594d, 0x7b0b0a52, 0x0a520895, 0x12a6210f, 0x22100b52, 0x52a86004, 0x0021140a, 0x06c35202, 0x03008929, 0xd9001700, 0x7a0106b5, 
-    0x202009de, 0x220aba6b, 0x7a3c0202, 0x25820ae8, 0x2006e44d, 0x36641813, 0x0500260d, 0x035b0205, 0x892d8301, 0x0fbd7823, 0x3e204b97, 0x738b4b82, 
-    0x8308577b, 0x05b7504a, 0x240fc078, 0x02040502, 0x29ba8255, 0x05030405, 0x02020063, 0x2b825904, 0x4d040223, 0x21008259, 0x60520a40, 0x07102b05, 
-    0x012b1b08, 0x05230133, 0x5a521733, 0x08032910, 0x9abbfec6, 0x12a6d4fe, 0x250a5c52, 0x88fe8906, 0x5a52a8b1, 0x0a2b410f, 0x1a00062f, 0x0a40e400, 
-    0x00020102, 0x06050109, 0x068d4302, 0x0cdb7c18, 0x3c030324, 0x6863004b, 0x18072008, 0x2008d069, 0x065c1813, 0x82cb180b, 0x01042107, 0x24892e83, 
-    0x9710b878, 0x823e204d, 0x8c768c4d, 0x59032271, 0x78388200, 0x032c10bb, 0x55030506, 0x06000400, 0x63060405, 0x05212182, 0x21798259, 0x35410503, 
-    0x410b2005, 0x122b0535, 0x1c080810, 0x1733012b, 0x41033337, 0x01211439, 0x055c5a1d, 0x41b0fe21, 0xf5210e3b, 0x123d41f5, 0xc300022e, 0x1b04e0fd, 
-    0x13007b04, 0xcb001700, 0x220c6143, 0x8205001d, 0x5d06218a, 0x201c6843, 0x43248719, 0x45a0176f, 0x86055c4f, 0x1181556a, 0x4c023c25, 0x4321401b, 
-    0x04260977, 0x00050201, 0x5d186102, 0x402d137d, 0x1311110a, 0x10231323, 0x2b1b0807, 0x12554213, 0x03330524, 0x1641c323, 0x6301260c, 0x0492bbef, 
-    0x0e544260, 0x9346c720, 0xfec32c06, 0x041b0456, 0x001a007b, 0x180fb5cc, 0x200e2ba4, 0x086e793c, 0x184b4421, 0x24122ba4, 0x40585013, 0x2ba4181b, 
-    0x182c8208, 0x9e192ba4, 0x823e2049, 0x791f2049, 0x6b8407da, 0x22053e42, 0x1800004b, 0x2d2c2ba4, 0x13112325, 0x08062024, 0x33012b1a, 0xa4183532, 
-    0x32300e29, 0x14111516, 0x01012b06, 0x69b3b9f6, 0xb88a8371, 0x2d062541, 0xfecda6b2, 0xca02faf2, 0xacb68e97, 0x284187fd, 0xc4362207, 0x447c82d2, 
-    0x202907a3, 0x41002700, 0x2ab51601, 0x0a9e7301, 0x0b010025, 0x18030205, 0x210c0a95, 0x8e524b3b, 0x09092105, 0x2a063d62, 0x0808010a, 0x1b4c083a, 
-    0x8213b04b, 0x852720e3, 0x18062032, 0x820ba395, 0x07f35e32, 0x894b3c21, 0x063d4e2e, 0x3e2061ab, 0x9305704e, 0x538f8c32, 0x94820533, 0x8a264021, 
-    0x000728c2, 0x09070809, 0x82060063, 0x08062283, 0x09734e5d, 0x594c0422, 0x402d0082, 0x41000018, 0x35393b40, 0x292d2f34, 0xe6431828, 0x180c2008, 
-    0x2129e643, 0x8747010f, 0x17162106, 0x210f4258, 0x43181f01, 0x4318089e, 0xd8201db2, 0x21126046, 0x43180605, 0xa6201d83, 0x2a187f46, 0x04e3ff89, 
-    0x007b0448, 0x18240014, 0x22103fa4, 0x18054b44, 0x240e3fa4, 0x4058503e, 0x20148214, 0x3fa41804, 0x0344210c, 0x223fa418, 0x01151630, 0x151c1e00, 
-    0x0b241624, 0x01140009, 0xd0740614, 0x37102a09, 0x16323336, 0x14111617, 0xea401806, 0x73683313, 0x3c3f3eb3, 0x78e97b7b, 0x3d7b3cb1, 0x76b33c3e, 
-    0x0082488d, 0x828c8d21, 0x1d483404, 0xdd4e4b4b, 0x981c018c, 0x984a4d97, 0xde8fe5fe, 0x794c4a4b, 0x4018054d, 0x032007e3, 0x28064b79, 0x00030089, 
-    0x00280018, 0x050d4b90, 0x24052a56, 0x01030100, 0xc7411872, 0x3ca41809, 0x56ef830f, 0x2884052a, 0x10339c18, 0xa4184420, 0x63201513, 0x16359c18, 
-    0x05191a23, 0xf6411804, 0x05667707, 0x11570820, 0x6e132006, 0x094105ec, 0xc6f4251e, 0x8d9abbfe, 0x6c1b0e41, 0x13410524, 0x0006262a, 0x002b001b, 
-    0x084557c7, 0x58500523, 0xe6a31840, 0x4b442514, 0x05050108, 0x0b368b18, 0x2a823520, 0x0bcd7f18, 0x8f096e47, 0x05db4429, 0x71010021, 0x1f8207ac, 
-    0x0d8fa318, 0x18064421, 0x312c8fa3, 0x1c1d1640, 0x23250708, 0x2b1d2b1c, 0x1b071012, 0xa3181b08, 0x26240f8c, 0x35012e27, 0x201e4d41, 0x058c571f, 
-    0x413f0121, 0xf5231f50, 0x41d2faf5, 0x00212052, 0x06674204, 0x0b00102a, 0x2c001700, 0xa1003c00, 0x20056942, 0x0e7d5725, 0x1808b25b, 0x21083aa3, 
-    0xb2574204, 0x82222008, 0x010a2314, 0xb3570604, 0x25358710, 0x401b4c07, 0xa3180020, 0x2c920983, 0x594c0027, 0x2e234059, 0x05b6572d, 0x2d34362b, 
-    0x233c2e3c, 0x192c1821, 0x0bb8572c, 0x64540c20, 0x8056180e, 0x2240410d, 0x0d386918, 0x4541f520, 0x0edc571b, 0x4d419d20, 0x00002121, 0x26c9b743, 
-    0x01c61701, 0x410c9a19, 0xb7431b20, 0x02270826, 0xe3ff2000, 0x7b04b204, 0x2c002000, 0xb04bc500, 0x40585031, 0x00030020, 0x00030500, 0x06060064, 
-    0x04075b02, 0x43020202, 0x012605ac, 0x0101005b, 0x8c180142, 0x242007cc, 0x07252787, 0x3c040401, 0x202d844b, 0x202b9200, 0x2053823e, 0x272b8721, 
-    0x00050108, 0x5f010501, 0x0624338e, 0x2b401b4c, 0x022d1382, 0x06040206, 0x00020070, 0x06020306, 0x23348a63, 0x57050101, 0x05203b82, 0x05318383, 
-    0x59594f01, 0x22154059, 0x28000021, 0x222c2126, 0x3abe822c, 0x25262320, 0x18080935, 0x011e012b, 0x23061415, 0x16272622, 0x23021015, 0x55110222, 
-    0x17280556, 0x36323316, 0x01273435, 0x080a5265, 0x0b9e044a, 0x0f595509, 0xf6150e1d, 0x3ef4ebea, 0x8f75b27a, 0x212a3bcb, 0xfd1e2e2a, 0x8f8f8ee6, 
-    0x8f8f8d8e, 0x402a7104, 0x03767025, 0xfe766005, 0x01d3fee2, 0x8f20012b, 0x714d95dc, 0x36381370, 0x0efc3e3e, 0xd9d7d6da, 0xdad6d7d9, 0x2008af43, 
-    0x26b58289, 0x00170007, 0x43920023, 0xa31805af, 0x4421125c, 0x057d6f4b, 0x5b180820, 0x3e240836, 0x1e405850, 0x1a5ca318, 0x4c074425, 0x8925401b, 
-    0x5ca31820, 0x1740311c, 0x08091819, 0x23181d1f, 0x0f112319, 0x17091708, 0x135ba318, 0x023e3429, 0x021e3233, 0x7d021015, 0x022a0b81, 0x89e0aa17, 
-    0xf8b30c02, 0x11413087, 0xb3752505, 0xeaf63f79, 0x29060d41, 0x88fe8906, 0x88fe7801, 0x0841d2fa, 0x954d2807, 0xe2fe8fdc, 0x419cd3fe, 0x00200808, 
-    0x29086b43, 0x0300d705, 0x1f001300, 0x0941b300, 0x0a5d5a06, 0x47080e4e, 0x3a200f23, 0x08134918, 0x02040223, 0x2031925f, 0x07415905, 0x69821c20, 
-    0xa3180120, 0x4420147b, 0x40212382, 0x0a077223, 0x03040523, 0x15454705, 0x15405938, 0x04051415, 0x1f14191b, 0x0b0d1f15, 0x13051304, 0x08081011, 
-    0x655a2b16, 0x063d4205, 0x27102641, 0x56023d01, 0x2b01aafd, 0x24122341, 0xfa94d705, 0x191e41a0, 0x00032a08, 0x04a0ff2f, 0x00bc0496, 0x00340025, 
-    0x40850046, 0x0211131b, 0x40410002, 0x05011434, 0x01240203, 0x4a030301, 0x48000112, 0x70a31825, 0x18442011, 0x240f70a3, 0x4058503e, 0x70a31813, 
-    0x0244230f, 0xa3181b4c, 0x36321f70, 0x36463535, 0x1f292b46, 0x08052a1d, 0x37172b15, 0xe346012e, 0x011e230a, 0x41183717, 0x0623097b, 0x82262223, 
-    0x0727251c, 0x26272601, 0x08aa5418, 0x05171622, 0x0a914118, 0x32820120, 0x011e8908, 0x1a17aa2f, 0x7b0a0b0a, 0x5d31e87b, 0x1f472526, 0x29a45d93, 
-    0x3d0b0b17, 0x37eb7b3e, 0x41292657, 0xa602a01e, 0x42333123, 0x27244a8b, 0x0e070403, 0x488e0301, 0x03032424, 0xfe080802, 0x18291631, 0xc8143619, 
-    0x332f502a, 0x1d013b64, 0x0e0d9798, 0xb01d2a0d, 0x6141c34d, 0x8f3b6d31, 0x10964bde, 0x202a0f0e, 0x31e103ba, 0x346b1716, 0x351c6796, 0xd5463b1d, 
-    0x67a1376e, 0x151c351e, 0xd1fd2438, 0x0b0b1f1c, 0x0400000d, 0x08056341, 0x00890628, 0x001c0003, 0x00310028, 0x111b40a3, 0x12010201, 0x02040210, 
-    0x13282f30, 0x04050505, 0x0503011b, 0x011c4a04, 0xcc604703, 0x01022e0d, 0x04040072, 0x02005b02, 0x064b4402, 0x06a94201, 0xec5f4220, 0x511d2008, 
-    0x27820649, 0x00211d82, 0x29a31803, 0x5f44200a, 0x002009eb, 0x72286e82, 0x04000200, 0x63040205, 0x1329a318, 0x2a0e4029, 0x2a312929, 0x182a2531, 
-    0x080828a3, 0x0123018d, 0x35012e37, 0x33023e34, 0x37171632, 0x011e0717, 0x23021015, 0x01072722, 0x2223012e, 0x1415020e, 0x32051716, 0x26343536, 
-    0x02160127, 0xbbfec6f4, 0xaa54fe9a, 0x7a3e2927, 0x9e6275b4, 0xa45d933c, 0xebf52c2a, 0x02a071cc, 0x3d6524a6, 0x264a6c47, 0x03010e0e, 0x0c0c908e, 
-    0x064831fe, 0xfa88fe89, 0xc148c8db, 0x94da8e75, 0xb039364d, 0xc042c34d, 0xfedefe7a, 0x03ba77d5, 0x372c32e1, 0x39619768, 0xdbd54873, 0x3a6e3cce, 
-    0x435ed1fd, 0x062908c7, 0x00270020, 0x004c003c, 0x052841b1, 0x1f5b2c20, 0x0fa64d05, 0x2008114d, 0x17a3180c, 0x503e240e, 0x89294058, 0x251e8233, 
-    0x0806010b, 0x104d5f06, 0x004b2109, 0x09223c87, 0x7e181b4c, 0x64210a21, 0x78a21800, 0x37338f09, 0x59594c04, 0x3d3e1e40, 0x00002829, 0x4c3d4446, 
-    0x31334c3e, 0x3c293c28, 0x2008484d, 0x29484d0d, 0x304b0720, 0x28534d24, 0x9b47cd20, 0x1f5c4d1b, 0x48ddfa21, 0x200820ce, 0xff0e0003, 0x04ba04e3, 
-    0x003b007b, 0x00680058, 0x120f40b9, 0x29010701, 0x36030401, 0x0400022a, 0x06b96603, 0x010c242d, 0x04030009, 0x08610309, 0x56070701, 0x0b270754, 
-    0x04040206, 0x18055b00, 0x2409b842, 0x4058503e, 0x832b8821, 0x221c831f, 0x8a5f0004, 0x4c072736, 0x0229401b, 0x12820101, 0x07010923, 0x232d8c63, 
-    0x57040000, 0x2708558a, 0x594f0004, 0x59234059, 0x013c3d59, 0x59685900, 0x4a626468, 0x3d583c48, 0x252f3158, 0x191d1e23, 0x000d0f17, 0x0d3b013b, 
-    0x2c09b24d, 0x37023e34, 0x3233013e, 0x3e171617, 0x21098601, 0x41181511, 0x3629075c, 0x15373637, 0x0e07010e, 0x06884401, 0x27210b84, 0xe6a71832, 
-    0x23620808, 0x0e070622, 0x1e141503, 0x011e1702, 0x37013c01, 0x34353436, 0x22232627, 0x011d0607, 0x81637101, 0x0b292d29, 0x2b142016, 0x3f5a6186, 
-    0x34112f40, 0x2b4e2121, 0xfe4848ad, 0x4e193215, 0x214a253c, 0x411e2e42, 0x28491b1a, 0x23235233, 0x381e1a3d, 0x2b4a201e, 0x0f0a2967, 0x1514050b, 
-    0x37334715, 0x0b831344, 0x0b057e08, 0x47160a0f, 0x0101d302, 0x57562828, 0x481d2726, 0x9edb4842, 0x566e8954, 0x1f454621, 0x311d4020, 0x760f1111, 
-    0x5acefe77, 0x2449a254, 0x1a0e0d24, 0x2117ac33, 0x120b0908, 0x242f1010, 0x110f2f26, 0x15549810, 0x476d533b, 0x3030ab8a, 0x15282b28, 0x4c73543a, 
-    0x3c54704a, 0x02262e15, 0x0a0f0516, 0x98020a0a, 0x45444343, 0x02002b9e, 0x56febe00, 0x7b045404, 0x27001700, 0x15b6d600, 0x1b491802, 0x5320200a, 
-    0x052a055d, 0x005b0105, 0x4b440101, 0xb0440106, 0x4b422106, 0x0852c218, 0x58501327, 0x05001c40, 0x07d05605, 0x35202393, 0x4ba32382, 0x27823e20, 
-    0x40821e20, 0xa2180020, 0x3c2107eb, 0x1859824b, 0x20091d49, 0x0543583e, 0x1214a318, 0x85590321, 0x82592090, 0x0f403000, 0x1f211819, 0x27192718, 
-    0x10242815, 0x58180807, 0x16300847, 0x15011e17, 0x23060710, 0x26272622, 0x01231127, 0x0e485818, 0x12a7be38, 0x654c4c2f, 0x3a3aa064, 0xca747439, 
-    0x4e255439, 0xc901b92b, 0x00824386, 0x45868622, 0x043b0082, 0x2b548f60, 0x4f4f4e2b, 0xedfe89d9, 0x15179c9b, 0xc9fd512d, 0x6d6d2902, 0x4f6dd6d6, 
-    0x534107ba, 0x1f062707, 0x27001700, 0x53418800, 0x07074109, 0xd68a3b20, 0x41132f41, 0x308b1007, 0x4a18e885, 0x30410a20, 0x2628820b, 0x033e0303, 
-    0x4159594c, 0x51181305, 0x05410c9e, 0x41b92019, 0x06231e04, 0x41b2fd1f, 0x00332105, 0x89000200, 0x1f0452fe, 0x1a007704, 0xd6002c00, 0x420016b6, 
-    0xd2570c5b, 0x0a5b4206, 0x005b0024, 0x5b420000, 0x07524412, 0x8d05975a, 0x05534123, 0x53414ba1, 0x03002408, 0x68630004, 0xd84205f5, 0x14534108, 
-    0x5b422887, 0x1b1c320d, 0x2c1b2426, 0x15112c1c, 0x0807242a, 0x0e252b18, 0x05504201, 0x097e4118, 0x011e1726, 0x11333717, 0x080fa618, 0x08094377, 
-    0x1666034e, 0x674d293a, 0x353ca15f, 0x3a3b393f, 0x4c6663a0, 0x12173d26, 0xf1feb9a7, 0x44236642, 0x42652344, 0x44444385, 0x40288b43, 0x504c2d17, 
-    0x8693d247, 0x4e4e50de, 0x2a3f162b, 0x02f6f98f, 0x6e383629, 0x386ed5d4, 0xd56e6d35, 0x006d6ed5, 0x01370082, 0x00002e01, 0x7b044704, 0xa4001600, 
-    0x010b0b40, 0x020c0002, 0x58020302, 0x1520075e, 0x2105c243, 0x45430202, 0x054f6809, 0x58501327, 0x02001140, 0x07b74302, 0x015c0020, 0x82352007, 
-    0x20359818, 0x8b1c843e, 0x5b00204d, 0x182808dc, 0x03020000, 0x01005500, 0x01220682, 0x78826302, 0x00590323, 0x06d85b03, 0x2814b628, 0x08041024, 
-    0x4b542b18, 0x1e172507, 0x26151701, 0x08053d45, 0x2311152a, 0x12a72e01, 0x835e5f2f, 0x3a1d3c44, 0x3e3f391a, 0x5b5bab49, 0xdb6004b9, 0x113f4077, 
-    0xbc121b08, 0x6c15152e, 0xd3fdcd6b, 0x00215582, 0x21f38502, 0x5d828a06, 0xda00152d, 0x010c0b40, 0x060d0204, 0x87040502, 0x002022f5, 0xa4ed1800, 
-    0x02022209, 0xe04e183c, 0x053a210d, 0x2007d655, 0x0963491b, 0x04040022, 0x1807855a, 0x18084ace, 0x9411f476, 0x09285249, 0x12695318, 0x82005921, 
-    0x2170827f, 0x195b2240, 0x0504230b, 0xbd825502, 0x03050424, 0x20826404, 0x00590524, 0x4b590205, 0x13092306, 0xbe182325, 0x01220813, 0x2a580723, 
-    0x144f1806, 0x11240807, 0xc6360323, 0xef9abbfe, 0xbb2d12a7, 0x36764389, 0xad49793c, 0x8a06b9b5, 0xdbb288fe, 0x24228274, 0xd72a2ebc, 0x41052841, 
-    0x89340727, 0x18000600, 0x0f40e400, 0x00020102, 0x0305010f, 0x06020910, 0x08626c18, 0xd5182120, 0x03210c94, 0x21e28203, 0x46180505, 0x3a210963, 
-    0x072c4106, 0xbd181c20, 0x00220aaf, 0x997b0505, 0x182d8205, 0x2007787b, 0xd3761835, 0x204b9411, 0x8b278f3e, 0x5903226e, 0x82828200, 0xd6761873, 
-    0x05032c0d, 0x00550306, 0x06050004, 0x82640504, 0x59062521, 0x06030600, 0x23057c5a, 0x2325130a, 0x0f22be18, 0x21103441, 0x795a5101, 0x41e72006, 
-    0x89250e37, 0x88fef5f5, 0x0c3941b1, 0xe4000235, 0x4704e0fd, 0x11007b04, 0xcb001500, 0x01080b40, 0x43090002, 0x1c200b55, 0x82093963, 0x155c43e2, 
-    0x43085d63, 0x439f1663, 0x8205da7d, 0x050423f2, 0x7143005d, 0x43202015, 0x04220b6b, 0x76180300, 0x402714b0, 0x13111109, 0x59102325, 0x1724055c, 
-    0x3233013e, 0x08615118, 0x17231127, 0x01230333, 0x0d13412e, 0xbbef1425, 0x41600492, 0x735a0b12, 0xffd53207, 0x040604e3, 0x0044007b, 0x280f4079, 
-    0x29020301, 0x73a31807, 0x4b442217, 0x73a31800, 0x21cf830d, 0xa3180013, 0x44220e73, 0xa3184c03, 0x2f292173, 0x0e21232d, 0x0144000c, 0x072b6144, 
-    0x27012e27, 0x17011e35, 0x27cb821e, 0x35013e37, 0x022f2634, 0xa3181282, 0x5c440a70, 0x05246005, 0x14150623, 0x202a8216, 0x70a3181f, 0x4e79080b, 
-    0x272b5d2c, 0x5a403569, 0x2e562e2b, 0x20234479, 0x45087f76, 0x4928754b, 0x9e393637, 0x2a562b62, 0x502a5326, 0x2e51284f, 0x3e1f5d3a, 0x6b171717, 
-    0x66484a63, 0x393d4622, 0x091da33d, 0x111c0808, 0x0c2320be, 0x1a320e0d, 0x57462446, 0x0f0e021a, 0x80492832, 0x2e2b7c51, 0x08080829, 0x2eb41119, 
-    0x140c0b17, 0x23542914, 0x2312123a, 0x340e0e13, 0x567f4d26, 0x2e302d7f, 0x2e008200, 0xffd50002, 0x060604e3, 0x00030089, 0x18990034, 0x5e126fa3, 
-    0xa3180bfd, 0x44220a44, 0xa318004b, 0xfb6b0d44, 0x0603210f, 0x0c44a318, 0x2407a050, 0x00720001, 0x26478301, 0x03050004, 0x18630504, 0x2d1244a3, 
-    0x04051140, 0x1d1f2325, 0x3404090b, 0xf46e3405, 0x22133609, 0x16352726, 0x023e3233, 0x022e3435, 0x032e022f, 0x33363435, 0x058d4432, 0x08095841, 
-    0x0e141560, 0xc60e0302, 0x569abbfe, 0xcd6ab557, 0x425f3daa, 0x5e3a1b22, 0x52450842, 0xd8224974, 0x51a1adce, 0x17f25a9d, 0x58731a17, 0x3d8c8a4a, 
-    0x8906a572, 0xd2fa88fe, 0x6abe2323, 0x2842301a, 0x242d3822, 0x100e020e, 0x3e624b35, 0xb442aea3, 0x23a52e2e, 0x2314123a, 0x9b1a0e11, 0x5b83537e, 
-    0x33410030, 0x00062209, 0xbb57184b, 0x012f2a07, 0x0e300506, 0x0d060402, 0x05cd7a01, 0x210c025f, 0xa3180205, 0x44200813, 0x0f13a318, 0x0cbb5718, 
-    0x12bea218, 0x18064421, 0x830bbb57, 0x00052120, 0x17bea218, 0x0812402d, 0x2a343607, 0x07131528, 0x184b084b, 0x4213bb57, 0x01213dac, 0x05ba4429, 
-    0xb3422f20, 0x05a87939, 0x42d2fa21, 0x21083dba, 0xfed50001, 0x04060475, 0x0064007b, 0x501840be, 0x51040501, 0x0503022f, 0x0202072e, 0x01011803, 
-    0xa2181702, 0xb44213ab, 0x18002006, 0x8a25aba2, 0x5302202d, 0x1a210781, 0xf7791800, 0xd7a21809, 0x1844200b, 0x3629aba2, 0x494b5557, 0x27293436, 
-    0x12141c1f, 0x2b140806, 0x14151601, 0x18060706, 0x442faaa2, 0x032d2c6c, 0x393d46c0, 0x21177450, 0x1e0f0b0b, 0xaaf1181e, 0x18082310, 0xd1410c0e, 
-    0x0f022a33, 0x7f567f4d, 0x1a143f2d, 0x9fa21833, 0x34e84119, 0x2a069b44, 0x0604e2fd, 0x30007b04, 0x18003400, 0x45279ba2, 0x511806ec, 0xa2180d26, 
-    0x4426189b, 0x401b4c03, 0xa2180021, 0x342d259b, 0x21313233, 0x07191b1f, 0x01300005, 0x06556830, 0x25279244, 0x23033307, 0x91444b02, 0xefbc2425, 
-    0x441d92bb, 0xa8302890, 0x0100a7fe, 0xe3ffbc00, 0x14067d04, 0xd1004e00, 0x2805696e, 0x0724380c, 0x06020103, 0x27048201, 0xb04b1b4a, 0x40585011, 
-    0x00241388, 0x1b4a0201, 0x22830e89, 0x85595921, 0x001b2e37, 0x5b040202, 0x3b040400, 0x0303004b, 0x053b473a, 0x09155718, 0x17204683, 0x012b228a, 
-    0x035b0001, 0x00000205, 0x824c0042, 0x82352065, 0x2b419c65, 0x03001b40, 0x03010001, 0x01007000, 0x01225582, 0x4c885f00, 0x594c0234, 0x11405959, 
-    0x33350001, 0x27292d2e, 0x4e000a0c, 0xe65e4e01, 0x35272209, 0xdaaa1816, 0x07eb4c12, 0xc04b3720, 0x34112109, 0x22065051, 0x47070617, 0xa9080b71, 
-    0x1415011e, 0x010e0706, 0x4822db02, 0x254a1720, 0x3c42444b, 0x231f5537, 0x19130f1d, 0x2f43314d, 0x17171644, 0x75272928, 0x3e3c0251, 0x39397970, 
-    0xa13569bb, 0x6a68d167, 0x54559a01, 0x2e110e0e, 0x634f3a1f, 0x341b1c1d, 0x1d9c373c, 0x12050606, 0x0f1fa40e, 0x1a17190f, 0x33202d44, 0x1d3a231a, 
-    0x20401b27, 0x3c2d4522, 0x3c2a2b6c, 0x39396b12, 0xfb8b4241, 0xd4710493, 0x6e333468, 0x3f0dd770, 0x291c623e, 0x14251814, 0x2c513225, 0x4a36632a, 
-    0x2d2b2f7e, 0x01000000, 0xfcff8300, 0xd5050804, 0x78001600, 0x02090ab4, 0x75544802, 0x04182605, 0x02010101, 0x058f6659, 0x05050022, 0x6e09056b, 
-    0x15280597, 0x01060500, 0x5f000500, 0x0124278a, 0x1b401b4c, 0x12823182, 0x01020523, 0x221d8261, 0x87570500, 0x0005363b, 0x4059594f, 0x14000113, 
-    0x0c0d0e12, 0x0607080b, 0x01160005, 0x05c94215, 0xbe6b2720, 0x37320806, 0x21152111, 0x16171411, 0x2315013b, 0x56ce2703, 0x01d5fe55, 0xa201b82b, 
-    0x2e2f5efe, 0x04e1cf76, 0x02cc5253, 0x25018f64, 0x8f8bfe50, 0x327b9cfd, 0xc38b9331, 0x9e002027, 0x020e0fb4, 0x27c38604, 0x02010722, 0x09010108, 
-    0x06268b82, 0x04030301, 0x3b5b0559, 0x09092405, 0x770a5b00, 0x1f200ce5, 0x00212989, 0x221a8209, 0x8a5f0009, 0x82032031, 0x822520d7, 0x2312823b, 
-    0x61030402, 0x00242b8b, 0x00570900, 0x09204f86, 0x1b2ce184, 0x1c1e0001, 0x14151617, 0x10111213, 0x0a21e882, 0x35ea8209, 0x1f012000, 0x2b14080b, 
-    0x022e2205, 0x3523013d, 0x35213533, 0xed841121, 0x15331527, 0x1e141523, 0x25f18502, 0x285a8f68, 0xf488e5e5, 0x16e5e525, 0x823b5032, 0x58272af7, 
-    0x8eed668c, 0x2f018fe9, 0x26f98246, 0x3eed8ee9, 0x82173455, 0x410220fb, 0x062b05bf, 0x00030092, 0xb6940019, 0x18020d0e, 0x280992cd, 0x00000020, 
-    0x01000401, 0x24fd8c61, 0x5b020707, 0x0c856f08, 0x27871d20, 0x08070026, 0x02070201, 0x2320fb8f, 0x03411f87, 0x04072a05, 0x07006103, 0x57070202, 
-    0x2a4b8600, 0x594f0207, 0x05154059, 0x82161804, 0x0c0f34f4, 0x04090a0b, 0x11190519, 0x16080910, 0x0333012b, 0x41221323, 0x032513e1, 0x9a71c634, 
-    0x0fe44138, 0xfe920625, 0x41e2fa88, 0x320812e8, 0xfe830001, 0x05080485, 0x002900d5, 0x171040c3, 0x01030211, 0x03020110, 0x25264a02, 0x4b480502, 
-    0x585017b0, 0x07082240, 0x05040402, 0x05010659, 0x834b3c05, 0x005924b8, 0x4a3a0101, 0x00200531, 0x4e07b57e, 0x032105d1, 0x203c8200, 0x2030955f, 
-    0x07754701, 0x43831d20, 0x01000324, 0x2e910061, 0x1b4c0424, 0x69822340, 0x00234283, 0x89610405, 0x2d40182a, 0x82002008, 0x594f2562, 0x10405959, 
-    0x292e1c82, 0x11132900, 0x1125241c, 0x1b080924, 0xe842012b, 0x5d1e2007, 0x272c0543, 0x33011e35, 0x34353632, 0x2627022e, 0x280b2f41, 0x2e2f6602, 
-    0x30c2cf76, 0xc7a4182c, 0x12082508, 0x4186151e, 0x21071c43, 0x0a43d103, 0x5d383105, 0x185a5533, 0x2f0f1183, 0x28210f2b, 0x3f0f1f30, 0x300a2d43, 
-    0x00010000, 0x04e3ffc3, 0x005e041b, 0xb5b00018, 0x0a2b6715, 0x0103172e, 0x4b3c0101, 0x3a040400, 0x0202004b, 0x0b885c18, 0x58501124, 0x1e861340, 
-    0x04201983, 0x9a0d6e45, 0x823e2039, 0x00142839, 0x00010502, 0x82600002, 0x5901215a, 0x042a4684, 0x1a401b4c, 0x00040200, 0x0f825702, 0x00040025, 
-    0x87610401, 0x00022173, 0x2e05b773, 0x14000111, 0x0d111213, 0x0005060b, 0x45180118, 0x27260586, 0x33113526, 0xed4c1411, 0x83362005, 0x232f080b, 
-    0x06070627, 0x54ab1602, 0x1a36b854, 0x45823c4f, 0x12a7b945, 0x1d555332, 0x02e47071, 0x984afdb6, 0x5c252246, 0x7902ab5b, 0x62a8a2fb, 0x82003231, 
-    0x41022000, 0x062c0503, 0x0003006c, 0xb5e5001c, 0x03040119, 0x2107106e, 0x2d510022, 0x01052209, 0x05836a03, 0x824b3a21, 0x5c0223ba, 0x81180107, 
-    0x112007da, 0x0d276418, 0x04252886, 0x065c0204, 0x255c1807, 0x0aa3640c, 0x3e204d99, 0xa3644d82, 0x0400210a, 0x04276882, 0x06006002, 0x84590306, 
-    0x7a062035, 0x545108ce, 0x02062306, 0x19825704, 0x02060025, 0x87620603, 0x0204219b, 0x2e053841, 0x18040513, 0x11151617, 0x04090a0f, 0x5d1c051c, 
-    0x3321065b, 0x06804301, 0x25133e41, 0xbbfec6f4, 0x43413b9a, 0x6c062510, 0xeffa88fe, 0x41184841, 0x062c0947, 0xef001f00, 0x01040a40, 0x011c0001, 
-    0x64097a52, 0x06200b5b, 0x2a057645, 0x4b3a0707, 0x03050500, 0x1801085c, 0x2007397d, 0x25fe8811, 0x04010102, 0x29867201, 0x07212483, 0x5f7d1808, 
-    0x0fab6408, 0xab644f99, 0x05002c0f, 0x05030108, 0x07006003, 0x84590407, 0x4c072436, 0x1825401b, 0x240b7a56, 0x05030705, 0x251a8257, 0x04030700, 
-    0x9f876107, 0x41030521, 0x142e0550, 0x1a1b0708, 0x12141819, 0x1f070c0d, 0xa9641f08, 0x05d5440d, 0x64135441, 0xed20069d, 0x21145641, 0x5841f5f5, 
-    0x42032019, 0x102c069f, 0x17000b00, 0xfe003000, 0x06012db5, 0x08346918, 0x020a2523, 0x0a3e7c09, 0xe3440720, 0x08082805, 0x06004b3a, 0x185c0406, 
-    0x240933ea, 0x40585011, 0x832c9421, 0x0b082227, 0x5cea1802, 0x2055a80b, 0x2255823e, 0x82060022, 0x04062266, 0x245d8d60, 0x05080800, 0x248f8459, 
-    0x401b4c08, 0x25098220, 0x05040800, 0x2d946108, 0x90690020, 0x64212005, 0x2c2b05e2, 0x25292a2b, 0x181d1e23, 0x64301930, 0x0d4429e2, 0x0dd66416, 
-    0x7f41a320, 0x0fcb6410, 0x4417e042, 0xe4200d27, 0x430c2744, 0x264424d8, 0x4461208b, 0x03212826, 0x17574122, 0x01c61725, 0x41469a19, 0x2644104f, 
-    0x01003d1e, 0xe3ff2700, 0x7104aa04, 0x0f012600, 0x011e0e40, 0x01090306, 0x010c0600, 0x4a030004, 0x2f05f34b, 0x0006001f, 0x00060400, 0x02050764, 
-    0x4b3c0303, 0x2405ae47, 0x5c020404, 0x0b734500, 0x268f1b20, 0x01040431, 0x0101025c, 0x4c013a01, 0x1ab04b1b, 0xa2405850, 0x82352049, 0x87232026, 
-    0x07002649, 0x054b3c07, 0x20749601, 0x202a823e, 0x252a8820, 0x04020004, 0x31846002, 0x01010022, 0x82069c45, 0x26402679, 0x07030700, 0x20278972, 
-    0x069f4501, 0x03020123, 0x05784101, 0x50213983, 0x25008359, 0x22140b40, 0x01822313, 0x08082523, 0x0a3b651c, 0x27231126, 0x2223010e, 0x2605e046, 
-    0x36323316, 0x18331135, 0x3a09b6a4, 0x55090b96, 0x233b1f59, 0xa83112a7, 0xb8a7ac73, 0x8983706b, 0x2a2533b9, 0x65851e2e, 0x1139062f, 0xa8dffc14, 
-    0xe5e06461, 0x4afdb602, 0xacb68e97, 0x1abd7902, 0x3e3e3638, 0x074f4400, 0x09826c20, 0x1b000726, 0x19b5e600, 0x650a4f44, 0x4b440a2c, 0x6509200f, 
-    0x1124082c, 0x1d405850, 0x86090b65, 0x06062528, 0x09085c04, 0xa40c4744, 0x0e7a654d, 0x09060027, 0x04060401, 0x0d3f4460, 0x6e892420, 0x08060025, 
-    0x44570604, 0x6222074f, 0x77820600, 0x50213284, 0x2f008259, 0x08091540, 0x15161718, 0x0c0d1012, 0x1b091b08, 0x41117965, 0x11240c53, 0x010e2723, 
-    0x20097365, 0x074c4182, 0x3112a725, 0x656c06a8, 0xef20066c, 0x240b4641, 0x61a8a2fb, 0x09374864, 0x00ba0529, 0x01170003, 0x4815b508, 0x21200a37, 
-    0x47093665, 0x112419e8, 0x1d405850, 0x36482890, 0x8225200e, 0x4a4da424, 0xa41805bf, 0x7f580aad, 0x0fab4805, 0x86053b57, 0x155b4826, 0xb34a2220, 
-    0x48042008, 0x32440b59, 0x4059300f, 0x14040513, 0x0e111213, 0x0408090c, 0x65170517, 0x132009b6, 0x2b0db742, 0x0e272311, 0x023d0101, 0xd9aafd56, 
-    0x240b5f41, 0xfa94ba05, 0x135a41bd, 0x0001002d, 0x0475fec3, 0x005e04b0, 0x44500128, 0x132a0513, 0x04050110, 0x03000102, 0x04820103, 0x01224a25, 
-    0x50490102, 0x1a870646, 0x1a8b0220, 0x30934020, 0x26075450, 0x04010621, 0x724b3c04, 0x05230500, 0x825c0305, 0x4b422d56, 0x00000107, 0x01005b01, 
-    0x4c013e01, 0x1d205a86, 0x26087e48, 0x01035c02, 0x8f3a0202, 0x50212324, 0x4da44058, 0x28823520, 0x61841e20, 0x5f010022, 0xde647e93, 0x001c2808, 
-    0x00030005, 0x87640305, 0x48a6822d, 0x022006aa, 0x26055d4c, 0x03020004, 0x8a610204, 0x01012227, 0x23101900, 0x5959380e, 0x00011540, 0x1b1d2021, 
-    0x12141718, 0x05070e0f, 0x28012800, 0x18140808, 0x210e3c7b, 0x67443523, 0x33112710, 0x1415010e, 0x40180416, 0x0b240779, 0x451f2919, 0x250a6844, 
-    0x38283003, 0xf418f0fe, 0x68440ac2, 0xa2fb280e, 0x2a225541, 0x4400002e, 0xd92a086b, 0x27001300, 0x1a013b00, 0x6b4439b5, 0x0029320a, 0x02030001, 
-    0x0a630301, 0x01090201, 0x00020500, 0x0f734463, 0x200dbf48, 0x48309825, 0x5dac12c3, 0x58503e24, 0x5d912640, 0x4407ab48, 0x2c200d8b, 0x93442893, 
-    0x0061210b, 0x21067b49, 0x93440406, 0x29213405, 0x01141528, 0x36373800, 0x2d303235, 0x293b282c, 0x181d1f3b, 0x6d09e7a4, 0x621805ba, 0xa4180923, 
-    0x032013e7, 0x21125343, 0xa4187802, 0x41201ed3, 0x210b6e43, 0xa418b404, 0xb42021bb, 0x48118e43, 0x032a07f7, 0x37002300, 0x35b58301, 0x69180801, 
-    0x2c210850, 0x072f7400, 0x4b666320, 0x4b413308, 0x07070109, 0x0a004b3c, 0x004b3a0a, 0x5c060808, 0x7818010c, 0x28200be6, 0x2e83339b, 0x020c0a22, 
-    0x11232f87, 0x93405850, 0x873b202f, 0x202f8e63, 0x932f8235, 0x922f8893, 0x823c2093, 0x8a292033, 0x82082093, 0x060821ae, 0x0ca04218, 0x070a0a23, 
-    0x22d48459, 0x521b4c0a, 0x272005eb, 0x0a784218, 0x02050b28, 0x03010703, 0x39870063, 0x40212e8b, 0x2329942d, 0x5708060a, 0x00255182, 0x0a07060a, 
-    0x07244162, 0x50060823, 0x31008459, 0x24251c40, 0x33340000, 0x2c2e3132, 0x37242829, 0x42183725, 0x0d2008a7, 0x24a74218, 0x20148045, 0xa942181f, 
-    0x427b2020, 0xe9200c2e, 0x19a84218, 0x42fafa21, 0x01291127, 0x00006400, 0x60046d04, 0xbba41800, 0x056d4514, 0x2008b958, 0xbba4180c, 0x183c2008, 
-    0x341fbba4, 0x4501bf64, 0xfebf4601, 0x6004ed72, 0xac0354fc, 0x0100a0fb, 0x21008200, 0x6b82d104, 0x60000c22, 0x0abba418, 0x10a1a418, 0x184b3c21, 
-    0x2009a1a4, 0xa1a4183e, 0x2b7e8414, 0x00010210, 0x00720001, 0x72010301, 0x69223083, 0xa4185959, 0x013111a0, 0x23010b23, 0x9da0c3b6, 0xfeb6c3a2, 
-    0xb2b3b0fa, 0x2c8f82b0, 0xfd420277, 0xfb8903be, 0xfd6602a0, 0x84d3829a, 0x6f062797, 0x10000300, 0xa0189300, 0xb04e0a37, 0x82012005, 0x02012221, 
-    0x52a41870, 0x4b3c210b, 0x9c523282, 0x6d3a2005, 0xa4180859, 0x033809c9, 0x03020502, 0x00007005, 0x00050106, 0x01045d05, 0x023c0202, 0x28401b4c, 
-    0x07139e18, 0x03271182, 0x6e030200, 0x82050300, 0x006e2602, 0x00050100, 0x24528755, 0x594d0500, 0xaf9f1859, 0x2301210e, 0x0735a118, 0x0327d084, 
-    0xbbfec634, 0x8ce5fd9a, 0x6f0625d8, 0xfc9788fe, 0x0624db97, 0x8a001300, 0x0f63a418, 0x1bc9a318, 0xa4183c20, 0x8f4f0a63, 0x0103340c, 0x03040072, 
-    0x06040306, 0x06010770, 0x01057106, 0x763c0303, 0x1b19057d, 0x1482098e, 0x0ec9a318, 0x1cc5a318, 0x0220d584, 0x21066e4f, 0xd790d7fe, 0x8ff5f521, 
-    0x000022d9, 0x054f4203, 0x00f20530, 0x0017000b, 0xb7d50024, 0x031a1d22, 0x44180507, 0x232807ad, 0x07040500, 0x70070504, 0x210be24e, 0xc6474b41, 
-    0x25a31805, 0x8722200d, 0x2016832a, 0x742f9271, 0xa318081a, 0x03220d4f, 0x1b190101, 0x57840841, 0x40212782, 0x2809822a, 0x04000500, 0x05007005, 
-    0x20028207, 0x1854846e, 0x840c389d, 0x00013534, 0x5959594f, 0x0c0d1d40, 0x23240001, 0x1e1f2021, 0x18191b1c, 0x180b3a4f, 0x421bd64b, 0x2e4f0c0f, 
-    0x8dfc210c, 0x240c3e41, 0x8e1e2805, 0x2002881e, 0x0e2042c8, 0x42000021, 0x1321a2ff, 0x0eff4233, 0x01c6d726, 0xe4fd9a19, 0xfe42e78c, 0x01002a13, 
-    0x00004c00, 0x60048504, 0xafa21800, 0xc9461816, 0x030d2f0f, 0x00020201, 0x00010159, 0x4c023c00, 0xe818401b, 0x12201681, 0x13afa218, 0xfe042308, 
-    0x2901cc6f, 0xfecf2701, 0xd5b8016f, 0xb9feb8fe, 0x024802d5, 0x016bfe18, 0xfde8fd95, 0xfec101b8, 0x0082003f, 0x68000126, 0x810456fe, 0x1f2a9382, 
-    0x0ab63f00, 0x01000207, 0xa1464a01, 0x02112605, 0x3c010101, 0x2124824b, 0xc4675c03, 0x22138307, 0x8a720100, 0x59670813, 0x121d1fb7, 0x08042016, 
-    0x33132b17, 0x3e373632, 0x33013701, 0x01330109, 0x0e07050e, 0x010e0703, 0x012b0607, 0x3e2d6db8, 0x27381614, 0x01c34ffe, 0xc347014c, 0x1b18d9fe, 
-    0x110a080f, 0x202b1e10, 0x36160715, 0x945c4527, 0x141bf0fe, 0x046c7017, 0x0394fc4e, 0x3e08fd6c, 0x1c152744, 0x6e512c2e, 0x260d2b49, 0x8227163b, 
-    0x85022072, 0x6e062dab, 0x22000300, 0x0eb65600, 0x0302020b, 0x1b20ad87, 0x23090266, 0x03030104, 0x022bb782, 0x005c0502, 0x053e0505, 0x8d401b4c, 
-    0x0302231d, 0x1d890072, 0x0a40592d, 0x16122022, 0x06101121, 0x822b1908, 0x012321b9, 0xc582c88d, 0x0e23c884, 0x6f012b01, 0xdd2006b1, 0x2136d090, 
-    0x070e1827, 0x1b212819, 0x1d341f0a, 0x94295623, 0x88fe6e06, 0xd38cfaf9, 0x3f66542e, 0x67461526, 0x3613344b, 0x13131033, 0x0020d282, 0x6f32d387, 
-    0x26000600, 0x0b405d00, 0x00010104, 0x03021013, 0x86410204, 0x541c2006, 0x6b5a0a58, 0x03032806, 0x06005c06, 0x82063e06, 0x231e8ed9, 0x00720403, 
-    0xda821e89, 0x18122f29, 0x10111221, 0x181b0807, 0x2007aca8, 0x20dd8403, 0x0ea64103, 0x2b20da82, 0x2005fe78, 0x24db837d, 0x211c190b, 0x09ae4114, 
-    0x1117133e, 0x0f120e0b, 0x191f281a, 0x64832c0c, 0xfe6f0694, 0xf9f5f588, 0x0b141bf9, 0x36513b26, 0x2d07b441, 0x202a3d30, 0x45273224, 0x14364c67, 
-    0xdf83514b, 0xb3410320, 0x06174505, 0x96003725, 0x6a1f22b6, 0x3a2406a9, 0x1f405850, 0x210b0979, 0x60594b41, 0x04042706, 0x07005c07, 0x4d183e07, 
-    0x1d230869, 0x84010103, 0x01052329, 0x24916300, 0x82204021, 0x04002513, 0x70040500, 0x0020288b, 0x592e4789, 0x0d1b4059, 0x3700010c, 0x21232435, 
-    0xd8441a20, 0x780a200c, 0x09421bf6, 0x0ad2420d, 0x210ce544, 0x0f4245fd, 0x11e04210, 0x210dfb44, 0x1a42c8f9, 0x12ee420c, 0x240a1b42, 0x00210003, 
-    0x49ef4255, 0x422f0921, 0x1a2406ee, 0x0133132b, 0x860fee42, 0x012b28e4, 0x1901c6e3, 0x9090fe9a, 0x1e1a35da, 0x0d090812, 0x1e2b210d, 0x8b2b0813, 
-    0x6f06945e, 0xf9f988fe, 0x2308ce8c, 0x172e4e43, 0x57222418, 0x0e27476f, 0x0000514b, 0xcb000100, 0x10040000, 0x09006204, 0x05b66400, 0x00020200, 
-    0x20071a47, 0x07505b15, 0x824b3c21, 0x59032116, 0x23082d6b, 0x4058503e, 0x0f0fa218, 0x18003c21, 0x34300fa2, 0xfd8302cb, 0xfd2d0395, 0xfc83027d, 
-    0x2503aabb, 0xdcfca893, 0x057b4396, 0x062d9384, 0x00030071, 0xb685000d, 0x04020409, 0x20958702, 0x6c45181f, 0x8295840c, 0x08a2189f, 0x0609510c, 
-    0x2107f649, 0xa1180400, 0x3c210c90, 0x6aa98202, 0x03250b98, 0x03040200, 0x12476802, 0x0d8da118, 0x18230121, 0x2709e39e, 0xfec64a03, 0x9afe9abb, 
-    0x0625c18b, 0xfb88fe71, 0x20c687b1, 0x05574102, 0x062fc382, 0xb8001000, 0x01020b40, 0x070c0002, 0x18030502, 0x220c0445, 0x82660004, 0x1802207d, 
-    0x200d1153, 0x86a11806, 0x125f6a09, 0x09955718, 0xf283278a, 0x70181d20, 0x43180bdf, 0x2e8508be, 0x2a33a118, 0xa1184020, 0x98651d31, 0xacfe2106, 
-    0xf521fb8d, 0x21fd8bf5, 0xff860000, 0x00f6052a, 0x0015000b, 0x0c11b6b4, 0x210ac341, 0x8f510620, 0x42412007, 0xc441085a, 0x503a240f, 0x411d4058, 
-    0x2e9306ba, 0x18086f4c, 0x2018e0a0, 0x2022823c, 0xe0a01840, 0x13402224, 0xdea01801, 0x1e1f2729, 0x1e1e911e, 0xff8b1bfe, 0x1e2a0524, 0x02821e90, 
-    0x4180fb21, 0x033207ff, 0xd5010e01, 0xf005c103, 0x38002800, 0xc7003c00, 0xa0180e40, 0x242507dd, 0x03060501, 0x05c5564a, 0x00252308, 0x05060001, 
-    0x0a630601, 0x09040501, 0x05070002, 0x07006300, 0x08070800, 0x0202005d, 0x03005b03, 0xc3184103, 0x2c280848, 0x00050400, 0x70000405, 0x0921348a, 
-    0x21339701, 0x2e883240, 0x0e42a018, 0x36886b82, 0x07080823, 0x2b0e1955, 0x1d403b0b, 0x0001292a, 0x393a3b3c, 0x38292f31, 0x2223382a, 0x0f111b1d, 
-    0x28000709, 0x694a2801, 0x26272105, 0x0d48a018, 0x06070625, 0x743e3507, 0x1e32065a, 0x23111501, 0x0e070627, 0x36322701, 0x013d3637, 0x19632223, 
-    0x168d0805, 0x21152107, 0x4c7e2302, 0xac5e5d4b, 0x23201cb6, 0x3b212d58, 0x22443e1d, 0x3f221f47, 0x2c57b126, 0x320e812b, 0x0f492140, 0x41205436, 
-    0x3e3d917f, 0xd22b1418, 0x64fd9c02, 0x4344ba02, 0x46478174, 0x18442c04, 0x0809141a, 0x0e7f2112, 0x07070616, 0x5e842b56, 0x417040fe, 0x77101121, 
-    0x73472325, 0x4d23221d, 0x27113124, 0x03007be1, 0xd501f400, 0xf005dd03, 0x29001500, 0x63002d00, 0x503ab04b, 0x071c4058, 0x01060201, 0x00020400, 
-    0x06574263, 0x0303002d, 0x01005b01, 0x4c034101, 0x5122401b, 0x268b07fb, 0x0e39c818, 0x17174036, 0x2d000116, 0x222a2b2c, 0x17291620, 0x000b0d29, 
-    0x08150115, 0x08656818, 0x3634352c, 0x33013e37, 0x16171632, 0x04411415, 0x013e2506, 0x2e273435, 0x080e0841, 0x845e6863, 0x32362f2d, 0x5b862f33, 
-    0x642f875a, 0x5b872f64, 0x1b1d5231, 0x4f1b391f, 0x3a396736, 0xef3a1d1d, 0x5cfda402, 0x313eba02, 0x5c629633, 0x3c343997, 0xbb70353c, 0x3c3470ba, 
-    0x24272775, 0x4e89496c, 0x4f4d2925, 0x276d458b, 0x007bdf4c, 0x00020000, 0x04000025, 0x00d505ac, 0x000a0007, 0x0109b572, 0x09c84504, 0x0c820520, 
-    0x04010224, 0x28826202, 0x034b1326, 0x14010101, 0x08c1e118, 0x01031526, 0x73010201, 0x0024228c, 0x1d401b4c, 0x00214e82, 0x231c8872, 0x55040202, 
-    0x35082382, 0x005a0204, 0x4e020402, 0x0d405959, 0x0a080808, 0x11110a08, 0x06061011, 0x33012b18, 0x21032301, 0x0b012303, 0xf5ee0101, 0x6ed1c901, 
-    0xd16cf5fd, 0xd5d51803, 0x2119d505, 0xa62010b7, 0x71205c82, 0x0e24ab82, 0x81001900, 0x20058364, 0x24c2821e, 0x05020405, 0x07375763, 0x064b1322, 
-    0x07fd1619, 0x18031421, 0x2007a6b8, 0x8225871b, 0x0300231b, 0xc57c0304, 0x01132108, 0x2220b382, 0x0124df82, 0x61010002, 0x0323258a, 0x87570403, 
-    0x03042248, 0x2db8824f, 0x180f100f, 0x10190f16, 0x11212619, 0xba820710, 0x21134708, 0x33112115, 0x011e1704, 0x29041415, 0x3e322501, 0x26343502, 
-    0xa611012b, 0x45fd8603, 0x657b01eb, 0xfcfe191c, 0x46fef3fe, 0x7c58ba01, 0xa99d244e, 0xa6d505ef, 0xbf0f3efe, 0xd3418635, 0x3f1ea6d0, 0x89934664, 
-    0x5749ddfd, 0x29db8705, 0x001d0012, 0xb5910028, 0x21190109, 0x13221ba3, 0xe582074b, 0x825b0121, 0x099341f5, 0x82061c21, 0x040524c5, 0x82630502, 
-    0x0100231c, 0x21190104, 0x132108a3, 0xa3211903, 0x1f153929, 0x2713141e, 0x1f281e25, 0x131a1c28, 0x2e1d141d, 0x16060820, 0x3221132b, 0x0787d518, 
-    0x0120ee84, 0x82058562, 0x891320ee, 0xba012ff8, 0x3f7ab272, 0x74498383, 0xf8fe2c51, 0xfa82f7fe, 0x8590b628, 0x4b69431e, 0x0241efeb, 0x62323908, 
-    0x9d865d8e, 0x653f0b14, 0xcec95287, 0x7a6f6d03, 0x1835523a, 0x39fd3efe, 0x2c091141, 0x00d70001, 0x05730400, 0x000500d5, 0x05e94151, 0xe1411020, 
-    0x02002309, 0xde441402, 0x00102508, 0x73020102, 0x01201c88, 0x1520e982, 0x13831285, 0x00005533, 0x00590100, 0x4d010001, 0x11b55959, 0x06031011, 
-    0x30cb8217, 0x23112115, 0xfd9c03d7, 0xd505cb2f, 0x00d5faaa, 0x2e6f8502, 0x03003c07, 0xe0000900, 0x5007b04b, 0x511d4058, 0x43820752, 0x004b1826, 
-    0x59020303, 0x132b7982, 0x0404004b, 0x1b4c0414, 0x180ab04b, 0x910e9ff4, 0xa3152021, 0xa0352046, 0x8e3a2046, 0x03042321, 0x8f887304, 0xf1820320, 
-    0x2307de48, 0x00720102, 0x02201c84, 0x55208b82, 0x0327ad82, 0x0203005a, 0x83594e03, 0x11b72100, 0x22080082, 0x19060510, 0x0333012b, 0x15210523, 
-    0x02231121, 0x9ae5bae8, 0x9c03b4fe, 0x07cb2ffd, 0x5ff8fe3c, 0x82d5faaa, 0x067f41ee, 0x00070728, 0x4b800007, 0x7f8208b0, 0x01001626, 0x66010000, 
-    0x00215382, 0x24218259, 0x03004b13, 0x05614303, 0x82076453, 0x0202217b, 0xba831c8f, 0x3a821520, 0x88821c82, 0x3e887320, 0xb5820220, 0x178a1a20, 
-    0x55201883, 0x02255782, 0x0002005a, 0x20b08302, 0x28ad83b6, 0x2b180604, 0x33132113, 0x24ab8211, 0x03f202d7, 0x25a782a7, 0x3201d505, 0xa78424fe, 
-    0x2100022e, 0xb004befe, 0x1200d505, 0x82002100, 0x38052942, 0x0301051e, 0x00510300, 0x59010606, 0x13010100, 0x0207084b, 0x04000003, 0x08b84159, 
-    0x1c269483, 0x00030400, 0x1b845504, 0x5d203084, 0x06203088, 0x21209b82, 0x06249b82, 0x61060100, 0x2b842084, 0x04190a86, 0x10220a7f, 0x9c821313, 
-    0x82122021, 0x18112ca9, 0x1b060910, 0x3233372b, 0x1935043e, 0x20098a04, 0x080a8201, 0x040e1449, 0x14150607, 0x104d2133, 0x10151a1e, 0x79540308, 
-    0xaac5fcaa, 0x42fe4b03, 0x0d0f0c08, 0x2f06020a, 0xac834daa, 0x015ac5be, 0xfed5fad2, 0xfe420114, 0x04ec01be, 0x4bd7fe81, 0x83a6b1b0, 0x080e0552, 
-    0x00000016, 0x82c50001, 0x824e20c4, 0x000b22eb, 0x27e98577, 0x0002001d, 0x03020403, 0x08de7318, 0x824b1321, 0x590526e3, 0x14050500, 0x07fc4405, 
-    0x24881a20, 0x2106d14a, 0xa4410101, 0x7b181905, 0x1906202f, 0x262d7b18, 0x0003003c, 0x432d010f, 0x2a20054b, 0x82084b43, 0x04062384, 0x53436105, 
-    0x0606280f, 0x07005907, 0x43071407, 0x18190758, 0xe5821a7b, 0x15232e8c, 0xad405850, 0x82352060, 0x2060aa31, 0x202e823a, 0x0b007724, 0x84050021, 
-    0x5a1119c3, 0x0313230d, 0x87821b4c, 0x22053856, 0x41720102, 0x18190677, 0x59241bdc, 0x110b4059, 0x10260085, 0x2b1c0608, 0x12193301, 0x79310e32, 
-    0xfe9ac5b8, 0xfd760369, 0xfd8e0254, 0xfcbf0272, 0x05a54377, 0xaa46fe25, 0x19aae3fd, 0x2808d315, 0x000b003c, 0x01230017, 0x056d414b, 0x82002b21, 
-    0x06082299, 0x287a1807, 0x4b18350c, 0x04050500, 0x04040059, 0x08004b13, 0x00590908, 0x09140909, 0x21076e41, 0x16190329, 0x308f1a06, 0x58501523, 
-    0x2063ae40, 0xac328235, 0x823a2063, 0x94262030, 0x6a161994, 0x0513220d, 0x6a16194c, 0x59592230, 0x6d161959, 0x1406211e, 0x19233019, 0x29192120, 
-    0x012e098f, 0x8f1e1e95, 0x1ef91e1e, 0x1e1e8e1e, 0xa7411afd, 0x5cb2180b, 0xaa9c210d, 0x3906b141, 0x00010000, 0x0400000f, 0x00d505c2, 0x40620013, 
-    0x0d10110c, 0x0306090c, 0x78490307, 0x020f2a08, 0x00000201, 0x04054b13, 0x07624502, 0x58503a24, 0x0f840f40, 0x85590021, 0x8203201d, 0x831620f5, 
-    0x0303230a, 0x12845500, 0x83590321, 0x03002220, 0x08dc824d, 0x1313093c, 0x11121212, 0x2b1a0606, 0x01330109, 0x01113311, 0x23010933, 0x23110703, 
-    0x23032711, 0xe1fe3f01, 0xbb1c01cf, 0xfecf1c01, 0xc53001e1, 0x59bb59de, 0x7b03c5de, 0xadfd5a02, 0x03845302, 0x85fca62c, 0xfeba8a02, 0xbad00130, 
-    0xb38276fd, 0xe3ff893a, 0xf0053704, 0x9c002e00, 0x011c1640, 0x011b0504, 0x01270403, 0x01040302, 0x01240482, 0x4a050100, 0x20059344, 0x0882721e, 
-    0x05040427, 0x0505005b, 0x05a26f1a, 0x00010624, 0xc2181b00, 0x1b200838, 0x01202588, 0x01211882, 0x4b9a1800, 0x041a2108, 0x2128d882, 0x04000500, 
-    0x63040503, 0x00282589, 0x00570100, 0x5b000101, 0x4f202e84, 0x1337e382, 0x1e200001, 0x11131719, 0x06080e10, 0x2e012e00, 0x2b140607, 0x6b262205, 
-    0x2b300a23, 0x32333501, 0x26343536, 0x07062223, 0x33013e35, 0x0807c348, 0x1415014d, 0x2902020e, 0x6767d663, 0xb2a960c4, 0x4c7a562e, 0x9b8c9a9a, 
-    0xbf4c8d92, 0x4ebc796c, 0x457cb06a, 0x9b948488, 0x1dc48747, 0x36c92426, 0x44889533, 0xa6274a6c, 0x796f7479, 0x20ba2a26, 0x92693920, 0x22a37e5a, 
-    0x6698c627, 0x823c72a3, 0x8b00219b, 0x1cbbf918, 0x034b1323, 0x0bb44801, 0x200a0a56, 0x1b0a5613, 0x1012112d, 0x2b180604, 0x01113313, 0x82231121, 
-    0xc38b2b04, 0x0001f801, 0xff08fec3, 0xf9180500, 0x3b2c16bb, 0x15000b00, 0x13b64c01, 0x0406020e, 0x2207b86a, 0x8201031d, 0x66013880, 0x01080200, 
-    0x00020400, 0x04010564, 0x074b1304, 0x14060601, 0x441b4c06, 0x1c200536, 0x2d821d88, 0x4b180122, 0x0e23238f, 0xa0405850, 0x82112048, 0x20489f24, 
-    0x2048a317, 0x20248235, 0x2288821c, 0x98720102, 0x923a20b5, 0x6fd38323, 0x132005c7, 0x4021d982, 0x21429122, 0x954c0606, 0x59062105, 0x04232b82, 
-    0x85594d06, 0x40260800, 0x15000117, 0x10111214, 0x090c0d0f, 0x03050708, 0x010b0002, 0x1406090b, 0x2720012b, 0x33011e33, 0x0e333732, 0x8b410501, 
-    0x68022f08, 0x7717defe, 0xa552640c, 0x9e0b771e, 0x9a4192fd, 0x49062b09, 0x6f3936f2, 0xfb747a78, 0xfb180433, 0x0220085d, 0x27052342, 0x03003b07, 
-    0xf9000d00, 0x095bfb18, 0xb8180520, 0x00210862, 0x27ec8201, 0x02020103, 0x01054b13, 0x2007654a, 0x201e8207, 0x0c8a4a1a, 0x0e20218f, 0x1120409d, 
-    0x352040a0, 0x3a20409d, 0x9a831e8d, 0x2105f671, 0xfb180413, 0x592d23bb, 0x09405959, 0x11121112, 0x06061011, 0x05e3461a, 0x26084441, 0xc5b87901, 
-    0x412ffe9a, 0x0724093b, 0x5ef8fe3b, 0x200b3741, 0xeb011901, 0x365e4321, 0x43121321, 0x3320095e, 0x27eb0119, 0x04000034, 0x003b07c9, 0x000f0003, 
-    0x0d0940fc, 0x0406090c, 0x66430204, 0x48172007, 0xa4410924, 0xc5c6410f, 0x41121321, 0x032209c6, 0x03190523, 0x02270a24, 0x9ae5babb, 0x19cb93fe, 
-    0x270b2a03, 0xf8fe3b07, 0x0268fd5e, 0x0a2d0319, 0x0100002e, 0x00000e00, 0xd5055004, 0x60001900, 0x23053346, 0x03030016, 0x2506ab4b, 0x02000000, 
-    0x2c45045b, 0x8213200c, 0x0201242e, 0x885f0200, 0x050a7d25, 0x0300012c, 0x61030100, 0x02020000, 0x37875700, 0x02002b08, 0xb759594f, 0x1a111118, 
-    0x19060510, 0x3e32372b, 0x033e3702, 0x11211135, 0x1d211123, 0x020e1401, 0x0e230607, 0x1f3e6047, 0x74820306, 0x2e032208, 0x0668fecb, 0x662b3219, 
-    0x5020a4fd, 0x7e2e6888, 0x014d9c92, 0x052bfaaa, 0x80b9fa2b, 0x329dc8ea, 0x82598277, 0x430019b3, 0x4b132126, 0x1520bb8d, 0x0224a382, 0x70020300, 
-    0xfb5b1683, 0x02132405, 0x19401b4c, 0x82244300, 0x211322bf, 0x05f94509, 0x11012323, 0x43001923, 0x00892123, 0x1b771119, 0x054b1323, 0x0b534801, 
-    0x12771119, 0x83031321, 0x7711199e, 0x1a062425, 0x4c33132b, 0x892509ec, 0xcb2902cb, 0x771119cb, 0xff752a11, 0x055c04e3, 0x000b00f0, 0x8356181b, 
-    0x821a2010, 0x02022491, 0x48045b00, 0x56180c1e, 0x1a201183, 0x23835618, 0x0c0d2108, 0x13150001, 0x1b0d1b0c, 0x0b000507, 0x06060b01, 0x22052b14, 
-    0x12101102, 0x11123233, 0x32270210, 0x0ebcfa18, 0xf1186720, 0x1d2412a9, 0x88017d01, 0x80290182, 0x79fe80fe, 0x80fe7afe, 0x8fe818a4, 0x05934411, 
-    0xd5054826, 0x55000700, 0x2005c342, 0x08da4e11, 0x250e2a53, 0x01010311, 0xf94e0102, 0x8616200d, 0x08f54e13, 0x02005924, 0xdb180200, 0x06270867, 
-    0x21132b18, 0x82112311, 0x03892203, 0x055141bf, 0x052bfa23, 0x06f34e2b, 0x0000c524, 0x7b827504, 0x13000a23, 0xcfeb1800, 0x4b132118, 0x180c2651, 
-    0x2316cfeb, 0x1b4c0413, 0x24cfeb18, 0x120b0c2d, 0x0c130b10, 0x20241113, 0x82170606, 0x04322b9e, 0x2b061415, 0x01231101, 0xf7523632, 0xc5210805, 
-    0x01fbb401, 0xeafdff01, 0x8db401ca, 0xea8e9b9c, 0xdee1d505, 0xa8fde1dd, 0x8693fe02, 0xcffd9286, 0x67331900, 0x001c310a, 0x0d0f4079, 0x19010201, 
-    0x0203020e, 0x0300011a, 0x098be418, 0x01020227, 0x0101005b, 0xb864181a, 0x09384a09, 0x03001323, 0x212c8204, 0xdd825f00, 0x02202585, 0x1920c182, 
-    0x08de4118, 0x156c6f18, 0x82151721, 0x000929bd, 0x051c011c, 0x052b1406, 0x14e71619, 0x3632212a, 0x010e1537, 0xe190e802, 0x14642c19, 0x16191d20, 
-    0x282109d7, 0x5b2c192a, 0x1801200e, 0x4208fbdc, 0x0221090f, 0x50ef8201, 0x2a510580, 0x503a2708, 0x00114058, 0xdd180003, 0x13210a77, 0x77dd1800, 
-    0x18062021, 0x2d1d77dd, 0x0400007c, 0x00d50595, 0xb65a0018, 0xf35f090c, 0x83352006, 0x0102246a, 0x5f130101, 0xae5108f3, 0x27838305, 0x0000000e, 
-    0x60030003, 0x01201f84, 0x23054a4c, 0x72010001, 0x03221582, 0x1c835700, 0x1f835c20, 0x59595028, 0x181228b6, 0x80820420, 0x32333724, 0x0f60023e, 
-    0x0139080a, 0x2b030e07, 0x286dcc01, 0x1126303f, 0xfe0b0b07, 0x3701d958, 0xfed53401, 0x21411e64, 0x53443717, 0x18ac9434, 0x10263f2d, 0x35041d1d, 
-    0x3e03c2fc, 0x8c4ed4fb, 0x29392333, 0x215e8217, 0xb3840002, 0x003b072a, 0x0124000b, 0x1518b66b, 0x0aef4818, 0xab4a2120, 0x0205270b, 0x01066400, 
-    0xc5820505, 0x5006ff5d, 0x07200522, 0x2025de82, 0x01080200, 0x4a218300, 0x279305af, 0x27820e20, 0x112050a4, 0x172050a6, 0x352050a7, 0x08d03a19, 
-    0x9705bf4a, 0x4b3a20c9, 0xe74a070c, 0x26278306, 0x07000400, 0x84600704, 0x4c0524d0, 0x8228401b, 0x010222e0, 0x08175f72, 0x0025f888, 0x04070704, 
-    0x061a5f57, 0x68070421, 0x592b062f, 0x00011740, 0x191a2224, 0x4a0e1617, 0x01201aca, 0x2f14d241, 0xdefe7c02, 0x630c7717, 0x771ea355, 0xbffd9e0b, 
-    0x4a1be141, 0xfa2107e8, 0x18ea4163, 0x00030038, 0x04000042, 0x00d5058f, 0x00240019, 0x406f002f, 0x24252f09, 0x9a62041a, 0x82352005, 0x181520fd, 
-    0x2008cc74, 0x05605563, 0x8b0bbe52, 0x0505231c, 0x21835902, 0x1b4c052a, 0x02001a40, 0x55020501, 0x48183a8c, 0x2108081c, 0x18110940, 0x10181111, 
-    0x2b1a0606, 0x35032e25, 0x37023e34, 0x1e153335, 0x0e141503, 0x23150702, 0x09820e11, 0x17021e24, 0x1b823e33, 0x022e4e08, 0x81030227, 0x2b2b68ad, 
-    0xcb82ad67, 0x2765ae87, 0x83ad672a, 0x305f53cb, 0x5f300c0c, 0x5f52cb53, 0x300d0d30, 0x0698525f, 0x80dea563, 0x5d9fd87f, 0x057a7a04, 0x7edba261, 
-    0x5c9fdc86, 0xb7049805, 0x9a6f440d, 0x6e9a6464, 0x440d0d44, 0x2509836e, 0x000d446f, 0xc6180001, 0xb54a1ecf, 0x12122636, 0x06041112, 0xcfc61818, 
-    0x00893336, 0x05440400, 0x001d00d5, 0x190a406c, 0x00010201, 0xc1180001, 0x142208cb, 0x1e820200, 0x63000223, 0x05374403, 0x2307824c, 0x4058503a, 
-    0xa7791b88, 0x04132c08, 0x1a401b4c, 0x02010103, 0x8b550104, 0x04250839, 0x01040059, 0x59594d04, 0x251511b7, 0x06052417, 0x0e012b19, 0x2e222303, 
-    0x33113504, 0x021e1411, 0x023e3233, 0x080a8237, 0x7903233f, 0x50515734, 0x5a68372d, 0xcb1e354b, 0x415d3c1d, 0x4745492e, 0x02cbcb2b, 0x11201a92, 
-    0x361e0906, 0x025b8259, 0x5419fe01, 0x060d3161, 0x02212714, 0x002bfa78, 0x00010000, 0x04befe64, 0x22c782a9, 0x4766000b, 0x1725057f, 0x05020500, 
-    0x25b88552, 0x02020104, 0x27825a00, 0x70501420, 0x00152108, 0x00211f82, 0x82198256, 0x5e052107, 0x01202784, 0x0121bf87, 0x82178372, 0x62002118, 
-    0x02220882, 0x0a825a05, 0x594e0526, 0x11094059, 0x10260083, 0x2b1a0606, 0xb0820129, 0x03822120, 0x23113336, 0x65fcff03, 0xcb2902cb, 0xd505aa86, 
-    0x2b05d5fa, 0x14fed5fa, 0x72249382, 0x60040000, 0x5c209384, 0x13219385, 0x20878204, 0x053b5b00, 0x95555483, 0x8210200a, 0x05002481, 0x855e0501, 
-    0x21a78222, 0x0a831940, 0x72000122, 0x05231982, 0x82550105, 0x83012006, 0x8f012034, 0x33132189, 0x05838584, 0xba722123, 0x210182e0, 0x878712fc, 
-    0x1f418b82, 0xfe5d2405, 0x82d104be, 0x000f228b, 0x2d8b856f, 0x02070019, 0x03055207, 0x13010102, 0x6a82064b, 0x210f2141, 0x21820017, 0x83560021, 
-    0x2108821a, 0x2a855e07, 0x1b4c0124, 0x0a831d40, 0x72010222, 0x1b821a84, 0x84620021, 0x5a07213f, 0x07210b82, 0x0fc3544e, 0x88012921, 0x24a2839e, 
-    0xfc270423, 0x41a58436, 0x3141092d, 0x00002406, 0x82890001, 0x824820a7, 0x000b22a7, 0x05675889, 0x05001826, 0x67050000, 0x1323fd83, 0x8202004b, 
-    0x010423a5, 0xc8410000, 0x05a74e05, 0x05000523, 0x581e9473, 0x1e83056b, 0x82020021, 0x02052334, 0xe7416200, 0x07495008, 0x00231d85, 0x87550200, 
-    0x0002215b, 0xea41c282, 0x11212d15, 0xfe130223, 0x2902cb76, 0xab76fecb, 0x2a066341, 0x00befe2b, 0x002e0002, 0x824f0400, 0x001122b7, 0xede41819, 
-    0x061a2e07, 0x02000501, 0x61020501, 0x00040400, 0x12355d5b, 0x8e821a20, 0x73010222, 0x04202791, 0x0c88f218, 0x00050424, 0x24826304, 0x05020223, 
-    0x3a068257, 0x00590205, 0x4d020502, 0x0e405959, 0x19121212, 0x11221812, 0x07291111, 0x182b1906, 0x8207a8eb, 0x113f08a8, 0x01230121, 0x06222111, 
-    0x01211015, 0x5067369f, 0xbe814231, 0xcbd2017b, 0xa2fedefe, 0xfe5603d6, 0x019790f9, 0x149a021f, 0x5b855e3d, 0x396d9f67, 0x77022bfa, 0x1d0389fd, 
-    0x88871202, 0x8200fdfe, 0x0b574ad3, 0x35427320, 0x00012607, 0x04010304, 0x25cd8463, 0x03030105, 0x574a5c02, 0x0016210c, 0x1b822086, 0x03020024, 
-    0x28836002, 0x925a0020, 0x823e850a, 0x0202231d, 0x40875703, 0x50020322, 0x544acd83, 0x21243207, 0x17060610, 0x1133132b, 0x15163233, 0x21230414, 
-    0x08544a25, 0xfdeaca3e, 0xfbfffeff, 0xb4014cfe, 0x8d9c9b8e, 0xfdd505ea, 0xdedde1a8, 0x8692a6e1, 0xcffd9386, 0x342ab783, 0x89040000, 0x0c00d505, 
-    0x175e1500, 0x08844911, 0x8724175e, 0x20c1832d, 0x23da8222, 0x00010200, 0x281e175e, 0x12140d0e, 0x150e150d, 0x06175e24, 0x35210123, 0x26c79121, 
-    0xfbfe3901, 0x858acf01, 0x01ac22cb, 0x23cb8354, 0xaa2b058a, 0x0322cc8d, 0xcb824100, 0xcb826e20, 0x12000e26, 0x80001d00, 0x20058541, 0x07ba611b, 
-    0x0001032b, 0x074b1300, 0x02050501, 0x0d684e5c, 0x22871c20, 0x02231c82, 0x4e570502, 0x2f84056f, 0x0982cb84, 0x00020123, 0x88258e55, 0x02052849, 
-    0x40595950, 0x5d131410, 0x112705f3, 0x10212811, 0x41190608, 0x1e2b0592, 0x0e141502, 0x01212302, 0x5e231133, 0x320809e6, 0x615bca41, 0x454479a5, 
-    0xfe60a579, 0xcb6203db, 0x33c3fdcb, 0x78254058, 0xd5055b78, 0x7039a8fd, 0xa86e6ea7, 0xd5053970, 0x1fa62bfa, 0x864b6a44, 0x6ccffd93, 0xdf82070f, 
-    0x32002524, 0xdd858a00, 0x16822020, 0x02000727, 0x04006307, 0x06055004, 0x02060826, 0x5b030000, 0x200dac4e, 0x8327871d, 0x221a821d, 0x885f0300, 
-    0x4c042431, 0x8225401b, 0x020424dc, 0x8b610401, 0x03032327, 0x4d895700, 0x4f030022, 0x1129e682, 0x2f312627, 0x32273226, 0x26e68219, 0x0609101a, 
-    0x50352b1a, 0x24560927, 0x020e2505, 0x2311012b, 0x21053050, 0xf686010e, 0x14832e20, 0x5d472708, 0x03061d3a, 0x02010303, 0x8f481520, 0x72484773, 
-    0xaccf488f, 0x2b321a06, 0x0376a131, 0x3b4e2d40, 0x4f392021, 0x4f50152f, 0x060f410b, 0x3971a739, 0xa0fa2b05, 0x9dcaf38c, 0xa63c3b34, 0x44684624, 
-    0x26496943, 0x8200cffd, 0x00023200, 0x0400002c, 0x00d505d1, 0x00230016, 0x20b04beb, 0x056e5550, 0x05010833, 0x63050107, 0x00000102, 0x01094b13, 
-    0x5c040707, 0x081d5406, 0x24822820, 0x0800222a, 0x57080105, 0x00010103, 0x61202983, 0x35202995, 0x23222982, 0x2b820300, 0x63080323, 0x5a2a9c00, 
-    0x2a8e05ef, 0x07010926, 0x57070404, 0x00217a83, 0x24628459, 0x401b4c00, 0x2309822a, 0x55000403, 0x2d86588f, 0x0720ae88, 0x3206f974, 0x22171812, 
-    0x18231720, 0x28111123, 0x10111121, 0x501b060a, 0x78410743, 0x4221200a, 0x3e080768, 0x012b022e, 0x01ba2c11, 0x5a15ba8b, 0x483a6a93, 0xcf488f72, 
-    0x03ba75fe, 0x3b4e2d14, 0x4f391f21, 0xd5051530, 0x64029cfd, 0x6b36a8fd, 0xb0796aa0, 0xc7023772, 0x23a639fd, 0x42456846, 0x4e274969, 0x4a290973, 
-    0x3100f005, 0x0f407900, 0x41ec181c, 0x00162813, 0x5b020303, 0x58020200, 0x8d5006ac, 0x8b4f180d, 0x521a2010, 0x49180580, 0x00200896, 0x82079c58, 
-    0x00012837, 0x4059594f, 0x1800010f, 0x4e0926ec, 0x98580573, 0x182f200b, 0x181b61f1, 0x182822ec, 0x202a1dec, 0x3ea28200, 0xe3ff8100, 0xf0052704, 
-    0x98002100, 0x010c1240, 0x010d0102, 0x011f0203, 0x01200405, 0x59040500, 0x04240abf, 0x61040305, 0x2008604f, 0xdb47184b, 0x0dbf5908, 0x05212585, 
-    0x4f3c8206, 0x21200e8e, 0x860a8e4f, 0x00002125, 0x12e74718, 0x171b1d2d, 0x10141516, 0x00090b0e, 0x59210121, 0x3c0805bf, 0x3502012e, 0x013e1234, 
-    0x15173233, 0x0e222326, 0x15210702, 0x33031e21, 0x15373632, 0x90dd0206, 0x52519be0, 0xb08fe09b, 0x60bb989a, 0x0c315886, 0x88fd7302, 0x91603102, 
-    0x4aaa5863, 0x07a34f9a, 0x69c72132, 0x447dcf52, 0xaa81c484, 0x4f8dc171, 0x52cf3e3f, 0xa9209282, 0x4f20ff82, 0x2220ff82, 0x172fff83, 0x16050401, 
-    0x03040301, 0x02020101, 0x8b010001, 0x010224ff, 0x18610203, 0x5a0779ba, 0x61211cbf, 0x23bf5a00, 0xbf5a2582, 0x181a2d14, 0x0d0e1214, 0x05070b0c, 
-    0x22012200, 0xbe5aff85, 0x3e230805, 0x35213702, 0x23032e21, 0x35070622, 0x1e323336, 0x14151201, 0x01010e02, 0x4b9ab0f3, 0x906255ac, 0x82033260, 
-    0x732d08f7, 0x8257340f, 0x4ca8615d, 0xe18eb09a, 0x9b51529b, 0xcf521de0, 0x8b4d3e3f, 0x8aaa74c2, 0x3e3d7fc7, 0x6952cf3f, 0xb8dffec7, 0xc6e1feb7, 
-    0x24838268, 0x0000c900, 0x1f241904, 0x4b132116, 0x081f2419, 0x20093d60, 0x26138414, 0x035d0500, 0x4d010101, 0x2419057d, 0x06252a1f, 0x21372b1a, 
-    0x5dc98211, 0xc9270532, 0xc7fe3901, 0x19fe3d03, 0x20101f24, 0x22978503, 0x5e003c07, 0x282005c7, 0x2005905a, 0xab981825, 0x4b182c0b, 0x05050107, 
-    0x06005906, 0x194b1306, 0x5e077a21, 0x21190ac1, 0x2a9015f8, 0x58501523, 0x2057a840, 0xa62c8235, 0x4f3a2057, 0xb28406ee, 0x00010623, 0x19a28263, 
-    0x200d5022, 0x50221913, 0x5e59202d, 0x1f193ba4, 0x5d200cf2, 0x200ba45e, 0x3c1c1956, 0x01d1180c, 0x39fa2a0c, 0xaaaa8104, 0x00aa7ffb, 0x271c1901, 
-    0x00172d08, 0x060a4074, 0x05020101, 0x02010001, 0x29062344, 0x02020016, 0x03005903, 0xdb5d1303, 0x172e4505, 0xa2532587, 0x054f6a05, 0x450b0b43, 
-    0x12290b2e, 0x0a0f1011, 0x01170008, 0x052e4517, 0x43022e21, 0x33080709, 0x35211135, 0x0e141121, 0x32fa0102, 0x3765605f, 0x4570bf5c, 0xfe1a3b60, 
-    0x32470283, 0x0a1dab6d, 0xec182315, 0x51235151, 0x44036587, 0x8b12fcaa, 0x00397cc4, 0x01300082, 0x0000dcff, 0xd7056f04, 0x7b002c00, 0x050106b5, 
-    0x083f8618, 0x03001a26, 0x03040500, 0x24055247, 0x01005901, 0x05356801, 0x2a05d565, 0x4058503a, 0x0401061a, 0x91730405, 0x4c002427, 0x861f401b, 
-    0x0133081c, 0x03000102, 0x00610001, 0x03050503, 0x03030057, 0x05005b05, 0x594f0503, 0x190a4059, 0x114b1823, 0x06071011, 0x23132b1b, 0x21152135, 
-    0x37013e11, 0x6937033e, 0x1e2707e8, 0x15161701, 0x5e112311, 0x0e24059a, 0x010e0701, 0x5f080e82, 0x6003d8b4, 0x251643fe, 0x0909071a, 0x973e0b0c, 
-    0x4e0e150d, 0x0e092b7f, 0x6ccb5502, 0x2c5c3276, 0x210e1f17, 0x2d05cb24, 0xf3fdaaaa, 0x040e1b19, 0x07060504, 0x01010b24, 0x11082a2a, 0xfee47004, 
-    0x9ace0118, 0x0b14168b, 0x8b281115, 0x006ffe54, 0x50000200, 0xa904e3ff, 0x1600f005, 0x36012a00, 0x2805397f, 0x00040029, 0x01040601, 0x05c04161, 
-    0x83070721, 0x1a052eb7, 0x0202004b, 0x01094b14, 0x5b000606, 0x088d5708, 0x58501124, 0x30882140, 0x49070721, 0x13200594, 0x02232786, 0x5f000208, 
-    0x132006d5, 0x25202882, 0x55942892, 0x2c823520, 0x3a2086ac, 0x26203082, 0xa3825d87, 0x0623a082, 0x8b005f00, 0x059042bb, 0x1b4c022c, 0x05002b40, 
-    0x05040700, 0x308a6307, 0x06000223, 0x068b5957, 0xe3886120, 0x4f000623, 0x3a008359, 0x17181b40, 0x22240001, 0x2a182a17, 0x0b0c1012, 0x0708090a, 
-    0x16000506, 0x560a1601, 0x2729072e, 0x11231123, 0x3e331133, 0x074a5803, 0x3e373622, 0x0a8db118, 0x1710113a, 0x64180316, 0x05336191, 0x6fcbcb6f, 
-    0x92613205, 0xc7c6ca65, 0x184a37c8, 0x173b0083, 0x2f6b394a, 0x1d2f3030, 0x0301b05b, 0x0566fda9, 0xa26ffdd5, 0xfe5daffe, 0x8279fe80, 0xa4813301, 
-    0xe4464746, 0x47e4abab, 0x8d8d4845, 0xb8feb7fe, 0xc3428d8d, 0xfed23405, 0x056f042a, 0x003f00d7, 0x250a40dd, 0x06070201, 0x43030101, 0x242a0787, 
-    0x02000700, 0x63020703, 0xca700106, 0x05966706, 0x24059543, 0x00000108, 0x08005119, 0x03002728, 0x03020102, 0x33937001, 0x41010121, 0x2e8505f3, 
-    0x58504924, 0x2e882540, 0x5c820520, 0x04050723, 0x20378761, 0x212c8b00, 0x279a2a40, 0x0808f346, 0x00010831, 0x594f0001, 0x17405959, 0x2f330005, 
-    0x21222324, 0x1d1e1f20, 0x090b1214, 0x3f053f00, 0x2b140609, 0x2e012a01, 0x17272301, 0x3233011e, 0x4335023e, 0x11200e18, 0x32194343, 0x02020e14, 
-    0x171a0b92, 0x4e030412, 0x430f0e07, 0x431a3a5e, 0xe2220a2b, 0x50436a03, 0x72333015, 0x012afeb6, 0x0111b501, 0x88512201, 0x43a00165, 0x61430b38, 
-    0x8f462a19, 0x00367bc4, 0x20000200, 0x05835900, 0x1b001222, 0x07fded18, 0x8b542320, 0x00612708, 0x07080005, 0xce540805, 0x01092605, 0x5c060707, 
-    0x07696100, 0x18072846, 0x8607098a, 0x3225822a, 0x06070600, 0x02020060, 0x1b4c0213, 0x02002940, 0x91720201, 0x23278252, 0x57070606, 0x07315487, 
-    0x59595006, 0x13141240, 0x1b13181a, 0x21241b14, 0x2c008211, 0x1b060a10, 0x3521012b, 0x15333521, 0x4f018221, 0x012a1055, 0x01fbfe25, 0x7101ca05, 
-    0x924e8ffe, 0x5104260e, 0xa4e0e0a4, 0x0c614fd4, 0x03000023, 0x09c35b00, 0x21001624, 0xb94d9300, 0x01072106, 0x4a054945, 0x08210a2c, 0xa0b31801, 
-    0x092d4a07, 0x27881d20, 0x06231d82, 0x4a040001, 0x24280e2f, 0x02000100, 0x63020103, 0x0023278b, 0x88570400, 0x0004224c, 0x32e6824f, 0x0c17181b, 
-    0x1d00010c, 0x1821171c, 0x0c160c21, 0x5b101216, 0x092005e8, 0x310ee85b, 0x23032e13, 0x07020e22, 0x023e3201, 0x031e2137, 0xe85b6702, 0x04242d06, 
-    0x4d6a4322, 0x2144694d, 0x4b200104, 0x05260682, 0x2104c3fd, 0xf45b6a42, 0x59032610, 0x4284c684, 0x2a048242, 0x803f4bfd, 0xbe7a80be, 0x82004382, 
-    0x825f20a6, 0x057d2696, 0x000d00d5, 0x05034175, 0x01041a26, 0x00010501, 0x6120d582, 0x2008926b, 0x0cec414b, 0x18001a21, 0x2911569a, 0x02020059, 
-    0x1b4c0313, 0x1c842040, 0x4a4c0020, 0x82612005, 0x2064824b, 0x22068255, 0x82590001, 0x00012255, 0x21f6824d, 0x0084110a, 0x22074d46, 0x49211133, 
-    0x1138054e, 0x8282e123, 0x2ffd9c03, 0xddfd2302, 0xaa3e03cb, 0xfeaaed01, 0xc2fcaabd, 0xaf24a782, 0x4b0466fe, 0x1e22a782, 0xa785bc00, 0x0500222b, 
-    0x05020100, 0x04006301, 0x052a4504, 0x2405f045, 0x06000000, 0x21af825b, 0x306a0617, 0x00252307, 0x2a820102, 0x92700021, 0x242c8c31, 0x40585040, 
-    0x262c8823, 0x05040003, 0x88610403, 0x212a8a34, 0x25992840, 0x00060623, 0x23838657, 0x594f0600, 0x2921ee83, 0x26ef8221, 0x06072026, 0x44052b1b, 
-    0x1024050d, 0x23112123, 0x5908f685, 0x011e1732, 0x0e141115, 0x02012b02, 0x5d433e4d, 0xfef81a3b, 0x9c03cbf2, 0x37012ffd, 0x36396fbc, 0x72a46a32, 
-    0x5023f04c, 0x22016184, 0x39fd3d01, 0xfeaad505, 0xab3d7746, 0x86cefe78, 0x003c7ec2, 0x0f000100, 0xc204befe, 0x1700d505, 0x0d407900, 0x0a0d1013, 
-    0x02030607, 0x1f480608, 0x00162108, 0x2905d869, 0x03020405, 0x024b1303, 0x80540201, 0x823a2007, 0x671d87f1, 0x03260a74, 0x1b4c0013, 0x36841c40, 
-    0x35835520, 0x07241b83, 0x00610003, 0x2205a76a, 0x824d0706, 0x110b22d7, 0x27008212, 0x08101313, 0x212b1c06, 0x67088c67, 0x012708a0, 0x23113313, 
-    0x671b1804, 0x0121058d, 0x0aa36730, 0xaa3af622, 0x67098d67, 0xfd230da7, 0x8214fe2f, 0xfe8935d3, 0x05370475, 0x004000f0, 0x331f40e1, 0x32070601, 
-    0x3e060501, 0x3106a767, 0x0202051a, 0x01010e03, 0x00010d02, 0x4b4a0701, 0xc78221b0, 0x64672720, 0x24a48208, 0x0707005b, 0x0153181a, 0x461b2008, 
-    0x00230540, 0x82170000, 0x053f42d8, 0x2e882420, 0x07430120, 0x20359105, 0x07414202, 0xbf672220, 0x5f002214, 0x26338700, 0x401b4c06, 0x18070028, 
-    0x670825cf, 0x698317ec, 0x59594f37, 0x250b4059, 0x25262124, 0x082a2415, 0x012b1c06, 0x07020e14, 0x1153181e, 0x2726230e, 0xfa67012e, 0x37042724, 
-    0x67a06e3a, 0x53182b2d, 0x1e240829, 0x61c95e26, 0x371c0768, 0x975c9a01, 0x360b456f, 0x5a55325c, 0x0f118318, 0x461c2b2f, 0x22260237, 0x331b1968, 
-    0x89000100, 0xc804befe, 0x0f00d505, 0x09406d00, 0x0203080b, 0x2b062964, 0x40585035, 0x00040014, 0x5d050405, 0x20052664, 0x08e25601, 0x1b8a3a20, 
-    0x68651583, 0x4c002406, 0x841a401b, 0x82552032, 0x23188231, 0x61000205, 0x3606eb6d, 0x594d0504, 0x11094059, 0x13111212, 0x1a060610, 0x0123212b, 
-    0x69231107, 0x332906f4, 0xf4032311, 0x9a19fe1f, 0x059a63cb, 0x72e3012a, 0xa4ec02d4, 0xd505b8fd, 0x24059963, 0x14fe37fd, 0x22008200, 0x583d0001, 
-    0x7c200833, 0x2005f341, 0x08cf491c, 0x20061043, 0x050f4301, 0x8f0b0e43, 0x82022023, 0x590322ca, 0x83298305, 0x8c2220b4, 0x82552042, 0x43208217, 
-    0x1120121a, 0x1a430084, 0x21112106, 0x6d59be84, 0xcbfc2307, 0xbd82d7fd, 0xd5cb2927, 0xfdc702d5, 0x05f15139, 0x32067359, 0x0475fe8b, 0x00f00531, 
-    0x40ca002d, 0x00012a1c, 0x82082b05, 0x01092e60, 0x01140104, 0x01130403, 0x4a050302, 0x200d820b, 0x05f44249, 0x19062021, 0x20070f4f, 0xf87b181a, 
-    0x421b2008, 0x172308f7, 0x851b4c02, 0x001d26f9, 0x03020003, 0x0f4f1902, 0x202e8a09, 0x09567404, 0x9006fb56, 0x67b5182c, 0x26283c2c, 0x16181d1e, 
-    0x04061012, 0x2d012d00, 0x2b140607, 0x11022201, 0x36322110, 0x42061537, 0x022013e7, 0x31072151, 0x2e151716, 0xc2e40201, 0x5b8601c4, 0x837849a9, 
-    0xd4422a2d, 0xd2862e0a, 0x9c514b90, 0xa15990e1, 0x05a7494e, 0x0a4d194c, 0x0d412308, 0xc7425b36, 0x461d3208, 0xc56f0737, 0xb8b11701, 0x69c82001, 
-    0x3ccf2a28, 0x050b4241, 0xbefe2f2a, 0xd505a204, 0x74000b00, 0x20051141, 0x08b04218, 0x20070750, 0x0c605b4b, 0x00001b28, 0x00040504, 0x27907005, 
-    0x1b4c0124, 0x1d882140, 0x01030227, 0x01020401, 0x20268461, 0x0ec24255, 0x21086d5b, 0x35502321, 0x11333306, 0xcbcf0223, 0x73042bfe, 0xd5d52dfe, 
-    0xaaaa2b05, 0xaf427ffb, 0x9be31807, 0x0e01631e, 0x09614618, 0x46181320, 0x12241161, 0x06031112, 0x259be318, 0x87000121, 0x00102877, 0x070ab774, 
-    0x7c010304, 0x16200866, 0x43090c48, 0x084805d8, 0x4816200c, 0x22840e08, 0x1b4c0224, 0x09821e40, 0x72020122, 0x02481e87, 0x82122015, 0x071021a3, 
-    0x0807d849, 0x09330124, 0x15013301, 0x11211521, 0xfe020223, 0xfe0801f8, 0x6c01d723, 0xfed96b01, 0xfe0a0121, 0xa401cbf6, 0xe01850aa, 0x502b07d0, 
-    0x005cfeaa, 0xfe120001, 0x44be04be, 0x0e24068f, 0x0205080b, 0x0121ba82, 0x2118824a, 0xe3414901, 0x00132705, 0x03040003, 0x36625d04, 0x4c142008, 
-    0x1a87083e, 0x9c820020, 0x1f845920, 0x40211a82, 0x20308419, 0x2a0f8255, 0x01040000, 0x03006100, 0x83590403, 0x594d2442, 0x8211b759, 0x051328b1, 
-    0x212b1906, 0x82010923, 0x82b18302, 0x23112db4, 0xfe05ea03, 0xda75fe92, 0x50fef401, 0x0885e518, 0xd4667927, 0x7dfd8302, 0x85e51803, 0x93fd2108, 
-    0x2007e741, 0x2c5c82a0, 0x00d7055b, 0xb5660024, 0x01030102, 0x06865001, 0x08d09518, 0x78679482, 0xec95180f, 0x02132311, 0xb0821b4c, 0x06590020, 
-    0x82032006, 0x82632049, 0xff831838, 0x19b72509, 0x10381823, 0x132cb083, 0x3f361133, 0x3f033e01, 0x17163201, 0x2d15aa4f, 0x3322cba0, 0x39331330, 
-    0x55301b3b, 0xa24f297a, 0xfdd72d10, 0x1a1c2655, 0x070c110a, 0x272d0201, 0x22059d4f, 0x4cda010c, 0x7b830a64, 0x53010021, 0x0239968f, 0x00000f00, 
-    0x3b07c204, 0x1f000b00, 0x0c406701, 0x18191c1d, 0x070f1215, 0x08516e07, 0x38551f20, 0x00663305, 0x00010a02, 0x64000204, 0x04020506, 0x094b1304, 
-    0xc6730208, 0x50072407, 0x881e4058, 0x06a3631f, 0x0e202590, 0x4ca22582, 0x4ca41120, 0x4ca51720, 0x26823520, 0x90821e20, 0x72010222, 0x3a20bf9a, 
-    0xde842592, 0x85590421, 0x4c0724ec, 0x9225401b, 0x07072346, 0x21845504, 0x83590721, 0x0704212f, 0x2e08626e, 0x1f00011b, 0x171a1b1e, 0x11131416, 
-    0x6e0d0e10, 0x0b210966, 0x0d666e06, 0x6e13b671, 0xfe210d70, 0x13c47146, 0x21079163, 0xcc7132fd, 0x00003818, 0x89000100, 0xb80466fe, 0x2000d505, 
-    0x0a40af00, 0x05010110, 0x5302010b, 0x1e2008df, 0x2307c44b, 0x03030104, 0x20054645, 0x11274c4b, 0x00242588, 0x59030202, 0x204c2a86, 0x8a1c2010, 
-    0x0200254b, 0x61020300, 0x4021498b, 0x4c1e9221, 0x12221412, 0x124c1211, 0x482b200d, 0x012408e4, 0x021e3233, 0x2007134c, 0x05134c27, 0x48779721, 
-    0x182406ef, 0x3c6c975b, 0x200d144c, 0x08fc487f, 0x753a9c24, 0x184c77b1, 0x05134106, 0xd5054826, 0xa3001700, 0x29050f45, 0x0004001e, 0x01040201, 
-    0x07410561, 0x2225861d, 0x48020200, 0x2d4106f9, 0x5040240e, 0x8a1c4058, 0x1407414b, 0x1e876a89, 0x21120741, 0x00821125, 0x1a4d1520, 0x092a490b, 
-    0x2005134d, 0x49ff844a, 0xf7890630, 0x495f0221, 0x93370838, 0x3b7ec287, 0x00010000, 0x04befe82, 0x00d7053d, 0xb57f0029, 0x4c010102, 0x1b2208ff, 
-    0x1d820300, 0x6301032f, 0x06000000, 0x045d0600, 0x13020201, 0x0c54784b, 0x1c82228f, 0x84590221, 0x4c052427, 0x8921401b, 0x06052340, 0x17825500, 
-    0x06050025, 0x83610502, 0x8359204f, 0x06d54e52, 0x18231937, 0x06071039, 0x33252b1b, 0x0f010e11, 0x0f030e01, 0x2e272201, 0x2b028201, 0x11331135, 
-    0x32331614, 0x013e3736, 0x0e830282, 0x11232a08, 0xd59d0223, 0x2f1d2811, 0x3c393312, 0x58a0301b, 0x28040e08, 0x736acb2c, 0x192d662c, 0x271f0b1f, 
-    0xaad5cbcb, 0x1e142402, 0x06794510, 0x1008543b, 0x79a53605, 0x49fed101, 0x15148c99, 0x250e180c, 0x7a015c86, 0xbefe29fa, 0x32a28200, 0x04000025, 
-    0x003b07ac, 0x0013000b, 0xb5960116, 0x44080115, 0x252008de, 0x2008de44, 0x05de4409, 0x08010a29, 0x08050600, 0x73006206, 0xa3660538, 0x50072607, 
-    0x00244058, 0x44258f02, 0x2b8e05ed, 0x69190e20, 0xdb5f1fc4, 0x057d5905, 0x58aa1120, 0x58ab1720, 0x6a193520, 0x848b1e1d, 0x2b893a20, 0x11ee6919, 
-    0x19090f41, 0x20361d6a, 0x26008259, 0x14141d40, 0x19140001, 0x4515216a, 0x05200e14, 0x092d4018, 0x28060b45, 0x1ea35563, 0xfe9e0b77, 0x3b4018f5, 
-    0x087f730c, 0x0e424018, 0x49040021, 0x675a05bb, 0x001f2606, 0xb52f0122, 0x06f54121, 0xea820720, 0x410b2321, 0x4d1807e5, 0x18210ba8, 0x0ec7414b, 
-    0x2a820a20, 0x18e26819, 0x200b3e41, 0x2053a915, 0x1953a735, 0x25223669, 0x1b4c0413, 0xed822c40, 0x04000824, 0xb8417008, 0x4f4e1805, 0x23e5820b, 
-    0x55080606, 0x08260682, 0x06005a06, 0x207e0608, 0x21403105, 0x0c0d2020, 0x22200001, 0x1e1f2220, 0x1a1b1c1d, 0x0d334e18, 0x15790c20, 0x099a411b, 
-    0x0c4b4918, 0x0f396919, 0x200c705a, 0x0f9f419c, 0xe37c0220, 0x3b072705, 0x17000b00, 0xaf58c201, 0x482d2005, 0xdd7a0f69, 0x17cf7a07, 0x58500722, 
-    0x9748fd82, 0x822d8707, 0x7b012045, 0x0e201903, 0x68b03382, 0x68b21120, 0x68b31720, 0x34823520, 0x68482c20, 0x1f05410e, 0x33823a20, 0x33972920, 
-    0x2012437b, 0x192b8f2f, 0x5920b151, 0x012c063b, 0x15161700, 0x11121314, 0x0d0e0f10, 0x480a6e6c, 0x05200fd2, 0x210a387b, 0x646c7a02, 0x7bba200c, 
-    0x3d770c39, 0x09337b07, 0x7f560220, 0x00192d08, 0x40980022, 0x0201110a, 0x01011003, 0x3108b96a, 0x0001001f, 0x05010405, 0x02020061, 0x03005b03, 
-    0xca181a03, 0x88560a29, 0x871c2009, 0x01072226, 0x08875604, 0x02242f85, 0x23401b4c, 0x840a6f7a, 0x2326824d, 0x57040000, 0x0874ca18, 0x08058656, 
-    0x1a1b177a, 0x1f200001, 0x221b221a, 0x0a0c1315, 0x19000405, 0x06081901, 0x22052b14, 0x21351102, 0x022e3435, 0x020e2223, 0x013e3507, 0x11122033, 
-    0x32270210, 0x2137023e, 0x67021214, 0x1303f6fc, 0x50714721, 0x50545326, 0x53a44e24, 0xf7f90001, 0x436749f8, 0xc5fd0522, 0x7e011d8c, 0x08538801, 
-    0x4887c079, 0x1e2e2011, 0xfe282acf, 0xfe78fe82, 0xa480fe79, 0x7fbf7f40, 0x00fcfef9, 0x04200082, 0x44050b41, 0x313006c3, 0x6c013a00, 0x01290a40, 
-    0x01280706, 0x4a020605, 0x2705395f, 0x0005002d, 0x09050809, 0x530f017e, 0x200808b4, 0x0808010d, 0x010c5b04, 0x041b0404, 0xb04b1b4c, 0x4058500a, 
-    0x0101032b, 0x030a020b, 0x00010700, 0x53408763, 0x4b2008b3, 0x1520328f, 0x67b03282, 0x67b13520, 0x32823a20, 0x9a932820, 0xc0829082, 0x54040821, 
-    0x2f200d57, 0x63542a8c, 0x08092409, 0x82610905, 0x04042332, 0xca885708, 0x4f040822, 0x0805c542, 0x32332725, 0x0c0d1819, 0x37380001, 0x3a333a32, 
-    0x22242b2d, 0x31181c1d, 0x10133119, 0x160d170c, 0x0b000407, 0x450e0a01, 0x01201a00, 0x451efb41, 0xf4200d15, 0x7e1c0842, 0xf9210d3b, 0x24174272, 
-    0xb34d0320, 0x003c3106, 0x0017000b, 0x400c012b, 0x2528290c, 0x1b1e2124, 0x2406b54d, 0x40585007, 0x0d51611d, 0x2011b34d, 0x2024820a, 0x0741411b, 
-    0x00010423, 0x20229163, 0x2047a315, 0x2047a135, 0x4d228f3a, 0x2220105b, 0x584d888f, 0x05cc7f16, 0x272a2b29, 0x20222326, 0x181c1d1f, 0x460d25f2, 
-    0x664d1bb6, 0x0ca94113, 0x4dccfd21, 0xc6461465, 0x0afd210c, 0x261b6b4d, 0xff890003, 0x433704e3, 0x463906af, 0x16406d01, 0x09080134, 0x08070133, 
-    0x0706013f, 0x0605011c, 0x0504011b, 0x06b94305, 0x16572c20, 0x0da94107, 0x08080028, 0x09005b09, 0xb1181a09, 0xb84309a1, 0x412a2009, 0x09230727, 
-    0x57630001, 0x31970856, 0x58501523, 0x2065af40, 0xad338235, 0x823a2065, 0x94272031, 0x0c052197, 0x0421ee82, 0x24d1885f, 0x401b4c08, 0x18298c2d, 
-    0x2609a4d3, 0x06070506, 0x18050063, 0x2113bcb0, 0xb0432340, 0x31362c06, 0x28292b2f, 0x181e2026, 0x43461946, 0x0d200bae, 0x181cae43, 0x21292840, 
-    0x40634c01, 0xc7fe210a, 0x22354018, 0x180fc043, 0x37234440, 0xff1a0001, 0x05b604e4, 0x002500d5, 0x180a40aa, 0x13050401, 0x02060301, 0x3006ec52, 
-    0x03010026, 0x02010302, 0x00060070, 0x03060103, 0x063a5563, 0x4b130528, 0x00020200, 0x4079075b, 0x9023200c, 0x8202202d, 0x00022120, 0x0804a518, 
-    0x4c041325, 0x8829401b, 0x00052625, 0x04050604, 0x195b8861, 0x8409a110, 0x594f2436, 0x82154059, 0x17192ea0, 0x12141516, 0x06080a10, 0x01250005, 
-    0x05f34625, 0x022e6308, 0x16143335, 0x35363233, 0x2b022e34, 0x21013501, 0x01152135, 0x17021e32, 0x1415011e, 0x6702020e, 0x4d96dc8e, 0xbfbec6ca, 
-    0x825a30c7, 0x7201ae52, 0xca031efd, 0x733488fe, 0x2b27656f, 0xdc964e25, 0xac763e1c, 0x9595906f, 0x486a458d, 0xb901a625, 0x47fea8aa, 0x334e341a, 
-    0x6c487739, 0x003e75aa, 0x3b7f0200, 0x003c2606, 0x000d0003, 0x093b7fcb, 0x5850072f, 0x01001740, 0x00590001, 0x4b180000, 0x0e3b7f03, 0x1e820a20, 
-    0x19821520, 0x00020124, 0x1c8f6101, 0x3b9d1520, 0x3b9b3520, 0x1c8b3a20, 0x200e107f, 0x23708a1b, 0x55020404, 0x0eca3a19, 0x230e0d7f, 0x07211521, 
-    0x25090d7f, 0xfd56023d, 0x0d7fb2aa, 0x943c220a, 0x0a0c7fd3, 0x07410320, 0x000b2d08, 0x00210017, 0x1a1fb6f5, 0x01040602, 0x28063b44, 0x0802091b, 
-    0x01000003, 0x05eb4a5b, 0x41189783, 0x0a200be3, 0x1920b482, 0x25841a82, 0x00010423, 0x20208f63, 0x9e208215, 0x9f352043, 0x8f3a2043, 0x8f411820, 
-    0x8e1f200e, 0x8c411880, 0x1b402914, 0x00010c0d, 0x1d1e2021, 0x0fb75a18, 0xd3430a20, 0x9a41181a, 0x0dc24509, 0x4f411820, 0x0d984309, 0x5a419c20, 
-    0x4900200a, 0x23240d57, 0x2c013300, 0x18054b49, 0x210cdf8f, 0x74644b18, 0x010b2109, 0x073e0719, 0x20098a45, 0x22de8723, 0x19000105, 0x21089833, 
-    0x2a8f4b1a, 0x58501523, 0x2057a840, 0x06856835, 0x08335718, 0x5c628299, 0x182a8807, 0x88086e90, 0x4c072433, 0x8c27401b, 0x000522a5, 0xf0331907, 
-    0x59592618, 0x25234059, 0x056a4524, 0x242b2d2b, 0x1f332533, 0x1923181d, 0x876b1823, 0x1a94410c, 0x7f7d0120, 0x0ca6411a, 0xfbf4fe23, 0x393019f7, 
-    0x0daf4110, 0x7d72f921, 0xab62229b, 0x062238c8, 0x4d684221, 0x2041684e, 0x4c1e0106, 0x0221456c, 0x2101bffd, 0x411d6d45, 0x03360f04, 0x7ab16f8e, 
-    0xb07b4341, 0x4316fd6d, 0x9696da8d, 0x00448dd9, 0x274c0500, 0x0023260c, 0x0139002e, 0x05d1426a, 0x010d2e27, 0x08090007, 0x121e4c07, 0x20060b68, 
-    0x121e4c0e, 0xa3472c20, 0x01052307, 0x41886300, 0x06060022, 0x15233396, 0xb1405850, 0x4e352069, 0x0b2406ea, 0x00030a02, 0xea4e69a6, 0x82339107, 
-    0x08224cc7, 0x0624a685, 0x30401b4c, 0x0026c98b, 0x07060005, 0xd1890605, 0x04233382, 0x41570804, 0x234c0802, 0x302b2308, 0x0943242f, 0x34352b06, 
-    0x3930392f, 0x2e242e24, 0x0f43282a, 0x430f2011, 0xa664260f, 0x150f430f, 0x43170742, 0x16421f1b, 0x03002715, 0xe3ffb300, 0x8f4a5904, 0x013a3506, 
-    0x2f124069, 0x2e090801, 0x1b080701, 0x1a060501, 0x04050401, 0x4e0e8b4a, 0x594a0f45, 0x4a0a2017, 0x61201625, 0x4a18bd4a, 0x65a70b8b, 0x99178b4a, 
-    0x4a3a2065, 0x6121168b, 0x2f8b4a00, 0x8b4a3182, 0x30322d1b, 0x25262a2c, 0x1d1f2324, 0x3a193a18, 0x6f298b4a, 0x50201ef4, 0x200b7f4a, 0x1e017097, 
-    0x700f1642, 0x02211b10, 0x05877f00, 0x03003c2c, 0xe2001c00, 0x020d10b6, 0x4d480302, 0x09574908, 0x2108075a, 0x06585c05, 0x500a2c08, 0x00194058, 
-    0x03010000, 0x93610100, 0x82152020, 0x9d1b2020, 0x9f352043, 0x823a2043, 0x18162020, 0x25087f6c, 0x02050002, 0x6b846005, 0x1b4c0324, 0x09822140, 
-    0x01020125, 0x89700203, 0x05052621, 0x02005702, 0x21a78302, 0x0e7f0502, 0x09403005, 0x21181228, 0x06061011, 0x21012b1a, 0x7e032115, 0x012614f6, 
-    0xfd560251, 0xed7e85aa, 0x3c07241b, 0x7e04fa94, 0x032018e8, 0x2c084b41, 0x0017000b, 0xb60c0130, 0x04022124, 0x074d4105, 0x0c1b5f18, 0x184b1821, 
-    0x2013ab40, 0x06f0750a, 0x9308bc47, 0x18152024, 0x950f675f, 0xa335204b, 0x823a204b, 0x481a2024, 0x40180c0a, 0x25200e77, 0x08714018, 0x4018258d, 
-    0xb2491274, 0x2e302505, 0x22232526, 0x0e915f18, 0x411b0d45, 0x7120158b, 0x210af042, 0x934145fd, 0x0ded421b, 0x413bfa21, 0x0020189e, 0x29099f41, 
-    0x00070003, 0xb6f00020, 0x9f411114, 0x821d200a, 0x760120e1, 0x514105d8, 0x500a2715, 0x021b4058, 0x27820001, 0x01000523, 0x179b4161, 0x352047a0, 
-    0x3a2047a1, 0x18202282, 0x00206a89, 0x200e9541, 0x257b8223, 0x05010401, 0x238b7004, 0x30139341, 0x1812280b, 0x11111121, 0x1c060810, 0x0333012b, 
-    0x18038523, 0x2613c943, 0xe5ba3102, 0x8204029a, 0x21fe2104, 0x291b7041, 0xf8fe3c07, 0xf8fe0801, 0x6a4178fa, 0x00032616, 0x0400007f, 0x065f463a, 
-    0x2501352b, 0x01310a40, 0x01180506, 0x089d5404, 0x06002228, 0x06080400, 0x65596304, 0x01072a0d, 0x4b130505, 0x14080800, 0x07925408, 0xb6582020, 
-    0x01052307, 0x35876300, 0x1523278e, 0xa5405850, 0x73352051, 0x768406a3, 0x454b519a, 0x18279007, 0x2008f76d, 0x21a18213, 0x9c8b2640, 0x06239482, 
-    0x8b550508, 0x590824a3, 0x19050800, 0x2e077944, 0x010c0d1d, 0x33343500, 0x262b2d32, 0x181c1e25, 0x430c8b67, 0x13201a20, 0x15384118, 0x43530121, 
-    0x06200a21, 0x16444118, 0x210d1b43, 0x411821fc, 0x002d1c52, 0xfed70001, 0x057304be, 0x000900d5, 0x05ff5e6f, 0x0300172b, 0x04030400, 0x0202005d, 
-    0x05267301, 0x240cf265, 0x0300001a, 0x20218204, 0x24268f70, 0x401b4c02, 0x261c8820, 0x03020001, 0x84610201, 0x64552024, 0x113c0d21, 0x05101111, 
-    0x212b1906, 0x15211123, 0x11331121, 0xcba20123, 0x2ffd9c03, 0xd505d5d5, 0x2606e965, 0x00520005, 0x427f0400, 0x2626064f, 0x35002a00, 0xc74a4d01, 
-    0x00292b05, 0x090a0005, 0x0c630a05, 0xf74e0b02, 0x01072c0a, 0x4b130404, 0x0909010d, 0x18085c06, 0x2008e150, 0x0604480a, 0x04202b84, 0x8405e156, 
-    0x202e953c, 0xac2e8215, 0xad35205f, 0x07d5565f, 0xb7828e90, 0x09060623, 0x21b88357, 0x9b845904, 0x1b4c0427, 0x01032e40, 0x822a8801, 0x06052315, 
-    0xfd875504, 0xf0883186, 0x46060921, 0x253306f8, 0x0c0d2b2c, 0x32340001, 0x352c352b, 0x2728292a, 0x5b1c2426, 0xd2560ed3, 0x3305241b, 0x7d323311, 
-    0x012115fc, 0x0a7f426e, 0x7ecefc21, 0x8242180a, 0x7e9c200d, 0x01201717, 0x3c052355, 0x2e00f005, 0x16409c00, 0x01020113, 0x02030114, 0x03040108, 
-    0x0405012b, 0x0500012c, 0x0e9f7a05, 0x18006321, 0x1809264a, 0x7a077b82, 0x6320119f, 0x07838218, 0x0c2e4a18, 0x820f9f7a, 0x149f7a25, 0x2127292a, 
-    0x181c1e1f, 0x000f1116, 0x085f5418, 0x35022e24, 0x98183634, 0xdd180a14, 0x77080881, 0x2315013b, 0x15020e22, 0x32331614, 0x0e153736, 0x7d970201, 
-    0x9b4787c3, 0x45888494, 0x4e6baf7c, 0xbf6c79bc, 0x9b928d4c, 0x4c9a9a8c, 0xb22e567a, 0x67c460a9, 0x3c1dd667, 0x9866a372, 0xa12227c6, 0x69935a7e, 
-    0xba20203a, 0x6f79262a, 0x27a67974, 0x88446c4a, 0xc9363395, 0x00002624, 0xfe750002, 0x055c04f2, 0x001400f0, 0x4074002f, 0x0001120b, 0x144a0102, 
-    0x47000213, 0x0a424f18, 0x01005b2c, 0x044b1a01, 0x00020201, 0x5518005b, 0x13200b6e, 0x45831382, 0x03005f24, 0x25840103, 0x1b4c032c, 0x01001a40, 
-    0x01020300, 0x1d856303, 0x38875720, 0x4f00023a, 0x0d405959, 0x24261516, 0x2f162f15, 0x06057024, 0x2a052b16, 0x22060701, 0x07544119, 0x10111227, 
-    0x07170702, 0x23e98201, 0x3435033e, 0x0866ac18, 0x11066108, 0x1e171614, 0x048f0201, 0x06070709, 0xf7f9fe02, 0x89f7fcfd, 0xfe97c88b, 0x206b53ef, 
-    0x09111910, 0x10191209, 0x4f4e6b23, 0x2144226c, 0x1b6b2123, 0x82010101, 0x84018601, 0x7ffe8101, 0xdbfe79fe, 0xbe4899fe, 0x4a950164, 0x73572144, 
-    0x8f5a5a91, 0x48225772, 0x8f484645, 0xe6a5bafe, 0x00484649, 0xda82b382, 0x12a71419, 0x58501c31, 0x01021240, 0x4b130000, 0x15010100, 0x1801044b, 
-    0x240fa05c, 0x03010003, 0x89218570, 0x05706d1c, 0x84000121, 0xa714191c, 0x00132508, 0x10401b4c, 0x11057018, 0x07067018, 0x2b190626, 0x011b3311, 
-    0x03210283, 0xa7141923, 0x19882023, 0x2a2eb304, 0x04004b1c, 0x084b1404, 0x55050501, 0x0a200bdb, 0x2021e482, 0x37041900, 0x861c200e, 0x07042126, 
-    0x20088d77, 0x2027820f, 0x94279124, 0xa6112053, 0xb3041953, 0x20a79614, 0x187f843a, 0x820e7864, 0x7e0720cc, 0x0325072c, 0x0303005b, 0x05ad771c, 
-    0x48b30419, 0x04190620, 0x023ed7b3, 0xe3ff7d00, 0x37064804, 0x40003700, 0x0e400001, 0x0102011e, 0x0204012b, 0x011d4a02, 0x0d474801, 0x001c3605, 
-    0x4b1a0101, 0x02040400, 0x0202005b, 0x01064b1c, 0x5b000303, 0x08175805, 0x58500a23, 0x20238240, 0x4d9d1802, 0x20239109, 0x9c238515, 0xa2352047, 
-    0x823a2047, 0x00192123, 0x7220a482, 0x82828582, 0x5f000322, 0x04249888, 0x20401b4c, 0x088d9d18, 0x04020323, 0x23238264, 0x57030000, 0x0321b088, 
-    0x06955d00, 0x38391532, 0x3b3d0001, 0x40394038, 0x191a2d2f, 0x37013700, 0x2b05257f, 0x3435022e, 0x013c3536, 0x012e012f, 0x37250982, 0x3e37033e, 
-    0x2b028301, 0x0f010e17, 0x07010e01, 0x010f030e, 0x07f05918, 0x020e9408, 0x10112027, 0x14112021, 0x74690216, 0x013f7ab3, 0x03020701, 0x2a080101, 
-    0x564e6f4a, 0x241a79ce, 0x2b134618, 0x542cf018, 0x394c2d2c, 0x3f080523, 0xb17361af, 0x793f3f79, 0x1b0173b3, 0xe3fee4fe, 0x904b1d8e, 0x171c85d1, 
-    0x090d050b, 0x155938a7, 0x47081c0e, 0x256e8291, 0x02081b29, 0x088e0b05, 0x05180208, 0x40181718, 0x3c244b48, 0x954c3a41, 0xdb8f90dc, 0x019c4c95, 
-    0xfeb001b0, 0x00dbd752, 0x00ef0003, 0x041e0400, 0x00140060, 0x002a001d, 0x180bb592, 0x201cdf63, 0xdf631815, 0x0315242d, 0x19401b4c, 0x35278385, 
-    0x15161e1f, 0x2a1e2729, 0x1a1c2a1f, 0x1d161d15, 0x08201214, 0x63181506, 0x0e2907e0, 0x031e0702, 0x23061415, 0xd7511821, 0x32132308, 0xda59023e, 
-    0xef113b05, 0x874c8d01, 0x30183a65, 0x5c433149, 0xc3cf1a39, 0x9c0163fe, 0x56545455, 0x1282efe3, 0x151a3608, 0xf3344a2d, 0x47226004, 0x512c486a, 
-    0x0c062a40, 0x3659452f, 0x9902a7a2, 0x56434355, 0xfdfdcffe, 0x2b48351d, 0x182d3e25, 0x000093fe, 0x00330101, 0x04230400, 0xe3631860, 0x18152012, 
-    0x180dbc52, 0x200de363, 0xe3631815, 0x21013223, 0x23112115, 0xf0023301, 0x04b8c8fd, 0x36fc9660, 0x20008200, 0x2f738402, 0x006d063d, 0x00090003, 
-    0x05b04b95, 0x1b405850, 0x02228b82, 0x91426600, 0x03032605, 0x02005902, 0x18808202, 0x1807fc4c, 0x8a169e63, 0x183a2021, 0x211a9e63, 0x63180315, 
-    0xb721259e, 0x9c631811, 0x23012209, 0x27bd8405, 0xfec67703, 0xd5fe9abb, 0x0624c384, 0x9588fe6d, 0x0128c683, 0x00003d01, 0x9a052e04, 0x189b6318, 
-    0xfa469a82, 0x9b63180f, 0x5a1c8a09, 0x012105c4, 0x9b631800, 0x0215210e, 0x299b6318, 0x21012e08, 0x21033311, 0x3d012311, 0x01b93802, 0x04b8c8fd, 
-    0xfe3a0160, 0x0058fc0e, 0x69000200, 0x6804e2fe, 0x12006004, 0x89002100, 0x000119b5, 0x07b96f06, 0x0ea26318, 0x084b1522, 0x2da26318, 0x63181520, 
-    0x45084fa2, 0x010e0706, 0x14150607, 0x43693316, 0x0c141b12, 0xec020307, 0x2dfd9679, 0xfecd0296, 0x050a0984, 0x0c070407, 0x65409616, 0x216c7b7d, 
-    0x36fca001, 0x1e014cfe, 0xb401e2fe, 0xf2fe3403, 0x498ab31e, 0x09120a4d, 0xf3820808, 0xe3ff7c34, 0x7b045904, 0x24001d00, 0x0a409700, 0x0203011a, 
-    0xe118011b, 0x1c261b37, 0x0303004b, 0x5f185b00, 0xe1180d1e, 0x1c201937, 0x2a37e118, 0x011e1e33, 0x1e241e00, 0x18202224, 0x0b101116, 0x011d0009, 
-    0x08b25d1d, 0x023e3424, 0xd7183233, 0x02251642, 0x8fcd82a5, 0x77de184b, 0x511d2119, 0x1e70de18, 0x0bf7d918, 0x28002126, 0x0a40b700, 0x109bd818, 
-    0x13e2e018, 0x48060621, 0x4b310517, 0x02050500, 0x0201085b, 0x4c021b02, 0x3ab04b1b, 0x13e11850, 0x061c2225, 0x13e1184c, 0x22222232, 0x70d81805, 
-    0x16062813, 0x0133132b, 0x18221323, 0x1809887d, 0x2514acdf, 0x1901c6fa, 0x3141669a, 0x8906251d, 0xd2fa88fe, 0x081f3641, 0x00040025, 0x04e3ff7c, 
-    0x000d0659, 0x0017000b, 0x013c0035, 0x320a4001, 0x33060701, 0x02070401, 0x23b04b4a, 0x18405850, 0x2c1507de, 0x08004b1a, 0x005b0508, 0x4b1c0505, 
-    0x07de1800, 0x05975c07, 0x590c7365, 0x09260552, 0x09070600, 0x32986106, 0x8d0c7365, 0x0c072132, 0x04218b82, 0x203a885f, 0x069d4e08, 0x20087c59, 
-    0x44de1800, 0x04042311, 0x94875707, 0x4f040729, 0x40595959, 0x5c363627, 0x362f0554, 0x3a3c363c, 0x292e3038, 0x18212328, 0x65351935, 0xdc182770, 
-    0x012120ca, 0x0aa34e81, 0x9f41f220, 0x4305221d, 0xc978181e, 0xa0fa210a, 0x281ea941, 0x003b0001, 0x04970400, 0xc3631860, 0x1815201d, 0x201cc363, 
-    0xc3631815, 0x03012928, 0x33111333, 0x03331311, 0x0ac36318, 0xc7ef3e38, 0xc7ffa8ff, 0xb30301ef, 0x68a868bf, 0xcc02b3bf, 0x50fe9401, 0x0384b001, 
-    0x34fd6c3a, 0xfeb11002, 0xb15f01a1, 0x0100f0fd, 0xeaffa900, 0x7b042804, 0x9c002f00, 0x09bf6318, 0x18012621, 0x2022bf63, 0xbf63181c, 0x041c242c, 
-    0x18401b4c, 0x2127bf63, 0x63181d1f, 0x2f2208bf, 0x63182f01, 0x36201fbf, 0x08be6318, 0x15035a08, 0x02020e14, 0x67b15a1b, 0xaf63b64c, 0x76522cb4, 
-    0x89a59e4b, 0x478e958f, 0x9dd269ac, 0x3f77a869, 0x68407881, 0x8647274a, 0x1d1b16c4, 0x692322ad, 0x34492d5b, 0x4456901c, 0x1b195545, 0x4c2930a7, 
-    0x8060436b, 0x482f0c19, 0x7f4f3b60, 0x01003059, 0x0000c300, 0x60041a04, 0x7b5d1900, 0x18152015, 0x2019bf63, 0xbf631815, 0x11333d26, 0x23011123, 
-    0xe701b8c3, 0x19feb8b8, 0xfc6004b8, 0xfb2903d7, 0xfc2903a0, 0x020000d7, 0x06277f85, 0x000b0017, 0x18b60015, 0x2009bb63, 0x06c65711, 0x18020221, 
-    0x200ebb63, 0xbb631815, 0x1835200a, 0x23120563, 0x04040105, 0x6318238b, 0x15201d29, 0x29296318, 0x63184020, 0x0a210a25, 0x25631809, 0x33032d0d, 
-    0x3233011e, 0x02333736, 0x01113305, 0xa86ff185, 0x5b0b2905, 0x0e60565b, 0x38fd1777, 0x29080041, 0x481f01f8, 0xfe4c4a4e, 0x094198e1, 0x090b410b, 
-    0x03006f26, 0x73000d00, 0x1809eb63, 0x2012a562, 0x27631815, 0x18e1830a, 0x630a7f61, 0x15200994, 0x23a56218, 0x0da16218, 0x89230121, 0x570127c0, 
-    0x9a1901c6, 0xb88727fe, 0xfe6f0624, 0xb28a9788, 0xec000134, 0xb2040000, 0x0b006004, 0x09405500, 0x02050809, 0x67180204, 0x0d2408cc, 0x00000101, 
-    0x18363e42, 0x21139f62, 0xc218beec, 0x04230bca, 0x182ffe60, 0x200bcac2, 0x278b8502, 0x03006f06, 0x76000f00, 0x0c9f6218, 0x185e3e41, 0x410b1962, 
-    0x092e063e, 0x07012301, 0x24032311, 0x9abbfec6, 0xb98ce1fe, 0xfe6f0624, 0xbc8d9788, 0x0000002d, 0x00320001, 0x042e0400, 0x181b0060, 0x21101b62, 
-    0x62184b15, 0x1525231b, 0x401b4c03, 0x18488219, 0x29181b62, 0x1a111128, 0x19060520, 0x7b5a372b, 0x1c621805, 0x15380807, 0x07020e14, 0x012b010e, 
-    0x422d2332, 0x02061b2e, 0x03010304, 0x5ffeb811, 0x262a1303, 0x37627b29, 0x623f1d96, 0x53471a44, 0x8e012c5a, 0xca03a0fb, 0xa1a950f5, 0x3b3a3690, 
-    0x01229682, 0xb7823d00, 0xb7829b20, 0x6c000c27, 0x02070ab7, 0xce691803, 0x02621809, 0x05094208, 0x0db65318, 0x16831c88, 0x84590021, 0x82022022, 
-    0x001b28c1, 0x00020003, 0x82700203, 0x02032311, 0x06825500, 0x59020022, 0x62192482, 0xc3820b63, 0x09331322, 0x2c066743, 0x3d231101, 0x017701b8, 
-    0xfeb8b877, 0x2f0283e5, 0x4dfd6004, 0xa0fbb302, 0x1ffee502, 0x1bfde101, 0x0023a682, 0x82bd0001, 0x041426a7, 0x000b0060, 0x05385465, 0x08026218, 
-    0x00010225, 0x184b1500, 0x880d7253, 0x5b16831c, 0x1520051c, 0x391f6218, 0xfb43bd20, 0xfe602408, 0x82c70139, 0xfd03229a, 0x28e682fd, 0x04e3ff89, 
-    0x007b0448, 0x1f62180f, 0x181c2012, 0x20261f62, 0x1f62181c, 0x10113523, 0x15170001, 0x1b111b10, 0x0f000709, 0x06060f01, 0x22052b14, 0x1752b018, 
-    0xeb680227, 0xb27a3ef4, 0x70b11875, 0x181d200c, 0x211948b0, 0x5f410000, 0x1762180a, 0x18152011, 0x241d1762, 0x1b4c0215, 0x17621840, 0x03bd2229, 
-    0x05464657, 0x03a0fb25, 0x8236fcca, 0x0002217b, 0x079faa18, 0x20001427, 0x12b6d600, 0x06dd5c02, 0x58500524, 0x20822040, 0x004b152e, 0x5b010505, 
-    0x1c010100, 0x0401064b, 0x26052652, 0x03004b1b, 0x18031703, 0x1808b9a4, 0x20089faa, 0x20239415, 0x204ba635, 0x1827823a, 0x8b0c9faa, 0x2071867c, 
-    0xb8f31840, 0x188d8208, 0x2108c8aa, 0x1e855903, 0x00825920, 0x160f4034, 0x151a1c15, 0x13201620, 0x07102328, 0x132b1806, 0xd5511733, 0x22232309, 
-    0x62182726, 0x233a077f, 0x14150622, 0x12a7be16, 0x64659930, 0x3c3c709f, 0x6964a070, 0x01b92d97, 0x008286c9, 0x89872a08, 0x8f600489, 0x98515456, 
-    0xd98a8ada, 0x54565098, 0x2902c9fd, 0xd9d7d7d9, 0xdad6d6da, 0x00010000, 0x03e3ff9b, 0x007b04fd, 0x9762181d, 0x0e1a2207, 0x05ba4d02, 0x4e180320, 
-    0x3d410af4, 0x20a18206, 0xb1641800, 0x9762180e, 0x181c2010, 0x22239762, 0x4d121618, 0x05240697, 0x052b1406, 0x2108694c, 0x56581716, 0x074c5808, 
-    0xca7ebd39, 0x8e4c4c8e, 0x98547fca, 0x59944753, 0xb3bab9b3, 0x51429958, 0x83501d9a, 0x98da30d3, 0xc12e2850, 0xcfe03b40, 0x3f3ae0d1, 0x83282ebf, 
-    0x00d626d3, 0x04fc0300, 0xa3641860, 0x0102210a, 0x59231782, 0x50010100, 0x11200e05, 0x0d936218, 0x18001521, 0x2e2d9362, 0x03c9fe0d, 0xb8c9fe26, 
-    0x9696ca03, 0x820036fc, 0x72002563, 0x8b0456fe, 0x1f227b82, 0x62183e00, 0x3a260993, 0x11405850, 0x7e840102, 0x5c209b82, 0x2005e941, 0x2013841b, 
-    0x87821800, 0x03172d09, 0x2fb6594c, 0x04201812, 0x132b1806, 0x16df8018, 0x8018c220, 0xfe2122d7, 0xd18018f0, 0x8502201e, 0x150627a7, 0x2b000b00, 
-    0x62189a00, 0x11200987, 0x17e56118, 0x004b152b, 0x5c070404, 0x17070700, 0x07994e07, 0x6c182020, 0x05270a62, 0x06640002, 0x8d050501, 0x23402127, 
-    0x19c06118, 0x592d4d88, 0x01174059, 0x1a292b00, 0x0e161719, 0x195b490c, 0x11410120, 0x72022116, 0x0bc91519, 0x412dfd21, 0x04212220, 0x078449f6, 
-    0x41faf921, 0x44081e2a, 0x68000300, 0x6a0456fe, 0x19001406, 0x2f002400, 0x1d402000, 0x1a24252f, 0x000a0d17, 0x01000108, 0x0100004a, 0x01007200, 
-    0x4c011701, 0x06021b1c, 0x2e052b16, 0x3e343503, 0x33113702, 0x15031e11, 0x07020e14, 0x78611811, 0x6e0d3a11, 0x3031679f, 0xb86f9f67, 0x30679f6f, 
-    0x6e9f6731, 0x36563cb8, 0x56361a1a, 0x0808883c, 0x4a0b1d30, 0x9596d68c, 0x0b4a8dd4, 0x67fe9901, 0xd48d4a0b, 0x8cd69695, 0x73fe0b4a, 0x2c0c8005, 
-    0x7b7b995b, 0x0c2e5f9c, 0x9c5f2e0c, 0x5b997b7b, 0x85180c2c, 0x9149219b, 0x7b611836, 0x9b851814, 0x00a52e28, 0x04fd0300, 0x00190062, 0x150a406c, 
-    0x7b611801, 0x0e5c541a, 0x117b6118, 0x18041521, 0x22217b61, 0x18152513, 0x200a7b61, 0x7b611802, 0x36330808, 0x11331137, 0x08450323, 0x3f6a4f32, 
-    0x335f8854, 0x574327b8, 0x3e744530, 0xd201b8b8, 0x12161503, 0x5f865527, 0x91fe6f01, 0x0c284c41, 0xf5012417, 0x82009efb, 0x00012900, 0x04e2feb8, 
-    0x0060049a, 0x12736118, 0x184b1521, 0x20257361, 0x73611815, 0x04043b38, 0x01b8b4fc, 0x968cb8e6, 0x36fc6004, 0x36fcca03, 0x01004cfe, 0x00007d00, 
-    0x93845504, 0x0c736118, 0x18056c47, 0x231c7361, 0x1b4c0015, 0x34736118, 0xf0a87d22, 0xfc210182, 0x2d878728, 0xa0fbca03, 0x01000000, 0xe2fe6900, 
-    0x8b82d104, 0x61180f20, 0x15201273, 0x29736118, 0x61181520, 0x3b224273, 0xa5842efc, 0x2d419020, 0x06314108, 0xbd20a783, 0x1420a782, 0x6118a782, 
-    0x15201373, 0x1d736118, 0x3a251e90, 0x15405850, 0x73611800, 0x18c38410, 0x29387361, 0xb8a0fe1d, 0xfeb8e701, 0x634197a0, 0xa0fb2b05, 0x0200e2fe, 
-    0x0000b200, 0xb782e203, 0x1e001122, 0x19736118, 0x180f6649, 0x20177361, 0x73611815, 0x121e222b, 0x7361181d, 0x01232414, 0x5f110123, 0x3b0805f5, 
-    0x0133021e, 0x474c19c2, 0x86663b33, 0xb88d014b, 0xb5fefec1, 0x1ce37802, 0x2020323c, 0x011b3c32, 0x48280adf, 0x7b56536f, 0xa0fb254f, 0x39fec701, 
-    0x6d015d02, 0x30462c15, 0x152c4530, 0xe124db82, 0x56040000, 0x0c23db82, 0x18001400, 0x4b127b61, 0x02200598, 0x217b6118, 0x58001521, 0x61180a6f, 
-    0x0e281b7b, 0x0d11130d, 0x26140e14, 0x087b6118, 0x32213908, 0x1415021e, 0x25212306, 0x26343520, 0xe111012b, 0x680001b8, 0xe73d73a5, 0x0148fed6, 
-    0x810101b0, 0x6004f880, 0x54293bfe, 0xa4a6557f, 0x575eb499, 0x000097fe, 0x3c000200, 0xaa20bb82, 0x0e22bb82, 0x61181700, 0x4e4a187f, 0x5b032205, 
-    0x07995800, 0x58503a23, 0x977f1840, 0x079e4811, 0x2220c583, 0x257f6118, 0x160f1027, 0x10170f14, 0x977f1817, 0x23012407, 0x89112135, 0x363221cb, 
-    0x0122cc85, 0xc382f834, 0x82690021, 0x84e820cf, 0x867c27cf, 0x03f87a88, 0xd08396ca, 0xa7557e2e, 0x5a579ca4, 0x9afe5a5b, 0x68000300, 0x6920cf82, 
-    0x0c24cf82, 0x19001000, 0x14836118, 0x61181520, 0x15202e83, 0x2a836118, 0x1811122a, 0x12191116, 0x26111119, 0x0e836118, 0x21230626, 0x23113301, 
-    0x081b6318, 0x5bb66822, 0xef26ce86, 0xb8b84903, 0xd283c0fd, 0xa2415320, 0x2ed18305, 0xa0fb6004, 0x5c5b589a, 0x0096fe5b, 0x82020000, 0x040022cd, 
-    0x22d782d1, 0x18300029, 0x21187b61, 0x61184b15, 0x0322092d, 0xe2480314, 0x181d2007, 0x220b5361, 0x18030105, 0x200a7b61, 0x7b611815, 0x2a2b302d, 
-    0x302a2d2e, 0x112b302b, 0x201a2128, 0x4f1a0609, 0x60180c87, 0x23320a03, 0x0e14011d, 0x030e0702, 0x3225012b, 0x012b3435, 0x984f1011, 0x35023b09, 
-    0x6d904f15, 0x906c3e40, 0x05e5bd52, 0x11262c16, 0x37513c2a, 0xd02d0327, 0xa74f0dd0, 0x05dc410b, 0x527d5333, 0xf5ca0329, 0x97933b45, 0x2617348e, 
-    0xb599101c, 0x06bb42b4, 0x00006a2c, 0x6004c704, 0x1d001600, 0x114f8800, 0x031d2305, 0x61180101, 0x15200a73, 0x10736118, 0x58503a24, 0x24891e40, 
-    0x10186118, 0x4c00152c, 0x0224401b, 0x04010001, 0x27905500, 0x0d126118, 0x1812402c, 0x171a1b17, 0x111d181d, 0x61182811, 0x35291e10, 0x11012b34, 
-    0x6c01a86a, 0x24fc89a8, 0x02a894fe, 0x25f482c9, 0x39fe6004, 0xee89c701, 0xfd030223, 0x2ae585fd, 0xffd50001, 0x040604e3, 0x1830007b, 0x5521ff60, 
-    0x5b1806ec, 0x032117d0, 0x055b6003, 0x21056451, 0x53190002, 0x21201bff, 0x088aaa18, 0x08ff6018, 0x5e331621, 0x2f21064a, 0x1daf1802, 0x1802201a, 
-    0x182686aa, 0x3e2982aa, 0xa5000100, 0x0704e3ff, 0x24007b04, 0x12409800, 0x0102010d, 0x0203010e, 0x04050121, 0x18000122, 0x2119fb60, 0x60184b1c, 
-    0x1c242bfb, 0x401b4c02, 0x180f5b66, 0x2417e3a8, 0x18191d1f, 0x05fe4d17, 0x24012422, 0x2109d560, 0xb218023e, 0x0e230875, 0x18250702, 0x2308fb60, 
-    0xc702010e, 0x330a024e, 0x5b5f9244, 0x092e547f, 0xe2fd1902, 0x84592f05, 0x3e985e5a, 0x3a0d0c4e, 0x5b363e3d, 0x90014378, 0x38669057, 0x2ebf3c3d, 
-    0x00000028, 0xffe10001, 0x414304e3, 0x182c0707, 0x17050401, 0x04040301, 0x03020101, 0x1b036118, 0x181c0358, 0x58100361, 0x5d181403, 0x7b180bf7, 
-    0x1c2a0bc3, 0x0f13151a, 0x080c0d0e, 0x07410006, 0x069a7b08, 0x0c046118, 0x3c09f64f, 0x9a552102, 0x5e983e51, 0x2f59845a, 0x02e2fd05, 0x542e0919, 
-    0x945b5a80, 0x54995246, 0x05244f7f, 0x2e281d27, 0x383d3cbf, 0x28fc8266, 0x365b7842, 0x2ec13f3c, 0x07274f28, 0x00820020, 0xe4000232, 0x1c04f8ff, 
-    0x0b001406, 0xad001d00, 0x501cb04b, 0x0b47d918, 0x7b4b1a21, 0x1521075c, 0x5042184b, 0x050b4507, 0x27823520, 0x01001e22, 0x0523c082, 0x97630001, 
-    0x05db4625, 0x02242588, 0x03020300, 0x2008797b, 0x05215915, 0x052c1d88, 0x05020400, 0x02006104, 0x57020303, 0x02386d86, 0x59594f03, 0x01134059, 
-    0x1b1c1d00, 0x1213151a, 0x00040710, 0x070a010b, 0x080e296c, 0x17141326, 0x013b011e, 0x26222315, 0x11352627, 0x01213523, 0x822020ef, 0x2e202020, 
-    0xd72b4318, 0x307f50e9, 0xad01f55b, 0x0793d918, 0x7d63fc31, 0x9c1e213e, 0xc26a3832, 0x00904202, 0x41030000, 0x05290507, 0x000b00f3, 0x00290017, 
-    0x05014599, 0x477a2320, 0x4b1a2b0b, 0x07060600, 0x07070059, 0xf0834b15, 0x4a185b20, 0x20270c08, 0x05000400, 0x965f0504, 0x4c062431, 0x7024401b, 
-    0x0731073b, 0x00630001, 0x04060007, 0x00610607, 0x04050504, 0x214f8657, 0xee820504, 0x25054070, 0x26272829, 0x1f6d1f21, 0x1bf3790d, 0x01410320, 
-    0x5b022011, 0x87200af6, 0x200d0741, 0x0be55b29, 0x4165fc21, 0x02200c0d, 0x0a5bdb18, 0x84001822, 0x23121342, 0x59040303, 0x152ab182, 0x0202004b, 
-    0x05005b05, 0x83181705, 0x13420864, 0x83042005, 0x262594e0, 0x01001c40, 0x84000106, 0x00042620, 0x03040203, 0x41448a61, 0x182705ea, 0x11121316, 
-    0x410c0e10, 0x013e15ea, 0x11353233, 0x11213521, 0x012b0614, 0x2020a202, 0xfd202082, 0xfeb4eaca, 0xb2f501c3, 0xdb18fea6, 0xfa280976, 0xfb8fe503, 
-    0x00d2c48c, 0x012c0082, 0x00004100, 0x14065704, 0x8a001b00, 0x0d8be618, 0xf5790020, 0x23928206, 0x03590100, 0x23059451, 0x59060202, 0x2409316d, 
-    0x4058503a, 0x2127871d, 0x18820200, 0x5d060222, 0x00282f8a, 0x23401b4c, 0x06010200, 0x0a867118, 0x2f896120, 0x02224b85, 0xde824d06, 0x0a8de618, 
-    0x2b1d062b, 0x33352313, 0x21113311, 0x8de61815, 0xbeff2712, 0xc001b8be, 0xd41840fe, 0x28080a30, 0x018fd103, 0x8f4cfeb4, 0x626173fe, 0xbefee5e0, 
-    0x8e974201, 0xfbfeacb6, 0x00020000, 0x04e3ff76, 0x007b04b8, 0x0131001a, 0x05cf632b, 0x18002821, 0x2009df60, 0x08ae7b15, 0x004b1c27, 0x4b140202, 
-    0xde601800, 0x88202011, 0xde60182f, 0x83358207, 0xdd601826, 0x9324200e, 0x23539227, 0x40585035, 0x3a2083ab, 0x0c396118, 0x60180620, 0xb6840dda, 
-    0x0059032a, 0x02150303, 0x29401b4c, 0x0fda6018, 0x02060024, 0x60180600, 0xdd8708d9, 0x08d86018, 0x00011726, 0x1d1f282a, 0x0ad46018, 0x1a011a23, 
-    0x066b5409, 0x0bd36018, 0x2005e66d, 0x05bf5b03, 0x087c8c18, 0x07065b08, 0x1415010e, 0x4e3c0316, 0x08406486, 0x8eb8b88e, 0x83644008, 0x688c504d, 
-    0x8a693e3c, 0x26471bd6, 0x171a4927, 0x441a381b, 0x1c452624, 0x1d1c1d1b, 0x78be8447, 0x60041cfe, 0xc07f1afe, 0x92484181, 0xdd9995de, 0x10014590, 
-    0x3f3f3a3b, 0xc665a439, 0x3d37356e, 0x629f3c3d, 0x9f429c62, 0xfe4b3605, 0x067c0456, 0x00250014, 0x1a0b408c, 0x01000101, 0x0200254a, 0x06d56c01, 
-    0x07001f2a, 0x07010000, 0x01066300, 0x075b4f18, 0x184b1521, 0x2107f46b, 0x9d4a0114, 0x871c2007, 0x04002626, 0x01040100, 0x2d2d8a5d, 0x401b4c02, 
-    0x03040022, 0x05550401, 0x18820301, 0x02030723, 0x222e8961, 0x83590104, 0x594d2631, 0x230b4059, 0x26008311, 0x06082913, 0x6c012b1c, 0x232605d5, 
-    0x11150622, 0xae421123, 0x0e14300f, 0x95020702, 0x2f506b3c, 0x42563315, 0x42b88a90, 0x7a3508b3, 0x7a3eaeba, 0xfbfe79b6, 0xc88f540b, 0x4f744c7f, 
-    0xfeacb628, 0x0bc042fb, 0x92f1ee2f, 0x1679bbf6, 0x00020000, 0x04000032, 0x22fb82a0, 0x451d0014, 0xfb830779, 0x00720229, 0x07080005, 0x43630805, 
-    0x4b200a6b, 0x12456018, 0x02002223, 0x182c8901, 0x43074060, 0x60180ea0, 0x16282d47, 0x151a1c15, 0x261d161d, 0x0a476018, 0x554dfd89, 0xf82a2812, 
-    0xa901b8f8, 0x4d0157fe, 0xcd2a1059, 0xfeb40193, 0xcefe934c, 0x5e4d5429, 0x0300220b, 0x07ef5900, 0x18000d24, 0x60182300, 0x1c21194b, 0x4b60184b, 
-    0x021c242e, 0x18401b4c, 0x37284b60, 0x0e0e191a, 0x1e1f0001, 0x231a2319, 0x180e180e, 0x07091214, 0x0d010d00, 0x084b6018, 0x013e3728, 0x11123233, 
-    0xa67b0210, 0x0254080f, 0x7bf6e968, 0xeb79ae3c, 0x0431f5f6, 0x46684525, 0x25456746, 0x461b0104, 0x07244264, 0x2407d3fd, 0x011d6342, 0x0120012d, 
-    0x4e49981c, 0xe2fed2fe, 0xd4fee0fe, 0x8d588002, 0x62353562, 0x1cfe588d, 0x42755732, 0x32577542, 0xbb000100, 0x2d040000, 0x0d006004, 0x1a4f6018, 
-    0x60181520, 0x1520254f, 0x334f6018, 0x35230122, 0x3c058845, 0x11211521, 0x823d0123, 0xfdf00282, 0xfea001c8, 0xf401b860, 0xb8c201aa, 0xfeaaf6fe, 
-    0x05ab430c, 0x56fee324, 0xab823404, 0x8b002122, 0x20052748, 0x21601822, 0x22a9820f, 0x18140202, 0x440efd52, 0x601805df, 0x31821653, 0x18000021, 
-    0x20088060, 0x4e601840, 0x22601823, 0x20292f08, 0x2b1b0607, 0x3e323301, 0x34113502, 0x6018022e, 0x33210824, 0x0f541832, 0xac1b2c09, 0x0f294637, 
-    0x43563113, 0x83b8fcfe, 0xfa2e08db, 0x205aa382, 0x5a825428, 0x17f2fec1, 0x014a6039, 0x31615508, 0x0419fe0c, 0xcffeb860, 0x72945621, 0x996bf2fe, 
-    0x01002f63, 0xe2fe3b00, 0xef82ae04, 0x60181720, 0x15202327, 0x23276018, 0x18001521, 0x64392760, 0x13260904, 0x04231133, 0xf5633418, 0x03012105, 
-    0x22060764, 0x63964dcd, 0x0b6409f1, 0xfeca220e, 0x29cf824c, 0x0475fea9, 0x007b0428, 0x60180041, 0x3d200a23, 0x2c236018, 0x60181c20, 0x358a3423, 
-    0x1808ce67, 0x201f2360, 0x2360181c, 0x18242031, 0x643c2360, 0x04270a5e, 0x9b6b3728, 0x182e3063, 0x24084d5d, 0xaf57291f, 0x1d6b6464, 0x46410129, 
-    0x0a385773, 0x18335f39, 0x24072360, 0x013a491d, 0x1d7d641a, 0x26055743, 0x04e2fed8, 0x1860049e, 0x21202760, 0x60184b15, 0x15201f27, 0x3d276018, 
-    0xfe1dda26, 0xbebe8962, 0x27056162, 0x02c48678, 0x3ffe8142, 0x22086362, 0x852afefe, 0x56b720af, 0x601808e7, 0x15261a27, 0x0001024b, 0x5c181400, 
-    0x1c200840, 0x25083d49, 0x06070006, 0x60185d07, 0xb4840927, 0x42276018, 0xb80e042f, 0xb8b819fe, 0xc3b8e701, 0xfef901c3, 0x24b88207, 0xfcbd0143, 
-    0x34b68258, 0xfea50001, 0x04070475, 0x002f007b, 0x2c1840c6, 0x2d050001, 0x2e818209, 0x04020a0d, 0x03011601, 0x02011504, 0x184a0503, 0x200f2360, 
-    0x2360181c, 0x182e8a2d, 0x20212360, 0x2360181c, 0x282a2a2c, 0x181a1f20, 0x05071214, 0x06296700, 0x06220123, 0x086a7615, 0x13256018, 0x34350322, 
-    0x21084b50, 0x2f5ed302, 0x743c2206, 0xf962183c, 0xbd77230c, 0x545e4784, 0xdf032108, 0x22063e5e, 0x18082623, 0x260ceb62, 0x96550638, 0x5e8a85d5, 
-    0x002b0764, 0xd6000100, 0xfc03e2fe, 0x18006004, 0x20191f60, 0x1f601815, 0x18152026, 0x21401f60, 0x7f5eb8c5, 0xc3c32705, 0xb2b2ae03, 0xa7420afd, 
-    0xfe5c2407, 0x82740456, 0x000822a3, 0xbb431934, 0x503a310a, 0x010c4058, 0x15000001, 0x0202004b, 0x1b4c0217, 0x02220e84, 0x0e857200, 0xb5592d08, 
-    0x03111212, 0x252b1706, 0x01093301, 0x23110133, 0x54fe0802, 0x014901c3, 0x54fec349, 0x4e0412c0, 0x6c0394fc, 0x44feb2fb, 0x00010000, 0x10226387, 
-    0x60184d00, 0x63830a0b, 0x0e0b6018, 0x06236d82, 0x61061706, 0x022305e4, 0x18720201, 0x20092a60, 0x24188400, 0x110a4059, 0xe45f1811, 0x23052408, 
-    0x85353335, 0x33152480, 0x82152315, 0xc8c82184, 0xc8258689, 0x96b9c0c8, 0x228a8735, 0x83f19635, 0x5b60208b, 0x0f26069f, 0x0e406d00, 0x5f18080b, 
-    0x5e2018df, 0x1808825f, 0x2010df5f, 0xdf5f185e, 0x18152008, 0x2517df5f, 0x0304005a, 0x5f184e04, 0xd6281cdf, 0xfeb8fe12, 0xb801d5b9, 0x0ab5a218, 
-    0xc48c2d26, 0x3ffec101, 0x09b5a218, 0x4170fe21, 0xc32f07a7, 0x1b040000, 0x13001406, 0x02b56700, 0x70030201, 0x16210725, 0x06ad7800, 0x824b1c21, 
-    0x59022196, 0x200d3a65, 0x24358213, 0x02000201, 0x5425885d, 0x5f180595, 0x132c1ae0, 0x10231323, 0x2b190605, 0x3e113313, 0x1006f518, 0x724eb820, 
-    0x1406260a, 0x6261a4fd, 0xfcf418e0, 0x01012c0b, 0x020000c7, 0x001f067f, 0x482d0003, 0x0b2005ff, 0x012b9682, 0x01010059, 0x1b4c0114, 0x82001040, 
-    0x55002109, 0x00361386, 0xb4594d01, 0x06021011, 0x33012b16, 0xc7012311, 0x1f06b8b8, 0x4282e1f9, 0x33053b6c, 0x09004806, 0xf4001d00, 0x1a1b0c40, 
-    0x10131617, 0x0407070d, 0x7960f883, 0x010a210b, 0x5b2b2e82, 0x13020200, 0x0205064b, 0x18150404, 0x230b5d5f, 0x4058501e, 0x9c067960, 0x56352027, 
-    0x5e1806ad, 0x4d8c10eb, 0x8b07d356, 0x8f511825, 0x1815200b, 0x082deb5e, 0x011b4027, 0x191c1d00, 0x12141518, 0x0c0e0f11, 0x0607080b, 0x00020304, 
-    0x0b090109, 0x012b1406, 0x16330320, 0x33373233, 0x13d96c02, 0xfe68022d, 0x167717de, 0x771ca7ac, 0x6cb3fd17, 0x05290fe5, 0x961f0129, 0xfde1fe96, 
-    0x18ed6ca3, 0x01000035, 0x56fed800, 0x60045904, 0x85002300, 0x01130a40, 0x180e0305, 0x4a17df5e, 0x5e1818b3, 0xac4a11df, 0xda5e180e, 0x05a54a1c, 
-    0x12111222, 0x180fa54a, 0x2016b75e, 0x08a74a16, 0xbe27dd29, 0xe0e301be, 0x4a3afdfd, 0x262014a9, 0x20089247, 0x0aad4a17, 0xcd20f383, 0x2420f382, 
-    0x1805af4a, 0x9a12bf5e, 0xbf5e18e7, 0x18e7900f, 0x4b119b5e, 0xe78308b3, 0x5e182520, 0x8d4b0995, 0x955e1806, 0x840b200f, 0x069e47dd, 0x210a7c4b, 
-    0xa7470d02, 0x8cfb2607, 0x2f63996b, 0x2ec78300, 0x04e2feaf, 0x00620407, 0xb57f001c, 0x18030102, 0x18085d65, 0x2007745e, 0x18258264, 0x8207975e, 
-    0x895d18aa, 0x05755507, 0x01000325, 0x87010300, 0x975e1822, 0x18152008, 0x820b975e, 0x1805201d, 0x301b975e, 0x28132313, 0x1b060710, 0x1133252b, 
-    0x06360706, 0x12b11807, 0x3d48080d, 0x23113301, 0x8c022311, 0x013c1bc3, 0x612b1f10, 0xb9a8ad3a, 0x8a837169, 0xb8c3b8b8, 0x24337e01, 0x19120a01, 
-    0x01e5e019, 0x97f5fe0b, 0xceacb68e, 0xe2fe9efb, 0x8f000300, 0x6804e3ff, 0x0b003106, 0x59004800, 0x0a40d401, 0x0fdf3b19, 0x5a183420, 0x0b3d08e9, 
-    0x02070001, 0x05006400, 0x05090a00, 0x0600630a, 0x005b0706, 0x4b1c0707, 0x14080800, 0x483a194b, 0xbc571808, 0xa130200a, 0x2236853b, 0x18020c08, 
-    0x2307f457, 0x4058500f, 0x112073b7, 0x73b33b82, 0x37823520, 0xab833320, 0x00720123, 0x20e6ad02, 0x203a8a3a, 0xa83b1908, 0x061c2127, 0x43a83b19, 
-    0x4a254022, 0x21a73b19, 0x5306d944, 0x33260543, 0x27220102, 0xa018012e, 0x07220df5, 0x41190706, 0x6820383e, 0x250bdd65, 0x65ae7dfe, 0x41193630, 
-    0x05213d4c, 0x07fc6512, 0x61d1fa22, 0x41574119, 0xdf420420, 0x00102a06, 0x0017000b, 0x02650054, 0xc3381902, 0x05615826, 0x210adf42, 0x3819010e, 
-    0x511807c3, 0x2e200958, 0x13eb4318, 0x3485398b, 0x420d0821, 0x32200cdd, 0x0024359f, 0x4b140808, 0x11216f8f, 0xc3381950, 0x206f9c16, 0xb5358220, 
-    0x4335206f, 0x0c25064b, 0x00030b02, 0x9a441807, 0x0ef7430a, 0x3a20a78f, 0x00203783, 0x18060a43, 0x8b072044, 0x952e193f, 0x061c2510, 0x37401b4c, 
-    0x2e193294, 0x5923278f, 0x19562940, 0x5a250139, 0xe2180eac, 0x1b430d80, 0x374f184b, 0x4395200d, 0x4620421a, 0x210b285a, 0x1e439dfa, 0x03002142, 
-    0x2f06db77, 0x000b0031, 0x01300029, 0x260a4008, 0x27060701, 0x2406d977, 0x40585011, 0x08c3452f, 0x00010a27, 0x64000205, 0xf115190c, 0x77002007, 
-    0x0b210ddb, 0x07c24501, 0x36823520, 0x4e452e20, 0x2035a807, 0x2035823a, 0x2035982b, 0x205e8207, 0x0ee17707, 0x2d8e3120, 0x8907e477, 0x770720a1, 
-    0x3e8408e4, 0x59594f25, 0x19234059, 0x6a159b14, 0x0d2009db, 0x770e3345, 0x022120d4, 0x0b064577, 0xd577f520, 0x0ae1441e, 0x291ed177, 0x00020000, 
-    0x04e3ff8e, 0xbb7b046b, 0x63601805, 0x4b1c2123, 0x08186018, 0x501b0021, 0x01210ae8, 0x3c601800, 0x63601807, 0x181c200d, 0x2f2b6360, 0x00011e1f, 
-    0x241e2122, 0x1315241f, 0x06070c0e, 0x260bbc7b, 0x3521013d, 0x18022e34, 0x080cd59a, 0x27020e38, 0x21373632, 0x62021614, 0x3f78ae6f, 0x5d311d03, 
-    0xbf5a5688, 0x5ec16a6d, 0x4c8ecd82, 0x77c0894b, 0xfd11ab88, 0x4b1d96a2, 0x5a7ec88c, 0x628f5b06, 0xb7393833, 0x18412b2b, 0xad9c2807, 0x00a9a39f, 
-    0x41040000, 0x06200507, 0x2405c745, 0x013c0035, 0x5f601802, 0x1820200d, 0x4517f75f, 0x0d200b1d, 0x0e405418, 0x440c837a, 0x092406a2, 0x61090508, 
-    0x8f09e244, 0x0c837a32, 0x5f18328b, 0x1c2410f7, 0x401b4c06, 0x32f75f18, 0x37274022, 0x2b06847a, 0x3c36393a, 0x2b2d3c37, 0x1e1f2426, 0x232b847a, 
-    0x022e2201, 0x201c8d41, 0xca4e1801, 0xdbfe210b, 0x201d9a41, 0x0e764405, 0x201ca941, 0x05474e03, 0x2206bb5f, 0x18a0002b, 0x200fef5f, 0xa75f1835, 
-    0x4e1a200f, 0x3a201245, 0xf64d2491, 0x865f1810, 0x835f1824, 0x13034e39, 0x210cd145, 0x044ecbfd, 0x0b9f4511, 0x211c0a4e, 0xfb7a0300, 0x06cf4205, 
-    0x05014722, 0x097f5f18, 0x5f183e20, 0x20200e7f, 0x17195f18, 0x004b1a2a, 0x5b090808, 0x1c090900, 0x0f7f5f18, 0x178d5418, 0x31986320, 0x178d5418, 
-    0x54186320, 0x1c200f8d, 0x34195f18, 0x07175f18, 0x3135372d, 0x28292b2f, 0x181e2026, 0x7d471947, 0x5f180b55, 0x21573717, 0x1415250a, 0x4e01020e, 
-    0x210a6861, 0x8d7bb7fe, 0x0ee04223, 0x9c7ba420, 0x00003b24, 0x91000100, 0x68044cfe, 0x25006004, 0x12406f00, 0x03050118, 0x05020113, 0x04820106, 
-    0x2d06b764, 0x4058503a, 0x0005001e, 0x02050102, 0x84610063, 0x01012809, 0x01065b00, 0x59170000, 0x0426057a, 0x04050300, 0x28886103, 0x59251e8a, 
-    0x00011340, 0xe25e181a, 0x25002308, 0x6f632501, 0x022e2105, 0x0d587818, 0x5e180120, 0x45080fe0, 0x64603127, 0xc7553968, 0x30c6bf6d, 0xae52825a, 
-    0x65fdae01, 0x65fe6a03, 0x696f6f30, 0x4f272a2b, 0x4cfed695, 0x141c1208, 0x963231c3, 0x486a448c, 0xf301a626, 0x24fea893, 0x384f3117, 0x6d4a7637, 
-    0x003e75aa, 0x037c0200, 0xbc052705, 0x0d000300, 0xf77a8d00, 0x18282009, 0x250ba75e, 0x01034b13, 0xf77a0202, 0xa75e180b, 0x181c8b10, 0x2516a75e, 
-    0x1b4c0415, 0x5e181b40, 0x117b1da7, 0x1521230c, 0xd27b0721, 0x3d012608, 0xaafd5602, 0x07cd777a, 0x94bc0523, 0x0a0f7bc8, 0xc7860320, 0x0b00f428, 
-    0x21001700, 0x5e188f00, 0xaa8309a3, 0x0c5f5e18, 0x7c4b1a21, 0x228e13a7, 0x06010725, 0x84590406, 0x82062028, 0x181f20b6, 0x1820405e, 0x25393d5e, 
-    0x11231133, 0x7c442301, 0x8850200d, 0x442a20e7, 0xca200b74, 0x0021f28a, 0x05d35e04, 0x27066344, 0x00330027, 0x20b04bd2, 0x0fe35d18, 0x8c621a20, 
-    0x105e180a, 0xe35d180f, 0x181c2018, 0x18103b5e, 0x2021e35d, 0xe35d181c, 0x2340352e, 0x18192829, 0x00010c0d, 0x33282d2f, 0x1f213329, 0x27192718, 
-    0x2be15d18, 0x15bbea18, 0x210c4841, 0x4e79f5fe, 0x0e104412, 0x5d799d20, 0x3720101a, 0x05200b01, 0x260c6f42, 0x00300025, 0x42fe003b, 0x5d180571, 
-    0x1a211571, 0xa75d184b, 0x4b1c2107, 0x0fdb5d18, 0x21715d18, 0x5d183391, 0x1c202a71, 0x37715d18, 0x322b4025, 0x42262631, 0x37310597, 0x323b3136, 
-    0x2630263b, 0x212a2c30, 0x1925181f, 0x0b9d4225, 0x206f5d18, 0x4218ca61, 0xd7610ea1, 0x10af4220, 0x2724e661, 0xd7000300, 0x3904e3ff, 0x36061f44, 
-    0x4001013c, 0x08013012, 0x07012f09, 0x05011c08, 0x04011b06, 0x414a0405, 0x2c2105bf, 0x05884f00, 0x0c0d5d18, 0x18327f48, 0x48080d5d, 0x7f4810b1, 
-    0x48612017, 0x5d18307f, 0x7f48140d, 0x32342d07, 0x26272b2d, 0x1e202425, 0x3c193c18, 0x6b307f48, 0x012116fc, 0x0b744849, 0x096cb820, 0x0fb04120, 
-    0x2e1d186c, 0xfe680002, 0x05810456, 0x000300bc, 0x18780023, 0x20090f5d, 0xcb5c1828, 0x4b132c0b, 0x03030104, 0x02004b15, 0x6a5c0502, 0x5d180c06, 
-    0x208d0c0f, 0x181c4021, 0x8812ad5c, 0x5959243f, 0x182f0940, 0x230fa55c, 0x033e3736, 0x10d7bb18, 0x20057c47, 0x22dc7985, 0x94bc0524, 0xd579c8f9, 
-    0x8603201d, 0x00ea28ef, 0x0017000b, 0x18700037, 0x2009b35c, 0x675c183a, 0x4b1a210f, 0x1812d77a, 0x231daabb, 0x594c0717, 0x21058c47, 0x5c183537, 
-    0xfd953017, 0x0ccb8c18, 0x05414520, 0x47202023, 0xf9210bb5, 0x1d1041d0, 0x7a000021, 0x812206e7, 0x09827006, 0x27000724, 0x5c185a00, 0x3a200927, 
-    0x11ba5b18, 0x230ee77b, 0x0501061e, 0x119a5b18, 0x2209e27b, 0x182f0b40, 0x9415915b, 0x17022bed, 0x0289e0aa, 0x87f8b30c, 0xeaa220fe, 0xfe700629, 
-    0xfe780188, 0x9ff8f988, 0x000322e4, 0x2de882a5, 0x00f505fd, 0x0017000b, 0x40aa0033, 0x5b182f0a, 0x35200aa3, 0x17515b18, 0x074b1a25, 0x82050501, 
-    0x080823f3, 0x83180814, 0x062109ed, 0xcd5b1800, 0x4b1a2210, 0xefd11800, 0x18152007, 0x2d2c2b5b, 0x0c0d1d40, 0x32330001, 0x292b3031, 0x086e2324, 
-    0x540b200d, 0x03251a51, 0x2223030e, 0x09e57a2e, 0x37023e28, 0x23113311, 0x2f446701, 0x7a38200a, 0x262c09f2, 0x25315842, 0x1e393b40, 0x2b05b8b8, 
-    0x200c156e, 0x0b027ba7, 0x294c4027, 0x170e050c, 0x06047b11, 0x24010122, 0x18063b79, 0x2018235b, 0x0df66015, 0x18001a21, 0x2115235b, 0x5b180215, 
-    0xdc313a23, 0xfdf002b8, 0x04c3c3c8, 0x10fdb860, 0x00002afe, 0x05b37605, 0x26060b50, 0x00280024, 0x5cbd0031, 0x29200503, 0x24150157, 0x04040107, 
-    0x235b1815, 0x503a2410, 0x182a4058, 0x210e565a, 0x5b18020c, 0x1a27095b, 0x0601084b, 0x84590406, 0x965a183d, 0x25403334, 0x0c0d292a, 0x2e300001, 
-    0x312a3129, 0x25262728, 0x5a182224, 0x0c773493, 0x0cc9470f, 0x77f5fc21, 0x0520141a, 0x200cff6f, 0x052d75c9, 0x77a4a721, 0x4b180d27, 0x14310e2b, 
-    0x15010201, 0x0a020301, 0x2c030401, 0x2d040501, 0x8b5a1801, 0x1c2f741a, 0x5a186320, 0x1c200f8b, 0x18132f74, 0x29178b5a, 0x2022282a, 0x17191d1f, 
-    0x01641113, 0x2e421807, 0x8c5a1807, 0x34421808, 0x8b5a1809, 0xb54a0811, 0x4687c27d, 0x41674927, 0x763f8078, 0xd29e69a8, 0x8e48ac69, 0xa6888f94, 
-    0x52764b9f, 0x63afb42b, 0xb4614eb4, 0x7f593016, 0x48603b4f, 0x80190c2f, 0x4c6b4360, 0x1ba73029, 0x44455519, 0x341c9056, 0x695b2d49, 0x1cad2223, 
-    0x0082001c, 0x84000231, 0x1a0452fe, 0x14007704, 0xd6002000, 0x180010b6, 0x220c6b44, 0x18150202, 0x210e6b44, 0x35825b00, 0x126b4418, 0x025b0123, 
-    0x8f441801, 0x25238f07, 0x40585035, 0x4ba10020, 0x44183a20, 0x0024076b, 0x63000403, 0x4418308e, 0x2887146b, 0x156b4418, 0x28131128, 0x18060722, 
-    0x1d19252b, 0x232110ff, 0xabf81801, 0x6103380a, 0x6369972e, 0x3c3c70a0, 0x6763a070, 0xa7122e99, 0x86f2feb9, 0x82868888, 0x558b3900, 0xd9985057, 
-    0x98db898a, 0x8f545651, 0x2902f6f9, 0xdad6d6da, 0xd9d7d7d9, 0x08bf5a18, 0x21abca18, 0x0bc25a18, 0x15a55a18, 0x18001521, 0x2615a55a, 0x121112b7, 
-    0x18051012, 0x210aa45a, 0xca182301, 0x012c20ab, 0x0000d500, 0xd505d104, 0x78000d00, 0x20053b44, 0x5577181a, 0x03032708, 0x01025900, 0x93180000, 
-    0x20200f28, 0x2d862196, 0x9f820420, 0x82021d21, 0x01032437, 0x87610300, 0x8202202b, 0x59042610, 0x00040106, 0xde8c1804, 0x11332810, 0x15211121, 
-    0x82231121, 0xd5233a07, 0x016c01ba, 0xbae4fed6, 0x05ba94fe, 0x029cfdd5, 0xd5faaa64, 0x39fdc702, 0x22008200, 0x83b90001, 0x600421af, 0x1521af9b, 
-    0x2066824b, 0xd8931804, 0x85af9109, 0x20af8521, 0x23afbe15, 0x9a01a8b9, 0xd224af82, 0xa866fea8, 0x26059079, 0x0236fc96, 0x43fdfd03, 0x05820533, 
-    0x2a77de19, 0x004b1328, 0x59050404, 0xdf600107, 0x0025320b, 0x09030002, 0x0a610302, 0x06000901, 0x61060904, 0x77de1900, 0x01132e0f, 0x2b401b4c, 
-    0x01080000, 0x01000201, 0x23309261, 0x55040505, 0x04255b87, 0x59594d05, 0x77de1940, 0x1d062510, 0x1521012b, 0x84058a41, 0x23033107, 0x03231101, 
-    0xef029a01, 0x3301aefe, 0x6501cdfe, 0x2177de19, 0xe3ff2936, 0x7b04b004, 0x3e003100, 0xc8004d00, 0x0f141440, 0x0e030202, 0x2f269782, 0x05060229, 
-    0xc182012a, 0x69424a20, 0x0d262205, 0xcf451909, 0x4b1c2412, 0x19020a0e, 0x5908cf45, 0x23200962, 0x21832d8a, 0x020c0725, 0x19000600, 0x200acf45, 
-    0xcf45191c, 0x402f0833, 0x0132323f, 0x3f454700, 0x324d404d, 0x393e323e, 0x272b2d37, 0x181d1e25, 0x0c111316, 0x0005070a, 0x0f310131, 0x052b1406, 
-    0x34352622, 0x18013b36, 0x200b57b4, 0x059e7817, 0x21011d32, 0x1415010e, 0x3233021e, 0x06153736, 0x27262223, 0xab59ee82, 0x0e8e0805, 0x01011d02, 
-    0x013e3732, 0x2223013d, 0x1415020e, 0x9b650116, 0x75c0c7a1, 0x82385f63, 0x3f824e3f, 0x7d2049b1, 0x4b775567, 0x0115fe22, 0x53341701, 0x31824b3b, 
-    0x936d9571, 0x0284291f, 0x3f271344, 0x283d2c2b, 0x5eb2fe12, 0x31141125, 0x1d436f52, 0x9fad1d58, 0x7958b1b1, 0xa8272b7f, 0x397f2123, 0xd0803846, 
-    0x240f5a97, 0x4c785516, 0xac333323, 0x534c5454, 0x34ae024d, 0x20456c4b, 0x4e704621, 0x43ecfd2b, 0x48667420, 0x354a2e15, 0xbf185f64, 0x03270afb, 
-    0x5f000600, 0x180105b5, 0x2f09b54e, 0x00000011, 0x01034b25, 0x5a010202, 0x26010100, 0x20086973, 0x2413820e, 0x01020100, 0x2520835e, 0x401b4c00, 
-    0x48820017, 0x15827220, 0x02010123, 0x08308755, 0x4e010230, 0x0b405959, 0x06040404, 0x10110604, 0x2b160704, 0x21013301, 0x01010925, 0xc901f5ee, 
-    0x850379fb, 0xbefebefe, 0x2bfad505, 0xfb7904aa, 0x6f180087, 0x90200fb3, 0x175f9218, 0x13722d20, 0x822e200a, 0xb04b267f, 0x4058503a, 0x37921820, 
-    0x82002008, 0x825b20b1, 0x20278bb1, 0x21278229, 0x92181e40, 0x04201362, 0x82051a56, 0x5c921820, 0x1807201c, 0x720d45ae, 0x9218100e, 0x6d18075c, 
-    0x6f1817a8, 0x012f25b0, 0x54fec300, 0x60049e04, 0xc2002000, 0x8231b04b, 0x120c2ed7, 0x1e000101, 0x04031318, 0x1b4a0201, 0x200e8240, 0x200e8803, 
-    0x39228559, 0x00010218, 0x034b2800, 0x04010101, 0x0401055b, 0x004b2e04, 0x062a0606, 0x42411b4c, 0x001f2105, 0x20051065, 0x20278570, 0x20269200, 
-    0x9769823a, 0x87292026, 0x8840204d, 0x21428821, 0x53834b29, 0x85590621, 0x5959396f, 0x130a4059, 0x13132723, 0x07071023, 0x33132b1b, 0x33161411, 
-    0x11353632, 0x37280885, 0x0e153736, 0x27222301, 0x38080483, 0x23112726, 0x7077b8c3, 0x20b98080, 0x0d110721, 0x2244261d, 0x842e187d, 0x2d7d5d5a, 
-    0xfd6004a7, 0xa9968f48, 0xfc8d02a7, 0x05373ca0, 0x17940e04, 0x4d519e16, 0xd5fd514b, 0x39008200, 0xff770001, 0x055a04c4, 0x002a00d5, 0x260f4063, 
-    0x16191a1d, 0x29010205, 0xa8180203, 0x112609c8, 0x01010103, 0x10824b39, 0x825b0021, 0x42422032, 0x0e230829, 0x82000200, 0x845f2002, 0x1801201f, 
-    0x2008714d, 0x20168472, 0x352f8657, 0x594f0002, 0x261cb659, 0x08042416, 0x2e052b18, 0x23062701, 0x84182622, 0x17250894, 0x3233011e, 0x25158237, 
-    0x17011e37, 0xe084013e, 0x82070621, 0x074d080b, 0x562d1404, 0x6ea8712d, 0x403d3cad, 0x1d1d13ca, 0x364a5668, 0x891c5f3d, 0x0d36521c, 0x2223ca09, 
-    0x46203f1f, 0x1d32143c, 0x3c3c3b44, 0x0c047db6, 0x5b2db6fb, 0x14302626, 0x5c336a36, 0x1f2d5e33, 0x4a042040, 0x915df4fb, 0x0e201239, 0x2aeb859e, 
-    0x04000080, 0x00f00550, 0x41850021, 0x203005d0, 0x03020100, 0x70030102, 0x04000300, 0x61040305, 0x0022b486, 0xc1194b41, 0x27890cd8, 0x05040523, 
-    0x202c9073, 0x20fb8202, 0x844a8825, 0x00002622, 0x02000102, 0x25b51963, 0x00593509, 0x4d040304, 0x09405959, 0x26161111, 0x08062516, 0x34132b1a, 
-    0x09c29a18, 0x23011d2f, 0x27263435, 0x2223012e, 0x010e0706, 0x05b84715, 0x40803708, 0x72a93c3d, 0x3c3dad70, 0x1d13ca40, 0x5656691d, 0x131d1d67, 
-    0xfafc0603, 0x7d0c04ca, 0x3b3b3cb5, 0xb53c3c3a, 0x2ddfa17d, 0x2f26265a, 0x5a26262f, 0xaa23fe2d, 0xef833dfe, 0x55000222, 0x7c20ef82, 0x1824ef82, 
-    0x7e002c00, 0x1b2bf185, 0x02020607, 0x04000103, 0x18630002, 0x2507c14e, 0x04004b41, 0x656f3a04, 0x0004230a, 0x27937304, 0xe7820520, 0x83002221, 
-    0x0100271d, 0x01020500, 0x25836305, 0x02000023, 0x22078357, 0x825b0002, 0x00022258, 0x2de4824f, 0x1919190f, 0x272b192c, 0x29161111, 0xea820820, 
-    0x65210121, 0xf08905c0, 0x33111528, 0x23112315, 0xf58b0119, 0x1716143e, 0x0333011e, 0xddf3fe35, 0x3f423d77, 0x70ac3c3c, 0x3c3dae6f, 0xca7d7d41, 
-    0x6a1d1d14, 0x1c39fe82, 0x1c13131c, 0x0157671c, 0xc84280c3, 0x40ca8c92, 0x403b3b40, 0xfe90c940, 0x33f68291, 0xb5016d02, 0x2a2a6b37, 0x31313634, 
-    0x87515187, 0x00363130, 0x0482aa82, 0x419b0421, 0x00220ef7, 0xf7410003, 0x23c4820b, 0x0202005b, 0x8611f741, 0x0cf74127, 0x00202c87, 0x8b05f741, 
-    0x82022022, 0x0002216f, 0x8b1ef741, 0x011d22f2, 0xb2c61823, 0x011e2109, 0x21061541, 0xed411603, 0x42ca2009, 0xbb240903, 0x4a04cabb, 0x2109ea41, 
-    0x0242a1df, 0x61fe2109, 0xeb82ff82, 0xe3ff802a, 0xd5055004, 0xbc002100, 0x2c05f141, 0x03050023, 0x04050304, 0x01010070, 0x79c31839, 0x4b3c2308, 
-    0xb1450400, 0x09d04306, 0x2a882020, 0x6c610420, 0x2e328c06, 0x4b1b4c03, 0x58503eb0, 0x01002040, 0x90720102, 0x0303272c, 0x02005902, 0x27823c02, 
-    0x8d264021, 0x00022c22, 0x03020503, 0x00040061, 0x87570400, 0x00042379, 0xad7d594f, 0x1a1b3205, 0x0b0c1214, 0x0708090a, 0x21012100, 0x2b140807, 
-    0x08234405, 0x21152123, 0x05164211, 0x3736322f, 0x013d013e, 0x06141533, 0x02010e07, 0x051a4454, 0xfc060333, 0x1d1d13fa, 0x69565667, 0xca131d1d, 
-    0xb03d3c40, 0x0612441d, 0xaa8bfe35, 0x5b2dd5fd, 0x30302626, 0x2d5b2626, 0xb67da1df, 0x743a3d3c, 0x60200527, 0x71298982, 0x3300f005, 0xb04bbe00, 
-    0x33d4820f, 0x02030024, 0x00030200, 0x01000070, 0x00660001, 0x5b040202, 0x4128a982, 0x0101054b, 0x005a0601, 0x0b6ff618, 0x2b8a2520, 0x01000223, 
-    0x202c986e, 0x2058823a, 0x822c8e22, 0x0600244f, 0x885e0601, 0x058b7c34, 0x51847d89, 0x8b820420, 0x63020422, 0x06232c82, 0x87570106, 0x06013683, 
-    0x5959594e, 0x1e110a40, 0x212d1626, 0x1b080710, 0x1533132b, 0xd9891833, 0x0a4b4308, 0x240f5842, 0x0e070614, 0x08028301, 0x21152168, 0x3433cb8c, 
-    0x6f3d3b73, 0x222c302a, 0x5670262a, 0x27277553, 0x4550cb25, 0x726fbb45, 0x4e4e47b8, 0x531f2225, 0x24572d2e, 0x43fc6701, 0x31a14b01, 0x5081302e, 
-    0x6074c25a, 0x32363dad, 0xaf373730, 0xad141480, 0x414b4bed, 0xed514a43, 0x4fb06996, 0x33338248, 0x00aa0d40, 0x78000100, 0x59040000, 0x0900d505, 
-    0x7f428c00, 0x001a2505, 0x4b390000, 0x012bec82, 0x01010059, 0x03004b3c, 0x445a0403, 0x17270c70, 0x04000300, 0x8d5e0403, 0x42022028, 0x1720076d, 
-    0x72205683, 0x02212387, 0x82478502, 0x1d40211e, 0x01261985, 0x01030200, 0x6b456102, 0x07557109, 0x11b75922, 0x10250082, 0x2b190805, 0x08987913, 
-    0x03cb7830, 0x02eafc16, 0x05aafc8b, 0xaa8bfed5, 0xb682f4fc, 0x1b46b782, 0x00f22205, 0x073b7a1f, 0xd0451d20, 0x02022308, 0x9b825b00, 0xba844120, 
-    0xba8c5920, 0x24881a20, 0x08dc6d18, 0x91522b85, 0x075d4605, 0x25180d46, 0x261611b7, 0xa0842516, 0x271e0b46, 0x3c3d4080, 0xb06d6ead, 0x2e100946, 
-    0x7d0c0430, 0x3b3c3cb6, 0xb63c3d3a, 0x42dfa17d, 0xfc3209ee, 0x0200aa60, 0xe3ff4900, 0xf005c404, 0x49003300, 0xd37f0701, 0x05262a05, 0x01080101, 
-    0x06010706, 0x08834263, 0x3a2bdb83, 0x07010a4b, 0x095b0007, 0x44000001, 0x11240514, 0x22405850, 0x28852d93, 0x18090321, 0xa90c0bf0, 0x823a2057, 
-    0x00262857, 0x07000703, 0x89700003, 0x2555825f, 0x07000109, 0x1a435f00, 0x872d200c, 0x04002428, 0x43010200, 0xbe860513, 0x03233082, 0x88570700, 
-    0x000723b6, 0x0082594f, 0x351d403c, 0x3d000134, 0x3549343b, 0x2b2c2d49, 0x1d22242a, 0x0d14161c, 0x0133000b, 0x5c440b33, 0x36342a09, 0x3b013e37, 
-    0x26343501, 0x47018227, 0x23200777, 0x08933419, 0x1d011e2e, 0x23153301, 0x07061411, 0x3227010e, 0x35212d83, 0x83268311, 0x1582080f, 0x1e171614, 
-    0x46ee0201, 0x322d2d77, 0x792d2d32, 0x221c8a48, 0x5e3b3c23, 0x2424785c, 0x4287c41d, 0xbc7a77bc, 0x83454140, 0x2f2d3183, 0x3523487c, 0x8a111112, 
-    0x11113224, 0x10040407, 0x1d351211, 0xa7363633, 0x39ac7676, 0x80183839, 0x193837a8, 0x36363019, 0x73fc79aa, 0x2201a603, 0x4c494996, 0x95dd4a49, 
-    0xe3feaf34, 0x3c39a36c, 0x221ba438, 0x01516a20, 0x20201a1d, 0x2d451c37, 0x22206c52, 0x00820016, 0x4600022e, 0x6d04e3ff, 0x1900d505, 0xaf002d00, 
-    0x30057143, 0x0202001e, 0x01064b39, 0x5b010404, 0x01010103, 0xf96a183c, 0x09ec450a, 0x6a181b20, 0x2e8c0b41, 0x79430420, 0x001b2507, 0x72020102, 
-    0x518a2788, 0x40202282, 0x2205317f, 0x82010103, 0x01052317, 0x27826304, 0x05000023, 0x656b1857, 0x00053e08, 0x5959594f, 0x1a1b1940, 0x21230001, 
-    0x2d1b2d1a, 0x10111213, 0x0b0d0e0f, 0x19011900, 0x0e874109, 0x11213324, 0x6d411133, 0x19212010, 0x080aba9c, 0x761e024e, 0x3f3c3cab, 0xad3d3c43, 
-    0xca0d016a, 0x3e3f7d7d, 0x516aaf3d, 0x141d1d6a, 0x6757f3fe, 0x13151a1c, 0x1d671c1c, 0xd1484848, 0x48d7938f, 0x75014b48, 0xfeaa8bfe, 0x42cb8c42, 
-    0x34a43b41, 0x376b2a2a, 0x39410502, 0x51589036, 0x42393992, 0x26062f7e, 0x00d50565, 0x18a2001c, 0x2e0c0b95, 0x0302001d, 0x04020304, 0x00000070, 
-    0x75004b39, 0x44200638, 0x890d2649, 0x211f8b24, 0x33835900, 0x20084141, 0x22498a1a, 0x75040004, 0x4420085e, 0x88055e7e, 0x04012366, 0x90825500, 
-    0x01020324, 0x40826303, 0x00590422, 0x4d282d82, 0xb7595959, 0x23162616, 0x2707c144, 0x3233013e, 0x011e1716, 0x27102b4a, 0x3ccabb23, 0xae675185, 
-    0x280d1c44, 0xfed505ca, 0x3b262a50, 0x0e18443c, 0x8233fd21, 0x00b8246a, 0x82540400, 0x000522fb, 0x0535424e, 0x77821020, 0x0127ec82, 0x005a0201, 
-    0x7c3a0202, 0x0d20085b, 0x02202c82, 0x30b3c019, 0x02cbb824, 0xc019fcd1, 0x012609b3, 0xe3ff5d00, 0x6f827404, 0x02012322, 0x23058544, 0x03030021, 
-    0x04226f84, 0xe4180659, 0x00220c30, 0x8044075b, 0x901d200c, 0x05052528, 0x07025b00, 0xa40c7b44, 0x643a204d, 0x5e8205d6, 0x5f000525, 0x8a010100, 
-    0x59032179, 0xf4846583, 0x25823e20, 0x03001c2a, 0x03000200, 0x05006102, 0x01242d8f, 0x22401b4c, 0x0024b182, 0x01040501, 0x02221f82, 0x44180500, 
-    0x99830932, 0x4f213084, 0x29008359, 0x00011540, 0x14161c1d, 0xdd480d0e, 0x01232306, 0xf8420823, 0x23112109, 0x33210182, 0x0cdf4811, 0x0806014d, 
-    0x03010e5a, 0x25806f26, 0xbab71d27, 0x0d7101ba, 0x303d1212, 0x0f0f3a31, 0x241aba0b, 0x381d8125, 0x78a93835, 0x4ffc0802, 0x8bfed505, 0x664b31fd, 
-    0x1c1b1f1f, 0x4b661f1e, 0x49fdcf02, 0x3838a978, 0x00000035, 0xff360002, 0x059a04e3, 0x003000f0, 0x40170152, 0x05011b0a, 0x01011c02, 0x08fed418, 
-    0x01062923, 0x2e0e8203, 0x01010857, 0x00590201, 0x4b390202, 0x48050500, 0x534506f5, 0x060a4608, 0x58501322, 0x0320f683, 0x07232c82, 0x82630103, 
-    0x5b022328, 0x33830104, 0x3520298f, 0x5aac2982, 0x30823a20, 0x8b862620, 0x93080246, 0x4c053294, 0x002b401b, 0x02010502, 0x00040055, 0x05040305, 
-    0x86368263, 0x20398291, 0x140b4600, 0x31322f08, 0x44450001, 0x52325231, 0x1e202223, 0x0f101416, 0x0b0c0d0e, 0x30013000, 0x2b14080b, 0x022e2205, 
-    0x35012e27, 0x23373634, 0x33153311, 0x65433736, 0x06015807, 0x011e0725, 0x4a011e17, 0x07460573, 0x3e372208, 0x05ad4d03, 0x2b273a82, 0x1d010e01, 
-    0x82161401, 0x08028225, 0x4f72029f, 0x1e4f6880, 0x2e2e2e3c, 0x6034b78a, 0x5f964285, 0x2a295e2f, 0xb86c2a4f, 0x39935e52, 0x5553f8a8, 0x1a19175c, 
-    0xa53f3b55, 0x26725364, 0x050a2926, 0x0a010305, 0x3f491414, 0x0c86bb40, 0x0803252b, 0x24232509, 0x311a1d70, 0xe9582c45, 0x68e38b83, 0x80f59c01, 
-    0x09252348, 0x111c0909, 0x3a3646d7, 0x4d570434, 0x52a9ee4f, 0x75484399, 0xa42e2c29, 0x56202023, 0x38391934, 0x85461433, 0x20573638, 0xea612420, 
-    0x65362481, 0x2059392f, 0x01002521, 0x00009300, 0xd5053d04, 0x93001c00, 0x760e82b5, 0x18220803, 0x19820200, 0x63000222, 0x20071a4c, 0x0de2443c, 
-    0x04271f8e, 0x00590304, 0x443c0303, 0x182508dd, 0x01030100, 0x8a448872, 0x1d40211f, 0x03241a85, 0x55030402, 0x03232088, 0x4f590403, 0x592b0606, 
-    0x261611b7, 0x08052216, 0x50012b19, 0x2e2005c4, 0x2105fc4f, 0x47181716, 0x112b0836, 0x03231133, 0x5c823673, 0x503baa6a, 0xe44b0503, 0x01ca2d07, 
-    0x3d2b24af, 0x7db63c3a, 0x33fd8f02, 0x2309f248, 0xa0fb5801, 0x4724e082, 0x6204caff, 0x2439ef82, 0x24b72200, 0x0e111c23, 0x4b470005, 0x58503ab0, 
-    0x000000b5, 0x1b4c0039, 0x280782b3, 0x1fb35969, 0x2b150801, 0xc6f61901, 0x37032409, 0x4b133303, 0x05820524, 0xe2470620, 0x174c0805, 0x40011501, 
-    0x2220543c, 0x34796927, 0x4e978d7e, 0x6fd9eeb5, 0x9b5957ca, 0x10291d36, 0x0f0d0f1f, 0xbf021830, 0x2e180a01, 0x293f1c1a, 0x2c669f3d, 0x2a5a5d5d, 
-    0x89fe3b01, 0x38367135, 0x291a306e, 0x0e1a2613, 0x1a0c0b16, 0xccdffe0a, 0x00297782, 0xff5f0002, 0x057204d0, 0x338a82f0, 0x40ac0045, 0x06011510, 
-    0x03363d01, 0x39060503, 0x03050001, 0x2707c555, 0x01020300, 0x70010302, 0x0621d082, 0x0cab4905, 0x05010723, 0x0e8b5105, 0x2d8f2320, 0x00222382, 
-    0x4a490500, 0x60a8180e, 0x00042609, 0x02040302, 0x855b8763, 0x8757202d, 0x00053a58, 0x4059594f, 0x413a3b10, 0x3b453a3f, 0x2a162645, 0x0808252a, 
-    0x2e052b19, 0x06725201, 0x43053143, 0x3e20052a, 0x08baa918, 0x0e070622, 0x43059c46, 0x30080945, 0x07021415, 0x2517011e, 0x2e373632, 0x06222301, 
-    0x03161415, 0x244823d6, 0x4572cc58, 0x2f2b2d77, 0x782a2b2f, 0x58bf6749, 0x26253537, 0x504b7c28, 0x06894c76, 0x6cbc5208, 0x4846c06e, 0x33505f53, 
-    0x44fd2658, 0x45419044, 0x4844418d, 0x61363046, 0x255d542d, 0x486e2526, 0x27287148, 0x6b424d29, 0xb5738ae5, 0x302e3a37, 0x80af3737, 0xedad1616, 
-    0x42424a4b, 0xa8ef4a48, 0x7bd1feb4, 0x4f427837, 0x433e484a, 0x47414249, 0x21008200, 0x0b500001, 0x0be74b07, 0x2306c04f, 0x5b020000, 0x42050350, 
-    0x135105a8, 0x001a220a, 0x09305001, 0x5d040322, 0x2b854a82, 0x1b4c0024, 0x1c882040, 0x4b18fd4f, 0xfb4f09e7, 0x4f21201e, 0xfe2117f9, 0x17f94f7b, 
-    0x9efc2108, 0x000200aa, 0x04000056, 0x00f0057a, 0x0025001a, 0x1c0d40d9, 0x040e1118, 0x01190304, 0x4a020400, 0x20057047, 0x07e5431c, 0x4b2bb985, 
-    0x04040106, 0x01055c00, 0x823a0000, 0xb04b29c5, 0x40585013, 0x03030018, 0x4a05465c, 0x1f8b0511, 0x1f823520, 0x3a20439f, 0x19202382, 0x55825882, 
-    0x60000422, 0x0325708d, 0x23401b4c, 0x07124d00, 0x03000226, 0x63030204, 0xb8822b82, 0x8b885720, 0x50000422, 0x36053847, 0x00011b1b, 0x241b251b, 
-    0x13141516, 0x1a000f10, 0x08071a01, 0x50212b14, 0x75080516, 0x37023e34, 0x0137013e, 0x24361333, 0x06221533, 0x27150107, 0x07010e01, 0x1415010e, 
-    0x6b013316, 0x25286638, 0x4029132a, 0x2c622e2d, 0xc2e4dbfe, 0x9918018d, 0x0183ee6d, 0x93fee8d9, 0x421d391d, 0x185b623d, 0x44581c1e, 0x806c5d2b, 
-    0x3f9a4f4d, 0xaefefe01, 0xb6afbeaf, 0xa4c8fcaf, 0x2d7902af, 0x9b73335e, 0x00334535, 0x56000100, 0xbb04e3ff, 0x1f00d505, 0x27496d00, 0x00172505, 
-    0x59010404, 0x200a1355, 0x08ad4805, 0x1422fd83, 0x10820200, 0x5f000222, 0x04202689, 0x1a29f882, 0x00010103, 0x04010204, 0x0a1d5561, 0x4f332884, 
-    0x11405959, 0x18190001, 0x0e101617, 0x1f000708, 0x51061f01, 0xfc500c00, 0x1135230a, 0x8f4c1521, 0x2a022106, 0x5005fe50, 0x012209fa, 0xfc50bb85, 
-    0x060f550b, 0x26263029, 0x4a042d5b, 0x509efcaa, 0x012207fc, 0xd3824000, 0xf005912d, 0xbf004400, 0x030139b5, 0x854a0104, 0x2e2108da, 0x04050600, 
-    0x70040605, 0x02030100, 0x70020103, 0x03000400, 0x63030401, 0x07050500, 0x0707005b, 0x05055641, 0xf18c0820, 0x35982b20, 0x28820220, 0x5f000222, 
-    0x05243d88, 0x31401b4c, 0x07262d90, 0x07060500, 0x6b886305, 0x092e8d18, 0x4f383e84, 0x17405959, 0x2d2f0001, 0x23252728, 0x17191a1c, 0x06070c0e, 
-    0x44014400, 0x200a414c, 0x0b234133, 0x2e273427, 0x35212301, 0x05b04d21, 0x23263426, 0x23150622, 0x240a5d4f, 0x07061415, 0x0bd54706, 0x90027308, 
-    0x3f3fbe87, 0x2421d23a, 0x50556f23, 0x24232572, 0x4971274e, 0x5002b0fd, 0x1d1e5d42, 0x75787d1a, 0x3c40d279, 0x6664a43c, 0x46393ca6, 0x5d371a1d, 
-    0x20206245, 0x3f41391f, 0x424d1dc1, 0x4261aa42, 0x33292a70, 0x6b26292e, 0x2348823f, 0x242aaa26, 0x74335923, 0x5b7b7170, 0x37353594, 0x90313338, 
-    0x2a663c5e, 0x47111f56, 0x42723030, 0x4244ac58, 0x0082004c, 0x3600012c, 0x9b04e3ff, 0x1f00d505, 0x637e8200, 0x03012608, 0x70030401, 0x09914900, 
-    0x00030323, 0x0d62425b, 0x04001b22, 0x03202586, 0x03221882, 0x2d885f00, 0x1b4c0124, 0x1d882140, 0x0100022d, 0x61010204, 0x00000300, 0x86005703, 
-    0x00032147, 0x23087042, 0x090a1012, 0x21117042, 0x8f4a3523, 0x096f530c, 0xad6ec528, 0xbb403d3c, 0x6d538501, 0x62032214, 0x0b7142aa, 0x820d6b53, 
-    0x827120e7, 0x00392de7, 0x170a40aa, 0x18010401, 0x02040601, 0x2508e746, 0x04050406, 0xf3820506, 0x0604002a, 0x00630401, 0x5b030202, 0x3922ae82, 
-    0x4e4b004b, 0x06824a06, 0x58503a25, 0x8f002340, 0x07a04b2d, 0x4d533587, 0x28258705, 0x01020003, 0x00630203, 0x205b8601, 0x9b7c1805, 0x07a64b08, 
-    0x01154033, 0x2c323300, 0x141e202a, 0x0c0f1112, 0x0139000b, 0x0aa34b39, 0x37363431, 0x2737013e, 0x012b012e, 0x16323335, 0x82150517, 0x2202820b, 
-    0x48072223, 0xaf480523, 0x09294108, 0x6f716008, 0x544848be, 0x8a393b4b, 0x6d395a43, 0x337b2d25, 0xfb01487e, 0x17270df4, 0x91142f17, 0x0b1e1756, 
-    0x77274d16, 0x26745252, 0x50cb2426, 0x1dbc4545, 0xed4b4b45, 0x4ff1a5aa, 0x2802504c, 0x1aaa1219, 0x67d4d51e, 0x05050b06, 0x56279605, 0xf6826430, 
-    0x3132376c, 0x81ae3736, 0xecae1616, 0x49424a4b, 0xf22208d3, 0xc9181d00, 0x5b2a0c33, 0x41000000, 0x0101034b, 0x665c3a01, 0x18112008, 0x840933c9, 
-    0x1802201e, 0x200e1b67, 0x06cc4657, 0x4f02002c, 0x16b65959, 0x04251626, 0x9b581808, 0x1115230c, 0x9b581123, 0x9323210c, 0x20148d52, 0x0b8a52ca, 
-    0x04f4fb23, 0x0999494a, 0x82b6fb21, 0xff603ab3, 0x057104c6, 0x003400f0, 0x010f4067, 0x00020001, 0x02000401, 0x0233344a, 0x059f4904, 0x181e4021, 
-    0x3208dbac, 0x00010400, 0x04006e04, 0x01007104, 0x005b0301, 0x82410303, 0x234021d1, 0xe0822093, 0x82570321, 0x5b013621, 0x01030100, 0x1db7594f, 
-    0x262b1626, 0x2b190805, 0x1e173513, 0x061e5503, 0x34353624, 0x5e592e27, 0x171c5506, 0x15172338, 0x2810eec8, 0x4e152d2c, 0x20142877, 0x274d160b, 
-    0x75505376, 0xa7412726, 0x6a200805, 0x4748bf6f, 0x1f1f2454, 0x592d2d4f, 0x0b01e828, 0x0c0765d4, 0x474f0609, 0x62325923, 0x376cf683, 0x48051d55, 
-    0x452f0685, 0xaaed4b4b, 0x4848b670, 0x21222268, 0x8200d263, 0x00012200, 0x0693592d, 0x72002027, 0x020609b6, 0x0a8c4b01, 0x83020121, 0x487020dc, 
-    0x4b20085b, 0x08eee318, 0x58503a25, 0x87001840, 0x0003231f, 0x80487303, 0x8d1d200c, 0x0102391a, 0x00570200, 0x59000202, 0x00020000, 0xb659594d, 
-    0x17182616, 0x2b180804, 0x25057c48, 0x11231127, 0xaa49010e, 0x113a0812, 0x11be0323, 0x57691d1d, 0x1d6757be, 0x3ebe121d, 0x99cf4343, 0x4141d398, 
-    0x9503be36, 0x3b3c944f, 0x94fc094f, 0x480c6c03, 0x58943939, 0xd783392a, 0x56564e4e, 0x83d74e4e, 0x8f835cfc, 0x82600021, 0x057024db, 0x823400f0, 
-    0x57c82079, 0x25200555, 0x012e8282, 0x00680001, 0x00020007, 0x00630207, 0xcc410606, 0x044b2605, 0x05010101, 0x08665b5a, 0xe2823520, 0x2c832620, 
-    0x01000223, 0x442da070, 0x0022050a, 0x2d8b0102, 0x68820420, 0x05010523, 0x2463885e, 0x401b4c06, 0x2653882a, 0x07060003, 0x87630603, 0x8204205b, 
-    0x0105227e, 0x37868757, 0x594e0501, 0x10405959, 0x41434f51, 0x31323334, 0x212c2224, 0x17080810, 0x28095f57, 0x27263435, 0x2e27032e, 0x20028501, 
-    0x05194435, 0x2405024b, 0x1415031e, 0x065c5706, 0x7f180120, 0x484c0cc4, 0x1eb5080a, 0x011e1703, 0xcb8b1415, 0x39793c28, 0x18160e0c, 0x292a2911, 
-    0x377e3d11, 0x090b2a26, 0x19181504, 0x9739384e, 0x3dc69667, 0x0d1b2d1f, 0x91383645, 0xfc67014b, 0x237d0243, 0x06142638, 0x2311170e, 0x5d425b7d, 
-    0x0d2d2521, 0x18130b1a, 0x3917314f, 0x251a3c3b, 0xa24c0125, 0x5e342b2e, 0x1d51332a, 0x030c1714, 0x23110201, 0x20264018, 0x814b153c, 0x286a3e3c, 
-    0x55662f29, 0x706d652c, 0x5de78c37, 0xaa24935f, 0x6d34a701, 0x284e8678, 0x1e4a5155, 0x1a20433f, 0x4924481d, 0x143d225b, 0x01010c1b, 0x20261406, 
-    0x28487a2e, 0x00010000, 0x04000062, 0x00f005c7, 0x65ce1821, 0x5f192007, 0x612b06f4, 0x00040400, 0x0000005b, 0x19054b41, 0x2408bd94, 0x4058503a, 
-    0x220e8219, 0x90730302, 0x4c042426, 0x861e401b, 0x2954821b, 0x63040001, 0x02020100, 0xb6465501, 0x02012a06, 0x4059594d, 0x11261609, 0x11165d11, 
-    0x44060f5b, 0x62200e7e, 0x5b0c125b, 0x145d0a2a, 0x61fe240b, 0x4b3dfeaa, 0xfb210b34, 0x2a9b82b6, 0x04e3ff93, 0x00d5053d, 0x475e001d, 0x12200573, 
-    0x200aca49, 0x0cd84804, 0xa6190f20, 0xc0492e73, 0x011d2306, 0xc049051d, 0x56332019, 0x0221054e, 0x0fbe4967, 0x490cb95a, 0xfb210dbc, 0x09bb49f4, 
-    0x00002124, 0xbf82af04, 0xa3001e22, 0x200ccb4f, 0x0a654f1d, 0x594b3921, 0x04210569, 0x0a604304, 0x58503a24, 0x24881a40, 0x05000425, 0x475e0504, 
-    0x01220565, 0x03193c01, 0x1a24087e, 0x03010300, 0x850ad24f, 0x21218526, 0x1c852240, 0x4f020121, 0x00650bf4, 0x835a2007, 0x594e212a, 0x2308e15e, 
-    0x1a080622, 0x241cdb4f, 0x03211533, 0x13dd4f01, 0x52fee422, 0x2308df4f, 0xa8fe1a01, 0x25094546, 0xd5facd02, 0x008200aa, 0x6900012a, 0x6704e3ff, 
-    0x4d00f005, 0x09ed5518, 0x01050430, 0x70010405, 0x05020100, 0x006e0201, 0x69440505, 0x02002206, 0x059b6202, 0x2109fc56, 0x2c8e0022, 0x01060223, 
-    0x05aa4a00, 0x05243485, 0x28401b4c, 0x0326248f, 0x03040500, 0xc14b6305, 0x2035840a, 0x30f3824f, 0x30000113, 0x2328292e, 0x070a0c21, 0x014d0006, 
-    0x0ac45c4d, 0x17143326, 0x37323316, 0x4407264f, 0xcf550b3e, 0x23152105, 0x2510035f, 0x17031e17, 0x0283011e, 0x59441620, 0x02880805, 0x45c37a77, 
-    0x5bd24745, 0x50868a57, 0x3a3d2d26, 0x4e488936, 0x42363781, 0xa6383835, 0x39ac7474, 0x1cd23739, 0x425c1e1e, 0x201e5d40, 0x26232c1d, 0x22253563, 
-    0x350f0b10, 0x4c302f73, 0x3f411515, 0x451db83f, 0x6cad3f3f, 0x4b515592, 0x4a426823, 0x2e212362, 0x2d381a18, 0x51617e2d, 0x40373791, 0x91373740, 
-    0x1f573451, 0x1d21221f, 0x3a2b5420, 0x281d1a4c, 0x060b0d12, 0x33110503, 0x3f592120, 0xa4634f3e, 0x00443d3c, 0x200c7b48, 0x05434368, 0x2b5b1820, 
-    0x033a2114, 0x2007d56e, 0x231f8817, 0x00710303, 0x24074f5b, 0x401b4c02, 0x83198c1c, 0x218e481a, 0x4811fe56, 0x195b228e, 0xb6fb220b, 0x20008200, 
-    0x08074d02, 0x59003e26, 0x33b5b100, 0x200a094d, 0x07014d28, 0x02060924, 0x034d0004, 0x07072605, 0x05005b05, 0x14034d05, 0x2f922520, 0x8707fd4c, 
-    0x82072037, 0x4d2b20ee, 0x05260859, 0x05040700, 0x5f8a6307, 0x3912f74c, 0x013f401b, 0x3f4d4f00, 0x29594059, 0x1a1b1c27, 0x070c0e18, 0x013e0006, 
-    0x60440a3e, 0x0dfb4c09, 0xfc4c2620, 0x09d45206, 0x63420120, 0x0ff54c06, 0x1f4d0320, 0x49318207, 0xf2520817, 0x022a0805, 0x42be8390, 0x1fd23842, 
-    0x51712525, 0x23237356, 0x26262820, 0xaefd4970, 0x30201101, 0x3d111111, 0x70a4373b, 0x3b3ba86b, 0x0c4d1d3c, 0x3a770807, 0x86c2403f, 0x1d1d5c45, 
-    0x0e1c1519, 0x38171527, 0x1b5d4b26, 0x1b15171a, 0x4a1d5f1b, 0x5eaa4545, 0x2c2c6f41, 0x2b2a3430, 0x5e413871, 0xaa252222, 0x22223911, 0x934e2a47, 
-    0x393c3336, 0x58943535, 0x5329643d, 0x3149111f, 0x59417031, 0x4c4442aa, 0x22298803, 0x2c335622, 0x1b102059, 0x260a0908, 0x33542020, 0x2221592f, 
-    0x00010029, 0x0400009b, 0x00d5055e, 0x427a0007, 0x1520057f, 0x490d3a5e, 0x15200d38, 0x210c7b5e, 0x2b835900, 0x2008ca60, 0x230d8212, 0x5d030003, 
-    0x022a2388, 0x18401b4c, 0x03010000, 0xc9465500, 0x00002408, 0x82005903, 0x594d2425, 0x82b65959, 0x041025ff, 0x132b1808, 0x2e05515e, 0x02cb9b23, 
-    0xcb08fdf8, 0x8bfed505, 0x844ffcaf, 0x0046244e, 0x828a0400, 0x001d269f, 0x0037002a, 0x34a38587, 0x0101031f, 0x07060109, 0x08630601, 0x01040701, 
-    0x00070500, 0x07745763, 0x43053a21, 0x2695072a, 0x57050521, 0x268205a0, 0x00244027, 0x02050102, 0x254e9655, 0x05005905, 0xa9820502, 0x370e4026, 
-    0x111a1136, 0x10250284, 0x2b1d080a, 0x0a134225, 0x33353724, 0xd7561e15, 0x4a15200a, 0xff410611, 0x33172305, 0xae44013e, 0x02770809, 0x35ae8406, 
-    0x33272930, 0xc187ac33, 0x3333ae87, 0x33332828, 0x49c187ae, 0x181e1d61, 0x5f1d1f18, 0x6249c14a, 0x18181d1d, 0x49621d1d, 0x5154069e, 0x8e96d24a, 
-    0x554f4edb, 0x057a7a05, 0xdb4e4e56, 0x4edc8c8c, 0x9d05574e, 0x2f03b304, 0x77a53433, 0x3638a778, 0x33030332, 0x79a63636, 0x3334a479, 0x0200032f, 
-    0x00002400, 0xf0058e04, 0x3a002100, 0x1bb59f00, 0x18070301, 0x28081ff6, 0x00070109, 0x03070103, 0xe5511863, 0x0808220a, 0x06ab5302, 0x4a079761, 
-    0x06230512, 0x9b730600, 0x4c08252f, 0x0029401b, 0x73822583, 0x02070824, 0x2d8b6308, 0x122cb218, 0x22231238, 0x3a222e30, 0x11113a23, 0x11262a15, 
-    0x1b080a10, 0x3523372b, 0x51501133, 0x05c4560e, 0x11272628, 0x15211521, 0x5c430123, 0x27262208, 0x06595e26, 0x16147808, 0xe3011e17, 0x3a37bfbf, 
-    0x7e78b03c, 0x363939b0, 0xa9383a36, 0x264f2d71, 0xd4022954, 0x01ca2cfd, 0x1c624edf, 0x1e18181d, 0x4c36331e, 0x1f1f674e, 0x20201d19, 0x02aff469, 
-    0x3c9f6095, 0x3c43403d, 0x6161a03c, 0x46393c9e, 0x34200e0d, 0xf4afbafe, 0x22291e03, 0x40406824, 0x13262565, 0x24242814, 0x65423c65, 0x002a2626, 
-    0x00020000, 0x04e3ff75, 0x00f0055c, 0x4926000b, 0x172007c1, 0x2106224d, 0x76184101, 0x13470a07, 0x27d81809, 0x18412011, 0x2f230776, 0x00010c0d, 
-    0x260c1b1d, 0x0507260d, 0x0b010b00, 0x2005bc52, 0x27d81802, 0x3736210a, 0x200c114b, 0x05ce6306, 0xe9690220, 0x53fc2207, 0xcc8a186b, 0x10e86913, 
-    0x184aa421, 0x2318c68a, 0x47000300, 0x8a2def82, 0x3100d505, 0x4b003e00, 0x0bb6c700, 0x0a5b4d09, 0x0c482320, 0x4b393107, 0x02020108, 0x01065b04, 
-    0x4b3c0404, 0x01010107, 0x200bee60, 0x05fe6a3a, 0x01090126, 0x5f000100, 0x215c3394, 0x821e2008, 0x04052673, 0x07630503, 0x8a2f8601, 0x05106859, 
-    0x2e480320, 0x826b8205, 0x0401221a, 0x232a8302, 0x57010000, 0x013d7688, 0x59594f00, 0x01194059, 0x404a4b00, 0x333d3e3f, 0x1e1f2032, 0x1415161c, 
-    0x01310013, 0x09e34530, 0x642e2721, 0x1e3105f6, 0x011e1702, 0x26221133, 0x37363435, 0x11013b36, 0x05514c1e, 0x0e070624, 0x04830701, 0x2e5f0320, 
-    0x1333210a, 0x08088342, 0x23012e87, 0xa77a7402, 0x1652433c, 0x04c20f16, 0x1a0d1009, 0xb4c55663, 0xcc5d302b, 0x556c45b6, 0x2b391940, 0x51171711, 
-    0x2a523b3f, 0x42309c62, 0x14141515, 0x30421515, 0x1b6452c1, 0x1b11111b, 0x1d52641b, 0x69201d18, 0x559b4444, 0x57361313, 0x33193a48, 0x84330339, 
-    0x2266458b, 0x038bfe41, 0x20312415, 0x5890dd4a, 0x6b41439c, 0x060c1f21, 0x074e0504, 0x232a0b0b, 0x0b0b2823, 0x3525fc06, 0x69953333, 0x33339b68, 
-    0x3cfc822e, 0xe5ff6700, 0x60046904, 0xe5003500, 0x5005b04b, 0x2e33b658, 0x01020602, 0xb04b1b4a, 0x200d8513, 0x870d8300, 0x59592116, 0x40352584, 
-    0x0203051a, 0x4b3c0101, 0x3a060600, 0x0201044b, 0x075b0002, 0x08015e08, 0x40213982, 0x86218616, 0x0806231c, 0x37520003, 0x50352206, 0x203f9e58, 
-    0x2021823e, 0x83388217, 0x00022252, 0x2164825f, 0x4e855901, 0x1b4c0624, 0x19821e40, 0x02000623, 0x25118357, 0x01000600, 0x80896106, 0x4f000223, 
-    0x25008259, 0x00011740, 0x6b622f31, 0x191a2905, 0x090a1113, 0x35013500, 0x2508a154, 0x33113503, 0x8a501411, 0x410d8408, 0xa34105cc, 0x221d8205, 
-    0x6e063523, 0x6f0806e1, 0x1f5c3e58, 0x070e150e, 0x0a0306a8, 0x2d242b19, 0x0f100e31, 0x0b0804a8, 0x28310d06, 0x110c2d2b, 0x44a7a70d, 0x1d694482, 
-    0x2c1b6523, 0x5f481b3b, 0x89024e7b, 0x49777ffd, 0x162a3b25, 0x88201d20, 0xfd81027b, 0x44654a7f, 0x1e1a0d28, 0x8e251b22, 0xfb810270, 0x437b60a0, 
-    0x0045484a, 0xfec10001, 0x04230456, 0x0017007b, 0x0102b5f2, 0x4a010302, 0x20056041, 0x05a96026, 0x00006824, 0xf2603c00, 0x59052c0d, 0x3a050500, 
-    0x0606004b, 0x414c063e, 0x402105a6, 0x08d76023, 0x00030325, 0x8401015b, 0x04042134, 0x35242a8f, 0x27405850, 0x59a02a88, 0x2e823e20, 0x2e882520, 
-    0x05000426, 0x61050406, 0x8685908f, 0x0121818a, 0x05366100, 0x06212f89, 0x20ac8559, 0x22008259, 0x19110a40, 0x250b0037, 0x33013e15, 0x414a1632, 
-    0x22232205, 0x06666b06, 0xb8c13608, 0xad73a831, 0x7169b9a7, 0xaa028a83, 0x04b856fd, 0x6261a860, 0xf4f4e6df, 0xaeb48e97, 0xfe8f16fe, 0x02000056, 
-    0x56fe4900, 0x77048704, 0x26001a00, 0xb04b2301, 0x2cae8218, 0x0301120a, 0x04010007, 0x1b4a0203, 0x200c8640, 0x230c8206, 0x17b04b59, 0x29211e82, 
-    0x99261900, 0x06082209, 0x07575a02, 0x0b844b20, 0x825b0021, 0x4b4228db, 0x3e050500, 0x851b4c05, 0x002d254f, 0x4b3c0202, 0x00233584, 0x85440101, 
-    0x59042528, 0x3a040400, 0x35203495, 0x2a206582, 0x0020348e, 0x01226789, 0x668f0606, 0x31823e20, 0x03002631, 0x03000400, 0x01086104, 0x05000006, 
-    0x8f630006, 0x29948542, 0x01002440, 0x01030700, 0x30936307, 0x85590521, 0x825920bb, 0x11403200, 0x20221b1c, 0x261c261b, 0x13111111, 0x0809222a, 
-    0x05f4751a, 0x5d5f2620, 0x013e2606, 0x17163233, 0x05e46337, 0x3d08fc75, 0x10150607, 0x972d2603, 0x39a06468, 0x393b3b39, 0x6664a039, 0xa7122e98, 
-    0xfeb9a8a8, 0x008287f2, 0x43863508, 0x57558b43, 0xd64d4c51, 0x4dda8a89, 0x5555514d, 0x8f2ffc93, 0x250256fe, 0xd9d7d7d9, 0xfed76d6c, 0x00000050, 
-    0xfeb80001, 0x04a40456, 0x0017007b, 0x010bb5d4, 0x09763e19, 0xd8852020, 0x03000031, 0x0303005b, 0x04004b44, 0x05590104, 0x42010101, 0x1c200ed1, 
-    0x02264582, 0x0201035b, 0x23943c02, 0x82074077, 0x2b4b9c1d, 0x4058503e, 0x01040021, 0x05550401, 0x8c075761, 0x06bf4233, 0x02001d30, 0x55020100, 
-    0x00000300, 0x63000304, 0x2d820400, 0x01040623, 0x0fb94261, 0x22131137, 0x2b1b0807, 0x23263401, 0x11150622, 0x17331123, 0x3233013e, 0x06185116, 
-    0x69570338, 0xb88a8371, 0xa83112a6, 0x94a7ad73, 0xb602b994, 0xaeb48e97, 0xc14287fd, 0xd9fd3606, 0x0056fe8f, 0xb8000100, 0x4104e3ff, 0x17001406, 
-    0x15b5f500, 0x436d8201, 0x252606f7, 0x3b010100, 0xbb6b004b, 0x004b2507, 0x59060505, 0x3a268482, 0x0404004b, 0x8a635c00, 0x9128200d, 0x5b00272c, 
-    0x00020706, 0x2e854200, 0x00220b85, 0xf34a1b4c, 0x6c5ca805, 0x05280555, 0x05000600, 0x04006106, 0x04227582, 0x6c8d6000, 0x1b4c032d, 0x02001e40, 
-    0x02050300, 0x92006103, 0x4c01222a, 0x23008259, 0x00011540, 0x07380919, 0x05060727, 0x01170004, 0x06ce5717, 0x4b113521, 0x310805b2, 0x32331614, 
-    0x33013d36, 0x0e352311, 0xad0a0201, 0xd102b8a5, 0x706b2ffd, 0xb9b98884, 0xe01da731, 0xfe6c04e5, 0xd7fd8f4c, 0xadb58e97, 0xa830fdeb, 0x76826461, 
-    0x56fe6734, 0x7704a504, 0x24001800, 0x12b6c500, 0x06050200, 0xe4434a01, 0x00212305, 0x345d0606, 0x4b442205, 0x089a5f07, 0x2108e86a, 0x0e41043e, 
-    0x02022309, 0x2d844b3c, 0x2c9adb82, 0x58503e24, 0x4a822340, 0xed820020, 0x83079a43, 0x6b358463, 0x57830740, 0x00244028, 0x01060102, 0x25600602, 
-    0x20358908, 0x05676b03, 0x59342682, 0x10405959, 0x1e20191a, 0x241a2419, 0x2a131111, 0x19080822, 0x2e189d43, 0x36320121, 0x23263435, 0x15060722, 
-    0x43440310, 0xfe21129b, 0x189b439f, 0x9187fa22, 0x2c0b9943, 0x00e30001, 0x06150400, 0x00090014, 0x05134264, 0x00001a24, 0x0f6c3b00, 0x20f98318, 
-    0x090f6c17, 0x0224288a, 0x15401b4c, 0x6c08924d, 0x3b230831, 0x6b594c00, 0xe33114e7, 0xfd7a02b8, 0xfd250286, 0xfe140623, 0xc3fc8f4c, 0x2c788294, 
-    0xfeb70001, 0x04190456, 0x0015007b, 0x0cff46d7, 0x67461f20, 0x0202280f, 0x04004b3a, 0x455a0504, 0x1324089f, 0x1b405850, 0x0a444119, 0x22910020, 
-    0x22823520, 0xe58349a2, 0xe8462220, 0x11174708, 0x40297387, 0x01000023, 0x03000103, 0x462c8870, 0x998808ed, 0x73535920, 0x23132705, 0x06102313, 
-    0x7f181a08, 0x162007d6, 0x2005b559, 0x06e44623, 0x2244b720, 0x06e34606, 0x449efc21, 0x4a200720, 0x39053144, 0x008f6cfc, 0x00020000, 0x0456fe6a, 
-    0x007b04b6, 0x01430030, 0x0102b50b, 0x21480602, 0x052a2a07, 0x01090201, 0x03020803, 0x052b4163, 0x2f089142, 0x0808010a, 0x04005b04, 0x004b4204, 
-    0x073e0707, 0x20072548, 0x22318a26, 0x48000606, 0x2d930627, 0x58503523, 0x205fad40, 0x2031823e, 0x825f8928, 0x04002454, 0x8f040807, 0x298f869a, 
-    0x01002640, 0x01020600, 0x32956306, 0x85590721, 0x82592028, 0x13403400, 0x37393132, 0x43324331, 0x252a2416, 0x10251511, 0x411c080b, 0x99190555, 
-    0x332508ab, 0x010e2315, 0x08b86407, 0x496c3420, 0x012e2105, 0x2008ec4d, 0x06024e11, 0xfc4d3720, 0x6a55080b, 0x492212a6, 0x75714d2b, 0x433d3ba6, 
-    0x0b686505, 0x79333347, 0x2a724542, 0x2c352b2a, 0xc93c702c, 0x56272f02, 0x267347aa, 0x02b82726, 0x1a412871, 0xc407231a, 0x1414321a, 0x10111019, 
-    0xaa600432, 0x28174c3a, 0xd94f4c53, 0xab838f85, 0x27293333, 0x43682525, 0x3d2e824d, 0x359e6d24, 0x2d2d2a74, 0xebfb668e, 0x25201502, 0x14567426, 
-    0x283d1514, 0x1314351e, 0x00820019, 0x5d00022c, 0x9b04e3ff, 0x19001406, 0x6d5e2c00, 0x02022209, 0x1c276c3b, 0x58503e23, 0x0c276c40, 0x04242e8c, 
-    0x19401b4c, 0x180cff6b, 0x22089196, 0x6b4c023b, 0x2c220afa, 0xfa6b2c1b, 0x165b083b, 0xab7b2702, 0x32333938, 0x7bad3737, 0xa8b91501, 0x393935a8, 
-    0x684372af, 0xfe202123, 0x235f3ced, 0x21202623, 0x4f581d43, 0x7879d651, 0x5b4d4ec8, 0x4cfeb401, 0x7328fe8f, 0x514848c2, 0x383a3a9c, 0xa201669e, 
-    0x9a36363a, 0x399f5e69, 0x00010073, 0x0456febc, 0x00140614, 0x18770013, 0x440c2361, 0xcf6b069a, 0x06e04309, 0x2405c145, 0x4058503e, 0x0887431d, 
-    0x3b000022, 0x830d264b, 0x1b402124, 0x8410a743, 0x04042127, 0x59251d82, 0x2313b759, 0x0dcc6b13, 0x210aa343, 0x844abc23, 0x06b8290a, 0x61a4fd14, 
-    0xfde6df62, 0x2f069e43, 0x0100ddfb, 0x56fe9701, 0x6004da03, 0x33000500, 0x20058873, 0x05884310, 0x2406b36b, 0x1b4c023e, 0x23128240, 0x00720001, 
-    0x29081289, 0x1111b559, 0x17080310, 0x1133012b, 0x01211521, 0x8b01b897, 0x6004bdfd, 0x008f85fa, 0x68000100, 0x680456fe, 0x39001406, 0x084c2301, 
-    0x020a2905, 0x1f030601, 0x02020401, 0x2106934d, 0x11820a40, 0x11860120, 0x1e860c84, 0x20079b4d, 0x24858229, 0x03004b3b, 0x0bdb4603, 0x04040024, 
-    0x71184b3a, 0x17440796, 0x8521200e, 0x06062130, 0x20059f6e, 0x23278344, 0x01055b04, 0x40443284, 0x50352307, 0x59ac4058, 0x6c4c3e20, 0x05002505, 
-    0x63050207, 0x33476189, 0x04042105, 0x4405bb68, 0x402107a0, 0x07104423, 0xfa770020, 0x84398b08, 0x82592085, 0x0b402500, 0x11232d16, 0x10230382, 
-    0x181c0808, 0x2508eb62, 0x1d011e17, 0xc24d1401, 0x07104410, 0x34013d24, 0x5455022e, 0x23112b09, 0x6123a768, 0x1a5b4345, 0xc84d121a, 0x2315830d, 
-    0x131a1a5a, 0x062b158c, 0x3eecfd14, 0x3635383d, 0x4dfc6499, 0x188710c7, 0x4d664921, 0xfb2109e0, 0x05e343d5, 0xe3ff893b, 0x2b064804, 0x3c002100, 
-    0x0d408400, 0x0102010c, 0x0f104a01, 0x01040d0e, 0x057c4748, 0x01041823, 0x06407302, 0x0ad29818, 0x26050352, 0x4058503e, 0x62010615, 0x28890653, 
-    0x8206a657, 0x01032310, 0x98186302, 0x402f145e, 0x01222315, 0x22303200, 0x143c233c, 0x75111213, 0x34300ec5, 0x013e3736, 0x17132537, 0x15210507, 
-    0x17011e23, 0x71072e5d, 0x2c410654, 0x45272005, 0x71080b2a, 0xb27e6702, 0x3d383c3a, 0x518a3535, 0x94cff1fe, 0x0141016a, 0x27205a0f, 0x02060409, 
-    0x393c3701, 0x704e80b6, 0x011f1f23, 0x0d070704, 0x4e992e36, 0x1f22226d, 0x6d23221e, 0x4b4a571d, 0xca877ccd, 0x0f514747, 0x622101b3, 0x30aad297, 
-    0x361b3672, 0x8a0b2630, 0x59484bd3, 0x3439409c, 0x2b0c6f96, 0x351b3a33, 0x39412a67, 0x53559739, 0x3e3b3894, 0x17440000, 0xb56f220c, 0x3b651800, 
-    0x001a210a, 0x2606234b, 0x02004b3c, 0x825c0002, 0x4b42242c, 0x44040400, 0x18200917, 0x2006585b, 0x85298a64, 0x9040201f, 0x5904211a, 0x59283a85, 
-    0x1311b759, 0x05221323, 0x20088b49, 0x06de7b35, 0x08833620, 0x5b032328, 0xad75a731, 0x984ab8a5, 0x61a83005, 0x04e5e064, 0x9794fb6c, 0x02adb58e, 
-    0x82f6f97b, 0x00bd21af, 0x20055b49, 0xd35b1913, 0x1cb5445d, 0x6518bd20, 0x2f081ee9, 0x00020000, 0x04e2ffa6, 0x00140620, 0x014c0033, 0x210e4009, 
-    0x41010201, 0x0922252e, 0x02020405, 0x07b04b4a, 0x1f405850, 0x04010200, 0x70040201, 0x20074041, 0x0a9f683a, 0x20059f42, 0x2026820a, 0x68268c1b, 
-    0x03230535, 0x51000205, 0x0c2006e9, 0x112049a5, 0x352049a1, 0xb58a49a3, 0x00040326, 0x70000304, 0x200bfa68, 0x05904c3b, 0x15405934, 0x00013435, 
-    0x4c354c34, 0x1b1d2c2d, 0x33001314, 0x1d5c3301, 0x1234220a, 0x07985737, 0x18823f20, 0x1415062e, 0x33011e17, 0x013e3732, 0x010e1537, 0x2206a766, 
-    0x82352311, 0x740e200b, 0x3d240685, 0x27263401, 0x12843482, 0x0805b257, 0x591c029c, 0x3330308a, 0x5439b7c3, 0x111b1c1c, 0x39c73312, 0x32122620, 
-    0x1b212020, 0x29151d38, 0x23785a15, 0x14b81c23, 0x68282a3f, 0x226c4809, 0x1b142020, 0x3d4b5f1b, 0x2a25245f, 0x581e1d1b, 0x3c3c411e, 0x01c464a4, 
-    0x2d079c5e, 0x294d2020, 0x4f1c3e20, 0x37303155, 0x0b151226, 0xb1112412, 0x350e1b0d, 0xa449487f, 0xacfffd5b, 0x1a1b492d, 0x2f37a11f, 0x56477a2c, 
-    0x3c3c7933, 0x7739276b, 0x55944544, 0x2e2c7441, 0x0000002e, 0xfec20001, 0x04af0456, 0x0015007b, 0x010bb5cc, 0x414a0001, 0x4f1f2007, 0x01210f8b, 
-    0x05634b01, 0x52064750, 0x1b20065c, 0x910b8a4f, 0x069a4122, 0x554f0220, 0x2426910c, 0x4058503e, 0x4f49821f, 0x012307f7, 0x85590201, 0x06a7527f, 
-    0x4c053e27, 0x001b401b, 0x23b18203, 0x00630003, 0x89072d67, 0x08584b1d, 0x5e131121, 0x834f05cc, 0x03212213, 0x0b814f61, 0xb2fe9522, 0x230e814f, 
-    0x008f2ffc, 0x9a2f5c82, 0x2d04e3ff, 0x31001406, 0x5d014a00, 0x8250b04b, 0x1a0e259d, 0x23040201, 0x2c279782, 0x03010601, 0x8b401b4a, 0x03072310, 
-    0x9047594a, 0x00272305, 0xc4840404, 0x074b3b22, 0x290a5150, 0x4b3a0505, 0x06060109, 0x8e695b00, 0x82112009, 0x94232055, 0x2029852e, 0x09325505, 
-    0xa8059a53, 0x055c4759, 0x00060526, 0x70000506, 0x08254c82, 0x00060001, 0x226a935f, 0x851b4c01, 0x002521de, 0x00212e86, 0x23b78202, 0x63010206, 
-    0x042c3791, 0x2c401b4c, 0x06010700, 0x70060701, 0x00252f89, 0x01020701, 0x202e9361, 0x39008359, 0x32331b40, 0x3e3f0001, 0x4a334a32, 0x1c1e2a2b, 
-    0x0d0e1315, 0x31000b0c, 0x33573101, 0x34352609, 0x2337023e, 0x05c95a35, 0x17323324, 0xcf71011e, 0x0a544307, 0x54432720, 0x039a0813, 0x021e1415, 
-    0x29021617, 0x2e2d8460, 0x291c0e2d, 0x33d2911b, 0xad4b4b7c, 0x0b181b5e, 0x38140812, 0x2e6b391a, 0x79275f31, 0x484444bf, 0x3e1812a6, 0x02652929, 
-    0x2020664e, 0x31312d1b, 0x271a6d9a, 0x130a0e1a, 0x1d3f111b, 0x97393841, 0x948d3d6e, 0x5e8f4594, 0x403b3ba0, 0x03030203, 0x2d0a0997, 0x446f2623, 
-    0x43434f0a, 0xacfd73b6, 0x1a472da8, 0x3ca01d1a, 0x3d793031, 0x30814c8b, 0x3d073a30, 0x3d858885, 0x2c3d5035, 0x01004012, 0xe3ff9000, 0x14069004, 
-    0xe2001500, 0x241913b5, 0x20210a43, 0x06d24800, 0x614b3b21, 0x052205ec, 0x9d463a05, 0x62062005, 0x112408c4, 0x1c405850, 0x0225278f, 0x055c0002, 
-    0x0c3c7506, 0xa1514ba3, 0x00022606, 0x70000502, 0x052e6100, 0x5b8d6020, 0x1b4c012e, 0x01002340, 0x01040204, 0x05007002, 0x04202a96, 0x3005a651, 
-    0x12000113, 0x0e0f1011, 0x05080a0d, 0x01150004, 0x06124515, 0x290a0347, 0x11231521, 0x010e2723, 0x0547e201, 0x61013a06, 0x3112a7a8, 0xe5e01da7, 
-    0x48fdb802, 0xadb58e97, 0xfa8f2f04, 0x6461a87b, 0x2a008200, 0xfed90001, 0x042f0356, 0x4b0a0060, 0x0123091f, 0x824b3c01, 0x5b02251b, 0x3e020200, 
-    0x23051f4b, 0x72010001, 0x592b128a, 0x201223b5, 0x2b170803, 0x84323313, 0x0622087c, 0xead9012b, 0xa7b1b8b4, 0xfaf2fefe, 0x8cfb7404, 0x0100d1c5, 
-    0xe3ff1800, 0x14061804, 0xd7001500, 0x296013b5, 0x50052406, 0x64204058, 0x022506c5, 0x04004b3b, 0x266c8204, 0x4b3a0505, 0x62030300, 0x87410b71, 
-    0x06804405, 0x22832787, 0x8e108741, 0x4c4b9223, 0x03230585, 0x6b000106, 0x53820af8, 0x04050523, 0x44808359, 0x042705d4, 0x04000500, 0x8f006105, 
-    0x05924627, 0x7c414020, 0x0a0c2306, 0x7c410607, 0x05fd6b0e, 0x48323321, 0x272e0582, 0x1202010e, 0x01a8a5ad, 0x84706b60, 0x7c41b988, 0xdd032306, 
-    0x8648fb8f, 0xa0fb2106, 0x35057c41, 0xfea80001, 0x041e0456, 0x0043007c, 0x1f3ab750, 0x0103031e, 0xa44c4a01, 0x00162105, 0x5b24d582, 0x44020200, 
-    0x36051741, 0x00000104, 0x1b4c003e, 0x02001440, 0x02030100, 0x03006301, 0x865b0003, 0x40593316, 0x4100010f, 0x1921233f, 0x01430017, 0x14080542, 
-    0xf46f012b, 0x37362306, 0x0285013e, 0x0b294318, 0x3e270727, 0x16323301, 0x09a37517, 0x0e070324, 0xbd730703, 0x337f0806, 0x01211521, 0x18442a60, 
-    0x303e1a18, 0x45427f30, 0x3a33327b, 0x6c262a22, 0x20482f3f, 0x88163d23, 0x618dc948, 0x40403fac, 0x78333138, 0x221d0a3d, 0x361b0f23, 0x1d0e2931, 
-    0x200a0a07, 0xfd1b021a, 0x1b56fe74, 0x223f1718, 0x37376e36, 0x80423f7c, 0x49844443, 0x22256033, 0x13111424, 0x5c652236, 0x37363669, 0x93555897, 
-    0x3e864c4a, 0x21211d0a, 0x31341a0e, 0x1a27132d, 0x0c0c1a08, 0x82008f12, 0x00012c00, 0x040000bd, 0x007b0415, 0x4ea40013, 0x5319086f, 0xe64991af, 
-    0x0762560a, 0x46112321, 0xbd2207f2, 0x6f1812a6, 0x04210ad1, 0x1d501960, 0x08e7850e, 0x56fef227, 0x9204de03, 0x34003800, 0x01283140, 0x4a010201, 
-    0x03191a27, 0x02004802, 0x00720201, 0x72010301, 0x00030300, 0x06ea415c, 0x3600012b, 0x10232534, 0x0138000f, 0x13e74137, 0x2207f641, 0x7117013f, 
-    0x172c05d9, 0x3233011e, 0x0e173736, 0x030e0701, 0x08052749, 0x2115217e, 0x3b229c01, 0x221b181a, 0x2e541e1e, 0x2d356c30, 0x4130306d, 0x7b5f3731, 
-    0x2b3b2f1f, 0x2851211f, 0x3f173d23, 0x2345bd70, 0x18142536, 0x0115200b, 0xfebefdcf, 0x16171456, 0x8837313e, 0x42974848, 0x20338145, 0x4c6b2323, 
-    0x60377b3c, 0x602d1e71, 0x1136292f, 0x090b1113, 0x6bd55b71, 0x515d6635, 0x0f1f2e1f, 0x00008f12, 0xfe620001, 0x04640456, 0x00350060, 0x0005b671, 
-    0x01030002, 0x2906c36e, 0x02040619, 0x4b3c0202, 0x0e5b0105, 0x0af14e07, 0x58503e24, 0x19821740, 0x00010126, 0x63000307, 0x6f522a86, 0x901b2005, 
-    0x09895219, 0x110b402e, 0x27162816, 0x08212418, 0x252b1c08, 0x24061e5c, 0x27262223, 0x234f5c2e, 0x5cbd0321, 0x52200625, 0x5c214f5c, 0x4d5c051d, 
-    0xf6f92127, 0xa82cfb82, 0x290456fe, 0x46007c04, 0x47006500, 0x5107e843, 0xd1430b39, 0x401b2308, 0xb5540014, 0x02022107, 0x290de843, 0x43455254, 
-    0x46002426, 0x00424601, 0x05dd730b, 0x35013e22, 0x6206184e, 0x33200ab8, 0x070abf18, 0x0e070623, 0x20028401, 0x091b4203, 0x01152122, 0x4e0ab862, 
-    0x48670b4e, 0x01b80806, 0x1843266b, 0x2d1d1e18, 0x25151a36, 0x0603080b, 0x0e13180e, 0x32260e20, 0x460a0811, 0x609d393e, 0x4e535529, 0x3a434223, 
-    0x4078302f, 0x2620401b, 0x0e212b39, 0x0d130f0e, 0x020b1d0d, 0x3f09fe1b, 0x43363683, 0x66272629, 0x20563639, 0x1e182824, 0x1a041d10, 0xfe0f0e30, 
-    0x14141a56, 0x4a27283b, 0x171d4045, 0x351d2c34, 0x32362112, 0x29151b31, 0x2a4a2f11, 0x4c1e2e14, 0x372f3387, 0x1c28190c, 0x585b9136, 0x864a4897, 
-    0x1e3e1b40, 0x252c3624, 0x11211413, 0x09091d14, 0x66028f07, 0x4545823d, 0x5f3c518e, 0x1b202221, 0x2a4e1d1a, 0x172d411d, 0x4f230528, 0x502c2926, 
-    0x35055f43, 0x040000b6, 0x007b047f, 0x40c60029, 0x0201020a, 0x03011504, 0xc8590202, 0x821b2006, 0x05ba5a23, 0xf2505b20, 0x02022305, 0xa16b5903, 
-    0x50132709, 0x00174058, 0xad5d0404, 0x201e8d08, 0x9e1e8235, 0x823e2041, 0x001c2622, 0x02030302, 0x21568355, 0x708d5900, 0x1b4c0424, 0xa0821f40, 
-    0x24053865, 0x04010204, 0x202c8563, 0x23698600, 0x594d0302, 0x40250082, 0x112c1609, 0x0daa561b, 0x2309bc45, 0x35211521, 0x0811c341, 0xb6231149, 
-    0xa23112a6, 0x2d8d6776, 0x1d1a2b2d, 0x0136521b, 0x3ffdfd29, 0x1e1d1e5c, 0x61202118, 0x205e4445, 0x04b82120, 0x6364ac60, 0xae3f3f45, 0x44934f65, 
-    0x8f3a7640, 0x3d6d3484, 0x4457863a, 0x36323482, 0x7a2d2d34, 0x8273fd46, 0x00012eb3, 0x04e3ffbd, 0x005e0415, 0xb5b00013, 0x972d1911, 0x0821499d, 
-    0x13011322, 0x20055963, 0x0d255026, 0x010e2734, 0xa7ac1002, 0x83706bb8, 0x12a7b989, 0xe01da831, 0x261902e5, 0xfb210896, 0x079f47a2, 0x56feb62c, 
-    0x1406ba04, 0x83001500, 0xf38600b5, 0x2105494d, 0x424a0303, 0x0bdb5007, 0x2007db5d, 0x05db431b, 0x21075e6c, 0x2e890064, 0x2209294d, 0x6820401b, 
-    0x527c08d8, 0x89278605, 0x05176c22, 0x4d231321, 0x2524054a, 0x2223010e, 0x3324c98d, 0x55032115, 0x220af150, 0x829bfeac, 0x0bea49bb, 0x91d3f822, 
-    0x2a050743, 0x04e5ff68, 0x007b0469, 0x4d120139, 0x0a270522, 0x01060119, 0x54050137, 0x11850ab3, 0x11830020, 0x1e8a4020, 0x3207b354, 0x01010322, 
-    0x004b3c01, 0x5b040606, 0x44040400, 0x4b01074b, 0x4f4d0840, 0x50132409, 0x821a4058, 0x59012323, 0x7e620304, 0x02022a05, 0x05075a00, 0x00000308, 
-    0x08e55c3a, 0x3e204ba5, 0x1f214b82, 0x05146a00, 0x778d6020, 0x36054e78, 0x1b4c053c, 0x04002340, 0x04020600, 0x02006306, 0x57020005, 0x82010103, 
-    0x01002398, 0xc9826105, 0x825c0021, 0x79022099, 0x17360620, 0x35360001, 0x22232b2d, 0x17181b1d, 0x06070f11, 0x39013900, 0xad180809, 0x112207b4, 
-    0x9e541133, 0x3e152b0e, 0x17323301, 0x1115011e, 0x57451123, 0x22232505, 0x0e07020e, 0x35281083, 0x4d01010e, 0x141a3582, 0x230d6762, 0x81426225, 
-    0x0a351485, 0x24370e06, 0x0d1a2b22, 0xa7040404, 0x6b1b6225, 0x02679c36, 0x0f6662d7, 0x39426022, 0xfd331883, 0x47810229, 0x0d2a4565, 0x2a171b1d, 
-    0x52202138, 0x825efd33, 0x05bb411a, 0x56febc2a, 0x7b041404, 0xb9001300, 0x200c0b49, 0x054d441a, 0x24167b57, 0x40585013, 0x127a5b16, 0x20058153, 
-    0x9d1d8235, 0x0fbb573f, 0x570ee262, 0xab5318bb, 0x0dbd5709, 0x20112049, 0x0b5f5bbc, 0x57073f62, 0x00280abd, 0x93000200, 0x2a0448fe, 0x2238fb82, 
-    0x97012e00, 0x0d1d0f40, 0x04060502, 0x03020101, 0x03010001, 0x08b04b4a, 0x2620c782, 0x2005454c, 0x05267306, 0x084b4423, 0xab7c1101, 0x24375301, 
-    0x2a000123, 0x242e2328, 0x1b1e1f2e, 0x0a0f1119, 0x01220008, 0x4c080922, 0x3524056c, 0x3233031e, 0x21b37619, 0x4c55022a, 0x593254a5, 0x91254b50, 
-    0x19ac7619, 0x1c48fe22, 0x25a67619, 0x0101002a, 0x04000035, 0x00600413, 0x0c934518, 0x594b3c21, 0x3a2007cc, 0x18087c68, 0x240a9345, 0x1b4c003c, 
-    0x47061a40, 0x06fa591f, 0x02b8352c, 0x0422fd26, 0x8f2ffc60, 0xfb590000, 0x06692606, 0x01390014, 0x0647452e, 0x06011c24, 0x47450001, 0x4511850c, 
-    0x1e890647, 0x4609fb59, 0x4b45090f, 0x052f6608, 0x29570220, 0x0b135e08, 0x40462120, 0x06062405, 0x45045b01, 0x27830582, 0x00010523, 0x0a324b00, 
-    0xaa05fb59, 0x503e2459, 0x502a4058, 0x00240972, 0x00020700, 0x890baa46, 0x288b859a, 0x01002b40, 0x01040604, 0x09a75006, 0x8b087745, 0x202d843c, 
-    0x2c008259, 0x28180b40, 0x28162315, 0x08082215, 0x053a611c, 0x012e2723, 0x11664535, 0x66451120, 0x1502241a, 0x45416225, 0x4d452866, 0x0f664506, 
-    0xfd350423, 0x176745ec, 0x00b4fb36, 0x00020000, 0x0456fe4f, 0x007b0472, 0x0129001d, 0x0617b60c, 0x0a239019, 0x01052a39, 0x00010601, 0x61000107, 
-    0x3c020200, 0x0909004b, 0x03005b03, 0x5f4b4403, 0x13241396, 0x26405850, 0x0921318a, 0x07226509, 0xc45f2d93, 0x205faa06, 0x205f823e, 0x254a8228, 
-    0x08010400, 0x9a986304, 0x2609c45f, 0x08090003, 0x95630903, 0x0dc45f32, 0x251e1f2e, 0x1f291e23, 0x12111129, 0x1111232a, 0x2205c45f, 0x65333523, 
-    0x734a0740, 0x22232108, 0x0808b46d, 0x35363753, 0x06222110, 0xc7161415, 0x12a77878, 0x6466982e, 0x3b3939a0, 0x9f393a39, 0x025bd067, 0xb90efdf2, 
-    0x4386c901, 0x88f4fe43, 0xb9fe8888, 0x8f18058f, 0x4d515555, 0x868bda4d, 0x514c4ed7, 0x8fbbfeaa, 0x6d290263, 0xb001d86b, 0xd9d7d7d9, 0x00020000, 
-    0x8fa31889, 0x6d44201a, 0x3e231087, 0x6d405850, 0x5c191187, 0x11202433, 0x0f8fa318, 0xa3180820, 0x03324e8f, 0x56fe1900, 0x14069904, 0x30002900, 
-    0xa1003d00, 0xbf7a07b6, 0x2820080b, 0x03070700, 0x0303005b, 0x010a4b3b, 0x5b040202, 0x04040108, 0x01094b3c, 0x5b000101, 0x00000105, 0x830a7067, 
-    0x822620e6, 0x23168219, 0x63000106, 0x00203995, 0x20062967, 0x82488224, 0x04012351, 0x32936302, 0x593e2685, 0x3d104059, 0x1431323c, 0x111a1111, 
-    0x101b1129, 0x2b1d080b, 0x27262205, 0x3727012e, 0x376d011e, 0x068a6806, 0x013b3623, 0x0a315211, 0x23112328, 0x15062211, 0x326d1614, 0x0185080d, 
-    0x357d50e1, 0x7b2f5f38, 0x2b284721, 0x9a63375b, 0x393a3737, 0xafcc7039, 0x3e3ec18b, 0x3d3d3838, 0x7db88cc2, 0xb8777a74, 0x26277f5e, 0x26261c21, 
-    0x2005647f, 0x344d1c1a, 0x1a492d80, 0x2e031b1d, 0x7028282d, 0x28714445, 0x4747fe4d, 0x81c74545, 0x4e4ed681, 0x075bfe54, 0x48434f30, 0x422ffc51, 
-    0x619f3b3b, 0x30308c58, 0x01000032, 0xe3ff7000, 0x1406b004, 0x0f011500, 0x5028b04b, 0x0113b558, 0x4a010302, 0x2007821b, 0x58078204, 0x2220060b, 
-    0x28095f5c, 0x02020104, 0x05005a05, 0x060f6d05, 0xf7555c20, 0x8d18200d, 0x0cf35529, 0x40205e82, 0x352149a5, 0x05e15450, 0x2107de5f, 0x72860404, 
-    0x02020023, 0x20718a00, 0x2827823e, 0x0004001b, 0x05040005, 0x081d5662, 0x6707355d, 0x032605ba, 0x03010401, 0x25937004, 0x20059654, 0x07975459, 
-    0x291b1456, 0x15331133, 0x010e3521, 0x1456c201, 0xe8b92406, 0x67315ffe, 0x955405b5, 0x2ffc2207, 0x0813568f, 0x0000a02d, 0x7a043304, 0x70002900, 
-    0x822ab04b, 0x001921a6, 0x07dc4218, 0x5d030321, 0x042106cf, 0x0bce4b01, 0x03001626, 0x00720301, 0x8205e578, 0x211d87e5, 0xfe781b40, 0x5702230d, 
-    0x1e850200, 0x00023308, 0x40595950, 0x1e00010f, 0x0b14161d, 0x0129000a, 0x14080529, 0x2e22212b, 0x3e343502, 0x0e333702, 0x1e141503, 0x36323302, 
-    0x27263435, 0x16330324, 0x11821e17, 0x020e4b08, 0xa8706102, 0x12063871, 0x1abe191f, 0x22071420, 0x88446644, 0xfe665788, 0x02b501db, 0x568a617d, 
-    0xae753a28, 0x67a2713c, 0x3534361f, 0x2f311f20, 0x71471e32, 0x98a92b51, 0x66299174, 0x33a11401, 0x8b715825, 0x79ae6d58, 0x00820041, 0x9f000222, 
-    0x342ceb82, 0x20001606, 0x54002b00, 0x020817b6, 0x09dee318, 0x03001729, 0x00590103, 0x443b0101, 0x3a230a73, 0x441b4c00, 0x22840e6e, 0x594c0335, 
-    0x21221340, 0x26280001, 0x2b222b21, 0x20001112, 0x84062001, 0x51d085d1, 0x35260698, 0x16171433, 0xcb85011d, 0xdd842720, 0x20236b08, 0x02161411, 
-    0x31e8e66d, 0x1d619261, 0x471c3a2f, 0xa17eb546, 0x2c5a895c, 0x73ab7139, 0x8a858488, 0x018af0fe, 0xb075ff14, 0x8a165280, 0x11203329, 0x63641107, 
-    0xb9391b59, 0x815b2090, 0xc37e6eaa, 0xca914685, 0xfeb9c1bf, 0x00ccc18a, 0x6f000200, 0x610457fe, 0x2e001504, 0x43003e00, 0x191a4040, 0x27020102, 
-    0x01050226, 0xd8184a02, 0x63240e60, 0x04040107, 0x37057657, 0x304c003e, 0x3800012f, 0x303e2f36, 0x151f213e, 0x00090a13, 0x082e012e, 0x0120c282, 
-    0x18079441, 0x35099490, 0x2e071714, 0x36343501, 0x15163233, 0x15070614, 0x1415011e, 0xcf84020e, 0x23022e26, 0x15020e22, 0x6608d282, 0x81c7897e, 
-    0xcb86413e, 0x1d28198a, 0x52341710, 0x0f5a583c, 0xac171789, 0x3cc4c1b8, 0x4295973e, 0xa388b37c, 0x755c38a4, 0x5c763d3d, 0x57fea339, 0x56a3814e, 
-    0x5486aa58, 0x39331302, 0x3f231e3e, 0x48451d30, 0x26522d2a, 0x8589335d, 0x7d519491, 0xd838142a, 0x75ae74ac, 0x91a0953a, 0x27527f59, 0x59805227, 
-    0x8200a090, 0x00022200, 0x34f38237, 0x000b049a, 0x003d0030, 0x090b40bc, 0x04000207, 0x00060106, 0x06234c02, 0x02002b29, 0x02010501, 0x82007005, 
-    0x00043517, 0x01010368, 0x07050108, 0x0a630501, 0x04070701, 0x0404005c, 0x6f051b5c, 0x1a2405b0, 0x2c405850, 0x0621328d, 0x21339c70, 0x2e9c2a40, 
-    0x00040029, 0x09640407, 0x82060601, 0x59592d60, 0x31321740, 0x36390000, 0x3d323d31, 0x3108b382, 0x21233330, 0x0b222b14, 0x012b1a08, 0x2223012e, 
-    0x36270706, 0x02263537, 0x33363435, 0x17021e32, 0x20333633, 0x21101511, 0x34351120, 0x1122012b, 0x14821415, 0x17031e27, 0x3d363203, 0x08118301, 
-    0x14011d7e, 0x330c0316, 0x793f5194, 0x53292c33, 0x9caa9092, 0x2c2c301c, 0xa93c1419, 0xa9fe6701, 0x2b49a7fe, 0x75542e81, 0x627a5046, 0x51972751, 
-    0x7747954d, 0x5e57fe5d, 0x69262b52, 0x8b0b122c, 0xebd67201, 0x261609e5, 0x2bfe621d, 0x0206fe14, 0xfe5dea0f, 0xb87f6dc4, 0x26215983, 0x435c473d, 
-    0x857b6102, 0xf7b6f1d4, 0x00008b8d, 0xfea00001, 0x04330457, 0x002f0015, 0x00364039, 0x03010304, 0x2c05427c, 0x6e020103, 0x03000500, 0x63030504, 
-    0x07407c00, 0x4c003e33, 0x26280001, 0x181a1e1f, 0x0a0b1214, 0x2f012f00, 0x0b534207, 0x030e3328, 0x33161415, 0x37573520, 0x06594206, 0x83023e21, 
-    0x155208f8, 0x02061411, 0x76b17577, 0x36200e3b, 0x3624bc29, 0x92901224, 0x7b770801, 0xb03e7771, 0x71441a1e, 0x974f4b8f, 0xfedb4976, 0x8f633557, 
-    0x3f46295a, 0x3a1e203c, 0x7529453e, 0xa402f184, 0x706e8489, 0x2801656f, 0x8d5e366c, 0x66332e5e, 0x67fd689b, 0xbf82c3c6, 0xbf829e20, 0xbf823220, 
-    0x4d004227, 0x3c3d4a40, 0x20be8202, 0x6247184a, 0x5e022021, 0xcf840535, 0x2f333527, 0x1d25272e, 0x22d3861b, 0x4d420142, 0xbc440507, 0x05316d0b, 
-    0x012b3429, 0x3e323335, 0x43343502, 0x17230817, 0x43352623, 0x38080639, 0x1507020e, 0x14151116, 0x75700206, 0x093a74af, 0xc0212918, 0x09192c22, 
-    0x8a7f8f89, 0x394949ed, 0x191c3954, 0x33455e3b, 0x17243f58, 0xda3ca117, 0x1ad2d9ca, 0xed3d5638, 0x08f083e6, 0x20598d54, 0x23383435, 0x30323926, 
-    0x6f84731c, 0x8cf36270, 0x30584429, 0x2943552c, 0x324c3219, 0x523e6c27, 0xc0acac7e, 0x4c613eb1, 0x2c14193d, 0xbf4ffffe, 0x000000bd, 0x00b70003, 
-    0x064b0400, 0x00150014, 0x00350025, 0x110c4074, 0x12030201, 0x05030405, 0x9d570202, 0x07203406, 0x05000201, 0x63050204, 0x01030300, 0x0101005b, 
-    0x44084b3b, 0x3a25082b, 0x401b4c00, 0x8222881d, 0x01062418, 0x18000400, 0x0808ddc1, 0x4c033b27, 0x271b4059, 0x01161726, 0x262d2f00, 0x1f352735, 
-    0x1725161d, 0x000a0c25, 0x09150115, 0x212b1408, 0x37101120, 0x0c424435, 0x10110425, 0x41363201, 0x13200a27, 0x70080d8c, 0x37fe8002, 0xa85c6bc8, 
-    0x2faaabad, 0xfd46012e, 0x1f565aca, 0x22214132, 0x5b1e3241, 0x2e8988c7, 0x3333614d, 0x872f4c62, 0x4b01f701, 0x9220144a, 0xa2a7a576, 0x2b79529b, 
-    0x59fe2d14, 0xd70307fe, 0x563d606e, 0x371a1936, 0x6f623a54, 0xa5b7bafc, 0x2c5d9164, 0x65925d2c, 0x0000b5a5, 0x2d000200, 0x90040000, 0x20000b04, 
-    0x64002e00, 0x04010ab5, 0x07a85801, 0x01021823, 0xae551801, 0x00052509, 0x0207035b, 0x2105fb46, 0x1a8c1e40, 0x55180020, 0x218308c9, 0x4f00053c, 
-    0x22194059, 0x29000121, 0x222e2126, 0x15191c2e, 0x080d0f14, 0x01200006, 0x17460920, 0x42112005, 0x20080506, 0x013e3317, 0x1d163233, 0x23071001, 
-    0x10351136, 0x1d22012b, 0x27061401, 0x34113532, 0x0e072326, 0x3e0d8201, 0xae990116, 0x4ababcbe, 0x2b0e286e, 0xa2973c5f, 0x84d4a2ef, 0xa89e5321, 
-    0x572321a5, 0x8253595b, 0x032508ae, 0x2cf4f21e, 0xe12b3837, 0xa2fe43e2, 0x4201aea7, 0xb6190175, 0x91eefedc, 0x4b6901f3, 0x83010146, 0x8b94bd8c, 
-    0x22008200, 0x82a00001, 0x043226eb, 0x001b0015, 0x05e26639, 0x16820f20, 0x00010224, 0x47186302, 0x40210705, 0x28098216, 0x00730102, 0x00020200, 
-    0x06f95d57, 0x4f020038, 0x2914b659, 0x08042414, 0x26212b18, 0x21103502, 0x02141120, 0x16462307, 0x10340809, 0x8c012313, 0xcb01707c, 0x7c74c701, 
-    0x334b3192, 0x67411e1a, 0xc68f8149, 0x11016c94, 0xfeee01aa, 0xebfeae15, 0x928d3f67, 0x7b474493, 0xafaf345b, 0xf4fee4fe, 0x01335e82, 0x59fe9e00, 
-    0x02043404, 0x72002e00, 0x022829b6, 0x57010403, 0x232d06a3, 0x02030100, 0x00680102, 0x04050006, 0xf34a1806, 0x7102200b, 0x3e25056a, 0x401b4c00, 
-    0x08a14824, 0x5930269a, 0x00011540, 0x1e1f2021, 0x1517181a, 0x08091012, 0x2009e046, 0x09744826, 0x20331626, 0x2b10013d, 0x08ba1919, 0x20355708, 
-    0x0e141504, 0x1e150702, 0x10011d01, 0xecec7602, 0x202b1a0b, 0x182519ad, 0x018e8e0c, 0x4141ee03, 0xd9cd7173, 0x2d012d01, 0x49663f1c, 0x59fe918b, 
-    0x4427c2d5, 0x1d1e3a3e, 0x26423c3a, 0x32fc8e82, 0x64981001, 0x9a74795b, 0x5636b5c1, 0x140e2f42, 0x3296ab18, 0x8b4177fe, 0x068b4406, 0x33003e3e, 
-    0x090c3040, 0x08020002, 0x02000401, 0x0302004a, 0x00020300, 0x04000070, 0x6e040003, 0x30080d5a, 0x043e0404, 0x1d2e1c4c, 0x0805242b, 0x2e012b19, 
-    0x052c4603, 0x46013f21, 0x1620062c, 0x0e26ab84, 0x16141501, 0xd5850717, 0x35033e22, 0x4605925c, 0x72080534, 0xfa022315, 0x5a4d380c, 0x225f352e, 
-    0x0d713d4d, 0xe2e27c7d, 0x0f08e5e9, 0x1c100e16, 0x069f0203, 0x070b0905, 0x070c110a, 0x838b8b87, 0x326b593a, 0x34556d39, 0x3857febe, 0x251c3955, 
-    0x0e5a5f26, 0x4701820e, 0xebe9eeb2, 0x2e392ad9, 0x4d1c1829, 0x14241442, 0x1e2a3001, 0x0e1c232c, 0x382f2815, 0xa8a0a626, 0x99c67fb2, 0x5b2f2871, 
-    0x00285559, 0x82920002, 0x06282fc4, 0x001f0015, 0x4bbb002f, 0x58500cb0, 0xd6822e40, 0x0403012b, 0x01020068, 0x07020107, 0x2ddf8270, 0x07010607, 
-    0x03030063, 0x05005b05, 0xa7633b05, 0x0935560a, 0x6c462f20, 0x2136a608, 0x31972c40, 0x87092863, 0x4c033e71, 0x1b405959, 0x00012021, 0x2f202527, 
-    0x191b2f21, 0x0f111617, 0x0507090a, 0x1f011f00, 0x06b2430a, 0x33121027, 0x33171632, 0x06ce4511, 0x23011d2b, 0x20211035, 0x06140119, 0x05cc4927, 
-    0x0e226708, 0x1e141502, 0xea680202, 0x69dde7ec, 0x31142482, 0x2d33644f, 0xbb284256, 0xcf019f01, 0x7f79d5df, 0x6a487d8a, 0x48222144, 0x0105016f, 
-    0x01040108, 0x01413c05, 0x3a5a3e02, 0x3927151b, 0x013e3e24, 0xfd86fe26, 0x91f6f954, 0xc8c4b8b1, 0x46876a40, 0x426b8948, 0x02000000, 0x00009d00, 
-    0xfb053204, 0x20001500, 0xb943a600, 0x00273a05, 0x04060403, 0x00700603, 0x05060004, 0x00630604, 0x5b010202, 0x41010100, 0x545a184b, 0x06765708, 
-    0x58503a24, 0x2e8f2440, 0x07232482, 0x1a050001, 0x200e3646, 0x2626882b, 0x04020001, 0x87630201, 0x442e825d, 0x388409e5, 0x59594f36, 0x16171940, 
-    0x1b1d0001, 0x20172016, 0x0c0d0f11, 0x0507080a, 0x2b08e745, 0x11352622, 0x15012902, 0x11152221, 0x2205e744, 0x41021011, 0x3808072a, 0x02101506, 
-    0x02e3dd5f, 0xce014e01, 0x238d1efe, 0xdb6b7823, 0x8de9e8e4, 0x8c89898b, 0x02f5f589, 0x8f5b01b6, 0x42dafeb0, 0xfbfefe3e, 0xf0fefdfe, 0xbbbfc592, 
-    0xfec0bab7, 0x053b4384, 0x0000372f, 0x0b049a04, 0x58003100, 0x03010db5, 0x07b14500, 0x04001929, 0x04030203, 0x82017002, 0x03012fda, 0x63030004, 
-    0x02020106, 0x1b4c023a, 0x1b872040, 0x71201183, 0x03232082, 0x82570003, 0x03003b06, 0x0301055b, 0x594f0300, 0x32150a40, 0x29173412, 0x1b080727, 
-    0x3d26332b, 0x8b483401, 0x33173205, 0x3233033e, 0x011d021e, 0x36230714, 0x07341135, 0x24d38223, 0x2b341123, 0x08078201, 0x1716144d, 0x31c7fe23, 
-    0x2454855d, 0x15292d36, 0x2b291611, 0x87551e31, 0xb3bc325f, 0x404b99b3, 0x944d42a0, 0xe0c26663, 0xb17666ed, 0x190b3b76, 0x291f1c28, 0x763b0917, 
-    0xec6b77b2, 0x01cec1da, 0xcf01d719, 0x1501ebfe, 0xfcfee4cf, 0x8561c76e, 0x00a026df, 0x06340400, 0x23df820f, 0x292ab691, 0x210a1345, 0x13450020, 
-    0x18042006, 0x20086b50, 0x09c8643b, 0x20092f43, 0x08154521, 0x40212898, 0x0823901e, 0x0106022f, 0x60000200, 0x3b050500, 0x59594c05, 0x00011340, 
-    0x13152021, 0x0a0c1012, 0x31000506, 0x08073101, 0x22212b14, 0x37343526, 0x14150633, 0x05a34d16, 0x270ae748, 0x33352427, 0x011e1714, 0x2005194c, 
-    0x08068203, 0xdc6b024b, 0x5baf65ef, 0x82898391, 0x523f8c88, 0x1c375134, 0x48694521, 0xefacdcfe, 0x6159acab, 0x1b39573d, 0xbdd6d7e1, 0x8f977d59, 
-    0xaaa59f8f, 0x2e1b87a5, 0x4622213c, 0x36092b3c, 0x142947b0, 0x86608894, 0x491d1420, 0xdf4c7a60, 0x051b41ea, 0x59fe9f35, 0x32043304, 0x39002100, 
-    0x1e1f3640, 0x0a0b0c1d, 0x91480406, 0x510220cb, 0x3e220548, 0xe3764c00, 0x05072805, 0x21000304, 0x82062101, 0x22012cc3, 0x06332726, 0x35363221, 
-    0x84150511, 0x350521ae, 0x0806aa49, 0x2535275b, 0x5f021011, 0xbb01e0df, 0x91090102, 0x6e4dfe92, 0xf0feff6f, 0x25548a64, 0x58865b2e, 0x59fe9403, 
-    0x85e3b9b6, 0x34a80386, 0x6da62b3c, 0xa7019c9f, 0x2c3e2812, 0x3e536133, 0xfb818211, 0x006bfebc, 0x00370001, 0x069a0400, 0x00300015, 0x110a4097, 
-    0x01000401, 0x01010a4a, 0x05534f48, 0x00002028, 0x00010401, 0x90820068, 0x03050423, 0x094a4870, 0x4a180720, 0x35240822, 0x21405850, 0x04212785, 
-    0x21289970, 0x238f2840, 0x71204283, 0x00235182, 0x82570104, 0x01260806, 0x01065b04, 0x4f040104, 0x0b405959, 0x34123214, 0x1d112415, 0x2b1c0808, 
-    0x35112621, 0x37043e34, 0x33030417, 0x88483237, 0x07142e08, 0x013d3623, 0x22012b10, 0x13231115, 0x05714c36, 0x23176008, 0x24d20901, 0xe0aa7a4c, 
-    0x95fe198d, 0xa55618d9, 0x74230f48, 0xd09e9f4f, 0x5884d8c5, 0x0201a041, 0xe6677c4b, 0x1801d2d2, 0xbbb95467, 0x29809fb4, 0xa0fe5394, 0x3230623d, 
-    0xf58eddda, 0xc1dbb8d1, 0xfea72a01, 0xa73d01c3, 0xfba5dbfe, 0x000100b9, 0x0400009f, 0x00f10533, 0xb6640029, 0x8202191a, 0x4b4a23a8, 0xf38225b0, 
-    0x01001122, 0x073d6918, 0x67500320, 0x2718820c, 0x00720102, 0x5b000202, 0x40231887, 0x84010016, 0x00002313, 0x19875702, 0x83000221, 0x010d35ea, 
-    0x05080a00, 0x01290004, 0x14080429, 0x0222212b, 0x11330119, 0x2b06b042, 0x2e27022e, 0x36343503, 0x010e1737, 0x08064e4d, 0x02141521, 0xe9e26a02, 
-    0x89888db6, 0x33200d86, 0x27311827, 0x57646a18, 0x2d1d414d, 0x3a2b1936, 0x82e31024, 0x01260869, 0x12fcee03, 0xa7b8b8ba, 0x36424f33, 0x2c221019, 
-    0x8a492437, 0x3a1e7c3c, 0x282b161d, 0x411c1026, 0xef3d6150, 0x8d82fffe, 0xfe2d0038, 0x04a30459, 0x001400ea, 0x40340023, 0x0b1b1e31, 0x01030408, 
-    0xfa824a01, 0x01020326, 0x01056103, 0x2f0adb61, 0x00011516, 0x23151c1d, 0x090a2316, 0x14011400, 0x2905a042, 0x3502012e, 0x03371210, 0x31500333, 
-    0x12570807, 0x27023411, 0x06132313, 0x12101502, 0xcd835602, 0xfefc4b8e, 0x7b0fa60f, 0x43407ebb, 0xc188e08e, 0x0fa59ac3, 0x9ba30ea5, 0x5959febf, 
-    0xb00a01b1, 0x63013f01, 0xfe01012a, 0xca8a14fb, 0xf68181f7, 0x018c75c0, 0xf6170120, 0xfd3a2c01, 0x391a02e5, 0xfef8d4fe, 0x82e4fee7, 0x82372094, 
-    0x044a31af, 0x004b000c, 0x30554058, 0x2f080701, 0x02030901, 0x2008ae82, 0x01040204, 0x010a7002, 0x03010508, 0x63030809, 0x06000700, 0x63060704, 
-    0x04000900, 0x61040901, 0x08c78300, 0x00010b21, 0x4c003e00, 0x43450001, 0x383a3e3f, 0x2c2e3234, 0x21222426, 0x12141a1c, 0x4b000a0b, 0x4d0c4b01, 
-    0x184d16f6, 0x23072d06, 0x0e271027, 0x030e0701, 0x37272223, 0x2105b664, 0xfe4e013e, 0x05794505, 0x11158308, 0x77920210, 0x0e3c78b3, 0xb32a3722, 
-    0x0e203527, 0x04019393, 0x172c2215, 0x1927321a, 0x6e09850a, 0x06132525, 0x141e150f, 0x22325349, 0x211c1c31, 0x232c120e, 0x292c301c, 0x2f161414, 
-    0x41264036, 0xfe284a69, 0x96683759, 0x404a2c5f, 0x3f241b38, 0x7c24413f, 0xea02f08e, 0x1931472e, 0x46674220, 0x0d01c1c1, 0x22200202, 0x0c14180b, 
-    0x2d35b55f, 0x19181220, 0x34472b12, 0x102a4736, 0x537d5329, 0x7b4616fd, 0x02310805, 0x57fe2d00, 0x0b049304, 0x43003700, 0x0b409900, 0x07050128, 
-    0x09023132, 0x4b4a0204, 0x58500ab0, 0x01002e40, 0x01020206, 0x07010868, 0x0405010a, 0x05b84a07, 0x03040631, 0x09010c63, 0x09010600, 0x02006306, 
-    0x415c0002, 0x1b220635, 0x30832f40, 0x02010623, 0x0831a670, 0x21405933, 0x00013839, 0x43383c3f, 0x2a2c4339, 0x1b1d2426, 0x0d0f1215, 0x04070a0c, 
-    0x37000203, 0x080d3601, 0x20012b14, 0x3b143311, 0x013d2001, 0x35232734, 0x092c5033, 0x23020e25, 0x82022e22, 0x33362516, 0x33171632, 0x2608c751, 
-    0x10011d16, 0x50320121, 0x62080866, 0xfe8f0216, 0x2ff9b752, 0x50391601, 0x53643650, 0x81643e3b, 0x5e793f42, 0x4bafbd39, 0x60112766, 0x4e91918c, 
-    0x34fea150, 0x5e9fd2fe, 0xfe58a24d, 0xf7850157, 0x02a665de, 0xb6940197, 0x7bca7bcc, 0x353a77b5, 0x80649967, 0x382bcdcd, 0x89bdcb63, 0x5c142ca5, 
-    0x94fe698d, 0x05018002, 0xfafea7fb, 0x45949578, 0x823005cf, 0x130457fe, 0x3800f105, 0x32b5aa00, 0x01030401, 0x2106e470, 0x0b820027, 0x68040325, 
-    0x50020100, 0x06290c5e, 0x004b3906, 0x5b000202, 0x05764207, 0x39441b20, 0x50282005, 0x2f90178e, 0x00284026, 0x72060506, 0x5a8a2f97, 0x40595935, 
-    0x35000115, 0x252c2e34, 0x161b1d24, 0x000a0b14, 0x53380138, 0x17200c18, 0x2f08ad54, 0x02121337, 0x15062223, 0x17021e14, 0x35012e23, 0x08083c48, 
-    0x1133138c, 0x56020614, 0x3c76af73, 0x26341f0d, 0x1d3023b0, 0x6a47250d, 0x017f8f45, 0xa0930101, 0x150a5c58, 0x25b3141f, 0x654c2e21, 0x5d673438, 
-    0x01111c50, 0x57fedbad, 0x5c956a3a, 0x383b4229, 0x3d23011e, 0x3c223c3a, 0xad264662, 0x012801b1, 0x550a0112, 0x44472062, 0x8b39143b, 0x4b775444, 
-    0x46321b22, 0xfa99022b, 0x00effd52, 0x00010000, 0x0456fe37, 0x000c049a, 0x4054003a, 0x05011551, 0x01010c02, 0x00010904, 0x08010801, 0xee500400, 
-    0x01042509, 0x6e010405, 0x053b3082, 0x006e0001, 0x00050800, 0x01036e08, 0x05010702, 0x63050206, 0x08080109, 0x824c083e, 0x003a2d51, 0x3412323a, 
-    0x14262415, 0x1c080a24, 0x2209784c, 0x4e003537, 0x362808c6, 0x1d163233, 0x010f1401, 0x21066742, 0x1d491115, 0x09ae5205, 0x08055d08, 0x315b4a33, 
-    0x412d6633, 0xd0fe403a, 0x654ca5b0, 0x99471026, 0x8ca9a7a0, 0x3a648678, 0x974c41a0, 0x3674623f, 0x49627b4e, 0x2e57fe1c, 0x261f394e, 0x01545c2a, 
-    0x01050116, 0xf6f85027, 0xe2683434, 0xb0f546e0, 0xdbafa601, 0xcbfeaff0, 0xfeaf3501, 0xb07d8afa, 0x2c1e527c, 0x4a69554b, 0x9e31f783, 0x320459fe, 
-    0x2d00f703, 0xb04b7d00, 0x4058503c, 0x29ca832a, 0x03007205, 0x03060406, 0x6b6d7004, 0x00062808, 0x04060104, 0x51020064, 0x1b2509d7, 0x05002e40, 
-    0x222b8207, 0xa4070607, 0x40593630, 0x2a000117, 0x19222429, 0x0b0d0f18, 0x0406080a, 0x012d0003, 0x050b522d, 0x3335262c, 0x20331614, 0x0e23013d, 
-    0xd6562301, 0x3e520810, 0x33113502, 0x02061411, 0xbcecea74, 0x0a018c8f, 0x5f802e14, 0x3871a86f, 0x4b69441f, 0x497555d8, 0x6c462221, 0x45623c4a, 
-    0xfedeb325, 0x83c9c759, 0x32f4f182, 0xaa784030, 0x6c7e4d69, 0x693b2e60, 0x4845746c, 0x1d2a5071, 0x023b583b, 0xbee2fb09, 0x008200ba, 0x00024108, 
-    0x04000037, 0x00140635, 0x003f0033, 0x1eb04bdb, 0x32405850, 0x0b010200, 0x700b0201, 0x01060800, 0x04080104, 0x00010061, 0x0b010a0b, 0x03010563, 
-    0x095b0703, 0x3b070701, 0x0a010d4b, 0x0c5b000a, 0x240c6e47, 0x08060039, 0x20d58204, 0x20418970, 0x2140a600, 0x3b9f3640, 0x6d827082, 0x5f000a22, 
-    0x2608858a, 0x59594c03, 0x34352340, 0x393b0001, 0x3f353f34, 0x27282c2e, 0x20212325, 0x14151a1c, 0x0d0e1012, 0x3300090b, 0x580e3301, 0x33200a28, 
-    0x23058d4d, 0x011d2223, 0x4a463782, 0x34232106, 0x2105d644, 0x1e82033e, 0x16131522, 0x08089b4d, 0x1415068b, 0x82960216, 0x3a3c7cbe, 0x5d71aa72, 
-    0x8e142386, 0x26169d8d, 0x271c1f34, 0x6f9b0b18, 0x207e5573, 0x3b2a1014, 0x908e334c, 0xe6d20102, 0x8a8b7a83, 0x5c998388, 0x6263be95, 0x405890ba, 
-    0xd5210142, 0x342321d2, 0x171a344e, 0xbb405635, 0x32635eb1, 0xa5172f49, 0xe909fd9b, 0xb8b091f4, 0xb4bac4cb, 0x0000c1c8, 0x9e000200, 0x34040000, 
-    0x22001406, 0x98003000, 0x06290b40, 0x08050402, 0x02040601, 0x18b04b4a, 0x21405850, 0x280c8307, 0x00680604, 0x01020004, 0x3c0a1a04, 0x4b3b2209, 
-    0x8a581803, 0x82352008, 0x86222028, 0x70022128, 0x40202999, 0xb7512489, 0x36548f06, 0x59594c05, 0x23230f40, 0x30233023, 0x59122225, 0x0808221c, 
-    0x41132b1a, 0x16240527, 0x15031e07, 0x080ac851, 0x23222687, 0x23011920, 0x32333613, 0x2e353617, 0x06222301, 0xb7a01115, 0x0ed3b5c0, 0x573c6202, 
-    0x8d8b1b39, 0x446544b2, 0x62412121, 0x08110841, 0xd0b2fefe, 0x382fca33, 0x687b0e38, 0xbe046267, 0x9d9caaac, 0x5b1aa160, 0xb14e8f77, 0x326000ff, 
-    0x47959081, 0x365c7c46, 0xfdd7fe01, 0x689503b5, 0x5d4a8706, 0xfe6f6762, 0x010000e4, 0x59fe5600, 0x25047a04, 0x63003c00, 0x01070f40, 0x32330403, 
-    0x02030202, 0x0401064a, 0x05606148, 0x04001a2f, 0x66040303, 0x02000300, 0x64020301, 0x071b5d00, 0x4c003e25, 0x8219401b, 0x7204211c, 0x22081b93, 
-    0x01114059, 0x1a262700, 0x0f151718, 0x013c000d, 0x1408063c, 0x0020012b, 0x13103511, 0x1d020617, 0x55121001, 0x26210597, 0x06ea512b, 0x27022e29, 
-    0x3327032e, 0x79171614, 0x1520056b, 0x6e080683, 0x7c02020e, 0xf0feeafe, 0x535291d1, 0x7b4cb7b2, 0x61552e56, 0x5053b0b8, 0x283d2714, 0x1e2a3116, 
-    0x4042b701, 0x23343a16, 0x4d375358, 0x81411530, 0x0159febf, 0x6168015b, 0x64014401, 0xeffe7e4c, 0xdffe9e90, 0x5d30eafe, 0x71785b8b, 0x27505e88, 
-    0x0f1e2736, 0x4d2f1808, 0x194f433e, 0x482f1b09, 0x2b765136, 0x50472314, 0xac6b3b5e, 0x8200427b, 0x00022e00, 0x0400008a, 0x00f1051f, 0x001a000f, 
-    0x05d7469a, 0x5c582220, 0x00012b08, 0x05010405, 0x03030063, 0xbd594b39, 0x09f34d09, 0x715b2220, 0x58022005, 0x2e8606ed, 0x4021298d, 0x82249728, 
-    0x88572079, 0x0422082b, 0x59594f00, 0x10111740, 0x14160001, 0x1a111a10, 0x090a0b0c, 0x0f000507, 0x08080f01, 0x22212b14, 0x0e511126, 0x11332507, 
-    0x20270210, 0x0807c257, 0x51021633, 0xe6e2e1e6, 0x1419846a, 0x01ebe4b2, 0x89868c15, 0x01ff8285, 0x01080104, 0x023a390b, 0xfe14fc4e, 0x91fffefc, 
-    0xbec07801, 0xb6bdc0c3, 0x00020000, 0x287982a1, 0x0014069c, 0x0043002f, 0x05b744d4, 0x00312808, 0x090a0908, 0x00700a08, 0x04010602, 0x61040209, 
-    0x0a000900, 0x630a090b, 0x05050107, 0x01035b01, 0x4b3b0101, 0x440b0b00, 0x38280fb6, 0x06020400, 0x70060402, 0x00244089, 0x06020906, 0x40213fa1, 
-    0x273a9f35, 0x010c0b00, 0x5f000b00, 0x0537828a, 0x4059594c, 0x4000011f, 0x2734363e, 0x20222325, 0x181b1c1e, 0x46111216, 0x00250512, 0x0d2f012f, 
-    0x067d4c08, 0x51056f43, 0x152d0507, 0x022e3423, 0x1d062223, 0x34352301, 0x071e5123, 0x15021e26, 0x13020e14, 0x08082d58, 0x33021e92, 0x02023e32, 
-    0x96dfcd4d, 0x2171628a, 0x577d1e14, 0x0b996e73, 0x3e1c2718, 0x8e8d9d51, 0x5b892314, 0x3970a870, 0xaeb77739, 0x34654e30, 0x2e4b5e30, 0x36654e2f, 
-    0x2d4a5e31, 0x07010801, 0x9fa1c502, 0x625f675a, 0x5640bbb1, 0x68681735, 0xd5d22123, 0x4042dffe, 0x63ba9258, 0x5b94be62, 0x90610a02, 0x57292f5f, 
-    0x965e5e86, 0x5e2f3768, 0x0200008d, 0x59fea000, 0xf1053404, 0x44003200, 0x11409400, 0x08022023, 0x021a2a03, 0x08090702, 0x03020102, 0x2d06a44d, 
-    0x0005002c, 0x06050706, 0x07010a61, 0x6a820200, 0x0400632a, 0x004b3904, 0x5b030808, 0x2405d87e, 0x5b000101, 0x069e4909, 0x432a4021, 0x082407a9, 
-    0x63080305, 0x2c8a3b91, 0x40592a08, 0x0133341d, 0x333c3e00, 0x28443444, 0x22252627, 0x1c1e1f21, 0x000f111b, 0x0b320132, 0x012b1408, 0x34352622, 
-    0x1737023e, 0x05235e06, 0x023e2208, 0x27263435, 0x20072726, 0x17211011, 0x16113311, 0x23153317, 0x16010f14, 0x15011e17, 0x32010614, 0x05196f37, 
-    0x0807995c, 0xe4e66a9f, 0x161f1309, 0x4b2e268f, 0x62333361, 0x5a562f4d, 0xfe590371, 0x4d4101cb, 0xb8025d9d, 0x020152bd, 0xe44847ab, 0x2855ccfe, 
-    0x2e1d1414, 0x3c1f1f3d, 0xfe531d2e, 0x24b7ca59, 0x1a313339, 0x3e4a2469, 0x20203e5d, 0x54416141, 0x65703380, 0x01480113, 0xb401094d, 0x6a3a01fe, 
-    0x483769a2, 0x97316842, 0x03cac26d, 0x4b1a33d9, 0x324c342a, 0x4d321717, 0x00645a37, 0xb3000200, 0x48040000, 0x0e00f105, 0xc4001600, 0x5013b04b, 
-    0x00214058, 0x03050302, 0x03006802, 0x03040500, 0x01006305, 0x06da4301, 0x47065c21, 0x2520088e, 0x22202882, 0x05212885, 0x20299c70, 0x23298435, 
-    0x72010301, 0x07232e8f, 0x60040401, 0x3a260581, 0x401b4c00, 0x24960028, 0x83080444, 0x0424087f, 0x59595000, 0x10174059, 0x1400010f, 0x10160f12, 
-    0x06080a16, 0x00030405, 0x080e010e, 0x212b1408, 0x33011920, 0x2005da53, 0x05044412, 0x20211022, 0x52080882, 0xab35fe7e, 0x607d2a29, 0xe5e4e6d4, 
-    0xf2fe0e01, 0x0d02eefe, 0xa1fde403, 0xfbfe3b49, 0xfcfef9fe, 0x0191fafe, 0xfe7c017b, 0x0085fe84, 0x9f000100, 0x340459fe, 0x3700d704, 0x2d403000, 
-    0x28292a2b, 0x22232425, 0x010a0a0b, 0x004a0102, 0x72020102, 0x4f010100, 0x3e2d05f4, 0x00014c00, 0x14162627, 0x37013700, 0x5e818204, 0x854b089e, 
-    0x056e5b08, 0x3d26272f, 0x05352501, 0x05113335, 0x14152515, 0x06ce4517, 0x72656108, 0x0b3872aa, 0x901e2919, 0x050e1914, 0x33614c2f, 0x2e4c6233, 
-    0x34492f15, 0x01b9feab, 0x50019247, 0x34d7b0fe, 0x3a142e49, 0x59feae74, 0x66a2713c, 0x4443482b, 0x34215929, 0x4915282b, 0x2a2a4f73, 0x2f4a7351, 
-    0x2b525255, 0x78a085ad, 0xfee880b4, 0x86b17ff3, 0x34ba487d, 0x3a65605e, 0x3d72a365, 0x8c36cf83, 0x22040000, 0x4d001406, 0x0c40b300, 0x05023d3e, 
-    0x02434406, 0xbb7d0403, 0x58282007, 0x64330dd5, 0x03000400, 0x63030401, 0x3b070700, 0x0202004b, 0x49085c00, 0x29200c89, 0x9a0edf58, 0x26402130, 
-    0x496d2b98, 0x08648207, 0x594c0725, 0x01174059, 0x22303100, 0x151d1f20, 0x08101213, 0x00030406, 0x094d014d, 0x212b1408, 0x33351120, 0x53210215, 
-    0x2b21060d, 0x08c35c01, 0x272c0a8a, 0x3335032e, 0x17021e14, 0x1415031e, 0x82050260, 0x380b8205, 0x5c02020e, 0x02bc30fe, 0x6a4d0d01, 0x1d111d42, 
-    0xfbfb1829, 0x0d192619, 0x0804820d, 0x17f9fb83, 0x160c1722, 0x1b4d6439, 0xa6344a50, 0x34634e2f, 0x354a501a, 0x944c4e90, 0x11263c2b, 0x01aa7239, 
-    0xfe6565a0, 0x504128ec, 0x2d3a2028, 0x2115961b, 0x2b16162b, 0x13981421, 0x1d172a20, 0x0d171d28, 0x5b321404, 0x2033264b, 0x11030713, 0x9143512b, 
-    0x601b142e, 0x143a8042, 0x453b351b, 0x597e502a, 0x0100002f, 0x59fe8a00, 0x14064704, 0xd9006a00, 0x54551140, 0x5e080702, 0x0605025d, 0x03026465, 
-    0xd4931904, 0x5a302007, 0x02260b53, 0x00630304, 0xd76f0909, 0x07072e07, 0x08005b08, 0x004b3c08, 0x5b000202, 0x08644e0a, 0x58501e2c, 0x01003340, 
-    0x01090809, 0x3f957008, 0x40213a95, 0x26358831, 0x06070008, 0x95640708, 0x3b6e8a3d, 0x1b405959, 0x46470001, 0x383a3b3d, 0x2f313234, 0x27292a2c, 
-    0x10111f21, 0x6a016a00, 0x5e050645, 0x3e2b066f, 0x26343501, 0x15163327, 0x4e070614, 0x35280889, 0x2b022e34, 0x32333501, 0xcd5a1b82, 0x0aeb4808, 
-    0xbc413082, 0x08c06107, 0x8605c541, 0x06d9080e, 0xc78f9402, 0x0d07387c, 0x0a080e15, 0x3ab92222, 0x130e0605, 0x4917050c, 0x727f738a, 0x22322111, 
-    0x42868888, 0x428a8a42, 0x88464042, 0x16454188, 0x9130472d, 0x341ea601, 0x35112645, 0x5b582433, 0x2c16585b, 0x5a592e43, 0x5b585d56, 0x4059fed7, 
-    0x3086c582, 0x458f8778, 0x5b324628, 0xc5b46abd, 0x3a2c5528, 0x2b859392, 0x3c66884c, 0x42255f54, 0x8e8e1c32, 0x4d8a534a, 0x9142464a, 0x2f162a3f, 
-    0x2209202a, 0x1e2317b2, 0x16060d1a, 0x5037482d, 0x15141166, 0x47295463, 0x14072538, 0x4e517411, 0x1c141a61, 0x94996584, 0x00020000, 0x04f3fea0, 
-    0x00160434, 0x00280018, 0x162a402d, 0x00030211, 0x184a0103, 0x47000214, 0x03000102, 0x01007300, 0x57010303, 0x03010100, 0x2e19825b, 0x182d4f03, 
-    0x08041027, 0x32172b18, 0x4f112437, 0x152b06a6, 0x16070614, 0x27241537, 0x5b010706, 0x50080b36, 0xfe5095c9, 0xa5824ff2, 0x81a45556, 0x5b8f8a4e, 
-    0x96f8fe90, 0x9f01dfc0, 0x20426748, 0x86888989, 0x3c67421e, 0x4301a959, 0x4384c581, 0x81c38442, 0x5e57f3a5, 0xc245d105, 0x830147c0, 0x84654817, 
-    0xbfc0b454, 0x668553b2, 0x00000049, 0xfe9f0001, 0x33ab8258, 0x00240015, 0x130d4079, 0x23020101, 0x04202122, 0x4a020100, 0x2f051c5b, 0x03040023, 
-    0x68040302, 0x03000500, 0x61030504, 0x012ade82, 0x63010200, 0x00000107, 0xe3675b06, 0x21258508, 0x269b7002, 0x40593108, 0x1c000115, 0x0f10111a, 
-    0x090c0d0e, 0x00040607, 0x08240124, 0x012b1408, 0x10351120, 0x33352305, 0x012f3632, 0x11231505, 0x04051025, 0x0e141511, 0x67088c82, 0x3735022e, 
-    0x02120717, 0xfe0c016a, 0x947272c2, 0xfe01028c, 0x6c03ad20, 0x1401ecfe, 0x56a58150, 0x4e81a456, 0x0215b41f, 0x0701e5fe, 0x012b0120, 0x4aaabba0, 
-    0x5d01cc1e, 0xb82ffe1d, 0x20f1fe71, 0x33659765, 0x65986532, 0xfe5b146f, 0x000100f9, 0x0457fe97, 0x0016062c, 0x4093002b, 0x0801220f, 0x05010f07, 
-    0x02262708, 0x24058943, 0x4058500a, 0x070e452d, 0x05000824, 0xe45d0804, 0x0707210a, 0x1345f084, 0x084c4806, 0x2f832e20, 0x82010321, 0x3930a4fb, 
-    0x01194059, 0x1a1e2000, 0x13171819, 0x0b0c0e11, 0x03040609, 0x012b0002, 0x09410a2b, 0x10333705, 0x35112021, 0x35232134, 0x0e112433, 0x26222301, 
-    0x17363435, 0xdd582215, 0x37520806, 0x07061411, 0x011d0415, 0xfe610210, 0x0b01be36, 0xedfe0d01, 0x14019c9c, 0xe8478a40, 0x9ce9e2de, 0x8595979c, 
-    0x9c9870e0, 0x57fe3501, 0xf8fe9501, 0xec370801, 0x9f010a9d, 0xb5b21114, 0x8e01c7b8, 0x6b70727b, 0xf8fe5454, 0x1436f6c8, 0xfe37f63e, 0x0082006b, 
-    0x00033108, 0x04000072, 0x00150663, 0x0026001c, 0x4b72012f, 0x585007b0, 0x090d3140, 0x01050402, 0x02040102, 0x070b0063, 0x06570b01, 0x07000101, 
-    0x6107010a, 0x22075a49, 0x4f0e4b3b, 0x0a200eac, 0x2c203882, 0x3282388a, 0x83010b21, 0x99632033, 0xb70c2033, 0xb211206c, 0xb535206c, 0x2e40216c, 
-    0x22190d41, 0x500a010e, 0xe288053f, 0x594c0822, 0x40330083, 0x1d272827, 0x2c00011d, 0x282f272a, 0x1d261d2f, 0x191f2125, 0x2a07edbc, 0x07090d0f, 
-    0x1c000406, 0x460f1c01, 0x342705e6, 0x35213336, 0x61262221, 0x1d25058a, 0x23153301, 0x24038315, 0x35130614, 0x05d76c34, 0x20133324, 0x0a84013d, 
-    0xfe350230, 0x01e3e13d, 0xe3effe11, 0xe0e3e2e1, 0x008272da, 0x31db5f08, 0x8389f5fe, 0x01058383, 0x84effe0c, 0xad550182, 0xaeb8a1b5, 0xaca5a9ae, 
-    0xb2a194d8, 0x03a5aab6, 0x63c3d8ec, 0xfc6a6767, 0x67c4d3a0, 0x0200cb65, 0x58fe3700, 0x16049a04, 0x32002500, 0x0e40b200, 0x01020114, 0x08030121, 
-    0x06000123, 0xb04b4a03, 0x40585020, 0x0401052a, 0x02010109, 0x69180104, 0x3a3108db, 0x08010a4b, 0x005b0608, 0x4b3a0606, 0x07000000, 0x384e185b, 
-    0x82352008, 0x8b282031, 0x03002531, 0x63030206, 0x40212f96, 0x252a9426, 0x08000600, 0x588a6306, 0x59592108, 0x26271340, 0x32262b2e, 0x25153227, 
-    0x14112323, 0x080b1033, 0x32012b1c, 0x23341127, 0x15010e07, 0x15261182, 0x10351124, 0x42563221, 0x011d2f05, 0x22230614, 0x15232726, 0x32012102, 
-    0x1b5d3536, 0x01500808, 0x4d09b768, 0x80373c61, 0x3101c2fe, 0x3d1043b8, 0x9a9999b8, 0x0f4d468f, 0xb2fe0a0f, 0x3c41f801, 0x54494c88, 0x03e7e6fe, 
-    0x0101b209, 0xc1fe5f5c, 0x010394d9, 0x8c01f078, 0xc6c69191, 0x35caccf4, 0x7cfe983f, 0x584f3902, 0xa7afa101, 0x696a83fe, 0x0138a682, 0x59fe6a00, 
-    0x16046604, 0x30004200, 0x3a3b2d40, 0x05191b1c, 0x4a010103, 0x2a13227f, 0x32340001, 0x15171e20, 0x7f014200, 0x3a47061f, 0x35052f07, 0x23022e34, 
-    0x17150622, 0x36342707, 0x804d3233, 0x08464705, 0x35023e25, 0x68372734, 0x720805de, 0xc68f6f02, 0x5127367a, 0x4b23547c, 0x1d314048, 0x2b3e2814, 
-    0xa5055d4c, 0x5ba6b00a, 0x2c295685, 0x50527f55, 0x25264d75, 0x49567a4f, 0x402c5175, 0x4533319a, 0x59febb82, 0x559e7948, 0x65798a4b, 0x1d1a0f24, 
-    0x2b3f3023, 0x182b3b22, 0x15384f50, 0x2d9c9e41, 0x3b38644c, 0x205d6c76, 0x70634d14, 0x4e653637, 0x704a252f, 0x5c367b4a, 0x685a8e36, 0x8435699d, 
-    0x82b320e7, 0x04472be7, 0x002e0028, 0x120a4080, 0xe3820201, 0x01011323, 0x05685848, 0x82002821, 0x00723110, 0x02030204, 0x00700304, 0x05050306, 
-    0x02006806, 0x22050142, 0x63050500, 0x29200a24, 0x03232a90, 0x93700506, 0x4059302b, 0x2d000115, 0x2126282c, 0x0b1c1f20, 0x63030409, 0x20250829, 
-    0x11330119, 0x06986b14, 0x27022e23, 0x05554b37, 0x22012b24, 0x8c4d2327, 0x334b0808, 0xfe7e0202, 0x4827ad35, 0x89943c63, 0x42634220, 0x486842ab, 
-    0xab6d3426, 0x56b80277, 0x644d2f14, 0x4f643434, 0xfe01bb30, 0x048c0159, 0x30ccfd19, 0x90183047, 0x6c7a4892, 0x353f2e60, 0x48979084, 0x3f6c9151, 
-    0x6241e359, 0x82212141, 0x70fe2204, 0x39008200, 0xfe650002, 0x045a0457, 0x00280024, 0x40360034, 0x03010633, 0x004a0104, 0xf8820403, 0x0070022b, 
-    0x03040001, 0x00630401, 0x0bf25d02, 0x252e302d, 0x0f1d1f24, 0x0128000d, 0x4e080628, 0x36210639, 0x09985737, 0x27073249, 0x3e323316, 0x33013d02, 
-    0x03230f82, 0x6335013e, 0x56080630, 0xb5740216, 0xd37976ad, 0xb58e57c9, 0x8fb75f5f, 0x54bdad57, 0x531d4570, 0x3042275a, 0xbcbdb21b, 0x9f9d95a6, 
-    0xfea09fa0, 0x7d989857, 0xd42c2c9a, 0x6fa56fa0, 0xa36d3837, 0x59df8c6b, 0x4d464322, 0x12584d2c, 0x4c233523, 0x028d8d4c, 0x839616ef, 0x8b95948c, 
-    0x8200918b, 0xffa026ab, 0x04330479, 0x31cb8216, 0x1a0f4047, 0x040e0f19, 0x4a010200, 0x030b0c27, 0xda614700, 0x820e2005, 0x00022425, 0x82630201, 
-    0x003a21fb, 0x2205b174, 0x82730002, 0x01022711, 0x01010057, 0x31825b02, 0x594f022c, 0x271b29b5, 0x2b170803, 0x4d183405, 0x2721083f, 0x065b6736, 
-    0x11043726, 0x36270314, 0x4b08ce88, 0x07171617, 0x120cef02, 0x471c0814, 0x21604535, 0x77744382, 0x01f2f275, 0x6c918faf, 0x89928480, 0x7db16e63, 
-    0x0f018670, 0x1b081614, 0x4a393b21, 0x571e1866, 0xd8e19efc, 0xc0fe2302, 0x3de8feb8, 0x767091f0, 0xd688a397, 0x5d932a5c, 0x80829682, 0xf5029535, 
-    0x14063b03, 0x26001600, 0x39403c00, 0x0305010c, 0x4e004a01, 0x072206c9, 0x18680401, 0x02023e06, 0x01005b01, 0x4c023b01, 0x00011718, 0x26171c1e, 
-    0x0d0e2618, 0x0507080a, 0x16011600, 0x06994108, 0x3b341129, 0x22251501, 0x4337011d, 0x28620686, 0x06536307, 0x605e3c08, 0xfeebb969, 0x347b46fe, 
-    0x1a1a344d, 0x392e5336, 0x21363c3b, 0x0e0d1d2f, 0xf5022d1d, 0x4c01908e, 0x510252b5, 0x4e2f4f9e, 0x65343565, 0x6b4f304f, 0x215c605c, 0x25244536, 
-    0x83213746, 0x00032aaf, 0x04e3ff85, 0x00f0054c, 0x29af8212, 0x4bbe0047, 0x585027b0, 0x5f182240, 0x082c09e5, 0x04050501, 0x0404005b, 0x01074b3c, 
-    0x2007c36a, 0x08b77a42, 0x04002022, 0x02222182, 0x17690504, 0x90412008, 0x823a2027, 0x881d2051, 0x23458227, 0x02000106, 0x21091c69, 0xaf660341, 
-    0x03002505, 0x63030104, 0x0023278b, 0x88570200, 0x00023f74, 0x5959594f, 0x27271b40, 0x00011314, 0x47274727, 0x1c1e3739, 0x26142613, 0x12000709, 
-    0xb77a1201, 0x262e0806, 0x36371011, 0x17163233, 0x14151216, 0x27060702, 0x36373632, 0x2e271011, 0x07222301, 0x1015010e, 0x13011e17, 0x27022e22, 
-    0x3435032e, 0x2b85023e, 0x8205b343, 0x0232081e, 0x7a79f068, 0x76f0797a, 0x3e3c3eb6, 0xef7b3c3e, 0x45226949, 0x4a682245, 0x2323458d, 0x47692446, 
-    0x0e13190f, 0x06080506, 0x07050204, 0x1c321c06, 0x0c820e27, 0x01034e08, 0x0d050704, 0xc5c41d2b, 0x7e017d01, 0x6460c4c5, 0xc4e1fe60, 0x60e2fec4, 
-    0x4a4ea0c4, 0x01370197, 0x4e4b9638, 0xa1e34b98, 0x4e96c8fe, 0x1709014a, 0x181d3527, 0x11343b3a, 0x3d382e0c, 0x464c8f1c, 0x33393a19, 0x372a0a11, 
-    0x484a1f3e, 0x32008200, 0x00f60001, 0x05460400, 0x000a00d5, 0x0304b75c, 0x69000302, 0x0c60087f, 0x01023305, 0x5a030000, 0x3a030300, 0x4b1b4c03, 
-    0x58503ab0, 0x13840e40, 0x5e030022, 0x392c2b82, 0x401b4c01, 0x00010017, 0x01027201, 0x00212582, 0x821c8455, 0x00330830, 0x59594e03, 0x141111b6, 
-    0x18080410, 0x1121252b, 0x33253505, 0x21152111, 0x3a010e01, 0x5001aefe, 0xfc3601ca, 0x7504aac8, 0xfa4ab84c, 0x0000aad5, 0x82980001, 0x0523298b, 
-    0x003c00f0, 0x1d0e4071, 0x1c225382, 0x17820201, 0x1d6b9582, 0x00152106, 0x65650e82, 0x02002405, 0x8c590302, 0x00122396, 0x2a820002, 0x23885d20, 
-    0x9a820020, 0x82001821, 0x010223bf, 0xdf7f6300, 0x3925830a, 0x4059594d, 0x3a3b3c0b, 0x19222439, 0x14080417, 0x3634372b, 0x37013e37, 0x0284033e, 
-    0x3435012b, 0x23262726, 0x07060722, 0x18158335, 0x270bb545, 0x010e0703, 0x07030e07, 0x6e08ca82, 0x390e0b98, 0x3e33599c, 0x1b0e1928, 0x0a192129, 
-    0x25241211, 0x645a814a, 0x67347064, 0x30623230, 0x3c44b668, 0x0b161648, 0x1b2c231c, 0x2635501d, 0x435d4940, 0x75fcb802, 0x0e1d1386, 0x3761a53c, 
-    0x111d2c44, 0x2c2f3520, 0x2a4c2616, 0x4723633c, 0xcc432121, 0x0d0c2519, 0x353c380c, 0x61336099, 0x32301931, 0x5a222037, 0x49412939, 0x82aa475e, 
-    0x002208fc, 0x04e3ff95, 0x00f00543, 0x409c0042, 0x04012916, 0x03012805, 0x02013804, 0x01010703, 0x00010602, 0x2b410501, 0x701e2006, 0x042d0872, 
-    0x005b0504, 0x4b410505, 0x00010100, 0x097a735b, 0x58503a24, 0x25881b40, 0x18820120, 0x5f000123, 0x202d8700, 0xcfdf1804, 0x2c2e2e2a, 0x191b2224, 
-    0x0c0e1618, 0x42014200, 0xf0671807, 0x35272108, 0x2f05ce74, 0x013e3732, 0x2e273435, 0x35012b01, 0x36373233, 0x25065d41, 0x07060706, 0x1a433635, 
-    0x15012206, 0x540f8314, 0x88080639, 0x02010e07, 0x36693036, 0x33366e2e, 0x61323462, 0x2d59a632, 0x7a2b582c, 0x8c9a9a4d, 0x24244d4e, 0x5c298b47, 
-    0x79666130, 0x694d5c5f, 0x433e42b1, 0x84442123, 0x25294e93, 0xc1444544, 0x080a091d, 0x1acc131c, 0x0d0d0e2a, 0x436c264b, 0x27254c86, 0x713c3da6, 
-    0x3d1f5936, 0x28140a0a, 0x10111fba, 0x92343736, 0x2866415b, 0x63272351, 0x64487e34, 0x3c3a3ba3, 0x02000000, 0x00006600, 0xd5056f04, 0x0d000a00, 
-    0x0cb67800, 0x061d6302, 0x58503533, 0x05061640, 0x01030202, 0x00020400, 0x01010062, 0x807c1839, 0x0016250d, 0x73040004, 0x0125228e, 0x1f401b4c, 
-    0x05284800, 0x64821d86, 0x25835520, 0x5a000222, 0x3f084b82, 0x594e0002, 0x0b0e4059, 0x0b0d0b0b, 0x1111110d, 0x08071012, 0x21012b19, 0x11330135, 
-    0x11231533, 0x01011923, 0x87fddf02, 0xc7ea5802, 0x29fec9c7, 0x03bf6401, 0xa433fcb2, 0x08029cfe, 0xebfc1503, 0x0126b382, 0xe3ff8f00, 0xb3822d04, 
-    0x95002f2b, 0x01200f40, 0x071b0502, 0x050c4202, 0x0c420320, 0x20a51808, 0x04042607, 0x03005903, 0x42bc8203, 0x2587130c, 0x85090c42, 0x050c422d, 
-    0x04000326, 0x61040305, 0x0943a518, 0x01000024, 0x47860057, 0x4f000122, 0x2a05b366, 0x1e1f2325, 0x14161c1d, 0x70000a0c, 0x052a0673, 0x2e272622, 
-    0x16352701, 0xfd411617, 0x012e2d07, 0x07062223, 0x1107010e, 0x11211521, 0x080c0342, 0x02010e58, 0x316f2d0d, 0x5d285633, 0xae5b5e5c, 0x2b325a59, 
-    0x255b842a, 0x4e25264f, 0xfdf40220, 0x292c2bc4, 0x3fb8792f, 0x45484344, 0x081dc745, 0x10180808, 0x191832cd, 0x57a05858, 0x3028297c, 0x1e090909, 
-    0xaaee0211, 0x081091fe, 0x453f4a07, 0xbe7671bb, 0x00454243, 0x83460200, 0x002d3008, 0x409c0043, 0x0201120e, 0x03011301, 0x82011d02, 0x062841d6, 
-    0x47001f21, 0xcf690642, 0x08965909, 0x8e460020, 0x503a2405, 0x471c4058, 0x412d1869, 0x401b4c02, 0x00010023, 0x02010302, 0x59268a63, 0x2f3413e1, 
-    0x3900012e, 0x2f432e37, 0x1a212343, 0x000b0d18, 0x082d012d, 0x24063d43, 0x34350226, 0xe07f1812, 0x2e27270c, 0x07222301, 0x7c181106, 0x06270bb0, 
-    0x27010e07, 0x18373632, 0x080b3074, 0x1614157d, 0x02011e17, 0x3bb68979, 0x48493b3f, 0x2989d348, 0x4728204d, 0x22461e20, 0xc3234c23, 0x55306362, 
-    0x643c622d, 0x3a3c3ca7, 0xad3c3c3d, 0x22654171, 0x66234444, 0x2266463e, 0x23272723, 0x611d6622, 0x1c01625b, 0x2601ceb7, 0x08646262, 0x0d180807, 
-    0x091e12ba, 0x9290090a, 0x3664e8fe, 0x4242191c, 0x7a76be42, 0x434242bd, 0x592d2c9e, 0x2e59adac, 0x2c2b312a, 0x81555581, 0x82312b2c, 0x008b2dfa, 
-    0x05370400, 0x000600d5, 0x0104b558, 0x25095146, 0x00000010, 0x3a435901, 0x02022205, 0xb683183a, 0x00102508, 0x73020002, 0x73491c88, 0x20128405, 
-    0x20308201, 0x21308255, 0x08825900, 0x4d003808, 0x12b55959, 0x08031011, 0x21012b17, 0x01152135, 0xfd560323, 0xfdac0335, 0x2b05d3ea, 0x81fa56aa, 
-    0x83000300, 0x4e04e3ff, 0x2b00f005, 0x51003b00, 0x22b69b00, 0x1805020a, 0x7108b774, 0x4120115d, 0x410a5d71, 0x1d2209de, 0x85710107, 0x10627106, 
-    0x23094548, 0x63030102, 0x0023278b, 0x82570400, 0x0424082e, 0x01065b00, 0x4f000400, 0x1b405959, 0x2c2d3c3d, 0x46480001, 0x513d513c, 0x3b2c3335, 
-    0x15173b2d, 0x2b012b00, 0x086d6518, 0x34350125, 0x18373637, 0x450c3448, 0x07220901, 0x5a541716, 0x03012605, 0x35363732, 0x05914634, 0x17141524, 
-    0x67181316, 0x2620082f, 0x41056e48, 0x2c0805f2, 0x3eb17467, 0x4f50433e, 0x24683d96, 0x3d3c2326, 0x6b6ba33b, 0x3d3c3ba4, 0x65232325, 0x4f4f9742, 
-    0xb43f3e43, 0x40417972, 0x797b403f, 0x08008240, 0x68427c3f, 0x27242525, 0x87864b23, 0x25272349, 0x1d6b2625, 0x9d36363b, 0x64659f69, 0x2d3e0f21, 
-    0x553f702f, 0x3533358d, 0x8d333335, 0x2c6c4458, 0x21113e2c, 0x699e6464, 0x3a37369f, 0x3f3f8103, 0x3a4a8278, 0x787a4040, 0x1dfd3f3f, 0x6b262626, 
-    0x236a4a44, 0x6b244b4c, 0x266d4446, 0x82002627, 0x00023400, 0x04e3ff7f, 0x00f00546, 0x0041002b, 0x100e409b, 0x46050401, 0x9c4407a9, 0x071f2207, 
-    0x09365f01, 0x005b0324, 0xaa460303, 0x891c2014, 0x079e4426, 0x85050521, 0x4c05242e, 0x4322401b, 0xc5510b6b, 0x44012005, 0x1734119f, 0x00012c2d, 
-    0x412c3739, 0x1f21412d, 0x0b0d1416, 0x2b012b00, 0x25077243, 0x3527012e, 0xa444011e, 0x0e112605, 0x23060701, 0x21c78222, 0x55193435, 0x122708a5, 
-    0x07021415, 0x4103010e, 0xc644087d, 0x06680805, 0x1e171415, 0x25100201, 0x4c20234d, 0x21452023, 0x63c14b48, 0x27461762, 0xa4647b53, 0x3f3b773b, 
-    0x896fae3c, 0x3a403bb6, 0xd64a4b45, 0x22664645, 0x23262623, 0x3e466622, 0x44442366, 0x071d6522, 0x0e180708, 0x091c13ba, 0x01919114, 0x194e3318, 
-    0x86424335, 0x44c176ef, 0x5b614142, 0xb4e2fe64, 0x65d6fec6, 0xb3026264, 0x28096543, 0xad592e2a, 0x2b2d59ad, 0x2be28200, 0x42ff6600, 0xd5053704, 
-    0x26000300, 0x2505a149, 0x0001000b, 0x1b827301, 0x4c003925, 0x8309401b, 0x00723a23, 0x59690101, 0x021011b4, 0x012b1608, 0x03230133, 0xeefcbe79, 
-    0xf9d505bf, 0x0827826d, 0x1b000220, 0x5a04f801, 0x0a007b06, 0x31000e00, 0x03042e40, 0x01000302, 0x0003010c, 0x010e4a02, 0xe1494703, 0x07de4916, 
-    0x33132c08, 0x37350711, 0x15331133, 0x17010721, 0xdfcd6801, 0xfdcc8ae5, 0x24044dd7, 0x03d9fb1b, 0x296302a6, 0x2bfd2774, 0x0601d46e, 0x82fafe6c, 
-    0x0003246f, 0x88f2fe1b, 0x0034246f, 0x894e4051, 0x0e202e71, 0x1f050402, 0x0f040601, 0x05060701, 0x087a874a, 0x05030025, 0x00620300, 0x06040005, 
-    0x00630405, 0x06070706, 0x06060055, 0x07005907, 0x344d0706, 0x26313233, 0x831a1c24, 0x08082391, 0x918d2b18, 0x37010924, 0x4243033e, 0x35072109, 
-    0x2d05d241, 0x15011e17, 0x0e070614, 0x21010f01, 0xb58d2115, 0xd8012208, 0x202d1fe7, 0x32280a18, 0x37345032, 0x3b433f39, 0x8b203c1e, 0x142a2c56, 
-    0x394c1711, 0xfd9a01d3, 0x08d88fc5, 0xe268fd22, 0x1e252e1e, 0x3c343d0f, 0x12122626, 0x0d1d7d24, 0x22420707, 0x37233258, 0x3857231b, 0x030072cd, 
-    0xe322f782, 0x67416504, 0x00382406, 0x8967406a, 0x0e2835f7, 0x27090802, 0x33080701, 0x13070601, 0x12060501, 0x07050401, 0x0920ff8a, 0x3408ff83, 
-    0x07080009, 0x00630809, 0x05060007, 0x00630607, 0x05040405, 0x05050057, 0x010a5b04, 0x4f040504, 0x2a2c0f10, 0x1d1f2325, 0x15171a1c, 0x3810380f, 
-    0x10141111, 0x1210410b, 0x0a304d19, 0x73732b20, 0x19222008, 0x20102e4d, 0x0d154106, 0x3ac3023f, 0x71453c71, 0xdb75662d, 0x615e4a42, 0x6e2d585f, 
-    0x3374453c, 0x2c517448, 0x635e5557, 0x0f1241bd, 0x15ebfc3f, 0x1a1b7914, 0x6c964550, 0x3e393c3f, 0x11791718, 0x51381f12, 0x135c4831, 0x7d516b15, 
-    0x060b4285, 0x04e32d08, 0x008c0665, 0x0022001e, 0x406f004c, 0x00010e6c, 0x02010d01, 0x02002000, 0x223c0203, 0x3b090802, 0x47080701, 0x27070601, 
-    0x26060501, 0x0822e782, 0xd84b004a, 0x03002608, 0x61030209, 0x1f184100, 0x4023243c, 0x3337393e, 0x2b2e3031, 0x244c2329, 0x2419114c, 0x18080b2a, 
-    0x3e37132b, 0xff763701, 0x35072106, 0x2d05f96a, 0x06071415, 0x1521010f, 0x17010721, 0x2a410109, 0x40200827, 0x144733e7, 0x43301a28, 0x427e6329, 
-    0x74473c77, 0x26252d52, 0x9a01d376, 0x0425c5fd, 0xd9fb1b24, 0x37213d41, 0x1f4e31e2, 0x331e333d, 0x7d481424, 0x3f231c1c, 0x3a3a3658, 0x72cd753c, 
-    0x41053943, 0x0420204d, 0x260c5743, 0x001c0019, 0x42124093, 0x22080961, 0x030e111b, 0x4a030506, 0x5005b04b, 0x002f4058, 0x72010001, 0x06030500, 
-    0x00680506, 0x73080408, 0x43000102, 0x0a270565, 0x04060209, 0x83550604, 0x04062b07, 0x0401075a, 0x1b4e0406, 0x31883040, 0x06050323, 0x2d32a270, 
-    0x1a124059, 0x1a1c1a1a, 0x1111111c, 0x8a421512, 0x431d2005, 0xed4a109b, 0x23152307, 0x3b440119, 0xfe142a0f, 0xa26b017d, 0xfe8a7474, 0x0f5b42ee, 
-    0x79b4fd2f, 0xe6fd1002, 0x2901ba6f, 0x63fe9d01, 0x87008200, 0x008c2cff, 0x0042003e, 0x0050004d, 0x4d1d40c5, 0x36200725, 0x2b06254d, 0x00020640, 
-    0x42454f01, 0x06070803, 0x34060a41, 0x0007003a, 0x68070808, 0x0a060a00, 0x00050073, 0x04050304, 0x091a4d63, 0x00010c2e, 0x63000107, 0x08020b0d, 
-    0x55080606, 0x082b0783, 0x01095a06, 0x4e060806, 0x833b401b, 0x0700233c, 0x3db27008, 0x23405936, 0x00014e4e, 0x504e504e, 0x4a4b4c4d, 0x46474849, 
-    0x2d2f4344, 0x26054e4d, 0x3e000b0d, 0x510e3e01, 0x272005a4, 0x22099d46, 0x4e3e3736, 0x4e4d05a0, 0x301c8208, 0x07062223, 0x3e350706, 0x33363701, 
-    0x15161732, 0x200d8214, 0x25078416, 0x0105010e, 0x534c0917, 0x15410808, 0x01011923, 0x38234f01, 0x1e36201d, 0x351d3e23, 0x1e512f33, 0x1a1d201a, 
-    0x4a426c38, 0x3031325c, 0x1a284418, 0x3c371c31, 0x3a1d4023, 0x54558e34, 0x5e552b2c, 0x305f3132, 0x0479fe88, 0xd9fb1b24, 0x0b934103, 0x06293908, 
-    0x0a0e0605, 0x07130e79, 0x1214150d, 0x37232638, 0x206c2612, 0x1f3a3b1f, 0x06060f10, 0x0879170c, 0x3b09050d, 0x2f47623b, 0x3615142e, 0x44795335, 
-    0x01c52122, 0xfafe6c06, 0x260fbe41, 0xfe1b0005, 0x455f04e2, 0x2e28061b, 0x46003a00, 0x66406900, 0x2909bd42, 0x0507010e, 0x09021727, 0x13460406, 
-    0x06073411, 0x0b630705, 0x09000601, 0x63090608, 0x0408010c, 0x82570804, 0x08250806, 0x010a5b04, 0x4f040804, 0x2f303b3c, 0x40420f10, 0x463c463b, 
-    0x3a2f3436, 0x1e203a30, 0x2e102e0f, 0x10141111, 0x131e450d, 0xfd182e20, 0x1e250cef, 0x06141502, 0x058e5607, 0x53320321, 0x132009d8, 0x29450b8a, 
-    0xfe27080e, 0x294e6f47, 0x59515e62, 0x41674827, 0x27486841, 0x625e5159, 0x47704e29, 0x4e4d4f4c, 0x4b4f4f4b, 0x545c5b55, 0x425d5a55, 0x33080fd6, 
-    0x3d21eafc, 0x6f5b3859, 0x48641213, 0x1e395031, 0x3150391e, 0x13126448, 0x59395a6f, 0xf501213d, 0x47454347, 0x47434547, 0x4e5563fe, 0x4e54544e, 
-    0x0000554e, 0x08073b41, 0x29008c2e, 0x4d002d00, 0x65005900, 0x88408b00, 0x05040119, 0x04030118, 0x03020124, 0x02010104, 0x0002032b, 0x09012d01, 
-    0x02364607, 0x4a07080b, 0x3718e942, 0x09000700, 0x63090708, 0x0008010e, 0x0b080a0b, 0x0a010f63, 0x570a0606, 0x31080682, 0x0d5b060a, 0x060a0601, 
-    0x4f5a5b4f, 0x012e2f4e, 0x5a5f6100, 0x55655b65, 0x4f594e53, 0x2e3d3f59, 0x1d4d2f4d, 0x1014161b, 0x080b0d0e, 0x01290006, 0x4a181029, 0x012408a9, 
-    0x35363233, 0x4105987d, 0x6f450641, 0x055c4109, 0x01050626, 0x22010917, 0x21317b41, 0x97462b01, 0x3efe271d, 0xfb1b2404, 0x944102d9, 0x46292028, 
-    0xc2421db7, 0x33aa4105, 0x0808ab41, 0x1e007b28, 0x42002200, 0x5a004e00, 0x81408400, 0x05020113, 0x0102030e, 0x02022002, 0x01220100, 0x2b3b0709, 
-    0x05080b02, 0x764f004a, 0x068e4410, 0x0823a441, 0x444f5027, 0x01232443, 0x4f545600, 0x4a5a505a, 0x444e4348, 0x2332344e, 0x16422442, 0x10111214, 
-    0x070b0d0f, 0x011e0005, 0x05a4411e, 0x1e352722, 0x2805a341, 0x07222326, 0x21152111, 0x08985915, 0x3a389841, 0x34609431, 0x6f693c78, 0x5a646774, 
-    0x9dfed601, 0x73483a32, 0x552e2c51, 0x419efe7b, 0x24352f92, 0x621d1a72, 0x29635a5b, 0xcc5fa201, 0x69492811, 0x4a694242, 0x3a8a4127, 0x080a8b41, 
-    0x0a00062f, 0x36002a00, 0x68004200, 0x01046540, 0x01080100, 0x010a0002, 0x13230406, 0x04050802, 0x0002004a, 0x04020004, 0x00010070, 0x00010200, 
-    0x340d8261, 0x06040506, 0x05010a63, 0x05070800, 0x010b6308, 0x07030307, 0x08068257, 0x5b030724, 0x07030109, 0x37384f03, 0x0b0c2b2c, 0x42373c3e, 
-    0x30324238, 0x362c362b, 0x2a0b1a1c, 0x11122a0c, 0xc34e0c10, 0x05624809, 0x2832f242, 0x0244fef7, 0x83b4fe48, 0x2d474199, 0x5f1c0625, 0x48edfc30, 
-    0x6b440650, 0x01012e32, 0x03600458, 0x00a30793, 0x4029000a, 0x059f4526, 0x92450120, 0x03032108, 0x4c0c0356, 0x01200721, 0x2109214c, 0x1e4c6a01, 
-    0xce042106, 0x2007184c, 0x22008200, 0x82420101, 0x077d2d57, 0x002500b4, 0x112d4030, 0x10010001, 0x5508ff55, 0x112717c6, 0x042b281b, 0x4b2b1808, 
-    0x012123df, 0x20d14b42, 0x4bce0421, 0x00301fc1, 0x46010100, 0x9c035504, 0x3e00b807, 0x4a404d00, 0x550f5d48, 0x59450583, 0x0e8b4e11, 0x47000121, 
-    0x07200de5, 0x2141e547, 0xd3473202, 0x55042132, 0x0832c047, 0x00010060, 0x04a30180, 0x008c054c, 0x401a000e, 0x0c0d0e17, 0x08090a0b, 0x02030407, 
-    0x47000c01, 0x69000000, 0x15080115, 0x25011b2b, 0x33130537, 0x05172513, 0x01090713, 0x94fef2fa, 0x14780124, 0x7801146c, 0xf294fe24, 0xfef2fe5e, 
-    0x01e601f2, 0x7b679e73, 0x57fea901, 0xfe9e677b, 0x6501438d, 0x41829bfe, 0xd74e6382, 0x33132830, 0xbf662301, 0x4ebe1203, 0x002f06d6, 0x02e90101, 
-    0x03e5022f, 0x000c0060, 0x821c401f, 0x01002153, 0x3b05b154, 0x01000102, 0x00014f00, 0x0c000407, 0x08030a01, 0x22012b14, 0x3b34013d, 0x011d3201, 
-    0x02240b82, 0xc01e1e07, 0x02240282, 0x1ef51e2f, 0x90820282, 0x3f01012a, 0x9103d101, 0x17002104, 0x0d254b96, 0x0117000b, 0x184b8517, 0x4e0d4a74, 
-    0x6c080767, 0x6b3d6602, 0x2c2b2a2a, 0x406c2729, 0x262a6b3f, 0x2c2c2b30, 0x2cd1016c, 0x3c6b2b2a, 0x27296b3f, 0x26292c2e, 0x6a3c426b, 0x002b2b2c, 
-    0x00ca0102, 0x040e033c, 0x000f005a, 0x4b4f001f, 0x58503eb0, 0x03001440, 0x03020105, 0x01045f02, 0x5b010000, 0x3c010100, 0x401b4c00, 0x0401001a, 
-    0x01030001, 0x03006300, 0x57030202, 0x02030300, 0x3428845b, 0x1340594f, 0x00011011, 0x1f101719, 0x07091f11, 0x0f010f00, 0x23ed8406, 0x34352627, 
-    0x21092b4a, 0x0f8d2203, 0x446c0223, 0x2000822f, 0x25059044, 0x2f2f0803, 0x1a824b4b, 0xfd210584, 0x310d8b34, 0x90010100, 0x1e037dfe, 0x18005d01, 
-    0x0a403900, 0x11820102, 0x01184a27, 0xb04b4700, 0x20bd8217, 0x250e820b, 0x00005b00, 0xb4833a00, 0x8e411020, 0x2ecc820a, 0xb4594f00, 0x08022429, 
-    0x36012b16, 0x51010e37, 0x17200c7b, 0x0805cf4a, 0xf4900151, 0x09130c08, 0x2c163820, 0x3c141816, 0x2e2f5524, 0xfea85c5c, 0x02e16de5, 0x27141302, 
-    0x153b2147, 0x43441711, 0x7b7cab79, 0x0003003e, 0x04000050, 0x0031017f, 0x0017000b, 0x4b540023, 0x585035b0, 0x03051240, 0x00010102, 0x0704085b, 
-    0x86050602, 0x8319208a, 0x20838214, 0x201c8d57, 0x3e938201, 0x18191b40, 0x00010c0d, 0x23181c1f, 0x10132219, 0x160d170c, 0x0b000407, 0x08090a01, 
-    0x42332b14, 0x23200934, 0x6e260b97, 0x1ec01e1e, 0x0584d91e, 0x0584da20, 0x8b055342, 0x00003305, 0xc6010200, 0x0a03c4ff, 0x0500da05, 0x6e001600, 
-    0x118203b6, 0x4a010025, 0x8221b04b, 0x551620b5, 0x002c0604, 0x03004b39, 0x045b0203, 0x42020201, 0x22084055, 0x82030013, 0x02032210, 0x2425885f, 
-    0x401b4c01, 0x24548219, 0x01000301, 0x0a134261, 0x4f392684, 0x0d405959, 0x0d0f0607, 0x16071606, 0x08051112, 0x11012b16, 0x23031121, 0x0c044213, 
-    0x07063508, 0x01e10106, 0x3a794309, 0x2e2e2e46, 0x2f45452f, 0x2f17172e, 0xbd011d04, 0xc9fd43fe, 0x2f30defd, 0x2f2f4d4e, 0x2a4e2e2f, 0x0030173c, 
-    0xf4000400, 0x2204c4ff, 0x0b2ebf84, 0x2d001c00, 0x09408b00, 0x00030609, 0xc6880104, 0x01031b29, 0x59000101, 0x82000102, 0x01072dc8, 0x5b040505, 
-    0x03080609, 0x04420404, 0x20075d5c, 0x84168218, 0x04052213, 0x832d8a5f, 0x821f20d0, 0x20128237, 0x82d28205, 0x04042324, 0x428a5705, 0x83040521, 
-    0x1e1737d6, 0x260c0d1d, 0x1e2d1d24, 0x0c13152d, 0x121c0d1c, 0x0a111212, 0xe0861808, 0x0120e685, 0x2120e68f, 0x0121108f, 0x21f7830f, 0x05839d01, 
-    0x8b50fe21, 0xa50121fe, 0x21130c41, 0x14413702, 0x0e214114, 0x02000038, 0xc4ffd001, 0xda051403, 0x16001000, 0x15b65800, 0x03020212, 0xb5534a01, 
-    0x05143205, 0x02000301, 0x005d0203, 0x5b000101, 0x00000104, 0x20f58339, 0x8209831b, 0x63012119, 0x02231f82, 0x82550302, 0x02032306, 0x29820059, 
-    0x594d2108, 0x11111340, 0x16110001, 0x13141611, 0x1000080a, 0x08061001, 0x32012b14, 0x15011e17, 0x23060714, 0x1b20d886, 0x1326f883, 0x2f457202, 
-    0xc9411717, 0x2e2e3f05, 0xf7fe4385, 0x30da054d, 0x4e2a3c17, 0x2f2f2f2e, 0x302f4e4d, 0xc9fddefd, 0xbd0143fe, 0xab823702, 0x02003b08, 0xcd040000, 
-    0x1b00be05, 0xb1001f00, 0x502cb04b, 0x07264058, 0x0e030205, 0x01020208, 0x10620203, 0x0103090f, 0x00020a0c, 0x6100010b, 0x04040106, 0x010d4b39, 
-    0x0b3a0b0b, 0x6b431b4c, 0x82262005, 0x04032214, 0x87339872, 0x3040212d, 0x0f822885, 0x730b0022, 0x00232e90, 0x84550100, 0x0001226b, 0x306e8359, 
-    0x594d0001, 0x1c1e4059, 0x1c1f1c1c, 0x1b1d1e1f, 0x0765661a, 0x00861120, 0x08111029, 0x21012b1d, 0x83132135, 0x03332303, 0x03821333, 0x03211523, 
-    0x25038233, 0x03231323, 0x04820123, 0x04012d08, 0x2901fefe, 0x01f6fe54, 0x68a0682f, 0x69a069f5, 0x54e7fef4, 0x68dffefa, 0x69f669a0, 0x5325029f, 
-    0x9e0154f5, 0x9a4e0199, 0x61fe9f01, 0x9a2f0383, 0xfe99b2fe, 0xfe9e0162, 0x01370262, 0x82b2fe4e, 0xc3012b97, 0x0703e5ff, 0x0f003701, 0xf3853600, 
-    0x01000c2f, 0x025b0001, 0x42000001, 0x401b4c00, 0x10734611, 0x0b405924, 0x88450001, 0x08032405, 0x42052b14, 0x07230c7b, 0x45650206, 0x1b200a72, 
-    0x2c0c5d45, 0x00020000, 0x04d8fff4, 0x00f80510, 0x2c5e822e, 0x170a408e, 0x16010001, 0x02000201, 0x207d854a, 0x08a74a1e, 0x2409295f, 0x5b030404, 
-    0x57891905, 0x503a2408, 0x881b4058, 0x82042025, 0x03042218, 0x0c335f5f, 0x1d882120, 0x2705eb4a, 0x03040063, 0x00570403, 0x04334786, 0x59594f03, 
-    0x2f301140, 0x422f393b, 0x2d2e4230, 0x42121c1e, 0x34250575, 0x3f013e37, 0x054d5301, 0x2e272622, 0x20050961, 0x0d405f07, 0x0f06072b, 0x06070601, 
-    0x1323011d, 0x57228222, 0x78080a5c, 0x06071415, 0x111eee01, 0x1d5a2b37, 0x24180b2d, 0x3557211d, 0x5d2d5752, 0x2d613031, 0x6434612e, 0x37363397, 
-    0x585b2422, 0xbe131246, 0x162a3e63, 0x11151515, 0x34202235, 0x2b2a2a14, 0x444e4702, 0x592b4824, 0x2b15351d, 0x19472f33, 0x11221b1c, 0x1dbc2234, 
-    0x0e0e0d2b, 0x83302d33, 0x4341504b, 0x2844565a, 0xfe7f2b28, 0x39162a00, 0x15382020, 0x14161911, 0x2a44432a, 0x3cfc822b, 0xff220004, 0x05b104d8, 
-    0x002800f1, 0x00650051, 0x40ab0079, 0x0210390c, 0x0f380100, 0x095d4102, 0x05242308, 0x07000201, 0x70070200, 0x00000103, 0x01045b01, 0x4b410101, 
-    0x07070109, 0x080b5b06, 0x0606030a, 0xc7440642, 0x88212007, 0x841f822b, 0x0607221c, 0x24368a5f, 0x401b4c00, 0x82238828, 0x231b8249, 0x63000102, 
-    0x06232d82, 0x8a570706, 0x07270854, 0x59594f06, 0x66671940, 0x70725253, 0x79677966, 0x65525c5e, 0x471f6553, 0x2b471f2c, 0x2b1a080c, 0x023e3413, 
-    0x653e013f, 0x0727063d, 0x33033e35, 0x5017013a, 0x0f2705ac, 0x1d030e01, 0xa1252301, 0x41012022, 0x2120128f, 0x22081392, 0x241609a8, 0x1f273b1b, 
-    0x5e354253, 0x413e203d, 0x0c022a48, 0x09888008, 0x391f2818, 0x050f1b17, 0x9f6002c2, 0x05fe2121, 0x200fbf41, 0x08108f28, 0x51322b23, 0x5929474a, 
-    0x522c573b, 0xd9413a50, 0x0d1b2c1e, 0xa3b00b01, 0x4e464526, 0x3323562f, 0xaa1e302f, 0x2122a19a, 0xec4147fe, 0x3b0f8f0f, 0x00020000, 0x03e5ffc1, 
-    0x001406dd, 0x00480013, 0x420a408f, 0x43030401, 0x02040201, 0x22067b47, 0x4301051c, 0x3b21064c, 0x0560754b, 0x02040424, 0x8147065c, 0x50352c08, 
-    0x001f4058, 0x00040003, 0x8b700403, 0x21268b2b, 0x21871c40, 0x82040021, 0x0204223a, 0x37298960, 0x59594c00, 0x14151540, 0x3c3e0001, 0x48142a2b, 
-    0x0a0c4815, 0x13011300, 0x4305134c, 0x03201125, 0x43099541, 0x3d26056e, 0x3d013e01, 0xb5563301, 0x010e2405, 0x5e010e07, 0x33260503, 0x36373632, 
-    0x11841537, 0x41900221, 0x2b080e62, 0x366ebc72, 0x11111139, 0x1e58313d, 0x01130b2d, 0x1e1ebe01, 0x34145a55, 0x240a0d0e, 0x3359211d, 0x5b2d522a, 
-    0x2b603260, 0xe4046530, 0x080f3541, 0x5f01fb42, 0x2a4f822f, 0x4c212145, 0x341d5630, 0x05402919, 0x7b0a150b, 0x4443639a, 0x38145953, 0x1435181b, 
-    0x1c18492b, 0x2311121b, 0x2a1ebc43, 0x000e0e0d, 0x52010200, 0x7f03aa03, 0x0300d505, 0x34000700, 0x2005f346, 0x0ee2470d, 0x01021325, 0x4e010100, 
-    0x01210541, 0x241c8259, 0x594d0100, 0x28a582b6, 0x18080410, 0x1133012b, 0x36038423, 0x01aeae52, 0x05aeae7f, 0x02d5fdd5, 0x00d5fd2b, 0x03100201, 
-    0x84be02aa, 0x5b2d205b, 0x01230803, 0x47005900, 0x10210644, 0x82568400, 0x5901220e, 0x20628200, 0x090a5b4d, 0x02231123, 0x834a8510, 0xfe8a38a3, 
-    0x042c032a, 0x000f0022, 0x40210128, 0x0201120a, 0x284a0103, 0x57470201, 0x14200533, 0x230a684b, 0x005b0203, 0x2307c65e, 0x40585007, 0xa1491b91, 
-    0x940c2005, 0x05fe5e1b, 0x1b941120, 0x15203785, 0x37851b94, 0x1b941d20, 0x1e203785, 0x37851b94, 0x1b943520, 0x40213783, 0x13434c19, 0x03020025, 
-    0x86594f02, 0x0f402700, 0x1f210001, 0xbc461416, 0x4c052005, 0x01211245, 0x16b94b24, 0x62024708, 0x32323048, 0x30494830, 0xfe303131, 0x090001df, 
-    0x2109140d, 0x172e173c, 0x263f1519, 0x61303259, 0xbf02b061, 0x4e503032, 0x31313132, 0x3230504f, 0xed72d8fb, 0x14150203, 0x3d23492b, 0x47171316, 
-    0x82b47e47, 0xef5c4082, 0x00012e46, 0x04cafe5e, 0x0042ff72, 0x40180003, 0x0f1c4215, 0x2a05255d, 0x21152117, 0xfb14045e, 0x8278beec, 0x02002976, 
-    0x1dfe0000, 0x5dffd104, 0x07253382, 0x1a401d00, 0x25368200, 0x61010002, 0x8a660200, 0x03402205, 0x07a8424c, 0x3a821520, 0x04230383, 0x832ffbd1, 
-    0x50a32303, 0x438450a0, 0xfe1d0127, 0x06b3031d, 0x2e43841d, 0x02144017, 0x3b000001, 0x0101034b, 0x88014001, 0x08e6423d, 0xacac1d2d, 0xacacea01, 
-    0x00f81d06, 0x82f80008, 0x01012840, 0x0381013f, 0x827104e1, 0xb306218d, 0x302f7c82, 0x0102092b, 0xfda2023f, 0xfe71045e, 0x8288fe88, 0x48032023, 
-    0xf0300623, 0x28001c00, 0x73003c00, 0x27280a40, 0x05000607, 0x2905864b, 0x40585035, 0x01010016, 0x2b825b00, 0x4d4c4120, 0x4c258420, 0x0e33204d, 
-    0x3335292a, 0x3c2a3c29, 0x05291b1c, 0x012b1508, 0x8207010e, 0x084d5b02, 0x46020e21, 0x13280687, 0x3435033e, 0x1127022e, 0x210ac344, 0xa7583233, 
-    0x06230805, 0x2013ee01, 0x315f2b0c, 0x5f61c05f, 0x0f396b99, 0x58303e24, 0x07162a24, 0x2a1cebbe, 0x2d1d0d1a, 0x445b1937, 0x2a080ec3, 0x0a053e05, 
-    0x22341105, 0x32373abc, 0x2550825c, 0x2e4e4744, 0x2e342356, 0x02aa1e30, 0x2d2f1c30, 0x422d1c2f, 0xfe071b2d, 0x4444fc52, 0x00310fc2, 0x05000001, 
-    0x06d104bb, 0x0003000b, 0x00104013, 0x052e4401, 0x4c013b22, 0x0805fe41, 0x15211121, 0xfbd10421, 0x500b062f, 0xbcff0100, 0x14051bfe, 0x0f0085ff, 
-    0x1e402100, 0x03040c0d, 0x49480104, 0x402a08e9, 0x00014c00, 0x0f00080a, 0xfd4f0f01, 0x242e0805, 0x17163527, 0x3233011e, 0x06153724, 0xa8660204, 
-    0xadb2b0fe, 0x5aa555a8, 0xad5101b1, 0xfeadfeb1, 0x7e78741b, 0x1a1a326a, 0x767e6967, 0x48820076, 0xf2fecf3b, 0x14067703, 0x26000b00, 0x02002340, 
-    0x02040300, 0x04006103, 0x05040500, 0x209a8b5d, 0x2a008211, 0x1a080610, 0x1521012b, 0x84331123, 0x01212503, 0xf0a801cf, 0xfe2a0082, 0x8f140658, 
-    0xfd8f45fd, 0x53838f46, 0x53825a20, 0x538a0220, 0x02000129, 0x00006101, 0x82000500, 0x03032953, 0x04005904, 0x4c033b04, 0x11215182, 0x24538411, 
-    0x23113305, 0x24038335, 0x01211121, 0x2e50825a, 0xfea801f0, 0xba027f58, 0x8fbb028f, 0x8200def8, 0xff22308f, 0x052404d8, 0x002800f1, 0x0042002e, 
-    0x4f080156, 0x0c2e05d9, 0x01000110, 0x030f292c, 0x4a020004, 0x0e83401b, 0x0e870320, 0x22855920, 0x02002d28, 0x02040604, 0x81827006, 0x2105447e, 
-    0x80824b41, 0x082d0a87, 0x05060601, 0x09070a5b, 0x42050503, 0x07414c05, 0x348c2b20, 0x01010022, 0x03263384, 0x03030059, 0x32914b39, 0x58503a24, 
-    0x32872840, 0x4e841e82, 0x4a050621, 0x718309df, 0x04233d85, 0x89401b4c, 0x82012092, 0x00012adb, 0x00030063, 0x04030204, 0x233a8261, 0x57060505, 
-    0x0631608a, 0x59594f05, 0x44184059, 0x4f2f3043, 0x4456434d, 0x05fe4a56, 0x1f121227, 0x080b2b47, 0x23844919, 0x21087d4e, 0xf74a012e, 0x3567490e, 
-    0x09016526, 0xb7fd7943, 0x210e1343, 0x108f4602, 0x21224b49, 0xc04e8c02, 0x43f22006, 0x0f8f0f27, 0x00040023, 0x082b4ba5, 0x20050342, 0x051b474b, 
-    0x01100a29, 0x010f0300, 0x18020004, 0x82088d7d, 0x86012011, 0x8a402011, 0x5959211e, 0xdd413185, 0x5013222e, 0x0ab24158, 0x42000021, 0x4642b745, 
-    0x4b01201b, 0x112122a8, 0x05ab5133, 0x21244642, 0x8d4b0803, 0xc8fd251f, 0x53a115cb, 0x210e3442, 0x108efd01, 0x45420220, 0xb5012922, 0x71fd8f02, 
-    0xf7fd9bfe, 0x8f0f3542, 0x0000340f, 0xcb000100, 0x67043bff, 0x1100d505, 0x0bb54200, 0x51020101, 0x11200708, 0x0d059e18, 0x4c023925, 0x1816401b, 
-    0x310f1857, 0x00020059, 0xb6594d02, 0x201a1111, 0x2b180804, 0xbb702113, 0x11072206, 0x08018323, 0xc001cb39, 0x447db06b, 0x6aa8743d, 0x058dbf8d, 
-    0x9d6f3cd5, 0x6b945b61, 0xb2fc0841, 0xe1f91f06, 0x00030000, 0x0370fec1, 0x007804dd, 0x00300013, 0x407b003c, 0x2e313c0a, 0x5105272d, 0x27240591, 
-    0x17405850, 0x20086555, 0x05284744, 0x02010524, 0x8e823e02, 0x20178c55, 0x128c5544, 0x8c555520, 0x40592c0b, 0x01141513, 0x14252600, 0x4b301530, 
-    0x062005e5, 0x41054749, 0xd71810cc, 0x3f2a0712, 0x3d033e01, 0x3e113301, 0x02823701, 0x010e152d, 0x030e0703, 0x021e1415, 0x41880217, 0x67200ea3, 
-    0x470d3647, 0x992b074d, 0x1a291d2d, 0x362d1d0d, 0x4148031a, 0xfb210f88, 0x06384728, 0x562f4d2a, 0x302e3522, 0x53fcaa1e, 0x24085347, 0x1d2d5c02, 
-    0x0744472e, 0x00820020, 0x00022308, 0x04860058, 0x00120379, 0x0022001e, 0x003c403f, 0x0d000101, 0x02030201, 0x02011e4a, 0x010c4901, 0x26824800, 
-    0x0002032e, 0x01006303, 0x01040200, 0x04006302, 0x0877be18, 0x0405003b, 0x13114d05, 0x22242529, 0x2b1a0806, 0x33013e13, 0x011f1632, 0x36323316, 
-    0x08d88237, 0x2e22235f, 0x2e012f02, 0x06222303, 0x11330507, 0x924e5823, 0x44723051, 0x455f7320, 0x90454b88, 0x30301b52, 0x22211e34, 0x1f363438, 
-    0x014e8e4d, 0x02fcfc92, 0x16373c9f, 0x3c360f20, 0x3b37af3f, 0x0d130d06, 0x0f150e0e, 0x3a443708, 0x0200cffe, 0xd8ffda00, 0xf005f703, 0x3c002800, 
-    0x0a408e00, 0x20ab8214, 0x51a58215, 0x7d180a2b, 0x0d4908c7, 0x06e35007, 0x70420321, 0x1b2208ed, 0x25860200, 0x49072b51, 0x0124073b, 0x21401b4c, 
-    0x00251d88, 0x00020100, 0x152b5101, 0x23071d49, 0x17192728, 0x23072b51, 0x012e2726, 0x3535ec83, 0x33023e34, 0x15171632, 0x2223012e, 0x1415020e, 
-    0x1e011f16, 0x161f5103, 0x3e022208, 0x29070606, 0x3e2c582e, 0x6c3a1127, 0xc2645e98, 0x52b3615b, 0x223f5635, 0x2d5a3735, 0xbf0c2138, 0x0e12425f, 
-    0x0c022408, 0x16153c34, 0x2b562d3a, 0x2949474a, 0x335c814e, 0x43bc3839, 0x4a341d46, 0x3657362d, 0x47462c59, 0x4f9a354f, 0x00201126, 0x20adab54, 
-    0x05c34f03, 0x43fe0521, 0x9b2006cb, 0x200dcb43, 0x0ccb4321, 0x004b4127, 0x4b3c0303, 0x0cc04f05, 0x8409ea43, 0x5b02211e, 0x3a201e89, 0x20147759, 
-    0x20ea4341, 0x204deb43, 0x0ed84185, 0xeb436420, 0xce04211f, 0x2010eb43, 0x2deb4317, 0xe5ffc133, 0xfe05dd03, 0x41001300, 0x0a40ba00, 0x0304013e, 
-    0x1417513f, 0x17514120, 0x512b822a, 0x3a200d3e, 0x24064f6f, 0x04030004, 0x101c5170, 0x4c004122, 0x8505db6b, 0x0501221e, 0x05e65a01, 0x02020425, 
-    0x86005704, 0x02042349, 0x42515950, 0x3a3c2707, 0x4114292a, 0x42514115, 0x05877a1f, 0x51055c45, 0xa54c063d, 0x79152005, 0x37250565, 0x02010e15, 
-    0x0e744186, 0x74416520, 0x2a213808, 0x01010816, 0x38220fbe, 0x291d5a28, 0x3f220c1b, 0xb0523657, 0x41c05f62, 0x21241d76, 0x21322e31, 0x34052b51, 
-    0x46495234, 0x2f1d5928, 0x2d1b2e2d, 0x451d344b, 0x373abc44, 0x2a008200, 0xffd80101, 0x03fa0269, 0x4e0d0066, 0x1526139b, 0x16080216, 0x2e46052b, 
-    0x06332905, 0x17161411, 0x5e940223, 0x66320082, 0x665553a8, 0x7efb8697, 0xfe85fb7e, 0xfc8100ff, 0x4b850082, 0x4b82f920, 0x4b930c20, 0x84141621, 
-    0x3512244b, 0x5c332734, 0x233605a2, 0xa7a7d801, 0x5c5c6065, 0x01976560, 0xfffefe02, 0x7f7efb85, 0x978485fb, 0xff7f0033, 0x06cc0303, 0x002e0065, 
-    0x223a403d, 0x01020101, 0x06304b4a, 0x0200632a, 0x02050100, 0x05006301, 0x0e502319, 0x2c00012f, 0x1617192a, 0x0a0b0d14, 0x012e0008, 0x051c742d, 
-    0x3d26272d, 0x26273401, 0x3335012b, 0x82363732, 0x3637320b, 0x2315013b, 0x1d060722, 0x0e071401, 0x17160701, 0x21098216, 0x15831617, 0x8c033f08, 
-    0x355555f8, 0x74748c36, 0x5535358d, 0x4640fa53, 0x2d2b2a8c, 0x6f384e16, 0x2a2b2d2d, 0xfd40468c, 0xefde494a, 0x8f3a3b96, 0xf0953a39, 0x8f4949de, 
-    0xf88f2b2b, 0x3122469e, 0x47471b0d, 0x0e82f89c, 0xc0829020, 0x05010132, 0x5804fafe, 0x31005c06, 0x34403700, 0x0304010a, 0x250bb37c, 0x03000400, 
-    0xbd826304, 0x57000522, 0x05212d82, 0x31ca825b, 0x2f314f05, 0x21232426, 0x13151618, 0x15080620, 0xae88052b, 0x27263724, 0xc489012e, 0x1623ae84, 
-    0x84011e17, 0x820620c6, 0x22be82c2, 0x822b0607, 0x44480874, 0x2d2b2c8c, 0x2d6e6f2d, 0x2c2b1816, 0xfa3e448c, 0x2a2a5453, 0x40457328, 0x27724740, 
-    0x55542a2a, 0x2c763ef8, 0x9cf88e2b, 0x1a1b4747, 0x556d2246, 0x2c2b8ef8, 0xdd4a498f, 0x1e634ef0, 0x1d8f1c1d, 0x4e641f1d, 0x4a49deef, 0xa72cc384, 
-    0x4f03f2fe, 0x07006406, 0x1f402200, 0x24098150, 0x55020303, 0x05875000, 0x4d030222, 0x4e082f53, 0x212e0523, 0xa801a701, 0x58fef0f0, 0xf98f6406, 
-    0x47848fac, 0x47828220, 0x63062a22, 0x02214786, 0x061b4e00, 0x00030323, 0x241f8255, 0x03005903, 0x20478900, 0x07134e05, 0x4ef08221, 0x06230511, 
-    0x85f88f53, 0x82cf2047, 0x01772647, 0x000500cc, 0x05d34b3e, 0x00001626, 0x66000101, 0x0936a318, 0x02005a25, 0x184e0201, 0x2018f86f, 0xf28918b5, 
-    0x15332509, 0xb8cf0121, 0x0123a782, 0x83b5fdcc, 0x2049825e, 0x205f825a, 0x205f8d02, 0x21618201, 0xed820066, 0x0220aa84, 0x00205f82, 0x01235f85, 
-    0x8f720100, 0x87592017, 0x2dc3825f, 0x01211133, 0xfeb8f05a, 0x4b027f58, 0xe68226fd, 0xcf265f82, 0x77033a03, 0xbf821406, 0xbf853420, 0xae821120, 
-    0x67020122, 0x210a734f, 0x1e19401b, 0x3b220d87, 0x55884c01, 0x15210131, 0x01231123, 0xf0a801cf, 0x8f1406b8, 0x8200b5fd, 0x825a2038, 0x8e022053, 
-    0x20978253, 0x067d5467, 0x5e3b0121, 0xf47205fd, 0x8912820b, 0x35232d53, 0x02231121, 0xa801f04a, 0x8f8505b8, 0x012aa983, 0xf2fe2801, 0x1206f302, 
-    0xab501800, 0x01002205, 0x824d8273, 0x1a1c3135, 0x2b160802, 0x27012e01, 0x37343526, 0x3337013e, 0x080aff55, 0x0223172f, 0x256e4e53, 0x6e264a4a, 
-    0x5f47a04d, 0x21202220, 0x45602121, 0x7cf2fea0, 0xdee371e3, 0xe373e4dd, 0x70dd7978, 0x7673e076, 0xde7373df, 0x28bb8278, 0x03f2fede, 0x001206a9, 
-    0x21678e15, 0x67841b18, 0x62823620, 0x26343523, 0x206f8227, 0x06b55133, 0x01230733, 0x1f4384de, 0x1f202122, 0x99a04563, 0x4a4a4a48, 0x33618297, 
-    0xe66be4e7, 0x70e77075, 0xed77e66b, 0xdfdde4e1, 0x00ebe3e4, 0xd82d5f82, 0xfa020502, 0x0d000206, 0xb04b2d00, 0x07136039, 0xcc835920, 0x1b4c0123, 
-    0x12a75540, 0x8205f044, 0x343523e1, 0xf0443736, 0x05022111, 0x870cf144, 0x82f92063, 0xa80c2063, 0x05084563, 0x08450120, 0x05022115, 0x2e0c0945, 
-    0xfff00001, 0x05e1039b, 0x001a0082, 0x7528402b, 0x2c080aea, 0x00570300, 0x5b000303, 0x03000104, 0x00014f00, 0x0d0e1819, 0x1a000b0c, 0x08051a01, 
-    0x22052b14, 0x02262724, 0x37123435, 0x15332436, 0x98bb1822, 0x33310809, 0x98e10315, 0x6b70f4fe, 0x706c7172, 0x5a950f01, 0x414444a0, 0xa1434341, 
-    0x7070655b, 0x9e09016b, 0x6c0c019d, 0x67277070, 0x93fc6b6b, 0x6a6afc94, 0x05bb426a, 0x252d8788, 0x19401c00, 0x01000110, 0x01254a01, 0x05ab7100, 
-    0x0000002c, 0x10111269, 0x2b150802, 0xb5413217, 0x022e2b05, 0x27012e27, 0x32352726, 0x897c1704, 0x03490807, 0xf0070607, 0x4343a15b, 0x32211241, 
-    0x326e2a1f, 0x01983b3a, 0x53396d0f, 0x391f1a37, 0x52233352, 0x61295958, 0x6a693e64, 0x4a8cfd6a, 0x2c748691, 0x1d19503b, 0x6d732612, 0x8b857f39, 
-    0x8c994e46, 0x341e2d79, 0x200d232b, 0x287d8213, 0x0387ff67, 0x0051056a, 0x146b460e, 0x4105b746, 0x26080501, 0x15020621, 0x21171214, 0x79795902, 
-    0x11017b77, 0x6d696a6c, 0xc079effe, 0xb6b76f01, 0xbbc06e01, 0xbdbb93fe, 0x82bb91fe, 0x826e2053, 0x05632253, 0x26539c24, 0x34351236, 0x7d212702, 
-    0x213f0589, 0x67696e01, 0x09016a66, 0x76767478, 0xb579f7fe, 0xb7b76401, 0xbbb66001, 0xb3b09ffe, 0x82ba9cfe, 0xff443253, 0x058d037e, 0x00050055, 
-    0x031b401e, 0x01000101, 0x0f01564a, 0x0211123d, 0x092b1608, 0x01093301, 0x01440123, 0x8afed574, 0x02d57601, 0xfdec0269, 0xb115fd14, 0xb9022843, 
-    0x01d48cfe, 0x8a8cfe74, 0xd3002743, 0xfe0357ff, 0x87a12e05, 0x21011332, 0xd3210109, 0x4a01e101, 0xea0116fe, 0x4202b6fe, 0x00208886, 0x47a9b882, 
-    0x02824482, 0x82bd0221, 0x014a2444, 0x8c1ffee1, 0x00012848, 0x0442ffce, 0x82d10503, 0xb52d218f, 0x59051641, 0x6f44084a, 0x104e7405, 0x85052641, 
-    0x01ce339e, 0xfe9301a2, 0xfea4015c, 0x0389026d, 0xfcb8fc48, 0x538700b9, 0x53b0d220, 0x7128aa86, 0x92015efe, 0x5efea201, 0x8a205482, 0xb8205484, 
-    0x2c08f282, 0xc9010100, 0x0803e6fe, 0x07007605, 0x07b30600, 0x2b300102, 0x17371105, 0x07171107, 0x57e8c901, 0x3357c4c4, 0x57e7c204, 0xc3a4fbc3, 
-    0x202f8757, 0x202f82ec, 0x202f857c, 0x252f8304, 0x37271137, 0x2f821117, 0xe82b2d82, 0x04c3bde8, 0xe757c35c, 0x85e73efb, 0xfe192d2f, 0x05b803b8, 
-    0x0035005d, 0x273a403d, 0x0827eb48, 0x1d313320, 0x0f181a1b, 0x000a0c0d, 0x07340135, 0x012b1408, 0x3d022e22, 0x022e3401, 0x3335012b, 0x0b833e32, 
-    0x3b023e30, 0x22231501, 0x011d020e, 0x07020e14, 0x0782031e, 0x13841e20, 0x21036408, 0x1a447359, 0x33442912, 0x44332c2c, 0x441a112a, 0x31975973, 
-    0x0d233f32, 0x2737230f, 0x0f233727, 0x323f230d, 0xb8fe9731, 0x63814b1d, 0x395c44d7, 0x38188018, 0x63d8435b, 0x811d4a81, 0x3f512d11, 0x446447df, 
-    0x2a0c0c29, 0xdf466444, 0x112d513f, 0x01000082, 0xb1fefa00, 0x6905d703, 0x37003400, 0x480c3440, 0x342f24f7, 0x26272932, 0x18191b24, 0x08062016, 
-    0x88172b15, 0x2e3722ba, 0x20ce8903, 0x85c2831e, 0x08ce87ba, 0xfa012b51, 0x27453735, 0x3c25100e, 0x253c2a2b, 0x45270e11, 0x61a53537, 0x131d4a7e, 
-    0x2f384b2d, 0x2e4a382f, 0x7e4a1d13, 0x11cca561, 0xe240512e, 0x2b456547, 0x45290b0c, 0x40e14866, 0x82112e52, 0x64824c1d, 0x395b44db, 0x39188218, 
-    0x65d9455d, 0x411e4b82, 0x3532058f, 0x9a03b2fe, 0x37002606, 0x19b65100, 0x01030218, 0x3f464a01, 0x00133105, 0x00010403, 0x005f0003, 0x5b020101, 
-    0x3b020200, 0x2605ad58, 0x03010002, 0x19630102, 0x081185e7, 0x010f4022, 0x1f313400, 0x0012141d, 0x05360137, 0x012b1408, 0x2e272622, 0x3e343503, 
-    0x12363702, 0x23263435, 0x072acc82, 0x33033e27, 0x15021e32, 0x6e510214, 0x16690807, 0x37363237, 0x5d032315, 0x781e3914, 0x1c316ba9, 0x55284431, 
-    0x1423335d, 0x0d191a1e, 0x4a380d88, 0x4d2a2b57, 0x5454233b, 0x192f4129, 0x48684320, 0x1b112253, 0xb2fe3d0a, 0x4a120505, 0x3f4f876a, 0x72c5ab92, 
-    0x352101f2, 0x1f0e282a, 0x37312735, 0x191b3651, 0x4f354e33, 0x73eec6fe, 0x337f9ebf, 0x2e3f5338, 0x01021613, 0x06fb4801, 0xf3823720, 0xf3829c20, 
-    0x4a003928, 0x021d1eb6, 0xf3870200, 0x00001227, 0x03000300, 0x2ded825f, 0x01005b01, 0x4c023b01, 0x0018401b, 0xf4820001, 0x82630221, 0x0003221b, 
-    0x20228357, 0x3325835b, 0x0a40594f, 0x22243739, 0x04401719, 0x052b1508, 0x1633011e, 0x08e6a218, 0x50022621, 0x1e25057f, 0x2e071702, 0x405d1803, 
-    0xa7421807, 0x2b680808, 0x0a370101, 0x3d11111c, 0x43684926, 0x422f191f, 0x23545428, 0x2b2a4d3b, 0x0d384a57, 0x1a180e88, 0x3124141f, 0x2d432d16, 
-    0x1b314428, 0x76a96c32, 0x3d14391e, 0x010101bf, 0x2f130a0b, 0x3337533f, 0x73bf9e7f, 0x4f3a01ee, 0x19334e35, 0x3751361b, 0x20342731, 0x1b2a290e, 
-    0x80c28d5d, 0x92abc672, 0x6988503e, 0x05051249, 0x0239ad82, 0xf2fe2c01, 0x1206a503, 0x1d000e00, 0x1db50800, 0x02000e0f, 0x2e012b30, 0x08a28205, 
-    0x07370443, 0x1415050e, 0x0317041e, 0x8db470a5, 0x1f204266, 0xb68c6541, 0x5b306472, 0x1a30424f, 0x4f42301a, 0xf2fe305b, 0xa687641b, 0x6466c8ba, 
-    0x87a5b7c6, 0x0db51b64, 0x99886a48, 0xa65454a6, 0x486b889a, 0x20639a0d, 0x245b821e, 0x3707040e, 0x266b823e, 0x0127042e, 0x87b56f2c, 0x71b72163, 
-    0x0621638c, 0x28639f12, 0xfe900101, 0x06d703be, 0x099b4448, 0x11252308, 0x11011701, 0x90010701, 0xfe65e201, 0x651701e9, 0x01c8039f, 0xeafe65e1, 
-    0xeafe6cfb, 0x01000065, 0x3382fa00, 0x33874120, 0x30010423, 0x2030832b, 0x37348237, 0xfe1701fa, 0xe20165e9, 0x01dd1efe, 0x01940416, 0x1ffe6516, 
-    0x1ffe38fc, 0x00263382, 0xd104ec01, 0xc35c7902, 0x07c45a1b, 0x8d790222, 0x33eafe82, 0x0702ce26, 0xab020304, 0x132b9b9b, 0xce211521, 0xcbfc3503, 
-    0x82a4ab02, 0x0101289c, 0x03df0164, 0x9b83026d, 0x82012033, 0x64012733, 0xf7fd0902, 0x34828302, 0x002033e8, 0x08326b41, 0x0000012b, 0x04d5028d, 
-    0x00060023, 0x0206b306, 0x012b3001, 0x09150135, 0x00011501, 0xd3fed501, 0x2f022d01, 0xbfa20152, 0xf4fef4fe, 0x24ff84bf, 0x038d00fe, 0x202f87d3, 
-    0x212f8203, 0x30820209, 0xfe010124, 0x2e822d01, 0x2bfed53a, 0x0c014c01, 0xfebf0c01, 0x5efe525e, 0xd3000200, 0xfc03e1fe, 0x05002f01, 0x2405355c, 
-    0x00030609, 0x205b8204, 0x1243614a, 0x1212122e, 0x18080411, 0x3335252b, 0x01230315, 0xfc2e0586, 0x2d029ac4, 0x6099c5fc, 0x81fecfcf, 0x05837f01, 
-    0x57830020, 0x03c70325, 0x841406fe, 0x40202257, 0x6157881d, 0x3b2209ab, 0x51874c01, 0x33011b27, 0x25231503, 0x32058313, 0x6299c7d3, 0xc4cd01fe, 
-    0x04fc629a, 0xfe7e0196, 0x84cfcf82, 0x20538605, 0x8753a7fc, 0x87ab859f, 0x460523a5, 0xa683cece, 0x00250583, 0x01010000, 0x20a782cf, 0x2453842d, 
-    0x0317401a, 0x20f68300, 0x0ab74d4a, 0x20059c48, 0x21998401, 0x948acf01, 0x35293ba9, 0x23131533, 0x62fccf01, 0x827c8599, 0x8277a876, 0x2303253b, 
-    0xc5fc3102, 0x932c3b8c, 0xf202e1fe, 0x05002f01, 0x1c401f00, 0x9b62b387, 0x41b8850e, 0xf62406aa, 0x609ac5fc, 0x41059941, 0x4741079b, 0x85132028, 
-    0x200584bf, 0x24c482d3, 0x62fc0601, 0x0e46419a, 0x00030029, 0x04600480, 0x82d50550, 0x00072409, 0x493c000b, 0x0f2005f4, 0x24050a6d, 0x02020459, 
-    0x05886a00, 0x0a831620, 0x00010123, 0x21128455, 0x20835901, 0x4d010025, 0x5e094059, 0x01230941, 0x88230133, 0xca2e2603, 0x0158e0fe, 0x250589da, 
-    0x8bfed505, 0x03857501, 0xac24f382, 0x24036004, 0x262db77e, 0xac012313, 0x8356accc, 0x82002048, 0x01022200, 0x20438216, 0x3d5364ba, 0x13231323, 
-    0x20578233, 0x20578216, 0x835b860a, 0x415e82a4, 0x65834d1b, 0x80200387, 0x708b6c86, 0x022a7486, 0xf2fe2901, 0x1406a903, 0xd7430700, 0x05062a05, 
-    0x03000202, 0x045d0302, 0x09a36001, 0x0808082d, 0x120b080b, 0x10111111, 0x60190807, 0x213e070d, 0x11231125, 0x80022901, 0x80fdf0f0, 0x06c82c01, 
-    0xa6f96414, 0x5a066464, 0x0200a6f9, 0x57822801, 0x578ca820, 0xe1820020, 0x02215785, 0x053a4959, 0xf951578e, 0x2f578407, 0x02f0f028, 0x0280fd80, 
-    0x06aac81c, 0xdef8645a, 0x01225785, 0x57828701, 0x12064a28, 0x19000500, 0x384c1640, 0x01002105, 0x2205314c, 0x4d4c003b, 0x87250c4a, 0xfeaa1901, 
-    0x290482e7, 0x90038202, 0x70fc70fc, 0x3fab0000, 0xfea00226, 0x1901aae7, 0x3f890482, 0xbf000226, 0x0804f2fe, 0x0b277f84, 0x1b401e00, 0x82020309, 
-    0x844a207d, 0x82732088, 0x8300200a, 0x06ff4484, 0x33011325, 0x85230109, 0x87bf2005, 0x8f6d208b, 0x90032194, 0x5b859c86, 0x5ba51220, 0x85052d4e, 
-    0xd8012105, 0xa920a888, 0x5d88b28f, 0x0300002a, 0x32002301, 0xe303ae03, 0x2006a370, 0x058352e9, 0x01002323, 0x06e75606, 0x01070326, 0x02030502, 
-    0x2d0be77f, 0x05040108, 0x4b1b4f04, 0x585007b0, 0x2a931e40, 0x5b040529, 0x04040108, 0x824c043a, 0x820e2025, 0x2050a625, 0x2050a211, 0x204ba340, 
-    0x71008259, 0x6d731d38, 0x9823200a, 0x1e41380b, 0x1e1e841e, 0x1e1e4d01, 0xfd1e1e7e, 0x811e1eb1, 0x33031e1e, 0x821e741e, 0x95fe2402, 0x821e721e, 
-    0x6afe2102, 0x002d0785, 0x03d60101, 0x05fb02fe, 0x000500d5, 0x093d7135, 0x63523a20, 0x5239200b, 0xa3421663, 0x05764605, 0xd328022a, 0x3d0581a4, 
-    0xc1fe9898, 0x7a2c5382, 0x5903f504, 0x03006d06, 0x0e401100, 0x08484318, 0x09464318, 0xc693022a, 0x069abbfe, 0x0088fe6d, 0x012e0082, 0xf104e100, 
-    0x2507ef03, 0x13002400, 0x2f881040, 0x83232421, 0x2b142561, 0x37363413, 0x2105c75d, 0x0883033e, 0x06143322, 0x0c1b8e18, 0xe1235008, 0x672a2529, 
-    0x38310638, 0x2e35391c, 0x01141112, 0x26242698, 0x4b1d3361, 0x363c1d1d, 0x130e102d, 0x3cf10498, 0x39312c6c, 0x0d0b020e, 0x201a1306, 0x252f1314, 
-    0x302d6b39, 0x11091037, 0x17100606, 0x3512141d, 0x01010027, 0x03ee0479, 0x98660658, 0x790127b7, 0x9a1901c6, 0xb7876606, 0x04b22208, 0x071e04e8, 
-    0x002f0015, 0x1ab04b8c, 0x17405850, 0x03000500, 0x63030501, 0x06040200, 0x00020002, 0x2655825f, 0x1b4c0139, 0x8237b04b, 0x0022281e, 0x03020301, 
-    0x89700201, 0x086e1826, 0x232f8508, 0x29401b4f, 0x04212488, 0x20468202, 0x2c2c8a00, 0x57020004, 0x00020200, 0x0001065b, 0x3a4a1802, 0x1b1c2709, 
-    0x090b1315, 0x7a180607, 0x262c09ae, 0x27012e27, 0x33011e33, 0x36373632, 0x07384c18, 0x0e010f25, 0x41231501, 0x3622054c, 0x47183233, 0x51080932, 
-    0x502a1803, 0x0e362225, 0x233305a5, 0x150c271a, 0x56351a1e, 0x02183217, 0x379e7d82, 0x518d3633, 0x8045423d, 0x24413435, 0x0462221f, 0x171914e8, 
-    0x201d3949, 0x30190e11, 0x2a153f28, 0x20010706, 0xae789dc3, 0x14544542, 0x2627230f, 0x583b4f76, 0x6b53211e, 0x04bc2606, 0x061404f1, 0x23ed8214, 
-    0x00134016, 0x0128b382, 0x00005e02, 0x4c003b00, 0x0806bf56, 0x15331326, 0xbc211521, 0xfccc028c, 0xa91406a8, 0x0102007a, 0x020000ff, 0x005203d2, 
-    0x0017000b, 0x35b04b50, 0x15405850, 0x210d3f6a, 0x406a0105, 0x75402005, 0x0d241dc0, 0x1300010c, 0x210a7974, 0xae760806, 0x0323210c, 0x240a8574, 
-    0x1e1e1d02, 0x24028797, 0xc21e5402, 0x2102821e, 0x0785acfd, 0x003cb182, 0x01640101, 0x026d03a4, 0x000d0083, 0x0d214024, 0x00010207, 0x00064a01, 
-    0x00480002, 0x00211c82, 0x22248257, 0x82005b01, 0x254f2714, 0x16080222, 0x7c41012b, 0x75152005, 0x01380593, 0x407e4064, 0x44448542, 0x7f3f4385, 
-    0x1f83023f, 0xa41d1f1d, 0x1e1d1e1d, 0x43823682, 0xc7fed22f, 0x98052504, 0x35002b00, 0x19409900, 0x06735f0c, 0x232c352e, 0x02030416, 0x03040124, 
-    0x04050100, 0x07a44e18, 0x21431f20, 0x23108205, 0x02020073, 0x01297583, 0x03004b44, 0x005b0403, 0x06137404, 0x58503e24, 0x268a1d40, 0x18050d7d, 
-    0x25086f75, 0x1b4c0244, 0x1f8a2240, 0x0200012c, 0x63020103, 0x04040300, 0x4a865703, 0x4f040331, 0x09405959, 0x1b111a11, 0x08061d11, 0x18052b1a, 
-    0x260a7149, 0x11331137, 0x8217011e, 0x84152002, 0x61272015, 0x072a0969, 0x23110706, 0x06070611, 0x1f831415, 0xba02ad08, 0x3f42b070, 0x3d3e4947, 
-    0x1d6776ae, 0x491d1d40, 0x20461e24, 0x201f3e23, 0x441f2140, 0x1f3d2e20, 0x85673941, 0x2950504f, 0x0b1b4269, 0xd14d5157, 0x4cd37a78, 0x010b5c4b, 
-    0x02e1fe1f, 0x1808080a, 0x2112ac10, 0x020c0c0b, 0x0f029afc, 0x141f0b0b, 0x081414ac, 0xe2fe0311, 0x760c1805, 0x76b7b777, 0x0007403c, 0xff7b0003, 
-    0x066304a6, 0x00290039, 0x00380030, 0x15184090, 0x040d0f12, 0x30380006, 0x16181c2e, 0x27060206, 0x03031d25, 0x4b4a0302, 0x58501cb0, 0x01051c40, 
-    0x73040304, 0x00060600, 0x00010159, 0x004b3b00, 0x5b030202, 0xc560fb82, 0x82352005, 0x851a2023, 0x241e8323, 0x06000206, 0x21218b63, 0x1c901f40, 
-    0x57205d82, 0x02332286, 0x59594f03, 0x14130a40, 0x14283312, 0x1b08071b, 0x5626252b, 0x3e3d05c7, 0x33013f01, 0x37171607, 0x011e0733, 0x27261517, 
-    0x37323301, 0x22230615, 0x23072726, 0x08048337, 0x012e01b1, 0x17160127, 0x07010e13, 0x17141106, 0x0f123e01, 0x92515151, 0x8e1378c9, 0x1c373c14, 
-    0x23122b8d, 0xfe393611, 0xa8d910de, 0x1810d7b0, 0x168d100c, 0x8d22343b, 0x3a1c7402, 0x2fdefe1f, 0x6942263c, 0x8c4a7129, 0x01681512, 0x01b6b21a, 
-    0x0a6cc318, 0x13084e4b, 0x190ba569, 0x283dd50e, 0xd3bd97fb, 0x3f010190, 0x871e1257, 0x0b0a8c05, 0x2795fb02, 0x109c0416, 0xfe9e3946, 0x0096ecd9, 
-    0x00020000, 0x04c300cd, 0x0042044c, 0x004b0034, 0x1949404c, 0x0003020f, 0x010c1c26, 0x33030204, 0x02010229, 0x1a1b4a03, 0x00040d0e, 0x27283448, 
-    0x82470103, 0x02032b33, 0x04630300, 0x01010201, 0x06825702, 0x5b010223, 0x310c8200, 0x4235364f, 0x364b3540, 0x142c2e4b, 0x14080512, 0x4b18132b, 
-    0x362609b5, 0x17372737, 0x88443736, 0x37172406, 0x711e0717, 0x0731057e, 0x07170706, 0x06070627, 0x27262223, 0x0727012e, 0x394a1825, 0x0e29080e, 
-    0x17141501, 0xa6cd011e, 0x08081213, 0x10080807, 0xa65ea81e, 0x312d2e2e, 0x16163217, 0x5aa61834, 0x05190fa6, 0x0f0f0707, 0x0817831f, 0x322f2d46, 
-    0x1a1a2b1a, 0x01a41d29, 0x1f4e2c64, 0x1d20201e, 0x2b2d4f1e, 0x221d1f4e, 0x014d1e3e, 0x2b1fa61d, 0x1a2b1818, 0x30172d1c, 0xa85fa62b, 0x070f0f1f, 
-    0x0e180707, 0x19a65da6, 0x33161234, 0x2f2d3117, 0xa75ea62c, 0x3f081783, 0x11110808, 0x1f1fe7a3, 0x2d2d4f1f, 0x1f1e1d4e, 0x4e1c1e1e, 0x1e405930, 
-    0x03000021, 0xd3febe00, 0x14065a04, 0x3d003300, 0x9e004700, 0x01201340, 0x3d470205, 0x070d2128, 0x06050106, 0x03010001, 0x36066e74, 0x00070021, 
-    0x01047307, 0x05010802, 0x63050201, 0x3b030300, 0x1801094b, 0x2a075a50, 0x1b4c003a, 0x5050b04b, 0x8e1f4058, 0x82238228, 0x01072247, 0x24328400, 
-    0x401b4c03, 0x26218424, 0x05020400, 0x87005704, 0x33268f4f, 0x0e405959, 0x11113e3f, 0x11111b19, 0x0a101a1a, 0x212b1d08, 0x2605b443, 0x17011e35, 
-    0x84111716, 0x3435270c, 0x35373637, 0xd5431533, 0x17162b0d, 0x06141516, 0x11070607, 0x06821323, 0x82141521, 0x13172110, 0x08075446, 0x4f02279e, 
-    0x32336433, 0x60363560, 0x64626634, 0x32333495, 0x64be6a6a, 0x29255329, 0x5c2c2a52, 0x2a55221d, 0x386c6bcf, 0x66bd743c, 0x3b3a6801, 0x6f371b1c, 
-    0x3e3d6f64, 0x7b371d1b, 0x0b0b0f02, 0x21b4161f, 0x0122112d, 0x3b10ca01, 0x4d772e2f, 0x0d5e5e9c, 0x0b02ebeb, 0x0d140807, 0x082417ad, 0xfe020f0a, 
-    0x62602051, 0x36814c97, 0xd1fe0967, 0x3705cc05, 0x422e5d38, 0xfd113219, 0x3b3a0390, 0x1a4b2e61, 0x03001432, 0x9bfef500, 0x14064b05, 0x28001c00, 
-    0x44012c00, 0x020d1ab6, 0x4a010908, 0x3905174a, 0x03010532, 0x01020106, 0x00610203, 0x0a0b000a, 0x04005d0b, 0x004b3b04, 0x3a450909, 0x07072a07, 
-    0x010d4b3a, 0x5b000808, 0x0681760c, 0x11b04b26, 0x2e405850, 0x3485399f, 0x020c0728, 0x00420000, 0xad461b4c, 0x206fb505, 0x206f823e, 0x826f8930, 
-    0x238b8259, 0x6300080a, 0xae8bb387, 0x83590421, 0x4c0722c2, 0x26a28c1b, 0x08090001, 0x91630901, 0x0707213a, 0x59203087, 0x402f0082, 0x011d1e23, 
-    0x2a2b2c00, 0x1d222429, 0x78281e28, 0x102f0807, 0x090b0e0f, 0x1c011c00, 0x2b14080e, 0x542e2205, 0x162006e5, 0x0f591b1a, 0x36322722, 0x08a35918, 
-    0x21036e08, 0xa6022115, 0x3c71a064, 0x64a1703d, 0xfe2d9868, 0xb83101cf, 0x12a6bfbf, 0x8649992e, 0x86868a8a, 0x02868787, 0x1daafd56, 0x8ada9951, 
-    0x5097da89, 0x35015456, 0x79959579, 0x548dfafa, 0xd6da9c56, 0xd7d9dad6, 0xb0fed9d7, 0x00010094, 0x04e3ff25, 0x00f00525, 0x40cc004a, 0x06011d16, 
-    0x04011e05, 0x02010e06, 0x0b014603, 0x00014701, 0x0702470b, 0x01072a3f, 0x03010804, 0x63030402, 0x0a020109, 0x020b0101, 0x06006101, 0x005b0506, 
-    0x4b410505, 0x666b1800, 0x9d501807, 0x94272009, 0x0c0b2131, 0x00215482, 0x2c39885f, 0x401b4c06, 0x0005002d, 0x06050406, 0x23319563, 0x570b0000, 
-    0x23085f87, 0x594f000b, 0x011f4059, 0x3d404200, 0x2a393b3c, 0x24272829, 0x14181a22, 0x09101213, 0x00060708, 0x0d4a014a, 0x09d75518, 0x3337232a, 
-    0x012f3426, 0x35363437, 0x48180a82, 0x17340773, 0x27012e15, 0x07222326, 0x07210706, 0x15010e21, 0x1406011c, 0x16200482, 0x17200483, 0x16251282, 
-    0x32331617, 0x082e8237, 0x0706152e, 0x76f30206, 0x5d4242b2, 0x7531ae17, 0x02020101, 0x7d31a602, 0x88435e18, 0x484b54df, 0x264a214b, 0x5790524e, 
-    0xe1011857, 0x0146fe31, 0x4c080084, 0xd3fe3169, 0x92575816, 0x462a4e51, 0x4b494921, 0x45454b1d, 0x066e95d2, 0x413e0a10, 0x6c021505, 0x9047d68f, 
-    0xcf2b1314, 0x22112f1f, 0x6ccd6768, 0x030c1509, 0x10130b07, 0x04091110, 0x0b150a01, 0x6969ca6e, 0x1e2f1222, 0x14132bcf, 0x37008200, 0xfe000001, 
-    0x06b00456, 0x00360014, 0x2049404c, 0x21040501, 0x06050301, 0x05298c82, 0x04010001, 0x0301064a, 0x066c4307, 0x04050523, 0x056a435b, 0x00010124, 
-    0x3a82085b, 0x003e2008, 0x3100014c, 0x282e2f30, 0x161b1d26, 0x0d131415, 0x0136000b, 0x14080936, 0x2622132b, 0x18272627, 0x2007fa56, 0x24ef8336, 
-    0x21352313, 0x0c264113, 0x23012e2d, 0x0e070622, 0x21030701, 0x82032115, 0x06680807, 0x1a361acb, 0x301b2f32, 0x16311918, 0x1d1d4d35, 0xfc750e2b, 
-    0x0e311301, 0x9563313e, 0x34303230, 0x11142a0f, 0x4d331a2d, 0x0a241e1c, 0xfe2f012d, 0x471464b8, 0x56fe6233, 0x170a0505, 0x081711a4, 0x23280808, 
-    0x02506f23, 0x4a018faf, 0x6432885c, 0xa4120909, 0x0607180c, 0x201d2108, 0xc9fe445c, 0x7d85fd8f, 0x00733cc4, 0x0029bc82, 0x05430400, 0x001100d5, 
-    0x05e7438f, 0x00222108, 0x01050004, 0x06610504, 0x01070101, 0x00010800, 0x03030061, 0x02005902, 0x004b3902, 0x083a0808, 0x2507d578, 0x00080022, 
-    0x2e9a7308, 0x1b4c0324, 0x24852840, 0x860ac470, 0x00002b5b, 0x01065501, 0x59000101, 0x87820107, 0x59594d25, 0x86110c40, 0x09102700, 0x132b1d08, 
-    0xdc183523, 0x210808fc, 0x23153311, 0xe9e92311, 0xfd5a03e9, 0xfd500270, 0xcaf7f7b0, 0x04453901, 0x48feaa57, 0x45b5feaa, 0x4e82c7fe, 0x828b0021, 
-    0x056c30cb, 0x002700f0, 0x100a40b6, 0x11050601, 0x69060401, 0x5b4307e1, 0x43612009, 0x0020055b, 0x2a0c5b43, 0x0000010b, 0x0c00590c, 0x870c3a0c, 
-    0x095b43df, 0x2784318a, 0x5d0c0022, 0x200c5b43, 0x105b432e, 0x0c23318d, 0x8455000c, 0x21608238, 0xea830c00, 0x2627142c, 0x22232425, 0x15112021, 
-    0xf5832327, 0x820d1021, 0x333722f2, 0x20f48211, 0x28038335, 0x32333634, 0x2e151716, 0x051c5c03, 0x45742120, 0x82112005, 0x8b340807, 0xc7bfbfec, 
-    0x51ddd3c7, 0x47274f91, 0x46254544, 0x011b3c60, 0x0179fe87, 0x0271fe8f, 0xaa1ffc2d, 0x8f8f4201, 0xf9ff5f8f, 0x15b61d1f, 0x250a141f, 0x48678d56, 
-    0x2b081182, 0x00aabefe, 0xff0a0002, 0x05cc04e3, 0x004d00d5, 0x4ba40356, 0x585013b0, 0x013a0e40, 0x013b0602, 0x0125020e, 0x4a03030a, 0x21b04b1b, 
-    0x0d20158a, 0x26841586, 0x26820c20, 0xb76f1086, 0x3d2f0807, 0x000e0111, 0x030e0a03, 0x0f0f0063, 0x01075b05, 0x4b390505, 0x0202090d, 0x0c590602, 
-    0x06060208, 0x0a004b3c, 0x005c010a, 0x4b3a0101, 0x82040400, 0x0b0b2404, 0x46105b00, 0x39200c92, 0x3f8344ac, 0x46100421, 0xc383089d, 0x182085c0, 
-    0x4820f282, 0x09218593, 0x21c98b01, 0xd5a60d0d, 0x4f821a20, 0x4f894620, 0x01000a26, 0x64010a04, 0x990a2241, 0x12234157, 0x4d822120, 0x31823e20, 
-    0x02060d2d, 0x02080c55, 0x0e0d0006, 0x9b630d06, 0x1369415e, 0x45822720, 0x01084123, 0x20488506, 0x273e9c61, 0x5b0c0d0d, 0x440c0c00, 0x2014b241, 
-    0x20488235, 0x23489b45, 0x4b390707, 0x0022eb84, 0x09820505, 0x3a204c9c, 0x00274c83, 0x01000104, 0x9b700004, 0x100b2154, 0x9605d546, 0x4c0d225c, 
-    0x058a6f1b, 0x07004628, 0x07050f05, 0x5487700f, 0x00050027, 0x0f05060f, 0x875ca363, 0x214d82aa, 0x48a14c40, 0x000c0025, 0x410c0e0d, 0x0b200b8a, 
-    0x5721a482, 0x07ef4100, 0x2106ea42, 0x3879000b, 0x59480808, 0x4f2b4059, 0x5500014e, 0x4f564e53, 0x383d3f56, 0x24272936, 0x1c1d1e22, 0x18191a1b, 
-    0x10111317, 0x0a0c0e0f, 0x00020509, 0x124d014d, 0x052b1408, 0x23352722, 0x35262722, 0x010e2311, 0x2311012b, 0x1e323311, 0x11331702, 0x15270182, 
-    0x17141123, 0x19013b16, 0x240911cc, 0x012e012f, 0x073b4435, 0x22230133, 0x021e1415, 0x031e011f, 0x01061415, 0x34353632, 0x08418226, 0x59e70388, 
-    0x29695a6b, 0x7c032629, 0xe2647e7d, 0x213a583f, 0xbd5c2a06, 0x391313bd, 0x2f61365a, 0x200e463f, 0x55202534, 0x2d6d6e4b, 0x52272659, 0x1c0a872f, 
-    0x2e1f262f, 0x7a152c44, 0x4d469afc, 0x1d7e464d, 0x50500146, 0xc86002d1, 0x05a8fddb, 0x785a35d5, 0xfe3e0144, 0xa0fd8fc2, 0x2327268a, 0x5c583139, 
-    0x20283527, 0x95240f12, 0x1eaba180, 0x2828ae1e, 0x272f1faa, 0x150e1122, 0x43654d38, 0x1b03b4a8, 0x91878891, 0xb345cffd, 0x05582d07, 0x002300f0, 
-    0x110a4090, 0x12030401, 0x3e06556c, 0x40585035, 0x02010520, 0x00010106, 0x00610102, 0x5b030404, 0x41030300, 0x0001074b, 0x46590800, 0x1d200c89, 
-    0x1d842789, 0x5d080022, 0x04242f88, 0x24401b4c, 0x8c079a6a, 0x08082327, 0x2e845500, 0x00214c82, 0x07804608, 0x252a1426, 0x09101111, 0x20098d45, 
-    0x785b1834, 0x6a26200d, 0x21220599, 0x8c452115, 0xc7570805, 0xa5376ec7, 0x20492469, 0x22284d18, 0x433f1a41, 0x01403f87, 0x028dfe73, 0xaa33fc19, 
-    0xee8fd101, 0x3e3f7dfe, 0x17050707, 0x2118b810, 0x59591609, 0xfe8fd9c1, 0x0000aa2f, 0xfeb80005, 0x066004d3, 0x00160014, 0x0025001a, 0x00340029, 
-    0x1b0a408e, 0x0e060701, 0x46070901, 0x2c2007b7, 0x27082882, 0x01037305, 0x06010801, 0x63060107, 0x0c07010d, 0x070a0901, 0x02006309, 0x0b4b3b02, 
-    0x0a0a020e, 0x01045b00, 0x003a0000, 0x2a20ea82, 0x29832e98, 0x05222682, 0x3984000a, 0x4c023008, 0x261e4059, 0x34171726, 0x262a2b33, 0x28292629, 
-    0x17242527, 0x121a171a, 0x11111c11, 0x080f1011, 0x01292b1b, 0x33352111, 0x15031e15, 0x6c070614, 0x11260514, 0x23011923, 0xba792511, 0x11032106, 
-    0x023c0b89, 0x0188fe30, 0x965a6478, 0x7b813d6c, 0xdcf09e91, 0x1801b464, 0x20384f2e, 0x334f371c, 0x74080b83, 0x21426342, 0x3d624425, 0xfbfa1a05, 
-    0x7a512b05, 0x11867953, 0xad8fb414, 0xd2fe08ae, 0x8a012c04, 0x040276fe, 0x374a2e17, 0x162b4533, 0x010afc03, 0x0121fedf, 0x54361b03, 0x3a5b413d, 
-    0x0100041d, 0xe9ff0a00, 0xe505cc04, 0xf7002600, 0x010f1240, 0x01100102, 0x011a0204, 0x01000607, 0x4a040300, 0x502cb04b, 0x002f4058, 0x03070006, 
-    0x00610706, 0x08000003, 0x21ec8403, 0x2d785b01, 0x05053205, 0x04005904, 0x004b3c04, 0x59090808, 0x3a090900, 0x07ec4709, 0x36902c20, 0x09000828, 
-    0x005d0908, 0x3d8f0202, 0x68440520, 0x722a2007, 0x728f08d6, 0x3b850820, 0x31826f87, 0x88304021, 0x0004262c, 0x05040605, 0x23709161, 0x55080909, 
-    0x082a9986, 0x59594d09, 0x260e4059, 0x00821125, 0x2324122c, 0x080a2228, 0x0e012b1d, 0xc14c2301, 0x15172c08, 0x06222326, 0x33161415, 0x42113732, 
-    0x0783068f, 0xaf026d08, 0x5e4d843c, 0x39396a97, 0x985f976a, 0x8e967174, 0x968e9898, 0xfe130271, 0xfe91015e, 0xfdac016f, 0x37ac01e3, 0xdd9b5238, 
-    0x9bdd8a8a, 0x90a36e52, 0xeee5e5ee, 0x83170290, 0xfe83adfe, 0x00008360, 0x5f000100, 0x5904e4ff, 0x2e00f005, 0xb04be000, 0x40585015, 0x02010c14, 
-    0x020d2201, 0x2c2d0203, 0x1a1d2329, 0x03050006, 0x17401b4a, 0x0d271683, 0x22020401, 0x88040301, 0x4a042219, 0x26358559, 0x0005001d, 0x41570503, 
-    0x04240945, 0x00030301, 0x0a786218, 0x5a823520, 0x04001e22, 0x04222682, 0x26896305, 0x0e89aa18, 0x25823a20, 0x25881b20, 0x63060321, 0x9a4105e4, 
-    0x4c022407, 0x4121401b, 0x0320085e, 0x55207182, 0x6d852b89, 0x4f00033d, 0x40595959, 0x26000113, 0x1c1e1f24, 0x0b0f111b, 0x012e0009, 0x1408072e, 
-    0x1922052b, 0x730b6f8c, 0x7508077a, 0x1117021e, 0x33361533, 0x011f1632, 0x06222326, 0x013e1115, 0x02061537, 0x9ee38dc2, 0xe39e5555, 0x54ade38f, 
-    0xa46a76bf, 0x5c363a71, 0x568c477c, 0x152312c5, 0x76412f01, 0x55b35980, 0xc86b1cb1, 0xb4b41f01, 0x6bc91e01, 0x5f5ed58e, 0x95e49b4f, 0x508fd492, 
-    0x9d5d030f, 0xaa0504b5, 0xfeacb51f, 0x5f560777, 0x00008fd3, 0x6d000100, 0x6f0442ff, 0x3d001e05, 0xdb4f5301, 0x20102c05, 0x1d030201, 0x02000215, 
-    0x8202003b, 0x074379eb, 0x04201783, 0x4020178c, 0x97492a90, 0x24230807, 0x03030400, 0x09006604, 0x00730901, 0x4b3c0202, 0x00000107, 0x01055b03, 
-    0x4b440303, 0x01020608, 0x5a013a01, 0x20240712, 0x02020400, 0x26832b86, 0x055b0224, 0x33830203, 0x1324278a, 0x1f405850, 0x04212782, 0x97528472, 
-    0x82352026, 0x82232026, 0x9b26867a, 0x8d3e2079, 0x219f902a, 0x3d835902, 0x4021a482, 0x23508b26, 0x55020100, 0x2e82c582, 0x00030123, 0x21228264, 
-    0xa6835901, 0x4d010223, 0x35008359, 0x3c3d0e40, 0x22152816, 0x18112315, 0x1d080a27, 0x2e34012b, 0x624d2702, 0x15032106, 0x0889c018, 0x17021e2f, 
-    0x36073313, 0x17163233, 0x23011916, 0x20258a11, 0x08258201, 0x23033573, 0x08041902, 0x2e0d070b, 0x0c2c2c2a, 0x04080b07, 0x231295a7, 0x39254262, 
-    0x420b1f2b, 0x402f306a, 0x371d6240, 0x0a0703a8, 0x2a2e0b07, 0x110f3426, 0x695da80e, 0x60428702, 0x1a0f2c45, 0x0f1a231e, 0x4360452c, 0x60047ffd, 
-    0x113c3f60, 0x0112231b, 0x3219bc04, 0xdefe6836, 0x810277fd, 0x31476040, 0x1d1f1a0f, 0x77892320, 0xfeb07ffd, 0x05000092, 0x38008200, 0xd505d104, 
-    0x1e001b00, 0x26002200, 0xe1002900, 0x011d0a40, 0x01290403, 0xd547180b, 0x142c3b08, 0x0405070e, 0x080f1103, 0x03010203, 0x12166202, 0x05091015, 
-    0x0a0c1301, 0x49180003, 0x3a25137b, 0x2c405850, 0x2140820d, 0x39a3730b, 0x1b4c042a, 0x01063840, 0x72040304, 0x0023349b, 0x86550100, 0x00012279, 
-    0x3e7c8459, 0x594d0001, 0x232e4059, 0x1c1f1f23, 0x2327281c, 0x25262326, 0x1f221f24, 0x1c202122, 0x181e1c1e, 0x20129949, 0x06e54d17, 0x35233527, 
-    0x13211133, 0x05d24833, 0x15331538, 0x03211123, 0x01231123, 0x27131527, 0x35211523, 0x23011f23, 0x0083a217, 0xd3100124, 0x0883c4e6, 0x82f0fe21, 
-    0x13012708, 0x7e39b74f, 0x04820502, 0x024f4f2a, 0x7b937b26, 0xdafd2602, 0x0a820383, 0x03260885, 0xfececeaf, 0x008293f2, 0x00ce7b22, 0x3606ff4c, 
-    0x00d505c9, 0x01520049, 0x340e407d, 0x35060701, 0x19070801, 0x18080201, 0x08080b5b, 0x08010b28, 0x08050200, 0x09006302, 0x005b0409, 0x4b390404, 
-    0x06070700, 0x0606005b, 0x01034b44, 0x4b3a0101, 0x00050500, 0xc34c0a5b, 0x9c2f200c, 0x05fe4c36, 0x03213583, 0x08b94c0a, 0x58503523, 0x94369d40, 
-    0x833a206d, 0x25198236, 0x01050005, 0x76897000, 0x90820520, 0x5f000522, 0x0720b592, 0x2007b246, 0x2736882d, 0x09000400, 0x63090406, 0xea873e91, 
-    0x40213482, 0x262f9033, 0x07000600, 0x8b070608, 0x00012337, 0x10415705, 0x00052107, 0x0805e94a, 0x4b1f4022, 0x5100014a, 0x4b524a4f, 0x32373952, 
-    0x141f2130, 0x0f101112, 0x0005080d, 0x0c490149, 0x052b1408, 0x2c050757, 0x2e032317, 0x11012b03, 0x32211123, 0x05674816, 0x1e011f2a, 0x36323301, 
-    0x022e3435, 0x20051579, 0x050b4f36, 0x210ccf4a, 0xd04a020e, 0xa08d0809, 0x141e3821, 0x8b020e17, 0x302b187a, 0x818d273b, 0xa0a52401, 0x4b2e5054, 
-    0x7c3f3a27, 0x13595340, 0x29304229, 0x17324f37, 0x763b8c8d, 0x3c6a332e, 0x3d230cad, 0x583d2931, 0x4c291a38, 0x5e49fd6f, 0xa35e5f5f, 0x05080a1d, 
-    0x01070508, 0x38604a7f, 0x0589fd16, 0x9ad0d6d5, 0x911925b4, 0x3433b47a, 0x36275b58, 0x0f112029, 0x644d3612, 0x1faba140, 0x2828ae1d, 0x28301da9, 
-    0x150e1024, 0x41654e39, 0x2e588254, 0x84863a03, 0xeefd8484, 0x20008200, 0x08038206, 0xd1040021, 0x1f00d505, 0x26002300, 0x2d002a00, 0xf0003000, 
-    0x2d300d40, 0x000d031c, 0x01254a01, 0x51490102, 0x2e280570, 0x03050709, 0x0a0f1203, 0x3e05cf43, 0x11171318, 0x070b1016, 0x0c141501, 0x010d0003, 
-    0x06086100, 0x39040402, 0x0d010e4b, 0x480d3a0d, 0x2e2007af, 0x00220e82, 0x3ba5730d, 0x1b4c0424, 0x46833c40, 0x72040322, 0x0023379c, 0x88550100, 
-    0x00012280, 0x43838459, 0x323b05d8, 0x24242727, 0x2e2f2020, 0x2a272b2c, 0x28292a27, 0x26242624, 0x23202320, 0x431f2122, 0x192013dc, 0x2806dc43, 
-    0x33352327, 0x21173327, 0x23038437, 0x23153307, 0x03210383, 0x27018323, 0x17213713, 0x21072721, 0x40080682, 0x01132305, 0x59591323, 0x1d321244, 
-    0x0117c51d, 0x1e8c1e31, 0xc5172001, 0x11321d1d, 0xbf865943, 0xbfc80ebf, 0xfffe12fc, 0x117f010e, 0x0d820113, 0xfe12fdfe, 0x0249b7cf, 0x0370b972, 
-    0x8f758f80, 0x820084c2, 0x80fc2808, 0x89fc7703, 0x84750f04, 0xfd8f2700, 0xfd670299, 0x00820097, 0x2a00022e, 0xa704e3ff, 0x0f00d605, 0x9f001f00, 
-    0x08057c41, 0x05002723, 0x05020102, 0x01007001, 0x06010206, 0x0202006e, 0x01075b00, 0x4b390000, 0x03060600, 0x0204085c, 0x0a007c03, 0x2e8f2420, 
-    0x20830620, 0x60030622, 0x02203789, 0x8c05844b, 0x2a508355, 0x02000502, 0x03060063, 0x88570603, 0x03063e59, 0x40595950, 0x1e101113, 0x151a1c1d, 
-    0x111f1014, 0x1325111f, 0x18080920, 0x3625132b, 0x06964612, 0x21234608, 0x22212311, 0x33011902, 0x021e1411, 0x33112133, 0xa3012a03, 0x1f95d8ca, 
-    0xfe476641, 0xdd0295f2, 0x1e95d4ce, 0x01486641, 0x05018f11, 0xfe0103d2, 0xfed9fed8, 0x78560191, 0xfa336dab, 0x012a01b2, 0xfe6f0124, 0x240d83aa, 
-    0x0efa4e05, 0x35008200, 0x002a0001, 0x05a70400, 0x001100d5, 0x060a4079, 0x0f020101, 0x63460601, 0x04173508, 0x01050101, 0x00010600, 0x02010362, 
-    0x074b3902, 0x3a060601, 0x08ce4c18, 0x18831e8a, 0x84590221, 0x211e8224, 0x09821d40, 0x02060123, 0x213f8d55, 0x26825906, 0x4d060222, 0x0b24eb82, 
-    0x11111112, 0x10230382, 0x531c0808, 0x310805e1, 0x33011133, 0x21152101, 0x11012301, 0x8a8ab423, 0xdd3c02ac, 0x8401bafd, 0x72027efe, 0xac9cfde3, 
-    0x0273e102, 0x0289fd81, 0x737ffd77, 0xcf021ffd, 0xbf8431fd, 0xbf822f20, 0xd505a23d, 0x6c001700, 0x14151540, 0x10111213, 0x06070e0f, 0x02030405, 
-    0x03100001, 0x414a0100, 0x112005e0, 0x00200e82, 0x41fa821a, 0x1111192c, 0x18080418, 0x2707012b, 0x03823525, 0x35211122, 0x1124b382, 0x15051737, 
-    0x49080382, 0x04022311, 0x1d014dd0, 0x1e014dd1, 0x73042bfe, 0x50e52dfe, 0x50e6cbfe, 0x01cbcafe, 0xd96ea1ba, 0xd96ea288, 0xaaaa9e01, 0x6fa1f1fe, 
-    0x6fa288d8, 0x00b8fdd9, 0x1e000500, 0xc60439fe, 0x3b00f005, 0x6a005300, 0x8d008200, 0x50613201, 0x4c1a3c05, 0x04111617, 0x01500205, 0x0186010a, 
-    0x37690a04, 0x04040002, 0x00016a4a, 0x93401b47, 0x8509201c, 0x8559201c, 0x822820f3, 0x0820085b, 0x63080501, 0x0a000100, 0x630a0104, 0x41020200, 
-    0x0d090e4b, 0x04050c07, 0x065c0004, 0x00030b03, 0x2406da59, 0x40585037, 0x862f8f25, 0x2227842a, 0x83600004, 0x5f54183e, 0x8f2a2008, 0x2855822c, 
-    0x00090403, 0x010e5704, 0x22318409, 0x865f0009, 0x33402631, 0x02050200, 0x22319b72, 0x83090000, 0x00092238, 0x083b865b, 0x59594f30, 0x84294059, 
-    0x3d6b6c83, 0x8900013c, 0x848d8387, 0x6b75768d, 0x67826c82, 0x3c5a5c65, 0x2f533d53, 0x0a1c1e2d, 0x013b0009, 0x14080f3b, 0x0f4d172b, 0x17162b08, 
-    0x1337013e, 0x0607010e, 0x6f182707, 0x0e210ca8, 0x05586302, 0x26222327, 0x2f032e27, 0x26228301, 0x023e3225, 0x76033e37, 0x032006bf, 0x17241282, 
-    0x1301011e, 0x16233788, 0x82061415, 0x21328335, 0xa95d1303, 0x050e7008, 0x15010e26, 0x05021e14, 0x0f821582, 0x15060809, 0x1ba61614, 0x12162532, 
-    0x111d2e21, 0x05051427, 0x241a5f02, 0x5c090b0a, 0x2023340f, 0x9d673050, 0x072c2c33, 0x1212180f, 0x56252331, 0x1a331b30, 0x12181b0c, 0x0a050804, 
-    0x03012605, 0x2229311c, 0x0d130c0e, 0x251d2107, 0x085e3662, 0x2b15050b, 0x553f013a, 0x16253e12, 0x3e29172e, 0x2f2f2214, 0x1d163018, 0xa23e1039, 
-    0x0b0c2013, 0x0e070813, 0x1a1b091f, 0x03020616, 0xfc170f07, 0x09130ea8, 0x0e141a15, 0x3e221d19, 0x512d3354, 0x0e0e243c, 0x0319271a, 0x1b300a4d, 
-    0x5735381f, 0x1e222578, 0xf95e6d7b, 0x827a348a, 0x76413f85, 0x13363330, 0x191c0a17, 0x140a0515, 0xb4540a1b, 0x33594226, 0x696a682f, 0x42b77130, 
-    0xfc065055, 0x2255459b, 0xfd30371b, 0x98d002cb, 0x181d31c1, 0x8e56323c, 0x203fc778, 0xfd33361f, 0x245c02ee, 0x3e681b20, 0x2b144327, 0x3b49290e, 
-    0x1d183310, 0x071a2a37, 0x1c22201e, 0x451d180f, 0x2e3a0563, 0x8e04e3ff, 0x4500f005, 0xa2005500, 0x2b3b0d40, 0x1b030402, 0x01030a1a, 0x91430202, 
-    0x00253206, 0x01020003, 0x00630203, 0x00010004, 0x00630104, 0xa1d81807, 0x00002408, 0x18005b06, 0x200b3951, 0x822c9022, 0x06002222, 0x2c33885f, 
-    0x401b4c07, 0x00050028, 0x07050307, 0x232c9163, 0x57000606, 0x55839882, 0x4f06003d, 0x0d405959, 0x44454d4f, 0x162a2629, 0x0808102b, 0x32252b1a, 
-    0x3435023e, 0x4f27022e, 0x27200558, 0x7105fd4d, 0x162605f0, 0x33031e17, 0x76183632, 0xac080ea8, 0x1415031e, 0x1323020e, 0x3435033e, 0x0e222326, 
-    0x16141502, 0x6e43aa02, 0x1b0b2b4e, 0x784a232e, 0x2d3c2637, 0x2e1b0a1f, 0x231f0f18, 0x298b1928, 0x24404145, 0x18235c2c, 0x0c171d25, 0x731d3512, 
-    0x6d512d70, 0x546d3c41, 0x2f363531, 0x39152d44, 0x987eb776, 0x09111911, 0x291a313f, 0x854c0f1c, 0x3f624223, 0x3733321e, 0x173a4423, 0x230d2420, 
-    0x38231023, 0x5b426029, 0x29251a39, 0x0c1a291c, 0xd55b231f, 0x5a835582, 0x8b5a2b2f, 0x55cb6260, 0x6158552b, 0x749c5937, 0x1a8e0342, 0x244a4740, 
-    0x331e6b67, 0x8a5b2847, 0x6a000400, 0x07834800, 0x2c00242a, 0x25013100, 0x010115b4, 0x08077648, 0x0b103225, 0x0c030305, 0x01020206, 0x11610203, 
-    0x0f01020d, 0x0e000207, 0x12610001, 0x08000e01, 0x63080e09, 0x4a0a0a00, 0x2a5107fe, 0x0032250b, 0x73090809, 0x0a293eaa, 0xb04b1b4c, 0x4058503c, 
-    0x82398438, 0x030a2499, 0x9b630a04, 0x08082341, 0x8782570e, 0x5b080e2a, 0x080e0800, 0x3d401b4f, 0x06263a8c, 0x030c0201, 0x41845502, 0x010c0025, 
-    0x8e630c03, 0x083f8ec0, 0x59595928, 0x2d2e2640, 0x20202525, 0x312d2f30, 0x2c25312e, 0x292b2c25, 0x24202420, 0x1e1f2123, 0x11111824, 0x11111121, 
-    0x914c1310, 0x13202a0c, 0x1e231533, 0x06141501, 0x39088207, 0x012b030e, 0x26012311, 0x0515012b, 0x26343536, 0x17152127, 0x15213732, 0x00825bc5, 
-    0xb4017008, 0x785e8201, 0x0203025f, 0x13725e02, 0x70a67548, 0xa602caea, 0x02eaa54d, 0x02030310, 0xb0eaf2fd, 0x0319fe4d, 0x74737372, 0xf7fe0901, 
-    0x0e1f0f74, 0x730e1b0e, 0x2a4b673e, 0xcc04a8fd, 0x19e76363, 0x10201119, 0x7474e773, 0x35000200, 0x89045bff, 0x22007806, 0xb0002d00, 0x0a101640, 
-    0x23010202, 0x02050211, 0x03181d2d, 0x01000403, 0x43040306, 0x2720064c, 0x2b05ed64, 0x73070607, 0x04000500, 0x61040503, 0x430c4451, 0x25200e4e, 
-    0x03252e92, 0x03070600, 0x097b5106, 0x2405c048, 0x72000100, 0x26568400, 0x05020001, 0x88630201, 0x0603275e, 0x00570306, 0x5a830303, 0x4f060328, 
-    0x0b405959, 0x01821311, 0x1b11152f, 0x2b1c0808, 0x02022e05, 0x3e123435, 0x06756101, 0x012e1524, 0x0d821127, 0x35231129, 0x010e1121, 0x83231507, 
-    0x06740805, 0x1e171011, 0x45021701, 0x518fc16f, 0x6fc18f51, 0x5ecf6a8c, 0x4e6ccb60, 0x01783987, 0x76de6422, 0x276a438c, 0x6a276f6f, 0x6b0f1643, 
-    0xb71101bd, 0xbd1201b7, 0x898f0f6b, 0xd7464304, 0xfb045b60, 0x2723023f, 0xfda69101, 0x054e547f, 0x10e20589, 0xfe993646, 0x99d2fed1, 0x00104636, 
-    0x00030000, 0x04000027, 0x00d505a9, 0x001a0017, 0xb5ba001e, 0x04030119, 0x26071348, 0x050c0f26, 0x420d0303, 0x623405fa, 0x03070e10, 0x02080a01, 
-    0x00010900, 0x04040061, 0x010b4b39, 0x200bee42, 0x220e8226, 0x9d730900, 0x4c042933, 0x0030401b, 0x72040304, 0x00232d97, 0x84550100, 0x0001226a, 
-    0x4b6d8359, 0x20340555, 0x18181b1b, 0x1e1b1e1b, 0x1a181c1d, 0x16171a18, 0x12131415, 0x0cba5818, 0x23134808, 0x23373335, 0x33132135, 0x23152113, 
-    0x23153317, 0x21032313, 0x0b012303, 0x21270101, 0xac85cb07, 0x1601ef43, 0x01a5d0a5, 0xac41ed14, 0x9abfa485, 0xc19b33fe, 0x5f60a102, 0xfe3e2101, 
-    0x08023df8, 0x027bcf7b, 0x82f8fd08, 0xf8fd2106, 0x22080883, 0x4101cd03, 0xb6febffe, 0x0100cfcf, 0xe3ff0000, 0xf005d104, 0xc8003b00, 0x011c1240, 
-    0x011b0605, 0x82380504, 0x0139235c, 0x65420b00, 0x103b5d07, 0x01020b2b, 0x05050061, 0x06005b06, 0x1e976006, 0x8406095d, 0x07976031, 0x052b3987, 
-    0x2d401b4c, 0x05000600, 0x60050604, 0x318c0997, 0x08149760, 0x2f34362d, 0x282c2d2e, 0x1f252627, 0x0f181a1d, 0x080c0d0e, 0x00050607, 0x0d3b013b, 
-    0x052b1408, 0x34352422, 0x33352337, 0x37013e37, 0x7c213521, 0x232407f1, 0x36350722, 0x0805c777, 0x15330778, 0x0f010e23, 0x21152101, 0x1415010e, 
-    0x36323316, 0x010e1537, 0xfef88b02, 0xd99d12f8, 0x486b1d12, 0x3f0345fe, 0x1c1b090a, 0x4773502b, 0xabd2b9ba, 0x4681b66f, 0x30e99c15, 0x02276991, 
-    0x16a7fc3a, 0x699ba816, 0xd26c73cc, 0x4dd5e01d, 0x22157b41, 0x077b1844, 0x30471b09, 0x22405d3c, 0x3f4ecd77, 0x4b64a373, 0x442e7b3d, 0x1d7b0918, 
-    0x88802d4d, 0x2dd74944, 0x0082002d, 0x00022208, 0x04d3fe82, 0x0014064f, 0x00380027, 0x1513406a, 0x0102020f, 0x16212838, 0x22020304, 0x03040200, 
-    0x06dc4303, 0x05001d25, 0x7e730504, 0x00220854, 0x0f693b00, 0x1b40210c, 0x0d691f8d, 0x002e0807, 0x4c003b00, 0x270f4059, 0x1d242526, 0x131a1b1c, 
-    0x06101112, 0x052b1408, 0x013d052e, 0x37043e34, 0x1e153735, 0x2e151701, 0x32112303, 0xf883023e, 0x2311072b, 0x0e070603, 0x16141503, 0x05296517, 
-    0x82026b08, 0x63717c3e, 0x4a2b2a48, 0x3b7a7263, 0x58b35e65, 0x5b57572d, 0x575b3333, 0xb45a2d57, 0x5901645b, 0x20372a45, 0x0d04050d, 0x531f3146, 
-    0x2f08182e, 0xb08f6f4e, 0xb26b1168, 0x2d4c6c8e, 0xe202e608, 0xd5484402, 0x162e4b34, 0x2e16f1fb, 0x48d3354a, 0xf0fe0246, 0x4316b405, 0x706d6529, 
-    0x1b472633, 0x1e30945c, 0x00000b31, 0xcb4b0002, 0x00032407, 0x4a70000b, 0x193a05c2, 0x01040300, 0x02030502, 0x01010061, 0x00005900, 0x004b3900, 
-    0x053a0505, 0x92721b4c, 0x00192505, 0x73050205, 0x01242591, 0x1e401b4c, 0x00381b85, 0x00030100, 0x03006101, 0x55030202, 0x02030300, 0x02010459, 
-    0x594d0203, 0x260ca572, 0x21152113, 0x82352101, 0x23112805, 0xfb73042f, 0x4bd5018d, 0xcb2905c2, 0xfeaad505, 0xfbaaaade, 0x2e4882f7, 0x00006800, 
-    0xd5057104, 0xc8002b00, 0x820124b5, 0x4b4a3594, 0x585018b0, 0x01002540, 0x01090000, 0x01066300, 0x59050404, 0x3923a382, 0x8201084b, 0x07592671, 
-    0x3c030301, 0x0864584b, 0x2c823520, 0x13822320, 0x01201c82, 0x3690d684, 0x3a202a88, 0x00242a83, 0x73090009, 0x04202f9b, 0x2820e982, 0x00212584, 
-    0x237c8205, 0x63040503, 0x01212e8d, 0x21a68257, 0xbd835b00, 0x82594f21, 0x2b0e32f4, 0x1112112a, 0x14112411, 0x080a2421, 0x2e012b1d, 0x06887c03, 
-    0x37213723, 0x080c8321, 0x07213762, 0x21171621, 0x030e2307, 0x17031e07, 0x72022313, 0x4c454327, 0x48ddc130, 0x05244468, 0x0137e8fd, 0x432608db, 
-    0x37f34866, 0xfe37d203, 0x011657a7, 0x03e33723, 0x49704d2a, 0x413d3f27, 0x01d9cb2a, 0x36645279, 0x4126a612, 0x267b3359, 0x7b243b4a, 0x7b7e517b, 
-    0x39577243, 0x40210a0a, 0x68fe546a, 0x25338d83, 0xac040000, 0x1800d505, 0x0b409c00, 0x0302010b, 0x4a020412, 0x203f091f, 0x07030106, 0x03010201, 
-    0x01086202, 0x00010901, 0x6100010a, 0x04040105, 0x0a004b39, 0x420a3a0a, 0x20250701, 0x0a000a00, 0x242c9873, 0x401b4c04, 0x22368228, 0x91720403, 
-    0x00002328, 0x5c825501, 0x59000122, 0x89455f82, 0x18102705, 0x12151617, 0x02841111, 0x080b1031, 0x21012b1d, 0x27352135, 0x01333521, 0x82010933, 
-    0x15490804, 0x21150721, 0x23112115, 0x71fe0202, 0xfe5a8f01, 0xbffef3cb, 0x016c01d7, 0xb6fed96b, 0x56c5fefc, 0x6ffe9101, 0x6f0c02cb, 0x026f9723, 
-    0x026dfd31, 0x6fcffd93, 0xfd6f2397, 0x000100f4, 0x041f017e, 0x00f50454, 0x401e0005, 0x217e821b, 0x45187200, 0x11260f15, 0x08031011, 0x0d4f2b17, 
-    0x03400805, 0x70fdaa96, 0x2afca402, 0xd4fcf504, 0x000200aa, 0x04310158, 0x00c30379, 0x005f0034, 0x00554058, 0x1e000101, 0x35030201, 0x49040501, 
-    0x04070601, 0x0201344a, 0x02040148, 0x00011d49, 0x06015f48, 0x5908bd6a, 0x052c0817, 0x57050607, 0x07000400, 0x63070406, 0x2e06bc45, 0x2a4f0605, 
-    0x292b252b, 0x08352f29, 0x4c2b1c08, 0x1e2407fe, 0x031e1702, 0x01200284, 0x2a08a365, 0x2223010e, 0x2e012f26, 0x64262703, 0x152006ad, 0x23062c4d, 
-    0x1e173317, 0x36212782, 0x220f8237, 0x4d010e15, 0x29840535, 0x33822e20, 0x0607bf08, 0x4e275807, 0x364e2422, 0x1a151009, 0x1b1b1113, 0x06091620, 
-    0x2f080504, 0x45443371, 0x4b234b20, 0x264b2447, 0x21375e38, 0x1a1c2218, 0x29313510, 0x4b1f204d, 0x224e2826, 0x64294f20, 0x3c210181, 0x42293360, 
-    0x2a442220, 0x24224a26, 0x6431244c, 0x240f2139, 0x130c2124, 0x464c1a38, 0x50034a47, 0x0e0d2d1e, 0x0502010d, 0x09070404, 0x0304090d, 0x17040301, 
-    0x310e1e1f, 0x1c3aaf1e, 0x171c0e0e, 0x0b0e0a0e, 0x0f0c0407, 0x222f0d0e, 0x0d2e1fc3, 0x0f370f0c, 0x0e111c1b, 0xb0232c0f, 0x0e0e2c1d, 0x0f1a190e, 
-    0x0b0d0e07, 0x1e060503, 0x0100411e, 0xaf00a600, 0x55042b04, 0x42001100, 0x36821340, 0x0a0b0c23, 0x06595009, 0x00010e2b, 0xb04b4a01, 0x4058503e, 
-    0x0799440b, 0x4c013c22, 0x14ac4418, 0x17185608, 0x2b160802, 0x2d270501, 0x11053701, 0x17251133, 0x2507010d, 0x2f022311, 0x0139b0fe, 0x399afe66, 
-    0x01735001, 0x9afe3950, 0xfe396601, 0x280273b0, 0xc2c362cb, 0x7901cb63, 0x63cb87fe, 0xcb62c3c2, 0x000087fe, 0x54000100, 0x7f042801, 0x23001203, 
-    0xb04b5900, 0x267a8245, 0x0205061b, 0x82010003, 0x00632dea, 0x04000004, 0x04040057, 0x01025c00, 0x502b0c82, 0x0022401b, 0x04000402, 0x8b700002, 
-    0x87022025, 0x00002725, 0x59500004, 0x59820e40, 0x23002334, 0x26132328, 0x19080724, 0x010e012b, 0x22230607, 0x01832627, 0x0722232f, 0x36230706, 
-    0x32333637, 0x17011e17, 0x06df4116, 0x7f046708, 0x48251b04, 0x343a4fa5, 0x28254e4a, 0x23204d25, 0x3f059c07, 0x3b499852, 0x3620451e, 0x192a1533, 
-    0x03024750, 0x41a4700e, 0x65212291, 0x481d1d6c, 0x84d0ab54, 0x4312238f, 0x16334a2d, 0x00a7a316, 0x00500003, 0x0481046a, 0x001a009e, 0x00400034, 
-    0x40104062, 0x3c3d3e3f, 0x38393a3b, 0x020b3637, 0x4b4a0103, 0xe1821eb0, 0x01051424, 0x81180402, 0x442d0cb2, 0x401b4c03, 0x0001001b, 0x03010203, 
-    0x231e8263, 0x57020000, 0x02220682, 0x28845b00, 0x40594f3a, 0x011b1c13, 0x1b282a00, 0x10341c34, 0x011a000e, 0x1408061a, 0x2622252b, 0x08355d18, 
-    0x4f08c95f, 0x272005dc, 0x6808d74f, 0x451805ab, 0x27310986, 0x17372737, 0x17071737, 0x02072707, 0x47c47269, 0x3900824e, 0x32305a26, 0xc2763463, 
-    0x4d4e4e48, 0x74c3464f, 0x3638924f, 0x203d373d, 0x1e821f41, 0x39944308, 0x373d393a, 0xc2d48f38, 0xc3c463c4, 0x63c2c363, 0x566ac2c2, 0x6ac54e47, 
-    0x264ec36a, 0x1315143d, 0xc44e4856, 0x4fc5686b, 0x3d8c5746, 0x55913637, 0x203c8e4c, 0x3b1e0e29, 0x4e933a39, 0x37368e54, 0x3a8aca3d, 0x41000021, 
-    0x8020102b, 0x36051941, 0x05010726, 0x09040108, 0x00610405, 0x02090006, 0x0b610906, 0x410a0201, 0x2d28112b, 0x03000100, 0x63030106, 0x00233094, 
-    0x82570200, 0x00022237, 0x273a845b, 0x1f40594f, 0x00011b1c, 0x200a8d41, 0x0b494135, 0x49410c20, 0x21132437, 0x67112135, 0x232005c7, 0x2a2d4941, 
-    0x01edfe0a, 0x14018c13, 0x418cecfe, 0x012a2e48, 0x15018c46, 0xfe8cebfe, 0x008200ee, 0x00032808, 0x04c00058, 0x008f0479, 0x00270023, 0x4078002b, 
-    0x01010013, 0x02011200, 0x234a0203, 0x49010201, 0x48000111, 0x7439b04b, 0x002605c9, 0x02010402, 0xa45f0063, 0x0706270a, 0x0303005d, 0x4b825b00, 
-    0xd2684420, 0x00002305, 0x52180203, 0x00200cd5, 0x2306d15f, 0x55060707, 0x09877818, 0x0b40592a, 0x13111111, 0x34262529, 0x26055d45, 0x1e323303, 
-    0x45011f02, 0x5218052d, 0xe0670ee4, 0x21153305, 0x4c4d2a58, 0x2b12294b, 0x202a4336, 0x4831613d, 0x52184b88, 0x042310ed, 0x84dffb21, 0x201c2c03, 
-    0x030c1b2c, 0x0e12160c, 0x183c1b1b, 0x240ef652, 0xacc0ac96, 0x20fb8300, 0x2bfb8296, 0x000b006f, 0x011b000f, 0x08b04b66, 0x1c21e682, 0x2ebe8200, 
-    0x61030205, 0x01070500, 0x5f040504, 0x18000106, 0x2209416a, 0x9c0ab04b, 0x00442623, 0xb04b1b4c, 0x20239c0e, 0x2023843c, 0x85239c11, 0x9c132047, 
-    0x20478523, 0x85239c17, 0x9c182047, 0x20478523, 0x83239c3e, 0x22402a47, 0x01060100, 0x00010200, 0x09234163, 0x08557918, 0x04010724, 0xc9650405, 
-    0x17403608, 0x00011011, 0x1b101417, 0x0e0f1a11, 0x04070c0d, 0x0a010b00, 0x0e8f7508, 0x15210523, 0x0bd47821, 0x1e0c022e, 0x1e1eb91e, 0x210493fd, 
-    0xb401dffb, 0x03240c84, 0x1eba1e79, 0xa2230282, 0x8369feaa, 0x1eb9231c, 0x6c180000, 0x00334daf, 0x04000082, 0x00b80550, 0x4b850026, 0x585023b0, 
-    0x4c001e40, 0x2f50052f, 0x4b392708, 0x00050500, 0x4964065b, 0x05874b06, 0x7d4c1c20, 0x8b2d8708, 0x21402123, 0x4f181e91, 0x29080ef3, 0x13405959, 
-    0x22240001, 0x1a1b1c1d, 0x0e101113, 0x25012600, 0x2b140807, 0x022e2221, 0x35012e27, 0x37023e34, 0x15213336, 0xa5552221, 0x24098205, 0x1e17011e, 
-    0x08128301, 0x45780224, 0x215c7081, 0x41222122, 0x88743b5c, 0x28fed801, 0x3b495730, 0x03180e14, 0xe2fc1e03, 0x32121404, 0x15835894, 0x875f343b, 
-    0x61b65553, 0x88a3bc64, 0x2baa6232, 0x2a3c664b, 0x33aa316a, 0x8d8b3260, 0x08e682aa, 0x63004a2b, 0xa2048904, 0x31002000, 0x64004400, 0x0f111b40, 
-    0x3f000202, 0x0112313e, 0x1f020305, 0x03030101, 0x0001104a, 0x01012048, 0x05644547, 0x01041329, 0x03010003, 0x82005f01, 0x005b2928, 0x02440000, 
-    0x1a401b4c, 0x02240882, 0x63020003, 0x34821d82, 0x06825720, 0x5b010322, 0x4f362783, 0x330c4059, 0x33443232, 0x292e2a44, 0x2b170805, 0x032e013f, 
-    0xd9823435, 0x021e322b, 0x07173717, 0x1415011e, 0x06635407, 0x46010721, 0xeb820b6e, 0x46051721, 0x01200b88, 0x4d08ff84, 0x2817754a, 0x9f9d121e, 
-    0x515f37dd, 0x63751d44, 0x9d412d76, 0x3674be4b, 0x1c44505e, 0x129f0276, 0x4e471624, 0x3c3a934e, 0x16081c37, 0x4e42010d, 0x383b3994, 0x16070e0e, 
-    0x11d8fd0c, 0x4d231028, 0x451d75c6, 0xdf375e51, 0x20129f9d, 0x3f821629, 0xa0383b08, 0x4b9ddf6d, 0x281e1253, 0x65037617, 0x1e09150d, 0x933c393b, 
-    0x14454f4e, 0x3baa1226, 0x4e923b39, 0x11234d26, 0xd8fd1029, 0x0f07150d, 0x0200000f, 0x60015800, 0xa2037904, 0x50180300, 0x13212561, 0x05c34421, 
-    0x44045821, 0x0323069f, 0x44ecaaa2, 0xc0240583, 0x42047904, 0x0b294784, 0xb04b5100, 0x40585020, 0xd85e181a, 0x193c2016, 0x222592ce, 0x18110940, 
-    0x8708fe5e, 0x887e8378, 0x3484847c, 0xacc0aa42, 0x0000acc0, 0x00b20001, 0x051d0400, 0x000b00d5, 0x05d94277, 0x7f821d20, 0x02000133, 0x03006101, 
-    0x00590403, 0x4b390404, 0x05000000, 0x0c654e59, 0x2485a483, 0x00201a82, 0x09295f18, 0x4c03392b, 0x0020401b, 0x02030004, 0x1b941804, 0x82612008, 
-    0x00052223, 0x21458655, 0x684e0500, 0x2137240e, 0x86352111, 0x02b22403, 0x834cfdb4, 0x03230803, 0xaa95fc6b, 0x01aaec01, 0x2bfaaaeb, 0xff020000, 
-    0x040000fa, 0x008f05d9, 0x00060003, 0x0106b53d, 0x50010201, 0x0e20060d, 0x02205882, 0x61218c82, 0x05ba6300, 0x00154022, 0x73201c82, 0x09e45018, 
-    0x02005925, 0x184d0200, 0x08083a50, 0x01210324, 0x01210123, 0xfddf0406, 0xd901d1f8, 0x70011ffd, 0x71fa8f05, 0xe9fbe304, 0x58000100, 0x79048d00, 
-    0x65827704, 0xb3062208, 0x30010306, 0x0109132b, 0x01150135, 0xfc520358, 0xfb2104ae, 0x014401df, 0xb640013d, 0xfea65efe, 0x2058825e, 0x22978258, 
-    0x823f0479, 0x000a242f, 0x4b0a4039, 0x0722060e, 0x4d414800, 0x820b2005, 0x5901219c, 0x10219987, 0x21098200, 0x13865500, 0x4d01002c, 0x1711b459, 
-    0x2b160802, 0x64842d13, 0x15211528, 0x23035821, 0x6883ddfc, 0xb62a6c84, 0xfeb8e7ea, 0xb4fea8b5, 0x3582aa56, 0x292afd82, 0xa804fa00, 0x2d00f003, 
-    0x48824200, 0x4a404d3e, 0x12293251, 0x01050404, 0x0101024a, 0x04050107, 0x0a630501, 0x04030906, 0x57040000, 0x26080884, 0x035b0004, 0x04000208, 
-    0x43444f00, 0x00012e2f, 0x55434c4e, 0x36385544, 0x422f422e, 0x17192325, 0x2d000b0d, 0x480b2d01, 0x33260ec8, 0x1e171632, 0x2f5a1701, 0x0706290c, 
-    0x2223010e, 0x27012e27, 0x27240983, 0x37363732, 0x200f204a, 0x06b14321, 0x8206e272, 0x16990841, 0x6b3d4c01, 0x27292929, 0x456b2527, 0x22214c32, 
-    0x3f181e3d, 0x30512222, 0x2527693f, 0x28262b30, 0x41523d6b, 0x40274522, 0x374b2343, 0x2e363542, 0x2e16321e, 0x173d223c, 0x15151914, 0x6d023713, 
-    0x16173c22, 0x462a2a17, 0x2e353442, 0x2d173020, 0x353536fa, 0x8d50538b, 0x1d363134, 0x45591d1c, 0x1d1d5b3d, 0x30333a22, 0x8b535a87, 0x32353431, 
-    0x7b42591a, 0x8d191d36, 0x487d3c3b, 0x21311759, 0x3b571d21, 0x1d215833, 0x20232023, 0x41693957, 0x7c3b3a40, 0x3219564b, 0x08008200, 0x81000134, 
-    0x4c048dfe, 0x48000e06, 0xb04b8d00, 0x4058500f, 0x05040020, 0x68040501, 0x02020100, 0x02006601, 0x02000106, 0x05006000, 0x005b0305, 0x053b0303, 
-    0x2d761b4c, 0x85212005, 0x70012127, 0x40212899, 0x23238a22, 0x6e020105, 0x07464d92, 0x383a2f05, 0x24262d2f, 0x0a0c1416, 0x48014800, 0xd1180807, 
-    0x36270b24, 0x16173233, 0x82011e17, 0x32332c02, 0x3712013e, 0x34363436, 0x4b123637, 0x162406b4, 0x06071415, 0x08059541, 0x27012ea6, 0x2223012e, 
-    0x0e140302, 0x030e0702, 0x01010e07, 0x1a44293a, 0x1210181a, 0x18233a23, 0x06060e19, 0x0e090303, 0x111d291b, 0x01010104, 0x32323207, 0x47275d95, 
-    0x2020311a, 0x101c2a37, 0x04040612, 0x0c090302, 0x02073c33, 0x05010302, 0x17251b13, 0x8dfe8f2f, 0x39161514, 0x112b191e, 0x1b0f0f20, 0x14141b0c, 
-    0x01af5a16, 0x271fa601, 0xfc1b2321, 0x75756f01, 0x2b17136a, 0x20203342, 0x111a0b13, 0x130b1d0b, 0xfeccfe11, 0x57440dc9, 0xd17f285f, 0x663283a9, 
-    0x01000069, 0x1afe7c00, 0x8907c702, 0x6d001d00, 0x3f056741, 0x03010018, 0x68010202, 0x3f030300, 0x0202004b, 0x01045c00, 0x00400000, 0xb04b1b4c, 
-    0x40585025, 0x0bd7bd18, 0x402b208e, 0x01030016, 0x01007203, 0x8b720102, 0x59593039, 0x00010f40, 0x0e101415, 0x1d000507, 0x41051d01, 0xf76d0547, 
-    0x06414106, 0x1b124608, 0x11331101, 0x010a0714, 0x01010e07, 0x40625836, 0x09373036, 0x03020602, 0x3e310b08, 0x03c60808, 0x302f3507, 0x541afe94, 
-    0x2c3e3642, 0x0f1c081d, 0x35011113, 0x2f013601, 0xf5fa6b05, 0xf9fe8124, 0x706e94fe, 0x27d3826e, 0x00fe0102, 0x6c074c04, 0x6320d382, 0x1720d385, 
-    0x03209282, 0x1d47d383, 0x23b78206, 0x03400303, 0x2320d283, 0xf282d282, 0x1e820220, 0x47700321, 0x1f88073d, 0x39864020, 0x03221a82, 0x1e887103, 
-    0x594c0231, 0x2714b659, 0x08042724, 0x34012b18, 0x41011a37, 0x152105f4, 0x072d7b14, 0x23012e2a, 0x010b0222, 0x01022311, 0x5f20b785, 0x392bd082, 
-    0x050d332c, 0x0b030203, 0x833d3209, 0x240826d0, 0x01070181, 0x83b5826c, 0x23263fd3, 0x160f160e, 0xfecbfe0e, 0xfad1feca, 0x00010098, 0x040000a4, 
-    0x00a2042c, 0x4b530032, 0xa8821ab0, 0x81871120, 0x2006d665, 0x07ec7801, 0x00000f2a, 0x00010200, 0x01036302, 0x22066c45, 0x45010316, 0x5720086d, 
-    0x5b251d83, 0x02000200, 0x22b7824f, 0x841b2d1d, 0x181320b7, 0x240c8240, 0x15031e17, 0x07556811, 0xc6732720, 0x0e072405, 0x830e0701, 0xa4260816, 
-    0x79190d0c, 0x6d66575b, 0x2c1c39b1, 0x0609050e, 0x0301ac04, 0x0b050304, 0x44330c03, 0x4c272850, 0x080e3443, 0x12820208, 0xad023208, 0x9c784402, 
-    0x1e746734, 0x1b373e1d, 0x3916384c, 0xfd45684e, 0x0da202bc, 0x122c2c27, 0x1b08231b, 0x1011202c, 0x111c2d1e, 0x30161422, 0xfd09242d, 0x459c8260, 
-    0x023c0fdf, 0x132b3001, 0x09150135, 0x04581501, 0x03aefc21, 0xa62f0252, 0xfeb6a201, 0xb7c3fec0, 0x02262f83, 0x00005600, 0xdf457704, 0x27648241, 
-    0x0515010d, 0x56211521, 0xdf216882, 0x06094803, 0xa84c022a, 0xe7b84b01, 0xaa56b6ea, 0x250a8741, 0xb5300006, 0x51510104, 0x50352505, 0x000c4058, 
-    0x72211c82, 0x07724102, 0x0e880a20, 0xb5596923, 0x081d5312, 0x01092336, 0xedf20123, 0xfebf4d01, 0xbffbfefb, 0x5efba204, 0x54fcac03, 0x582a3a82, 
-    0x79047301, 0x05005e03, 0xe74c3e00, 0x00162605, 0x02000002, 0x231a8267, 0x00550100, 0x25054856, 0x1b4d0001, 0x18821540, 0x8f730221, 0x083a4717, 
-    0x35210132, 0x03231121, 0x0487fcd1, 0xb202a821, 0x0015feac, 0x3f428b83, 0x22b78307, 0x62020102, 0x0c200863, 0x022b5982, 0x02007200, 0x4c023a02, 
-    0x880a401b, 0x08b7820e, 0x1012112a, 0x2b170803, 0x01093313, 0xa4230133, 0x010501bf, 0xb3febf05, 0xfca204ed, 0xfbac0354, 0x0100005e, 0x2d025800, 
-    0xd7027904, 0x1beb4c18, 0x1521132b, 0x21045821, 0xd702dffb, 0x2c8b84aa, 0x04ae0096, 0x0054043b, 0xb306000b, 0x06bf4709, 0x09372308, 0x01091701, 
-    0x96010907, 0xa2fe5e01, 0x015e0174, 0xa2fe745f, 0xfe745c01, 0x01a4fea3, 0x015c0125, 0x0f82755e, 0xfe220483, 0x238377a4, 0x75824a82, 0xff822508, 
-    0x0650044f, 0x00210069, 0x0034002a, 0x341540a8, 0x04050219, 0x06020120, 0x104a0205, 0x4800020f, 0x47060121, 0x3105364c, 0x02080a22, 0x04010903, 
-    0x61040305, 0x02020107, 0xed825b00, 0x4b390022, 0x64065054, 0x35240625, 0x20405850, 0x21821882, 0x02000323, 0x8b338a63, 0x25402127, 0x06232296, 
-    0x86570506, 0x06053c28, 0x4059594f, 0x2c222213, 0x222a222b, 0x2221242a, 0x13111111, 0x1c080b2c, 0x1837052b, 0x2e07a851, 0x1737013b, 0x23153307, 
-    0x21152103, 0x82331603, 0x27222305, 0x55791b07, 0x178d0807, 0x17011e23, 0x0117031e, 0x5f3c433f, 0x40232342, 0x88743a5d, 0x27a336aa, 0x0190b07c, 
-    0x908efe3e, 0xd8011913, 0x2b3128fe, 0x76907c3a, 0x1231925b, 0xfafa0414, 0x0a111405, 0x10191615, 0x8a31dd80, 0x6363bca5, 0x3188a4ba, 0x7f32b162, 
-    0xaa23feaa, 0xaa0427fe, 0xe203bd0c, 0x898fdd01, 0xaa335f33, 0x1e315a3a, 0x13262a31, 0x00010000, 0x04250058, 0x00dd0479, 0x40340013, 0x02090a31, 
-    0x01134803, 0x01044700, 0x02010503, 0x61020301, 0x20f28206, 0x0df97800, 0xd0821120, 0x11210382, 0x29d38208, 0x3523013f, 0x35213721, 0xd0831321, 
-    0x82072121, 0x033908ca, 0x01c9a47d, 0xfefdb84a, 0x7df68702, 0xb2fecba4, 0xfd0602b8, 0xd38df879, 0x01aaecac, 0xaad5663b, 0xc5feacec, 0x02000000, 
-    0xc4ff5800, 0x3e057904, 0x25001800, 0x13405a00, 0x2e6f8225, 0x03040101, 0x0e0f4a02, 0x18480002, 0x18470401, 0x2408ab64, 0x04030400, 0x4192825d, 
-    0x3c2506bf, 0x401b4c02, 0x829a821a, 0x19032012, 0x2213ff1b, 0x82220940, 0x2b1329a2, 0x2b1a0806, 0x012e3705, 0x2306ba4d, 0x1737013b, 0xa782a384, 
-    0x23130725, 0x5a020e22, 0x45080641, 0x2d463501, 0x4744204b, 0x64ae814a, 0x39a14b7e, 0xbafe1301, 0xfd2302dd, 0x4aa84ba9, 0x33587745, 0x2f17302f, 
-    0x13cd0718, 0xa6452134, 0x83b06663, 0xaa35df4a, 0x9670fd96, 0x330504df, 0x42467959, 0x21173073, 0x3757000b, 0x3313222b, 0x23848211, 0x2c03aa7e, 
-    0x36073457, 0x02000000, 0xe7ffbe00, 0x2d051704, 0x51003a00, 0x11b57e00, 0x4b060501, 0x2530074f, 0x01020300, 0x70010302, 0x02000400, 0x63020403, 
-    0x06246d82, 0x63060105, 0x09b4b918, 0x4c004225, 0x9a2b401b, 0x00002327, 0x2e885705, 0x4f00053b, 0x3c194059, 0x4700013b, 0x3c513b45, 0x232e3051, 
-    0x0d1c1e22, 0x013a000b, 0xe48d183a, 0x6f8a180b, 0x05754a08, 0x57058264, 0x23200553, 0x4a0aac54, 0x15250599, 0x0e070214, 0x09a95401, 0x0c95f718, 
-    0x21023d08, 0x33328448, 0x39373732, 0x415f4c91, 0x0815361d, 0x0304040b, 0x38131410, 0x26382122, 0x07193222, 0x0c0b1124, 0x5a212325, 0x36925733, 
-    0x424d3733, 0x356cb845, 0x2422235c, 0x4e2c1615, 0x76080882, 0x15162423, 0x36193f16, 0x548d3635, 0x4341a957, 0x44142d3c, 0x2a532c37, 0x421d4f29, 
-    0x20212365, 0x201a1d1d, 0x1c0b0f07, 0x173d1b0f, 0x4e4d1917, 0xa78ad34b, 0x6a66e6fe, 0x423f3872, 0x455ca83f, 0x3e3e1f5a, 0x59aa4242, 0x1e1d5a47, 
-    0x0000001f, 0x00210005, 0x05b00400, 0x001a0098, 0x0032002e, 0x005c004c, 0x30124099, 0x31030201, 0x2f020001, 0x32050701, 0x5e070601, 0x27320757, 
-    0x03000100, 0x63030102, 0x08020109, 0x02050001, 0x42826300, 0x05060734, 0x010b6307, 0x5b040606, 0x0404010a, 0x1b4c043a, 0x299c2d40, 0x06040423, 
-    0x08308857, 0x4f040626, 0x4e234059, 0x1c33344d, 0x5600011b, 0x4e5c4d54, 0x333d3f5c, 0x264c344c, 0x1c2e1b24, 0x000b0d2e, 0x0c1a011a, 0x210c7b4a, 
-    0x7c4a013e, 0x56162007, 0x27320d1a, 0x07222326, 0x1415010e, 0x09011e17, 0x01091501, 0x67182722, 0xae4a099c, 0x18318805, 0x8209538c, 0x1634082e, 
-    0x74445f01, 0x322f2d2a, 0x45742a2a, 0x2d3a3b40, 0x180b2417, 0x762a2c30, 0x1b442545, 0x37361f17, 0x19364d4b, 0x4216351d, 0x7e04f5fe, 0x450382fb, 
-    0x2d2d5c88, 0x44352c83, 0x2e393941, 0x190b221a, 0x732f302d, 0x35364d42, 0x4d4c3636, 0x08008235, 0x31190338, 0x42752d2a, 0x2a2a7447, 0x2d181831, 
-    0x3b1b3517, 0x2c764240, 0x1b87322a, 0x2a43171a, 0x3435364c, 0x4f284418, 0xfe1e1635, 0x71b40190, 0x3bfe52fe, 0x41732e5c, 0x2f847547, 0x1a2e2608, 
-    0x40391936, 0x2e30743f, 0x3536872e, 0x36364d4d, 0x4e4f3535, 0x00003535, 0x00580001, 0x05790400, 0x00070004, 0x05cd4d3c, 0x14821120, 0x02720125, 
-    0x18000001, 0x1808ee97, 0x0819d897, 0x1111b624, 0x08041011, 0x21372b18, 0x21033313, 0x01582115, 0x01a801bc, 0xdffbbd01, 0xfb5a04aa, 0x0000aaa6, 
-    0x03820700, 0xd104003e, 0x17009805, 0x2d002900, 0x5d004500, 0x8d007500, 0x0a40af00, 0x0302012b, 0x0509012d, 0x41071e66, 0x0d2308e9, 0x420c0201, 
-    0x07350513, 0x010b0501, 0x09050809, 0x100a1163, 0x04080803, 0x0e060f5b, 0x06194203, 0x19423520, 0x232f9807, 0x57080404, 0x3608388c, 0x594f0408, 
-    0x76773340, 0x46475e5f, 0x18192e2f, 0x81830001, 0x8d778d76, 0x755e696b, 0x5153755f, 0x5d475d46, 0x452e393b, 0x1f21452f, 0x29192918, 0x17000b0d, 
-    0x42121701, 0x16211031, 0x051c6417, 0x27010e23, 0x0bfc4132, 0x03241783, 0x01091701, 0x2412cd43, 0x010e0706, 0x20179621, 0x0a065225, 0x45050f44, 
-    0x6c4e054d, 0x27262107, 0x2006c672, 0x08178501, 0x3f1f0135, 0x29292668, 0x6926272c, 0x29693a3c, 0x272b2f24, 0x453d6827, 0x31313031, 0x31304544, 
-    0x3817171a, 0x271404d6, 0x0101eafb, 0x2925683e, 0x2a2a2928, 0x823f3966, 0x2a2a2909, 0x02692628, 0x28683c2a, 0x26253d82, 0x3e3b6829, 0x0847826a, 
-    0x25282a3e, 0x2358fd69, 0x1b16163d, 0x3d141819, 0x173c2025, 0x16191c14, 0x8b023b17, 0x18153d25, 0x14191817, 0x3d24243d, 0x161a1615, 0x033c171a, 
-    0x2a272d58, 0x6a3d3a68, 0x292c2627, 0x41692429, 0x28274d82, 0x30317b2c, 0x82314445, 0x26453a81, 0x1a171738, 0x9f01c5fe, 0xfd60fe60, 0x2a262dc9, 
-    0x673c3b69, 0x2d28292a, 0x266f8225, 0x2629693b, 0x82292b2e, 0x673f293f, 0x2d2a2926, 0x39692926, 0x79311384, 0x3d16161b, 0x183e2123, 0x17181c14, 
-    0x23263e14, 0x3345823c, 0x3e19161b, 0x193e201f, 0x151b1c14, 0x1f243d16, 0x1a171a3d, 0x0805b742, 0x79047125, 0x0b009304, 0xb04b8700, 0x40585007, 
-    0x01010315, 0x05000104, 0x00610001, 0x59020505, 0x3c020200, 0x561b4c05, 0x1a2005d0, 0x087ffe18, 0x02282287, 0x00590502, 0x4d050205, 0x15202182, 
-    0x40203e99, 0x5920399a, 0x200d4c60, 0x0bed5801, 0x44fe1435, 0x01a8bc01, 0xa843febd, 0x01aa2d02, 0xaa44febc, 0x510044fe, 0xb783084b, 0xce000f22, 
-    0x1f20b985, 0x4b2ab992, 0x07060600, 0x07070059, 0xc387073a, 0x268a1d20, 0x05000226, 0x61050206, 0xc683248d, 0x35204ba2, 0x4b9eed82, 0x93224021, 
-    0x0ee0586b, 0x0b21fe83, 0x24008511, 0x1c080810, 0x0b00412b, 0x15210524, 0x04410221, 0xfe22080a, 0xfb210444, 0xaaa002df, 0xb7fe4901, 0xaab4feaa, 
-    0x000100aa, 0x044cfe98, 0x00ee0539, 0x4b340007, 0x934d28b0, 0x05f06107, 0x01258082, 0x1b4c013e, 0x078e4d40, 0x11866120, 0x09057818, 0x11211324, 
-    0x03821123, 0xa103982f, 0x9b95fd9b, 0x5ef8ee05, 0xe2f81e07, 0x2c008200, 0x00580001, 0x047904a3, 0x001a005f, 0x05f84849, 0x03001328, 0x03000104, 
-    0x23675f00, 0x023c2107, 0x19205d82, 0x180ac456, 0x3b0db661, 0x010f4059, 0x0e161800, 0x00090b0c, 0x0519011a, 0x252b1408, 0x35022e22, 0x33023e34, 
-    0x2205b256, 0x841e1415, 0x3602350a, 0x4a81ae65, 0x64ae814a, 0xbcfd4402, 0x33587745, 0x44775933, 0xbd220b82, 0x14824ba3, 0x81af6328, 0x5934964b, 
-    0x19834478, 0x82009621, 0x229b8770, 0x853e0019, 0x8212209b, 0x000328b2, 0x01005f03, 0x825b0201, 0x833c209f, 0x001822f8, 0x262b8202, 0x00630102, 
-    0x18030300, 0x2b0cc75b, 0x282128b6, 0x18080420, 0x3221132b, 0x3c05c26a, 0x21352123, 0x15021e32, 0x23020e14, 0x44025821, 0x33597744, 0x45775833, 
-    0x4402bcfd, 0x259c8464, 0xbdfd64af, 0x13833901, 0x59784428, 0x814b9634, 0x188263af, 0x78824b20, 0xba000237, 0x1604fa00, 0x2500f003, 0x47003700, 
-    0x21294440, 0x04040d14, 0x066d5303, 0x0104032c, 0x06096303, 0x00000402, 0x07835704, 0x00042208, 0x0208055b, 0x4f000400, 0x00012627, 0x37262d2f, 
-    0x1c1d3727, 0x11121a1b, 0x090b0f10, 0x25012500, 0x0b2b410a, 0x1716322d, 0x1533013e, 0x1e070622, 0x82161703, 0x022e2608, 0x27030e27, 0x07575332, 
-    0xb5820e20, 0x021e7c08, 0x6c3fdf01, 0x4c292c4e, 0x895c426c, 0x5b932e38, 0x102e6739, 0x0a16191d, 0x4628392f, 0x20274544, 0x394b443f, 0x1e2b6945, 
-    0x3c2e1632, 0x182a3c24, 0xfa392815, 0x578e6538, 0x36628953, 0x7e768173, 0x297d748c, 0x0b1f2c3b, 0x36178d32, 0x573c4258, 0x7d8d1b39, 0x17594877, 
-    0x5a402231, 0x3e553538, 0x01000021, 0xd9ff3b00, 0xa006a004, 0x41000a00, 0x03040940, 0x02040102, 0x504a0101, 0x0e21050e, 0x24218200, 0x61010002, 
-    0x06c94d00, 0x02001525, 0x54730201, 0xb52c10cc, 0x03151111, 0x012b1708, 0x13252707, 0x233cd782, 0x02012301, 0x2301299e, 0x94d301db, 0x7f06fe2f, 
-    0x7d351203, 0x0525fd62, 0xbcf983bf, 0x2707ef43, 0x19000005, 0x5e001d00, 0x28105759, 0x04000106, 0x00630003, 0x053e6404, 0x4c053a22, 0x2506cd7a, 
-    0x63020103, 0x1e880300, 0x04050523, 0x2b248655, 0x594d0504, 0x00011340, 0x1a1b1c1d, 0x27069e42, 0x07190119, 0x012b1408, 0x23149e42, 0x21152105, 
-    0x5c17a142, 0x0121054a, 0x11a64244, 0x8eaa9a21, 0x855220bb, 0x421b20bb, 0x00240994, 0x03000403, 0x2020ba8d, 0xb98f1d91, 0x11110929, 0x20282128, 
-    0x421a0806, 0x152016bd, 0xc142af82, 0x21042518, 0xda01dffb, 0x8210c542, 0x500020ad, 0x01231603, 0x41670201, 0x1b210fc4, 0x19dc4140, 0x8205b14f, 
-    0x23112d83, 0xfc210458, 0x5e03a887, 0x00c1feac, 0x26080082, 0x01580001, 0x037904f1, 0x001e0012, 0x00314034, 0x0d000101, 0x02030201, 0x00010c4a, 
-    0x02011e48, 0x03010047, 0x82570102, 0x06205e29, 0x5b02012f, 0x02010200, 0x2425294f, 0x18080422, 0xe670182b, 0xe270181b, 0x9f02211d, 0x15de7018, 
-    0x5b010021, 0x78200adb, 0x5805a44f, 0xc0780cdb, 0x00002306, 0xdb585b05, 0x50352408, 0x581b4058, 0x632006be, 0x8a080859, 0x08dc5822, 0x05221d8a, 
-    0x6b180005, 0x593d0a0d, 0x2d094059, 0x17112621, 0x1a080620, 0x3221372b, 0x3e37023e, 0x35213701, 0x27032e21, 0x068c4426, 0x1e172b08, 0x0e141501, 
-    0x23060702, 0xd8018221, 0x3b4a552f, 0x04170d15, 0x1e03e2fc, 0x38271704, 0xfe594d26, 0x44d80128, 0x215e7080, 0x974f2122, 0xfe310805, 0x4b29aa28, 
-    0x67263e66, 0x6e33aa38, 0x4b26606b, 0x875e33aa, 0x61b75554, 0x88a4bb65, 0x00006231, 0x8f000100, 0x3d044cfe, 0x0b00ee05, 0x0f404d00, 0x05435002, 
-    0x00010227, 0x03020301, 0x0544464a, 0xec511520, 0x39003006, 0x0202004b, 0x03005903, 0x4c033e03, 0x4313401b, 0x15870ae1, 0x11b65932, 0x04131112, 
-    0x132b1808, 0x21350109, 0x01092115, 0x8f3d0482, 0xdbfd2502, 0x23fd9a03, 0xf6fd0a02, 0x52fcf102, 0x9703a8fe, 0x8c5f5003, 0x96fcddfc, 0x29468289, 
-    0xbb000300, 0x19048600, 0x87828404, 0x23001724, 0xc7455e00, 0x05172605, 0x04080301, 0x208b8207, 0x09565f02, 0x82004421, 0x001e297c, 0x00010601, 
-    0x63000103, 0x95822282, 0x06825720, 0x5b020322, 0x4f212c86, 0x24571859, 0x22213435, 0x3b34013d, 0x011d3201, 0x06022314, 0x1ec01e1e, 0x8413fe1e, 
-    0xa2012106, 0x03240684, 0x1ef51e53, 0xfd210282, 0x85078533, 0x0b934b05, 0x26001337, 0x6c002a00, 0x94008000, 0xc100a800, 0x01280a40, 0x012a0302, 
-    0x08934b0b, 0x634b3120, 0x11220807, 0x01100201, 0x00020500, 0x02060763, 0x020d0f05, 0x0b050a0b, 0x140e1563, 0x0a05130c, 0x095b040a, 0x974b1208, 
-    0xa43b2007, 0x04042333, 0x3e8e570a, 0x040a3e08, 0x3b40594f, 0x81829596, 0x2b2c6d6e, 0x00011415, 0xa8959ea0, 0x8a8ca896, 0x94829481, 0x806d7678, 
-    0x6264806e, 0x4c4e5658, 0x34363f41, 0x6c2c6c2b, 0x26141d1f, 0x090b2615, 0x13011300, 0x0b044516, 0x20060e47, 0xfbcf1827, 0x06072a08, 0x021e1415, 
-    0x01170103, 0x07284513, 0xfe593220, 0x021e210a, 0x9f4f0c83, 0x06494705, 0x27262225, 0x6627012e, 0x0a8606d5, 0x50890620, 0x4705b946, 0x22200882, 
-    0x01290f95, 0x4e683c1e, 0x694e2c2c, 0x0807863c, 0x3d223b4b, 0x2e1a1a2d, 0x3043233d, 0x3c2d1a31, 0x271404d9, 0x33a7eafb, 0x24244157, 0x62335841, 
-    0x07040845, 0x23050905, 0x301f3655, 0x05102027, 0x0a090806, 0x33335422, 0x25254158, 0x34335941, 0x08062252, 0x060a0305, 0x67374d23, 0x3d2b8546, 
-    0x331c6347, 0x25161626, 0x311d1d33, 0x25151525, 0x1d970132, 0x16152632, 0x1d1c3326, 0x18832532, 0x03221090, 0x91832d58, 0x2d4e6924, 0x99824d2d, 
-    0x2d4e6a23, 0x288b827b, 0x2e3c2222, 0x4431301b, 0x4ba18223, 0x2c3b08be, 0x3d3d694d, 0x532c4e69, 0x07090809, 0x292a060d, 0x101e170e, 0x0e0b0905, 
-    0x822c270b, 0x3c3c211b, 0x2d2a3c82, 0x070b0727, 0x28070c06, 0x2583542c, 0x54070c26, 0x3d2d1b79, 0x1a234e84, 0x83233d2d, 0x825e824f, 0x1a2e2107, 
-    0x29080f97, 0x1c010100, 0xb603db02, 0x0b002c05, 0xb04b4500, 0x40585017, 0x00020014, 0x5d050205, 0x00000104, 0x01035901, 0x003c0101, 0x934b1b4c, 
-    0x0b1b5e1c, 0x35210127, 0x15333521, 0x34018221, 0xfe340223, 0x6a1801e8, 0xe8fe1801, 0x5fd4036a, 0xf95ff9f9, 0x2b548200, 0xd4031c01, 0x3304b603, 
-    0x2d000300, 0x0a9b8c18, 0x1b825920, 0x2617da67, 0x08021011, 0x82012b16, 0x27b08255, 0x0466fd9a, 0x02005f33, 0x61204782, 0xa5204782, 0x83272f5f, 
-    0x2096823e, 0x20428521, 0x23468302, 0x60855fa5, 0x002f7682, 0x001c0101, 0x02b6033f, 0x000b0090, 0x4c234026, 0x045f19b9, 0x21e89709, 0xe8863801, 
-    0x01255382, 0x01b60338, 0x1b675697, 0x0123d289, 0x82005f97, 0x001c2277, 0x208782c5, 0x21d3b909, 0xd3870902, 0x004a003e, 0x05870400, 0x002f00b4, 
-    0x192db56e, 0x49010002, 0x5020b04b, 0x00174058, 0x5b010404, 0x3929f482, 0x0001024b, 0x05590300, 0x63a81801, 0x82352007, 0x0015281e, 0x00040001, 
-    0x8d630401, 0x1b40211c, 0x0323178a, 0x88550003, 0x0300381e, 0x4059594d, 0x112a1a09, 0x06102919, 0x372b1a08, 0x35032e33, 0x18023e34, 0x240859ae, 
-    0x35211533, 0x2112823e, 0xb354022e, 0x1e540805, 0x21151702, 0x583cf54a, 0x8a4b1c39, 0xc47978c4, 0x391b4b8a, 0xfef83d59, 0x425e3a31, 0x7b572f24, 
-    0x577b4d4d, 0x5e41212e, 0xac31fe3e, 0xa4938841, 0xb1fd9e5e, 0xfcb15f5e, 0x95a25c9e, 0xacac4289, 0xc0a07a24, 0x81bd796a, 0xbc814343, 0xa2bd6679, 
-    0x00ac267e, 0x012c0082, 0xe3ff7500, 0xf0055c04, 0x99002900, 0x2f053d49, 0x03020025, 0x05020305, 0x04050070, 0x6e040503, 0x09f6aa18, 0x04040022, 
-    0x0b194518, 0x58503a23, 0x6dba1840, 0x242c8609, 0x00010604, 0xc7aa1804, 0x8f28200e, 0x00012551, 0x03010203, 0x200a1a6a, 0x2035845b, 0x05835d4f, 
-    0x22232008, 0x15171b1d, 0x07090f10, 0x29012900, 0x2b140807, 0x26272205, 0x00103502, 0x041e3221, 0x5d2e2317, 0x4e08065d, 0x33121011, 0x3e373632, 
-    0x0e333701, 0xfe7c0205, 0x01404584, 0x54010107, 0x33486382, 0x09ca0a21, 0x77230c18, 0x9d9d9b53, 0x2377539b, 0xca09170d, 0x4834220b, 0xc61d8164, 
-    0xb91e0167, 0x8e017b01, 0x62594428, 0x43252d65, 0xfe514818, 0x82cbfece, 0xce210801, 0x411a4851, 0x62673025, 0x00264257, 0xb2000300, 0x1d04a2ff, 
-    0x13003506, 0x1b001700, 0xb04b3601, 0x2bf2821c, 0x00090030, 0x0e670900, 0x0c03020b, 0x38053257, 0x3b060600, 0x04010a4b, 0x07590504, 0x39050501, 
-    0x020d0f4b, 0x59000101, 0x08a96408, 0x37822020, 0x37822f20, 0xac730921, 0x84352036, 0x05062336, 0x3b8f7206, 0x3a206d9c, 0x2d213682, 0x83369300, 
-    0x23958298, 0x61000109, 0x0424418a, 0x34401b4c, 0xc3822f89, 0x03231c82, 0x8a620405, 0x233983ac, 0x55010000, 0x0123da89, 0x82594d00, 0x1e403400, 
-    0x14141818, 0x1b181b18, 0x1714191a, 0x15161714, 0x86111213, 0x10102c00, 0x212b1d08, 0x13333523, 0x83213521, 0x372d0803, 0x11330733, 0x01230721, 
-    0x13032311, 0x01032111, 0x8b8a5a0c, 0x4401ebfe, 0x0132fe8a, 0x1c9b1bfe, 0x1b8afdd3, 0x4b74029a, 0xfbfed58a, 0x0677628a, 0xfa606031, 0x9e035e2b, 
-    0x15feeb01, 0xec016afd, 0x820014fe, 0x82002b88, 0x4e04a500, 0x22005d04, 0xd7485d00, 0x001b2105, 0x22080166, 0x18000106, 0x200aadd0, 0x7e47183c, 
-    0x05b04c08, 0x05040025, 0x18610403, 0x2210fc75, 0x18134059, 0x2709ffb5, 0x22000e10, 0x08072101, 0x20054f4f, 0x0f076627, 0x21152125, 0x8233031e, 
-    0x02200805, 0x6f7f4576, 0x2023215d, 0x395c4123, 0xd8018873, 0x6b4228fe, 0x030b3350, 0x0bedfc13, 0x426b5033, 0xa5391183, 0x37583d21, 0x423c773a, 
-    0x1f586b7b, 0x402aaa3f, 0x24aa244f, 0xaa2a404f, 0x5ab28200, 0x283a09db, 0xb2003300, 0x10131540, 0x27050402, 0x04030209, 0x11124a02, 0x21480502, 
-    0xdb5a0001, 0x0a232506, 0x09030207, 0x2b067442, 0x5b050404, 0x39050500, 0x02080b4b, 0x0dc35818, 0x58503524, 0xdf822140, 0x05030424, 0x328a6304, 
-    0x4021288e, 0x23239628, 0x57010000, 0x01382b89, 0x59594f00, 0x292a1840, 0x31322222, 0x332a3329, 0x28222822, 0x1122212f, 0x0c250082, 0x172b1b08, 
-    0x07e04137, 0x2305544b, 0x07173717, 0x2b05837a, 0x012b0607, 0x032e0107, 0x32010b27, 0x37067c4b, 0x7b27d603, 0xc0fe92ae, 0x13917201, 0x0128fe18, 
-    0x392d2fd8, 0x603c43a3, 0x0807f55a, 0x0236ab44, 0x22160427, 0x4d721d2e, 0x3d49552d, 0x04170d16, 0x7f91d3fe, 0xdd01aa7f, 0x04d901aa, 0x31bd0caa, 
-    0xa58932dd, 0xba6364bc, 0x623188a3, 0x33e203b1, 0x23586168, 0x79fd89fe, 0x40684927, 0xfe386726, 0x1f420023, 0x0020220c, 0x051f4251, 0x2a0e2a65, 
-    0x0303005f, 0x04005b04, 0x65033c04, 0x4d4c0a2a, 0x09402619, 0x1124212c, 0x09144e14, 0x4c05494c, 0x16200747, 0x2d0a464c, 0x33506b43, 0x03edfc0b, 
-    0x50330b13, 0xe583436b, 0x6f7f452b, 0x2143215d, 0x733b5d40, 0x200f8288, 0x0902424f, 0x573e212b, 0x407f6e37, 0x215a6a79, 0x26b78440, 0x030000fa, 
-    0x470405d7, 0x352305eb, 0x64405850, 0x103121b9, 0x2b160802, 0x21112113, 0xfddd02fa, 0xfa040523, 0x0cb752fc, 0x724c3620, 0x02112905, 0x39000001, 
-    0x0101004b, 0x83096e4c, 0x00012213, 0x52138a72, 0x33230ab9, 0x82112111, 0x9b982e03, 0xfc9b6b02, 0xf8ee055f, 0xf81e07e2, 0x0b1f545e, 0x54000321, 
-    0x0529091f, 0x01060301, 0x02030702, 0x214d8261, 0xcb825900, 0x004b3c24, 0x1f540404, 0x2417820f, 0x01000401, 0x8c2e8a61, 0x82152024, 0xa11f20f1, 
-    0x8235204b, 0x9d1d2026, 0x2240214b, 0x00251f87, 0x04070304, 0x21719055, 0xc0440704, 0x0c1f5405, 0x75211321, 0x126e056d, 0x04582607, 0x01dffb21, 
-    0x092955bc, 0xaa93043e, 0x01aa60fd, 0xaab4fe4c, 0x0200b7fe, 0x47012b01, 0xc203a603, 0x28001400, 0x2e403100, 0x301aff6f, 0x00011516, 0x28151e20, 
-    0x090b2816, 0x14011400, 0x0c094c06, 0x2105ab57, 0xba4b020e, 0x0235080f, 0x54734365, 0x74563130, 0x2d724243, 0x56322c30, 0x46284276, 0x341e1e35, 
-    0x45272846, 0x331d1e33, 0x30470145, 0x44437354, 0x31315775, 0x3e71302e, 0x30567344, 0x2d16827f, 0x34462727, 0x47331e1e, 0x32442828, 0x0082001d, 
-    0x5b520220, 0x76073705, 0x37002c00, 0x1d40d400, 0x0504011b, 0x0406011a, 0x03020126, 0x04820104, 0x0100012b, 0x2e2f3031, 0x06000804, 0x0571524a, 
-    0x4e182d20, 0x6e440804, 0x4b3f2c06, 0x03020200, 0x0303005b, 0x6d094b3b, 0x44220794, 0x5718004b, 0x3e290777, 0x2d405850, 0x08000800, 0x5c39a573, 
-    0x2f8c05c0, 0x57820120, 0x52010821, 0x5b230570, 0x8a050500, 0x022c0872, 0x4059594c, 0x37000119, 0x33343536, 0x191d1f32, 0x10111317, 0x0006080e, 
-    0x0a2c012c, 0x012b1408, 0x35272622, 0x3233011e, 0x3435023e, 0x08b3c718, 0x22232625, 0x823e3507, 0x021e2b15, 0x07061415, 0x0e141516, 0x1a530302, 
-    0x9922080a, 0x463c7042, 0x4f2f356e, 0x6e6d1f38, 0x615e4a42, 0x7864535f, 0x47367445, 0x572c5172, 0x5d31c155, 0x3c53eb86, 0x0424080b, 0x79141513, 
-    0x27141a1b, 0x4c45253a, 0x3a3a3f6c, 0x11792f3f, 0x50391f12, 0x135c4732, 0x5e3ca92c, 0xfffe2242, 0x200a5f53, 0x06774103, 0x0a00653a, 0x18000d00, 
-    0x11408000, 0x0106010c, 0x07020102, 0x0f101112, 0x03040804, 0x31066d41, 0x00040026, 0x08040008, 0x00060070, 0x07060207, 0xaf180961, 0x3f200cc4, 
-    0x21076641, 0x28882540, 0x71080822, 0x01282c96, 0x1440594c, 0x17180b0b, 0x132aef82, 0x0d0b0d0b, 0x12111111, 0xaf180a10, 0x15250bb1, 0x01011923, 
-    0x0a094113, 0x7dfef42b, 0x74a26b01, 0xeefe8a74, 0x2ff28c20, 0x100279dc, 0xba6fe6fd, 0x9d012901, 0xc7fd63fe, 0x003ade8a, 0xfe120201, 0x06be021d, 
-    0x0003001d, 0x00104013, 0x4b3b0000, 0x40010100, 0x854c4c01, 0x11332906, 0xac120223, 0xf81d06ac, 0x23081b82, 0x00020000, 0x047cfe3f, 0x00050791, 
-    0x00470023, 0x39134076, 0x02030215, 0x0416283a, 0x27030104, 0x01000203, 0x3c070f41, 0x02010619, 0x01030107, 0x05630302, 0x00010101, 0x0804095b, 
-    0x3e000003, 0x401b4c00, 0x231b8c1f, 0x57010000, 0x2608228a, 0x594f0001, 0x24251b40, 0x3c3d0001, 0x2a2b3537, 0x47254724, 0x11131819, 0x23000607, 
-    0x080a2301, 0x22132b14, 0x42372726, 0x13340629, 0x33023e34, 0x07171632, 0x2223012e, 0x1115020e, 0x21020e14, 0x11201f8a, 0x03201f8e, 0xfa301f82, 
-    0x432d6628, 0x1314311c, 0x010b151e, 0x3c5b3c1f, 0x192b0f83, 0x1e121631, 0x3d1f0c17, 0x8573015a, 0x8315201f, 0x890f821f, 0x0c16211e, 0xfe302e83, 
-    0x7f1d1c7c, 0x2812130f, 0x22062f41, 0x38566831, 0x0e2b0e82, 0x42271114, 0x31def930, 0x8b375669, 0x880e851d, 0x082c821d, 0x0300003f, 0x97fe3500, 
-    0xea069d04, 0x3f001f00, 0x66005f00, 0x33536340, 0x02030313, 0x24344454, 0x01060414, 0x03234303, 0x03010003, 0x02060a4a, 0x02070b02, 0x03020103, 
-    0x02050963, 0x01000001, 0x08078357, 0x5b000131, 0x040d080e, 0x0100050c, 0x40414f00, 0x00012021, 0x4f515658, 0x5f404648, 0x36385f41, 0x26282f31, 
-    0x3f213f20, 0x0f111618, 0x1f000608, 0x410f1f01, 0x36210b35, 0x0c144135, 0x33410620, 0x2d1db20d, 0x243920b2, 0x0c2f1024, 0x32181014, 0x0c83374e, 
-    0x0b2e1229, 0x32171015, 0x8b0e014e, 0x871a840d, 0x0d012127, 0xfe2e1a98, 0x8e0e0e97, 0x2f1f0707, 0x62375d06, 0x0c822a49, 0x1f060828, 0x38a3f92f, 
-    0x0c874862, 0x26831988, 0x0029199f, 0x00030000, 0x048600bc, 0x084f5315, 0x3d06774a, 0x08050017, 0x04050401, 0x0602075f, 0x01000003, 0x0101035b, 
-    0x4c004401, 0x031d401b, 0x14840101, 0x00010522, 0x11136b18, 0x201e4e53, 0x0a365313, 0x710b4253, 0xda270baa, 0x1ec01e1e, 0x849d011e, 0x06545306, 
-    0x53074d53, 0xbe820d53, 0x01020027, 0x028600e8, 0x20bf86e8, 0x0515494f, 0x03001422, 0x0ea39d18, 0x1a24ba84, 0x01040100, 0x18a39d18, 0x2ce26718, 
-    0x2005f253, 0x14ea53bc, 0x54040021, 0x2f220ea3, 0x97856c00, 0x01071a2c, 0x0a060b05, 0x04050403, 0xb619095f, 0x9d840a30, 0x01032123, 0x23148401, 
-    0x63000105, 0x04232882, 0x82570504, 0x04052206, 0x2732865b, 0x2340594f, 0x18192425, 0x2b29a883, 0x252f2428, 0x181c1f2e, 0x119d1823, 0x080c230d, 
-    0x64412b14, 0x0b7c4123, 0x210c7041, 0xc554e2fc, 0x0d774113, 0x00220d85, 0x43670200, 0x84042505, 0x0f000b00, 0x2409ed5b, 0x02030002, 0x05395203, 
-    0x42005b21, 0x19260635, 0x01040100, 0xd9820200, 0x1006b818, 0x010f4023, 0x09c87300, 0x5505556b, 0x0525095c, 0x02211521, 0x25938409, 0x21048ffd, 
-    0x0a42dffb, 0xaa7c2907, 0x4a000300, 0x87048600, 0x1b227f86, 0x65416300, 0x19677505, 0x20286b74, 0x34647440, 0x84a90321, 0xe1fb27a7, 0x16fdea02, 
-    0x1c425d03, 0xaa7c230c, 0x374159fe, 0x00052207, 0x20b78257, 0x28b7847d, 0x001b0017, 0x00330027, 0x36bb8580, 0x00040022, 0x05040705, 0x07010961, 
-    0x030c080d, 0x5f060706, 0x430a020b, 0x29230d82, 0x84010103, 0x01042314, 0x308a6300, 0x09b59818, 0x4f3b3a86, 0x29274059, 0x0d1c1d28, 0x2f00010c, 
-    0x2933282c, 0x1c202332, 0x1b261d27, 0x1818191a, 0x200bcd6a, 0x1a35420e, 0x15210523, 0x17514221, 0xe2847620, 0x84650221, 0xfdfb2606, 0xdffb2104, 
-    0x210b841d, 0xfc8c6a02, 0x0241f885, 0x080f8509, 0x00030024, 0x04860058, 0x00840479, 0x002a000b, 0x408b0036, 0x03010c12, 0x04011902, 0x184a0205, 
-    0x012a0201, 0x435e0204, 0x00242806, 0x04050002, 0x82630502, 0x07042d34, 0x00630403, 0x06010907, 0x085f0607, 0x2608ae49, 0x401b4c00, 0x8201002a, 
-    0x05664210, 0x06282f8f, 0x00570706, 0x5b060707, 0x4f3b3884, 0x2c1b4059, 0x3200012b, 0x2c362b2f, 0x1d262835, 0x1014161b, 0x0004070e, 0x490a010b, 
-    0x83420574, 0x183e200a, 0x4419258b, 0xa7420bb9, 0x358b1808, 0x41b0201d, 0xb4200c1b, 0x2115605a, 0xa21895fe, 0x002008f6, 0x2509ff5a, 0x403d0020, 
-    0xd54a103a, 0x02033f05, 0x0201044a, 0x00011148, 0x03010047, 0x00570100, 0x00030002, 0x00630302, 0x5b000101, 0x36820104, 0x00014f2c, 0x0c0e1315, 
-    0x20000608, 0x59432001, 0x064a4a05, 0x84013f21, 0x151721d3, 0x20051d48, 0x05cf6f07, 0x4b7d3908, 0x884b4b8f, 0x20745e45, 0x51307244, 0x8c4c4e92, 
-    0x34361f51, 0x090b2238, 0x36060403, 0x36f10160, 0x3c3faf3c, 0x16200f36, 0x42ae3c37, 0x150f0839, 0x0203050e, 0x1c170301, 0x582f6c82, 0x7904ae00, 
-    0x20004704, 0x38403b00, 0x820a1013, 0x191f2318, 0x92820301, 0x12184a2b, 0x48010311, 0x03020920, 0x21a48347, 0x2e825702, 0x4b058745, 0x022c0576, 
-    0x26254f03, 0x08042525, 0x13252b18, 0x2007f471, 0x22a18535, 0x18031713, 0x08072844, 0x26222342, 0xc0010327, 0x0b181158, 0x8d4f3235, 0x51914e49, 
-    0x4e1d5e39, 0x4a575388, 0x454b8846, 0x592e4f90, 0x01cd5333, 0x02080683, 0xae403b0c, 0x0c16373c, 0xfe1f5701, 0x3f3c2291, 0x153b37af, 0x0094fe14, 
-    0xd37f7e82, 0x00a22205, 0x33a98203, 0x043c403f, 0x13020301, 0x02050401, 0x0201124a, 0x01204901, 0x002cc282, 0x00020100, 0x03006101, 0x57030405, 
-    0x2d097942, 0x005b0403, 0x4f040304, 0x23262525, 0x485d1011, 0x21152205, 0x7fa78511, 0x1522078e, 0xa782010e, 0x64012f21, 0x37080534, 0xfb210458, 
-    0x4d934edf, 0x01426e37, 0x30613d21, 0x464b8948, 0x64334e90, 0x6d512139, 0x4a8b5128, 0xfeaaa203, 0x1b373ee7, 0x1b1c0f1c, 0x38b0403d, 0x0f1a193b, 
-    0x413c1625, 0x6024a784, 0xc3037904, 0x60e78d18, 0x15211523, 0x1d045d21, 0x0321c383, 0x15a74250, 0xac963b08, 0x00010000, 0x04630058, 0x00d5047a, 
-    0x404a0032, 0x101c1f47, 0x2d030403, 0x04050f25, 0x4a020205, 0x031d1e24, 0x01324803, 0x03004700, 0x03050200, 0x04006302, 0x04010500, 0x956b6305, 
-    0x27132513, 0x11232b2a, 0x290a956b, 0x2223012e, 0x07030e07, 0xc77b3e35, 0x42022005, 0x03250910, 0x27262223, 0x08be8207, 0x59e8075f, 0x925101e9, 
-    0x4c32612c, 0x29291240, 0x542a0f25, 0x1a214b50, 0x2337322e, 0x71c61d0d, 0x512022a7, 0x4d1b3a8c, 0x1f225354, 0x026e2f3c, 0x9878fd2a, 0xe7ab9ac7, 
-    0x081b1614, 0x0e1c1a15, 0x1b2e24ac, 0x130c060a, 0x0110050d, 0xe0fe6458, 0xb2374406, 0x111e2b1a, 0xabb20f0f, 0x000000fe, 0x21df8202, 0xcb7c0431, 
-    0x00373205, 0x001c4091, 0x12000101, 0x2e030201, 0x0207022d, 0x09ce7c03, 0x04013723, 0x05d27c47, 0x01002636, 0x01070200, 0x01086302, 0x06010907, 
-    0x61060705, 0x0b05010a, 0x0424f582, 0x0303005d, 0x2009d67c, 0x09b55e2d, 0x04233092, 0x82550504, 0x04052237, 0x373a8459, 0x1240594d, 0x33343536, 
-    0x11133132, 0x29141111, 0x0c342625, 0x132b1d08, 0x7c061a41, 0x132215e2, 0xdc6c2337, 0x6c372005, 0x072108dc, 0x21ee7c58, 0xf92ccd36, 0xfe8b7501, 
-    0x687b0200, 0xfef92c71, 0x00028b8b, 0x046784fd, 0x271bfc7c, 0xac3d15fd, 0x528facc0, 0xd7820584, 0x0807e368, 0x38002e31, 0x1a408f00, 0x0602141f, 
-    0x02092905, 0x01130407, 0x4a030703, 0x03202128, 0x01384805, 0xb04b4700, 0x40585033, 0x00060026, 0x07060307, 0x54010863, 0x0a29070f, 0x010b0101, 
-    0x5d000100, 0x06a94f00, 0x966a4420, 0x00052605, 0x04050704, 0x23309463, 0x55010000, 0x01223782, 0x3a845900, 0x40594d23, 0x05594f12, 0x48351224, 
-    0xe0532727, 0x2b1d2405, 0x41213725, 0x26260615, 0x23032e27, 0x60420622, 0x37012908, 0x32160717, 0x37363233, 0x4205ca43, 0x63080561, 0x07211521, 
-    0xfe323601, 0x454d01f0, 0xd0016efe, 0x2706094b, 0x1830363f, 0x27498d52, 0x2c4f4b4a, 0x3d353118, 0x9b563a25, 0x060c0551, 0x4b4b8846, 0x1f124d8f, 
-    0xa1013811, 0x024521fe, 0x469ffd24, 0xc0ac8937, 0x0204d1ac, 0x050e1611, 0x1eae403b, 0x050d1d2b, 0x1910150c, 0x01e138ee, 0x3caf3f3c, 0x9c030336, 
-    0xc0212182, 0x08008200, 0x5800013a, 0x79043000, 0x3c00c304, 0x60406300, 0x03151f22, 0x282d0304, 0x0205030e, 0x03070d2e, 0x343b0106, 0x00070301, 
-    0x01144a04, 0x01013305, 0x21274902, 0x48030320, 0x0702063c, 0x32106343, 0x07000600, 0x01005706, 0x01070000, 0x06006300, 0x825b0706, 0x4f073010, 
-    0x28252325, 0x22252527, 0x2b1c0808, 0x41261325, 0x01270500, 0x17163233, 0x85012e37, 0x3303250d, 0x17021e32, 0x82096e43, 0x07272116, 0x080a8b45, 
-    0x03012f6d, 0x32637a01, 0x4b8b4e2f, 0x234e934d, 0x37362340, 0x8d51315b, 0x4b492649, 0x2f192d50, 0x5d273e34, 0x3139618a, 0x484b8846, 0x48444e90, 
-    0x455a7334, 0x90494b89, 0x336a324c, 0x0159621f, 0x423b0b4a, 0x0a383dae, 0x1516b20a, 0x1dae403b, 0x050e1d2b, 0x0110160c, 0xbdfe2937, 0xaf3f3c0f, 
-    0xaf193939, 0xb0403d35, 0x1a19393a, 0x18bcfe10, 0x080a5340, 0x1e009332, 0x3f003b00, 0x21409900, 0x00010100, 0x0302010d, 0x0405011f, 0x0706012e, 
-    0x011e4a04, 0x04012d02, 0x0306013b, 0x00010c49, 0x2ab04b48, 0x2a405850, 0x088f4518, 0xfd820420, 0x63070430, 0x06000500, 0x63060508, 0x09000800, 
-    0x92430908, 0x4330200d, 0x04240b92, 0x00630201, 0x60183490, 0x402f0e33, 0x133e3f0e, 0x25262525, 0x22242529, 0x621d080a, 0x15201c70, 0x451b2f46, 
-    0x4c46218c, 0x2104251a, 0x2004dffb, 0x2015a745, 0x126446c3, 0x00ac952b, 0x58000300, 0x79049500, 0x05534104, 0xbc005824, 0x53413040, 0x013c280f, 
-    0x014b0809, 0x41060b0a, 0x4a2c095b, 0x49040801, 0x4800010c, 0x470a0158, 0x20056241, 0x1a624132, 0x080a0b2b, 0x0900630b, 0x0a090a00, 0x0cfd445f, 
-    0x6a413820, 0x0b092720, 0x0057090a, 0x42860008, 0x5b0a0922, 0x4f2a4583, 0x56124059, 0x484d4f54, 0x76412546, 0x05084507, 0x4119a849, 0x93411d76, 
-    0x1d1c471b, 0x9a1a8f41, 0x2ba6411a, 0xba41be20, 0x18002012, 0x29095f43, 0x00290025, 0x4086002d, 0x174a1513, 0x01162808, 0x04490100, 0x46480201, 
-    0x2326058c, 0x01080100, 0x2c4c0400, 0x04063806, 0x06006105, 0x07060700, 0x0303005d, 0x02005b02, 0x4c034402, 0x4a29401b, 0x2d90093f, 0x360e806a, 
-    0x00011740, 0x2a2b2c2d, 0x26272829, 0x0e11181a, 0x25000608, 0x54092501, 0x36220bab, 0x9546013f, 0x0d624a05, 0xad7e0520, 0x4a012006, 0x482e056a, 
-    0x203c6033, 0x2b36432a, 0x4c4c2812, 0x6f4a2a4d, 0xa2fe220e, 0x06c97604, 0x366e0331, 0x3c3faf3c, 0x120e1a1c, 0x0c030c16, 0x4a202c1b, 0x96240d7e, 
-    0x00acc0ac, 0x2408bf82, 0x04dd0057, 0x00270479, 0x00130009, 0x083e4041, 0x01000202, 0x03020a0e, 0x074a0202, 0x48010203, 0x03020f13, 0x0d8a4e47, 
-    0xfa555720, 0x03022e06, 0x1200014f, 0x060b0d10, 0x01090004, 0x052d4b09, 0x35253808, 0x25321704, 0x24010415, 0x15053233, 0x05222724, 0xfec86902, 
-    0xb95901b6, 0xfe5501ba, 0x0127fdb9, 0x01c8c848, 0xb9a8fe49, 0x02aafeba, 0x9bb29cd9, 0x9cb2a308, 0x849cb6fe, 0x82002009, 0x00022400, 0x82440058, 
-    0x00be2993, 0x00420020, 0x00464049, 0x0809565f, 0x03010540, 0x61030008, 0x0b08010a, 0x08090701, 0x09006107, 0x57090606, 0x06090900, 0x06010c5b, 
-    0x224f0609, 0x393a3b21, 0x2c313338, 0x21292a2b, 0x14422242, 0x27171125, 0x1a080d10, 0x3e33132b, 0xfe553703, 0x1e173605, 0x15331701, 0x27012e21, 
-    0x0e07012e, 0x07060701, 0x2e220121, 0x230d8202, 0x21352327, 0x2006987a, 0x252c8236, 0x23152137, 0x2282030e, 0xe1587c08, 0x391e0b02, 0x2a4b2330, 
-    0x3c495128, 0x05120b13, 0x03aafee1, 0x2b162933, 0x1853361a, 0xa9fe0514, 0x491e1102, 0x0f194449, 0x01e1050f, 0x2a320357, 0x301c3011, 0x0c0b1a55, 
-    0xe1560102, 0x38200d02, 0x0351252c, 0x42330aa2, 0x1b182149, 0x27412f19, 0xa81e3816, 0x14248261, 0x4702010f, 0xfd5b3d48, 0x432a134a, 0x1c331d30, 
-    0x218a5ca8, 0x4a47140e, 0xa831491e, 0x4744360c, 0x181a181d, 0x2908e340, 0x2000be04, 0x30002400, 0x13412d40, 0x0006230d, 0xbe186103, 0x11210f5c, 
-    0x22fa8511, 0x9e1c0808, 0x211523fa, 0xdfa12115, 0xfb210423, 0x39c09bdf, 0x0000aaf0, 0x58000300, 0x79046001, 0x0b001905, 0x13000f00, 0x34403700, 
-    0x44180100, 0x04210aa7, 0x20a88202, 0x0d676904, 0x13000125, 0x50101112, 0x072309cf, 0x4e2b1408, 0x00430b23, 0x0cd35007, 0xe8208d84, 0x2305f04d, 
-    0xacecaa46, 0x07247b82, 0xe9ff5800, 0x03227b84, 0x7f860700, 0x23001724, 0xbf7cf300, 0x37380805, 0x00010102, 0x01077201, 0x09090504, 0x0e036804, 
-    0x060f0002, 0x00040502, 0x01106105, 0x0a080009, 0x00620809, 0x0c0b000a, 0x11610b0a, 0x0d0c0c01, 0x0d0d005b, 0x1b4c0d42, 0x20050e61, 0x233e8a38, 
-    0x70090405, 0x40213fa9, 0x233aae3e, 0x570c0d0d, 0x0c2e8187, 0x59594f0d, 0x18192f40, 0x0c0c1010, 0xbe520000, 0x16173d05, 0x13101415, 0x11121310, 
-    0x0f0c0c0d, 0x0a0b0f0c, 0x0607090a, 0x00010506, 0x03000300, 0x3905ff71, 0x34173515, 0x14033323, 0x32332333, 0x15051535, 0x21113521, 0x32052115, 
-    0x5d41011d, 0x02332506, 0x1efc1e09, 0xde230283, 0x6b92011e, 0x0229055d, 0xc01e1e70, 0x19051e1e, 0x2100821e, 0x0482edfe, 0xaaaa4626, 0x46ac6afe, 
-    0x26056841, 0x00040000, 0x41ecff58, 0x1f220adf, 0x1e417800, 0x50252005, 0x03200b46, 0x5105e641, 0x40500596, 0x42062207, 0x0f6e5006, 0x6e50278e, 
-    0x14152911, 0x181b0001, 0x1e151f14, 0x200d2242, 0x0e7d510a, 0x23450720, 0x0a2c5507, 0x20056951, 0x080f45de, 0xda844320, 0x33420320, 0x8cfe210a, 
-    0xd782d687, 0xd7405720, 0x13fa4287, 0x210b4d52, 0x3b529b03, 0x093f520a, 0x0434d895, 0x2e014a00, 0xd5038704, 0x0f000b00, 0x1f001b00, 0x45404800, 
-    0x2506b546, 0x08010061, 0x93560001, 0x04063e05, 0x06005705, 0x06040700, 0x05006107, 0x095b0405, 0x04050401, 0x0110114f, 0x1d1e1f00, 0x3b48181c, 
-    0x0f7f410f, 0x48183720, 0x0f830e3b, 0x1e1e682c, 0x6a1e1eb0, 0xfbfc0503, 0x0b89e6fe, 0x1ec50224, 0x02821ed4, 0xfeaadd23, 0x23098536, 0x0000acde, 
-    0x4f41a7da, 0x8e25200b, 0x210f83a7, 0x9c84b903, 0x83e1fb21, 0x6f0321a9, 0xaa950c8a, 0x3b086750, 0x001300a2, 0x4033001f, 0x06020030, 0x00010203, 
-    0x08610102, 0x00030407, 0x55000505, 0x20080884, 0x00590500, 0x4d050005, 0x1f141414, 0x11171f14, 0x14111116, 0x1b080910, 0x2621132b, 0x21373435, 
-    0x758d8235, 0x08820598, 0x3e254208, 0x26343501, 0x15062327, 0x01581714, 0xfe1b193e, 0xfe2104c0, 0x0b0d0dc9, 0xfb380110, 0x1a5d02df, 0x8f1a1a19, 
-    0x0a023334, 0x3b3d3a3e, 0x400ca8a8, 0x26382026, 0x3e18aaaa, 0x1a3f2120, 0x30484830, 0x20008200, 0x057f4504, 0x0015062b, 0x00280014, 0x0030002c, 
-    0x05255573, 0x4c182620, 0x01361128, 0x0101005b, 0x01084b3b, 0x5b020000, 0x02020109, 0x1b4c003c, 0x09822440, 0x04211282, 0x05275502, 0x850dfa48, 
-    0x4c033032, 0x161b4059, 0x30000115, 0x2c2d2e2f, 0x5e292a2b, 0x0a210bcd, 0x0adc6f08, 0xcd5e3220, 0x08d34517, 0x693d6639, 0x4e2d2c4c, 0x6c3c3c69, 
-    0x2d2a2a26, 0x243a6b4f, 0x1b1b2e40, 0x84243f2f, 0x402e2307, 0xc14313fe, 0x2ae83508, 0x3b3a654a, 0x2c2c4c67, 0x38642827, 0x2b4b653b, 0x3c2c1a6f, 
-    0x2705a869, 0x23233d2e, 0xb51a2c3c, 0x20050a46, 0x07874600, 0x09004b3e, 0x11000d00, 0x35403800, 0x01020004, 0x02050900, 0x4a020102, 0x01000000, 
-    0x63010002, 0x09da4718, 0x330d9246, 0x12111111, 0x08062123, 0x36132b1a, 0x15173233, 0x0f062726, 0x29070569, 0xe6e4d1b6, 0xd6dbd6ca, 0x4c185ede, 
-    0xb42808de, 0x97b29797, 0x609f0109, 0x7b867d84, 0x00440629, 0x000a0006, 0x18b3000e, 0x27083b40, 0x40585007, 0x0101021e, 0x01209e82, 0x08135919, 
-    0x05006227, 0x06050600, 0x2693825d, 0x1b4c003b, 0x8208b04b, 0x00232525, 0x72000100, 0x03222a82, 0xcf647201, 0x28278206, 0x55050606, 0x06050500, 
-    0x76308359, 0x509f070c, 0x4ba34020, 0x59595924, 0xf5820a40, 0x1112112e, 0x1b080710, 0x1333012b, 0x23010b23, 0x28075745, 0xe9a21802, 0x95a6ab8f, 
-    0x28f287d6, 0xa6fd4406, 0x56feaa01, 0x0d6f4148, 0x0227f38a, 0x01000201, 0x84b04b4a, 0x067144f3, 0xca897020, 0x0123f284, 0x8a000001, 0x260e82f3, 
-    0x00720002, 0xa0020302, 0x21509ef3, 0x4ba22340, 0x1121f388, 0x24f38612, 0x0333011b, 0x086f4b23, 0xa6952e28, 0xa2e98fab, 0xf48940fe, 0x0156fe25, 
-    0x86a6fdaa, 0x07e741f4, 0x6342a520, 0x40a02706, 0x0708090d, 0xf7830406, 0x00010323, 0x20fb8548, 0x06634216, 0x04006228, 0x05040500, 0xf382015d, 
-    0xe7413920, 0x871e2008, 0x030024a7, 0x82030204, 0x0d874223, 0xb04b1b26, 0x40585015, 0x40204397, 0xf4773e9e, 0x12153007, 0x1a080611, 0x2127012b, 
-    0x0721011b, 0x88072713, 0xdae22de3, 0x55540d01, 0x55da0c01, 0xcafedbdc, 0x0530e887, 0x00019e07, 0xff9e00ff, 0x659f9f00, 0x00acecaa, 0x5828bb82, 
-    0x79046001, 0x0300af06, 0x2206d542, 0x4105b598, 0x052006e1, 0x2126a182, 0x02020000, 0xdf416600, 0x42612006, 0x012a07d2, 0x07590201, 0x3c020201, 
-    0xca824c01, 0x28821c20, 0x28822020, 0xde410020, 0x21279407, 0x22842640, 0x00253682, 0x01020301, 0x42538962, 0x593e0dfe, 0x04134059, 0x0c0d0e04, 
-    0x08090a0b, 0x04060407, 0x08101106, 0x012b1608, 0x25210133, 0x6144010b, 0x65362b08, 0x93fd0401, 0x9697cd01, 0xc94186fe, 0xfdaf2808, 0x86016f69, 
-    0x84e57afe, 0x000024dd, 0x82450007, 0x068c35df, 0x0014001c, 0x003d0028, 0x0051004a, 0x01590055, 0x31b04b63, 0x0f31b582, 0x0412010d, 0x0e02123b, 
-    0x00013c0d, 0x1b4a030e, 0x20118b40, 0x20118203, 0x08288559, 0x080c4145, 0x11010305, 0x04030910, 0x63040112, 0x0012011a, 0x0d120e0d, 0x020f1961, 
-    0x0a0b180e, 0x00051703, 0x63000e13, 0x14001300, 0x61141315, 0x16001500, 0x005d1615, 0x5b020707, 0x02020106, 0x1b4c073b, 0x8250b04b, 0x0c502a71, 
-    0x04050101, 0x01085701, 0x204d8505, 0x214d9005, 0x4b9d0317, 0x010a4b24, 0x57860303, 0x1b4c0324, 0x52825140, 0x04100025, 0x83631001, 0x02092654, 
-    0x04051204, 0xada18e61, 0x593b0853, 0x4b414059, 0x2a3e3f4b, 0x59000129, 0x55565758, 0x4b525354, 0x4f514b51, 0x3e43454d, 0x3a4a3f4a, 0x32353638, 
-    0x2a3d2930, 0x2627283d, 0x20232425, 0x181b1d1e, 0x11151617, 0x640e0f10, 0x1b2305fb, 0x702b1408, 0x200809e1, 0x33351716, 0x0e272311, 0x35230101, 
-    0x36343533, 0x2315013b, 0x011d0622, 0x11231533, 0x26220523, 0x05806135, 0x21011d37, 0x3233011e, 0x25061537, 0x34353632, 0x07222326, 0x16141506, 
-    0x05855325, 0x0807a745, 0x3e27ee43, 0x2c18182c, 0x4127273e, 0x063d4315, 0xb5024115, 0x453e3f3f, 0x1c23403f, 0xfe436d6d, 0x1c7162f3, 0x542c4834, 
-    0x04d0fe5e, 0x4a44454a, 0x35f4fd4a, 0x35353b3b, 0x023c1e1e, 0x36390258, 0xfe054036, 0x087a4626, 0x1ee23d08, 0x30304d38, 0x221f374e, 0xd0fdda25, 
-    0x0122253d, 0x451c336a, 0x251d373c, 0xa0fe3324, 0x31646e0a, 0x681e384e, 0x4745205b, 0x371f3e25, 0x524a4a53, 0x4b482a29, 0x4037c153, 0xc9fe3741, 
-    0x44056442, 0x3808072f, 0x00210014, 0x00290025, 0x0208b6aa, 0x01040302, 0x27b04b4a, 0x2b405850, 0x09000800, 0x6109080a, 0x0b000a00, 0x065d0b0a, 
-    0x00040401, 0x0201025b, 0x4b3b0000, 0x03020507, 0x250d8703, 0x4b1b4c03, 0x32824eb0, 0x32922820, 0x32820120, 0x87010121, 0x00592131, 0x2f823d82, 
-    0x00264024, 0x43820700, 0x03000823, 0x2e349961, 0x59594c04, 0x28291240, 0x24252627, 0x83231311, 0x10232801, 0x2b1d080c, 0x51173313, 0x362c05ee, 
-    0x15163233, 0x34112311, 0x06222326, 0x2946088b, 0x51dd3807, 0x3b541d08, 0x4117533a, 0x595b587a, 0x51433a38, 0x453a3759, 0x43855950, 0x0736087a, 
-    0x38323055, 0x6f78773f, 0x4801b5fe, 0x515d4c50, 0x4801cafe, 0x07834b51, 0x6b444020, 0x00da390c, 0x00310025, 0x00390035, 0x100a40c0, 0x0f010001, 
-    0x02000201, 0x05b04b4a, 0x2008fa82, 0x0002002a, 0x68020004, 0x00000100, 0x63000102, 0x06000500, 0x61060507, 0x08000700, 0x095d0807, 0x0ad56901, 
-    0x20050149, 0x1831852b, 0x9c080dc3, 0x31402132, 0x04202d90, 0x05225382, 0x368a0304, 0x07080828, 0x07070055, 0x72835908, 0x59594d28, 0x26271740, 
-    0x39573839, 0x2a2d2d05, 0x30273126, 0x2b242425, 0x2b16080a, 0x0f20ab18, 0xe06f3620, 0x0f062b05, 0x07030e01, 0x011d010e, 0xb94c1723, 0x08ba440a, 
-    0x071e2508, 0x2d151d10, 0x35401c1a, 0x5f31592a, 0x364c2f62, 0x2c2c251d, 0x050a100e, 0x60030302, 0x2a1e1e1b, 0xf5fd1e1e, 0x08088648, 0x281cf824, 
-    0x2c152223, 0x2d1d2b1a, 0x5e212337, 0x412f1938, 0x2b422927, 0x0e130d2b, 0x1e0a060b, 0x1ec83e1a, 0x02821e43, 0x38056641, 0x58000100, 0x79040a00, 
-    0x1b00fa04, 0x09407200, 0x05020d0e, 0x00011b48, 0x05eb7047, 0x52582020, 0x01072f12, 0x59050404, 0x05050106, 0x1b4c043c, 0x09822740, 0x03231282, 
-    0x8c610405, 0x124e582c, 0x18191a29, 0x11151617, 0x84111311, 0x080c2400, 0x59252b1d, 0x21220864, 0x68592135, 0x212f080a, 0x01072115, 0x01ef3710, 
-    0x6bfe583d, 0xfd58e501, 0x558b02c3, 0xfeeb378d, 0x910159c8, 0x025a20fe, 0x5377fd3a, 0xc0ac764a, 0xb8aac0ac, 0x82aa7741, 0xb6ac2207, 0x20008200, 
-    0x20cf8204, 0x21cf8200, 0xff4f00ee, 0x4e642007, 0x2320059b, 0x01241c82, 0x61010002, 0x2109ee49, 0xd84a0500, 0x09b77e05, 0x99284021, 0x0fcb5325, 
-    0x2010296a, 0x067f4e15, 0x11d85118, 0xdffb2124, 0xa384ee04, 0x82acc021, 0x00032860, 0x0454ff56, 0x479f0477, 0x2c220645, 0x50182940, 0x808909a1, 
-    0x1019a318, 0x08041725, 0x18132b18, 0x8309b44a, 0xb84a1868, 0x8204200c, 0xac022168, 0x08bc4a18, 0x6c826020, 0x2d216bbd, 0x206d8201, 0x24d88701, 
-    0xfc210356, 0x086842df, 0x16206b83, 0x09085118, 0x02246c82, 0xb5fe5600, 0x1a26d786, 0x38403b00, 0xd7861011, 0x48030923, 0x5848181a, 0x08182326, 
-    0xe4871c08, 0x1d420120, 0x09825b08, 0xfc36f086, 0x01ca2782, 0x35fe5b70, 0x7b9a6d02, 0x95fec92a, 0xfdc6015b, 0xfd889994, 0x29cbfd2f, 0xa1aa60ac, 
-    0x60aa2c75, 0x00009fac, 0x419bca00, 0x1e5c0514, 0x08204113, 0x9c95a320, 0x8d082e41, 0x012b089d, 0x00005700, 0x04057904, 0x32001c00, 0x16182f40, 
-    0x04080a13, 0x01000106, 0x0f10124a, 0x00050b0e, 0x03191c48, 0x47010401, 0x84010000, 0x0100232b, 0x1e82005b, 0x1d4f5a08, 0x1608021c, 0x0613372b, 
-    0x013e3507, 0x2526013f, 0x13370435, 0x37360317, 0x010f0615, 0x24150516, 0x81eb0307, 0xbc6e977d, 0xfebe6151, 0xd85b01e1, 0x79829ac2, 0x62a2d89b, 
-    0xfe1d01c0, 0x4dc1d8a5, 0x49290201, 0x114634b2, 0xb28812c1, 0x7f0108aa, 0x28fefe4d, 0x2268b24a, 0x280f84c2, 0x000081fe, 0xff580002, 0x279b82e3, 
-    0x000f0020, 0xb5080012, 0x46089182, 0x2b300205, 0x35251325, 0x07171325, 0x03051525, 0x03251505, 0x01170513, 0x77fe776a, 0x99723202, 0xfe2f014b, 
-    0xd2016492, 0x4b74fefd, 0x13e9d9fe, 0xa69b8101, 0x306d01de, 0x8ab678f1, 0xb7aebbfe, 0x038bfecb, 0x92566f0d, 0x0f11225b, 0x215b8309, 0x5b820537, 
-    0x05352522, 0x0520ca82, 0x013b5f82, 0x3c010727, 0x01d1fe4b, 0x2efe646e, 0x99740202, 0xfd890177, 0xd50172ce, 0x83133ee9, 0x45012153, 0x01245382, 
-    0x7ffe3075, 0xfe256782, 0x569f0293, 0x205b85c5, 0x3db7820d, 0x00170008, 0x404b001a, 0x12191a15, 0x0d0f1011, 0x090a0b0c, 0x0e050607, 0x01174801, 
-    0x1a444700, 0x020d3005, 0x00010101, 0x00010359, 0x4c003a00, 0x8213401b, 0x0000230f, 0x16885501, 0x4d000131, 0x1f11b659, 0x08041111, 0x37052b18, 
-    0x89213521, 0x820720fe, 0x074408fe, 0x07211521, 0x01170513, 0xf4fe3f25, 0xfe5f4301, 0x733f025e, 0x1b014da1, 0x014ea4fe, 0x4e23feaa, 0x9efd2b02, 
-    0x00ff9150, 0xaabebed3, 0xa8831f01, 0x356001b4, 0x64b859ed, 0x96b67cf1, 0x03f3aaec, 0x003e4add, 0x1255b394, 0x29b3c005, 0x35233717, 0x35053733, 
-    0x56413725, 0x08b38408, 0x07270121, 0xebb33ecd, 0x01dbfe3a, 0x4efe4c66, 0xa174e601, 0xfd990173, 0x83024ecb, 0x024f45fd, 0x822ace0c, 0x5cb230b0, 
-    0x7dec68b6, 0x610198b8, 0x80a1fe35, 0x82f1b1a8, 0x3c9322b0, 0x39af8384, 0x04d4ff56, 0x003f0477, 0x002a0006, 0x0719405a, 0x19000101, 0x02030201, 
-    0xf843184a, 0x00082506, 0x02012a48, 0x20066741, 0x0e697e13, 0x02420226, 0x18401b4c, 0x2517857e, 0x2529b659, 0xf3443b26, 0x0519590b, 0xaf5f1f20, 
-    0x08094515, 0x1821a35f, 0x2108e04f, 0x5c18207e, 0xdfeb1992, 0x20055244, 0x45df9d15, 0xdfa1077d, 0x56180120, 0xe09c08a0, 0x00023208, 0x040dff56, 
-    0x00080577, 0x00340031, 0x1a234067, 0x01020205, 0x03022230, 0x344a0200, 0x18192133, 0x13141617, 0x0e101112, 0x010f0c0d, 0x02043148, 0x08c94103, 
-    0x64000121, 0x03260b88, 0x1b4c0342, 0xa4641840, 0x40593217, 0x1f242609, 0x0411351d, 0x052b1608, 0x07062213, 0x05494a35, 0x45443720, 0x05072608, 
-    0x16072515, 0x09265f17, 0x022e7408, 0x032e012f, 0x05130327, 0x58250117, 0x4e498d51, 0x140e5191, 0x5efe450b, 0xa1734102, 0xfe19014d, 0xa90150a7, 
-    0x174223fe, 0x465e731e, 0x8f4b4b88, 0x30301d4e, 0x02211d32, 0x13160c05, 0xfdfe925f, 0x0d01bed5, 0x3cae403b, 0xd6010137, 0x01b5a883, 0x58ec355f, 
-    0x7cf263b8, 0x07cf96b6, 0x3f3c3610, 0x07363caf, 0x0e0c130d, 0x09050201, 0x03dffe08, 0x413e4bde, 0x134105f3, 0x00323705, 0x40520035, 0x01253121, 
-    0x01000103, 0x2434354a, 0x15161719, 0x46441314, 0x11072706, 0x06324800, 0x11410102, 0x000b2906, 0x5b010000, 0x42010100, 0x095f6318, 0x13865720, 
-    0x4f010032, 0x2729b659, 0x08022022, 0x13172b14, 0x010e0706, 0x4305b045, 0x1e220d90, 0xb2181f03, 0x26200a50, 0x7108fe85, 0xcd072701, 0x221a2255, 
-    0x7e4e2549, 0xd8fe223a, 0xfe4e6701, 0x74e8014b, 0x970173a1, 0x053bcdfd, 0x081d1f1b, 0x455f7320, 0x92484b88, 0x3c5c344e, 0x1c231a21, 0x0267151e, 
-    0xbe2aca08, 0x0b080301, 0xae20300e, 0x6a05303c, 0xea69b65d, 0x0199b87e, 0xa0fe3562, 0xb8b1a87f, 0x0c0b0901, 0x3c360f03, 0x3939af3f, 0x0b0e1a19, 
-    0x05080b0e, 0x9303c7fe, 0x0341823b, 0x044a3105, 0x00d30477, 0x000d0006, 0x0a0db508, 0x30020206, 0x42089447, 0x6e4305ac, 0x07964208, 0x48e00221, 
-    0xfe210678, 0x0715486c, 0x0223ff82, 0x8cff5600, 0x0609224b, 0x854b8303, 0x48152044, 0x374705cc, 0x21042708, 0x2103dffc, 0x40874a02, 0x5286fe20, 
-    0x0300003f, 0x70fe5600, 0xb1057704, 0x1e001b00, 0x0a002100, 0x1e2021b7, 0x030d1b1c, 0x37012b30, 0x052f4607, 0x20064d42, 0x05934637, 0x82050721, 
-    0x13570807, 0x27011705, 0x4c030107, 0x503401f9, 0xb5017cfe, 0x0233fe18, 0x4ca26e68, 0x50cefef5, 0x4efe8201, 0xfdcb0119, 0xfedf6d9b, 0x2501fcd2, 
-    0xa0fe32fa, 0x5ab64ef8, 0xb8700701, 0xa8914f89, 0x326801c1, 0x58b84df9, 0xb671f8fe, 0xa8904e88, 0x059bfec1, 0xfe4a571b, 0x93a04800, 0x1e1f228f, 
-    0x238f851d, 0x25352513, 0x220e6c45, 0x82051525, 0x0325218f, 0x99088c83, 0x03011707, 0x01d6fe7d, 0x41fe1da2, 0xfd30f901, 0x7d5902d7, 0x27017ea2, 
-    0x011d62fe, 0x300afebb, 0xaafd2602, 0x55d2017c, 0x69aefe11, 0x01a0fe58, 0x83a85e98, 0x93b68c5f, 0xbcb8a09e, 0xfe329a01, 0x82a85c65, 0x91b88b60, 
-    0xbcb6a19f, 0xc4046afe, 0xf2fd3719, 0x00001a1e, 0x56000100, 0x7704d3ff, 0x0b002f05, 0x05b30600, 0x2b300100, 0x35250005, 0x00150124, 0x15010405, 
-    0xb9fe7704, 0xdf0226fd, 0xb9fe4201, 0xab015cfe, 0x012d4001, 0x95a696c5, 0xfeefc601, 0xfe625798, 0x4384efa3, 0x43825820, 0x43827920, 0x43820a20, 
-    0x82050a21, 0x372a0843, 0x01242500, 0x15050035, 0x01580104, 0xfeac013f, 0x01b9fe5c, 0xfddf0242, 0xc2b9fe26, 0x57625d01, 0xfeef6801, 0x96a6953a, 
-    0x3b423bfe, 0x82042005, 0x00b13883, 0x001f000e, 0x0f1ab508, 0x30020009, 0x012e252b, 0x3527012c, 0x84370024, 0x2e11238b, 0x02822703, 0x16354f08, 
-    0x17011e04, 0xe05c7704, 0xcffef7fe, 0x026101ab, 0xdefeb709, 0x93016bfe, 0x742b2401, 0x37367f7f, 0x6aa98d77, 0xfe2c01b8, 0x64d566d9, 0x1d6489ad, 
-    0x13013da6, 0xd1feefcb, 0xdefe5d50, 0x713440fd, 0x2424616d, 0x102a343e, 0x8e651cc8, 0x6f426eb6, 0x237f8b06, 0x050e141f, 0x13207f82, 0x1620c384, 
-    0x062dc482, 0x0706010c, 0x24023e15, 0x030e1537, 0x08028207, 0x2401564e, 0x6bfe9301, 0x02b7defe, 0xab610109, 0xf7fecffe, 0xd9665be1, 0xb82c01fe, 
-    0x778ba76a, 0x7d813b3a, 0xc4012b70, 0x505d2201, 0xcbef2f01, 0xa63dedfe, 0xad89641d, 0xb66ed564, 0xc81c658e, 0x3e332811, 0x6b632726, 0x0200336f, 
-    0x8eff5600, 0x2d3afb86, 0x19405e00, 0x0001010f, 0x0302011c, 0x0e1b4a02, 0x06090a0c, 0x00080005, 0x0f472d48, 0x00122708, 0x01020001, 0xb6825f02, 
-    0x005b0325, 0x453a0303, 0x01200544, 0x15944518, 0x0b40592d, 0x1e20292b, 0x11131719, 0x41140804, 0x09210e51, 0x1a6b6b01, 0x21156041, 0x6e6bdffb, 
-    0x116f411c, 0x6378fe21, 0xf78a1522, 0x2b000c27, 0x19405900, 0x20f7820d, 0x26f7841a, 0x08090c19, 0x83020405, 0xb72b20f7, 0x29b628f7, 0x042f2425, 
-    0x412b1808, 0x042309c4, 0x9a150700, 0x0dd241f0, 0xfda9fe24, 0xeb9cbaf0, 0x240ddd41, 0xcceafe39, 0x84ea9699, 0x045b39eb, 0x00a70577, 0x001d0017, 
-    0x181db508, 0x30020817, 0x2e13052b, 0x24352701, 0x2a067d4b, 0x0307010e, 0x26151716, 0x82130325, 0x1643080a, 0xa6590117, 0x0175d361, 0xa3a1f449, 
-    0x516e9a68, 0xe7555ba9, 0xd6feb2c3, 0x613055a0, 0x734f5533, 0x3f282202, 0x7f42a618, 0xfe321202, 0xef9a76aa, 0xfe378f58, 0xefd576eb, 0xf4fd9df7, 
-    0x1c136003, 0x931c140b, 0x820e2077, 0x13173877, 0x3e350706, 0x26133701, 0x05163527, 0x1e031713, 0x04151701, 0x82130307, 0x27262213, 0x236d89f6, 
-    0xa2a02a01, 0xfe248483, 0xe4a1f4b7, 0x01217685, 0x216b8556, 0x6b841501, 0x320c0224, 0x8885defd, 0x02eefd23, 0x827685ec, 0xff582277, 0xa75518c4, 
-    0x40633508, 0x02010b13, 0x01012403, 0x0a4a0202, 0x48030209, 0x47000118, 0x08055a51, 0x05061520, 0x01040102, 0x5f000100, 0x03020200, 0x03030059, 
-    0x1b4c023c, 0x03001d40, 0x03010200, 0x1f836102, 0x01000023, 0x6d078357, 0x592a0869, 0x191a0e40, 0x251a2519, 0x0082112d, 0x19080722, 0x50065f4b, 
-    0xcd82050e, 0x15011e29, 0x2b020e14, 0x77130701, 0x273205c7, 0x0327012e, 0xfe393201, 0xdd4601ed, 0x5702ddfd, 0x5518a24b, 0xc9320bbc, 0x33587745, 
-    0x2f17302f, 0xaa07d418, 0x96900296, 0x551835df, 0x01220bb7, 0x55183375, 0xfd2208b0, 0x734b008d, 0x822c2005, 0x00d62edf, 0x002b001f, 0x2b134075, 
-    0x05040501, 0x26a38201, 0x0211124a, 0x841f4802, 0x503538df, 0x031f4058, 0x01090201, 0x04020504, 0x00050063, 0x06050106, 0x7f010761, 0x40210bd9, 
-    0x82219425, 0x885520f2, 0x00012228, 0x21f1824d, 0xeb822022, 0x13111128, 0x0a11112a, 0xf1821d08, 0x2135232b, 0x35032e37, 0x3b023e34, 0x05055101, 
-    0x15210323, 0x05a24b21, 0x08f34118, 0x05012308, 0x1b01e336, 0x6478393a, 0xae814a40, 0x9e47b264, 0xecfee235, 0xfdf001dc, 0x550232dd, 0x014772fd, 
-    0xfd837f10, 0x55452b3c, 0xaa9f9f29, 0x734910ac, 0xb066619a, 0x35d64a83, 0x70fd96a1, 0xd4aa9a96, 0xfe843e05, 0x334f6923, 0x27fb8c0c, 0x00310025, 
-    0x1513407b, 0x302bde82, 0x02040301, 0x0213144a, 0x88254805, 0x7e2020fb, 0x612b061c, 0x0302090a, 0x01020106, 0x8e630203, 0x952620fc, 0x2cfd9122, 
-    0x26262712, 0x11312731, 0x41312d11, 0x20008211, 0x0801410b, 0x21352126, 0x23222613, 0x32270682, 0x17371716, 0x41171607, 0x212208fc, 0x00422115, 
-    0x266d0808, 0x05010327, 0x1b01e235, 0x01b2fe33, 0x0c06db81, 0x02bcfd06, 0x11251344, 0x38499e49, 0x4a454633, 0x4464af81, 0xfd560234, 0x44f84671, 
-    0x32335977, 0xca1b172d, 0x9aaa9f9f, 0x018f0296, 0xdb020396, 0x331fda35, 0x6660a847, 0x9a4a82b0, 0xae02d4aa, 0x46795833, 0x172d7445, 0x00a6fd13, 
-    0xff580001, 0x05790430, 0x00260000, 0x210a4068, 0x21ec8201, 0x0841264a, 0x001e2b08, 0x05040003, 0x00630403, 0x19820605, 0x06410520, 0x93242010, 
-    0x11044120, 0x12110c2a, 0x28212811, 0x09111121, 0xf382fe84, 0x22233723, 0xac4f182e, 0x42172013, 0x66290506, 0x01a0fe52, 0x65867ce8, 0xb94f18ae, 
-    0x3428080d, 0x02447758, 0x41b1fe44, 0xfe5f0151, 0x6666a718, 0x814b9aaa, 0xae6363af, 0x34964b82, 0x45447759, 0x96335878, 0xd0aa6535, 0xdb888482, 
-    0x69002829, 0x01220e40, 0x82230302, 0x4a0222df, 0x20df8828, 0x06c5411d, 0xb4436320, 0x01012508, 0x07590001, 0x20071a4f, 0x821f9223, 0x06552158, 
-    0x01272687, 0x40594d00, 0x821b110b, 0x114125db, 0x1c080811, 0x2105cf43, 0xd7410637, 0xfc4f1805, 0x8d072010, 0x11082ade, 0x02bdfd08, 0x58784344, 
-    0x0d501834, 0x6742240b, 0x88543c7d, 0x019b35e0, 0x78583396, 0x59774445, 0x824b9634, 0x9d6265b0, 0x440e4a74, 0x002fe284, 0xff830002, 0x054e04e3, 
-    0x00190004, 0x4f600025, 0x1b3205e0, 0x05010103, 0x05007201, 0x02040107, 0x00630405, 0x44180202, 0x402109bb, 0x211d9020, 0x9f180000, 0x26080de2, 
-    0x1a1b1740, 0x1e210001, 0x241b251a, 0x0c0e1314, 0x19000607, 0x08081901, 0x22052b14, 0x1135022e, 0x1e141133, 0x82323302, 0x220a83dc, 0x5503020e, 
-    0x36080ac7, 0xb8836902, 0x24ac3675, 0x5253774c, 0xac244c77, 0xd0b87536, 0x1e981e1e, 0x7a351d1e, 0x150394c9, 0x9d7a18fd, 0x5b23235b, 0xe8027a9d, 
-    0xc994ebfc, 0xdb01357a, 0x821ea61e, 0x20cb8e02, 0x20cb8576, 0x22ad8224, 0x18720106, 0x8411266d, 0x010a29d4, 0x00420000, 0x29401b4c, 0xdd882699, 
-    0x02332c82, 0x40594f00, 0x2500011b, 0x21222324, 0x1d1e1f20, 0x891a1b1c, 0x990b20e1, 0x35232ae1, 0x15333533, 0x15231533, 0x23e19223, 0x65aaaab5, 
-    0xe2980282, 0x641a023d, 0xac64aaaa, 0x01000000, 0x77005800, 0x8b047904, 0x3e000700, 0x5018b04b, 0x82124058, 0x020323f8, 0x40185d03, 0x0120083a, 
-    0x1820cf82, 0x18171755, 0x230aa340, 0x11211521, 0x582e0382, 0x89fc2104, 0xdffb7703, 0xfdaa8b04, 0x6396aa40, 0x03000023, 0x22638400, 0x5c005902, 
-    0x4021059b, 0x24788218, 0x01020001, 0x221b8261, 0x82550003, 0x59032171, 0x4d202583, 0x1122638b, 0x65823521, 0x7703582f, 0x210489fc, 0x2101dffb, 
-    0xfbaac002, 0x223982ec, 0x820e0058, 0x82f420c7, 0x000b21c7, 0x087b5018, 0x73567c82, 0x0504270d, 0x05050059, 0xd282053a, 0xd2892020, 0x67030021, 
-    0x75181313, 0xdd8310f9, 0x86065d56, 0x268182e1, 0xfdaaf404, 0x8280aa98, 0x000221e7, 0x80828394, 0x6582d485, 0x61030023, 0xba511800, 0x8920200b, 
-    0x5e1d87f2, 0x838e0d7c, 0x8384fd85, 0x20070141, 0x26838204, 0x6802e201, 0x8244fcaa, 0x00012c84, 0x0400005e, 0x00040572, 0x42390007, 0x551805b1, 
-    0x3a210c0f, 0x12c31801, 0x0055240e, 0x18020000, 0x2a0912c3, 0x08041011, 0x21132b18, 0x82112311, 0x045e2e03, 0x40fdaa14, 0xfa0405aa, 0xfb5a04fc, 
-    0x8b2a82a6, 0x853b205f, 0x02112b5f, 0x00010001, 0x01010072, 0x454b5a03, 0x87162007, 0x03032313, 0x19865501, 0x4e030122, 0x11d04218, 0x02aa5e30, 
-    0xecfbaac0, 0xa6fb0405, 0xfcfa5a04, 0x71180300, 0x38380cf3, 0xb04b6400, 0x4058501e, 0x0004001c, 0x05040205, 0x02010761, 0x02000106, 0x09d44818, 
-    0x82034421, 0x002328d0, 0x04030001, 0x8a630301, 0x20d68226, 0x9bf31857, 0x17402b0c, 0x00011b1c, 0x35363738, 0x7118282a, 0x082009f5, 0x0ee26718, 
-    0x28f57118, 0x15210123, 0xa3701821, 0xf7fe272d, 0x4dfdb302, 0x7118566a, 0x01232ce7, 0x18008cd2, 0x2310df71, 0xb7590038, 0x0320c882, 0x89027318, 
-    0x01170122, 0x252d0c41, 0x63e801d4, 0x0c4118fe, 0x84ca202e, 0x130f4134, 0x23992742, 0x23113303, 0x222d1a41, 0x41fcfc2f, 0x02262e17, 0x00cffe1a, 
-    0x3b430400, 0x0049240c, 0x4384005d, 0x2636053d, 0x07000500, 0x63070506, 0x0a06010b, 0x06020401, 0x01096304, 0x47430802, 0x002d2811, 0x05030001, 
-    0x94630301, 0x00002930, 0x01095702, 0x5b000202, 0x4f373a84, 0x4b234059, 0x1c35364a, 0x5500011b, 0x4b5d4a53, 0x353e405d, 0x43493649, 0x0c200b5d, 
-    0x20375d43, 0x71511837, 0x0dbd6608, 0x012e2722, 0x4107904b, 0x20082d54, 0x4760394e, 0x61482928, 0x25623738, 0x482a2726, 0x311c3862, 0x12271525, 
-    0x301c1d30, 0x24141524, 0x2e724130, 0x4728843b, 0x63393860, 0x27292a48, 0x39365f25, 0x85294762, 0x1c312414, 0x15122736, 0x24078215, 0x1423301c, 
-    0x20008200, 0x0a934107, 0x00222008, 0x0030002a, 0x003e0036, 0x404a0046, 0x3e3f4612, 0x35363738, 0x292a2c30, 0x000d1b22, 0x414a0101, 0x0c2105ad, 
-    0x0c1b7c02, 0x83001121, 0x8257200e, 0x5b00331f, 0x01000102, 0x40594f00, 0x1000010b, 0x011a000e, 0x5f41031a, 0x0e03231d, 0x02820701, 0x2e251724, 
-    0x02822701, 0x25071131, 0x17141506, 0x34353621, 0x010f0527, 0x8217011e, 0x3e332302, 0x02823701, 0x4e412720, 0x31ad3f17, 0x10093a73, 0x7201ff08, 
-    0x3a091008, 0xfe963173, 0x021c1bec, 0xfe1b1cdf, 0x08fe96ec, 0x12820810, 0x22827320, 0xfe200982, 0x29174241, 0x3107a303, 0x0a120a39, 0x04829a9a, 
-    0x0731392a, 0x965acffe, 0x45515145, 0x96250383, 0x1209995a, 0x82148209, 0x21088222, 0xc7420099, 0x0038240f, 0x4178003c, 0x24200519, 0x230b3f69, 
-    0x61070602, 0x2015c542, 0x0b0d462b, 0x72040621, 0x2e860536, 0x2811c342, 0x011b1c1b, 0x3a3b3c00, 0x0f194639, 0x5b410a20, 0x0f78181d, 0x5e032019, 
-    0x51410688, 0x0b781817, 0x02ed2415, 0x8385fd7b, 0x17454103, 0x78188c20, 0x02241508, 0x678d6638, 0x20aa3747, 0x30374703, 0x93017924, 0x15416dfe, 
-    0xd2012c2e, 0x0003008c, 0x04690050, 0x829c0483, 0x00072e09, 0x40470013, 0x00000044, 0x02000602, 0x0dbe4b61, 0x0906032a, 0x03010a61, 0x55030101, 
-    0x03230682, 0x82005901, 0x044d230c, 0x12711304, 0x0a0b2706, 0x07040809, 0x0e820704, 0x17080b2c, 0x1121132b, 0x21112521, 0x5f180111, 0x27080abf, 
-    0xfb330450, 0xfca403cd, 0xfe4601e8, 0x8c3701c9, 0xc8fe3801, 0xfb9c048c, 0x1b038ccd, 0x4701e5fc, 0xfe39018c, 0xcafe8cc7, 0x978e8082, 0x35000b24, 
-    0x16823240, 0x82040221, 0x04002897, 0x04030500, 0x85066105, 0x8906828d, 0x20858a8d, 0x23858a07, 0x21152113, 0x33247d88, 0x4dfdb302, 0xd3207689, 
-    0x41083b48, 0x39220b07, 0xd98a3640, 0x02030b24, 0x7f834a01, 0x7f820320, 0x77850420, 0x77890682, 0x0520f986, 0x3722738a, 0x02820109, 0x01091725, 
-    0x88010907, 0x0121337b, 0x63f5fe0a, 0x0c010b01, 0x01f4fe63, 0xf8fe6308, 0x8a88f6fe, 0x09018327, 0xfe630b01, 0x261c84f5, 0x0163f8fe, 0x41f7fe08, 
-    0x0123510b, 0x88231133, 0x0d01238f, 0x7f88fcfc, 0xfe1b0223, 0x216f83cf, 0x64180001, 0x3f2009bf, 0x2805bf4a, 0x00010013, 0x02010302, 0x06704c61, 
-    0x24070756, 0x00030100, 0x211b8e55, 0x8c4c0300, 0x1133350b, 0x11211521, 0x03a85823, 0xa887fc79, 0xd3fd0405, 0x00d3fdaa, 0x63943282, 0x01030024, 
-    0x9a536100, 0x066b5607, 0x03010223, 0x8b638302, 0x8b02201b, 0x06634263, 0xd103232f, 0x790387fc, 0x2d02a8a8, 0xfa2d02aa, 0x4b638cfc, 0x012208e7, 
-    0x48850102, 0x2706cb56, 0x00030016, 0x01007303, 0x64829282, 0x59000125, 0x5f000102, 0x1120054b, 0x8305e74b, 0x3ac1835d, 0x43fe1502, 0x44fe2104, 
-    0xaa5a04a8, 0x00a6fbaa, 0x00020000, 0x048d0058, 0x82770479, 0x00062642, 0x0406b508, 0x06835a03, 0x01031137, 0x21045805, 0x0256fda8, 0xa62f02aa, 
-    0x16fca201, 0xfffef502, 0x2b3392fe, 0x02000305, 0x01132b30, 0x11020915, 0xfb323282, 0xfd5203df, 0xfe770456, 0x5efea65e, 0x0101f401, 0x5d8201fe, 
-    0x00005826, 0x3f047904, 0x0a226784, 0x74183900, 0x3526392d, 0x0d031101, 0x814e0101, 0xfda83705, 0xfc790287, 0xfb210487, 0xa84c02df, 0xc1fc4b01, 
-    0xb9b75702, 0x1f75c3fe, 0x2b738c06, 0x06094038, 0x01020305, 0x48000600, 0x18051242, 0x2321e64f, 0x16080217, 0x0123d984, 0x85031125, 0x23de8272, 
-    0xa885fd23, 0x042b7283, 0xa8b5fe3f, 0xa001b4fe, 0x8590feb7, 0x00023073, 0x0467011c, 0x00a203b5, 0x002a0016, 0x823a403d, 0x02052fef, 0x00630503, 
-    0x04010002, 0x07610102, 0x94820401, 0x06825720, 0x5b00043e, 0x04000106, 0x17184f00, 0x20220001, 0x2a182a17, 0x07080c0e, 0x16000506, 0x08081601, 
-    0x2305d96f, 0x21372127, 0x2105ae5e, 0x4e181415, 0x230811a7, 0x5e3c9803, 0xfd092a44, 0x69020195, 0x5c462e09, 0x4c693c39, 0x694c2b2c, 0x25321d3d, 
-    0x32251515, 0x26321d1c, 0x01380783, 0x463a2767, 0x4922a820, 0x4e2d263b, 0x673c3d69, 0x15942b4c, 0x1c1d3125, 0x43081e82, 0x1c332516, 0x1525311c, 
-    0x00010000, 0x044cfe83, 0x000b064e, 0x401b0019, 0x02020018, 0x00005b00, 0x034b3b00, 0x3e010101, 0x25154c01, 0x08042415, 0x34132b18, 0x3233023e, 
-    0x1115021e, 0x2e341123, 0x0e222302, 0x83260a83, 0x82b87536, 0x8351b982, 0x76533206, 0x03ac244c, 0x7ac994ff, 0xc97a3535, 0x054dfa94, 0x077f5186, 
-    0x827afa21, 0x246b8354, 0x054e042f, 0x2d6b82ee, 0x28b04b61, 0x12405850, 0x01010103, 0x76844b39, 0x73180420, 0x3920080d, 0x02221986, 0x198c7201, 
-    0x03174024, 0x14840101, 0x82086751, 0x00022934, 0x4059594f, 0x1400010f, 0x79083e52, 0x3e520529, 0x12505113, 0x832ffe21, 0xb30523ad, 0xad877afa, 
-    0xfa860523, 0x82c5834d, 0x022d08b3, 0x82006900, 0x80046704, 0x07000300, 0x07b50800, 0x02010305, 0x09132b30, 0xfe016906, 0x02fe0002, 0xf0fe0e01, 
-    0x1001f2fe, 0xfe018202, 0x260f83fe, 0xfe1001fe, 0x82f0fef2, 0x01013a3b, 0x039b0109, 0x003704c8, 0x40180009, 0x00010315, 0x07080948, 0x47000406, 
-    0x08ea8201, 0x11126926, 0x2b160802, 0x37212701, 0x17072117, 0xe2010727, 0x540c01d9, 0xd90c0153, 0x02dada54, 0xffff9e9a, 0x9e9eff9e, 0x582e8384, 
-    0x79046001, 0x2000c303, 0x4a002400, 0x45184740, 0x1128096d, 0x49010001, 0x48020104, 0x2709287b, 0x04000106, 0x00630001, 0x23100478, 0x21222324, 
-    0x097a4518, 0x18050478, 0x241b7a45, 0x21152105, 0x7e451801, 0x050e7b1e, 0x18a20221, 0x30188445, 0x0000ac96, 0x00f8ff01, 0x05d60400, 0x000b0004, 
-    0x05844329, 0x1b287118, 0x1214122d, 0x2b170803, 0x33011021, 0x82121300, 0x11210804, 0xfd140223, 0x7101f0e4, 0x6b01130f, 0xa6e4fdf0, 0x88017c03, 
-    0xd3fed9fe, 0x2a012a01, 0x84fc78fe, 0x82639500, 0x18002015, 0x21164472, 0x63841214, 0x00232908, 0x01103311, 0x02030023, 0x02082301, 0x1c02a61c, 
-    0x0f8ffef0, 0xf095fe13, 0x7d038701, 0x79fe83fc, 0x2d012701, 0xd6fed6fe, 0x002d6282, 0xff5a0002, 0x057704fa, 0x001d000a, 0x0a977737, 0x05020025, 
-    0x6b630201, 0x632f0620, 0x01090700, 0x04070304, 0x03030063, 0x55085b00, 0x2a2207dd, 0x27980100, 0x03000023, 0x3e2d8757, 0x594f0003, 0x1e1f1b40, 
-    0x34360001, 0x27292a2c, 0x371f371e, 0x10121a1c, 0x1d000d0f, 0x540a1d01, 0x04250535, 0x043e3435, 0x78661833, 0x5601200c, 0x023214e1, 0x90a65ae2, 
-    0x2e2e5476, 0xa6907553, 0xfe97015a, 0xe356646a, 0x01653e05, 0x406afe95, 0x30305370, 0x01417052, 0x1d6bfe96, 0x15152632, 0x011d3226, 0x542e0695, 
-    0x202c8276, 0x22388259, 0x18aa2e55, 0x2f071b66, 0x305401aa, 0x40417053, 0xaa305470, 0x1c332516, 0xaa212f83, 0x0e134100, 0x36080f6a, 0x06010002, 
-    0x00630102, 0x04050006, 0x00630506, 0x00070004, 0x5d630704, 0x28200c8d, 0x25963c82, 0x00030323, 0x332b8657, 0x594f0300, 0x21280b40, 0x212c2128, 
-    0x08082028, 0x21372b1c, 0x0ce76618, 0x14150427, 0x2123040e, 0x20158d11, 0x25158202, 0x5a212302, 0xf0859601, 0xfe64af25, 0x4195016b, 0xfe230b0c, 
-    0x87950169, 0x201b82f4, 0x050c4196, 0xfe40712d, 0x824ba46a, 0xae6364ae, 0x41aa4b81, 0x01250b09, 0x322516fe, 0x41f6841d, 0xa2830708, 0xfe580027, 
-    0x06790441, 0x23ea8215, 0x0011000a, 0x660c6f6a, 0x07210661, 0x055d6801, 0x2f825520, 0x00590127, 0x4d010001, 0x05634611, 0x20096f6a, 0x05b46111, 
-    0xa5615820, 0xdffb2505, 0xdffb2104, 0x08177b18, 0x766a2220, 0x23fd2908, 0xfeb6eae7, 0xb5fea8b4, 0x7f6a7bc0, 0x85112009, 0x6a582086, 0xfc250d82, 
-    0x032303dd, 0x09846a8c, 0xa8b6fd25, 0x82b64c01, 0x1800200f, 0x2d092376, 0x000a0003, 0x0a0a4039, 0x06070809, 0xe7820405, 0x1805cb4d, 0x29201087, 
-    0x08021011, 0x21132b16, 0x7b862115, 0xef835620, 0x0422fb85, 0x6a89aa3f, 0x43486b82, 0x416bc009, 0x5b410863, 0x416d820a, 0xdb820b53, 0xe360ff20, 
-    0x00103005, 0xb508001f, 0x0a10111a, 0x132b3002, 0x8237033e, 0x0e152202, 0x27e58202, 0x35250026, 0x36012c36, 0x20056f61, 0x09c96056, 0xfed9663f, 
-    0x04b8d4fe, 0xf7fdb721, 0x01ab9ffe, 0xe0090131, 0xfedcfe5c, 0x0195016d, 0x104a0322, 0x07cd6029, 0xb66efc38, 0xfc1c658e, 0x1301cb82, 0x651ca63d, 
-    0xef65ac89, 0x505ddefe, 0xe361d1fe, 0x237f850b, 0x0006161f, 0x01297f82, 0x012e2426, 0x031e3527, 0x36028217, 0x24250001, 0x011e3501, 0x1517010c, 
-    0x04070004, 0xd4feb877, 0x6166d9fe, 0xfb3d09d5, 0x012201df, 0xfe6dfe95, 0x01e15bdc, 0xab310109, 0xf7fd9ffe, 0x1c8202b7, 0x6eb68e65, 0x09d961fc, 
-    0x01a9fc33, 0x015d502f, 0xac65ef22, 0xa61c6589, 0xcbedfe3d, 0x33008200, 0xfe560002, 0x0677048c, 0x00320029, 0xb5080038, 0x11323338, 0x13358383, 
-    0x16352726, 0x25263717, 0x3f033e35, 0x07171301, 0x1537013e, 0x058f5f0e, 0x07209d82, 0x15209b83, 0x7f080882, 0x0327032e, 0x1e070613, 0x0f011701, 
-    0xfad1a2ba, 0xfed233b3, 0x99ab59f2, 0x8c342f82, 0x5e364da2, 0x4c8c412a, 0x55a6c956, 0x073380d2, 0x73797b3a, 0x8ff15332, 0x090c1212, 0x64dcb307, 
-    0x2a542d69, 0x4e02bffe, 0x26c81e40, 0x2d5aa347, 0x312a0fa6, 0x011d1a36, 0x2af533bc, 0x44ef2f57, 0xeefe2e70, 0x5defa664, 0x04a148a3, 0x6a615521, 
-    0xd462fc37, 0x070c0c61, 0xc8fd0505, 0x1524f004, 0x000f190a, 0x2a22bf89, 0xbf822d00, 0x2a2c2d23, 0x26bf8219, 0x0706011b, 0x843f3635, 0x37252205, 
-    0x054d4124, 0x5f170121, 0x700807d8, 0x2536010f, 0x0f040615, 0x27010301, 0x7757d007, 0x4eaa8b5a, 0x01cc9be8, 0xe5fe2802, 0x786b2ddb, 0x31134281, 
-    0xa5a2a216, 0xfe5ea94e, 0xd044caff, 0xfebf3f01, 0xa1166fe0, 0x051d9b01, 0x1601bffe, 0x97fc6968, 0xab88f77a, 0x7f6bcaef, 0x32efe664, 0x22525a61, 
-    0x0209180a, 0xf3fd3304, 0xa610291a, 0x69d8522c, 0x671dc830, 0x00fe0f4c, 0x0e06b704, 0x37a78200, 0x045bff58, 0x00a70579, 0x0013000f, 0x0609405f, 
-    0x48010205, 0x4700010f, 0x3a05ac59, 0x02070817, 0x00010504, 0x065d0004, 0x01030301, 0x01010259, 0x4c033c01, 0x821f401b, 0x23128209, 0x61030104, 
-    0x00232383, 0x83550400, 0x00042207, 0x232e8459, 0x1040594d, 0x4d080082, 0x13131013, 0x13111111, 0x08091111, 0x37172b1b, 0x13211123, 0x15330717, 
-    0x15210121, 0x01010b21, 0x59e31121, 0x728602e4, 0xfee4599e, 0x02e6fed8, 0x727afd42, 0xfe1a0101, 0x04dd6668, 0x3f1c0114, 0x40fdaadd, 0x01e4feaa, 
-    0xfdc002c6, 0xaf920040, 0x02090a23, 0x20af8e03, 0x20808201, 0x23af8301, 0x59030202, 0xa7609f82, 0x821f2005, 0x01062509, 0x02030102, 0x0123af83, 
-    0x83010000, 0x010121af, 0x0121af84, 0x82af8b00, 0x20af88ad, 0x20a98235, 0x26b38435, 0x01032111, 0x82012311, 0x280125af, 0xbefd1a01, 0xaf82b585, 
-    0x7e4e022a, 0xdd66e6fe, 0xaac002aa, 0xfb21b183, 0x30af8aec, 0xff580001, 0x0479043e, 0x001400f4, 0x0f0a4068, 0x21818201, 0x6f5e144a, 0x00612110, 
-    0x60066f5e, 0x24200f73, 0x8c066f5e, 0x156f5e20, 0x00841120, 0x21096f5e, 0x305b1121, 0x0c825d06, 0xb1fd6722, 0x37053f5b, 0x5220d2fe, 0x18fe6001, 
-    0xaa6658a7, 0xaabc0380, 0x1aaa98fd, 0x00d0aa66, 0xb39f5c82, 0x04000527, 0x61040503, 0x062a6000, 0x2092b391, 0x3520b3a6, 0x0383b582, 0x8d5ab38f, 
-    0x25b38c05, 0xaa6802aa, 0xb38844fc, 0xedfe563d, 0x3f047704, 0x61002700, 0x101a2040, 0x0102030a, 0x03012026, 0x4a020003, 0x6918191f, 0x0a2406da, 
-    0x09274801, 0x2938e66a, 0x252d25b6, 0x18080425, 0x4f18052b, 0x37210f8d, 0x05bf4625, 0x4a182520, 0x27240b08, 0x43d30103, 0x09944f18, 0x5a3c5226, 
-    0xecfd301d, 0x24056146, 0x573278fe, 0x9d4f184a, 0xf43e2408, 0x18062701, 0x21099d4f, 0x6c47a7d2, 0xdf7b2206, 0xa34f1822, 0x00f02407, 0x87000100, 
-    0x002825e3, 0x1b214062, 0x2721e384, 0x20e38521, 0x057d7320, 0x12131427, 0x48010b11, 0x20e4bb28, 0x23e4972e, 0x012d3505, 0x0520e782, 0x0f7a5018, 
-    0xc747e592, 0x3ffe2305, 0xe6993e45, 0xb6a7d422, 0x2305da47, 0xedfe108d, 0x0220e88a, 0x4b20e782, 0x35066767, 0x4065002f, 0x191f2220, 0x2e010203, 
-    0x03031028, 0x274a0200, 0x6d672021, 0x010a2406, 0x41182f48, 0x123108cd, 0x03000200, 0x005f0302, 0x5b000101, 0x3a000000, 0x1db36c00, 0x2a2c0b28, 
-    0x1b1d2325, 0x6e671416, 0x0fe04113, 0x0cee4b18, 0x03272622, 0x21157367, 0x511847fd, 0x74671d84, 0xa6fc2111, 0x1f975118, 0x41fe5621, 0x0c37050b, 
-    0x65002d00, 0x1d202040, 0x01020317, 0x030e262c, 0x4a020003, 0x671e1f25, 0x0a240681, 0x162d4801, 0x2a390b41, 0x2123282a, 0x1214191b, 0x67140804, 
-    0x01200d87, 0x671f0941, 0x0121128c, 0x1d064168, 0x21118f67, 0x064195fd, 0x03003b1d, 0xea015000, 0x1b037f04, 0x17000b00, 0x37002300, 0x03053440, 
-    0x00000102, 0x07835701, 0x5b000133, 0x02070408, 0x01000506, 0x18194f00, 0x00010c0d, 0x0458181f, 0x18092010, 0x200e5044, 0x0ac66133, 0x6e250b8b, 
-    0x1ec01e1e, 0x16f5181e, 0xea01240b, 0x8e1ef51e, 0x327a8202, 0xf2fecf01, 0x14067703, 0x19000500, 0x02001640, 0x60730201, 0x3b2207d4, 0x93184c01, 
-    0xd7180742, 0xf9210d88, 0x2022826d, 0x2037825a, 0x20378902, 0x82378200, 0x8259204e, 0x003b2119, 0xd7183788, 0xf8210d6c, 0x891d82de, 0xebc1186f, 
-    0x005d2308, 0x348a0000, 0x3311332e, 0xcf012115, 0x58fef0b8, 0x6df91406, 0x0babd818, 0x37836f84, 0x02000025, 0x825d0200, 0x20a4894e, 0x2a378205, 
-    0x5a012111, 0x58feb8f0, 0x8293067f, 0x3356826c, 0xfd180101, 0x07b803f0, 0x00110086, 0x17b04b3a, 0x0b405850, 0x3f281682, 0x0101004b, 0x1b4c0140, 
-    0x25053e51, 0x0001000b, 0x17837301, 0x1b4c0024, 0xc7820940, 0x82720021, 0x69370820, 0x18b45959, 0x16080217, 0x1a10012b, 0x33373603, 0x11040a06, 
-    0x18012315, 0x72664d2d, 0x57a03777, 0x314b6a8a, 0xdafec316, 0x07023201, 0x6601b401, 0x56e22101, 0x82c1feaf, 0xfeb42701, 0xfe4cfe87, 0x5382eafa, 
-    0x18284882, 0xdb01fcfd, 0x03008907, 0x20208383, 0x25208391, 0x83981284, 0x2205e64b, 0x82113301, 0xc3c3257a, 0x73f68907, 0xfe215383, 0x26d78214, 
-    0x00120089, 0x85b04b28, 0x00002140, 0xe583d788, 0x82057060, 0x20c582e5, 0x20c58418, 0x08bf8226, 0x15333535, 0x17041a10, 0x45180323, 0x445e7282, 
-    0x3d21c325, 0x447b6a56, 0x6c14fea0, 0x30010101, 0x9e016301, 0x1101dc01, 0xe2feeaea, 0x76fe29fe, 0xd9feb4fe, 0x8589f0fe, 0xfd1924c7, 0x41b903f0, 
-    0x3508414b, 0x3327040a, 0x031a011e, 0x02231511, 0x4b3116f6, 0xa0578a6a, 0x66727737, 0xfec32d4d, 0x010601da, 0x017901b4, 0x013f014c, 0xe256af3f, 
-    0x9afedffe, 0xf9fd4cfe, 0x4b41cefe, 0xf6022305, 0x8382fcfd, 0x21424b41, 0x4b41f602, 0xfe192208, 0x41538414, 0x22082b4b, 0x11041a36, 0x10153335, 
-    0x2307040a, 0x7b441901, 0x213d566a, 0x5e4425c3, 0xa0458272, 0x018914fe, 0x82270110, 0x018a33c4, 0xea1e01d7, 0xfeeffeea, 0xfe62fe24, 0xfed0fe9d, 
-    0x13426cff, 0xb8032708, 0x05006d07, 0xc87a3300, 0x43102005, 0x3f2a0777, 0x0202004b, 0x1b4c0240, 0x8f431040, 0x013f210c, 0x0c1adb18, 0x2311212f, 
-    0xa0021801, 0x07c323fe, 0x52f7c36d, 0x5e674200, 0x2522a784, 0x94825850, 0x21066742, 0xa7895902, 0x6c420020, 0x18128705, 0x3009f883, 0x15211133, 
-    0xc3180121, 0x60fddd01, 0x4ef78907, 0x8fa786c3, 0x063b44fb, 0x5344fb8c, 0x003f210a, 0x3520fb8b, 0x022bfb82, 0x0223fef5, 0xaa06c3a0, 0x828ff6c3, 
-    0xf502233c, 0x5382fcfd, 0x63437a20, 0x434e2018, 0x02272763, 0x07c3c3f5, 0x4382f67a, 0x7a200863, 0x8305a341, 0x82102040, 0x21a28214, 0xfb8b0000, 
-    0x01000124, 0x12890072, 0x2121fb89, 0x38fd8211, 0xdd011801, 0xfe60fdc3, 0xf6a308d7, 0x0201009a, 0x04eafd0c, 0x006d07c1, 0x0c6f450f, 0x40825b20, 
-    0x4c013f2a, 0x03242115, 0x012b1708, 0x0a0f7918, 0x0223113d, 0x9a6e3d0c, 0xfe13015d, 0x3b5333e7, 0x5f05ba21, 0x518dc16f, 0x7e5a32b0, 0x8283f84c, 
-    0x01002f36, 0xfcfd1100, 0x8607c602, 0x64002100, 0x8e8219b5, 0x424a0121, 0x13200552, 0x00271b82, 0x63000103, 0x18020200, 0x44083288, 0x132005f2, 
-    0x8708f758, 0x4c02291f, 0x001a401b, 0x72020102, 0x9a181a88, 0xb6340df0, 0x3531161d, 0x2b180804, 0x042e3425, 0x3335012f, 0x35043e32, 0x102ae282, 
-    0x07010e07, 0x1617011e, 0xac831512, 0x29124308, 0x57856344, 0x85563d3d, 0x122a4364, 0x331365ba, 0x11351e1e, 0x08ba3431, 0x4a85cb93, 0x01020824, 
-    0x4c2509bb, 0x0291ca86, 0xfee8fd0c, 0x2f1d9848, 0x1a331011, 0xe5dffe4a, 0x0100e8fd, 0x14fe0c02, 0xcb82c104, 0x3d001022, 0x1120a985, 0x23057341, 
-    0x5b000202, 0x0022aa82, 0xa7820040, 0x02201382, 0x8606d456, 0x40592d13, 0x0e00010d, 0x0006070c, 0x040f0110, 0x68060158, 0x200807f6, 0x03211521, 
-    0x6f995cae, 0x3b21ba3e, 0x19013353, 0x14feedfe, 0x71c08d50, 0x94f86407, 0x315a7e4d, 0x257783b0, 0xc602f4fd, 0x3f428c07, 0x45182005, 0x212011a3, 
-    0x2e283f42, 0x07baba0c, 0x0068f68c, 0xfd100001, 0x41c502ea, 0xcf4209eb, 0x835b2006, 0x410020d0, 0x2e2509eb, 0x35212302, 0x05145821, 0x830b0221, 
-    0xe7fe36a1, 0x9a5d1301, 0x05ba3d6e, 0x5a7e4c67, 0x8d51b032, 0x8bf86fc1, 0x26008200, 0xfd0b0201, 0x41c004fc, 0x062306eb, 0x41010201, 0x02240beb, 
-    0x63020103, 0xeb412582, 0x03022211, 0x947b1873, 0x00002808, 0x1b4c003f, 0x82001a40, 0x00722211, 0x341a8403, 0x57010202, 0x02010100, 0x0102005b, 
-    0x59594f02, 0x363116b6, 0x05eb411c, 0x37125608, 0x2e37013e, 0x19262701, 0x14113301, 0x013b041e, 0x050e0715, 0x02231115, 0x1432330b, 0x32201d33, 
-    0x12ba6512, 0x8564432a, 0x573d3d56, 0x29446385, 0xe514ba12, 0x1d4a2101, 0x31111030, 0xb801981b, 0xf4fd1802, 0x4c86ca91, 0x01bb0925, 0x4a240802, 
-    0xfd93cb85, 0x247d83f4, 0x0214fe10, 0x22cb82c5, 0x4133000f, 0x5f4305eb, 0x45888209, 0x5f430703, 0x2a128607, 0x1525b559, 0x17080320, 0x6a21132b, 
-    0x233d09ce, 0x19011021, 0x213b5333, 0x996f3eba, 0xfeedfe5c, 0x7e5a31c4, 0xf86c074d, 0x8dc0719c, 0x256b8250, 0x00fe0102, 0x8347c702, 0x41232007, 
-    0x834711df, 0x01022828, 0x8907c6c6, 0x5a0077f6, 0x012511af, 0x01020500, 0xad491805, 0x1caf5a08, 0x10111225, 0x5a090b0f, 0x35200baf, 0x25061b5a, 
-    0x21072117, 0x6918030e, 0x01200f57, 0x3106a05a, 0x5e3c3e68, 0x02092a44, 0x97fd016b, 0x5e452c09, 0xa75a1d3b, 0x5a1d2005, 0x312205b7, 0xa65a6701, 
-    0x3a272f07, 0x21a81f47, 0x96273c48, 0x1d322516, 0xd65a311c, 0x26312d06, 0x03000015, 0x23fe7500, 0x75065c04, 0x06370982, 0x30000900, 0x01022d40, 
-    0x4a010001, 0x00020105, 0x02030948, 0x82024701, 0x0001220e, 0x21068255, 0x6d550100, 0x04370805, 0x04070804, 0x03060406, 0x132b1408, 0x21050509, 
-    0xf3017501, 0x0cfef401, 0x97fe6901, 0xd10298fe, 0x68012ffd, 0x25045002, 0xd3fbdbfb, 0xf8026604, 0xfd7208fd, 0x8b010000, 0x03b3246b, 0x82300101, 
-    0x8602203d, 0x202e873a, 0x32278300, 0x04710058, 0x00930479, 0x4b9e0013, 0x585007b0, 0x82051940, 0x06083289, 0x01070002, 0x01096100, 0x59020707, 
-    0x02020104, 0xbf7f183c, 0x821f2008, 0x0701230e, 0x278b5502, 0x02221282, 0x2d825907, 0x18070221, 0x9a077b4a, 0x9f402047, 0x59592742, 0x130e4059, 
-    0x00861112, 0x080a1029, 0x23012b1d, 0x86113335, 0x23152201, 0x28018411, 0xf4f44c01, 0xf5a8e8a8, 0x260482f5, 0x01aa2d02, 0x8344febc, 0x85aa2003, 
-    0x22df8c06, 0x85b8001b, 0x071d2bdf, 0x01030305, 0x03080a0c, 0xe1820900, 0x020b0d29, 0x59020909, 0x82020406, 0x4c0929e3, 0x0ab04b1b, 0x24405850, 
-    0x01230f83, 0x8d550209, 0x2125842c, 0x33835909, 0x87090221, 0xa5509ee8, 0x21f1834b, 0x8c4f1b16, 0x20f98709, 0x20f9820e, 0x23f98a13, 0x33113311, 
-    0x1128fd87, 0xca231123, 0xa2a87272, 0x73210182, 0x41068473, 0x08410a04, 0x350a830a, 0x00030000, 0x042ffe50, 0x000b0681, 0x00100007, 0x4b66001c, 
-    0xea8239b0, 0x05002032, 0x02040108, 0x00630405, 0x5b010303, 0x3b010100, 0x0a891e19, 0x4c004025, 0x881d401b, 0x6a072022, 0x26080fe7, 0x594c033b, 
-    0x11121b40, 0x00010809, 0x1c111518, 0x0c0e1b12, 0x10091008, 0x07000305, 0x08090701, 0x20012b14, 0x82211011, 0x82252003, 0x23022103, 0x61180482, 
-    0x2c080ce3, 0x02e8fd68, 0xfd190218, 0xc68d01e7, 0x0174fec7, 0xc01e1e2b, 0x2ffe1e1e, 0xef03ed03, 0x13fc11fc, 0x0161038c, 0xfcb301b0, 0x029ffc9d, 
-    0x925118bd, 0x01002308, 0x8c189600, 0x0224483b, 0xf1015800, 0x08376318, 0x13407222, 0x0c356318, 0x2a490124, 0xcb740401, 0x001b2106, 0x0a366318, 
-    0x9a180320, 0x44260a71, 0x401b4c00, 0x54180021, 0x032008cd, 0x15e96018, 0x13405924, 0x63180001, 0x54180d1c, 0x3e2010d0, 0x19735918, 0x25106318, 
-    0x07d16518, 0x16096318, 0x03000023, 0x27641800, 0xf45218c1, 0xf902280b, 0x1ec01e1e, 0x779ffc1e, 0x21821ccc, 0x1c410282, 0x2664181e, 0x00012c08, 
-    0x040000a4, 0x00a2042c, 0x5d460035, 0x122005f7, 0x2307c05f, 0x045b0002, 0x5f071a5d, 0x403a18d5, 0x2900010f, 0x0c191b28, 0x0135000b, 0x14080535, 
-    0x2e22212b, 0x27262702, 0x2149012e, 0x1e172f06, 0x031e1701, 0x023e3233, 0x37013e37, 0x1684033e, 0x020e2608, 0x07030e07, 0x32680206, 0x1d4d5961, 
-    0x0c0d193c, 0x040302ad, 0x06080403, 0x4c43340e, 0x44522b26, 0x0c020a31, 0x08128205, 0x04ac0144, 0x0e060906, 0x2b4a3c2c, 0x2c1d0f59, 0x34653c1d, 
-    0x4402789c, 0x240960fd, 0x1e16302d, 0x2c1d0d1c, 0x2013101e, 0x2504182c, 0x2c2c121e, 0xa2020d27, 0x6949bcfd, 0x3415364d, 0x0e2a3c4f, 0x0200001d, 
-    0xe3822500, 0xd505ac2c, 0x0a000700, 0x0ab58900, 0xaa180301, 0x1621085d, 0x2be18202, 0x04004b39, 0x00590104, 0x4b3c0101, 0x4406416f, 0x16210532, 
-    0x20808200, 0x20228e73, 0xd3a41804, 0x84142007, 0x0100271d, 0x01030400, 0x25846104, 0x1b4c0024, 0x09821b40, 0x72000122, 0x58821c86, 0x58825520, 
-    0x0059042b, 0x4d040104, 0xb7595959, 0x08008211, 0x0805102b, 0x33132b19, 0x33132113, 0x21012301, 0x6cd12513, 0xd16e0b02, 0x01f537fe, 0xd556fe4f, 
-    0x7bfed505, 0x2bfa8501, 0x04fdae03, 0x2f3d8200, 0x0300001c, 0x004d04b4, 0x404e0009, 0x0506070b, 0x06276182, 0x4a010001, 0x4830b04b, 0xb882066c, 
-    0x3a010123, 0x189a8301, 0x2c232773, 0x1314b459, 0x2b160802, 0x01270701, 0x2f048233, 0x16022311, 0x24015aa0, 0x5a220152, 0x7003a4a0, 0x23270b82, 
-    0xa05addfe, 0x820090fc, 0xb800277f, 0x19040000, 0x7f846103, 0x82050e21, 0x01082c79, 0x4a020002, 0x47020109, 0x8208b04b, 0xbb911882, 0x12240830, 
-    0x08031111, 0x01372b17, 0x17213523, 0x01352311, 0xe36e02b8, 0x7f3a9c01, 0x027492fd, 0xfe3a7f6e, 0x92fde364, 0x42267b84, 0x8f04e500, 0x7b827d03, 
-    0x25402832, 0x00020708, 0x064a0101, 0x48010205, 0x47000109, 0x0f149218, 0xaf611120, 0x21372a05, 0x37272135, 0x03011501, 0x87c28212, 0x3f012ace, 
-    0x5aa0a4a0, 0xfe52ddfe, 0x893782dd, 0x406323d3, 0xd382040f, 0xd3840720, 0x82020321, 0x6bd4855a, 0x662005f9, 0x02268582, 0x0202005a, 0x5d41023a, 
-    0x82102007, 0x05964d3e, 0x40211787, 0x23128615, 0x55000202, 0x00283086, 0x59594e02, 0x101412b5, 0x252be883, 0x01370133, 0x07113335, 0x82430221, 
-    0x29e386d9, 0x746e027f, 0xfee392fd, 0x33823a64, 0x230ce741, 0x070a404d, 0x0520e583, 0x3a45e641, 0x33111737, 0x01173711, 0x5a1c0123, 0x5aa0a4a0, 
-    0x0152defe, 0x03a05a23, 0x8290fc70, 0x41dd200c, 0x63250de3, 0x01030f40, 0x28138201, 0x4a020102, 0x00020405, 0x070f4148, 0x0021a282, 0x41048266, 
-    0xfd82100f, 0x178b7220, 0x1a2c5c19, 0xf8411420, 0x33112905, 0x01170115, 0xb8211533, 0x28090441, 0x02e39c01, 0x92fd746e, 0x207b827f, 0x09f74100, 
-    0x2640292b, 0x01020001, 0x034a0100, 0x228c8202, 0x5f020809, 0x142f12ac, 0x2b160802, 0x17013513, 0x21152107, 0x89420717, 0x080221de, 0xf582eb84, 
-    0x200ecb42, 0x20e7834f, 0x23578202, 0x4a020200, 0x00205582, 0x8208cc42, 0x67002710, 0x02020100, 0xd5835501, 0x02005926, 0x1b4d0201, 0x0222d483, 
-    0x178f7300, 0x11b55923, 0x2dd38412, 0x11231501, 0x23152137, 0x37010701, 0xcc853a7f, 0x8b09d542, 0x000f29d3, 0x092c402f, 0x04000108, 0x4a2b7d82, 
-    0x02030607, 0x0f480004, 0x180a0b0e, 0x2007e448, 0x21aa8355, 0x1d820059, 0x8a174d21, 0x372726d9, 0x27011501, 0x21df8737, 0xa7439302, 0x6dfd2307, 
-    0xe7865aa0, 0x2306e142, 0x5aa0a05a, 0x01204483, 0x30073b44, 0x4053000f, 0x0b0c0d10, 0x0508090a, 0x01020304, 0x3e59420b, 0x02161729, 0x012b1608, 
-    0x44111737, 0x5f420743, 0x08484407, 0x8d086742, 0xddfe37a8, 0x00020000, 0x0400002a, 0x004d04a6, 0x00130009, 0x1110405c, 0x9b820f10, 0x05060722, 
-    0x0d28998c, 0x00000102, 0x01034b3c, 0x840bdc44, 0x59012114, 0x08ed9718, 0x4d4c1320, 0x2e16820c, 0x594d0100, 0x1414b659, 0x08041314, 0x42132b18, 
-    0xed4409fc, 0x432a2008, 0xba200805, 0xa420ad88, 0x21093242, 0x0245ddfe, 0x0100210e, 0x2a088f42, 0x40320011, 0x0200012f, 0x41010002, 0x112707b9, 
-    0x040c0d10, 0x84014702, 0x82552015, 0x02002106, 0x02279d82, 0x134d0200, 0x84141311, 0x01352383, 0x4d180717, 0xc04107e0, 0xe3012c09, 0xce638e94, 
-    0x8e93d1fe, 0x417dfe63, 0xfa2308c1, 0x82a4a852, 0x05bf4103, 0x3124778a, 0x0b0c2e40, 0x012e7682, 0x06090a4a, 0x48010405, 0x030d0e11, 0x49184700, 
-    0x172312ad, 0x84111113, 0x23372276, 0x45758335, 0x7782050c, 0x63ad0725, 0x822f01ce, 0x8301216e, 0x24073a42, 0x01941dfe, 0x27708637, 0xfe52ddfe, 
-    0xfaa05add, 0x280bab42, 0x403d0011, 0x0001033a, 0x29dd8201, 0x01100003, 0x4a030304, 0x7c820102, 0x47040132, 0x04000100, 0x01025501, 0x03010500, 
-    0x61030004, 0x2009e846, 0x23008311, 0x1a080614, 0x23069343, 0x21153335, 0x8e820182, 0x29069b43, 0x01a45b01, 0xa48ffe71, 0xf789a5fe, 0xfaa4fa23, 
-    0x41f582fa, 0x7b820b6b, 0x0101083f, 0x020a0b02, 0x010d0100, 0x4a030005, 0x48020109, 0x4705010c, 0x05010200, 0x01035502, 0x208e1801, 0x17112110, 
-    0x10207c82, 0x81187b83, 0x37430766, 0x23152a07, 0x90feb201, 0x01a47001, 0x23fe885c, 0xdf01a4a4, 0xfc887784, 0x17267f89, 0x40404300, 0x7b83030a, 
-    0x00010c29, 0x16000304, 0x8204020f, 0x020b27ff, 0x17480102, 0x0141020e, 0x4186821d, 0x33240901, 0x33153335, 0x23248786, 0x23352315, 0x22060741, 
-    0x87f8a4f7, 0xa4f8228a, 0x0a0b41f7, 0x4108c743, 0x19240e13, 0x44404700, 0x25068f41, 0x01180005, 0x8f410506, 0x01193605, 0x01034706, 0x01060001, 
-    0x02020455, 0x02070900, 0x05000605, 0x2b128261, 0x08590601, 0x06010601, 0x1116174d, 0x14230086, 0x411d080a, 0x97840599, 0x2007ca7a, 0x25998d35, 
-    0xbdbda474, 0x958c74a4, 0xa4fafa23, 0x420082fa, 0x93840e9b, 0x01010c36, 0x020e0f02, 0x01110100, 0x4a030007, 0x4802010d, 0x47070110, 0x241e444f, 
-    0x11111819, 0x20958417, 0x20938410, 0x05587b23, 0x240f2d41, 0xbcfe2315, 0x418b82bc, 0x74200a2c, 0x2105b841, 0x2941fafa, 0x00fa210a, 0x26080082, 
-    0x00420001, 0x038f04d1, 0x00170091, 0x12344037, 0x04050611, 0x4a010100, 0x0b0c0f10, 0x01060708, 0x13141748, 0x43050304, 0x17331639, 0x18080411, 
-    0x2337252b, 0x35010717, 0x21071701, 0x41071713, 0x212507b8, 0x32d20103, 0x296f83e5, 0xa05a2301, 0x8c3c0601, 0x4842f732, 0x3ce82308, 0x0c83eef1, 
-    0x1b845220, 0x82200e21, 0x0652420c, 0x44f2fe21, 0x1f3f0a3f, 0x4a404d00, 0x0002030e, 0x01101101, 0x00050400, 0x0602131e, 0x0f4a0305, 0x48010202, 
-    0x4102121f, 0x1d2220c5, 0x3241111c, 0x12c54106, 0x420b6142, 0xa7240a65, 0xa8863886, 0xa820a987, 0xa7200c82, 0x410a6942, 0xfa200d41, 0x0806db41, 
-    0x8b015921, 0x61037804, 0xb4003c00, 0x5005b04b, 0x000c4058, 0x3a000101, 0x02032122, 0x1b4a0204, 0x8c11b04b, 0x82012013, 0x21228d13, 0x37855959, 
-    0x00202008, 0x01000401, 0x00010355, 0x00020400, 0x02006304, 0x57020505, 0x05020200, 0x0501065b, 0x864f0502, 0x821b204b, 0x01042521, 0x01000201, 
-    0x40202292, 0x593c45a0, 0x140a4059, 0x272d2c2b, 0x08071111, 0x37132b1b, 0x1e211521, 0x011e1703, 0x37363233, 0x23051a66, 0x16323336, 0x17231082, 
-    0x18032e07, 0x080817af, 0x07030e7b, 0x26222306, 0x2315012f, 0x9c013a59, 0x0d03f5fe, 0x121d2719, 0x341b2339, 0x070a081a, 0x1a090405, 0x2e1c2d24, 
-    0x205c3c34, 0x6a0c2414, 0x1e171003, 0x1b1f1910, 0x110e1838, 0x24180805, 0x32301e2e, 0x6d225d39, 0x3a27037f, 0x1e11047f, 0x2115222e, 0x0e091e1a, 
-    0x16090f0e, 0x0e282e31, 0x17263517, 0x09431d3d, 0x091b1e1b, 0x111c1a0e, 0x2f120e1f, 0x170f2b30, 0xe0802834, 0x21008200, 0x67410001, 0x00382207, 
-    0x06435c74, 0x01013630, 0x02001602, 0x4a020103, 0x360b401b, 0x0d870401, 0x20855920, 0x01051b27, 0x01010402, 0x24ed1803, 0x01062a0d, 0x4f000300, 
-    0x0020401b, 0x231e8204, 0x02010557, 0x1047ed18, 0x59312285, 0x11120a40, 0x292c2b35, 0x1b080723, 0x0e07012b, 0xa8a11801, 0x8206200c, 0x27072410, 
-    0x4137033e, 0x1e23072d, 0x41161703, 0x6f080643, 0x17213521, 0xf9032311, 0x385d246d, 0x1a1a4e67, 0x172d1208, 0x23101b0e, 0x160f1432, 0x200b6a02, 
-    0x2c182d28, 0x265b3736, 0x07091b18, 0x141a120d, 0x39221f19, 0x152b2512, 0xf5fe0206, 0x7f3a9c01, 0x2b806b02, 0x331f5c31, 0x0b2e2d14, 0x17200707, 
-    0x43082411, 0x2730361c, 0x2d2e170c, 0x1116341d, 0x0c15181c, 0x2b15210f, 0x02091a33, 0x64fe3a7f, 0x080b8746, 0x4e005633, 0x2a2e4b40, 0x05040104, 
-    0x02002f01, 0x4a020003, 0x02032c2d, 0x56480104, 0x04303155, 0x01074704, 0x00040003, 0x00700403, 0x00050001, 0x02630501, 0x210d8201, 0x06825700, 
-    0x5b040033, 0x00040106, 0x28244f04, 0x292f2428, 0x08082c28, 0x06fe441c, 0x20062242, 0x05857737, 0x0120f388, 0x3f21f387, 0x07524301, 0x07062630, 
-    0x2223010e, 0x27262726, 0x2627012e, 0x0e822223, 0x06200283, 0x2e221383, 0xd1450701, 0x08260807, 0x16171c13, 0x0b0f060e, 0x05040f12, 0x1b2c0b02, 
-    0x37231e1c, 0x06100b11, 0x070a0a06, 0x080f0a0a, 0x1b12100c, 0x8d430f19, 0x06210807, 0x14080c0e, 0x3621252f, 0x03081916, 0x0908090e, 0x03050f12, 
-    0x1b2e0a02, 0x3023201a, 0x0d0c0817, 0x08aa4307, 0x11090236, 0x0c081218, 0x060c0614, 0x1111432a, 0x28111a29, 0x070d1213, 0x0e255782, 0x040b1016, 
-    0x08084503, 0x0a0a013b, 0x2023291a, 0x150c2626, 0x05150605, 0x4528070b, 0x1e251111, 0xa0010a0a, 0x0ddb475a, 0x2137cb48, 0x684b3733, 0x87272006, 
-    0xfa962bf6, 0x2602a05a, 0x5aa0dafd, 0xb18896fa, 0xa4201382, 0x75831082, 0x220bc74e, 0x18560011, 0x4e16abb1, 0x4b5f38cf, 0x27072306, 0xe5493537, 
-    0x17152306, 0xd74e2707, 0x49fa2005, 0x8f8308e3, 0x85260221, 0x230125a2, 0xa05addfe, 0xfd21b683, 0x0cdf49da, 0x20316749, 0x05704e01, 0xe0471720, 
-    0x01072508, 0xdafda0c8, 0x804e698f, 0x0aaf4605, 0x300d1341, 0x0f124055, 0x0b0c0d0e, 0x0506090a, 0x01020304, 0x3ea14b0d, 0x23061241, 0x27351737, 
-    0x2106024b, 0xa34b1507, 0x08984107, 0x4106094e, 0xfe220dbd, 0x7b4f00dd, 0x000e280c, 0x082b402e, 0x4c030001, 0x0e230aae, 0x4c090a0d, 0x162012ae, 
-    0x250aae4c, 0x17071737, 0xad4c2707, 0xfa1c2808, 0x5af2f25a, 0x42e4fdfa, 0x10830a1e, 0x270d9342, 0x402d000e, 0x0108092a, 0x0b226b8c, 0xf34d030a, 
-    0x06194d11, 0xdd823720, 0x2009e04a, 0x21518342, 0x184d1c02, 0xfae42308, 0x64853f01, 0x2412df49, 0x4039000d, 0x08db4a36, 0x02010c23, 0x054b4903, 
-    0x02010d2e, 0x00010047, 0x00550102, 0x02030000, 0x2005d94a, 0x05064e02, 0x11111122, 0x220ad24b, 0x4a113335, 0x022509d3, 0xfda4a4cc, 0x22dd8934, 
-    0x84fa68fd, 0x08834ddb, 0x63000d2b, 0x08090b40, 0x02030407, 0x05707c06, 0x58503024, 0x0a821140, 0x024b3c24, 0x9b180001, 0x895309c0, 0x21188205, 
-    0x9b180100, 0x592b27d9, 0x141411b6, 0x18080410, 0x4d33252b, 0x33240892, 0x1c012115, 0x240afe42, 0x02a468fd, 0x081b41cc, 0x42a43421, 0x0d3c0af7, 
-    0x36403900, 0x00010104, 0x02020607, 0x03010901, 0x054a0302, 0x08480001, 0x00470301, 0x21168b77, 0xc7761711, 0x82132005, 0x09634b67, 0x638d4220, 
-    0x427d0321, 0xf3420cf1, 0x000d2b0b, 0x0b0a405f, 0x0102090a, 0xce520305, 0x5a112008, 0x8d530715, 0x5035250b, 0x000f4058, 0x32276077, 0x1114b659, 
-    0x08041311, 0x37012b18, 0x35231117, 0x50231521, 0xfa2208fd, 0x8f839802, 0x41050051, 0xfe2107b1, 0x0c2b4fdd, 0x69001324, 0x8b431140, 0x06072605, 
-    0x02030405, 0x52ad410c, 0x41171721, 0x272006ad, 0x200c434f, 0x05b34107, 0xa05afa22, 0x2608b544, 0xfafa5aa0, 0x82a468fd, 0x18022112, 0x2008bc41, 
-    0x411582e8, 0x0b2114bf, 0x08bf4102, 0x00010324, 0xbf410a48, 0x1114211a, 0x22053142, 0x51113313, 0x01350738, 0xa4422311, 0xa05a2301, 0x34fdcc02, 
-    0xddfe5aa0, 0xfe7d03a4, 0x201083dd, 0x467a85a4, 0x0d340b3f, 0x32403500, 0x02010105, 0x0002070c, 0x064a0201, 0x0d480201, 0x57796f83, 0x14112116, 
-    0x4505974e, 0x012b062f, 0x23113311, 0x6e020111, 0x4234fda0, 0xa4210596, 0x536b82a4, 0x013d06a6, 0x0168fd23, 0x00ddfe23, 0x00420002, 0x048f0400, 
-    0x000d00d6, 0x4088001b, 0x01010422, 0x31e58400, 0x0402151a, 0x144a0305, 0x13060209, 0x0203020a, 0xf0820349, 0x07011b23, 0x053f4347, 0x01002338, 
-    0x01060200, 0x00006102, 0x00050300, 0x05006103, 0x05070400, 0x9b186104, 0x40210b86, 0x24258828, 0x06070306, 0x252b9655, 0x594d0706, 0xc0820b40, 
-    0x11141228, 0x08081014, 0x34412b1c, 0x41d28d0d, 0x02210e42, 0x21e18c2c, 0x5141d604, 0x1cfe250c, 0x5aa0a4a0, 0xf0861283, 0x2a097b45, 0x22002304, 
-    0x30403300, 0x4f020203, 0x02270680, 0x0221224a, 0x82004703, 0x0200230f, 0xd8826301, 0x230c8773, 0x241a112b, 0x37097050, 0x3e373632, 0x26343501, 
-    0x23012e27, 0x17163235, 0x06141516, 0x23030e07, 0x37089245, 0x10322045, 0x0f161411, 0x38193011, 0x28562f66, 0x2f2f152d, 0x93fd102b, 0x3508c344, 
-    0x2f111015, 0x0e2d1d1a, 0x27a41411, 0x3676552e, 0x20142d6c, 0xcf470b16, 0x059b5006, 0x2329a382, 0x2f403200, 0x03021f20, 0x249c8202, 0x4a020300, 
-    0x059b5523, 0x20053360, 0x25a48203, 0x03030057, 0x08825900, 0x2a4d0025, 0x43111d11, 0x2123059a, 0x82022e22, 0x3435219a, 0x3322a683, 0x9b822215, 
-    0x14150127, 0x011e1716, 0x08be5533, 0x1093fd39, 0x15302e2a, 0x262f2432, 0x19346d2d, 0x160f1130, 0x32101114, 0x42450220, 0x0139058e, 0x150ba03f, 
-    0x6b311520, 0x256b3f30, 0x14a4282c, 0x1d2d0e11, 0x10112f1a, 0x060d4915, 0x02000022, 0x212da788, 0x49003400, 0x02034640, 0x01060002, 0x29058200, 
-    0x02030120, 0x01214a03, 0xab604703, 0x06002806, 0x63060100, 0x83020507, 0x8357201d, 0x02002407, 0x8201045b, 0x234f300e, 0x222c2e22, 0x11342334, 
-    0x14262c11, 0x4a190808, 0x21200540, 0x3220bd86, 0x5e41b683, 0x012b2905, 0x21352315, 0x32010717, 0x84097d41, 0x011d3ddb, 0x5a230142, 0x283201a0, 
-    0x3f6a232b, 0x2b25673d, 0x172d282b, 0x0f282f31, 0xcefea497, 0xff2ecf82, 0x1411273b, 0x2f101213, 0x0f311717, 0xd153150f, 0x377d3306, 0x32232b6c, 
-    0x692a2430, 0x2c68383b, 0x0a152017, 0x2c82d5d5, 0x11259e2f, 0x2e191a2f, 0x16160f11, 0x1a310f0f, 0x2de78e7d, 0x1e414044, 0x0504021d, 0x00021f20, 
-    0xe3820204, 0x00470136, 0x73010001, 0x05000300, 0x63050304, 0x04020607, 0x57040000, 0x043b0783, 0x01025900, 0x4d000400, 0x34222222, 0x162c3322, 
-    0x1111112d, 0x2b1a0808, 0x82213701, 0x41f982cb, 0xe9840aa7, 0x21011d27, 0x15013727, 0x075d4209, 0x3b08bb41, 0x12033316, 0xa4cefea0, 0x2f280f97, 
-    0x282d1731, 0x67252b2b, 0x236a3f3d, 0x3201282b, 0x0805b141, 0x1470fe26, 0x162e1111, 0x12103017, 0x27111413, 0xa03f013b, 0x150ad5d5, 0x682c1720, 
-    0x2a693b38, 0x23323024, 0x7d376c2b, 0x3506be41, 0x1b7d9e01, 0x1411112e, 0x2e110f16, 0x112f1a19, 0x01000025, 0xb8827200, 0x95055f36, 0x06000d00, 
-    0x01060db3, 0x03252b30, 0x01131737, 0x01031713, 0x28080882, 0xefbf0205, 0xfd7a8467, 0x5aa0973d, 0xb8b5c302, 0x0db1fe4a, 0xb94a5001, 0x56fed402, 
-    0xfd1e7d03, 0xfbaa01ec, 0xef6884c6, 0x080f5600, 0x65051a38, 0x64000b00, 0x04051140, 0x03010002, 0x00020202, 0x06074a02, 0x8f7c0102, 0x55102006, 
-    0x0122068e, 0x08584b3c, 0x503e2608, 0x00104058, 0x06776302, 0x01005929, 0x4c003c01, 0x8515401b, 0x09f37d12, 0x01000030, 0x59594d00, 0x101711b5, 
-    0x2b170803, 0x57502101, 0x23112507, 0x1efe7603, 0xde34e682, 0xa05a2201, 0x03a48602, 0x015aa0c7, 0x23015223, 0x95fba05a, 0x9c479b94, 0x57022006, 
-    0xe4440508, 0x08da6705, 0x6f6b9b91, 0x013c210a, 0x9d189b85, 0x9b881321, 0x46491320, 0x23112408, 0x828402b8, 0xfe24298d, 0xfea05adc, 0x6b04a420, 
-    0x23068e41, 0x39fca05a, 0x230f3741, 0x032c402f, 0x28069f44, 0x4a020002, 0x02020a0b, 0x140e5947, 0x14111125, 0x43170803, 0x11260637, 0x17211133, 
-    0xfb83b807, 0xa4e20124, 0xfb887afd, 0xfbc70325, 0x8e5aa095, 0x402e29ff, 0x0207082b, 0x090a0102, 0x63826282, 0x82000121, 0x01022c62, 0x00020072, 
-    0x00550200, 0x82000202, 0x00022331, 0x575a114e, 0x37252205, 0x2c5f8321, 0x15013727, 0xa09c0201, 0x01a47cfd, 0x23ce87e0, 0x39fc6b04, 0x2f081b44, 
-    0x00ba0001, 0x04170400, 0x000b0052, 0x090a405d, 0x01216482, 0x2cac1805, 0x43f84109, 0x13111422, 0x0126f583, 0x21111737, 0x87482135, 0x5a7f2605, 
-    0x0241fea0, 0x28868463, 0xa05a2301, 0xfca4d102, 0x0589598b, 0x0100002a, 0x00004000, 0x5d039204, 0x51229382, 0x5b411140, 0x05de6110, 0x27821620, 
-    0x66010023, 0x5afb8300, 0x1b200a72, 0x20178a5a, 0x127d41b5, 0x22014022, 0xd2237b82, 0x418afca4, 0x0125087d, 0xa09dfdbf, 0x355b825a, 0x04580151, 
-    0x00e50380, 0x40330021, 0x011e1f30, 0x1d020103, 0x05820202, 0x01004a2c, 0x01020302, 0x03007003, 0x7e847103, 0x82005721, 0x005b2a06, 0x4f020002, 
-    0x28152519, 0x05745704, 0x5105524f, 0x23200672, 0x08058446, 0x07062244, 0x011d010e, 0x23011737, 0x01a05a51, 0x3a394204, 0x8f585490, 0x013f3937, 
-    0x1b222998, 0x5e343d5a, 0xa01a2c24, 0x52ddfe5a, 0xa05a7b02, 0x39945818, 0x363e3a39, 0x38558f39, 0x2f1d2363, 0x672c2328, 0x27411734, 0x20a39109, 
-    0x22a38800, 0x87000300, 0x7e0220a3, 0x0882088a, 0xa3820020, 0x462a1321, 0x172f0580, 0x022e3435, 0x23012e27, 0x15060722, 0x82013e23, 0x20af85b2, 
-    0x3ba2841f, 0xa05ae801, 0x141b1107, 0x6d395425, 0x01984b48, 0x8f373741, 0x3a905458, 0x0103403c, 0x1735a388, 0x282e3724, 0x4d282514, 0x90576d50, 
-    0x3a3e3636, 0x52983b39, 0x28a38718, 0x00320002, 0x049e0400, 0x318e821a, 0x4061000d, 0x0401070f, 0x02010403, 0x0d4a0204, 0x3e5d020c, 0x001e2a07, 
-    0x02040402, 0x00000067, 0x20b58201, 0x64c21961, 0x00592109, 0x4d232d82, 0x821d401b, 0x73022120, 0x59251f97, 0x121211b7, 0x05535e11, 0x21152122, 
-    0x2609875a, 0xfb6c0432, 0x5a050194, 0x0424078c, 0xa4fe501a, 0x2407655d, 0x00020000, 0x399b8246, 0x0046048b, 0x000f0005, 0x091240be, 0x06040501, 
-    0x0e050301, 0x03030201, 0xdd5d0f4a, 0x001f2708, 0x05020503, 0x45186803, 0x0024071d, 0x59000101, 0x71448c82, 0x5025240a, 0x85204058, 0x70022126, 
-    0x3520279a, 0x1e202782, 0xef822788, 0x01000423, 0x5d2f8861, 0x40210564, 0x22208824, 0x82710202, 0x85012067, 0x994f1824, 0x5959230e, 0xf7830940, 
-    0x83181120, 0x23200952, 0x4627fa89, 0x04fc4504, 0x88630149, 0x494623fb, 0x8d5b03fc, 0x8600200b, 0x828c20ff, 0x820920ff, 0x40bb33ff, 0x01010212, 
-    0x00010404, 0x02010701, 0x034a0300, 0xf85c0401, 0x001f2106, 0x00228182, 0x8a826801, 0x00030227, 0x04006202, 0x2dfa8204, 0x5a050303, 0x3a050500, 
-    0x4b1b4c05, 0xff8423b0, 0x3f822682, 0x279a7020, 0x1d25ff83, 0x04010400, 0x08435e72, 0x4c8a5184, 0x93224021, 0x0505241f, 0x85005503, 0x05032325, 
-    0xfc84594e, 0x12111123, 0x20fc8414, 0x085d5e01, 0x1121053b, 0x01211133, 0x92fde4d0, 0x7e6e0274, 0xfe64fe3a, 0x4afc0376, 0x6401bafb, 0x076b5e02, 
-    0xfc039c24, 0xa382bbfb, 0x5900013a, 0x78040000, 0x2e00f903, 0x0c408e00, 0x03040121, 0x0308091e, 0x4a020402, 0x2205f05d, 0x8202001b, 0x680234a9, 
-    0x04000300, 0x61040302, 0x00010100, 0x0001055b, 0x83003a00, 0x20cb83f3, 0x2122851c, 0x23947001, 0x91214021, 0x0000231e, 0x48875701, 0x4f000122, 
-    0x113dc882, 0x24250001, 0x1f202223, 0x2e001113, 0x08062e01, 0x22212b14, 0x012e2726, 0x17373435, 0x07114a0e, 0x2206cb4a, 0x412f022e, 0x172107e4, 
-    0x081b821e, 0x0e070653, 0x674f0201, 0x4c4845b6, 0x31347794, 0x792d3133, 0x2f7c4649, 0x1b0f352e, 0x7f211624, 0xe39c013a, 0x4b494b1d, 0x4db74648, 
-    0x67b84845, 0x33739aca, 0x7b48447a, 0x34362d30, 0x457d2e2f, 0x36414724, 0x01e31c12, 0x1d7f3a9c, 0x6864b54b, 0x4e4548b6, 0x111b4100, 0x01010e29, 
-    0x11262702, 0x41010303, 0x0330091b, 0x03010401, 0x00020068, 0x01020301, 0x04040061, 0x84111b41, 0x70042122, 0x40222394, 0x1e900021, 0x04000023, 
-    0x20488757, 0x071b4104, 0x101c1e27, 0x0b0c0d0f, 0x0f1b410a, 0x613f3621, 0x0722073c, 0x364b030e, 0x06244106, 0x37272622, 0x2a05ea4b, 0x67820201, 
-    0x4f4546b7, 0x841d494c, 0x215b08e3, 0x0f1b2416, 0x7c2f2e35, 0x2d794946, 0x34313331, 0x484c9477, 0x454eb645, 0x666bb545, 0x7f1d49b6, 0xe364fe3a, 
-    0x4136121c, 0x7d452447, 0x36342f2e, 0x487b302d, 0x73337a44, 0xb867ca9a, 0x004d4548, 0x01420001, 0x038f04df, 0x0006007d, 0x00204023, 0x01000101, 
-    0x0201024a, 0x83004800, 0x0055210b, 0x59200682, 0x01282582, 0x0213114d, 0x132b1608, 0x2005574e, 0x055b5d42, 0x02b3fb23, 0x4e09835a, 0x022108b7, 
-    0x21478b83, 0xd95f0506, 0x84112013, 0x21353247, 0x07172115, 0xfc4d0442, 0x025aa090, 0xa0a47b08, 0x246b825a, 0x16020100, 0x051b6300, 0x4a000627, 
-    0x020304b7, 0x3e345303, 0x83101421, 0x0814636e, 0x22017c28, 0x04a4a05a, 0x0c63fe4d, 0x01012806, 0x0200001c, 0x824d04ba, 0xb74a22b7, 0x06125302, 
-    0x413a8763, 0x01240526, 0x33012707, 0x2305ac54, 0xa47a2401, 0x22057d5e, 0x4100b3fb, 0x04210f6f, 0x08066101, 0x850f6f41, 0x05c249b8, 0x87422121, 
-    0x83022641, 0xddfe5aa0, 0x07e7517b, 0x82830221, 0x402223b7, 0x4682051f, 0x064a0122, 0x201d4163, 0x053e6315, 0x0126fc83, 0x7ba4a03f, 0x7382ddfe, 
-    0x27576f41, 0x01173711, 0xa4160223, 0xde21ae82, 0x05e5417c, 0x01276f84, 0x02000047, 0x824d04e5, 0xb64924b7, 0x41020102, 0x6e413ede, 0x17372806, 
-    0x23113311, 0x825a4701, 0x079a42d6, 0x00020029, 0x04410042, 0x8221048f, 0x000d2d6b, 0x00324035, 0x0c000101, 0x02030201, 0x2205e142, 0x8202010d, 
-    0x1800208c, 0x200fa7cc, 0x22208200, 0x5212114d, 0xef42056f, 0x37012506, 0x15213521, 0x2e05ee4d, 0xb3fb7003, 0xfca0d002, 0xfe4d0490, 0x83fe02dd, 
-    0xfea4226e, 0x064f4118, 0x3623738d, 0x82043340, 0x01072473, 0x4b020203, 0x0d2305e3, 0x8403020c, 0x00022374, 0x8f186101, 0x11210f03, 0x06be5112, 
-    0x37272126, 0x11211501, 0x41062343, 0x454107fb, 0x27032c05, 0xddfe5aa0, 0x7be1fe7b, 0x515aa0a4, 0x7c2a084b, 0x13000900, 0x3b403e00, 0x59820708, 
-    0x090c0d27, 0x0b000203, 0x28c9820a, 0x05064a03, 0x13480102, 0x25778312, 0x02000001, 0x77910001, 0xc6511a20, 0x0115220d, 0x08786305, 0x210c7165, 
-    0x5361d6fc, 0x3e022209, 0x268082a0, 0xfe52ddfe, 0x8352c1dd, 0x620d8216, 0x07201707, 0x00208383, 0x620aa162, 0x01204307, 0x22061758, 0x62132311, 
-    0x24200911, 0x22086453, 0x845aeaa4, 0x52de21a0, 0x43053f41, 0xbf8905f1, 0x00ddfe22, 0x02200082, 0x41068b52, 0x0131083f, 0x00010200, 0x08090f10, 
-    0x12010304, 0x03020211, 0x05b84103, 0x2c421320, 0x5614201b, 0x15250b42, 0x01071721, 0x07b16637, 0x210ab864, 0xbc66ad01, 0x0703210a, 0x21073441, 
-    0x484176fe, 0x00002208, 0x08476301, 0x5b00112f, 0x0e0f0f40, 0x08090a0d, 0x00010205, 0x05c44c0a, 0x58503026, 0x01010d40, 0x49054463, 0x364e055e, 
-    0x23148405, 0x01035902, 0x40211485, 0x22248213, 0x62000202, 0x59250cbd, 0x1414b659, 0x05475512, 0x01270725, 0x68371733, 0x1125052b, 0x23112707, 
-    0x053a4101, 0x68cac821, 0xa0200533, 0x21073668, 0x3941c9c9, 0x70032205, 0x053e68a0, 0x41010021, 0x11300833, 0x39403c00, 0x02020c0d, 0x02050e03, 
-    0x0f100201, 0x0332a482, 0x020a0b4a, 0x01114803, 0x03004700, 0x03010200, 0xd5676102, 0x42122010, 0x2520056f, 0x41052541, 0x0721062a, 0x06a04417, 
-    0xb5416985, 0x207d8505, 0x278d82a4, 0xddfe5aa0, 0x52c9c952, 0x4105b741, 0x5a220b27, 0x6b640e40, 0x41092008, 0x12204526, 0x200e6b64, 0x056d6711, 
-    0x23072725, 0x86a05a2a, 0x52de238d, 0x7567c8ca, 0x087b6709, 0x00c9c922, 0x23410082, 0x403d260b, 0x0203043a, 0x05e25401, 0x43000121, 0x00230794, 
-    0x44101148, 0x11291c0c, 0x18080417, 0x3735132b, 0x088d4327, 0x21053447, 0xc642c9c9, 0x24768608, 0xc9522301, 0x858c84c9, 0x0100219c, 0x2708a358, 
-    0x404e000e, 0x0a0b0c0e, 0x20058343, 0x096f4509, 0xa6820c20, 0x024b3c22, 0x820c8a65, 0x18012013, 0x2316bf49, 0x1414b559, 0x4305f84e, 0x27260977, 
-    0x01231107, 0x686a4ec4, 0x524e2706, 0x52525301, 0x0f821e03, 0xddfe232c, 0xe2fc4e5a, 0x52527003, 0x0f4190fc, 0xff9b3c05, 0x033604c6, 0x000e0061, 
-    0x0a114054, 0x0d020001, 0x00030201, 0x050e4a02, 0x67030304, 0x172706a9, 0x00000300, 0x50006703, 0x59220804, 0x0c820101, 0x401b4d23, 0x21198216, 
-    0x18907303, 0x12b6592f, 0x04121311, 0x212b1808, 0x01233501, 0x07414927, 0x49010131, 0xfd746e02, 0x33023a92, 0x3a9c016e, 0x86ccfd7f, 0x7f34270e, 
-    0x7064fe3a, 0x0f5bcbfd, 0x4033290f, 0x050c0d30, 0x01020103, 0x2005be42, 0x22be420e, 0x21370126, 0x27372135, 0x88099b6a, 0x070341f1, 0x4e3f0123, 
-    0x20008252, 0x06a46a4e, 0x013f7482, 0x00009b00, 0x9b033604, 0x6b000e00, 0x06091240, 0x0c020002, 0x02000301, 0x0307084a, 0x4c020402, 0x122006a1, 
-    0x6620e984, 0x435afd82, 0x20318211, 0x21188c72, 0x2d821740, 0x13830220, 0x43030321, 0x032d05f0, 0x0003005a, 0x59594e03, 0x131512b6, 0x05435a10, 
-    0x01370124, 0xb46a3533, 0x70602408, 0x413acbfd, 0x7f2c0b13, 0xfd3a3402, 0x6e027492, 0x6ecdfd3a, 0x4205c06a, 0x4d220b43, 0x43420d40, 0x43082007, 
-    0x0c200962, 0x6b058944, 0x13830c4c, 0x72000222, 0x40211386, 0x8522820a, 0x5969210e, 0x27094242, 0x33111737, 0x03371711, 0x2a055643, 0x4e5a1c01, 
-    0x01535252, 0x5c5a4e52, 0x4e2a05be, 0x90fc1e03, 0x70035252, 0x1282e2fc, 0x3741dd20, 0x7f062011, 0x0329050b, 0x0a4a0201, 0x04040509, 0x08374100, 
-    0x6f820020, 0x01026623, 0x3c5d1801, 0x051f4509, 0x4c181120, 0x03200899, 0x08555d18, 0x7e181720, 0x03220890, 0x33875501, 0x4e030136, 0x11b65959, 
-    0x04111513, 0x372b1808, 0x01153311, 0x33150117, 0x2005dc6a, 0x0f26419b, 0x709c0124, 0x38413502, 0x7fcc2307, 0x9b560100, 0x7d032a05, 0x34000e00, 
-    0x01083140, 0x20a98200, 0x05424601, 0x430d0e21, 0x865c1dee, 0x2115230a, 0xeb431707, 0x23012205, 0x0c0d415a, 0x42054356, 0xbf830656, 0x32095743, 
-    0x03124055, 0x0c010201, 0x02000200, 0x0d0e4a02, 0x6b040809, 0xe9820702, 0x6b020221, 0x29830c02, 0x1b4d0226, 0x00001640, 0x850d036b, 0xb6592918, 
-    0x11121113, 0x2b180804, 0x2d09824f, 0x01152301, 0x7f1a0107, 0x6e9c013a, 0xf4863302, 0x70fb0122, 0x42056043, 0x0020064d, 0xeb6b4f83, 0x000f2f07, 
-    0x40420015, 0x0911143f, 0x06000108, 0x61690203, 0x081b6b08, 0x03020025, 0x18610200, 0x29112655, 0x15101010, 0x17151510, 0x60540514, 0x6b272008, 
-    0x252c082c, 0x07212737, 0x23014217, 0xef014e5a, 0x2b076d44, 0x5a4e11fe, 0x52524d02, 0x52526dfd, 0x43062441, 0x5a250677, 0xfa5a4e4e, 0x83008252, 
-    0x0817459b, 0x59279b83, 0x14151640, 0x6b111213, 0x11200b47, 0x6b3e914a, 0x37271547, 0x11072711, 0x831c0117, 0x05966f8b, 0xfe269482, 0x537b52de, 
-    0xc7915252, 0xddddfe24, 0xca849302, 0x0021b282, 0x08534202, 0x1a00152a, 0x45404800, 0x03000119, 0x380a4c41, 0x10111415, 0x01470404, 0x01060001, 
-    0x02000302, 0x02070861, 0x03040403, 0x38078355, 0x05590403, 0x04030401, 0x1616164d, 0x141a161a, 0x11111113, 0x08091413, 0x06b6551b, 0x07173727, 
-    0x07211533, 0x26038221, 0x17233727, 0x41372507, 0xa336085a, 0xfa366156, 0x015ad2fe, 0x5645fe88, 0x4ee33660, 0x5824015a, 0x5e413efe, 0x3ba83008, 
-    0x52a4526d, 0x4e6c3aa6, 0x52a4fa5a, 0x86030052, 0x00af2ea7, 0x001c0017, 0x40570021, 0x0d1b1e54, 0x3496820c, 0x4a010405, 0x06070a0b, 0x00060203, 
-    0x13161748, 0x060e0f12, 0x2db08502, 0x04000504, 0x08070961, 0x02020503, 0x08845505, 0x5902053c, 0x05020103, 0x1d1d4d02, 0x211d1818, 0x1f20211d, 
-    0x1c181c18, 0x13171314, 0xa7590a14, 0x83332007, 0x061242b8, 0x84072321, 0x013f21ba, 0x212eba82, 0x07232737, 0x5a230142, 0x8c2ec24e, 0x1d429a27, 
-    0x1fe32a07, 0x4e7c1b8c, 0xfe23995a, 0x24bf82fe, 0xfe525293, 0x06244223, 0xba20da22, 0x22082742, 0x857e209e, 0x525222cb, 0x0bc742a4, 0x1a001529, 
-    0x44404700, 0x820f1017, 0x4a012e98, 0x090a0d0e, 0x15480304, 0x00031112, 0x66491847, 0x0676411e, 0x49181720, 0x01260863, 0x21352337, 0x03822137, 
-    0x300a8768, 0x27372507, 0x06010721, 0x2e01fa36, 0x0178fe5a, 0x066f41bb, 0xddfe2329, 0x5dfe4e5a, 0x824b0256, 0x589623b1, 0x71412001, 0xddfe2208, 
-    0x211b8352, 0xaa84faa8, 0x250a7744, 0x403c000f, 0x2d660139, 0x02492705, 0x0f480001, 0x714c0501, 0x9a63180a, 0x83112015, 0x06132200, 0x05de6b08, 
-    0x10422120, 0x83172005, 0x01423207, 0xd0025a23, 0x0377defc, 0x7767fc99, 0x30fd2203, 0x0538415a, 0x82775221, 0x05b34f01, 0x84089f42, 0x010d2a7b, 
-    0x02010e03, 0x010c4902, 0x227b8205, 0x18004700, 0x4a081d49, 0x7b83160d, 0x2408de6b, 0x21352137, 0x71038227, 0xfd3405ed, 0x77220330, 0x990367fc, 
-    0x02defc77, 0x23015ad0, 0x3f01ddfe, 0xfe207985, 0x4406f771, 0x163d076b, 0x34403700, 0x080a0f11, 0x07000106, 0x4a010002, 0x02030709, 0x16480004, 
-    0x0e101215, 0x056e420d, 0x2609104b, 0x02000200, 0x5816174d, 0x332209bf, 0x01833717, 0x07153323, 0x65018327, 0x81280705, 0x9696973a, 0x5c213b96, 
-    0x97220582, 0x475d605b, 0xad432108, 0x43220082, 0x05826aa4, 0x6c6aad21, 0x163c0ce3, 0x33403600, 0x0d0f1415, 0x0704060b, 0x4a010100, 0x0c0e1213, 
-    0x16480104, 0x03050708, 0x260fa46a, 0x00010000, 0x7017164d, 0x3721056e, 0x207b8523, 0x208b8735, 0x05044127, 0x5b60a022, 0x5c228483, 0x84833b21, 
-    0x5d813a21, 0x7d850828, 0x8b85a420, 0x43080259, 0x7d2a0887, 0x0d000900, 0x33001100, 0x6f713040, 0x02042210, 0x219b8202, 0x07835500, 0x5901002e, 
-    0x01020305, 0x114d0100, 0x11131111, 0x2909e36c, 0x17211521, 0x15330107, 0x03822523, 0x23014228, 0x0201a05a, 0x7e82fefe, 0xbbbb3926, 0xbbbb3601, 
-    0x25098971, 0xa4a49e01, 0x008200a4, 0x5f450320, 0x207b8508, 0x12df7485, 0x02001d22, 0x56068542, 0x65180977, 0xaf470ac4, 0x821b2005, 0xdf7c184c, 
-    0x6b66180e, 0x4059222c, 0x26cd8209, 0x06131411, 0x4e2b1a08, 0x1324072a, 0x17331723, 0x15210382, 0x0a1e7523, 0x01a50123, 0x510383a3, 0xfe2906a5, 
-    0xfea05add, 0x7bbb7dfe, 0x418182bb, 0x3222104b, 0xb3742f40, 0x0204270f, 0x00000102, 0x07835501, 0x59000129, 0x00020305, 0x824d0001, 0x1116227c, 
-    0x207c8411, 0x06214a37, 0x4a410920, 0x12032107, 0x01216182, 0x05c74102, 0x41d6fc21, 0x4c66054c, 0xddfe2405, 0x41ddfe52, 0x4b41064d, 0x00033009, 
-    0x00110007, 0x0f0a4084, 0x090a0d0e, 0x76040505, 0x4a41072a, 0x14142167, 0x1808826f, 0x4f0743ec, 0x02270873, 0x01a3a416, 0x4ffba3a4, 0x0426076e, 
-    0xbb7bbb4d, 0x2c42c7fe, 0x05af4d07, 0xf4000233, 0xde030000, 0x06007604, 0x54000d00, 0x02020ab4, 0x068c5d03, 0x01041630, 0x00010103, 0x61000305, 
-    0x05050106, 0x3a4a5902, 0x8c1c2007, 0x02022318, 0x1f875505, 0x02053208, 0x0e40594d, 0x0d070707, 0x12120d07, 0x07101211, 0x012b1908, 0x23010923, 
-    0x11252111, 0x33072733, 0xc8bc0111, 0x76017401, 0x01a8feca, 0xc2c45e12, 0x2c62825c, 0xfc8bfe75, 0x0a0346ff, 0xf6fcc2c2, 0x28008200, 0x00420002, 
-    0x03b804bc, 0x3c9384a6, 0x052f4032, 0x01020301, 0x0204084a, 0x060d4801, 0x00470002, 0x03020001, 0x00610201, 0x20bb8203, 0x09f16055, 0x65161121, 
-    0x01290526, 0x35211121, 0x15270209, 0x23018221, 0xfefc4403, 0x74243e82, 0x10018cfe, 0x03326082, 0x0185010a, 0x8bfec958, 0x75018bfe, 0x5dcc5dc3, 
-    0x03410000, 0xb44c210d, 0x032b6382, 0x33b04b47, 0x14405850, 0x82000102, 0x0300257d, 0x0404005d, 0x2905b978, 0x401b4c04, 0x0001001b, 0x8c780004, 
-    0x64b11805, 0x09402510, 0x11121111, 0x28062d59, 0x11211133, 0x23130133, 0x32018211, 0x01c8f417, 0x8afeca58, 0x5ccc5ec4, 0x037501c2, 0x82fffc01, 
-    0x03262584, 0xc2f6fc0a, 0x8782f682, 0xf7821920, 0xf7898f20, 0x82010c21, 0x0b4a24e6, 0x83000201, 0x470121f7, 0x27082467, 0x02010102, 0x02020055, 
-    0x02229183, 0x6e824d01, 0x08041227, 0x01132b18, 0x28f98215, 0x35210315, 0x17073521, 0x20628519, 0x2e5f844f, 0x013102c2, 0xa8fec975, 0xcc0f01c9, 
-    0x8ac3c35d, 0x000a29f3, 0xb46c0015, 0x06020410, 0x2306f741, 0x06010720, 0x00376082, 0x03610106, 0x01080001, 0x05000905, 0x09010a61, 0x00590409, 
-    0x833a0404, 0x962620ff, 0x04042322, 0x29875509, 0x4d04092b, 0x0b124059, 0x0b150b0b, 0x20a08315, 0x31048211, 0x1d080b10, 0x1133132b, 0x23010923, 
-    0x21113311, 0x06823525, 0x82072721, 0xf4152210, 0x051742c8, 0xfdca2308, 0xcaa40216, 0x5cc2c45e, 0x011801c8, 0xfe7501e9, 0xfe17fe8b, 0x028c46e8, 
-    0xfdc2c27e, 0x00008c82, 0xb3420300, 0x000a2b08, 0x0019000d, 0x040cb48a, 0xbd860502, 0x010c292c, 0x07080005, 0x09610805, 0xc6830701, 0xc6840720, 
-    0x06010a2a, 0x6106000b, 0x0b0b010d, 0x2f20c689, 0x04232b9f, 0x87550b04, 0x830b2032, 0x0e1e27cf, 0x0e0b0b0e, 0x4f180e19, 0x102508c8, 0x0b0d0b0f, 
-    0x22db840d, 0x8b19080e, 0x270123db, 0xde840107, 0xdf8f2320, 0x48bc012a, 0xca770147, 0x4af04c5e, 0x0325e48d, 0xfc4747cb, 0x21e9827b, 0xe9834a4a, 
-    0x1129e78b, 0x7b001800, 0x040c17b5, 0x28e88703, 0x05010922, 0x00010102, 0x23df8405, 0x07060108, 0x0c25df82, 0x07030b0a, 0x20e18907, 0x2324982a, 
-    0x55070404, 0x07202d89, 0x1a32dc83, 0x0b0b1212, 0x18121812, 0x13141516, 0x110b110b, 0xd8841311, 0x1b080d22, 0x200cb441, 0x20d08411, 0x20dc8421, 
-    0x0ab74111, 0xa0520129, 0x5e02c85c, 0x41a05eca, 0x03220cb9, 0xcd829fa9, 0x9f22d582, 0xbb4157fc, 0x00102d0c, 0x407d0017, 0x0101140c, 0x0f4a0105, 
-    0x2123da8a, 0x8302060a, 0x820720db, 0x01082adb, 0x00010307, 0x61000709, 0x0c82420b, 0x23972720, 0x09040423, 0x202a8755, 0x30d68309, 0x0b111119, 
-    0x1117110b, 0x13151617, 0x0b100b12, 0x35d58510, 0x2b1a080c, 0x23372301, 0x17230109, 0x13211123, 0x27331737, 0xa4440107, 0x078e4208, 0xfeca2708, 
-    0x5e5e4ea8, 0x01c2c466, 0xc2c45e28, 0xc839025c, 0x8bfe7501, 0x03c7fdc8, 0xc25e5e50, 0x02f6fcc2, 0xfdc2c242, 0x974200be, 0x000e330c, 0x001f0014, 
-    0x1a0c4097, 0x01070201, 0x0610134a, 0x9f420703, 0x0e2b2a06, 0x03070208, 0x070a0201, 0x08d18202, 0x01040a20, 0x010a0001, 0x00010561, 0x0d09010c, 
-    0x0f610900, 0x060d0d01, 0x06060059, 0x1b4c063a, 0x2da13140, 0x0d060623, 0x39348755, 0x594d060d, 0x15151f40, 0x1f150f0f, 0x1d1e1f15, 0x18191b1c, 
-    0x140f1617, 0xf382140f, 0x11121125, 0x67101011, 0xf7880550, 0x21113323, 0x43f98501, 0xfd880c8a, 0x16fdca24, 0xff851601, 0x9543f220, 0x41212008, 
-    0xfe230503, 0x41e8fedf, 0x8c270705, 0xc2c2b601, 0x448c4afe, 0xbf4505c7, 0x000a3d07, 0x40540015, 0x01011051, 0x02050f06, 0x010e0504, 0x4a030207, 
-    0x48000104, 0x47030106, 0x063b2b82, 0x61060001, 0x05000100, 0x61050104, 0x02000400, 0x61020407, 0x03070108, 0x82550703, 0x03072706, 0x07030059, 
-    0x45444d03, 0x12143106, 0x10111411, 0x2b1b0809, 0x21152113, 0x35010935, 0x37200682, 0x2f080482, 0x21152737, 0x42112327, 0xea011801, 0x8cfe7401, 
-    0xe8fe16fe, 0xc27e02d2, 0x0183fdc2, 0xc9a6038c, 0xfe8bfec9, 0x46c9c98b, 0xc3c35dc9, 0xa2fdc95d, 0x310bf345, 0x00130009, 0x0e324035, 0x48050204, 
-    0x04020913, 0x57430647, 0x0404220b, 0x05517300, 0x01075928, 0x4d040004, 0x01841211, 0x44079868, 0x012105c8, 0x07c64413, 0x0e431720, 0x8afe2f08, 
-    0xc45e5ec4, 0xc25c5cc2, 0x8c017501, 0x81827501, 0x8bfe7426, 0x2a022601, 0xd6219582, 0x0dc348c2, 0x2d00232c, 0x55003800, 0x011f5240, 0xda670406, 
-    0x20230806, 0x23480401, 0x00470101, 0x03060004, 0x0a630604, 0x03030507, 0x00020209, 0x61000308, 0x0108010b, 0x82570801, 0x01082306, 0x0c82005b, 
-    0x2f4f2808, 0x3424242e, 0x2f382e32, 0x242d2438, 0x24272a2d, 0x11241411, 0x2b1b080c, 0x0e233701, 0x2e222303, 0x35232702, 0x61033e33, 0x17220577, 
-    0x446f011e, 0x01092205, 0x06976126, 0x32170727, 0x37013e37, 0x3f198221, 0xa0120316, 0x442b09ed, 0x5a3b3c5d, 0x6b092841, 0x422a096b, 0x613d3b5a, 
-    0x0f1d1129, 0xed030304, 0x08052049, 0x0bdffe2e, 0x26391711, 0x0b123146, 0x08354590, 0xdbfe050f, 0x2c060d08, 0x20a03f01, 0x24253945, 0xa4214539, 
-    0x253b4721, 0x2911292b, 0x09090820, 0x0806074b, 0x139e0143, 0x311a1712, 0x30f71510, 0x0c0a1108, 0x002f0711, 0xff420001, 0x058f0401, 0x00190061, 
-    0x1224409d, 0x05040211, 0x03020a13, 0x02141504, 0x05160302, 0x18020102, 0x01000217, 0x0f104a05, 0x19480502, 0x50831801, 0x001d2307, 0xc8560003, 
-    0x06a64a05, 0x004b3c22, 0x5f06ba4a, 0x3e240539, 0x1a405850, 0x220ced56, 0x87005d00, 0x4c04242b, 0x4d20401b, 0x59251f04, 0x11094059, 0x25018212, 
-    0x1a080611, 0x324a052b, 0x35212305, 0x09852721, 0x07150123, 0x7f028317, 0xa0220800, 0x265790fc, 0xc9c9240d, 0x56a5ddfe, 0x4e58059a, 0xc9c92106, 
-    0x20062e57, 0x21ef8202, 0xef4704bc, 0x00092505, 0x08254028, 0x0128bc82, 0x0201074a, 0x06094800, 0x2c13a25d, 0x16080212, 0x1101132b, 0x11211521, 
-    0x09e14703, 0x02c2c22e, 0xfe750131, 0xddfea4dd, 0xc3c33802, 0x210d8343, 0x5b840006, 0x2305895c, 0x01020408, 0x00205b83, 0x5d11d17f, 0xda82058f, 
-    0x02091128, 0x43031127, 0x9a49fffc, 0x11012805, 0xa4df01c2, 0x49fe2301, 0xfe230531, 0x8403007a, 0x03b822b7, 0x395982a6, 0x000f000c, 0x0b2a402d, 
-    0x00010205, 0x0a0e4a01, 0x00040104, 0x090c0f48, 0x47700406, 0x88142011, 0x091121be, 0xc183c382, 0x11272527, 0x01750119, 0x27bd82b5, 0x4f4bfe8b, 
-    0x1503c2c2, 0x7086cb86, 0xd2852320, 0x82c3c321, 0x00013977, 0x04f2fe92, 0x00ac013e, 0x40120005, 0x0202050f, 0x01014700, 0x12690000, 0x1327bb84, 
-    0x33010933, 0x82a39201, 0xa3333c04, 0xac012afe, 0xc80138fe, 0x000046fd, 0x01540001, 0x037d042f, 0x000800e5, 0x8206b551, 0x4a012ea8, 0x500ab04b, 
-    0x001c4058, 0x02010102, 0x22d18266, 0x59670300, 0x5a20090d, 0x4e213383, 0x494d181b, 0x00552110, 0x1c856e82, 0x12b65923, 0x5b661811, 0x82012009, 
-    0x0323377a, 0x020ffd45, 0xe3fafef1, 0xa5fe5b01, 0xaa3502e3, 0xa5fe0601, 0x4b83a5fe, 0x00742e08, 0x045d0492, 0x0006007c, 0x0306b306, 0x2d2b3001, 
-    0x01370101, 0x0102011b, 0x64fd0f01, 0xba5e0294, 0x02bad03d, 0x64fd955d, 0xa4fd0e01, 0x83008200, 0x04a324b3, 0x8211047d, 0x40262233, 0x05bd4123, 
-    0x01010423, 0x144b5e48, 0x013bff84, 0x03053505, 0x2f030109, 0xdb0225fd, 0xfe7e0130, 0x23a80282, 0x050123aa, 0x58fec9fe, 0x742206fb, 0x8782c100, 
-    0x8789ab20, 0x2d011339, 0x01010b01, 0xfe9c0274, 0x3d5c02f1, 0x01a2fdba, 0xba5d0256, 0x82a4fd3e, 0x84642088, 0x012e2987, 0x03a304a1, 0x000800e1, 
-    0x3c418782, 0x20878305, 0x13d35e08, 0x08084342, 0x0504272f, 0x42020504, 0x1402ecfd, 0x010a0180, 0xfe29fed7, 0x5c9302f6, 0x6060c0f2, 0x000100c0, 
-    0x042a014a, 0x003d0488, 0xb571002a, 0x02010124, 0x06086301, 0x01041528, 0x00010100, 0x756d0067, 0x00642f05, 0x033c0303, 0xb04b1b4c, 0x4058501c, 
-    0x1c820414, 0x8e730021, 0x1b40261b, 0x03020300, 0x821b8772, 0x0057264c, 0x5c010202, 0x3e558200, 0x40595950, 0x1d00010f, 0x0a11131b, 0x012a0008, 
-    0x1408052a, 0x2722012b, 0x36343526, 0x8421013f, 0x3e372408, 0x63213301, 0x09820503, 0x16324d08, 0x17160117, 0x06141516, 0x010e0107, 0x1b27fe02, 
-    0x8b0d0f1c, 0x1d2460fd, 0x200e1c1c, 0x8ba00213, 0x0d1c0f0d, 0x22141421, 0x0d2c010c, 0x0c100708, 0x220cd4fe, 0x1d1b2a01, 0x0d221425, 0x281a1b8c, 
-    0x0f0d1a28, 0x13230d8b, 0x0f0d1c26, 0x0e261d83, 0x13150f10, 0x26820d22, 0x82000f21, 0x00012800, 0x04b70154, 0x4125047d, 0x21342ad7, 0x09112135, 
-    0xfd460301, 0x01f2020e, 0x02c9fe37, 0x1b0138d2, 0x2806d441, 0x012e0001, 0x04a30478, 0x204fad14, 0x304f8235, 0x03d8fc56, 0xfe4d0128, 0xa87202b3, 
-    0xfeb2fefa, 0x299e82b2, 0x36000400, 0x9b047501, 0x4f820604, 0x0e000a24, 0x79701200, 0x01002305, 0x7d424a01, 0x04062807, 0x00010302, 0x84550100, 
-    0x00012608, 0x03050759, 0x065a4f03, 0x14111128, 0x08081011, 0x824d2b1c, 0x11332306, 0x03861323, 0x52032208, 0x2d01d3fe, 0xb7fe4901, 0x2d2de4fc, 
-    0x965a5a69, 0x2802b4b4, 0xfeb22c01, 0x01b7feb8, 0x01d4fedf, 0x8203852c, 0x01542e83, 0x047d049c, 0x0008000b, 0x0010000c, 0x42838314, 0x839d0d79, 
-    0x838a1620, 0x06171624, 0x868b0107, 0xfe462108, 0x831d01e3, 0xfd82b5b4, 0x632a2a0e, 0xab8e5555, 0x01fe01ab, 0x5dda62ab, 0x0d02d95f, 0xab0155fe, 
-    0xe1820385, 0x00310131, 0x04a003a7, 0x000600d1, 0x02144017, 0x59480001, 0x11210934, 0x05666c12, 0x01092338, 0x01211123, 0x3701a9da, 0xfea93801, 
-    0x019903e3, 0xfdc8fe38, 0x3f82000e, 0x008b0027, 0x04e103df, 0x2e3f8235, 0x0506b621, 0x00040104, 0x17b04b47, 0x82b55850, 0x003c241d, 0x82b31b4c, 
-    0x69210807, 0x0112b359, 0x132b1508, 0x11212701, 0x028b0127, 0xb8017816, 0x01eafd77, 0x781502a8, 0xfd7847fe, 0x272482eb, 0xf0000100, 0x4604df00, 
-    0x12254b84, 0x03040f40, 0x204c8202, 0x47501948, 0x82092008, 0x1137277d, 0xfd050321, 0x3684c9eb, 0x02560128, 0xeafdc916, 0x2382fe78, 0xc78d0120, 
-    0x74064144, 0x692205f0, 0xc7851111, 0x2f05a84e, 0x01a93101, 0xc9fea91d, 0xf202df01, 0xc8fe0efd, 0xc3897782, 0x10401322, 0x00227783, 0x78890005, 
-    0x01171322, 0x21270182, 0x1502788b, 0x82ebfdc9, 0x970222af, 0x21798478, 0x3b820077, 0x85015426, 0xf3037d04, 0x2028ff82, 0x01011d40, 0x01064800, 
-    0x20111646, 0x06164611, 0x11211527, 0x01541521, 0x27798337, 0x3701bc02, 0xa9e4fea9, 0x4341f78c, 0x07012b21, 0x01072111, 0x77670107, 0x8683b801, 
-    0x78f40228, 0xfd78b901, 0x8b8ac9eb, 0x24060d47, 0x4a010001, 0x18694704, 0x4a07aa46, 0x96820765, 0x01bb0127, 0xfec9fe37, 0x209a8445, 0x220982a9, 
-    0x42a9a9c9, 0x092a0b23, 0x1a401d00, 0x48010104, 0xf17e0109, 0x72012805, 0x00000103, 0x46121169, 0xf64e0627, 0x01012607, 0x01a9a931, 0x82e08238, 
-    0xdf012b45, 0x3801ba01, 0x46fec8fe, 0xb747c8fe, 0x01602f05, 0x04710474, 0x00030018, 0x401b0006, 0xa3830518, 0xea460320, 0x04300808, 0x04060404, 
-    0x14080206, 0x2504092b, 0xfeb20117, 0xfb1104ae, 0xfd5403ef, 0xc602cb8d, 0xaefe5201, 0x5201aefe, 0x0200cbcb, 0xa4017b00, 0x24045604, 0x152c4784, 
-    0x01011240, 0x03064800, 0x47000302, 0x69246682, 0x15080114, 0x213a4182, 0xfebb0107, 0xfcdb03c0, 0xfe280325, 0xe402c06d, 0xc0fe4001, 0x4001c0fe, 
-    0x008200c1, 0x43820120, 0x43822020, 0x8200bc21, 0x03b32c8b, 0x2b300101, 0x01090301, 0x83f97401, 0x02240831, 0xfece01ee, 0x0032fe32, 0x36000100, 
-    0x9b048c01, 0x10003d04, 0x23402600, 0x0100010f, 0x010e4a01, 0x01104801, 0x20066748, 0x21118257, 0x29835b00, 0x294f3a08, 0x16080220, 0x2221012b, 
-    0x35262726, 0x1e171411, 0x35213301, 0x52030109, 0x402498fd, 0x1a36361a, 0x68022440, 0xb7fe4901, 0x191c2102, 0x68014936, 0x1c193649, 0xfeb7fe95, 
-    0x206784b7, 0x2067828b, 0x4967853c, 0x0022072d, 0x55420948, 0x83572007, 0x825b20b5, 0x4f012328, 0x67832424, 0x37341323, 0x2660853e, 0x06222135, 
-    0x8a150607, 0x21708560, 0x6088f302, 0x70839520, 0x01274183, 0x03060150, 0x45e00481, 0x11382b53, 0x01091121, 0xebfe6502, 0x1c011501, 0x1202e4fe, 
-    0x0c01c201, 0x13fe13fe, 0x3622f583, 0xb7826e01, 0x43470020, 0x21113b2b, 0x04051635, 0xfde20207, 0x6cac0254, 0xb3fe4d01, 0x01e5016c, 0x63e677a4, 
-    0xa382e663, 0x65000228, 0x6c046b01, 0x53822104, 0x6d000f39, 0x010a0e40, 0x01060201, 0x010f0405, 0x4a030003, 0x500fb04b, 0x48244058, 0x042f0ede, 
-    0x62040105, 0x00000500, 0x05005505, 0x82590005, 0x4d002408, 0x8222401b, 0x18022026, 0x94083056, 0x40592624, 0x12131109, 0x05d45211, 0x82210121, 
-    0x0933279c, 0x01092301, 0x01822115, 0xfe5f022a, 0xb2fa0106, 0xa5fe5b01, 0xde200483, 0x022f0d83, 0xa9640114, 0xa5fea5fe, 0x22015b01, 0x42a9f2a9, 
-    0x652605db, 0x6c042f01, 0xb340e503, 0xfec5288f, 0x0107fede, 0x93d801f9, 0x362108b3, 0x9b04b800, 0x0b00fc03, 0x72001200, 0x010d1440, 0x01080201, 
-    0x09120405, 0x05000303, 0x00030100, 0x066d4104, 0x46412320, 0x03002a07, 0x00010067, 0x04010504, 0x236c4161, 0x59272490, 0x13110940, 0x56121113, 
-    0x132b08a5, 0x13333721, 0x01230115, 0x82210703, 0x2a023b01, 0xcdfdfd0f, 0x47635502, 0x6af9fd99, 0x627a2a02, 0x028caafd, 0x46016256, 0xc1838e1b, 
-    0xfe8f9325, 0x41e901b8, 0x02280576, 0xd7006100, 0xaa037004, 0x052abf87, 0x0d020101, 0x04030208, 0xc5830901, 0x1123bf86, 0x83405850, 0x050c4bbf, 
-    0x86730321, 0x3a2c42bf, 0x12121322, 0x2d063b5a, 0x27213503, 0x15013335, 0x25132303, 0x01822117, 0x46033d08, 0x01bdd8fd, 0x01630fdc, 0x8d418edf, 
-    0xfd5a5afe, 0x280281d8, 0x0169015a, 0x7b177b34, 0xfe7be4fe, 0xfb2c01c4, 0x0092d292, 0x00020000, 0x04db007e, 0x004d0453, 0x0011000a, 0x0c0f4065, 
-    0x26067f41, 0x00020211, 0x6a4a0305, 0x1b200511, 0x41058562, 0xb4840574, 0x82050321, 0x020224f8, 0x424c023c, 0x132129df, 0x22b28711, 0x82211127, 
-    0x421720b1, 0x350805e1, 0x02152111, 0x4b71fe58, 0x0152ca01, 0x92fe4b6e, 0xfe230152, 0x0136fece, 0x965201ca, 0xfe77ee01, 0x92fe9692, 0x32010402, 
-    0x778afe77, 0x55000200, 0x7c048200, 0xaf843e04, 0xaf828a20, 0x1b820220, 0x05010724, 0x98431104, 0x50152406, 0x4c1c4058, 0x25420871, 0x21b08208, 
-    0xb0850062, 0x8c05ee4a, 0x006124d3, 0x8a000005, 0x12b34322, 0x210a4642, 0x2e82005a, 0x42594e21, 0x87410747, 0x37112606, 0x01333721, 0x08d48907, 
-    0x10fe4549, 0x40b00151, 0x518c015a, 0x015a74fe, 0xfeb4fe8d, 0x01f00110, 0xa3180203, 0xa273fe80, 0x8d0173fe, 0xfe804b01, 0x0000816a, 0x33000200, 
-    0x9e044e01, 0x0c007504, 0x90001400, 0x010e1540, 0x0a110201, 0x04050304, 0x43020314, 0x17200908, 0x8e41dd90, 0x07465a0f, 0x42000321, 0xb1410d66, 
-    0x24dd822f, 0x11131312, 0x05254313, 0x27213524, 0xb4412737, 0x1731080a, 0x02152107, 0x25a0fdb8, 0x85027070, 0x256e0153, 0x015292fe, 0xfdcefe48, 
-    0x0255559f, 0x2c980161, 0x77f7f74c, 0xfe4b92fe, 0x01b90192, 0xbbbb7732, 0x26e38377, 0x04fd002a, 0x843104a7, 0x40be23e3, 0xe3820615, 0x02030e27, 
-    0x09110104, 0x43e88302, 0x0720062c, 0x0a20e3a2, 0x21287e45, 0x1142b04b, 0x0f334111, 0x4312ee41, 0x5921109a, 0x05114159, 0x41131221, 0x372406ef, 
-    0x35213727, 0x0809f141, 0x21071727, 0xfdba0215, 0x26727270, 0x53266a02, 0xfe267401, 0x7301538c, 0x94fdcafe, 0x6c025757, 0xfbfb7601, 0xfe4c2c4d, 
-    0x0802828c, 0x01740127, 0xbebe7937, 0x00000079, 0x00910001, 0x044004bd, 0x001d00ac, 0x090e4097, 0x08030201, 0x07020101, 0x03010001, 0x0520754a, 
-    0x01001323, 0x2d0e8204, 0x02005f00, 0x005b0302, 0x02440303, 0x5f4f1b4c, 0x00192105, 0x20106968, 0x202b845b, 0x8320824f, 0x203b94f6, 0x83369940, 
-    0x010f3ce4, 0x0b111300, 0x0005060a, 0x051d011d, 0x252b1408, 0x26272622, 0x09152127, 0x18211501, 0x08094f45, 0x0614152a, 0x02010e07, 0x4eb1644a, 
-    0xe7012232, 0x8cfe7401, 0x301017fe, 0x5b2d4c3f, 0x4eb16366, 0x4c484b49, 0x49bdb546, 0x813d314c, 0x4e08ef82, 0x3e1d8074, 0x2613353c, 0xb3484c49, 
-    0x4eaf6469, 0x00004d48, 0x01580009, 0x0379044e, 0x00100015, 0x00180014, 0x0020001c, 0x00280024, 0x0030002c, 0x0699409c, 0x09000401, 0x0c010201, 
-    0x030d0301, 0x0101014a, 0x02020100, 0x0a000049, 0x82030608, 0x042208e4, 0x160b1761, 0x14071509, 0x12010805, 0x040c0e10, 0x02010d02, 0x1a131b61, 
-    0x180f1911, 0x03030d07, 0x0c88550d, 0x59030d23, 0x08448200, 0x2d2d4d5d, 0x25252929, 0x1d1d2121, 0x15151919, 0x302d1111, 0x2e2f302d, 0x2c292c29, 
-    0x28252a2b, 0x26272825, 0x24212421, 0x201d2223, 0x1e1f201d, 0x1c191c19, 0x18151a1b, 0x16171815, 0x14111411, 0x11181112, 0x19081c12, 0x2735132b, 
-    0x35211721, 0x0e17011e, 0x21350701, 0x27132107, 0x8a331723, 0x37052403, 0x8a330723, 0x85dd3603, 0x01858001, 0x46823e16, 0xfe3e8246, 0x80fe85ea, 
-    0x722b72db, 0x27038480, 0x717f722a, 0xb9fe722b, 0x8034108a, 0x02722a71, 0xc7c73915, 0x2e7143c6, 0xc643712f, 0xab0001c7, 0xe4200086, 0x40080786, 
-    0x030000ab, 0x82007500, 0x6a045c04, 0x11000d00, 0x4d001500, 0x0b0c1840, 0x00010301, 0x030d1314, 0x4a020102, 0x00020206, 0x02121548, 0xb04b4702, 
-    0x40585027, 0x00010012, 0x02010002, 0x02020070, 0x06224d71, 0x000e4022, 0x72201582, 0x01211582, 0x08168272, 0xb5596932, 0x03231911, 0x012b1708, 
-    0x33162737, 0x15063732, 0x27171614, 0x01332507, 0x15010523, 0xcfb40201, 0x8735398e, 0x02032272, 0xecfecf8e, 0xe6a7fee6, 0x59381582, 0xf002a7fe, 
-    0x22068fcf, 0x371b8673, 0x2dcf8f1d, 0x012fa8fe, 0xa8fee658, 0x5426a382, 0x7d04d101, 0x6b4e6b03, 0x403a2206, 0x07694e37, 0x08480225, 0x82470501, 
-    0x01032490, 0x82610302, 0x04002484, 0x18610001, 0x230f4b74, 0x16111111, 0x31071649, 0x16352135, 0x01070617, 0x15211721, 0x03210721, 0x3582ff8d, 
-    0x81816f2a, 0x01c7fc6f, 0x56fe8eaa, 0x022c0484, 0x87b13882, 0x01874646, 0x8e3a8f78, 0x74267f82, 0x5d04ba00, 0x0982a104, 0x1400073a, 0x30403300, 
-    0x0302030f, 0x10110001, 0x0102030d, 0x010e4a02, 0x01490101, 0x48248582, 0x4702010c, 0x280d0b41, 0x03141122, 0x012b1708, 0x82e28235, 0x013008ff, 
-    0x07222326, 0x17372737, 0x14150637, 0x59018901, 0x01e692fd, 0x8f02e65a, 0x39368772, 0xcf2ecf8f, 0xbb03068e, 0xe5a7fee6, 0xa8fe2901, 0x062286fe, 
-    0x8f241383, 0x00843639, 0x752e5683, 0x5c04b000, 0x2c009704, 0x12405b00, 0x7b820d1f, 0x060c2b24, 0x82820003, 0x02171b2b, 0xb04b4803, 0x4058503e, 
-    0x240f8217, 0x00010200, 0x20328270, 0x0bef4371, 0x8c1c4021, 0x032f0819, 0x57030202, 0x02030300, 0x0302005b, 0xb6594f02, 0x28251224, 0x2b180804, 
-    0x35012e25, 0x0e373634, 0x26222301, 0x011e0127, 0x013f3233, 0x41262726, 0x172607ca, 0x012e2726, 0x8c740727, 0x01300805, 0x1d1c8901, 0x4a1c1c1d, 
-    0x1c472724, 0x3d165901, 0xf6314220, 0x394a1f14, 0x72883737, 0x1e3a0622, 0xf6020807, 0x17171519, 0x1bb0a8fe, 0x49232749, 0x1d3f2c82, 0x1658011c, 
-    0x01f72f19, 0x063a1f0e, 0x36867222, 0x10493a3a, 0x1bf60919, 0x3d1f1f38, 0x82a7fe17, 0x01003cb7, 0x8a012b00, 0x4403a604, 0xd7002400, 0x01230d40, 
-    0x21490102, 0x00480401, 0x75470101, 0x202a0590, 0x03000400, 0x63030402, 0xd6820200, 0x05005728, 0x05010000, 0x715d6300, 0x06df4409, 0x04001b2b, 
-    0x55040002, 0x03020105, 0x21288201, 0x09826300, 0x8207945d, 0x500f2322, 0x4aa34058, 0x27821120, 0x45a14a9c, 0x00825920, 0x09402908, 0x15101424, 
-    0x08062414, 0x34012b1a, 0x21373637, 0x010e0722, 0x36342115, 0x33013e37, 0x26272622, 0x16142135, 0x21331617, 0x6a080a83, 0x03061716, 0x0b0c1ca4, 
-    0x2d3fb8fe, 0x35fe1815, 0x44181a1c, 0x18442525, 0x18cb0136, 0x013f2d15, 0x1c0c0b48, 0x018b8b77, 0x1e444e8a, 0x39142d0e, 0x1944251f, 0x181e1e18, 
-    0x391f4c36, 0x1e0e2d14, 0x4c914e44, 0x0001004c, 0x04ba004f, 0x00ee0482, 0x402d002d, 0x11171e2a, 0x2a020103, 0x00031026, 0x1d4a0201, 0x04480201, 
-    0x4b470001, 0x01330518, 0x00720100, 0x25690000, 0x08032129, 0x26252b17, 0x83072223, 0x01372899, 0x2223012e, 0x53010706, 0x2042057f, 0x82012005, 
-    0x146408b8, 0x01171617, 0x37363736, 0x04141506, 0x3a907d82, 0x114d3f3c, 0xf6fe0b1c, 0x22224019, 0x8dfe1842, 0x262a4c1f, 0x201d1d50, 0x73011d20, 
-    0x0e0c151c, 0x030a0117, 0x06401f0e, 0x3d0624ba, 0x01080723, 0x191a0901, 0x7301191a, 0x1f1f1e20, 0x2a264f1f, 0x8cfe1e4e, 0x23213d1d, 0xfe182021, 
-    0x4f2511f7, 0x8e3b3e3e, 0x03359182, 0x2a013600, 0xeb039b04, 0x27001100, 0x74003b00, 0x040135b5, 0x07935403, 0x0000252c, 0x66000302, 0x01050107, 
-    0x0a827305, 0x57020138, 0x04000300, 0x64040301, 0x01020200, 0x0101065b, 0x1b4f0102, 0x27822440, 0x9e720021, 0x59270826, 0x28291640, 0x3b281213, 
-    0x24253b29, 0x1e202324, 0x27132712, 0x1508082a, 0x012e012b, 0x26272627, 0x36373435, 0x82163233, 0x051622f9, 0x830f8222, 0x37362c11, 0x3233013e, 
-    0x05041617, 0x84060704, 0x34352315, 0x15833736, 0x06374d08, 0x07010e07, 0x899b0406, 0x122c44cb, 0x2f212108, 0x0d112717, 0xdcfc5a0c, 0x1712391f, 
-    0x14180b0a, 0x1d1f3516, 0xc801851c, 0x61fd4801, 0x43021af6, 0x21102818, 0x15101011, 0xaa70cb5d, 0x1421095b, 0x258c0215, 0x2a131e43, 0x1f311516, 
-    0x29081882, 0xf0c2190b, 0x19181319, 0x381f1e1c, 0x0b181513, 0x2a144533, 0x12ca0a63, 0x16321f0f, 0x09100f2a, 0x591f4225, 0x0a1e16c1, 0x00820008, 
-    0x1d00023d, 0xb4046f01, 0x0d00af03, 0x2c002a00, 0x18262940, 0x0004050c, 0x0a4a0101, 0x18480101, 0x2c10ce83, 0x20220e0f, 0x2a0f2a0e, 0x2b140803, 
-    0x23e88201, 0x012e3736, 0x1621ee82, 0x22d38217, 0x8427022e, 0x20d482ff, 0x06004103, 0x5508ec82, 0x9803010e, 0x1e1e1f3d, 0xcc503d1f, 0x1535fdcc, 
-    0x091e2429, 0x160a150b, 0x0d183537, 0x101b1a18, 0x5a2b2722, 0x4401862a, 0x2d86bcfe, 0x3f6f0158, 0x20462a51, 0x512a4620, 0x5c5cc43f, 0x15110b70, 
-    0x13220e0a, 0x2e20202e, 0x11192419, 0x1a210f08, 0x543d3d54, 0x98821f1c, 0xbe012632, 0xa603ab04, 0x26005a00, 0x00002340, 0x57000301, 0x0a596318, 
-    0x0059032f, 0x4d030003, 0x4c4e595a, 0x12141c1f, 0x22af8204, 0x82272213, 0x013f25b1, 0x2f343536, 0x372abb83, 0x2133013e, 0x16171632, 0x0482011f, 
-    0x32013b24, 0x1a843736, 0x1b82d184, 0x18853220, 0x0f141523, 0x05ea4401, 0x36203d82, 0xe7823e84, 0x22012b25, 0x83060706, 0x07260819, 0x46212306, 
-    0x020a0a0c, 0x5d03035d, 0x0b050a02, 0x06f20106, 0x0502040c, 0x080d0549, 0x0d06e504, 0x16030a04, 0x18820101, 0x06075008, 0x05c3030d, 0xc30a0203, 
-    0x07060d03, 0x010a050b, 0x0a031601, 0xe5060d04, 0x04050c06, 0x07044903, 0xfe060507, 0x0abe010e, 0x06060e0a, 0x080904b9, 0x0706b905, 0x06040a0d, 
-    0x0a010505, 0x02080a92, 0x0c0a0406, 0x05510904, 0x0a0e0205, 0x82060504, 0x0806234d, 0x4f820e05, 0x0405062b, 0x05020e0a, 0x04095105, 0x322f820c, 
-    0x06040406, 0x03060992, 0x00010003, 0x04650126, 0x41f103ab, 0x02210627, 0x05fb4203, 0x03010022, 0x2a0b0b45, 0x3032393c, 0x10121d1e, 0x82140804, 
-    0x272621d9, 0x2620ea88, 0x4541eb90, 0x0b444114, 0x35013e25, 0x41012f34, 0x8d570945, 0x01072506, 0x4603010e, 0x4723f685, 0x82050503, 0x4b2d08f7, 
-    0x06040c06, 0x08046102, 0xfd070506, 0x0a0a0de7, 0x02027503, 0x050a027e, 0x1a02060b, 0x05020710, 0x080d0569, 0x0d064b04, 0x03050504, 0x06434147, 
-    0x01040c39, 0x02030545, 0x04bbfe0a, 0x0665010c, 0x030d0a04, 0x06b20406, 0x820d0507, 0x040633f4, 0x08c30406, 0x0a030307, 0x05070e0a, 0x070706ea, 
-    0x4241fa06, 0x0a500805, 0x0ad30a01, 0x04060208, 0x07050d04, 0x0604b206, 0x040a0d03, 0xfe040606, 0x080605dc, 0xfe0a0e05, 0x000604dc, 0x00030000, 
-    0x040c0132, 0x00b1039f, 0x0020000b, 0xb672002c, 0x0602111c, 0x4b4a0102, 0x58500eb0, 0x01032740, 0x01000001, 0x02070866, 0x04219382, 0x37318267, 
-    0x02000602, 0x05060062, 0x00550605, 0x59050606, 0x05060500, 0x25401b4d, 0x01212983, 0x21288472, 0x27977304, 0x1040592e, 0x2c212121, 0x14112c21, 
-    0x13151b18, 0x3706175f, 0x3327012e, 0x1617011e, 0x36012117, 0x37013e37, 0x2f262726, 0x17163301, 0x21050c4a, 0x1282012b, 0x35215e08, 0x0e070621, 
-    0x02320701, 0x0e292064, 0x070b054f, 0x0ffd522c, 0x783edc02, 0x381b2a0e, 0x083e781b, 0x206b3652, 0xa9673452, 0x0ec75237, 0x9cfd2029, 0x2c52f102, 
-    0x02050b07, 0x2b5f33f4, 0x670e1e0e, 0x8c70fe63, 0x14200e74, 0x8c731b27, 0x1e6b7311, 0xa2381c3a, 0x345d2d79, 0x0e676347, 0x05e7581e, 0x009cff2b, 
-    0x033505e5, 0x0009007d, 0x575a1829, 0x73032028, 0x64290850, 0xa05a2301, 0x44fbbc04, 0x06d66aa0, 0xa0a4a027, 0x0000005a, 0x18578a01, 0x2533a75c, 
-    0x44fba0b8, 0xa969bc04, 0x07297708, 0x0f20578a, 0x30335a18, 0x066fb585, 0x21bb8409, 0x5d18df03, 0x212008db, 0x4318c388, 0xcb8508dc, 0x1f570020, 
-    0x27e35b09, 0x21112123, 0x0c0b5a35, 0x1c012e23, 0x070b5aa9, 0xfeecff2b, 0xffe50400, 0x0003003f, 0x052a7f2d, 0x08e08118, 0x4c014026, 0x0010401b, 
-    0x280e3b7c, 0x1011b459, 0x2b160802, 0x27568207, 0xfbf90414, 0xc1fec107, 0x47852382, 0xb06a0021, 0x87272047, 0xfd6a2247, 0x21478896, 0x47b09501, 
-    0x47870320, 0xfc950125, 0x8501006b, 0xc002218f, 0x022347b9, 0x8740fbc0, 0xec032147, 0x032347b9, 0x8714faec, 0x17052147, 0x26204782, 0x27086741, 
-    0x00720001, 0x01400101, 0x0d7c7018, 0x88066041, 0x170524d0, 0x8200e9f8, 0x21d38600, 0x43824206, 0x0ad37018, 0x864b3b21, 0x41569e43, 0x578807b8, 
-    0xf7420623, 0x275784be, 0xf6ff6601, 0x65046b03, 0x41205782, 0x20056a51, 0x2017820b, 0x2057833c, 0x4b9b823a, 0x7c1805c6, 0x5e871f94, 0x1121012d, 
-    0x02660121, 0x04fbfd05, 0x8491fb65, 0xecff275f, 0xe504c002, 0x43418007, 0x50352305, 0x4c884058, 0x63423f20, 0x21aa881c, 0x8b418007, 0x42062105, 
-    0x81204782, 0x33204785, 0x812247b3, 0x8b41c1fe, 0x8a002205, 0x20478307, 0x0834413a, 0x09437118, 0x8205c669, 0x180020a2, 0x43161b72, 0x032b0500, 
-    0x14231133, 0x81079e9e, 0x85007ff6, 0x2a012153, 0x212753c0, 0x01142111, 0x85c2fe3e, 0x20578755, 0x2257c5c9, 0x8c23fedd, 0x68022157, 0x022357c4, 
-    0x8c84fd7c, 0x07032157, 0x032357c4, 0x8de5fc1b, 0xc5a62057, 0xfcba2257, 0x20578c46, 0x430e8204, 0x6c180553, 0x6642121f, 0x1e0b4206, 0x21112126, 
-    0xfb5a0414, 0xf622a082, 0x0082007f, 0x69020124, 0xab4200fe, 0x3a634206, 0x57820120, 0x41690221, 0x01220a60, 0x57824604, 0x0741e420, 0x3301253f, 
-    0x46042311, 0x2406bc42, 0xfeecff01, 0x45658200, 0x0223362b, 0x4583fd7d, 0xf384052b, 0x7345e620, 0x87e68632, 0x00002948, 0xecff0100, 0x6902c002, 
-    0x83373344, 0x07334493, 0x0400fe23, 0x224782e6, 0x434e0005, 0x102005eb, 0x3f2a5e82, 0x0101004b, 0x02005902, 0x64184002, 0x0d270839, 0x02000100, 
-    0x835d0201, 0x4c00221e, 0x2663181b, 0x252d8210, 0x594d0201, 0xfe5eb559, 0x21032206, 0x26018211, 0x027d0214, 0x8306fb7d, 0x40fb266c, 0xff020000, 
-    0x246f86ec, 0x00070003, 0x2071855c, 0x07616615, 0x022a7682, 0x00590302, 0x03400303, 0x6a451b4c, 0x18122005, 0x200e5298, 0x5298183f, 0x1859201d, 
-    0x820825f0, 0x0229237f, 0x80822111, 0x8383fd21, 0x83fd2184, 0x01208486, 0x05228388, 0x81855100, 0x11637418, 0x10207c85, 0x7320f183, 0x4c189e88, 
-    0xf55f1d88, 0x23f68605, 0x83fdfa04, 0x00207188, 0x4105ff44, 0x73880667, 0x0fdb7318, 0x4d187388, 0x3f200a98, 0x20056a41, 0x18128302, 0x8512984d, 
-    0x21012273, 0x23018211, 0x83fd6902, 0x02257683, 0xf6c004c0, 0x215c8280, 0x0a826902, 0x2342e620, 0x096f4232, 0xfb800724, 0x00820040, 0x826ab741, 
-    0x0229237c, 0xbc822111, 0x83fd7d24, 0xaa4283fd, 0x41878507, 0xaf420bbb, 0x01012308, 0xa3834b3f, 0x260faf42, 0x00020000, 0x82005d02, 0x05b8411e, 
-    0x23052d51, 0x55000202, 0x00202d86, 0x4118af42, 0x8b080743, 0xfe000010, 0x07380414, 0x0003006d, 0x000b0007, 0x0013000f, 0x001b0017, 0x0023001f, 
-    0x002b0027, 0x0033002f, 0x003b0037, 0x4bf4003f, 0x58501eb0, 0x010a5740, 0x09010b08, 0x6109080c, 0x0f0c010e, 0x0c100d01, 0x0112610d, 0x11011310, 
-    0x61111014, 0x17140116, 0x14181501, 0x011a6115, 0x19011b18, 0x6119181c, 0x01010103, 0x01025900, 0x4b3f0000, 0x05050107, 0x01065904, 0x4b3b0404, 
-    0x1c1c011e, 0x011f591d, 0x1d401d1d, 0x55401b4c, 0x1e821582, 0x05040823, 0x8c63bd61, 0x40593e57, 0x3d3e3f3a, 0x393a3b3c, 0x35363738, 0x31323334, 
-    0x2d2e2f30, 0x292a2b2c, 0x25262728, 0x5a9c1824, 0x089e6f09, 0x00851120, 0x08201029, 0x33112b1d, 0x82252315, 0xb6052003, 0x9a9a2707, 0x9a9a6902, 
-    0x0782ccfe, 0x9b9b6824, 0x0fad63fc, 0xdd6d0725, 0x8259dddd, 0x825a2003, 0xde582403, 0x8259dede, 0x86582003, 0x2a17830f, 0x001e0000, 0x0414fe00, 
-    0x416c07d1, 0x433c20bf, 0x4b004700, 0x53004f00, 0x5b005700, 0x63005f00, 0x6b006700, 0x73006f00, 0x7c017700, 0x08059943, 0x080a7f82, 0x090b0602, 
-    0x060c0702, 0x0e106107, 0x0f110c02, 0x0c120d02, 0x1416610d, 0x15171202, 0x12181302, 0x1a1c6113, 0x1b1d1802, 0x181e1902, 0x20226119, 0x21231e02, 
-    0x1e241f02, 0x2628611f, 0x27292402, 0x242a2502, 0x32346125, 0x33353002, 0x30363102, 0x03056131, 0x00010102, 0x02020459, 0x4b3f0000, 0x2a022c2e, 
-    0x2f592b2a, 0x2b2b022d, 0x383a4b3a, 0x37363602, 0x02393b59, 0x37403737, 0x7d401b4c, 0x678381c7, 0x30226483, 0x8d9a2b2a, 0x39087f8e, 0x77724059, 
-    0x73747576, 0x6f707172, 0x6b6c6d6e, 0x6768696a, 0x63646566, 0x5f606162, 0x5b5c5d5e, 0x5758595a, 0x53545556, 0x4f505152, 0x4b4c4d4e, 0x4748494a, 
-    0x43444546, 0x0b194142, 0x63420bed, 0x423c202b, 0x25240a63, 0x21231533, 0x07830382, 0xcc2f0be3, 0xcd9c01cc, 0xce9a01cd, 0xd096fdce, 0x829d01d0, 
-    0xcd9b240b, 0xddfcfbcd, 0x6c072217, 0x20008def, 0x8d0083f0, 0x8eef2012, 0x00002313, 0xe7420a00, 0x6d720806, 0x21001d00, 0x29002500, 0x31002d00, 
-    0x39003500, 0x41003d00, 0xb04b2e01, 0x4058501a, 0x06010861, 0x04050113, 0x22610506, 0x10032112, 0x16150117, 0x23611510, 0x19040214, 0x04020301, 
-    0x18256103, 0x1d160324, 0x161c1b01, 0x1e28611b, 0x0d1c0327, 0x1c0a0b01, 0x0111610b, 0x59070f0f, 0x07070109, 0x1a264b3f, 0x01020202, 0x01011f59, 
-    0x294b3a01, 0x7c820220, 0x0c0e592b, 0x400a0a02, 0x401b4c0a, 0x8363ac5f, 0x2248824b, 0x98010200, 0x08618e6e, 0x6040594c, 0x3a3a3e3e, 0x32323636, 
-    0x2a2a2e2e, 0x22222626, 0x413e1e1e, 0x3f40413e, 0x3d3a3d3a, 0x39363b3c, 0x37383936, 0x35323532, 0x312e3334, 0x2f30312e, 0x2d2a2d2a, 0x29262b2c, 
-    0x27282926, 0x25222522, 0x211e2324, 0x1f20211e, 0x73181c1d, 0x2a2812cb, 0x152b1d08, 0x11233533, 0x21200389, 0x21260f82, 0x23352311, 0x03832115, 
-    0x08860120, 0x07820320, 0x14830383, 0x99200b8f, 0x01220085, 0x02829acf, 0x32fe9b2c, 0x01ccfe9a, 0x03039ace, 0x00829a9b, 0xb62e068b, 0xde8f01dd, 
-    0x01dd8f01, 0xdddddd90, 0x0482a7f6, 0x4607dd22, 0xfe260583, 0xfeddddc9, 0x0082deca, 0xdec9fe25, 0x87cbfede, 0x00002f13, 0x06000100, 0xcb04acff, 
-    0x1b007c04, 0x7c4e3600, 0xf7991805, 0x11560825, 0x011b000f, 0x1408031b, 0x2622052b, 0x35032e27, 0x37023e34, 0x3233013e, 0x12161716, 0x07021415, 
-    0x6902010e, 0x484da046, 0x29294e71, 0x4d48714e, 0x9d4646a0, 0x9f9f924e, 0x549d4e92, 0x6f282b2b, 0x57579d87, 0x296e879d, 0x2c2b2b2b, 0xb4f5fe52, 
-    0x52f5feb4, 0x92822b2c, 0x8a020021, 0x00332293, 0x25958550, 0x02010514, 0x1b820104, 0x03005f2a, 0x005b0103, 0x03440101, 0x2106e977, 0x11190203, 
-    0x1d29185b, 0x2900011c, 0x1d331c27, 0x20af8533, 0x18af9b06, 0x220b4999, 0x5a062223, 0x1e2006e5, 0x472ac799, 0x783e7e39, 0x3e787c7c, 0x0982397e, 
-    0x7f7f7425, 0x9a7e3e74, 0x237b29db, 0x89da4423, 0x2344da89, 0x42270082, 0xd68f8fd6, 0x49232342, 0xff29050f, 0x04e50492, 0x00150096, 0x23ef832f, 
-    0x40585025, 0x172fefb5, 0x23000116, 0x172f1621, 0x000b0d2f, 0x87150115, 0x022625ef, 0x37123435, 0x2505a658, 0x02141512, 0xec900607, 0x14150324, 
-    0xec821716, 0x4e675508, 0xa39b529d, 0x9d529ba3, 0x9c9ea14e, 0x9e9ca3a3, 0x3c853fa0, 0x79858579, 0x393f853c, 0x5e3b4383, 0x75892342, 0x2b6e8343, 
-    0x10015a30, 0x1001bdbd, 0x5b2b305a, 0xbdf0fe5a, 0x5af0febd, 0x2226805b, 0x9595e144, 0x262244e1, 0x5a212622, 0x984c846f, 0x222642e0, 0x220fd741, 
-    0x41490028, 0x132105d7, 0x13d64100, 0x01001929, 0x01020300, 0x18006303, 0x2109b354, 0x0c820104, 0x40594f29, 0x2800010f, 0x411c1d27, 0x052005d0, 
-    0x4228d041, 0xc541188d, 0x25bc410a, 0x2620cb8f, 0x0320cb89, 0xf718a482, 0x44240aa9, 0x401b4c02, 0x0225cb83, 0x63020103, 0x005c1800, 0x845b2008, 
-    0x21cb8526, 0xcba42526, 0x42220321, 0x1621068f, 0x27c99933, 0x7b797a7a, 0x7a7a797b, 0x0429c79a, 0xcf464755, 0x46cf9191, 0x0c674347, 0x67432520, 
-    0x20c4930a, 0x077f591b, 0x83010521, 0x825520c5, 0x00032106, 0x132ac688, 0x00011c1c, 0x251c251c, 0x67431f21, 0x10012422, 0x84232627, 0x23c998ce, 
-    0x7af5a201, 0x79210082, 0x25c99a7b, 0x19016802, 0xcd83478d, 0x8c000021, 0x442820cb, 0x61232633, 0x82020105, 0x82572039, 0x19022006, 0x200a8f15, 
-    0x25cb821d, 0x281c2223, 0xcba2281d, 0x20064643, 0x053b4321, 0x4217f044, 0xfc210562, 0x2420442f, 0x2b071644, 0x38010100, 0x9a03acff, 0x0d007c04, 
-    0x252d9b45, 0x0d000b0c, 0x9b450d01, 0x08fb4307, 0x9a03113c, 0x974c9f47, 0x4c979999, 0x2b54479f, 0x1101552b, 0x1101acac, 0xfb2b2b55, 0x00820030, 
-    0x0a226f89, 0x9d432d00, 0x6c0b2005, 0x00210618, 0x093b5444, 0xc46b5720, 0xb4592909, 0x08021018, 0x32012b16, 0x3706f445, 0x38012306, 0x959d9a96, 
-    0x959b9b97, 0x5a587c04, 0xb2adf6fe, 0x5a5afffe, 0x340c9f41, 0x4b86002f, 0x585005b0, 0x03001b40, 0x03040204, 0x02010668, 0x05da4505, 0x45040421, 
-    0x042205da, 0x80851b4c, 0x22851c20, 0x94700221, 0x23402123, 0x00271e87, 0x03040001, 0x82630401, 0x00002326, 0x06825702, 0x5b000222, 0x4f305484, 
-    0x15405959, 0x00011c1d, 0x22232425, 0x2f1d2f1c, 0x2005d541, 0x22384407, 0x46112121, 0xfe212905, 0x29024617, 0x23ed0123, 0x0bff4523, 0x200aef46, 
-    0x42874322, 0x221c2224, 0xbb421d1e, 0x11032122, 0x221d8443, 0x437a7a47, 0xed201f80, 0x21067e43, 0xc38a0300, 0x34002e2c, 0x30b66800, 0x01040226, 
-    0xc6414a01, 0x07182905, 0x03000401, 0x62030402, 0x2c09c741, 0x01440101, 0x21401b4c, 0x01040100, 0x411f8b72, 0x403110c0, 0x1d2f2f19, 0x2f00011c, 
-    0x28342f34, 0x1d2e1c27, 0x20dd852e, 0x1fc34108, 0x10113630, 0x27012e27, 0x051e2111, 0x07061103, 0x70440706, 0x39443518, 0xf5f53d7b, 0xfd305b30, 
-    0x513708e2, 0x12656762, 0x16db5c5f, 0x3d1a7d44, 0x8d23247b, 0x19011901, 0x081f1c8d, 0x7f4fddfd, 0x142c4560, 0xb1012502, 0xf07e350e, 0x0f410000, 
-    0x00322c0c, 0xb6810038, 0x00021c38, 0x424a0104, 0x1a2705f9, 0x04000105, 0x82670004, 0x00042727, 0x00610403, 0xf8420202, 0x42022005, 0x192007f8, 
-    0x00212183, 0x21209373, 0x1b861e40, 0x46000121, 0x04390657, 0x00550304, 0x59040303, 0x04030400, 0x4059594d, 0x34000111, 0x2b313233, 0x22064229, 
-    0x013e2727, 0x35033e37, 0x05687a34, 0x07040e29, 0x16210721, 0x41171617, 0x0e3c182b, 0x372a652d, 0x7b23405a, 0x397f3e79, 0x6367642a, 0x0207364f, 
-    0x54fe721e, 0x5f5cdb16, 0x381a3241, 0x1825067f, 0x7e69541f, 0x45db894a, 0x2d152323, 0x4f7e6145, 0x357fed72, 0x0e2f410e, 0x35002e27, 0x2fb68100, 
-    0x132f412e, 0x00231382, 0x4a610402, 0x61420b03, 0x072f4105, 0x2f412092, 0x0653480a, 0x0204042b, 0x02020055, 0x04005904, 0x072f4102, 0x25343523, 
-    0x07894723, 0x351c264a, 0x052e2103, 0x07062223, 0x17101106, 0x3317011e, 0x013e3736, 0x2d412137, 0x02803918, 0x5036071f, 0x2b666863, 0xf4407a37, 
-    0x2f5c30f4, 0x705d5e72, 0x53fe0b77, 0x371a2a41, 0x7f4fa002, 0x152c4561, 0xfe8d2522, 0x8de7fee7, 0x0e07201c, 0x76b64035, 0x270c5742, 0x00360030, 
-    0x2535b668, 0x2f4a6743, 0x1c1d3131, 0x36310001, 0x23243631, 0x301d301c, 0x26246743, 0x2137043e, 0x4b010e11, 0x0125082f, 0x27262726, 0x18104111, 
-    0x64294738, 0x37506367, 0x2ce1fd08, 0x7d763060, 0x7f3e797a, 0xdb171e02, 0x0f415e5d, 0x157b3d1a, 0x7e61442c, 0x0623024f, 0xd4431b22, 0x45db898d, 
-    0x25022323, 0x0e357df1, 0x06004ffe, 0x3d0a7b44, 0x00360027, 0x00490044, 0x4065004e, 0x494a4e13, 0x373e4445, 0x28303136, 0x0e1e1f25, 0x8e440302, 
-    0x355c4b07, 0x011c1d29, 0x1c202300, 0x43271d27, 0x322c2355, 0x23261137, 0x11070622, 0x3e37011e, 0x03200282, 0x27270f82, 0x0527012e, 0x8207010e, 
-    0x2c168202, 0x17011e17, 0x34353625, 0x15060527, 0x196e4314, 0x821a4721, 0x1a0e3a00, 0xb41a0e0e, 0x09152415, 0x06030406, 0x1d1d1507, 0x13b2fe14, 
-    0x10081326, 0x82028208, 0x2a022708, 0xf8fc6767, 0x44416262, 0x0322081b, 0x0203d403, 0x022efc02, 0x12082102, 0x0204050c, 0x2a030303, 0x0e100b06, 
-    0x12080108, 0x0509050b, 0x0482dafc, 0x08120b2d, 0xb6b67c99, 0xb27a067c, 0x82007ab2, 0x41082000, 0x3208085f, 0x00110009, 0x00230019, 0x0035002d, 
-    0x0047003d, 0x1624406d, 0x0103040d, 0x3a414500, 0x31323539, 0x2328292d, 0x15191e1f, 0x05090e11, 0x46010313, 0x82033d40, 0x06034663, 0x03001328, 
-    0x03020104, 0x53485f02, 0x8219200c, 0x03012560, 0x00630100, 0x93689a82, 0x08268406, 0x40594f31, 0x443e3f0d, 0x3f473e42, 0x05212347, 0x012b1608, 
-    0x17323336, 0x22232607, 0x013e0507, 0x010e1737, 0x012e2107, 0x011e3727, 0x35260117, 0x18173734, 0x250853a8, 0x14151637, 0x1b860107, 0x2b862120, 
-    0x27220526, 0x32331637, 0x01222682, 0x00824bd2, 0x3e1e2608, 0xfe3e3a3a, 0x37672a7f, 0x22512d3d, 0x51222803, 0x67373d2d, 0x10b5fb2a, 0x0d0d7710, 
-    0x0d0db703, 0xfc101077, 0x2012827c, 0x2c1a8265, 0x4c2de801, 0x60316527, 0x4bcffe37, 0x083a844b, 0x044b1e22, 0x77151567, 0x3a7b1111, 0x196a2055, 
-    0x43303043, 0x55206a19, 0x4409fe3a, 0x1e445252, 0x37414137, 0x1e200383, 0xfe210d83, 0x20188286, 0x27208247, 0x46334019, 0x58204f41, 0x77213783, 
-    0x0ef74415, 0x4b003324, 0xcd446a00, 0x80831805, 0x0344371a, 0x24401b4c, 0x03000100, 0x63030105, 0x01080500, 0x04050204, 0xcb4a0763, 0x69ae1805, 
-    0x351b2c0d, 0x011c1d34, 0x343f4100, 0x4f4b354b, 0x09200b07, 0x211f3947, 0x1046013e, 0x09074f07, 0x26223723, 0x05fd6727, 0x1805e74f, 0x4a08765e, 
-    0x1f4f1df6, 0x2e39330d, 0x62643266, 0x66326462, 0x33672d2e, 0x5c6a6a5c, 0xb3426733, 0x13334f1b, 0x1c1c5d29, 0x6e6eb139, 0x821c39b1, 0xaf332a00, 
-    0x33af7676, 0x00001c1c, 0x0c375004, 0x5d004b24, 0x4d418400, 0x00263005, 0x07060005, 0x0b630605, 0x010a0701, 0x18070204, 0x912377ac, 0x18002030, 
-    0x211177ac, 0x61414c4c, 0x5d4c2505, 0x55575d4c, 0x20116741, 0x4b67410c, 0xc5662720, 0x2e272a05, 0x07222301, 0x17141506, 0x19634516, 0x31129950, 
-    0x20401b39, 0x3b3e3e3b, 0x1d1b4020, 0x43371d41, 0x06823743, 0x0e24122c, 0x240e4343, 0x43232012, 0x87412343, 0xf738082f, 0x6d211211, 0x216d4545, 
-    0x11121112, 0x4b4b691f, 0x12111f69, 0x28080c6e, 0x08284c4c, 0x4d27140c, 0x0014274d, 0x01020000, 0x03d1013f, 0x00210491, 0x00270013, 0x002e4031, 
-    0x4d06dc4f, 0x1531127f, 0x1f000114, 0x1527141d, 0x00090b27, 0x06130113, 0x41d41808, 0x021e210b, 0x1365a418, 0x66022208, 0x2e4f6c3e, 0x3e6c502e, 
-    0x2e516c3f, 0x3f6d512e, 0x26415732, 0x32574125, 0x25405632, 0x01563f25, 0x221c83d1, 0x83506c3e, 0x3e3d2124, 0x3b252482, 0x32564125, 0x211d8331, 
-    0x25845640, 0x002fa682, 0xffecff02, 0x06e504ec, 0x00030028, 0x604b0017, 0x1625059a, 0x00030300, 0x301e8259, 0x01044b3b, 0x59010202, 0x3a010100, 
-    0x401b4c01, 0x2413821a, 0x03000203, 0x23168263, 0x57020101, 0x22081d87, 0x594d0102, 0x04050d40, 0x17040d0f, 0x10111705, 0x2b160805, 0x21112103, 
-    0x023e3201, 0x022e3435, 0x820e2223, 0x021e2ac5, 0xfbf90414, 0x3f7a0207, 0x21b2836d, 0x9d843f6c, 0x066c4f2c, 0x01c4f928, 0x6c512ee5, 0xae853d3e, 
-    0x18833e20, 0x03000026, 0x00feecff, 0x1f249b86, 0xb4003700, 0x20058555, 0x2b9d8921, 0x04050500, 0x0401075b, 0x064b3a04, 0x4020a887, 0x945ca882, 
-    0x001f2205, 0x231b8205, 0x63040502, 0x268e3189, 0x58503324, 0x26881c40, 0x00241c82, 0x5d010201, 0x03242e88, 0x23401b4c, 0x0520f383, 0x268bf382, 
-    0x4a87fc83, 0x5936fc83, 0x21154059, 0x2d040520, 0x2137202b, 0x040f1137, 0x111f051f, 0x06410810, 0x37363608, 0x34351236, 0x012e2702, 0x07062223, 
-    0x1415030e, 0x1e17021e, 0x175d4401, 0x20052741, 0x083c547d, 0x54544620, 0x4d45200c, 0x39200875, 0x3508f242, 0xd8f72806, 0x2c2bac01, 0xb40b0152, 
-    0x520b01b4, 0x2b2b2b2c, 0x6f546e29, 0x286f2405, 0x4d7b2b2b, 0x5d44097d, 0x2ed98209, 0x02ecff02, 0x06e50414, 0x00120028, 0x414c001f, 0x152d05ff, 
-    0x05060400, 0x04010303, 0x02005d01, 0x05094202, 0x1b4c0224, 0x30831b40, 0x0200042e, 0x01040063, 0x00570401, 0x59010404, 0x4d362886, 0x130e4059, 
-    0x131f1313, 0x2517261f, 0x08071011, 0x21032b19, 0xf28b2311, 0x34332322, 0x2005356c, 0x20f98216, 0x24e28215, 0x4e929f1a, 0x23da879d, 0x7083941a, 
-    0x25055354, 0x28067c78, 0xc48cecfb, 0x3fd69223, 0x22008223, 0x4289da44, 0xfe2b06b3, 0x02e50400, 0x000f0014, 0x426f0018, 0x18210515, 0x2da98205, 
-    0x065b0400, 0x3a040401, 0x0101004b, 0x065f5a03, 0x50232408, 0x83164058, 0x231c821f, 0x63040001, 0x40211d8b, 0x23188c1b, 0x57010303, 0x01311e86, 
-    0x59594e03, 0x10110f40, 0x18101415, 0x14111811, 0x25d68225, 0x33032b18, 0xc0821214, 0x32334f08, 0x35123637, 0x01211133, 0x11262722, 0x06071021, 
-    0x98991a14, 0x9a4a974f, 0x1a999998, 0x7c0207fb, 0x03f47a7a, 0x027af5d1, 0xfbfeb314, 0x582a2e58, 0xb3050158, 0x2702ecfb, 0x19018d47, 0x478de7fe, 
-    0x06000100, 0xcb041402, 0x16007c04, 0xb5453b00, 0x03112705, 0x01020101, 0xcb820073, 0xea825b20, 0x4c024425, 0x8616401b, 0x20148313, 0x31148257, 
-    0x02005b02, 0x594f0200, 0x142314b6, 0x18080425, 0xe654132b, 0x5223200a, 0x23210867, 0x208e8806, 0x0658527a, 0x01218b83, 0x228b8405, 0x52b3fbfe, 
-    0x0f570849, 0x14022706, 0x29001800, 0x6e842640, 0x84547220, 0x00012b10, 0x0c0e1314, 0x18000607, 0x81541801, 0x02262e07, 0x16143335, 0x33011e17, 
-    0x3e373632, 0x2c0c8201, 0x02060702, 0x4f974a67, 0x7f7a9998, 0x07cf4174, 0x99997a2d, 0x2e2a5498, 0xb3050158, 0x4142d68f, 0xb32a06c9, 0x5858fbfe, 
-    0x37010100, 0xef511402, 0x41382006, 0x33600503, 0x825b2009, 0x604420ed, 0x89510e33, 0x14b5280b, 0x08031511, 0x41012b17, 0x17360500, 0x010e0722, 
-    0x37012315, 0x974b9899, 0x7a7a014f, 0x027b7e76, 0xf182b314, 0x7b2c2c26, 0x94ce4447, 0x01224e82, 0x6f863801, 0x89000c21, 0x0200226f, 0x251b8373, 
-    0x0101005b, 0x6d180044, 0x267e0dc8, 0xb559240a, 0x84131115, 0x2710246f, 0x57352326, 0x232a05f5, 0x7cf41f03, 0x459f4d77, 0x6c82a28f, 0x8d19012b, 
-    0x27307b47, 0xb6f6fe51, 0x07cb5200, 0x00140227, 0x401e000a, 0x166d181b, 0x0ac54109, 0x10131422, 0x253e5183, 0x11363732, 0x07021433, 0x38012306, 
-    0x7bf47c77, 0x959b9999, 0x018d4727, 0x00ffb519, 0x4b835a59, 0xacff3724, 0x4b829a03, 0x26000d28, 0x01002340, 0xa2410102, 0x0103300b, 0x4f000200, 
-    0x0b0c0001, 0x0d000607, 0x47040d01, 0xa0410683, 0x33163b06, 0x4f990307, 0x99984b97, 0x7a767e7b, 0x2c54017a, 0x0501582c, 0x44ce94b3, 0x5b827b47, 
-    0xff060028, 0x04cb04b2, 0x537f0076, 0x09133508, 0x62020602, 0x9dfd6302, 0x62021402, 0x9efd9efd, 0x02000000, 0x072d278a, 0x07b50800, 0x02010305, 
-    0x09132b30, 0x272b8606, 0x5afea601, 0xa5015bfe, 0x02213387, 0x82118462, 0x203b8cbe, 0x203b8206, 0x213b8706, 0x3c871104, 0x35fecb22, 0xca22388a, 
-    0x72826cfc, 0x04203791, 0x02237386, 0x86010911, 0x36fe2339, 0x3987ca01, 0xfe2c0425, 0x8d36fe36, 0x000621ab, 0x156b4018, 0x03091323, 0x23438721, 
-    0x6bfccb01, 0x02214589, 0x20439162, 0xf740181b, 0x0913221a, 0x21c58a05, 0xc78b36fe, 0x00224983, 0x3b410300, 0x000b2f0c, 0x090bb70a, 0x01030507, 
-    0x132b3003, 0x3c8c0a09, 0xfeca0129, 0x016e0192, 0x8d92fe6e, 0x83e68346, 0x92fe2d15, 0x04000000, 0xfaff2c00, 0x7404a504, 0x2408975f, 0x0f0a400d, 
-    0x3654850d, 0x092b3004, 0x06090503, 0x01020905, 0x01040166, 0xfdfcfe04, 0x830301c2, 0x6f012107, 0x03240f82, 0xc4fdfdfe, 0x03291785, 0xfe05016f, 
-    0x33fdfefb, 0x21148201, 0x1482fcfe, 0xfefe0225, 0x8336fbfe, 0xfcfe242b, 0x18020000, 0x410a6391, 0x752e0df3, 0xf401f301, 0x81010cfe, 0x7ffe7ffe, 
-    0x91188101, 0x0433076f, 0xfc31032d, 0x00c7fccf, 0x00010000, 0x04f00006, 0x823803cb, 0x401822a3, 0x0fe86b15, 0x2105e568, 0x01822101, 0x91033a2a, 
-    0x6ffcccfe, 0xb8fd3803, 0x02203782, 0x0724378a, 0x26402900, 0x03211383, 0xfa5b1800, 0x04042c13, 0x07040704, 0x05101112, 0x822b1708, 0x25212548, 
-    0x01032113, 0x5b244e87, 0xbc53fdbc, 0x722e5483, 0x9cfe6401, 0x44010100, 0x8c03b2ff, 0xdf697604, 0x6a3c2012, 0x012d1c27, 0x01211121, 0xfd480244, 
-    0xfb7604b8, 0xa58e823c, 0x821320db, 0x04062436, 0x853bfbc5, 0x83d7b7d8, 0x11252346, 0x4a841121, 0xfc530423, 0x21d2891f, 0xd38a0200, 0x47000722, 
-    0x2605bf47, 0x03010413, 0x47030100, 0x3c2209bd, 0xbc494c02, 0x41022005, 0x59221546, 0x49410c40, 0x2111210e, 0xf3857183, 0xfed60123, 0x24f7839c, 
-    0xfce00372, 0x2cfc8220, 0xfe180201, 0x03e50400, 0x00050016, 0x056a4936, 0x16840e20, 0x61010022, 0x2106f166, 0xf8651540, 0x0fdb6d05, 0x3107db66, 
-    0x21152101, 0x18022311, 0xd3fdcd02, 0xac1603a0, 0x408496fb, 0x6a021826, 0x8107e504, 0x35205782, 0x0d21c985, 0xb45f1900, 0x06c86508, 0x22067879, 
-    0x82550102, 0x5a02215b, 0x4e206683, 0x22083267, 0x82113301, 0x18022b58, 0xfd2d02a0, 0xfb810733, 0x5682ac95, 0x21053b66, 0xaf8db802, 0x82000121, 
-    0x8b00203a, 0x132166af, 0x3520af89, 0xfd29af84, 0xa0cc02d4, 0xfaac6a02, 0x265882ea, 0x02ecff01, 0x8db8026a, 0x225682af, 0x655e0200, 0xaf821733, 
-    0x89020021, 0x210322af, 0x2ab18211, 0xa02c0214, 0x160334fd, 0x6dfa6b04, 0x57820b87, 0x67000b22, 0x20055f41, 0xeb861815, 0x4b3f280c, 0x40050500, 
-    0x411b4c05, 0x15250524, 0x05000500, 0x24218d73, 0x401b4c02, 0x21e1821d, 0x1c877202, 0x01000023, 0x2d238255, 0x04590001, 0x00010001, 0x4059594d, 
-    0x5b181109, 0x2d190c4e, 0x182008fd, 0x2c25e682, 0xfd2d02a0, 0x25eb83d3, 0x95fb6b04, 0x3b6ffbac, 0x16032509, 0x39000700, 0x0f299785, 0x01020100, 
-    0x00010300, 0x066c4961, 0x077c6318, 0x82096a67, 0x686d831f, 0xb2180856, 0x658208f7, 0x85f90421, 0x235e8462, 0xecff0100, 0x8406ff41, 0x5033245f, 
-    0x820e4058, 0x0300233d, 0x50410300, 0x00172108, 0x7222bc82, 0x6e820102, 0x84550021, 0x835a201c, 0x684e201f, 0x33260cb6, 0x21152111, 0xc2830214, 
-    0x0307fb23, 0x42c08416, 0x072109b7, 0x20bf8281, 0x20bf855d, 0x06e25b13, 0x1e826120, 0x4a4b3f21, 0x33200830, 0x13247a82, 0x03020300, 0x07dc9818, 
-    0x00201f84, 0x22054443, 0x86720001, 0x4202201a, 0x59260685, 0x02010200, 0x8389594d, 0x21058742, 0x89422311, 0xa0d32305, 0x42418107, 0x078b4206, 
-    0x4241838f, 0x02022105, 0x00208391, 0x1f888384, 0x1805c843, 0x260d4c9b, 0x01010055, 0x41005900, 0x674105d4, 0x3311210c, 0xfd248383, 0xa02c02d4, 
-    0x2105c941, 0xe8827ff6, 0x21066741, 0x97451603, 0x21032b1b, 0x04142115, 0x0307fbf9, 0x3383ac16, 0xfe180225, 0x6cb80200, 0x02254317, 0x07a0a018, 
-    0x82898281, 0x22538687, 0x4178000b, 0x1b20058f, 0x02249282, 0x61020301, 0x0027cc82, 0x61000105, 0x42040400, 0x1b250eed, 0x05000500, 0x28279373, 
-    0x401b4c04, 0x03040022, 0x05f34204, 0x4111e77f, 0xf8420723, 0x2135230f, 0x2a412135, 0x052e4109, 0xacbe0126, 0xbf03acac, 0x736ba682, 0x58032105, 
-    0x0724fb82, 0x66000b00, 0x1520a985, 0x0320a183, 0x0427a182, 0x3f020201, 0x6b01054b, 0x33240773, 0x15405850, 0xb8410e82, 0x2022840a, 0x209d8202, 
-    0x2209821c, 0x89720201, 0x4101201d, 0x978f0cbb, 0x012d9383, 0x01231133, 0x0174fe78, 0x01a0a08c, 0x08c64140, 0x83810921, 0x42002099, 0x0327054f, 
-    0x00160358, 0x853c0009, 0x00102299, 0x20978201, 0x209a8602, 0x23778340, 0x02010417, 0x820dde44, 0x00012421, 0x18b7594d, 0x25089092, 0x21352101, 
-    0x01832311, 0x03226d83, 0x6a84a06c, 0x04eafa23, 0x059b456a, 0xfeecff27, 0x03b80200, 0x206782c2, 0x20678548, 0x0b604116, 0xab410420, 0x04402105, 
-    0x1d24e582, 0x04000400, 0x8c0ca141, 0x20738de6, 0x25778435, 0xd4fd1802, 0x03822c02, 0x01a0cc2a, 0xacacacbe, 0x00003efa, 0x2505ff4f, 0x81075803, 
-    0x75820500, 0x80000f22, 0x1d207785, 0xa4761a82, 0x05002f06, 0x61050604, 0x01010103, 0x01074b3f, 0x7e830404, 0x20051345, 0x200e821d, 0x0ba77605, 
-    0x01202a8a, 0x2426a382, 0x00010103, 0x258f7201, 0x240df576, 0x0b405959, 0x24008511, 0x1c080810, 0x05ae452b, 0x11330123, 0x052d4123, 0x8c011423, 
-    0x33b384a0, 0xfec0fea0, 0xa02c0274, 0xbf03c203, 0x6b0495fb, 0xbe037ff6, 0x2405d344, 0xfe780102, 0x24c38400, 0x00070003, 0x20c18542, 0x05ab6a0d, 
-    0x01208282, 0x2405ad50, 0x40585033, 0x2091840d, 0x201a8473, 0x20a18200, 0x2209820b, 0x82720001, 0x69012115, 0x200d5a44, 0x20818423, 0x050f4278, 
-    0xf6810723, 0x060c427f, 0xecff0222, 0x03276b83, 0x000500c2, 0x854c000b, 0x0017246b, 0x41000001, 0x002b059d, 0x03040203, 0x02010561, 0x82024002, 
-    0x821e2060, 0x02032209, 0x2d1f8973, 0x55040303, 0x03040400, 0x04030059, 0x1e464d03, 0x25f58611, 0x34fdb802, 0xf2886c03, 0xfaac1623, 0x82ed853e, 
-    0xbe01217f, 0x7f83eb84, 0x82094b52, 0x05032b8e, 0x00000062, 0x5e020002, 0x4e6c0104, 0x821e2006, 0x01032409, 0x87030072, 0x6c02201e, 0x23470657, 
-    0x0b0c4306, 0x20057841, 0x062d4711, 0xfca0cc23, 0x05794194, 0x17056a24, 0xd4823dfa, 0x95fbbf22, 0x01245e82, 0x6a02ecff, 0x09227f84, 0x06423c00, 
-    0x020f2105, 0x0023fd83, 0x87035e04, 0x03182276, 0x06414601, 0x46040421, 0x04260541, 0x0004005a, 0x0b434e04, 0x256e840a, 0x11331133, 0x67821421, 
-    0x6e82a020, 0x47054446, 0x678206a0, 0x02be0127, 0x008107b8, 0x07714909, 0x02001528, 0x02000100, 0x86826101, 0x6e820420, 0x0303002d, 0x1b4c033f, 
-    0x03001d40, 0x89720302, 0x8373831c, 0x20729222, 0x05844435, 0x02142132, 0x02d4fd2c, 0x34fda02c, 0xacac6a02, 0x3dfabf03, 0x00203082, 0x22067349, 
-    0x45008107, 0x0b5d0a2b, 0x00612705, 0x05040003, 0x7b830403, 0x21112b45, 0xc3460504, 0x20278a09, 0x219c8200, 0xb3820022, 0x05007222, 0x565d228c, 
-    0x0b244810, 0x21113323, 0x46018415, 0x023208da, 0xa0d3fd2d, 0x41fc8107, 0xfcacacac, 0x02000042, 0x97727801, 0x0a2b4508, 0x01207982, 0x0228a182, 
-    0x3f000001, 0x0101054b, 0x200af742, 0x220e8215, 0x83730104, 0x832288c4, 0x821c209d, 0x0003222c, 0x9e1d8772, 0x01232197, 0x11229b84, 0x17430123, 
-    0x8d012305, 0x978273fe, 0x097ff622, 0x83087a47, 0xbe01219b, 0x20065f4a, 0x09eb540b, 0x05000428, 0x62050401, 0x20820100, 0x035e0222, 0x7f83a283, 
-    0x09821e20, 0x72000423, 0x471e8800, 0x734a07ed, 0x0cac4506, 0x82857c84, 0x02348082, 0x0193fccd, 0x8d01a040, 0x8107d3fd, 0x05ace9fa, 0xac41fcc3, 
-    0x43081b41, 0x002d0f9f, 0x00030100, 0x03006101, 0x03020400, 0x0d9f4304, 0x98500420, 0x187a1805, 0x0e9f4313, 0x82211521, 0x842120fb, 0x03783a05, 
-    0xa033fd6d, 0x2d024001, 0x03a073fe, 0xeafaacc2, 0xfcac6a04, 0xff030042, 0x22ff8aec, 0x4351000f, 0x18250523, 0x05000104, 0x07514501, 0x07060723, 
-    0x082c435d, 0x09822020, 0x72010022, 0x0729208b, 0x00550607, 0x59070606, 0x20298200, 0x1720454d, 0x05208882, 0x20450382, 0x8d012908, 0x34fdd3fd, 
-    0x07fbf904, 0x24072245, 0xacac41fc, 0x08e355ac, 0x82c20321, 0x000924fe, 0x4453000f, 0x192105b5, 0x06154100, 0x03010529, 0x04020106, 0x45610203, 
-    0x402107df, 0x22098221, 0x8a730402, 0x02022321, 0x28825503, 0x59020327, 0x03020106, 0x21959102, 0xb0452115, 0x05764c05, 0x87831420, 0xfe8c0125, 
-    0x412c0274, 0xfe240a25, 0x96fbaca8, 0x82052841, 0x4203205a, 0x97830ac7, 0x43087b46, 0x62280543, 0x06000500, 0x61060501, 0x2005d142, 0x0cd14207, 
-    0x0e821d20, 0xd1420620, 0x03052205, 0x242a8d04, 0x401b4c00, 0x05d94224, 0xe718258f, 0x7b4610dd, 0x3301220c, 0x06e34211, 0xe5411520, 0x82a02006, 
-    0x01a026bc, 0x02d3fd8d, 0x08eb422d, 0x41098743, 0x032905eb, 0x000300c2, 0x40220007, 0x09a04d1f, 0x105be118, 0x08041025, 0x82032b18, 0x24598355, 
-    0xfbf90414, 0x05a84107, 0xacacac26, 0xecff0400, 0x2806cf43, 0x000b0005, 0x00170011, 0x05a14194, 0x14422120, 0x00072c05, 0x01096202, 0x06010a07, 
-    0x47060708, 0x0b250689, 0x40080801, 0x079d4c08, 0x0e822120, 0x73080622, 0x012a2e98, 0x29401b4c, 0x00010103, 0x29927201, 0x07060623, 0x225f8255, 
-    0x82590607, 0x06072c62, 0x4059594d, 0x15161712, 0x47121314, 0x11250597, 0x080c1011, 0x0999471d, 0xea41c582, 0x4701200c, 0x012306a1, 0x47d3fd8d, 
-    0x184306a4, 0x05ab4708, 0xac41fc22, 0x200afa41, 0x08234302, 0xef820720, 0x2e07c346, 0x00000102, 0x03000403, 0x00040062, 0x73050405, 0x1e200812, 
-    0x87078d4c, 0xa67c181d, 0x11c3460e, 0x20053e45, 0x069b4c14, 0x21056741, 0x8382bf03, 0x4cacac21, 0x0b220aff, 0x9b434100, 0x04102805, 0x00000202, 
-    0x46050005, 0x1a2009c0, 0x83052b41, 0x05052318, 0x20855500, 0x23835a20, 0x12444e20, 0x09c4460c, 0xc6461520, 0x8d012206, 0x060d4dfb, 0x8205114d, 
-    0x00fe27eb, 0xc203e504, 0x2f480300, 0x088f440b, 0x02010426, 0x61020305, 0x25066b4e, 0x05001e40, 0x76430502, 0x03002a08, 0x55030202, 0x02030300, 
-    0x21278259, 0x2f480203, 0x4103200d, 0x15240687, 0x14231121, 0x022de583, 0x04d4fd2c, 0xa0d3fdf9, 0xfeacc203, 0x052b46a8, 0x5b420120, 0x16032105, 
-    0x40207d82, 0x23055542, 0x04010011, 0x0323f182, 0x4b610001, 0x40210751, 0x102e4b18, 0x01212283, 0x4e718d00, 0xc14a0756, 0xf9042307, 0xc34a73fe, 
-    0xfbac2205, 0x05c44a96, 0x78010122, 0x48065f4e, 0x0327091f, 0x04000101, 0x495e0401, 0x18200876, 0x21087649, 0x304f0404, 0x5a042105, 0x1f482183, 
-    0x3301220b, 0x83018311, 0x827820e3, 0x8d012763, 0x810793fc, 0x674e95fb, 0x0667450a, 0x470a1f48, 0x03300aab, 0x00005e04, 0x4c003f00, 0x001d401b, 
-    0x72000100, 0x2008844e, 0x07e54603, 0x03207282, 0x460c9248, 0x1520055b, 0x2008dd50, 0x05e150d3, 0x4e053842, 0x9f4b09db, 0x205c820d, 0xf5e51802, 
-    0x4b04200c, 0x0320079f, 0x18053f45, 0x4c135878, 0xed470c13, 0xcd022209, 0x237383fd, 0xc203a0d3, 0x2106ea47, 0x23450100, 0x0d7b4c05, 0x01030023, 
-    0x20568301, 0x07664a04, 0x09821720, 0x0d798418, 0x00212182, 0x0d7b4c01, 0x7b4c1520, 0x6d032508, 0xa0a073fe, 0x4c051352, 0x04270b7b, 0x008107e5, 
-    0x42790013, 0x19290527, 0x01020305, 0x00020608, 0x08814d07, 0x07010925, 0x44074007, 0x19200775, 0x00220e82, 0x26907307, 0x1b4c0224, 0x91842240, 
-    0x21897220, 0x01000023, 0x06467455, 0x1c515383, 0x180e2005, 0x490f9aa5, 0xf841059f, 0x092a4d06, 0x828c0121, 0x8d0121ae, 0x0224b584, 0x6b04ac6a, 
-    0x42060842, 0x40180775, 0xbf840873, 0xbf858a20, 0xd7461f20, 0x03012a05, 0x01076102, 0x00010801, 0x08eb4e09, 0x40090923, 0x25c58709, 0x0009001f, 
-    0x2b977309, 0xcb820420, 0xef4e2720, 0x82269005, 0x07552675, 0x00010101, 0x995c8259, 0x07744ad0, 0x4d09e741, 0xfe510687, 0x2d022305, 0x904dd3fd, 
-    0x06a34405, 0x0042fc22, 0x200d2f58, 0x05a7442d, 0x55086f7f, 0x10551d47, 0x76042308, 0xdb573cfb, 0x49bb540c, 0x54102d55, 0x738a0bba, 0x17000b2b, 
-    0xb04bad00, 0x40585007, 0x085a6717, 0x176d4b20, 0x42002208, 0x31501800, 0x15396507, 0x15b04b22, 0x3e203a9d, 0x3f36d170, 0x40595959, 0x010c0d13, 
-    0x0c101300, 0x07160d17, 0x010b0004, 0x1408060a, 0x1920052b, 0x01291001, 0x213f0583, 0x11353235, 0x22212334, 0x33141115, 0xaafe5c01, 0x19025601, 
-    0xaafe5601, 0xe7fde4e4, 0x824ee4e4, 0x8318200e, 0xe8fd270e, 0xe472aafe, 0x16821802, 0x00e4e822, 0x87580082, 0x415b200f, 0x1b2905bf, 0x05000400, 
-    0x61050403, 0x13395606, 0x38822220, 0x18040221, 0x241c22c9, 0x04104059, 0x25c91804, 0x21112118, 0x2408bb56, 0xfc1a0363, 0x089241e6, 0xfc7d0325, 
-    0x590c00e6, 0x0524081b, 0x0d000900, 0x200a217a, 0x051f7a29, 0x68014b08, 0x501cb04b, 0x09424058, 0x0a010201, 0x16680201, 0x130f1201, 0x0c681213, 
-    0x010d0a01, 0x0b0a0e0b, 0x0e011061, 0x120f0111, 0x1a610f0e, 0x13031518, 0x0317191b, 0x5e141314, 0x03040607, 0x59000101, 0x03030508, 0x013c0000, 
-    0x657a1b4c, 0x8c432005, 0x120f2349, 0x4ab47013, 0x94823320, 0x4a864420, 0x84700a21, 0x214bb695, 0x46914d40, 0xc184b484, 0x01000223, 0x23a09861, 
-    0x55131414, 0x1322f484, 0xf7865a14, 0x59594e25, 0x7a324059, 0x1c272e8f, 0x132b1d08, 0x7a231533, 0x25200591, 0x21220982, 0x05823523, 0x82129b7a, 
-    0x33252115, 0x25831b83, 0x06370383, 0x017256c8, 0x01b4b462, 0x01aeae4e, 0x73cd5aa2, 0x7272aefb, 0x8b735204, 0xc8562807, 0x735af803, 0x856afdcd, 
-    0x76042526, 0x72c85672, 0xc82e0082, 0xb3b3b39a, 0xaeaeae9b, 0x72725a9a, 0x1182cc5a, 0x00007223, 0x0e2f5b06, 0x2005377c, 0x05ad42af, 0x010c3722, 
-    0x2205864b, 0x64010d61, 0x613805e5, 0x0007010e, 0x08070908, 0x09010f61, 0x090b0a00, 0x0110610a, 0x0b01000b, 0x280e0359, 0x0000003e, 0x02000302, 
-    0x2341a661, 0x550b0101, 0x0b224882, 0x4b835901, 0x594d2508, 0x14142c40, 0x0c0c1010, 0x04040808, 0x17141714, 0x13101516, 0x11121310, 0x0f0c0f0c, 
-    0x0b080d0e, 0x090a0b08, 0x2c06915a, 0x2b170811, 0x21112113, 0x15213501, 0x43038e05, 0x0323080d, 0x8b1ffce1, 0x76042a03, 0xe8033cfb, 0x6bdd6a6a, 
-    0x2502826b, 0xe06a6adc, 0x0b416e6e, 0x41872016, 0x1f2a050b, 0x090f0b10, 0x050d070e, 0xf359090c, 0x080a2505, 0x02040406, 0x2705b561, 0x1b4c023c, 
-    0x00002e40, 0xf7831385, 0x01232d8a, 0x8a550301, 0x8303200e, 0x010321e3, 0x3724e3b4, 0x21112311, 0xe384038e, 0x016adc2d, 0x48016c48, 0x6a46016a, 
-    0x436e4a01, 0xe02309f6, 0x8a0320fc, 0x00002203, 0x14ef411a, 0x7c13277e, 0x01211267, 0x050b41cf, 0x38736408, 0x3609370b, 0x34053507, 0x12140309, 
-    0x0c040e10, 0x610c030d, 0x133c153d, 0x0f3a113b, 0x1e0d0939, 0x04181a1c, 0x160d1716, 0x411f4261, 0x3f1b401d, 0x17093e19, 0x22242628, 0x17212004, 
-    0x29476120, 0x25452746, 0x09432344, 0x2e303221, 0x2b2a042c, 0x4c612a21, 0x4a314b33, 0x482d492f, 0x01002b09, 0x415d012b, 0x8220105f, 0xde0b5f41, 
-    0x01012381, 0x908a552b, 0x59012b22, 0x2b089383, 0xcc40594d, 0x60606464, 0x58585c5c, 0x50505454, 0x48484c4c, 0x40404444, 0x38383c3c, 0x30303434, 
-    0x28282c2c, 0x20202424, 0x18181c1c, 0x0809bf42, 0x64676477, 0x60656667, 0x62636063, 0x5c5f5c61, 0x585d5e5f, 0x5a5b585b, 0x54575459, 0x50555657, 
-    0x52535053, 0x4c4f4c51, 0x484d4e4f, 0x4a4b484b, 0x44474449, 0x40454647, 0x42434043, 0x3c3f3c41, 0x383d3e3f, 0x3a3b383b, 0x34373439, 0x30353637, 
-    0x32333033, 0x2c2f2c31, 0x282d2e2f, 0x2a2b282b, 0x24272429, 0x20252627, 0x22232023, 0x1c1f1c21, 0x181d1e1f, 0x1a1b181b, 0x1e374319, 0x37434d20, 
-    0x7a132006, 0x21200626, 0x0520078a, 0xa34213ce, 0xf8fc2112, 0xac0cb242, 0x07bd430e, 0x00866a20, 0x886bdd21, 0x200a8a00, 0x821d86dc, 0x6ee02106, 
-    0x736c0088, 0x07876106, 0x00092108, 0x0011000d, 0x00180014, 0x001f001c, 0x1e11408a, 0x16171a1b, 0x0d0e1114, 0x0c05080a, 0x4a010203, 0x2805f242, 
-    0x0c090d1c, 0x0a070b08, 0x05fc4307, 0x04050623, 0x0bfb4303, 0x00002922, 0x03231284, 0x88610200, 0x01012329, 0x0c885503, 0x0809f643, 0x1d1d2422, 
-    0x15151919, 0x1f1d0404, 0x1c191f1d, 0x18151c19, 0x12131815, 0x0b0c0f10, 0x09040904, 0x0e101113, 0x2a069a41, 0x23013525, 0x01130115, 0x83110123, 
-    0x17232603, 0x01150103, 0x08038227, 0x1527233e, 0xfbc50406, 0xfc53043b, 0x97034d6c, 0x97a4fd4a, 0xd0fef302, 0x8eba018a, 0x0bfdec8e, 0xfea26002, 
-    0xa2340142, 0xfb760492, 0x034c723c, 0x6afc4a94, 0x5b028501, 0xc3010efd, 0x46fe2f01, 0xfc302682, 0x96f502ae, 0x0101a0fd, 0xcdfe8bbe, 0x08009292, 
-    0x220c1744, 0x410e000a, 0x80300813, 0x1b1e1140, 0x1315161a, 0x0a0d0e10, 0x060c0607, 0x30081341, 0x0b090c1b, 0x060a0708, 0x06010006, 0x04055d01, 
-    0x0c124103, 0x00002722, 0x06231284, 0x87610200, 0x01012328, 0x0b875506, 0x59010622, 0x4d293783, 0x1d1d4059, 0x0f19191d, 0x070e410f, 0x0f17182e, 
-    0x15140f14, 0x11111312, 0x1a080d10, 0x2605dc45, 0x13150123, 0x82251523, 0x01172206, 0x24058235, 0x17013501, 0x08048225, 0x07352130, 0xfbc50406, 
-    0x8a2c023b, 0x8e8ed0fe, 0xfd97f302, 0x97034aa4, 0x036cfc4d, 0x950bfde1, 0x34012c01, 0xbe0142fe, 0xfb760492, 0xfe52043c, 0xfb828bd1, 0xa5fd8e39, 
-    0x9603ee97, 0x4c6cfc4a, 0xfd965f02, 0x0101010b, 0x42fe8b33, 0x45009292, 0x08240d1f, 0x12000d00, 0x0c454318, 0xa97e3020, 0x46002107, 0x0c834118, 
-    0x00642608, 0x006e0069, 0x40c90073, 0x70717253, 0x686b6c6d, 0x62636667, 0x5d5e5f61, 0x57595a5b, 0x52535556, 0x4d4e4f51, 0x6740184b, 0x40412907, 
-    0x3b3c3d3f, 0x35373839, 0x07634018, 0x292a2b38, 0x23252627, 0x1e1f2122, 0x191a1b1d, 0x12131617, 0x080c0d11, 0x6d414e07, 0x08814209, 0x20156e41, 
-    0x0a6e4129, 0x23077442, 0x06010106, 0x20088142, 0x09704106, 0x6f212008, 0x656a6a6f, 0x6f606065, 0x6a736f73, 0x656e6a6e, 0x60696569, 0x14646064, 
-    0x11121414, 0x41080e10, 0x13280574, 0x17152327, 0x07232725, 0x35200486, 0x05250982, 0x2f170727, 0x21118301, 0x0b831707, 0x84272521, 0x2027820b, 
-    0x87098235, 0x82218311, 0x8615860b, 0x842f8823, 0x2737251d, 0x35211507, 0x21213382, 0x08048737, 0xc5040629, 0x21e03bfb, 0x7e01224d, 0x4521551b, 
-    0x55217e01, 0x54014c1b, 0xfe4b204d, 0x4b4b4c7d, 0x454b46ec, 0x454bb602, 0x8277fe4b, 0x8401390d, 0xfd4c4c4b, 0x1c2246db, 0x4522c503, 0x4c40fd4a, 
-    0xbb024c4b, 0xec4b4c4b, 0xfe301c82, 0x231d4b78, 0x4b1dbe03, 0x4ce2fd45, 0x83014b4a, 0x34081385, 0xae024b45, 0xe6454b45, 0xfe4a4a4c, 0x234b245a, 
-    0x4b23e103, 0x1eebfd24, 0x0124454b, 0x4b452479, 0xfb76041e, 0x2032043c, 0x1a52224a, 0x21454521, 0x4a1c4c1a, 0x82578220, 0x4c452202, 0x22028245, 
-    0x824c514c, 0x28038249, 0x5222454c, 0x22521d1d, 0x82118245, 0x20768287, 0x2d00824b, 0x521c4b50, 0x1c522222, 0x4b44454b, 0x78824c4a, 0x4b504b24, 
-    0x02824b45, 0x4a454525, 0x826e4c4a, 0x4c4c2171, 0x1e207182, 0x24206f82, 0x00206d82, 0x01280082, 0x8700db00, 0xa103f503, 0x2f1b235e, 0x21112113, 
-    0xfc1a03db, 0xfca103e6, 0x020000e6, 0xb763338a, 0x07b14d2b, 0x02234a84, 0x83cafda8, 0x0272244e, 0x65cafd36, 0x234e0dc7, 0xfe522257, 0x16234e10, 
-    0xd6000321, 0x62022173, 0x0627739a, 0x05b54500, 0x45000201, 0x0e2107e3, 0x220c8303, 0x185e0102, 0x25077e5c, 0x02000017, 0x15827200, 0x0201013d, 
-    0x02010355, 0x005a0102, 0x4e010201, 0x040b4059, 0x04060404, 0x04101106, 0x412b1608, 0x01290557, 0xfbc50406, 0xfc52043b, 0x20e48b20, 0x0a574502, 
-    0x3f000625, 0x820106b5, 0x06534640, 0x6a001021, 0x59200783, 0x02247183, 0x15401b4c, 0x94181285, 0x5920086f, 0x02218082, 0x0877634d, 0x01206983, 
-    0x830aa064, 0x20718369, 0x10f76600, 0xb6465720, 0x07162405, 0x46030605, 0x042105b2, 0x0bb04601, 0x00001f29, 0x03020104, 0x84610200, 0x01012321, 
-    0x08845503, 0x2409a646, 0x04080814, 0x0c694b04, 0x96460820, 0x21112107, 0xf0840184, 0xfe290227, 0xfee00349, 0x0c734a49, 0x0d228f8f, 0x8f856500, 
-    0x01071d24, 0x92820003, 0x08610523, 0x05c74401, 0x2420968d, 0x288a9689, 0x06010123, 0x202f8255, 0x08314606, 0x9b841620, 0x0d080d23, 0x09074c0c, 
-    0x9d860920, 0x9b820120, 0x26410383, 0x219f8706, 0xa183d7fd, 0x019a022d, 0xfd48feb8, 0xfde003d8, 0x4f4afed6, 0x09240ea7, 0x66000d00, 0x0020a786, 
-    0x0421a682, 0x24a68203, 0x04030706, 0x0ba16d00, 0x4c023c23, 0x092a671b, 0x0124278c, 0x08550401, 0x04203083, 0x042ca983, 0x40594d01, 0x040a0a15, 
-    0x0a0d0a04, 0x042aa982, 0x11090409, 0x09101112, 0x32421808, 0x4b212006, 0x394206cc, 0x29022208, 0x08494172, 0x0121a683, 0x50a483b6, 0xa38c0b4b, 
-    0x05000224, 0xa38c0204, 0x4f700320, 0x033c2105, 0x0325a386, 0x61030002, 0xb3278b00, 0x84a783a3, 0x290225a3, 0x20fc2902, 0x2508ee41, 0xb8012802, 
-    0xa48420fc, 0x6420a38f, 0x2a064741, 0x00060108, 0x02060402, 0x41010761, 0x05210546, 0x26a38b01, 0x05000024, 0x82060301, 0x23288ba4, 0x55040101, 
-    0x45412f82, 0x6701202a, 0x522208b6, 0x9042d7fd, 0xb601250a, 0x20fc2a02, 0xfe38a783, 0x00020048, 0x040d0061, 0x001b046f, 0x00070003, 0x35b04b48, 
-    0x14405850, 0x210af468, 0x81710103, 0x26c4670c, 0x3305fe43, 0x04611121, 0x03f2fb0e, 0x04d6fc9c, 0x72f2fb1b, 0xd6fc2a03, 0x01205a82, 0x2d20738a, 
-    0x0b207185, 0x68881683, 0xae691020, 0x7f53180f, 0x84568307, 0x824e8352, 0x00af26bb, 0x0321045b, 0x69bb84cd, 0x9c8729ab, 0x7203af31, 0x00038efc, 
-    0xcd0372fd, 0x02728efc, 0x8272fd8e, 0x89002077, 0x18376a53, 0x3c854083, 0x33833882, 0x2307c36c, 0xb70a0002, 0x6930c982, 0x15080111, 0x2101092b, 
-    0x63026802, 0x76043bfb, 0x6c08b769, 0x022a06eb, 0x02b30600, 0x2b300100, 0x22450913, 0xfd762406, 0x549efd9e, 0x02250cdf, 0x02b31e00, 0x06e45f01, 
-    0x0e206f18, 0x5f831020, 0x83211321, 0x9dfd213b, 0x01205e84, 0x84085345, 0x8301205b, 0x1101285b, 0x02c50406, 0x54620214, 0x02310cef, 0x23000500, 
-    0x01042040, 0x01024801, 0x01000001, 0x20068255, 0x06c36501, 0x03030327, 0x11050305, 0x22be8503, 0x86010925, 0xfe1a22c1, 0x07844348, 0x92fc6e22, 
-    0x830c8f6d, 0xb508264f, 0x00020405, 0x20cf8302, 0x052a6a03, 0xfce10324, 0xd4840491, 0x01620225, 0x8290fcb8, 0x0aff5432, 0x33253383, 0x020205b4, 
-    0x06356a01, 0x2920c355, 0x08021012, 0x21132b16, 0xf5860109, 0xfc950125, 0x839401d7, 0x430423fb, 0x5b8ed8fc, 0x03228f82, 0x8f830102, 0x0311012c, 
-    0x04060109, 0x91fc72c5, 0x0b416f03, 0x83042005, 0x444820cc, 0x8f830ce7, 0x34001932, 0x01043140, 0x03004803, 0x01020105, 0x04630203, 0x82051e41, 
-    0x071e4106, 0x0306072f, 0x060f1103, 0x03190719, 0x11050305, 0x08264106, 0x2e222524, 0x30193502, 0x36410a3b, 0xb601290b, 0x1424311c, 0x1c312415, 
-    0x15230782, 0x46312515, 0x6e240516, 0x14c192fc, 0x14201485, 0x1b230783, 0x48152431, 0xa7410b73, 0x1101212b, 0x5d887089, 0x410e1341, 0x112027f3, 
-    0x2106f341, 0xf1416202, 0x0001280b, 0x04870006, 0x83a103cb, 0x0dbb4255, 0xfea10328, 0x0073fe73, 0x238e0000, 0x230b8342, 0xe6fc8d01, 0x43883983, 
-    0x42000521, 0x02210a33, 0x06344225, 0xcafca822, 0x01244d85, 0x3cfee28d, 0x33915282, 0x2009d741, 0x05d7410d, 0x3603ca24, 0x5f831402, 0xe26f0223, 
-    0x4a8382e2, 0x8b43073b, 0x4a248311, 0xab83052d, 0x8b432789, 0x4adb2009, 0xcf880550, 0x0f262389, 0x01020c40, 0x92824700, 0x7c436920, 0x212c8207, 
-    0x4f9673fe, 0x2282fb86, 0x9f4a9b85, 0x2bd7410a, 0x02010b23, 0x83da8768, 0x01722469, 0x8e3cfec4, 0x0d47414b, 0x0223c184, 0x413cfe36, 0xcb891047, 
-    0x1d000527, 0x02051a40, 0x7a721802, 0x07654311, 0x21130123, 0x23de8413, 0xe23cfee2, 0x02217883, 0x417793a8, 0x2e820b8b, 0x3cfe7224, 0x8b41c401, 
-    0x0917450c, 0x2420cb44, 0xc5040611, 0x05284504, 0x260bcb44, 0x000c400f, 0x45480001, 0x01240854, 0xcb042111, 0x9b065245, 0x01132227, 0x45508221, 
-    0x8ba0157b, 0x45079345, 0xb3441037, 0x03112235, 0x08aa4221, 0x0423e283, 0x45cafc52, 0x2425110f, 0x00042140, 0x1e944502, 0x2524fe82, 0xcb040111, 
-    0x5322d882, 0xea43cafc, 0x83362005, 0x4502204d, 0x05210aff, 0x244ba400, 0x25210113, 0x09784301, 0x4b8d4c89, 0x0920f3b5, 0x2107924b, 0xa785a803, 
-    0x0120f486, 0x2105f377, 0xdb4d6c03, 0x1a5b181b, 0x6c032c08, 0x0000a8fe, 0xfec80101, 0x6b080300, 0x212940ff, 0xc8012111, 0xc0fe4001, 0x05c06a07, 
-    0x3c000328, 0x95046a02, 0x8b821603, 0x0b000727, 0x1f402200, 0x6e881804, 0x11112b17, 0x1a080610, 0x1521132b, 0x03862521, 0x23013c26, 0x9b01ddfe, 
-    0x03220589, 0x0083ac16, 0x3c224d82, 0x57821402, 0x57a8e383, 0x9f839b82, 0x57910382, 0xa8fe6c24, 0x03855801, 0x00820020, 0x18020328, 0xb8026dfe, 
-    0xb7861307, 0xb04b5226, 0x4058502c, 0x18898818, 0x4c053e25, 0x8220401b, 0xa7881838, 0x1a30620e, 0x11330124, 0x03861523, 0xa0180222, 0x07240084, 
-    0xb496fd13, 0x4a820284, 0xc8010326, 0x08036dfe, 0x212383dc, 0x86152111, 0x05b74103, 0xfe400123, 0x8a0383c0, 0x41042089, 0x0f2d0ec3, 0x24402700, 
-    0x03020406, 0x00010100, 0x2a088455, 0x07590100, 0x01030305, 0x6b4d0100, 0x13210b50, 0x096c5a33, 0x0b822520, 0xbcbc3c24, 0x03873401, 0x41bdbd21, 
-    0xac2406cc, 0x040000ac, 0xcf416382, 0x2163ab0b, 0x3c652311, 0x8f078406, 0x0ad84163, 0xfe580124, 0x6b8200a8, 0xfe180227, 0x07b8026e, 0x085b7512, 
-    0xb04b6427, 0x4058502a, 0x11bf4123, 0x06050025, 0x67610504, 0x07260610, 0x1b4c073e, 0x25992840, 0x411c3c67, 0x15230bef, 0x41231133, 0xa02607f3, 
-    0xfe1207a0, 0x0287b45e, 0x01259f82, 0x036efec8, 0x429ff008, 0x15200a0b, 0x4208c743, 0x0783070f, 0xb36aa78e, 0x6c032106, 0x203b2774, 0x0a277411, 
-    0xa8fe6c25, 0x4400ecfb, 0x7f74058b, 0x01212d42, 0xfe1d03c8, 0x03c0fe23, 0x96fbac16, 0xafbf5789, 0xb0855789, 0x3b6f0120, 0x74578c06, 0x07412f7f, 
-    0xd4fd2a05, 0x02a0cc02, 0xfa580114, 0x83af8294, 0x08032157, 0x8240d774, 0x24fe26af, 0xc0fe1c03, 0x05d87402, 0x5782af84, 0x5789afbf, 0x0124b085, 
-    0x14021802, 0x2140df75, 0xdf752111, 0xfeeb2809, 0x000000a8, 0x76c80101, 0x21233f37, 0x82152111, 0x400127ae, 0xe3fcdd01, 0x38768107, 0xbe578305, 
-    0x465782af, 0x578605f0, 0x0124b084, 0x1402ecff, 0x25493776, 0xfa15046c, 0x00820093, 0x6a235783, 0x77070803, 0x00220c3f, 0x8f760200, 0x26b1822c, 
-    0x01dc0114, 0x76e4fc40, 0xaf840890, 0xb08757ca, 0x2109d36e, 0x8f750007, 0x05404361, 0x2305d576, 0xebfb8107, 0x250c4b44, 0x09008107, 0x9b656800, 
-    0x00172805, 0x02000002, 0x18010355, 0x72095e5e, 0x17250b59, 0x04000400, 0x24238f73, 0x401b4c01, 0x2419851c, 0x01000201, 0x7d9a1855, 0x2348820a, 
-    0x594d0002, 0x200b5767, 0x328c8223, 0x11211521, 0x50180223, 0xdd014001, 0x02a0d3fd, 0x7617056a, 0x01220624, 0x736bc801, 0x00092206, 0x2a938762, 
-    0x03000403, 0x01010055, 0x82024b3f, 0x59042298, 0x21938b00, 0x1e840014, 0x00211984, 0x089e6a04, 0x9e6a1920, 0x8461200c, 0x2138821e, 0x8d8d0400, 
-    0x2607d266, 0x50c80121, 0x452d02a0, 0xf5770511, 0x08174508, 0x37770720, 0x0a6a4862, 0x83dd0121, 0x6f072088, 0x134106be, 0x6ea7410b, 0x41053842, 
-    0x142208a7, 0x3c426d05, 0x74a74106, 0xa7418d82, 0x046c220b, 0x418d8615, 0x88856fa7, 0x41400121, 0x514308a7, 0x46878206, 0x2f4205ef, 0x54e3780f, 
-    0x33208582, 0x240ae378, 0x04580114, 0x2f671815, 0x08032108, 0x09228382, 0x43436100, 0x00142e05, 0x00010301, 0x62000104, 0x3f020200, 0x0e40434b, 
-    0x04000423, 0x29208c73, 0x401b4c02, 0x0102001b, 0xd6437202, 0x2bd88206, 0x01010055, 0x01035a00, 0x4e000100, 0x210cd043, 0x33573521, 0x02232905, 
-    0x01d4fd18, 0x504001dc, 0x23056f79, 0x96fbe9fa, 0x8506a377, 0x06cf438b, 0x01031424, 0x8b830001, 0x8b976120, 0x8b83208c, 0x8b891c20, 0x9c6c1b84, 
-    0x06335405, 0x332e8c90, 0x21113311, 0x24fec801, 0x50a02c02, 0x986ac0fe, 0xeafa2206, 0x20008200, 0x05374801, 0x20649f41, 0x06014735, 0x0124fe25, 
-    0x864001dc, 0x07fb7988, 0x206a9f41, 0x119f4111, 0x58011428, 0x93fa1504, 0x1341ecfb, 0x0873450d, 0x825da341, 0x0fa34190, 0xfb239084, 0x4194faeb, 
-    0x8a826ea3, 0x2c422120, 0x06a34105, 0x6c084543, 0x032108bb, 0x0bf7796c, 0x03000223, 0x7e781800, 0x08576e0c, 0x73040023, 0x07ff4600, 0x9a7c2386, 
-    0x0bf77908, 0x43054776, 0xcc2606b8, 0xd3fd2d02, 0x758202a0, 0x677e5620, 0x21738c0c, 0x3f440001, 0x03002206, 0x467b8304, 0x402405fe, 0x0304001d, 
-    0x02227382, 0xf1180301, 0x6b7a14cb, 0x08454b0f, 0xcd022c22, 0x6a227383, 0x074856ac, 0xecff2506, 0xe50400fe, 0xdb7ee782, 0x2060823d, 0x21d68521, 
-    0xd486f904, 0xeb706084, 0x215fbd09, 0x7a4d2135, 0x24fe2a05, 0x23fef904, 0x6a02c0fe, 0x193341ac, 0x2648a741, 0xfec80121, 0x451c0324, 0xa84105ea, 
-    0x41d38708, 0x738455a7, 0x4ddc0121, 0xe68205a1, 0x8905a841, 0x3d474173, 0x4109f342, 0x14240647, 0xa8fe5801, 0x4c080b44, 0xdf7906a7, 0x0577420c, 
-    0x04000024, 0x40180400, 0x1d2d088e, 0x01000100, 0x02000072, 0x00550004, 0x069a4202, 0xdf792282, 0x33112112, 0x7305f442, 0xfd2c05fb, 0x0334fdd3, 
-    0xfb15046c, 0x0056ac95, 0x9105ef43, 0x07224673, 0x04000323, 0x32738203, 0x023f0202, 0x1d401b4c, 0x02030200, 0x01030072, 0x7b550304, 0x032208bc, 
-    0x33720403, 0x05b17011, 0x21112123, 0xd1411802, 0x46332008, 0x874c0509, 0xe5042709, 0x07008107, 0x175d3900, 0x6f411805, 0x21112138, 0x086f4118, 
-    0x20069248, 0xcf411800, 0x28c18249, 0x01142115, 0x014001dc, 0x07c274dd, 0x5f85ac20, 0x41059f4d, 0x6d844ca7, 0xfe236f88, 0x41e4fc23, 0x01200aa8, 
-    0x7b053b55, 0xa7410dfb, 0x0c274743, 0xfcdd0123, 0x09a841e3, 0xa7417389, 0x4163843e, 0xa8410947, 0x06534307, 0x250d5b7c, 0x00040003, 0x41180403, 
-    0x02210987, 0x115b7c02, 0x73050023, 0x24279200, 0x401b4c02, 0x05ad4822, 0x22830520, 0x00030124, 0x28895501, 0x76081046, 0x01200cae, 0x33219c83, 
-    0x06154d11, 0x02d4fd22, 0x26058172, 0x011402a0, 0x4d150458, 0x8f460619, 0x41ab8d08, 0x05200a7f, 0xab93b383, 0x4905e47c, 0x3c6e0572, 0x43002006, 
-    0xab820650, 0x72020324, 0x22830500, 0x18105543, 0x18085e5a, 0x46122c45, 0x4518094d, 0x074b0b2c, 0xe504210d, 0x4518ab84, 0x948269c7, 0x85463320, 
-    0x0e464109, 0x204b9ba5, 0x63461806, 0x1821841a, 0x211a6346, 0x234b045a, 0x0c257d06, 0x4105254b, 0xd04308e2, 0x64461805, 0x0b8b420d, 0x21693341, 
-    0x9d452135, 0x08324b05, 0x4305054f, 0x95210582, 0x07c34bac, 0x4b70cb41, 0xf147053d, 0x052f4107, 0x4f06f547, 0xa37b0b9f, 0x000d2208, 0x05eb4c7c, 
-    0x6e431c20, 0x01052309, 0xf34c0600, 0x06062508, 0x1b4c0640, 0x2405eb45, 0x0006001c, 0x0ac04306, 0x0224288a, 0x23401b4c, 0x8405c143, 0x10c14323, 
-    0x2c825a20, 0x4e000126, 0x0a405959, 0x2705cf57, 0x1b080710, 0x1121012b, 0x15230184, 0x49231521, 0xb2870504, 0xc7435020, 0xfb562209, 0x6b7618ec, 
-    0x81072509, 0x83000d00, 0x1f2eb385, 0x00020400, 0x02005504, 0x02000100, 0x61826101, 0x59030028, 0x3f030300, 0xb68b004b, 0xb6851f20, 0x03202b96, 
-    0x2420b982, 0x03242185, 0x55030004, 0x0022538d, 0xef180404, 0xba8e0882, 0x42352321, 0xd443069d, 0x4c502005, 0x9a5105b0, 0x56142405, 0x4f6b04ac, 
-    0xcf4d0866, 0xe5042105, 0x7d20bb84, 0x1c30bb85, 0x05000400, 0x61050400, 0x00010103, 0x00010600, 0x4106d74d, 0x2893126f, 0xb5840220, 0x02010223, 
-    0x82ba8472, 0x00042244, 0x88bb8201, 0x0a334553, 0x23107041, 0x15331133, 0x2308154a, 0x50a02c02, 0x2309a649, 0xebfb1504, 0x8b0c534b, 0x181f20b3, 
-    0x2f086347, 0x05020605, 0x03030055, 0x01044b3f, 0x59060202, 0x200c6f41, 0x82268d1c, 0x06002421, 0x185d0602, 0x2507e142, 0x02030021, 0x23877203, 
-    0x4d831d83, 0x48876120, 0x4d060222, 0x22102442, 0x82352135, 0x098149b3, 0x52dc0121, 0x02230776, 0x5056ac6a, 0x0b4409d0, 0x58a3441c, 0x05429785, 
-    0x05cb4f05, 0x21060442, 0x9a895801, 0x200a0342, 0xa34b180b, 0x08db456a, 0xda4f2120, 0x06a74406, 0x45052347, 0xcf4707dc, 0x08ce5389, 0x23074d43, 
-    0xc0fe23fe, 0x940cd147, 0x74cf47ab, 0xd252ab82, 0x20ab8c05, 0x0af9436a, 0x431c8f42, 0x334706f0, 0x4721841a, 0x4d181a33, 0x8f421697, 0x01212208, 
-    0x419a8cc8, 0x02200cf4, 0x260c835d, 0x021a401d, 0x18010001, 0x7d0865e3, 0x11260571, 0x04101111, 0x405f1808, 0x013c2608, 0x0210fef0, 0x25058369, 
-    0xacac1603, 0x008200ac, 0x675d4783, 0x5f479f09, 0x478b0530, 0x29064d5d, 0x18020200, 0xb802c0fe, 0x4218c106, 0x0124277f, 0x11231133, 0x2908f55c, 
-    0xabfcc106, 0xacfca8fe, 0xf4820200, 0x0803c022, 0xc74147aa, 0x07995c08, 0x6f584b88, 0x16032306, 0x50180c00, 0x63200fb7, 0x12b75018, 0x0c695618, 
-    0x24211222, 0x0c40e918, 0x23111539, 0x552a1802, 0x79015580, 0xa0b487fe, 0x99527001, 0xfaac4675, 0x540090fc, 0x678d08ff, 0x8b05ef5b, 0x904b1867, 
-    0x61561807, 0x2121210d, 0x23266785, 0x32213521, 0x6784021e, 0x88feb428, 0x7f547801, 0x67822b56, 0x45acfa25, 0x87549974, 0x6a022567, 0x8107b802, 
-    0x5118cf82, 0x0025082f, 0x02000200, 0x7f50185f, 0x21ce8312, 0x1d835b02, 0xb5594f25, 0x83201225, 0x03210866, 0x11353221, 0x0e141133, 0x14212302, 
-    0xa0b47801, 0x547f562b, 0x160388fe, 0xfc7103fa, 0x7499548f, 0x22ce8245, 0x18020100, 0x22079751, 0x483f000d, 0x0e24053b, 0x01030200, 0x68884b82, 
-    0x56181620, 0x592d1591, 0x00010d40, 0x0607090b, 0x0c010d00, 0xd75c1804, 0x25728307, 0x21152133, 0xd4846c03, 0x7901b426, 0x6a0287fe, 0x7683d783, 
-    0x82acfa21, 0xff012e74, 0x0514fea7, 0x006d072a, 0x40130003, 0x21118210, 0xd4824b3f, 0x4c014038, 0x08021011, 0x33012b16, 0x78042301, 0xb22ffbb2, 
-    0xa7f66d07, 0x2f9f0000, 0x2f820320, 0x04b25923, 0x8a2e86d1, 0x000b3a2f, 0x091c401f, 0x02030306, 0x014a0100, 0x3f000001, 0x0201034b, 0x4c024002, 
-    0xdb571b12, 0x10210813, 0x02b297fd, 0xb210020f, 0x680298fd, 0xfdf0fdb2, 0xc002b2f1, 0x00fcad04, 0x53fb0004, 0x000454fb, 0x20ab82fc, 0x245f8200, 
-    0x026a02ec, 0x634f1868, 0x7c022322, 0x4f1884fd, 0x02250863, 0x07b802c0, 0x7ff38281, 0x3f200f57, 0x1d9f5418, 0x23063843, 0x3ffb8107, 0x02257b82, 
-    0x046a0268, 0x237b9de5, 0x21152101, 0x7d222782, 0x7c8483fd, 0x18020126, 0xb80200fe, 0x335b7b18, 0x02237b86, 0x8540fbc0, 0x821320f7, 0x826c20f7, 
-    0x401e22c3, 0x0a446c1b, 0x0101023c, 0x004d0100, 0x00030000, 0x08031103, 0x11032b15, 0x02141105, 0x0114027c, 0xc75d0158, 0x03c02208, 0x60ffb308, 
-    0x0141088e, 0x05034105, 0xe5041422, 0x201de364, 0x41368201, 0x6c200603, 0x01208182, 0x4105e364, 0x7f883303, 0x50050541, 0x7f82089b, 0x22000725, 
-    0x54001f40, 0x924516a0, 0x21012107, 0x29057e4a, 0x70fd7c02, 0x69029002, 0xf15297fd, 0x0a776505, 0x49180720, 0x1120071b, 0x2008055c, 0xe97b1803, 
-    0x2c531809, 0x08ff5b0b, 0x112c5318, 0x00213082, 0xa9521803, 0x5833200e, 0x502d052a, 0xc0fe50a0, 0xc104c002, 0x40fb3ffb, 0x09236600, 0xd018bf85, 
-    0x52461704, 0x3d481806, 0x27bc8508, 0x6c0370fd, 0x0056ac56, 0x220b3766, 0x4b550007, 0x1121052b, 0x0a595d02, 0x0b355118, 0x03001125, 0x89730300, 
-    0x4c00221d, 0x4e54181b, 0x6b531818, 0x057a7c0a, 0x18022327, 0x50400150, 0x82c188a0, 0x1202237b, 0x51191dfe, 0x2f822b8f, 0xbe02a224, 0xb3469805, 
-    0xac122130, 0x31080082, 0x0afd9805, 0x0afdf6fe, 0x1b000200, 0x9a04c1fe, 0x49007305, 0xb7005f00, 0x5018b04b, 0x2a124058, 0x15040801, 0x43070201, 
-    0x44020601, 0x04060001, 0x148c1b4a, 0x14850320, 0x2e855920, 0x002b2608, 0x04050001, 0x00630501, 0x07080004, 0x0a630804, 0x01030701, 0x02070602, 
-    0x00060063, 0x00570600, 0x5b000606, 0x2c478209, 0x401b4f00, 0x07020032, 0x03020703, 0x24359270, 0x07060300, 0x08349103, 0x1d40593a, 0x00014a4b, 
-    0x5f4a5557, 0x3c3e5f4b, 0x24263032, 0x1314181a, 0x49000b0d, 0x080b4901, 0x22012b14, 0x02262724, 0x37123435, 0x32332436, 0x011e1716, 0x35231115, 
-    0x23060706, 0x0e126518, 0x18171621, 0x24093665, 0x14150206, 0x0f5e1812, 0x17372808, 0x0e07010e, 0x18320301, 0x200a8ace, 0x08108222, 0x1614154c, 
-    0x1c031617, 0x6bdffea4, 0x5e5d6c65, 0x8f000160, 0x3c3cab72, 0x41259040, 0x89505241, 0x34393033, 0x49893735, 0x4322492a, 0x2a2a2d24, 0xc370507b, 
-    0x544b4749, 0x89df4e50, 0x1b1b361d, 0x22301d37, 0x3a1f1e3c, 0x2058341f, 0x02821f20, 0x35589208, 0x21204169, 0xfe412021, 0x707672c1, 0xbccc3e01, 
-    0x76733a01, 0x40404471, 0xfefc6fb7, 0x22233e6f, 0x9e363a3e, 0x3d9c5b63, 0x11123a3f, 0x4e3f3d23, 0x302e2d81, 0xfe5d605f, 0xfeaaa1fd, 0x655d5ef5, 
-    0x0f050505, 0x110e870b, 0x02060606, 0x26262843, 0x6b3f3f6a, 0x4d272526, 0x42416726, 0x004d2669, 0x38000200, 0xc504e2ff, 0x4100f005, 0xd0015800, 
-    0x5007b04b, 0x19164058, 0x4f010201, 0x03030b1a, 0x29394e02, 0x3c030503, 0x04050401, 0xb04b1b4a, 0x201d950a, 0x201d8500, 0x861d950c, 0x9511203b, 
-    0x973b841d, 0x82592072, 0x3d938500, 0x02020021, 0x01005b01, 0x004b4101, 0x59040303, 0x3a040400, 0x0501074b, 0x065b0005, 0x44180001, 0x24200ad5, 
-    0x0024288c, 0x0206045b, 0x2a861e82, 0x00210c85, 0x83ca824c, 0x8354a4ac, 0x2054a7b7, 0xa4e38235, 0x823a2054, 0x08cc5028, 0xc382c682, 0x5f000522, 
-    0xa850ba88, 0x00012605, 0x02010302, 0x231e8263, 0x57050004, 0x8807fa50, 0x000523f4, 0x0084594f, 0x4317403a, 0x42000142, 0x3b584358, 0x2031333a, 
-    0x0013151e, 0x08410141, 0x052b1408, 0x3a08d342, 0x27263736, 0x36343526, 0x32333637, 0x17011e17, 0x27012e15, 0x07222326, 0x83141506, 0x4201200e, 
-    0x2f2b06ca, 0x14153301, 0x07010e07, 0x82272317, 0x010e2305, 0x32823227, 0x1d823720, 0x01370323, 0x202d8306, 0x082e8216, 0x6b2802a2, 0x4e4042b5, 
-    0x8c442323, 0x34181733, 0x41ad6330, 0x26441d42, 0x3e1d401d, 0x38376542, 0x2a320e1d, 0x1426a001, 0x0201090a, 0x1225a401, 0xd5aa2638, 0x3356284e, 
-    0x1918662a, 0x2931172b, 0x0a0b1518, 0xfe040305, 0x2e2c5d54, 0x812f3231, 0x3d3f491e, 0x854367a9, 0x4965743b, 0x4f484544, 0x0c572a73, 0xb70c1205, 
-    0x12081e14, 0x3a4f2d2d, 0x38521e40, 0x4b31d1fd, 0x14305926, 0x27072333, 0x6a3b78a2, 0x226de52d, 0x140f1234, 0x0d06069b, 0x070e0d16, 0x03020507, 
-    0x4f4b4402, 0x7e485e52, 0x00352f32, 0x012f0082, 0x3bff6a00, 0xd5050604, 0x42001000, 0x780100b5, 0x3a230509, 0x18405850, 0x200e8e62, 0x8e621839, 
-    0x00593c14, 0x4d020002, 0x1111b659, 0x08042811, 0x26012b18, 0x35012e27, 0x33363734, 0x83231121, 0x02200801, 0x3977d62d, 0xd683833d, 0xbf8dc001, 
-    0x1089028d, 0x608f3670, 0xf97474bf, 0xf91f0666, 0x030000e1, 0x20088382, 0x05d1047d, 0x0029004e, 0x00810050, 0x630f408f, 0x7b050601, 0x06070264, 
-    0x0704017c, 0xb04b4a03, 0x208d823e, 0x006a1825, 0xd1681808, 0x06062c11, 0x05005b05, 0x4c063c05, 0x882c401b, 0x00052727, 0x06050706, 0x2f8a0063, 
-    0x11d06818, 0x521f2208, 0x012a2b51, 0x6a747600, 0x515c5e68, 0x3e815281, 0x2b502a3c, 0x00151750, 0x0b290129, 0x252b1408, 0x82d18322, 0x22d785d4, 
-    0x8237013e, 0x061e4202, 0x17011e23, 0x05084216, 0x07010e25, 0x83322706, 0x231d831a, 0x27263435, 0x23230184, 0x83060722, 0x14152301, 0x2c821716, 
-    0x65180284, 0x172111f6, 0x20628315, 0x7a731823, 0x3233220a, 0x204b8336, 0x08568215, 0x02010e77, 0x36724268, 0x2c2d6636, 0x17171744, 0x2d44172e, 
-    0x6d39632b, 0x396e7e7e, 0x43312a64, 0x162d2e14, 0x662a2d45, 0x687e6c39, 0x23552f5b, 0x25133d22, 0x4b261313, 0x6c5a5b4a, 0x4a5c596b, 0x1327254c, 
-    0x1d3c1814, 0x2d305126, 0x8f5c4b61, 0x35353232, 0x5a903233, 0x1c1d3a1e, 0x363b1e33, 0x3919391c, 0x24202360, 0x63232323, 0x19321f44, 0x1a183419, 
-    0x391d1d36, 0x2c6b827d, 0x652c2d44, 0x42723637, 0x65366c80, 0x087d822e, 0x172d2d61, 0x67322b45, 0x807f6c30, 0x2d68346a, 0x2e18462a, 0x3a142666, 
-    0x2e582223, 0x62366a59, 0x4a4b5c2e, 0x26252526, 0x5d5b4c4a, 0x2f5f3668, 0x261d5139, 0x13131438, 0x3030348e, 0x8c55568a, 0x06343032, 0x0d100505, 
-    0x070d1d6c, 0x23262306, 0x673f4269, 0x07242323, 0x0d130606, 0x05120b68, 0x82000605, 0x42042000, 0x43080c0f, 0x007a006e, 0x015bb5d1, 0x4a010806, 
-    0x5005b04b, 0x072d4058, 0x02060501, 0x00680509, 0x04030001, 0x0c630301, 0x06000801, 0x63060805, 0x0a02010b, 0x00020001, 0x0909005f, 0x04005b04, 
-    0x4c093c04, 0x2eb04b1b, 0x2e203482, 0x06233484, 0xa5700205, 0x35402135, 0x00263090, 0x08090004, 0x6e8c0904, 0x02000023, 0x20758257, 0x9d8b1902, 
-    0x40593608, 0x2b6f7023, 0x7900012a, 0x707a6f77, 0x6c6d6e7a, 0x5364656a, 0x0b534251, 0x53420d20, 0x03220853, 0x16173233, 0x07061415, 0x011e0706, 
-    0x1f031e17, 0x2e272301, 0x2b262701, 0x13231101, 0x35363732, 0x0c832634, 0x4a421520, 0xc9230849, 0x484794ee, 0x502c1616, 0x060e180a, 0x07121212, 
-    0x186b8f72, 0x2f1d0e29, 0x59e88237, 0x14112526, 0x42665926, 0x52084a43, 0x32316903, 0x173a2662, 0x14020e2f, 0x1a160810, 0xaeba0b1a, 0x150a3427, 
-    0x7a01d8fe, 0x1d3e1b1b, 0xe81a0e2f, 0x00020000, 0x043dffc7, 0x00f0050c, 0x006a0053, 0x2f12405d, 0x5d020301, 0x071f304a, 0x06030105, 0x03010001, 
-    0x3ab04b4a, 0x13405850, 0x82040100, 0x5f002f0e, 0x02030300, 0x0202005b, 0x1b4c0341, 0x40821940, 0x02010326, 0x01006303, 0x08abcc18, 0x4f2f2684, 
-    0x010f4059, 0x2a333500, 0x000a0c28, 0x18530153, 0x3708837b, 0x16352701, 0x32331617, 0x35013e37, 0x2f022e34, 0x27012e01, 0x37343526, 0x18084746, 
-    0x2407376e, 0x27261517, 0x08e14326, 0x1e011f2c, 0x011e1703, 0x06071415, 0x08841607, 0x06070624, 0xa7413603, 0x18272006, 0x08095972, 0x53020380, 
-    0x24205027, 0x48592c55, 0x38653d48, 0x361a1c1c, 0x64183954, 0x2f402a88, 0x1d3c5b2e, 0x3431331e, 0x51264b8a, 0x28512320, 0x3d464654, 0x1b194833, 
-    0x296d5f1b, 0x2e41593c, 0x2d212110, 0x1c3e5d2e, 0x33330f0e, 0x1e3e1166, 0x4a20271e, 0x102c20f2, 0x2424110e, 0x654b3613, 0x070608c3, 0x28a40e17, 
-    0x152a1313, 0x371e203b, 0x0e213a37, 0x4c315a3a, 0x47495967, 0x39392b31, 0x266c4243, 0x24882529, 0x13154f08, 0x311b3914, 0x21173e65, 0x13292f38, 
-    0x59365726, 0x35354646, 0x263b1a35, 0x542a7143, 0x2c2e5d02, 0x4a292f2d, 0x1883451d, 0x2c15172b, 0x2245271c, 0x3a302912, 0x02000000, 0x93030000, 
-    0xd5056604, 0x14000700, 0x12b76800, 0x07030a0f, 0x88410100, 0x82242006, 0x00032415, 0x4b700307, 0x052d05f8, 0x01010204, 0x06084b39, 0x01030302, 
-    0x240d8559, 0x401b4c03, 0x83268721, 0x232a8212, 0x61000107, 0x03211d84, 0x2a2b8359, 0x594d0301, 0x12120c40, 0x82111211, 0x10500800, 0x2b1d0809, 
-    0x21352313, 0x23112315, 0x011b3301, 0x11231133, 0x11032303, 0x01a2a223, 0x0172a2b6, 0x7d89aa68, 0x379c72ac, 0x770571a6, 0x1cfe5e5e, 0x00ff4202, 
-    0xbefd0001, 0xd3fee201, 0x1efe2d01, 0x2b010200, 0xa6037503, 0x1c00f005, 0x50003400, 0x18053342, 0x2011084e, 0x8f7f1841, 0x1d1e3422, 0x282a0001, 
-    0x341e341d, 0x1c000b0d, 0x08061c01, 0x4b012b14, 0x1e220e43, 0x49461701, 0x07062105, 0x18054a48, 0x08138b70, 0x3f640270, 0x31282d74, 0x732b2c2f, 
-    0x1e411e43, 0x1814361d, 0x30170923, 0x42772b2c, 0x1d194829, 0x171b1d1a, 0x45282a46, 0x1d1d1b19, 0x03441b1a, 0x282d2d75, 0x74434672, 0x0b312c2d, 
-    0x14270c0d, 0x37163819, 0x2b754241, 0x1e7f312a, 0x23461d19, 0x171b4626, 0x1b191d20, 0x43292748, 0x001b1a1a, 0x48000100, 0x8904a803, 0x0600d505, 
-    0x04b53000, 0xa3410101, 0x020c2108, 0x73290c83, 0x39000000, 0x401b4c00, 0x202b830a, 0x21138272, 0x81196901, 0x02320fef, 0xc801b110, 0xfe91feb2, 
-    0xd505b292, 0x8b01d3fd, 0x578275fe, 0x3bffa224, 0x57822f04, 0xa7000b22, 0x2b05a54a, 0x00050017, 0x02007305, 0x044b3902, 0x0c2e6c19, 0x20053a4b, 
-    0xd1621815, 0x02392311, 0x4f181b4c, 0x3b980772, 0x58503a23, 0x183b9640, 0x18200d63, 0x351a0f63, 0x0192fe10, 0x6e01b16e, 0x03b192fe, 0xa4019998, 
-    0xfb995cfe, 0xd78a00a3, 0xde001322, 0x2126d785, 0x09000900, 0x51180773, 0x392c0bd2, 0x0201064b, 0x05590302, 0x3c030301, 0x0885a018, 0x1cd95118, 
-    0x87043921, 0x834fa4eb, 0x204fa0f5, 0x29521840, 0x97f81829, 0x21252412, 0x62112135, 0x0f74064e, 0x02232606, 0x0192fe10, 0x081a416e, 0xb1240a83, 
-    0x1f029adf, 0x24052041, 0xfe9ae1fd, 0x0523415c, 0x0904e33c, 0x2e007b04, 0x12409600, 0x0504011d, 0x0403011c, 0x02010105, 0x01000104, 0x7b7e4a04, 
-    0x001e3505, 0x01020003, 0x00610203, 0x5b050404, 0x30050500, 0x0101004b, 0x2305b24c, 0x1b4c002e, 0x9b057f43, 0x82292025, 0x1c402925, 0x04000500, 
-    0x63040503, 0x44874e88, 0xd6821e82, 0x01132208, 0x17242600, 0x0f101115, 0x00080a0e, 0x072e012e, 0x052b1407, 0x012f2622, 0x011e1735, 0x023e3233, 
-    0x21e48237, 0xa645032e, 0x35072505, 0x3e37033e, 0x63081682, 0x1415021e, 0xc201020e, 0x4f2f6e34, 0x3368264a, 0x39639262, 0x025bfd0a, 0x633909a5, 
-    0x68365e8f, 0x13280f2b, 0x1211140d, 0x3166390b, 0x5097d988, 0x1dd89751, 0xa7120b0b, 0x310d0d19, 0x9055865c, 0x325d8554, 0x0c040b0f, 0x0604a307, 
-    0x0b020404, 0xd998500b, 0x98db8a8a, 0x01000050, 0xee040afd, 0x6606e9fe, 0x1722b182, 0x58431440, 0x53002009, 0x09220928, 0x26823301, 0xc619012a, 
-    0xee04bbfe, 0x88fe7801, 0x01331b82, 0x63fe30fd, 0x2ffffdfd, 0x35000300, 0x504eb04b, 0x830c4058, 0x02592a16, 0x3e010101, 0x401b4c01, 0x107b5311, 
-    0x0a405922, 0x012a558a, 0xfd153335, 0x63fecd30, 0x1582cccc, 0x46fc0122, 0x25208782, 0x11228784, 0x87840e40, 0x01010023, 0x096d5569, 0xc646fc27, 
-    0x069a1901, 0x2c7e8466, 0xc9fc0100, 0x67fef204, 0x1600c606, 0x2e7a8200, 0x00020115, 0x03090c14, 0x4a020201, 0x8208b04b, 0x0018218d, 0x01280b82, 
-    0x00010367, 0x57000202, 0x002a0682, 0x02005b02, 0x1b4f0200, 0x1a821740, 0x91730121, 0x594b0819, 0x00010d40, 0x0a0b1113, 0x16011600, 0x2b140804, 
-    0x16173201, 0x020e1415, 0x35231507, 0x35363736, 0x07222334, 0x79fd3635, 0x150108e5, 0x941a2f24, 0x78163143, 0x06554258, 0x0703aac6, 0x2b333a20, 
-    0x166c5810, 0x5e361330, 0x82188320, 0x2da382d2, 0xfe1d054e, 0x003706e1, 0x4b45001b, 0x95821eb0, 0x03001428, 0x03010105, 0x1f826001, 0x045b0222, 
-    0x3b25a282, 0x401b4c00, 0x2709821a, 0x02030000, 0x03006300, 0x57251e82, 0x01030300, 0x2d28845c, 0x09405950, 0x22241322, 0x08062213, 0x0a4e2b1a, 
-    0x072c0806, 0x33013e23, 0x011f1632, 0x37323316, 0x0e333736, 0x26222301, 0x283993fd, 0x1312261c, 0x66017c01, 0x2540275b, 0x271b2839, 0x7d021112, 
-    0x052a0d84, 0x2527375a, 0x93874f27, 0x0882211c, 0x82522421, 0x00002808, 0x04db0101, 0x41ba03ee, 0x4a660873, 0x41002005, 0x232c0773, 0x75023301, 
-    0xc619019a, 0x7801ee04, 0x2f82af82, 0x29052f2a, 0x4806a203, 0x3b001200, 0x1120cf85, 0x0027ae82, 0x02007201, 0x825b0002, 0x08a04d22, 0x14831383, 
-    0x0c2f7018, 0x13231328, 0x18080423, 0xb048012b, 0x08b88205, 0x06070626, 0x26272223, 0xa6013327, 0x582f310a, 0x0d312f56, 0x504f0b77, 0x4f4f9090, 
-    0x4806770b, 0x2525264b, 0x488f4b26, 0x8f200082, 0x01225d82, 0xaf822901, 0xaf82a820, 0x1f000626, 0x01011c40, 0x4a21b082, 0x267a8203, 0x00720001, 
-    0x82690101, 0x00063d22, 0x04121106, 0x012b1608, 0x03333717, 0xb4010323, 0xf68bb5b4, 0x6606f693, 0x88fef5f5, 0x0126c682, 0x75fe8b01, 0x2a822903, 
-    0x5e001f29, 0x01100a40, 0x820f0201, 0x4a022146, 0x2205f845, 0x82020011, 0x00662111, 0x5c205a82, 0x3e2a2382, 0x4b1b4c00, 0x585021b0, 0x18821040, 
-    0x65830220, 0x17870020, 0x86154021, 0x07a84912, 0x012d1882, 0x59595000, 0x2a3817b5, 0x2b170803, 0x07574921, 0x84010e21, 0x1e352be4, 0x011e1701, 
-    0x36373233, 0xf3833435, 0xbc023508, 0x0f0b1c37, 0x581d1e1e, 0x2e2b2c3e, 0x1324112a, 0x40112b13, 0x17161e1e, 0x363d762b, 0x281e3317, 0x17161744, 
-    0x830c0606, 0x04040d08, 0x2c181803, 0x3e2b2b20, 0x240e0741, 0x02164019, 0x2d888201, 0x0002004a, 0x01017202, 0x11690000, 0x7e831012, 0x27230134, 
-    0x33132307, 0xb58ba803, 0x93f68bb4, 0xf5f5ee04, 0x29827801, 0x46053f30, 0x10069103, 0x17000b00, 0x22402500, 0x34820103, 0x02055b29, 0x00000304, 
-    0x184c013b, 0x2c13f755, 0x011d3201, 0x22012b14, 0x3334013d, 0x2f0b8a21, 0x1e1eec01, 0x021e1e8f, 0x8e1e1e16, 0x10061e1e, 0x08820583, 0xa6820284, 
-    0x02010027, 0x02440502, 0x256b82cf, 0x401a000c, 0x68830017, 0x6683ac82, 0x07000129, 0x010c0004, 0x8208030a, 0x26528958, 0xb102013b, 0x82911e1e, 
-    0x244d8202, 0x901e1e90, 0x2547841e, 0xee041701, 0xa344f602, 0x5c022620, 0x01c6bbfe, 0x08a34419, 0x58010226, 0x1704ee04, 0x07243784, 0x1a401d00, 
-    0x820cb76e, 0x00012289, 0x0800574d, 0x33132323, 0x28038213, 0xbf89e101, 0xcc875eaa, 0x214585b3, 0x80827801, 0x3d01012c, 0x93036205, 0x0300f605, 
-    0x67475500, 0xab441805, 0x003b2908, 0xb04b1b4c, 0x40585008, 0x39201288, 0x8c083442, 0x10402225, 0x946a1800, 0x82002009, 0x594d220b, 0xd3441859, 
-    0x21013407, 0x93032135, 0x5602aafd, 0x00946205, 0xfea40101, 0x82190375, 0x001d2a79, 0x0d0a405e, 0x0e020001, 0x42048201, 0x002309a3, 0x82660200, 
-    0x5c01211e, 0x3e212b82, 0x0aa34201, 0x72020022, 0x4023178b, 0x84020015, 0x203e8212, 0x32188657, 0x59500100, 0x2918b559, 0x17080327, 0x0706212b, 
-    0x4c141506, 0x3723063f, 0x42070615, 0x4a0805ab, 0x3e373435, 0x02333701, 0x16152d87, 0x22351c1c, 0x101e101d, 0x20112226, 0x3a387b0f, 0x1c280d1b, 
-    0x2b2b3e77, 0x17162f20, 0x080b0407, 0x02040b85, 0x5e2b2b03, 0x3a1a352f, 0x0102001f, 0x03e10456, 0x0006077b, 0x001f000f, 0x821f4022, 0x180220e8, 
-    0x270e8887, 0x00030000, 0x2626264f, 0x20050c44, 0x05034414, 0x36267282, 0x16173233, 0xee523407, 0x16230808, 0x36373233, 0x504f7b03, 0x50507274, 
-    0x75734f50, 0x2c7b4f4f, 0x2b3f412c, 0x3f2c2c2c, 0x052c2c40, 0x824f74f4, 0x73732c18, 0x4f4f4f50, 0x2c2c3f74, 0x82402c2b, 0x2c2c2116, 0x0129e983, 
-    0x031d051f, 0x003706b2, 0x3c7b4524, 0x2713232b, 0x06231323, 0x012b1a08, 0x21988526, 0x9b532307, 0x1f162105, 0x3e10c744, 0x2b02012f, 0x0e110f16, 
-    0x01131226, 0x3332027c, 0x1e21265b, 0x10163927, 0x12270d10, 0x887d0211, 0x91053411, 0x25090915, 0x49874f27, 0x220d0e4a, 0x0a091437, 0x86522425, 
-    0x28bb840c, 0x02ef03e0, 0x001406f2, 0x97751815, 0x54152007, 0x3b210771, 0x2d20824b, 0x03005b03, 0x4c003c03, 0x0012401b, 0x02820003, 0x08089054, 
-    0x4c023b3f, 0x1118b659, 0x08041018, 0x22012b18, 0x3435022e, 0x1533023e, 0x15020e22, 0x33021e14, 0x643af202, 0x4a2a2a4a, 0x37203a64, 0x29181829, 
-    0xef032037, 0x39654a2b, 0x2b4a6439, 0x3828187b, 0x3516831f, 0x25000200, 0xac040000, 0x0700d505, 0x72000a00, 0x040109b5, 0x28490100, 0x05152106, 
-    0x02240c82, 0x62020401, 0x39278782, 0x0101034b, 0x49013a01, 0x1526071f, 0x02010103, 0x228c7301, 0x1d20a583, 0x00214e82, 0x231c8872, 0x55040202, 
-    0x04362382, 0x02005a02, 0x594e0204, 0x080d4059, 0x080a0808, 0x1111110a, 0xb8830610, 0x01332608, 0x03210323, 0x010b0123, 0x01f5ee01, 0xfd6ed1c9, 
-    0x03d16cf5, 0x05d5d518, 0x012bfad5, 0x027bfe85, 0xfdfc0227, 0x2e828204, 0x053f0102, 0x0591030e, 0x000b00d9, 0x49470017, 0x0f2005a7, 0x200bd444, 
-    0x2a9e8239, 0x02051740, 0x01000304, 0x84570001, 0x01002208, 0x2222825b, 0x184f0100, 0x4416e95a, 0x052425f1, 0x1e8f1ed9, 0x00200288, 0x26064f47, 
-    0x00f6055a, 0x444e0003, 0x01220827, 0x19827300, 0x85823b20, 0x85082744, 0x43392012, 0x0b2008b8, 0x25883b82, 0x00094026, 0x72010001, 0x6920db82, 
-    0x2c0a2044, 0x02331323, 0xbac59a75, 0x0801ee04, 0x22008200, 0x821f0101, 0x05b226f7, 0x002a00e9, 0x48f58545, 0x4125115b, 0x401b4c00, 0x2b8d821a, 
-    0x04570301, 0x00000201, 0x63000201, 0x2a0d5b48, 0x132a2323, 0x08062423, 0x56012b1a, 0x1d2b0768, 0x37342301, 0x16323336, 0x42011e17, 0x3d2208e3, 
-    0xac473301, 0x2e480805, 0x02012f01, 0x08130d2b, 0x13240a12, 0x33347d14, 0x10211255, 0x3919270f, 0x10101315, 0x7d14141f, 0x54333401, 0x290f2020, 
-    0x5a05391a, 0x05030a07, 0x062c1a19, 0x043b3a66, 0x0e110404, 0x06060d1e, 0x06281a1a, 0x083c3b64, 0x21200e82, 0x01279182, 0x02ee0479, 0x82f605f6, 
-    0x415820a5, 0xec4d0533, 0x095c4509, 0x5d451389, 0x20138909, 0x0f144e3b, 0x6a4a5920, 0x33032e0e, 0xe35c0213, 0xee04c5b8, 0xf8fe0801, 0x2d008200, 
-    0x04370101, 0x059a03ee, 0x000600f8, 0x4247b530, 0xb04b3505, 0x40585025, 0x0001010c, 0x00730002, 0x023b0202, 0x0a401b4c, 0x58470c82, 0xb5592106, 
-    0x2e0e5a47, 0xa5a68c9a, 0x04bdd38c, 0x01b2b2ee, 0x8b00000a, 0xb5382253, 0x21478201, 0x53854a01, 0x01000d2a, 0x03730100, 0x00000202, 0x0b20ab84, 
-    0x220ab548, 0x480b4059, 0xc32213b8, 0x5a82a6a5, 0xf805d326, 0xf6feb2b2, 0x5f825d83, 0x1b003708, 0x5a04f801, 0x03006a03, 0x02b30600, 0x2b300100, 
-    0x27011701, 0xfb1b3f04, 0x6a0318d9, 0x6cfafe6c, 0x0c010200, 0x8d039c02, 0x0a00df05, 0x79000d00, 0x02080cb6, 0x86830400, 0xda820e20, 0x1e821720, 
-    0x67020129, 0x00020506, 0x82010103, 0x00622340, 0xec4d0404, 0x823a2005, 0x8216201e, 0x7302211e, 0x40261d91, 0x0004001f, 0x1d887204, 0x5520d882, 
-    0x00222583, 0x46825a01, 0x01003e08, 0x4059594e, 0x0b0b0b0e, 0x120d0b0d, 0x10111111, 0x2b190807, 0x23153301, 0x21352315, 0x03330135, 0x19030111, 
-    0xfe8a7474, 0xa26b017d, 0x03eefe8a, 0xbaba6fc5, 0xfd100279, 0xfe9d01e6, 0x2cfb8263, 0x052f0101, 0x05a20306, 0x001200f8, 0x05304138, 0x16820e20, 
-    0x02000223, 0x265f825f, 0x4c013b01, 0x8416401b, 0x00722169, 0x272d544a, 0x5232320c, 0x0f303153, 0x3f06544a, 0x05770a50, 0x1d1d35f8, 0x77381b1c, 
-    0x3e3d3e3d, 0x01000077, 0x0e050202, 0xdb05cf02, 0x37000c00, 0x20054743, 0x08a8480c, 0x79833920, 0xc9641220, 0x82572005, 0x01002a06, 0x0001005b, 
-    0x40594f01, 0x20c0480b, 0x1edb0524, 0x02821e91, 0x013ac883, 0x04f5fe17, 0x00f70659, 0x00240003, 0x12214024, 0x03000101, 0x01030202, 0x81824a02, 
-    0x0272002e, 0x01030101, 0x03030072, 0x1f121f69, 0x3b05ba45, 0x11071133, 0x013e3734, 0x013e013f, 0x11353637, 0x23010923, 0x07061411, 0x010f010e, 
-    0x08059c53, 0x01231149, 0x46f5f517, 0x882e4e19, 0x220f3a28, 0x010401b9, 0x1a15b901, 0x442e4817, 0x1111352a, 0xf706f513, 0xfe9e17fc, 0x2364a02f, 
-    0x1a571d48, 0x74451f42, 0x2f012401, 0xabfed1fe, 0x2f338151, 0x1d2e1f4a, 0x50202030, 0x8256fe3e, 0x020027a2, 0xf5fe0b01, 0xa382e603, 0x1100052c, 
-    0x3b403e00, 0x0302080e, 0x9f850105, 0x0701002f, 0x01050201, 0x01066202, 0x05030305, 0x08068255, 0x59030553, 0x05030104, 0x00004d03, 0x0c0d1011, 
-    0x06070a0b, 0x05000500, 0x08081111, 0x11012b16, 0x15211133, 0x13012313, 0x33112315, 0x33350301, 0x01a80b01, 0xfeb5b380, 0xb3aa14f4, 0xac160e01, 
-    0xd4032303, 0xfb8fbbfc, 0xfe7c02d2, 0xd403d458, 0xd20182fd, 0x268783ac, 0xfe620003, 0x827004f5, 0x00162d87, 0x00370024, 0x35464049, 0x06070225, 
-    0x02218982, 0x39e28209, 0x05630402, 0x00010203, 0x06010706, 0x00070063, 0x00550700, 0x5c000707, 0x0c820108, 0x18502408, 0x37000117, 0x1e2c2e36, 
-    0x1824171d, 0x0c111224, 0x0004050a, 0x0a150116, 0x012b1408, 0x34113522, 0x47341133, 0x1e3805bd, 0x32111501, 0x23141115, 0x07062201, 0x21111506, 
-    0x27263411, 0x3613012e, 0x24094b5e, 0x1415010e, 0x08be8217, 0x9bb2144f, 0x9b66313a, 0x3a31669b, 0xaefeb59b, 0x321a452c, 0x1a1b7a01, 0x561b421a, 
-    0x37181715, 0x18372222, 0x90571817, 0x03b5f5fe, 0x8601c271, 0x6e36925e, 0x5e92366e, 0xfcc27afe, 0x5d07b58f, 0x6f3e2022, 0x86017afe, 0x20205538, 
-    0x2c6ffb22, 0x822f8461, 0x23382532, 0x61fe2b60, 0x2a08f482, 0xfeecff01, 0x075c0418, 0x000200d1, 0x0001b306, 0x032b3001, 0x04140111, 0x0918fe70, 
-    0x0024fbb9, 0xfec20001, 0x06c404be, 0x820500c3, 0x0105211f, 0x09391f82, 0x01092701, 0xfcc40437, 0x57035957, 0x0259a9fc, 0x59fdfbc1, 0xab03aa03, 
-    0x214f8357, 0x4f827500, 0x4f8be520, 0x0111012c, 0x90fbe504, 0x47f6d107, 0x2282dd04, 0x00010027, 0x03befe00, 0x205386ff, 0x2f738302, 0x09170209, 
-    0xfca90301, 0x56a90357, 0x5603aafc, 0x03287382, 0xfc570204, 0x0056fc55, 0x26291348, 0x01034b25, 0x48260101, 0x25201b13, 0x23301348, 0x012b1807, 
-    0x35291348, 0x00a60003, 0x05710400, 0x001200d5, 0x0028001d, 0x0109b591, 0xc1480205, 0x061f3a07, 0x05000201, 0x63050204, 0x00030300, 0x0000005b, 
-    0x01074b25, 0x5b010404, 0x20b78b00, 0x8226881c, 0x0100241c, 0x885f0104, 0x9581182e, 0x00022308, 0x268b6303, 0x04010123, 0x842d8257, 0x043d084a, 
-    0x59594f01, 0x1e1f1540, 0x25271314, 0x281f281e, 0x1d131a1c, 0x202e1d14, 0x2b160708, 0x1e322113, 0x06141502, 0x15031e07, 0x01290414, 0x35363201, 
-    0x2b022e34, 0x32131101, 0x3435023e, 0x08098226, 0xba01a656, 0x3f7ab272, 0x74498383, 0xf8fe2c51, 0x46fef7fe, 0x8590b601, 0x4b69431e, 0x7c58efeb, 
-    0xa99d244e, 0x32d505ef, 0x865d8e62, 0x3f0b149d, 0xc9528765, 0x6f6d03ce, 0x35523a7a, 0xfd3efe18, 0x643f1e39, 0xfd899346, 0x010000dd, 0x0000d700, 
-    0xd5057304, 0x51000500, 0x2005ef52, 0x22eb8210, 0x83005900, 0x020024fb, 0x49022602, 0x7e1807c1, 0x1c8409fb, 0xeb180120, 0x11241cb8, 0x17070310, 
-    0x152ecb82, 0xd7231121, 0x2ffd9c03, 0xaad505cb, 0x6f82d5fa, 0x6f82c520, 0x6f824e20, 0x0c439f19, 0x2105bf76, 0x77870101, 0x05040428, 0x05050059, 
-    0x7c870526, 0xc1761a20, 0x00042508, 0x5d050405, 0x8683a388, 0x21bb4818, 0xeb715920, 0x1a072108, 0x21209585, 0x2c052a54, 0xfd7603c5, 0xfd8e0254, 
-    0xfcbf0272, 0x26a28277, 0xfdaa46fe, 0x8200aae3, 0x826e20a7, 0x826320a7, 0x000926a7, 0x050a4068, 0x23118201, 0x02020301, 0x2007ea4a, 0x20228200, 
-    0x2b848259, 0x02004b25, 0x00590302, 0x03260303, 0x1220ab87, 0x0222ab83, 0x23885d03, 0x1b4c0024, 0x40821840, 0x01020024, 0xe1186100, 0x59310f2c, 
-    0x1211b659, 0x07041111, 0x01372b18, 0x15213521, 0x339a8201, 0xfdf7026e, 0xfcc9031f, 0xfc2203f4, 0x91049a0b, 0x6ffb9aaa, 0x74829582, 0x82890021, 
-    0x82482097, 0x000b2297, 0x05af4165, 0x19001521, 0x230ae907, 0x01054b25, 0x1c888b8b, 0x00261683, 0x00010259, 0xa8822500, 0x821b4021, 0x03012309, 
-    0x3b8b5500, 0x82590321, 0x03002124, 0x0b7d7918, 0x2b1a072a, 0x21113313, 0x23113311, 0x27080582, 0x02cb8923, 0xfdcbcb29, 0xd505cbd7, 0x64029cfd, 
-    0xc7022bfa, 0x030039fd, 0xe3ff7500, 0xf0055c04, 0x26000b00, 0x89002a00, 0x1f289785, 0x05000400, 0x61050402, 0x07c16618, 0x184b2d21, 0x20080d89, 
-    0x09385500, 0x2925269c, 0x401b4c00, 0x24a4821d, 0x03010403, 0x89508763, 0x053a5546, 0x0d172608, 0x2a00010c, 0x1d272829, 0x0d260c1b, 0x00050726, 
-    0x080b010b, 0x052b1407, 0x10110222, 0x12323312, 0x27021011, 0xa3e81932, 0x2e3a0808, 0x06222301, 0x14110607, 0x011e1716, 0x21152103, 0xf7fb6702, 
-    0xf7fdfcf7, 0x6b53fcf8, 0x11191020, 0x19120909, 0x4e6b2310, 0x44226c4f, 0x6b212321, 0xfe8f0177, 0x7d011d71, 0x01828801, 0xfe802308, 0xfe79fe80, 
-    0xa480fe7a, 0x5721444a, 0x5a5a9173, 0x2257728f, 0x48464548, 0xa5bafe8f, 0x484649e6, 0xab41ea02, 0x00c92a06, 0x05060400, 0x000b00d5, 0x05134166, 
-    0x0103172f, 0x59020101, 0x25020200, 0x0001044b, 0x0ee54200, 0x13841420, 0x5d050022, 0x01202689, 0x8205ea7f, 0x02002310, 0x1f826101, 0x00050523, 
-    0x24268455, 0x00050059, 0x0eac4105, 0x11213723, 0x05867b21, 0xc9211535, 0xc7fe3901, 0xc7fe3d03, 0xc3fc3901, 0xaa8104aa, 0x427ffbaa, 0xc9200a43, 
-    0x55289784, 0x08090940, 0x02040205, 0x2108c54d, 0x9782010d, 0x034b2523, 0x0bfb4301, 0x0e830d20, 0x84590021, 0x8202201a, 0x82132091, 0x84d61809, 
-    0x211c8209, 0x89820200, 0x13b63308, 0x04101212, 0x132b1807, 0x33011133, 0x01230109, 0x89231107, 0xed7702cb, 0x5602bbfd, 0x9a19fef4, 0xfdd505cb, 
-    0xfd980268, 0x028dfc9e, 0xb8fda4ec, 0x4f4e0100, 0x00062408, 0x4b04b545, 0x35200617, 0x22063256, 0x46024b25, 0xd64b0c30, 0x4b252009, 0xb52110d6, 
-    0x05734412, 0x01330123, 0x307a8323, 0xc901f5ee, 0xfe8dfed1, 0xd505d18e, 0x23052bfa, 0x06db46fa, 0x00005724, 0xfb827a04, 0x6c000c28, 0x02070ab7, 
-    0xf9880303, 0x03001528, 0x03000200, 0xe6847002, 0x41044b21, 0x1c880c01, 0x09411683, 0x8a1b200a, 0x02032334, 0x3b835500, 0x82590221, 0x00310824, 
-    0x59594d02, 0x111212b7, 0x07051012, 0x21132b19, 0x11210109, 0x23011123, 0x57231101, 0x02010e01, 0x0f010401, 0x99f6febb, 0x05baf5fe, 0x0208fdd5, 
-    0x2ba582f8, 0x03edfc27, 0x00d9fa13, 0x8b000100, 0x462aa782, 0x0900d505, 0x07b65200, 0xa0410202, 0x228d8345, 0x82180704, 0x1101248d, 0x82211133, 
-    0x018b378a, 0xc3f80100, 0x08fe00ff, 0xfbd505c3, 0xfacd0433, 0xfbcd042b, 0x00820033, 0x6b440320, 0x00032308, 0xaf450007, 0x2113247d, 0x82032115, 
-    0x03892a03, 0xcb41fcbf, 0xd7fd2902, 0x450983cb, 0x00220ab1, 0x87440200, 0x436d200c, 0x7d440671, 0x01052809, 0x5b000202, 0x44000104, 0x6b180a7d, 
-    0x2d21085e, 0x2d1e894b, 0x1b4c0029, 0x01001540, 0x01020300, 0x178c6303, 0x15505920, 0x0b694406, 0x69440620, 0x1f654426, 0x46296044, 0x07220b07, 
-    0xe9855500, 0x82001121, 0x005923de, 0x66490000, 0x0311220f, 0x345d1801, 0x6525200b, 0x55200f29, 0x02213382, 0x05296559, 0x11b65924, 0xc3431111, 
-    0x45212005, 0x032106f3, 0x05f145bf, 0x052bfa25, 0x83d5fa2b, 0xac002d2b, 0x5c040000, 0x0a00d505, 0x76001300, 0x192c7d85, 0x00030105, 0x01030201, 
-    0x04040063, 0x48063a49, 0x19250c3e, 0x02010200, 0x24259173, 0x401b4c04, 0x821b841f, 0x0304245a, 0x82630400, 0x01012323, 0x06825703, 0x01032508, 
-    0x0301005b, 0x59594f01, 0x0b0c0e40, 0x130b1012, 0x2411130c, 0x17070620, 0x3221132b, 0x06141504, 0x2311012b, 0x08c2c519, 0x01ac2508, 0x0101fbb4, 
-    0xcaeafdff, 0x9c8db401, 0x05ea8e9b, 0xdddee1d5, 0x02a8fde1, 0x868693fe, 0x00cffd92, 0x78000100, 0x6d20bb82, 0x0b2bbb82, 0x0f406d00, 0x02020107, 
-    0x824a0101, 0x82002003, 0x85492009, 0x491520ca, 0xdc470c00, 0x48012017, 0x012006ac, 0x1c054119, 0x11b65932, 0x04131112, 0x372b1807, 0x21350109, 
-    0x01092115, 0x783c0482, 0x3afec601, 0xdefcf503, 0x39fec701, 0x0bfc2203, 0x024102aa, 0xfdaaaa40, 0xaabffdc0, 0x2f20a382, 0xa220a382, 0xdb41a382, 
-    0x08796c09, 0x484b2521, 0x976c0c6b, 0x6c25200e, 0x8b822297, 0x24460120, 0x02233505, 0x042bfe04, 0xcb2dfe73, 0xaaaa2b05, 0x0000d5fa, 0x22000100, 
-    0xb93e7b82, 0x3a00e005, 0xb04bc500, 0x4058503c, 0x00011010, 0x0f263101, 0x1b000303, 0x03030401, 0x12841b4a, 0x128b0220, 0x39415920, 0x00192805, 
-    0x00040003, 0x83700403, 0x025b2449, 0x82010101, 0x040423ae, 0x1a490426, 0x88182007, 0x04042220, 0x82248971, 0x206b85b5, 0x821f8b1e, 0x2090823f, 
-    0x22068257, 0x825b0001, 0x4f002609, 0x0024401b, 0x228d8202, 0x8c700002, 0x02012648, 0x00570100, 0x31268701, 0xb7595959, 0x243b291c, 0x1907053b, 
-    0x2e34012b, 0x365d2704, 0x3e352b05, 0x16323301, 0x17031e17, 0x3c5d013e, 0x06780808, 0x23010e07, 0x27022e22, 0x1115050e, 0x11f80123, 0x3c342a1f, 
-    0x2a260d20, 0x2911142d, 0x182c1214, 0x44214d1f, 0x143e556e, 0x146ead3c, 0x49270a1d, 0x0b072138, 0x1a1d3711, 0x041d2931, 0x27344026, 0x02cb0e1b, 
-    0x85853c8a, 0x114c687c, 0x06090d07, 0x06aa0504, 0x0e070705, 0x689b6c41, 0x051ad8cc, 0x432e1802, 0x1934112a, 0x24121d26, 0x561a2234, 0x7c7e7b6b, 
-    0x0076fd37, 0x0482c182, 0x055b0436, 0x002100d5, 0x0034002a, 0x340d4075, 0x1d222a2b, 0x08020c13, 0x6a4acc82, 0x56324806, 0x11111c3b, 0x0706101c, 
-    0x33252b1a, 0x35032e35, 0x37023e34, 0x21352335, 0x1e152315, 0x05d75c03, 0x21153323, 0x06025813, 0x3e331723, 0x069a5a01, 0x70013b08, 0x68925993, 
-    0x92693a3a, 0xf1019358, 0x69925893, 0x93683a3a, 0x0ffe9358, 0x44294d93, 0xcb4d2944, 0x43113c2a, 0xaa4e2943, 0x6d3a0974, 0xa67575a6, 0x76093a6e, 
-    0x0976aaaa, 0x0d836e3a, 0x3a6d2808, 0x04aa7409, 0x44291105, 0x2a449d9e, 0x11200910, 0x439f9e43, 0x00001129, 0x12000100, 0xbe040000, 0x0b00d505, 
-    0x72b75300, 0x594207f6, 0x3b954805, 0x1212122a, 0x18070411, 0x3301092b, 0x27080284, 0x23010923, 0x50fe0602, 0x014801d9, 0x41fed94e, 0xfed9df01, 
-    0xda75fe92, 0xbe021703, 0x3302cdfd, 0xe9fc42fd, 0x7dfd8302, 0x93829282, 0x93827520, 0x93825a20, 0x67002029, 0x111c0940, 0x4104020e, 0x1325099b, 
-    0x01020203, 0x06ca4901, 0xb04c5a20, 0x0410280c, 0x05000001, 0x855e0500, 0x4c012422, 0x8319401b, 0x0100220a, 0x0bc44972, 0x002b3482, 0x59594e05, 
-    0x16110940, 0x41161716, 0x26270791, 0x01192627, 0x82141133, 0x11172612, 0x37361133, 0x080e8336, 0x06071036, 0x15331507, 0x936f0121, 0xcb7b61b1, 
-    0x492d2428, 0x4b2e49cb, 0xb1617bcb, 0xaa0ffe93, 0xbe9720d6, 0x57018901, 0xe2ada9fe, 0x03225746, 0x215bfca5, 0x44019158, 0xfe261183, 0x2097be77, 
-    0xcf82aad6, 0xcf824a20, 0xb4058735, 0x6e003100, 0x02182fb5, 0x4b490100, 0x585020b0, 0x4e001740, 0x252206e7, 0xba82024b, 0x4c590321, 0x35200948, 
-    0x8d191e82, 0x2621123f, 0x28d48203, 0x0001001b, 0x04010004, 0xf7841863, 0x0a484c0b, 0x112b1c24, 0xd6842819, 0x82333721, 0x103522d5, 0x05844337, 
-    0x14111626, 0x07010e07, 0x3521cd82, 0x51128236, 0x61080d5a, 0x011e1716, 0x4a211517, 0x37387af5, 0x7abf4790, 0x9046c07d, 0x3d591d37, 0x7831fef8, 
-    0x2b222143, 0x4e7c2b2e, 0x2c297952, 0x2321222d, 0x31fe3a5e, 0x8f9284ac, 0xb93501be, 0x595e5c5b, 0xbec9feb7, 0x42894b8f, 0xa54cacac, 0x746abe51, 
-    0x453f44bc, 0xb8413c48, 0x51be6a7b, 0xac257755, 0xff030000, 0xc35800c4, 0x00032805, 0x000e000b, 0x4a0db59f, 0x20210a77, 0x2d0c8207, 0x06010006, 
-    0x06010970, 0x06030400, 0xda826204, 0x4b250025, 0x4d020508, 0x27890b59, 0x04221883, 0x2e8d7303, 0x1b4c0024, 0x38822540, 0x72000122, 0x06225082, 
-    0x25897201, 0x06040423, 0x082c8255, 0x5a04062c, 0x04060400, 0x4059594e, 0x040c0c1c, 0x0c000004, 0x040e0c0e, 0x0a0b040b, 0x06070809, 0x00030005, 
-    0x070a1103, 0x01032b15, 0x03830133, 0x21032330, 0x010b0103, 0xc619013c, 0x0139bbfe, 0xfd58f5c9, 0x47022b06, 0x5d04d5d5, 0x88fe7801, 0x0459a3fb, 
-    0xff02220f, 0x22eb821e, 0x82d505d1, 0x000f224d, 0x054c4394, 0x0100262d, 0x01030403, 0x04007004, 0x4d060500, 0x1b4e05a1, 0x004b2a06, 0x59070606, 
-    0x26070700, 0x07b34507, 0x2d902320, 0x07000628, 0x005d0706, 0x34860303, 0xeb820320, 0x25872920, 0x0025f382, 0x03000103, 0x205c8861, 0x5a561806, 
-    0x987d180e, 0x1c07270b, 0x0133132b, 0x8e4f0123, 0x82112006, 0x82372007, 0x029a22dd, 0x0d984f2a, 0x0188fe24, 0x9c4faa78, 0xfe022206, 0x20d382d7, 
-    0x20d386c0, 0x21d38583, 0x6719001e, 0x062d09b9, 0x61060305, 0x00020204, 0x074b2500, 0x0b465001, 0x1e832590, 0x85590021, 0x8205202b, 0x872520c6, 
-    0x26128346, 0x55000501, 0x89000300, 0x5905214e, 0x744d2f82, 0x180b2005, 0x82082b58, 0x830320c2, 0x0a274fc2, 0xc2851020, 0x83092d4f, 0x0a314fbe, 
-    0x02000024, 0xc38221ff, 0xc38d8820, 0x01002028, 0x01030203, 0xac4f7002, 0x01042105, 0x0623c083, 0x41020201, 0x1d200e91, 0x06272787, 0x07000201, 
-    0x8a5d0702, 0x8203202f, 0x872420c4, 0x8241821f, 0x00012a1a, 0x01066103, 0x02070702, 0x224c8755, 0x184d0702, 0x410c4084, 0x3e4e0886, 0x853a2009, 
-    0x0b444ec3, 0xfed50525, 0x4e4dfc88, 0x35080849, 0xff4eff03, 0x059804e3, 0x000b00f0, 0x001f000f, 0x05b04bf1, 0x24405850, 0x04050300, 0x70040305, 
-    0x25020200, 0x0505004b, 0x01005b01, 0x074b2d01, 0x00040401, 0x7e4b065b, 0x82132008, 0x8820202b, 0x2126832b, 0x27930102, 0x53aa3520, 0x2ba43a20, 
-    0x4c00292d, 0x0025401b, 0x01050102, 0x88700502, 0x00012682, 0x05010305, 0x82a78963, 0x82592027, 0x17402f00, 0x00011011, 0x1f101719, 0x0e0f1f11, 
-    0x5f500c0d, 0x33012915, 0x32012301, 0x10113637, 0x08050b5e, 0x17101127, 0xfda40216, 0xfdfcf7f6, 0xc6fcf7f7, 0x9abbfec6, 0x449a5603, 0x9a444343, 
-    0x44444399, 0x7e011d43, 0x87018801, 0x084e5001, 0xf2052a08, 0x2afc88fe, 0x4b018a8d, 0x8d8c4a01, 0xb8fe8e8d, 0x8d8eb9fe, 0x02000000, 0x00002bfe, 
-    0xe005c804, 0x3e003a00, 0xb04b3b01, 0x1095492c, 0x4a030623, 0x0541491b, 0x96491120, 0x02062708, 0x0501104a, 0xae494901, 0x212b820f, 0x44855959, 
-    0x0300212b, 0x03000600, 0x06007006, 0x20028204, 0x226c826e, 0x46055b01, 0x002005d3, 0x2007b749, 0x206d8235, 0x23288f25, 0x4b250505, 0x2009bf49, 
-    0x412c884b, 0x558d0680, 0x71040423, 0x49308d00, 0x2d2808f0, 0x00010500, 0x70000501, 0x3382608f, 0x82010221, 0x49012018, 0x2c220dff, 0x004a0105, 
-    0x82ba8c09, 0x4a002030, 0x592c1107, 0x11110a40, 0x243b291c, 0x1b07073b, 0x242f0b4a, 0x02230133, 0x330f4a07, 0xc63dfd25, 0x4a9abbfe, 0x05243315, 
-    0x0088fed5, 0x02330082, 0x000041ff, 0xb405b404, 0x33000300, 0x31b58b00, 0x4702021d, 0x203907a9, 0x02060100, 0x70020106, 0x00060600, 0x0001035b, 
-    0x044b2500, 0x05020201, 0x09ec445a, 0x58503524, 0x27871e40, 0x06242283, 0x63060001, 0x4021258d, 0x23209324, 0x55020505, 0x022f2788, 0x59594e05, 
-    0x2a1a0b40, 0x11291911, 0x44081011, 0x33200727, 0x2e05324a, 0x021e3233, 0x020e1415, 0x21153307, 0x18033e35, 0x310b4e99, 0x5a211517, 0x9abbfec6, 
-    0x3cf53601, 0x4b1c3958, 0x9519c48a, 0x053b1d10, 0xfc88feb4, 0x93884170, 0xfd9e5ea4, 0xb15f5eb1, 0xa25c9efc, 0xac428995, 0x197a24ac, 0x30121595, 
-    0x00ca0003, 0x07070400, 0x000b003c, 0x01230017, 0x051f5e28, 0x0b252608, 0x00030a02, 0x035b0100, 0x2b010101, 0x0501074b, 0x00590605, 0x4b250606, 
-    0x04040108, 0x09005909, 0x4c092609, 0x05d0651b, 0x01032323, 0x232f8401, 0x63000106, 0x15232a99, 0xa8405850, 0x82352057, 0x2057a62c, 0x202a823a, 
-    0x82828b20, 0x090024a2, 0x895d0904, 0x4c05248a, 0x8b27401b, 0x06002122, 0x04231c82, 0x82610506, 0x0909232b, 0xd5875504, 0x4d090422, 0x30054576, 
-    0x010c0d1f, 0x21222300, 0x1d1e1f20, 0x191a1b1c, 0xa87b1818, 0x070c220b, 0x05aa6514, 0x32013b2b, 0x2314011d, 0x013d2233, 0x200b8634, 0x0a395401, 
-    0x1e5d012e, 0x1e1e8f1e, 0x8e1e1ef9, 0x57fd1e1e, 0x210b0246, 0xd4607106, 0x21088208, 0x0c4639fa, 0x4e032007, 0x8f410537, 0x01522206, 0x058d4499, 
-    0x01281032, 0x3e490504, 0x04070327, 0x07080133, 0x401b4a03, 0x06201283, 0x5920128b, 0x2b05ba41, 0x04070027, 0x08070408, 0x09020a70, 0x2f0ac241, 
-    0x05040400, 0x0501065b, 0x004b2505, 0x08260808, 0x2007bc41, 0x222e8725, 0x84010103, 0x01052331, 0x2c936300, 0x58501523, 0x205baa40, 0xa82e8235, 
-    0x05ed445b, 0x9e82b786, 0x8c957120, 0xb4830420, 0x58823c20, 0xb4872a20, 0xe0822b8f, 0x5720e782, 0x05320682, 0x04005b04, 0x1b4f0405, 0x06003040, 
-    0x06050405, 0x34977004, 0x1c820020, 0x00570523, 0x20328705, 0x2f008459, 0x0c0d1d40, 0x51520001, 0x373a4345, 0x23262a2c, 0x200b0042, 0x1b00420b, 
-    0x422d274f, 0xfe210b22, 0x33244585, 0x210d4a42, 0x424f19fc, 0x02003a33, 0xe7ff4600, 0x79049404, 0x39002400, 0x09402901, 0x0f122029, 0x01060304, 
-    0x058c484a, 0x0600253d, 0x025b0106, 0x30010101, 0x0303004b, 0x07045c00, 0x2e000002, 0x0501084b, 0x855b0005, 0x4c00290c, 0x11b04b1b, 0x1a405850, 
-    0x08222c8a, 0x2e880205, 0x21842920, 0x21821520, 0x29204e95, 0x2c854e8b, 0x2c823520, 0x02002625, 0x844b2802, 0x86002053, 0x5c04257f, 0x26040400, 
-    0x07232e86, 0x85000001, 0x0547422d, 0x04000326, 0x64040300, 0xa985358e, 0x40312b87, 0x01020025, 0x06020106, 0x00010070, 0x06010306, 0x06085163, 
-    0x278c6420, 0x3b050942, 0x01252619, 0x252e3000, 0x1c392639, 0x1117191a, 0x00090b10, 0x09240124, 0x052b1407, 0x0a906a18, 0x33131729, 0x031e1703, 
-    0x5115013b, 0x03250507, 0x3f363227, 0x06335101, 0x010e8c08, 0x021e1415, 0xa265fc01, 0x7c493d72, 0x74445aa3, 0x630e3d5a, 0x0428cda4, 0x1025221a, 
-    0x4f2f6e58, 0x1709283d, 0x47644a36, 0x3d24663f, 0x372b0c2c, 0x5a312140, 0x2a272623, 0x4e195644, 0x9989d694, 0x284791e0, 0x014f784f, 0xdba1fd25, 
-    0x19273218, 0x4e3a229c, 0x3f58362c, 0x6b6a9822, 0x5b41e7b5, 0x39371a39, 0x6861ac3f, 0x0035699e, 0x98000200, 0x630456fe, 0x22002306, 0x9d004300, 
-    0x01110e40, 0x01230504, 0x01200403, 0x41030301, 0x222006d4, 0x28084a6f, 0x5b000606, 0x2f000000, 0x07e5554b, 0x004b2928, 0x022a0202, 0x54441b4c, 
-    0x20299a05, 0x2029872e, 0x87249a40, 0x5921084e, 0x3f104059, 0x3234353d, 0x2227292f, 0x241a1c21, 0x2b150707, 0x023e3413, 0x041e3233, 0x020e1415, 
-    0x06355107, 0x022e2229, 0x13231127, 0x5d33031e, 0x232505ac, 0x35070622, 0x69a01816, 0x9888080a, 0x50987648, 0x56616832, 0x2b152540, 0x69412b41, 
-    0x81492849, 0x452569b2, 0xb92e4e47, 0x5a4814b9, 0x5f343265, 0xc7c12b49, 0x58112215, 0x2f2f5c88, 0x30275647, 0x042b475a, 0x70ad7859, 0x422b1435, 
-    0x3548745b, 0x174c5f6a, 0x836a4b0d, 0x75a05e44, 0x15090142, 0x11fe1a22, 0x3c230003, 0x401e192c, 0x868a4563, 0x03aa0101, 0x3e684926, 0x16355741, 
-    0x4968421f, 0x00010000, 0x0456fe42, 0x0060048f, 0xb73d000e, 0x0300090c, 0x2405f758, 0x4058503a, 0x08c84911, 0x824b2821, 0x032a2e17, 0x0f401b4c, 
-    0x00010102, 0x00010300, 0x08118563, 0x12b65956, 0x04222113, 0x212b1807, 0x012b2601, 0x17323335, 0x01330113, 0x2c022311, 0x5e2dd2fe, 0x41c24631, 
-    0xbf4601ff, 0x03be5bfe, 0xb09e7e44, 0x5d0353fd, 0x56fea0fb, 0x89000200, 0x4804e3ff, 0x2e002106, 0x9f003a00, 0x01180e40, 0x01190102, 0x01090203, 
-    0x4a030305, 0x2f05bb4d, 0x02020021, 0x01005b01, 0x004b2f01, 0x5b030505, 0x30207282, 0x83102e4c, 0x21289ea9, 0xb9820029, 0x03001f28, 0x03040500, 
-    0x54896305, 0x350ed14b, 0x2f301740, 0x34360001, 0x3a303a2f, 0x1b1e282a, 0x2e001315, 0x2f5c2e01, 0x36343907, 0x37013e37, 0x2e27012e, 0x3e343501, 
-    0x16323302, 0x2e15011f, 0x0e010f01, 0x06200382, 0x20062a7b, 0x06515c16, 0x26343524, 0x14832223, 0x69029008, 0x3a41f5eb, 0x0816260e, 0x1c221122, 
-    0x69a5733c, 0x97194e26, 0x20519c42, 0x27214123, 0x12291e1b, 0xeff13738, 0x8f8eecf4, 0x8f8d8e8f, 0x2b011d8f, 0xd8972101, 0x11251146, 0x23111d03, 
-    0x6f442c4a, 0x06062b4e, 0x2018ad24, 0x14010102, 0x2f181c18, 0x08152b20, 0xfe070105, 0xfee3feda, 0x9cd5fedd, 0xd9d7d6da, 0xdad6d7d9, 0x00010000, 
-    0x04eaffa9, 0x007b0428, 0x40c1002f, 0x02011416, 0x03011501, 0x04010a02, 0x05012c03, 0x00012d04, 0x444a0505, 0x1e2705fe, 0x04000300, 0x41040305, 
-    0x3021080c, 0x4d1c824b, 0x7a440585, 0x50072305, 0x259b4058, 0x9b09a85d, 0x214b8325, 0xcf6b1c40, 0x2074850a, 0x06d97f05, 0x3105484d, 0x00011340, 
-    0x2022282a, 0x17191d1f, 0x2f001113, 0xe2722f01, 0x05896a05, 0x6f413720, 0x15172307, 0x5441012e, 0x3b780805, 0x22231501, 0x1415020e, 0x36323316, 
-    0x010e1537, 0xc27db502, 0x49274687, 0x80784167, 0x69a8763f, 0xac69d29e, 0x8f948e48, 0x4b9fa688, 0xb42b5276, 0x4eb463af, 0x3016b461, 0x3b4f7f59, 
-    0x0c2f4860, 0x43608019, 0x30294c6b, 0x55191ba7, 0x90564445, 0x2d49341c, 0x2223695b, 0x001c1cad, 0x00010000, 0x0452fe9a, 0x00140626, 0x4027002c, 
-    0x02010024, 0x184a0100, 0x49010001, 0x59241c83, 0x27010100, 0x35062344, 0x16172b2c, 0x07031415, 0x16012b14, 0x3435023e, 0x052e2726, 0x91733435, 
-    0x15640805, 0x14150004, 0x17051e17, 0x1415011e, 0x0223020e, 0x29331ae2, 0x1e3f3a19, 0x738c8771, 0xd68e4649, 0x03ecfd90, 0xfe96fe66, 0x320a0393, 
-    0x57575243, 0x269a8d27, 0xfe51784e, 0x1f0d02e9, 0x42302231, 0x220c060b, 0x7eac723f, 0xd0e1eb75, 0xc3b9b958, 0x1bc97afe, 0x58845e18, 0x030a1c34, 
-    0x3b7c880b, 0x002d4e68, 0xc32cab82, 0x1b0456fe, 0x13007b04, 0x0bb5b100, 0x2406af52, 0x40585005, 0x052f461a, 0x43000021, 0xb6820637, 0x004b262b, 
-    0x042a0404, 0xb04b1b4c, 0x20218213, 0x27ce8216, 0x01035b02, 0x4b280202, 0x35201d8d, 0x3a203fa0, 0x5c8b2184, 0x85590221, 0x23618570, 0x03001640, 
-    0x032a9d82, 0x02006300, 0x02040100, 0x7a856101, 0x00825920, 0x2313b725, 0x57221311, 0x262e0583, 0x15062223, 0x33112311, 0x33013e17, 0x0a821632, 
-    0x6962033f, 0xb88a8371, 0xa83112a6, 0xb9a8ac73, 0x8e97b602, 0x87fdacb6, 0x61a86004, 0xfbe5e062, 0x447382a0, 0x0529053b, 0x001100dc, 0x0027001c, 
-    0x052d4490, 0x01072022, 0x2005e143, 0x07e14361, 0x4205dd4b, 0xaf4205d5, 0x25279d09, 0x1b4c0029, 0xb1421e40, 0x20528807, 0x08a45008, 0x593b2082, 
-    0x1e1b4059, 0x0112121d, 0x1d222300, 0x12271e27, 0x181c121c, 0x00090b16, 0x47110111, 0x01240644, 0x12343502, 0x7308d283, 0x1512011e, 0x2e130210, 
-    0x0e222303, 0x32010702, 0x2137023e, 0x6802031e, 0x3e7ab275, 0x75b27a3e, 0x3f79b375, 0x250331f6, 0x46466845, 0x03254567, 0x68461a01, 0xfd032446, 
-    0x452403cb, 0xc1631d68, 0xbabb1d01, 0x63c21e01, 0xe2fec263, 0xfe8cfebb, 0x71590379, 0x4c4c88bd, 0xfd71bd88, 0xbd894d45, 0x89bd7070, 0x0100004d, 
-    0xf8ff3601, 0x6004cf03, 0x88001300, 0x20050f41, 0x41148216, 0x03280794, 0x045b0003, 0x26000001, 0x93089776, 0x05f9431d, 0x58503c2d, 0x02001440, 
-    0x02030100, 0x87006101, 0x211b8339, 0x16891940, 0x03000023, 0x351c8757, 0x594f0003, 0x0f405959, 0x0f110001, 0x0708090a, 0x12011300, 0x42180705, 
-    0x2c0808a1, 0x21352311, 0x021e1411, 0x2315013b, 0x825e6003, 0xd2292926, 0x280f8e01, 0x6f593645, 0x312d3308, 0x4302679e, 0x4823fd8f, 0x9c14365d, 
-    0x26008200, 0x00ba0001, 0x82800400, 0x000b21cb, 0x20168760, 0x19876028, 0x87602820, 0xba20082e, 0xe0e301be, 0xfe0147fe, 0x8962fee1, 0xfe6004be, 
-    0xfed1012f, 0x0246fd5a, 0x3ffe8142, 0x44000100, 0x86298b82, 0x0f001406, 0x0db53d00, 0x096e5f01, 0x23051d47, 0x27010100, 0x40228b88, 0x20820311, 
-    0x83730221, 0x835b20c3, 0x003e0819, 0x12b6594c, 0x04232113, 0x012b1807, 0x2b012e27, 0x1e173501, 0x23011701, 0x02230109, 0x64194a2f, 0x8546314c, 
-    0x040220ac, 0xfec6fec3, 0x3204c37e, 0x9e3b43c6, 0x57520402, 0x3c039bfa, 0x4783c4fc, 0x82740021, 0x0442287f, 0x001d0060, 0x8a02b545, 0x010c267f, 
-    0x28000001, 0x0c4b5d4b, 0x02000c25, 0x84730200, 0x4c002218, 0x9bfe181b, 0x1c67080e, 0x0703101e, 0x33132b17, 0x35033e01, 0x2e272634, 0x1e332703, 
-    0x0e141503, 0x74230704, 0x3f2101c6, 0x0b2f516d, 0x1f15080b, 0x21ba1e2c, 0x2a182a3a, 0x61615a45, 0x6004c429, 0x924054fc, 0x18358591, 0x391d2d50, 
-    0x2c25423d, 0x2e6c6e69, 0x8084833d, 0x00266574, 0xfea00001, 0x06380452, 0x003f0014, 0x1429b697, 0x4b050102, 0x23220762, 0xaf820500, 0x70010524, 
-    0x0a650104, 0x4b272606, 0x29010100, 0x26d6824b, 0x06005c06, 0x49062a06, 0x2a96078e, 0x2a8c2e20, 0x25964020, 0x5927508c, 0x3f0f4059, 0x4e27283e, 
-    0x182405e6, 0x16070710, 0x2a0f9b45, 0x3435012e, 0x35233736, 0x70221521, 0x172905e2, 0x15030e15, 0x17041e14, 0x0806821e, 0x23020e31, 0x351ffb02, 
-    0x3f3a1526, 0x938b721c, 0x572e4d78, 0x8b8d4e7c, 0x03d0716b, 0x9eeb9e15, 0xc7813d4e, 0x8bd6938b, 0x5d492d44, 0x52255d61, 0x451f4571, 0x3a0806b4, 
-    0x1d2f2110, 0x0409482e, 0x552e1708, 0x85476081, 0x111b5972, 0x896a7898, 0x26b9b92b, 0x38406647, 0x031b344e, 0x5a3c0baa, 0x4b353d70, 0x0c152033, 
-    0x412c0c05, 0x6b403857, 0x82002c4e, 0x060f4900, 0x007b0426, 0x001b000f, 0x200fa360, 0x0a846030, 0x6009c844, 0x1e8b08a3, 0x2f1ea360, 0x00011011, 
-    0x1b101517, 0x07091b11, 0x0f010f00, 0x2c07a360, 0x33023e34, 0x15021e32, 0x32270210, 0x09bd4836, 0xf4eb6822, 0x2008a444, 0x0aa348ea, 0xdc8f202c, 
-    0x954d4d95, 0xe2fe8fdc, 0x8248d3fe, 0x002d080a, 0xff500001, 0x049e04d9, 0x0021004c, 0x011eb5c0, 0x4a010200, 0x5033b04b, 0x00204058, 0x01020106, 
-    0x05700206, 0x01010203, 0x04005904, 0x05bd4204, 0x55074b21, 0x352008fa, 0x1e202782, 0x00212787, 0x27298304, 0x61010406, 0x26020200, 0x4920258a, 
-    0x00264d8b, 0x02010002, 0x2c896e00, 0x2008114d, 0x85488826, 0x22188322, 0x82040071, 0x8255207b, 0x5901217b, 0x042f5d83, 0x59594d01, 0x01154059, 
-    0x0f151600, 0x590c0d0e, 0x00230562, 0x49210121, 0x570805f6, 0x35012e27, 0x23112111, 0x21352311, 0x14112315, 0x011e1716, 0x3e373233, 0x37013a01, 
-    0x06070615, 0x2e720d04, 0x54fe1717, 0x31048fb4, 0x0c0e0b8d, 0x17121b24, 0x0304090a, 0x26282003, 0x74204227, 0xfcac025d, 0x94b80348, 0x2340fd94, 
-    0x10101133, 0x01010103, 0x06060d85, 0xb431b582, 0x4a0456fe, 0x14007b04, 0x7b002000, 0x030112b5, 0x076d6a04, 0x9e821b20, 0x005b0026, 0x4b300000, 
-    0x2007eb60, 0x08954c01, 0x93056f6e, 0x08e24c22, 0x82194021, 0x0304243b, 0x88630400, 0x0aaf4c3e, 0x15160e2e, 0x20151a1c, 0x28132016, 0x17070624, 
-    0x2a07ad4c, 0x0e141502, 0x26222302, 0x61231127, 0x6a490537, 0x3eb43305, 0x746aa875, 0x3c3a74af, 0x6964a070, 0x01b92d97, 0x008286c9, 0x8989873c, 
-    0xe59e1c02, 0x98514795, 0xdc8c88d8, 0x54565097, 0x2902c9fd, 0xd9d7d7d9, 0x8b4ad6da, 0xfea52405, 0x82070452, 0x002d2adf, 0x170a4083, 0x18010201, 
-    0x05276901, 0x5850072b, 0x03001c40, 0x03000002, 0x07a94768, 0x004b3026, 0x5c040000, 0x20089e48, 0x2023823a, 0x2323831d, 0x70000302, 0x40212495, 
-    0x261f881b, 0x03020001, 0x8a630201, 0x59592742, 0x2c2d0c40, 0xe9822426, 0x05101324, 0x03441507, 0x3233220e, 0x084d4a16, 0x49041e21, 0x200808a1, 
-    0x26341fb8, 0x1b433616, 0x69807b67, 0xca8d4b43, 0x50985880, 0xb35d9245, 0x504028b9, 0x94184750, 0x07ea4393, 0x30202508, 0x0b472c1e, 0x46220b04, 
-    0x8f8cc07d, 0x295099e0, 0x3d3ec12d, 0x8e65d1e1, 0x091c365f, 0x73940a01, 0x2d4d673b, 0x2c05d743, 0x04e3ff77, 0x00600459, 0x00260013, 0x05994772, 
-    0x01041822, 0x2806d84c, 0x01064b28, 0x5b000303, 0x08024305, 0x1f95f983, 0xc3612920, 0x82012005, 0x89ed833c, 0x05914838, 0x14151532, 0x1f200001, 
-    0x26152614, 0x090b0c0d, 0x13011300, 0x290b464b, 0x23152133, 0x0e141116, 0x804e2702, 0x274b0805, 0x2227012e, 0x1415020e, 0x6f4d0216, 0x3b4079ae, 
-    0x0278b478, 0x44cef103, 0x486db57e, 0x5724496c, 0x1e3e1c55, 0x24466744, 0x944c1d8f, 0xd3878ed9, 0xa2b84c90, 0xc072e7fe, 0x3a9c4d8b, 0x7b4e8764, 
-    0x221540b9, 0x9057260a, 0x82d9d86a, 0x000128e8, 0x040000a0, 0x825e0432, 0x07bd44e7, 0x2408ac68, 0x04004b28, 0x48e48504, 0x14280980, 0x01050400, 
-    0x5f000400, 0x01262689, 0x1a401b4c, 0x10820200, 0x8205304a, 0x19572051, 0x21105e10, 0xa4430f11, 0x01132b06, 0x14070612, 0x2e22212b, 0x9e5a3502, 
-    0x17142206, 0x05644816, 0x54825a3b, 0x0398fe28, 0x2292fe92, 0x6f596c24, 0x6a9a632f, 0xb6b61202, 0x2e91e3fd, 0x06634830, 0x5d823320, 0x60046924, 
-    0x6d452600, 0x01012409, 0x4b045902, 0x9441050e, 0x27af8b07, 0x00010503, 0x005f0003, 0xaf842688, 0x00203082, 0x49062a49, 0x28840813, 0x59594f32, 
-    0x00011140, 0x0e101c1d, 0x06070809, 0x26012600, 0x0320af88, 0x08061249, 0x3e323373, 0x013e3702, 0x022e3435, 0x011e3327, 0x040e1415, 0x7d535302, 
-    0xd2012a53, 0x220d8f01, 0x7b552f3c, 0x01062b51, 0x3d240f01, 0x5449ba2e, 0x7757381c, 0x99632f97, 0x8f3b026b, 0x5a3f2bfd, 0x864f1b3b, 0x1e0c60af, 
-    0x6b652d10, 0xf15e3970, 0x8f9b4d8c, 0x00355c7d, 0x00020000, 0x0456fe4c, 0x00680485, 0x00340025, 0x0b0a4085, 0x01060101, 0x02010a4a, 0x05014e48, 
-    0x06001c2e, 0x005b0206, 0x4b280202, 0x01010105, 0x20052f58, 0x09204c2e, 0x58503a23, 0x20239440, 0x21238729, 0x65821a40, 0x02010624, 0x40896306, 
-    0xfa821c87, 0x30321030, 0x24252627, 0x181a2223, 0x07101415, 0x5b521507, 0x15372408, 0x820e0706, 0x021e26eb, 0x36341133, 0x062b5833, 0x23112323, 
-    0x089a4213, 0x22236d08, 0x0d021506, 0x4276a663, 0x4d8b6a3e, 0x26263240, 0x335c462a, 0x8d4a717d, 0x7844446f, 0xb7b760a5, 0x2d495b2e, 0x421f232a, 
-    0x19211a16, 0x90de974e, 0x4783c98e, 0x4c19a30d, 0x6b62973a, 0x0232689d, 0x439698af, 0x9091d58a, 0xfe4c95dc, 0x2f36026e, 0x7075a466, 0x2e2c3295, 
-    0x01004849, 0x56fe5900, 0x60047804, 0x4c001900, 0x0a0d17b7, 0x200af350, 0x0df35017, 0x055c0423, 0x06d04c01, 0x50021521, 0x17880af9, 0x40593908, 
-    0x23211409, 0x06222114, 0x012b1a07, 0x012b2603, 0x16323335, 0x33011317, 0x3b161301, 0x22231501, 0x01032726, 0xb70c0223, 0x46319c2f, 0x8f22a37e, 
-    0xfebf0a01, 0x9e2eb68b, 0xa4350d82, 0xf7fe8e22, 0x015f01bf, 0x569e7ee5, 0x0284fe5a, 0xfef4fc2c, 0x230b831e, 0xd6fd7a01, 0x8320a782, 0x4e20a782, 
-    0x2126a782, 0x11b66100, 0x6062020e, 0x50053505, 0x03134058, 0x01010202, 0x01044b28, 0x4b2e0000, 0x2a050500, 0x8b08116f, 0x8729201a, 0x1340211a, 
-    0x29212983, 0x2136844b, 0x30855905, 0xbc825920, 0x18151125, 0x83101518, 0x220526bc, 0x1135022e, 0x05e34633, 0x08821720, 0x37013e24, 0x1184013e, 
-    0x020e4908, 0x02231123, 0x708d480d, 0x292bb945, 0xb721411b, 0x291d431d, 0x7045b92b, 0x19b7488d, 0x6cb6844b, 0x7ffd8802, 0x1d2c7859, 0xd4030c2d, 
-    0x2c0a2cfc, 0x59782c20, 0x78fd8102, 0x4b84b66c, 0x00006ffe, 0x46000100, 0x8c04e3ff, 0x4527cb82, 0x41b58400, 0x46030201, 0x1c2a07ed, 0x02010300, 
-    0x70020301, 0xd1850105, 0x00020226, 0x0207065c, 0x990b8d69, 0x00292523, 0x19401b4c, 0x03293a82, 0x03007201, 0x04720302, 0x453f8801, 0x01310617, 
-    0x323b3d00, 0x1c232531, 0x0b12141b, 0x0145000a, 0x05db4745, 0x22065e50, 0x50030e33, 0x3e290648, 0x14333503, 0x1e17021e, 0x05964301, 0x013d0324, 
-    0x224b0310, 0x02340805, 0x022e2223, 0x01030e27, 0x46735371, 0x321f0e1f, 0x3022be24, 0x413c0e1e, 0x060f4125, 0xaa030709, 0x070a0603, 0x1622380e, 
-    0x07171e26, 0x03040703, 0x3224be7e, 0x4d082782, 0x33537247, 0x0b2a3d53, 0x523e2a0b, 0xcf914d1d, 0x8b955783, 0x8d4d4c8a, 0xc15b9b90, 0x16363bc0, 
-    0x67996e47, 0x466b976a, 0x193d3518, 0x0e1b3328, 0x3d553a26, 0x011f0120, 0x8b8a4c13, 0xcf835795, 0x311c4d91, 0x41252541, 0x00001c31, 0xe34d0200, 
-    0x70062705, 0x16000300, 0x4b46b200, 0x00202d05, 0x72000100, 0x01040100, 0x03030072, 0x24075649, 0x5b020505, 0x0ca76c06, 0x2922279d, 0x275e4c02, 
-    0x8a1e2006, 0x0004274f, 0x03040503, 0x4d870061, 0x40212583, 0x23209323, 0x57050202, 0x05342687, 0x59594f02, 0x05114059, 0x0e131504, 0x040b0c0d, 
-    0x11160516, 0x2905884b, 0x01230133, 0x2e272622, 0x134e3501, 0xf402270a, 0x9abbfec6, 0x184e8501, 0x7006250c, 0x00fb88fe, 0x20111c4e, 0x05034103, 
-    0x00f30529, 0x0017000b, 0x41cc002a, 0x24230505, 0x5a080209, 0x2d21081c, 0x2d8a824b, 0x06005906, 0x004b2806, 0x5b040707, 0x6b68010a, 0x202ba10b, 
-    0x08985929, 0x01032023, 0x2b5a8401, 0x63000106, 0x05000600, 0x61050607, 0x27835388, 0x95254021, 0x04042322, 0x28875707, 0x4f040737, 0x40595959, 
-    0x0d18191f, 0x2900010c, 0x20212227, 0x192a181f, 0x2782592a, 0x33410320, 0x0c895b10, 0x39411320, 0x2905240c, 0x881e8e1e, 0xcffa2102, 0x32114341, 
-    0xfff20004, 0x07cf03f8, 0x00030064, 0x001b000f, 0x41fa002c, 0x31210545, 0x06676200, 0x00000032, 0x040b4b2b, 0x0202030a, 0x01055b03, 0x4b2d0303, 
-    0x0833cb82, 0x08080059, 0x09004b28, 0x0c5b0609, 0x26060601, 0x4a1b4c06, 0x38ae058e, 0x38842920, 0x58503c24, 0xd9622d40, 0x2b6f840a, 0x64020308, 
-    0x07000800, 0x61070809, 0x6d888584, 0x40213483, 0x202f9c2a, 0x22958209, 0x835f0609, 0x002d0837, 0x5959594c, 0x1c1d2140, 0x04051011, 0x2324292b, 
-    0x2c1c2122, 0x14172c1d, 0x1a111b10, 0x0f04080b, 0x10110e05, 0x2b16070d, 0x23013301, 0x0aef5c07, 0x0b8a2120, 0x27220323, 0x0ca94226, 0xfec6fe35, 
-    0x1ed59abb, 0x1e1e8f1e, 0x1e1e4e01, 0x1b1e1e8e, 0x505252b4, 0x072407cc, 0xc388fe64, 0x220d7c41, 0x50d36360, 0x022e0ddb, 0x00003300, 0x70066904, 
-    0x2a000300, 0x77418d00, 0x43212005, 0x062b0ec3, 0x28040401, 0x0505004b, 0x43075b02, 0x9c430cc4, 0x8205200b, 0x0205271a, 0x0303005f, 0x30845904, 
-    0x4405e163, 0x1382080d, 0x4307be43, 0x3284089d, 0x59594f35, 0x04051340, 0x12142021, 0x0a0b0c0d, 0x2a052a04, 0x41081011, 0x1324060a, 0x35022e22, 
-    0x251b9d48, 0xbbfec6f4, 0xa248789a, 0x7006251e, 0x08fb88fe, 0x2023a848, 0x050f4103, 0x00f40529, 0x0017000b, 0x41a5003e, 0x25210511, 0x0aec5d0a, 
-    0x2106cf43, 0xd0430108, 0x430b2008, 0x22220cd0, 0x10820700, 0x5f040722, 0x05243497, 0x26401b4c, 0x2307825d, 0x63000106, 0xca434a82, 0x08a74307, 
-    0x4f244284, 0x21405959, 0x2b05a643, 0x26283435, 0x1e1f2021, 0x3e193e18, 0x41282c5f, 0xb6431e3d, 0xe0fe210c, 0x211e4541, 0x4c422a05, 0x41d6200c, 
-    0x0428234f, 0xfaff3300, 0x66076904, 0x2706db43, 0xb5cd0042, 0x07090130, 0x20076d47, 0x0ce24332, 0x0b040c22, 0x210fe243, 0xe343010a, 0x430d2008, 
-    0x2f200ce3, 0x09203988, 0x66431882, 0x974b2006, 0x4c072441, 0x872b401b, 0x01052231, 0x23278403, 0x64020308, 0xdd435f82, 0x25468a06, 0x59594c00, 
-    0xac432340, 0x38392b05, 0x24252a2c, 0x421c2223, 0xae43421d, 0x430e200d, 0x01201eae, 0x201e7d41, 0x11be4302, 0x5ae5fe32, 0x01295483, 0x0f8f01d2, 
-    0x4b364528, 0x082b4d6f, 0x2b066c4b, 0x3a1d5746, 0x07917456, 0xc088fe66, 0x200c8641, 0x088641cc, 0x365d483c, 0xaf875114, 0x0e1b0e5d, 0x706b662f, 
-    0x9aee5a39, 0x7b8e994b, 0x0000355c, 0xa3560300, 0x8b062105, 0x13220982, 0xe9431f00, 0x0103220f, 0x0dd15a72, 0x2105ae47, 0x5145022e, 0x07124407, 
-    0x29202896, 0x40212882, 0x0636441f, 0xf9562383, 0x07632405, 0x85040401, 0x3321824a, 0x15405959, 0x04051415, 0x1f14191b, 0x0b0d1f15, 0x13051304, 
-    0x210be943, 0xf5511102, 0xc6f42516, 0x8d9abbfe, 0x2812fa51, 0x88fe8b06, 0x2b01d0fa, 0x18ff5101, 0xe7490220, 0x70062105, 0x4927f782, 0x45b5a400, 
-    0x42050401, 0x2620077b, 0x052daf8a, 0x05030403, 0x01077004, 0x4b280303, 0x25b58306, 0x0209085c, 0x01410202, 0x482da309, 0x03220c90, 0x4e827201, 
-    0x72030527, 0x05040500, 0x41538a72, 0x1735050a, 0x3f410405, 0x27293536, 0x16181f20, 0x49040e0f, 0x10114905, 0x0652420a, 0xf65e0320, 0x4a372006, 
-    0xb9482c0d, 0x4a6a2005, 0x06253912, 0xfa88fe70, 0x3f174aeb, 0xeb600320, 0x89063405, 0x28000300, 0x67013d00, 0x242d0940, 0x05041316, 0x4d4a0108, 
-    0x2f2005ec, 0x3b0a7941, 0x5b030808, 0x03030104, 0x05004b30, 0x065c0205, 0x02020209, 0x010a4b2e, 0x5b020707, 0x02200c85, 0x2007f760, 0x22369424, 
-    0x8802070a, 0x05374a38, 0x58501523, 0x20629f40, 0x85628b29, 0x82352036, 0x8a302036, 0x04042462, 0x83004b28, 0x8600209e, 0x5c06259d, 0x26060600, 
-    0x09233886, 0x85020201, 0x823a2037, 0x8a2e2037, 0x00052637, 0x06050206, 0x05505464, 0xd1853f88, 0x9f8c3587, 0x0803042f, 0x70080403, 0x08000300, 
-    0x63080305, 0x8c408600, 0x83592031, 0x1b403a00, 0x0405292a, 0x3d293234, 0x1e203d2a, 0x14151b1d, 0x28040d0f, 0x10112805, 0x0b2f470b, 0x61064643, 
-    0x3142222f, 0x61212005, 0x06253334, 0xfa88fe89, 0x313961d6, 0x02000022, 0x2105175e, 0xf0828b06, 0xeb003338, 0x01181640, 0x01190304, 0x010e0405, 
-    0x01300506, 0x01310607, 0x195e0702, 0x41282007, 0x07200d58, 0x5c055841, 0x07240743, 0x085b0207, 0x23088841, 0x40585007, 0xd6432fa5, 0x242fa509, 
-    0x1b4c0229, 0x0b014440, 0x2207ae5e, 0x84060005, 0x37888a92, 0x40595959, 0x2e040515, 0x2324262c, 0x171b1d21, 0x05330415, 0x09101133, 0x5e0ea141, 
-    0xf4252447, 0x9abbfec6, 0x234c5eda, 0xfe8b0625, 0x5ed7fa88, 0x02332451, 0x56fec300, 0x8b061b04, 0x17000300, 0x0fb5e600, 0x43020301, 0x62430799, 
-    0x01052207, 0x05bf4272, 0x18020221, 0x23074b52, 0x4b260303, 0x6d082559, 0xdc490514, 0x02002508, 0x055b0402, 0x8c05264a, 0x05146d27, 0x539f2785, 
-    0x89055d64, 0x4e7a8b2b, 0xa5590748, 0x4e402005, 0x5283073d, 0x0200052e, 0x63020503, 0x03000400, 0x61030406, 0x5920a285, 0x40240082, 0x1123130a, 
-    0x10290282, 0x2b1b0707, 0x23013301, 0x05056101, 0x430cde5d, 0x01210501, 0x0ce45d87, 0xfe8b0625, 0x5da3fd88, 0x03350fe8, 0x4ffe3d01, 0xb2019503, 
-    0x17000b00, 0x67002400, 0x5018b04b, 0x318b8258, 0x05030001, 0x00630301, 0x5b040505, 0x04040108, 0xf97d4b42, 0x5d3e2009, 0x228607bf, 0x02231f82, 
-    0x8c630405, 0x40592220, 0x05e3491b, 0x181e2032, 0x13241924, 0x0d170c11, 0x00050717, 0x090b010b, 0x0bedda19, 0x06141522, 0x290b0d59, 0x26272213, 
-    0x33363435, 0x18821632, 0x9768023e, 0x96959694, 0x58969797, 0x58585757, 0x24575656, 0x222f1716, 0xfe312f25, 0xd9d7da4f, 0x2a080082, 0xa959dad7, 
-    0xa9a9b0af, 0x01a9afb0, 0x20151510, 0x202d2d20, 0x00002921, 0x58010100, 0x930370fe, 0x0a00b301, 0x04b74500, 0x51030203, 0x272005d8, 0x1133dc82, 
-    0x01000100, 0x00010272, 0x005a0300, 0x033e0303, 0x18401b4c, 0x82111265, 0x0300271a, 0x11b6594e, 0x45181411, 0x353908fa, 0x33113337, 0x6a012115, 
-    0x8ae5dfcd, 0xfed7fdcc, 0x296302de, 0x2bfd2774, 0x8272826e, 0xfe422d60, 0x017d0366, 0x001e00ba, 0x0e0e404f, 0x0d256582, 0x00000201, 0x237d8201, 
-    0x40b04b4a, 0x13217a82, 0x23758200, 0x63000102, 0x07b94018, 0x18207c84, 0x03231589, 0x86550203, 0x0302221b, 0x287d824d, 0x042a2419, 0x012b1808, 
-    0x05057637, 0x23022e27, 0x3e350722, 0x05d15301, 0x0f060724, 0x8f822101, 0xe7423408, 0x28144733, 0x2943301a, 0x77427e63, 0x5274473c, 0x7626252d, 
-    0xfd9a01d3, 0xe2d4fec5, 0x3d1f4e31, 0x24331e33, 0x1c7d4814, 0x583f231c, 0x3c3a3a36, 0x8272cd75, 0xfe463aaf, 0x019c0348, 0x002900ab, 0x1916409d, 
-    0x18050401, 0x24040301, 0x04030201, 0x23048201, 0x05010001, 0x20062564, 0x08f5651e, 0x5b20a082, 0x4221a082, 0x223e824b, 0x82065b00, 0x003e26ce, 
-    0xb04b1b4c, 0x18dd8249, 0x200f6655, 0x21238c63, 0x44892140, 0x01020024, 0x5b180203, 0x06200b4c, 0x00366c82, 0x4059594f, 0x1d000113, 0x1014161b, 
-    0x080b0d0e, 0x01290006, 0x2d420729, 0x35272205, 0x26f4821e, 0x2b343536, 0x5b333501, 0x0941073e, 0x06460809, 0x15011e07, 0x2d020614, 0x453c713a, 
-    0x75662d71, 0x5e4a42db, 0x2d585f61, 0x74453c6e, 0x51744833, 0x5e55572c, 0x48febd63, 0x1b791415, 0x9645501a, 0x393c3f6c, 0x7917183e, 0x381f1211, 
-    0x5c483151, 0x516b1513, 0x9782857d, 0x56fe0c32, 0x99018d03, 0x0d000a00, 0x0cb65100, 0x01020202, 0x22074844, 0x82010017, 0x0666340d, 0x03020205, 
-    0x02040001, 0x04006200, 0x4c043e04, 0x8216401b, 0x72012119, 0x59201890, 0x077f4918, 0x11113108, 0x07101211, 0x052b1908, 0x33013521, 0x23153311, 
-    0x01192315, 0xfe8f0201, 0xa26b017d, 0xfe8a7474, 0x0279f0ee, 0x6fe6fd10, 0x012901ba, 0x0063fe9d, 0x01350082, 0x61fe3f01, 0xb3017d03, 0x41001e00, 
-    0x01133e40, 0x030e0502, 0x24828302, 0x4a030100, 0x05ae4500, 0x05006127, 0x05010200, 0x0c6b4102, 0x1600012f, 0x10111214, 0x070b0d0f, 0x011e0005, 
-    0x0543411e, 0x28084241, 0x07222326, 0x21152111, 0x08185615, 0x33023108, 0x78346094, 0x746f693c, 0x015a6467, 0x329dfed6, 0x5173483a, 0x7b552e2c, 
-    0x722461fe, 0x5b621d1a, 0x0129635a, 0x11cc5fa2, 0x42694928, 0x274a6942, 0x25089f82, 0xfe490102, 0x01a1036b, 0x001700ce, 0x40750021, 0x0201090e, 
-    0x03010a01, 0x04011002, 0x4b4a0305, 0x585030b0, 0x98641d40, 0x0405220a, 0x0be27103, 0x4c003e25, 0x9223401b, 0x0000231f, 0x37665704, 0x00043308, 
-    0x1740594f, 0x00011819, 0x21181b1d, 0x11132119, 0xd5820c0e, 0x17011723, 0x0b474408, 0xb9641720, 0x063a4406, 0x35322723, 0x055d5b34, 0x80023108, 
-    0xacb396a1, 0x272b5c2e, 0x7a783058, 0x92888b40, 0xa7a78c97, 0xfe5b5b51, 0xd6e1d06b, 0x681011dc, 0x9fa11614, 0x888a9375, 0xc4c45894, 0x675d5d67, 
-    0x2d057b41, 0x0379fe3d, 0x00bc0185, 0xb53d0006, 0x3d440104, 0x821e2005, 0x430e20d0, 0x612506ac, 0x3e020200, 0x21c18202, 0xb9180015, 0x00200e43, 
-    0x4d202182, 0x09005b18, 0x21352134, 0x02230115, 0x0244fef9, 0x83b4fe48, 0x305f5d01, 0x6383edfc, 0x3b010326, 0x96035afe, 0x1f2d6382, 0x37002b00, 
-    0x18b66f00, 0x02050208, 0x06734301, 0x047f2020, 0x01072107, 0x21063546, 0x22634b3a, 0x09834509, 0x03010223, 0x25228263, 0x02040500, 0x208c6305, 
-    0x1b40593a, 0x20212c2d, 0x31330001, 0x372d372c, 0x2b202527, 0x0f112b21, 0x1f011f00, 0x24058345, 0x3435022e, 0x08b44736, 0x15021e23, 0x05474314, 
-    0x03020e22, 0x200aa15e, 0x080b8a13, 0x47680271, 0x62294e6f, 0x2759515e, 0x41416748, 0x59274868, 0x29625e51, 0x4c47704e, 0x4b4e4d4f, 0x554b4f4f, 
-    0x55545c5b, 0x5afe5d5a, 0x38593d21, 0x12136f5b, 0x50314864, 0x391e1e39, 0x64483150, 0x5a6f1312, 0x213d5939, 0x4347f501, 0x45474745, 0x63fe4743, 
-    0x544e4e55, 0x554e4e54, 0x30010200, 0x880362fe, 0x1700c501, 0x45002100, 0x01094240, 0x44040504, 0x03220689, 0x7f4d004a, 0x202a8209, 0x0df14204, 
-    0x01181925, 0x421d1f00, 0x0d24051f, 0x0006080b, 0x42091f42, 0x112405f6, 0x2223010e, 0x87095a46, 0x153608df, 0x2d270214, 0x57282b5c, 0x691df230, 
-    0x96908945, 0xb496a28a, 0x5a5a5181, 0x62fea851, 0x14681011, 0x393f0116, 0x888a943b, 0xd4e1d193, 0x678201dd, 0xc4675d5e, 0x8b8200c5, 0xfe1b2808, 
-    0x065a04e3, 0x000a007b, 0x002d000e, 0x04634066, 0x00030203, 0x03010c01, 0x08010e00, 0x06012207, 0x02121d09, 0x82110605, 0x4a0621c4, 0x38097246, 
-    0x62030007, 0x08000700, 0x61080709, 0x06000900, 0x63060905, 0x04040500, 0xf7631a05, 0x2325390d, 0x1e1f2021, 0x14161a1c, 0x2d102d0f, 0x10141111, 
-    0x2b18080b, 0x07113313, 0x25068446, 0x09170107, 0xd3432201, 0x4668201a, 0x4d2706a4, 0xfb1b2404, 0x43c902d9, 0x032117e1, 0x07c446a6, 0x0601d427, 
-    0xfcfafe6c, 0x16f143eb, 0x85000321, 0x008c2af3, 0x0022001e, 0x406b0041, 0x07e34668, 0x02002025, 0x82220203, 0x823620f6, 0x263121f6, 0x2524f682, 
-    0x07050401, 0x0020f683, 0x2505ee46, 0x02070300, 0xf8a06103, 0x39232433, 0x33343537, 0x2a2e3032, 0x24412328, 0x24191141, 0x46f8842a, 0x0a411bff, 
-    0x47402020, 0x2520191f, 0x47201d41, 0x2d41173f, 0x0923421e, 0x29008c2a, 0x4c002d00, 0x85408800, 0x370f6347, 0x0002032b, 0x0a012d01, 0x08014109, 
-    0x02313c0b, 0x01300807, 0x4a090706, 0x08112947, 0x00010c39, 0x63000109, 0x0a000900, 0x610a090b, 0x08000b00, 0x63080b07, 0x06060700, 0x07005707, 
-    0x0d5b0607, 0x06070601, 0x012e2f4f, 0x40424400, 0x3b3d3e3f, 0x2e333539, 0x474c2f4c, 0x0e200d4e, 0x202b4e47, 0x1f634205, 0x472b0121, 0x3e201e6f, 
-    0x201f5e41, 0x1d904729, 0x9242c520, 0x0400231d, 0x87430a00, 0x0d240808, 0x30001100, 0x1c40f300, 0x0202020c, 0x04010f01, 0x0a011100, 0x08012509, 
-    0x0215200b, 0x01140807, 0x4a060706, 0x2005ac4f, 0x05c94734, 0x09243e82, 0x70090400, 0x20115541, 0x282c830d, 0x0001035f, 0x0c590200, 0x2a4f8205, 
-    0x1b4c003c, 0x503eb04b, 0x82334058, 0x7201213b, 0x40213aae, 0x83358c39, 0x07424852, 0x081fd141, 0x40595923, 0x0b12131e, 0x2426280b, 0x1f212223, 
-    0x1217191d, 0x0b301330, 0x110d0b0d, 0x10121111, 0x2b19080e, 0x0c554801, 0xb5410320, 0x488d2020, 0x60200976, 0x201fa041, 0x0c9748f2, 0x4103fe21, 
-    0x04261d90, 0xe3fe1b00, 0x17456a04, 0x00262606, 0x40680030, 0x09194565, 0x020e182d, 0x01190506, 0x011f0607, 0x45050908, 0x05240a15, 0x00620300, 
-    0x08966918, 0x0809002c, 0x0b630907, 0x04040801, 0x06825708, 0x04082108, 0x04010a5b, 0x284f0408, 0x2c0f1027, 0x2830272a, 0x1d202230, 0x0f14161b, 
-    0x11261026, 0x0c101411, 0x45131b45, 0x194806ed, 0x0d204518, 0x48160321, 0x1f451627, 0x1a374811, 0x1e2aff89, 0x3a002200, 0x83004400, 0xb9498040, 
-    0x02203208, 0x2c010002, 0x07080222, 0x0809012d, 0x0b0a0133, 0x12c74906, 0x00010c26, 0x63000107, 0x2f062b45, 0x00090063, 0x0b090a0b, 0x0a010e63, 
-    0x570a0606, 0x0a3e0682, 0x010d5b06, 0x4f060a06, 0x23243b3c, 0x3e400001, 0x443c443b, 0x2f313436, 0x3a23282a, 0xfb493a24, 0x080f230d, 0x27462b14, 
-    0x05e4431c, 0x211f2c41, 0x3f463101, 0x9efe2617, 0xfb1b2404, 0x193f41d9, 0x4f462920, 0x07da4315, 0x24184d41, 0xfe1b0003, 0x086347f2, 0x41001524, 
-    0x49423e40, 0x0e132509, 0x03050402, 0x29054142, 0x06040600, 0x00010273, 0x46420300, 0x04043705, 0x05005505, 0x00590405, 0x4d040504, 0x11151112, 
-    0x07101411, 0x3e471b08, 0x0501210e, 0x42059a49, 0x8f200e07, 0x4106a849, 0x22200ff7, 0x2007b749, 0x20978204, 0x269788ed, 0x00300026, 0x891d40a2, 
-    0x01183999, 0x01130908, 0x01120605, 0x4a050504, 0x0109010e, 0x2cb04b49, 0x2a405850, 0x27100448, 0x09070809, 0x0a050063, 0x04302982, 0x08010b5f, 
-    0x005b0608, 0x063a0606, 0x30401b4c, 0x24822c95, 0x05060023, 0x12324808, 0x1b405928, 0x0f102728, 0x1d432c2e, 0x1a1c2305, 0x1d431517, 0x1e17491d, 
-    0x210d1541, 0x2549bd02, 0x0f254116, 0x49f5fc21, 0x002a1a35, 0x3d010300, 0x95036004, 0x6f50c307, 0x40422206, 0x50e8823f, 0x00231047, 0x50570200, 
-    0x0222084e, 0x4a504f00, 0x6004215a, 0x231e4a50, 0x0c010200, 0x8d28b382, 0x0a00a307, 0x63000d00, 0x200d134e, 0x08494620, 0x06730425, 0x82020205, 
-    0x835520b9, 0x00022b07, 0x0001035a, 0x1b4e0002, 0x22821f40, 0x00720124, 0x21960004, 0x4511254e, 0x254e0dcf, 0x1a05210b, 0x2f0c8e45, 0x3f010100, 
-    0x7d033c04, 0x1e008e07, 0x0f407100, 0x260e234e, 0x5020b04b, 0x4e1e4058, 0x04370822, 0x00590304, 0x4b3f0303, 0x00000106, 0x01005b01, 0x4c004401, 
-    0x4e21401b, 0x1e82114b, 0x1e825720, 0x065b0022, 0x2105984f, 0x534e1340, 0x3c04214a, 0x2b151144, 0x02000000, 0x4e044901, 0xb107a103, 0x2017534e, 
-    0x13534e18, 0x0026a482, 0x01075b04, 0xcf840404, 0x2179534e, 0xcd444e04, 0x00003018, 0x043d0101, 0x07850360, 0x000600a3, 0x4e214024, 0x3c4e0554, 
-    0x11122714, 0x17080310, 0x3a4e012b, 0x4407300e, 0xedfc305f, 0x3b010300, 0x96035404, 0x4e00b607, 0xc7200537, 0x7409374e, 0x01220551, 0x144e0300, 
-    0x051e410c, 0x1e410820, 0x05807d06, 0x5d4e2420, 0x083a4e0a, 0x04000023, 0x08414e57, 0x4f00042a, 0x15b04b1b, 0x1e405850, 0x518d2b90, 0x4ca44020, 
-    0x4e595921, 0x04217b8f, 0x338f4e54, 0x0359042d, 0x00bc0788, 0x00210017, 0x4e0e4073, 0x96610d8f, 0x4e1c2005, 0x002a0796, 0x00010601, 0x005f0001, 
-    0x8a420202, 0x02392505, 0x22401b4c, 0x4312b54e, 0x1720105b, 0x2152bd4e, 0x87455904, 0x00023e1c, 0x038d004f, 0x002304ea, 0x000d0006, 0x090db508, 
-    0x30020206, 0x0135132b, 0x15010915, 0x27068503, 0xfed5014f, 0x0f2d01d3, 0x022c0685, 0xa201522f, 0xfef4febf, 0xa201bff4, 0x00290a88, 0x00020000, 
-    0x048d00e7, 0x224b8982, 0x8303060a, 0x0109214b, 0x01214682, 0x22068525, 0x822d01e7, 0xfed5244b, 0x88c6012b, 0x014c2b09, 0xbf0c010c, 0xfe525efe, 
-    0x0a89bf5e, 0x01002108, 0x54fea500, 0x60048004, 0xc1002c00, 0x5031b04b, 0x180c4058, 0x2a000101, 0x04031922, 0x1b4a0201, 0x03200e83, 0x59200e88, 
-    0x18392285, 0x00000102, 0x01034b3c, 0x5b040101, 0x04040105, 0x06004b42, 0x4c063e06, 0x05ee601b, 0x03001f28, 0x03000100, 0x27857001, 0x26920020, 
-    0x69823e20, 0x26872020, 0x42820020, 0x83570121, 0x59002148, 0x4e853286, 0x891d4021, 0x231e8222, 0x63040106, 0x06211f83, 0x2a6e8559, 0x40595959, 
-    0x2826140a, 0x48251525, 0x20080773, 0x16171614, 0x37363233, 0x33113536, 0x1e171411, 0x37323301, 0x0e153736, 0x23060701, 0x27262722, 0x08078606, 
-    0xa5231157, 0x3c1c20b8, 0x20603e71, 0x0810b940, 0x0f0c0e18, 0x25131d0d, 0x3e202410, 0x2f0c2625, 0x5a5b4241, 0xa72c4040, 0x48fd6004, 0x4c23684e, 
-    0xa6552b2a, 0xa0fc8d02, 0x0e0e1c3b, 0x940e0405, 0x0b05120b, 0x514e2828, 0x26262726, 0x00d5fd50, 0x00faff02, 0x05d90400, 0x22af828f, 0x18480006, 
-    0x20083bae, 0x33e68235, 0x02000011, 0x01037200, 0x5a010202, 0x3a010100, 0x401b4c01, 0x263eae18, 0x0133013d, 0x01092521, 0x02d10002, 0x0321fb08, 
-    0xfe8ffedf, 0xfa8f0590, 0x1704ac71, 0x8200e9fb, 0xbf681800, 0x05fd580f, 0x11690124, 0x2f5a0210, 0x05a05806, 0x07336a18, 0xf2000326, 0xc4032e05, 
-    0x20084f61, 0x07594358, 0x220b2965, 0x61060407, 0x02200946, 0x1920ad82, 0x840af960, 0x0203221c, 0x297c8260, 0x594c002b, 0x10111540, 0xd8600405, 
-    0x077c630d, 0x60178764, 0x976012b8, 0x2cdb8410, 0x034002c6, 0x0092030a, 0x401f000f, 0x21da821c, 0x28470100, 0x01022e05, 0x4f000100, 0x07090001, 
-    0x0f010f00, 0x05754b03, 0x34352630, 0x32333637, 0x14151617, 0x68020607, 0x00822f44, 0x05844420, 0x2f400225, 0x824b4b2f, 0x8205840e, 0x0080313a, 
-    0x075104b7, 0x0003004a, 0x1eb04b26, 0x0b405850, 0x01211482, 0x21738273, 0xff18003f, 0x012d14a7, 0x03230133, 0xeefcbe93, 0xf94a07bf, 0x3a27826d, 
-    0x00250003, 0x07ac0400, 0x00030040, 0x000e000b, 0x010db5bd, 0x4a010206, 0x8217b04b, 0x8222204e, 0x0002254e, 0x07700201, 0x075a4b18, 0x3f2c3282, 
-    0x0202004b, 0x01054b39, 0x033a0303, 0x41092943, 0x022205b1, 0x2b897201, 0x3a20268d, 0x1f205082, 0x8206c55c, 0x223f8226, 0x8c730304, 0x8202202c, 
-    0x892720b3, 0x02002421, 0x88720206, 0x04042326, 0x2d825506, 0x4b180620, 0x59290885, 0x0c0c0f40, 0x0e0c0e0c, 0x29008311, 0x1a080810, 0x0333012b, 
-    0xe2831523, 0x2303212a, 0x02010b01, 0x9ae5bab3, 0x0c736418, 0xfe400724, 0x641863f8, 0xb8820e76, 0x02000030, 0x9b35d703, 0x0f5f23dd, 0x1900f53c, 
-    0x00830008, 0x15504e23, 0x2b078378, 0x2d392ed2, 0xc3fd46fc, 0xd1074b05, 0x09220f82, 0x31840200, 0x05830020, 0xfe6d072d, 0x0400001d, 0xff46fcd1, 
-    0x864b0586, 0x85248217, 0xfe052502, 0x6800d104, 0x07820b83, 0x00202582, 0x25230383, 0x9b00d104, 0x20238303, 0x202382a6, 0x2003928b, 0x20138289, 
-    0x87038208, 0x82c52007, 0x20039f0b, 0x202382e9, 0x83039266, 0x82032043, 0xa2c92017, 0x866d2003, 0x20338373, 0x8a0b82d7, 0xf6ff2103, 0x56200f82, 
-    0x9320ab92, 0x75201386, 0x038f0782, 0x138a0620, 0x0383cf83, 0x48202383, 0xac201782, 0x0f838f86, 0x0b828f20, 0x1341038b, 0x822f2013, 0x83038b23, 
-    0x20038f77, 0x8f238209, 0x200f8313, 0x0a974139, 0x83079f41, 0x41122007, 0x6e2016a3, 0x038b1782, 0x0f828820, 0x292003a3, 0xc1202782, 0xa4200382, 
-    0x7b200392, 0x20065b41, 0x8307825d, 0x827c200b, 0x20039f07, 0x202382a7, 0x20039297, 0x241382c3, 0x01d10446, 0x2103910c, 0x138dda00, 0x82ee0021, 
-    0x86e2202b, 0x82b42003, 0x8aa02007, 0x824c2003, 0x826d200b, 0x934f8303, 0x42892003, 0x0b870a0f, 0x138a2020, 0x83078f41, 0x820e201b, 0x86be2017, 
-    0x210f8203, 0x87822e01, 0x00210386, 0x201782e4, 0x200392d5, 0x201382bc, 0x93038e83, 0x96272087, 0x416420a3, 0xd78316d7, 0x1b826820, 0xcb20038f, 
-    0x038a1382, 0xb3830120, 0x0342f420, 0x82a62006, 0x42038307, 0x00210af3, 0x0e774321, 0xfb860f20, 0x410b9f42, 0x4b830717, 0x1f865620, 0x07867520, 
-    0x1b43c520, 0x412f2006, 0x42200aeb, 0x12200b82, 0xbf831f86, 0x0b827220, 0x0f865d20, 0x6f862e20, 0x07823420, 0xdb864120, 0x43862c20, 0x07828120, 
-    0xc343a920, 0x046d240a, 0x82dcffd1, 0x8250200f, 0x82d22007, 0x43202007, 0x5f20066b, 0xaf200782, 0xab870382, 0x3d209f83, 0x9344878a, 0x20838307, 
-    0x8b4f86a0, 0x4382202b, 0xbf830a13, 0x8707d343, 0x441a2023, 0xef430a03, 0x42b3200b, 0x7f200ecf, 0x20063f44, 0x0a134152, 0x47430020, 0x827d2006, 
-    0x04ef2407, 0x863301d1, 0x209f8303, 0x203f8e69, 0x42ef863b, 0xec200b0f, 0x03831382, 0x07823220, 0xbd203383, 0x07835b86, 0x0b82be20, 0x03829b20, 
-    0x0382d620, 0x03867220, 0x07826820, 0x03824c20, 0x0382a520, 0x0382b820, 0x67837783, 0xb2202f83, 0xe1200f82, 0x3c200382, 0x20062742, 0x20078210, 
-    0x06a3426a, 0x1b832f83, 0x0f82e420, 0xee200383, 0x20068f41, 0x20078276, 0x8303824b, 0x8289207f, 0x82bb2007, 0x82e32003, 0x20ab8703, 0x200b82d8, 
-    0x836f86b7, 0x825c2087, 0x2003830b, 0x05bf4260, 0x86c70121, 0x2027832b, 0x06a741cd, 0x2007f744, 0x200f827c, 0x8703868e, 0x4291204f, 0x8b430af7, 
-    0x42d7200b, 0xaf820edb, 0x86240121, 0x82a92013, 0x42842007, 0xd520063b, 0xb9200782, 0x29200b86, 0x2006d741, 0x20538675, 0x20078277, 0x20038280, 
-    0x20038255, 0x830b8636, 0x867820a7, 0x4449200b, 0x00210563, 0x063b41bb, 0x27865d20, 0x07829320, 0x03824720, 0x0f865f20, 0x17465620, 0x86402006, 
-    0x8343830f, 0x20078323, 0x8313822d, 0x45622007, 0x21200697, 0x69200782, 0x2f830b86, 0x63869b20, 0x7520bb83, 0x67205786, 0x83064345, 0x86b8207f, 
-    0x2013837b, 0x065b41e3, 0x2f436a20, 0x04bc2406, 0x869701d1, 0x828920f3, 0x210f8207, 0xc343bd00, 0x82c22006, 0x829a2007, 0x82902003, 0x82d92003, 
-    0x82182003, 0x82a82003, 0x201f8303, 0x830782f2, 0x200f838f, 0x831386b6, 0x86682007, 0x21bb8243, 0x57863501, 0x5f424f20, 0x82192006, 0x45702007, 
-    0x9f200637, 0x6f200782, 0x37200382, 0x9e200f86, 0xeb839786, 0x0b82a020, 0x07830f83, 0x0b829220, 0x278a9d20, 0x0b869f20, 0x2b830783, 0x07833f83, 
-    0x17868220, 0x13833783, 0x56200783, 0x8a201382, 0xa1200382, 0xb3206386, 0x37830782, 0x17868c20, 0x0f835f83, 0x7220ff83, 0x6a203f86, 0x27830782, 
-    0x33856520, 0x82950121, 0x82852007, 0x82f62003, 0x82982003, 0x200f8303, 0x20078266, 0x2017868f, 0x2007828b, 0x20038283, 0x0633487f, 0x07821b20, 
-    0x012503a2, 0x01d10458, 0x20038242, 0x06274246, 0x01215382, 0x200f82e9, 0x2003823f, 0x200382ca, 0x05934490, 0x82c60121, 0x82f42007, 0x82d0200f, 
-    0x82022007, 0x85c32007, 0x2200210f, 0x2505df41, 0xd1045201, 0x17821002, 0x4382e783, 0x425e0021, 0x012105a7, 0x204b851d, 0x253b8200, 0xd1040000, 
-    0x0f82bcff, 0x0382cf20, 0x1f825a20, 0xa5203b83, 0x2006c345, 0x200782c1, 0x20038258, 0x836386da, 0x2103820f, 0x0f82d801, 0x00200382, 0x0121d782, 
-    0x200b8205, 0x200382a7, 0x20438982, 0x214b8601, 0x13822801, 0x2b85de20, 0x00213383, 0x824b82f0, 0x67012103, 0x6e201382, 0x44200382, 0x00210385, 
-    0x831782d3, 0x82ce2003, 0x21038207, 0x1782c901, 0x19200383, 0xfa200f82, 0x35200b82, 0x37200382, 0x2c200382, 0xff830386, 0xbb831782, 0x37830388, 
-    0x1f826420, 0x17830386, 0xdb820120, 0x86fe0121, 0x8463865b, 0x839f839b, 0x86932003, 0x0480241b, 0x82ac01d1, 0x41162003, 0x0121056f, 0x830b8229, 
-    0x828720bb, 0x21038207, 0x1782bf00, 0x01210382, 0x200f8223, 0x200382d6, 0x05d7447a, 0x82790121, 0x42b22007, 0x012105d3, 0x8c7b85ff, 0x0b074993, 
-    0xd2200ba7, 0x2006bb48, 0x06e747cd, 0x5344f520, 0x203f8706, 0x200f828b, 0x061f460a, 0x0b86b820, 0x63485f20, 0x83238306, 0x2007831b, 0x8313822a, 
-    0x822f2003, 0x821e2007, 0x452e2003, 0x3520067b, 0x27200782, 0x21050742, 0xef498200, 0x86682006, 0x827e2063, 0x43582007, 0x542006df, 0x50200782, 
-    0x13830386, 0x01210382, 0x830f82e9, 0x864a2033, 0x20138227, 0x21ff8200, 0x0f8afaff, 0x0b822920, 0x67468120, 0x01022105, 0x8306a349, 0x8a562027, 
-    0x86a4200b, 0x8696202f, 0x205f864f, 0x207f8300, 0x201382be, 0x831f8621, 0x201b87c7, 0x20638a98, 0x06e345ba, 0x07871b87, 0x8f209b83, 0x82063346, 
-    0x1c01233b, 0x0393d104, 0xbf830020, 0xbb417520, 0x87338306, 0x86c78303, 0x2b012167, 0x3b246386, 0x1202d104, 0x3f200b82, 0x35200382, 0x2006eb41, 
-    0x836386e8, 0x204b8377, 0x8f9b8a57, 0x970f9793, 0x83178333, 0x0b634153, 0x45204393, 0x27467392, 0x93078707, 0x93238f63, 0x07af410f, 0x8f8f1b97, 
-    0xe7448320, 0x20178f06, 0x8317825e, 0x07474203, 0x438f07a3, 0x1c200f8b, 0x240ac74a, 0x01d10469, 0x05034109, 0x04f8ff23, 0x210383d1, 0x0f825a00, 
-    0x33870383, 0xcb93bf83, 0xe78f638f, 0xc344a782, 0x07cb4408, 0x6f821820, 0x19240387, 0xf602d104, 0x07820f82, 0x178b0120, 0x02210b82, 0x212785f5, 
-    0x8b820c02, 0x27821120, 0x0b840782, 0x0b821020, 0x13820b20, 0x01200783, 0xcb830782, 0x8707db49, 0x2177828f, 0xd7419600, 0x43a4200a, 0x01200597, 
-    0xb8202b83, 0x42200b82, 0x8f05ab47, 0x8200200f, 0x20138417, 0x8223862a, 0x9813830f, 0x82592003, 0x86038327, 0x873b8427, 0x8b3b8a43, 0x980b8717, 
-    0x85722053, 0x4800209b, 0x0783074f, 0x1382ba20, 0x03824020, 0x03865120, 0x8b483220, 0x86462006, 0x21838a7f, 0xab431602, 0x845f8705, 0x8e47200f, 
-    0x8edf87cf, 0x209b8407, 0x822b869b, 0x410f8f07, 0x1741081f, 0x0c07411e, 0x4f86f420, 0x19200783, 0x83065747, 0x83038b0b, 0x8327874f, 0x8727830b, 
-    0x82922007, 0x82542033, 0x8a742003, 0x822e2007, 0x864a200b, 0x200b830f, 0x210b8536, 0xcf453101, 0x04f02206, 0x830b88d1, 0x200f823b, 0x84078200, 
-    0x46602013, 0x7b200617, 0x8206034a, 0x5001213b, 0x65200b86, 0x03830782, 0x00211382, 0x200b8261, 0x06734a7e, 0x03463320, 0x42912006, 0x75200653, 
-    0x0b838b8a, 0x0f822b20, 0x43864f20, 0x07821d20, 0x03862620, 0xd1043224, 0x03899cff, 0xff218383, 0x960f82ec, 0x66012103, 0x378b1b99, 0x04690225, 
-    0x854604d1, 0x930b832b, 0x47178b53, 0x06230c4b, 0x8200d104, 0x83338303, 0x23038b07, 0xd1043801, 0x178f0383, 0x01210f97, 0x87af913f, 0x3701212b, 
-    0x53844b85, 0x43970b82, 0x2c201784, 0x86060f4e, 0x4401219b, 0x1b83a385, 0x02230b83, 0x83d10418, 0x82e79403, 0x9717871b, 0x78012123, 0x2b83a791, 
-    0x03871783, 0x2b934387, 0x8b871b8b, 0xdb9c278b, 0x2388d386, 0xdb82db20, 0x178f0383, 0x61200f93, 0x03832b82, 0x7f4daf20, 0xa7239306, 0x97778713, 
-    0x25479e07, 0xd104ecff, 0x834ec801, 0x413c2006, 0x0f93058f, 0x85180221, 0x421b8327, 0x17a20cb3, 0x038b3383, 0xfb13ef41, 0x82002013, 0x870383f7, 
-    0x0b6f42e3, 0xa7230b84, 0x87ffd104, 0x41ec2003, 0x02210523, 0x09bb4268, 0x0f83db83, 0x8b071b41, 0x12022107, 0x24061f49, 0x00d1041b, 0x06634a38, 
-    0x2007ab4a, 0x05674ac7, 0x822b0121, 0x82482007, 0x87a22003, 0x00002303, 0x03820afd, 0x00003024, 0x038246fc, 0x0382c920, 0xd1044e24, 0x0382db01, 
-    0x03822f20, 0x03822920, 0x07868b20, 0x5f823f20, 0x0b820220, 0x03821720, 0x03825820, 0x03823d20, 0x0382a420, 0x03825620, 0x03821f20, 0x2347e020, 
-    0x863f2006, 0x2013833f, 0x062f4c79, 0x6f4d3720, 0x0c012105, 0x02205785, 0x0b204787, 0x20059f4e, 0x21eb82ff, 0xc343c200, 0x074f5606, 0x20079f52, 
-    0x201782c5, 0x0a57516e, 0x0b86c920, 0x07822520, 0xaf455720, 0x86892006, 0x2007833b, 0x200b82ac, 0x064f4b78, 0x07822220, 0x03827620, 0x1f861220, 
-    0xd1044a24, 0x0382c4ff, 0xd1041e24, 0x0782d7fe, 0x03822120, 0xfe21ef82, 0x2007822b, 0x20238241, 0x06774dca, 0x07824620, 0x77469820, 0x20538306, 
-    0x06634fa9, 0x7b85c320, 0x82360121, 0x82ba2007, 0x46442003, 0xa0200657, 0x00211785, 0x20078250, 0x061351b4, 0x9b4e7720, 0x33002105, 0x20069751, 
-    0x06334959, 0xd1044622, 0x43843f83, 0x1382f220, 0x03871f83, 0x1f826b83, 0x03830020, 0x6f827383, 0x413d0121, 0x874e066f, 0x0c012106, 0x3f200f82, 
-    0x49200382, 0x20068341, 0x2007823b, 0x0ecf4e30, 0x0f8e0a20, 0x2b861b20, 0x4f203b97, 0xe7202f82, 0xff21b785, 0x05bf41fa, 0x57f20021, 0x012105e3, 
-    0x058b4dc6, 0x83250021, 0x2003820f, 0x08038db4, 0x00f00138, 0x005c0300, 0x00780400, 0x00500500, 0x00240600, 0x006c0700, 0x00ac0800, 0x00180a00, 
-    0x00080b00, 0x002c0c00, 0x00300d00, 0x00100f00, 0x00d81000, 0x007c1200, 0x0b821400, 0x00d01424, 0x0f821500, 0x3f821720, 0x00541828, 0x00fc1800, 
-    0x2f821a00, 0x008c1b24, 0x1f821d00, 0x00281e28, 0x00a81f00, 0x73822000, 0x00842128, 0x00c42200, 0x2b822300, 0x00902424, 0x07822600, 0x0070282c, 
-    0x00a02900, 0x007c2b00, 0x2f822c00, 0x00f42c39, 0x008c2d00, 0x00802e00, 0x00e02f00, 0x00e83000, 0x00443200, 0x82383300, 0x00f82803, 0x00203500, 
-    0x82143700, 0x00dc2803, 0x00683800, 0x821c3900, 0x242f8203, 0x00004c3a, 0x2013823a, 0x204f823b, 0x287f823c, 0x0000b03c, 0x0000343d, 0x200b823e, 
-    0x2007823f, 0x241b823f, 0x00000441, 0x207f8242, 0x248f8243, 0x0000e844, 0x200b8246, 0x204b8248, 0x20b78249, 0x24fb824a, 0x0000b84b, 0x2003824c, 
-    0x286b824e, 0x0000bc4f, 0x0000f851, 0x203f8253, 0x20df8253, 0x30178254, 0x0000cc55, 0x0000e056, 0x00002c58, 0x0000ec59, 0x201b825b, 0x203b825c, 
-    0x241b825d, 0x0000d05f, 0x244f8261, 0x0000f462, 0x28838263, 0x00002464, 0x00005865, 0x281f8266, 0x00005067, 0x0000a468, 0x24ef826a, 0x0000c86b, 
-    0x20b7826d, 0x240f826e, 0x00004070, 0x201f8271, 0x20378272, 0x20438274, 0x30078276, 0x00003077, 0x0000e477, 0x0000fc78, 0x0000747a, 0x20d7827c, 
-    0x24cb827d, 0x0000447e, 0x2093827e, 0x2023827f, 0x201f8280, 0x243b8282, 0x00004883, 0x288f8283, 0x00002885, 0x00008086, 0x24a78287, 0x0000188a, 
-    0x202f828c, 0x2867828f, 0x0000ac92, 0x00009095, 0x201f8298, 0x2097829a, 0x24cf829c, 0x000020a0, 0x201f82a3, 0x247f82a5, 0x000004a7, 0x24c382a8, 
-    0x00003ca9, 0x203f82aa, 0x28b382ac, 0x000034ad, 0x00009cae, 0x241b82b0, 0x000088b1, 0x201b82b3, 0x20af82b4, 0x247782b5, 0x00000cb7, 0x205382b8, 
-    0x247b82ba, 0x000084bb, 0x207b82bc, 0x289782be, 0x0000dcbf, 0x000098c0, 0x209782c2, 0x206b82c6, 0x2ca782c8, 0x00002ccb, 0x0000c0cd, 0x000078ce, 
-    0x24e382cf, 0x000038d0, 0x202f82d0, 0x24e782d1, 0x0000a0d2, 0x208382d3, 0x240382d4, 0x0000a8d5, 0x249382d7, 0x0000d4d8, 0x20ab82d9, 0x243782da, 
-    0x0000ecda, 0x20fb82db, 0x207b82dc, 0x205b82dc, 0x200b82dd, 0x245782de, 0x00008cdf, 0x207782e0, 0x203782e1, 0x202382e2, 0x20bb82e4, 0x201782e5, 
-    0x2cab82e7, 0x0000e8e7, 0x0000fce8, 0x000050ea, 0x285f82eb, 0x0000b4ec, 0x000000ee, 0x20b382ef, 0x202382f0, 0x203b82f1, 0x246382f2, 0x00006cf4, 
-    0x202382f6, 0x20ff82f7, 0x24cb82f8, 0x000010fa, 0x203f82fb, 0x087782fc, 0x0064fd25, 0x007cfe00, 0x00c4ff00, 0x00f80001, 0x007c0201, 0x00600401, 
-    0x008c0501, 0x00480701, 0x000c0801, 0x82080901, 0x00f43303, 0x00340b01, 0x00380c01, 0x00800d01, 0x00d80e01, 0x27821001, 0x00a81138, 0x00281301, 
-    0x00701401, 0x00cc1501, 0x00941701, 0x00581901, 0x23821b01, 0x00ec1b28, 0x00841c01, 0x27821d01, 0x003c1e24, 0x0b821f01, 0x0b822020, 0x4b822020, 
-    0x00a02131, 0x00742201, 0x00542301, 0x00902401, 0x825c2501, 0x00f02703, 0x00b42601, 0x03822701, 0x03822820, 0x00302a25, 0x82242b01, 0x00d02f03, 
-    0x00ac2c01, 0x00bc2d01, 0x002c2e01, 0x4b822f01, 0x00e42f24, 0x17823001, 0x00783124, 0x0b823201, 0x00983429, 0x004c3501, 0x826c3601, 0x20478203, 
-    0x24538238, 0x0100c839, 0x205f823a, 0x201b823b, 0x201b823c, 0x2477823c, 0x0100883d, 0x206b823e, 0x20bf823e, 0x20ab823f, 0x282f8240, 0x0100e840, 
-    0x01009c41, 0x201b8243, 0x28b78244, 0x01001445, 0x0100dc45, 0x28d38246, 0x0100fc46, 0x0100a447, 0x20338248, 0x208f8249, 0x202b8249, 0x209b824a, 
-    0x2c3b824b, 0x0100b04c, 0x0100084e, 0x0100104f, 0x20038250, 0x20378251, 0x20a78251, 0x2c9f8253, 0x01000054, 0x01000455, 0x0100c456, 0x203b8258, 
-    0x207f8259, 0x208b825a, 0x284f825a, 0x0100185c, 0x0100ec5c, 0x206b825e, 0x2053825f, 0x20bf825f, 0x28338261, 0x0100e061, 0x01005862, 0x204b8263, 
-    0x20bb8263, 0x20778264, 0x24178265, 0x01001c67, 0x24278268, 0x01002069, 0x2003826a, 0x2067826c, 0x2483826d, 0x0100cc6f, 0x20c78270, 0x20ef8272, 
-    0x20bb8274, 0x208f8276, 0x24138277, 0x0100d478, 0x242f827a, 0x0100f87b, 0x2087827d, 0x246f827f, 0x01002481, 0x20cf8282, 0x245b8284, 0x01007885, 
-    0x201f8287, 0x20638287, 0x20af8289, 0x2033828a, 0x2447828b, 0x01008c8c, 0x200b828e, 0x24078290, 0x0100a091, 0x20678292, 0x20178292, 0x28a78293, 
-    0x01007494, 0x01007c95, 0x20778296, 0x25cf8298, 0x01000c99, 0x03822c9a, 0x9b253f82, 0x9c0100b8, 0x23038268, 0x9d0100f4, 0x9e241f82, 0x9f01006c, 
-    0x9f243b82, 0xa00100a8, 0xa0203782, 0xa2209f82, 0xa3202b82, 0xa3208b82, 0xa4204382, 0xa52c8b82, 0xa5010050, 0xa60100fc, 0xa7010090, 0xa7240b82, 
-    0xa80100e4, 0xa9209f82, 0xa924ab82, 0xaa0100d0, 0xab205782, 0xac245382, 0xad010038, 0xae20b382, 0xaf243382, 0xb0010008, 0xb1207782, 0xb2245b82, 
-    0xb301001c, 0xb4201382, 0xb524c782, 0xb5010004, 0xb7243f82, 0xb80100a4, 0xb924b782, 0xba010098, 0xbb200b82, 0xbc245782, 0xbd010040, 0xbe203f82, 
-    0xbf248b82, 0xc0010058, 0xc1203f82, 0xc220bf82, 0xc2248b82, 0xc2010064, 0xc3209b82, 0xc4201b82, 0xc4202b82, 0xc5203782, 0xc6209382, 0xc7201382, 
-    0xc820d382, 0xcb209b82, 0xce209382, 0xd0200782, 0xd1206782, 0xd2248b82, 0xd40100e0, 0xd52c8782, 0xd60100cc, 0xd70100b0, 0xd8010078, 0xd920ef82, 
-    0xda2cb382, 0xdc0100dc, 0xde01008c, 0xdf010034, 0xe0209b82, 0xe1202f82, 0xe228a782, 0xe2010054, 0xe40100ec, 0xe5200f82, 0xe6207b82, 0xe7206782, 
-    0xe7204f82, 0xe8204b82, 0xe9255b82, 0xeb010080, 0x82038220, 0x82ec20f3, 0xd8ed3053, 0xc4ee0100, 0xb4ef0100, 0xbcf00100, 0x82f10100, 0x82f2209f, 
-    0x28f4245f, 0x82f40100, 0x82f52033, 0x82f7209b, 0xd4f82443, 0x82f90100, 0x82fa2017, 0x82fb20e3, 0x82fd202b, 0x82fe202b, 0xff300843, 0x0002004c, 
-    0x010200c8, 0x020200a0, 0x030200f8, 0x050200cc, 0x06020054, 0x0702003c, 0x08020090, 0x09020044, 0x0a020048, 0x0b020024, 0x0c0200f0, 0x0d242b82, 
-    0x0e020088, 0x10381b82, 0x1002000c, 0x120200d4, 0x1302008c, 0x1402002c, 0x15020060, 0x160200b0, 0x18204b82, 0x19203382, 0x1b242b82, 0x1c020004, 
-    0x1d290f82, 0x1f0200c0, 0x20020000, 0x82038238, 0xe8212417, 0x82230200, 0x82242013, 0x8425346f, 0xd8250200, 0xa4270200, 0xe4280200, 0x94290200, 
-    0x822a0200, 0x822c207f, 0x402d2853, 0x782f0200, 0x82300200, 0x8231201b, 0x2032243f, 0x82330200, 0x8234201b, 0x8235208f, 0x1036245b, 0x82370200, 
-    0x8238203f, 0xc0392447, 0x823a0200, 0x823c208b, 0x823d207b, 0x643f24b7, 0x823f0200, 0xac41249f, 0x82430200, 0x82442077, 0x8245202f, 0xb84624a3, 
-    0x82470200, 0x8248204f, 0x6c492457, 0x824a0200, 0x984b247b, 0x824c0200, 0x824d2003, 0x824e202b, 0x824f2007, 0x8250207b, 0x08512863, 0x50520200, 
-    0x82530200, 0x82542037, 0x5c55248b, 0x82560200, 0x82572087, 0x82582087, 0x82582007, 0xdc5924ef, 0x825b0200, 0x7c5c282f, 0x745d0200, 0x825e0200, 
-    0xfc5f2403, 0x82610200, 0x8262203f, 0x82632077, 0x8264201b, 0x14662473, 0x82670200, 0x8267200b, 0x8269201b, 0x826b202b, 0x186c247b, 0x826d0200, 
-    0x826e2063, 0x8270204f, 0x8271200b, 0x82722067, 0x507325bf, 0x1c740200, 0xe4270382, 0x94750200, 0x82770200, 0x82772037, 0x82782043, 0x827a206b, 
-    0xf07a24ff, 0x827c0200, 0x807d242f, 0x827d0200, 0x827f204f, 0x828020f7, 0x34812413, 0x82810200, 0x9c8224db, 0x82830200, 0x8284209b, 0x8285201b, 
-    0x82872003, 0xf488283b, 0xa08a0200, 0x828c0200, 0x828d204b, 0x828d2067, 0x828e2013, 0x648f2907, 0xc88f0200, 0x0c900200, 0x58200382, 0x0b820382, 
-    0x9f829120, 0x97829220, 0x23829220, 0x00789324, 0x4f829402, 0x97829520, 0xb3829620, 0x83829620, 0x67829820, 0x00309a25, 0x82989b02, 0x20578203, 
-    0x2493829c, 0x0200e09d, 0x20f3829e, 0x2043829e, 0x202f829e, 0x2527829e, 0x0200009f, 0x038228a0, 0x03825420, 0x0200b423, 0x245382a1, 0x02005ca1, 
-    0x247782a3, 0x0200a8a5, 0x201b82a6, 0x200f82a7, 0x201782a8, 0x205f82a9, 0x204b82a9, 0x240782ab, 0x0200c0ac, 0x208f82ad, 0x204b82ad, 0x20e782ae, 
-    0x204b82ae, 0x205b82af, 0x247f82af, 0x0200ccaf, 0x20c382b0, 0x24fb82b0, 0x0200d4b0, 0x207b82b1, 0x206f82b1, 0x206b82b2, 0x245782b2, 0x0200e8b2, 
-    0x20b382b3, 0x242782b3, 0x020020b4, 0x21df82b4, 0x0782a8b4, 0x0200f024, 0x038238b5, 0x03828c20, 0x0200e424, 0x038214b6, 0x02004424, 0x038210b7, 
-    0xb8204782, 0xb920f782, 0xba24ef82, 0xba02001c, 0xba205b82, 0xba20af82, 0xbb204b82, 0xbb250f82, 0xbb020050, 0x82038284, 0xecbb241f, 0x82bc0200, 
-    0x82bc2057, 0x88bc21d3, 0x13820b82, 0x2782bc20, 0x0040bd25, 0x8294bd02, 0x200b8203, 0x20ab82be, 0x208b82be, 0x209782be, 0x24bb82be, 0x020030bf, 
-    0x208382bf, 0x243b82bf, 0x02004cc0, 0x20df82c0, 0x25d782c1, 0x020070c1, 0x0382b0c1, 0xc2209b82, 0xc2281782, 0xc30200ac, 0xc40200f8, 0xc4250b82, 
-    0xc502007c, 0x23038204, 0xc6020034, 0xc6206b82, 0xc7206b82, 0xc7207782, 0x03bf1782, 0x7f82c820, 0x000cca24, 0xb382cb02, 0x00bccc24, 0xdb82ce02, 
-    0x0028d024, 0x5f82d102, 0xa382d120, 0x0010d328, 0x00a0d702, 0xbf82d802, 0x00ccd92c, 0x0038db02, 0x00a4dc02, 0x9f82de02, 0x1b82e020, 0x0078e224, 
-    0x3f82e402, 0xc382e520, 0x00d8e524, 0x2782e602, 0xcb82e920, 0x00fcea28, 0x00b4ec02, 0xc382ed02, 0x4b82ef20, 0x0094f024, 0x3782f102, 0x0048f224, 
-    0x0b82f302, 0xc382f420, 0x00c8f425, 0x8234f602, 0x00c42703, 0x0090f702, 0x7f82f802, 0xe782fa20, 0x0000fb24, 0x0b82fc02, 0x0008fd24, 0x0f82fe02, 
-    0x003cff29, 0x0084ff02, 0x82080003, 0x00b02403, 0x82180103, 0x82482003, 0x00b82303, 0x13820303, 0x00700429, 0x00440503, 0x820c0603, 0x00f82403, 
-    0x82280703, 0x82942003, 0x00ec2403, 0x824c0803, 0x82a42003, 0x00d82703, 0x00240903, 0x2b820a03, 0x17820a20, 0x00c00b28, 0x00000c03, 0x0f820d03, 
-    0x17820f20, 0x00880f28, 0x00dc1103, 0x37821203, 0x00a0132c, 0x00fc1303, 0x00981403, 0x4b821503, 0x00101624, 0x7f821603, 0x00401729, 0x00f01703, 
-    0x82501803, 0x00e42f03, 0x00d41903, 0x005c1a03, 0x001c1b03, 0x97821d03, 0x47821e20, 0x006c1e24, 0x97821e03, 0x8b821f20, 0x2f821f20, 0x008c1f30, 
-    0x00802003, 0x009c2103, 0x00382303, 0x73822403, 0x00582524, 0x53822603, 0x07832620, 0x0300b423, 0x208b8227, 0x20378228, 0x28538229, 0x0300c42a, 
-    0x0300f42a, 0x242b822c, 0x0300ac2d, 0x2017822e, 0x2c33822f, 0x0300e82f, 0x03006830, 0x03002031, 0x20938232, 0x20838233, 0x20278233, 0x20578234, 
-    0x20fb8235, 0x28978235, 0x0300d036, 0x03000838, 0x20778239, 0x205b823a, 0x283f823b, 0x0300643d, 0x0300783e, 0x208f823f, 0x243b8240, 0x0300c840, 
-    0x242f8241, 0x0300a842, 0x20978243, 0x20278244, 0x205f8245, 0x242b8245, 0x03004846, 0x24578247, 0x0300cc47, 0x20938248, 0x249b8249, 0x0300a04a, 
-    0x2027824b, 0x209b824d, 0x2443824f, 0x03007450, 0x203f8251, 0x248f8251, 0x03005452, 0x29278252, 0x03005c53, 0x0300f853, 0x03829454, 0x55248782, 
-    0x5603004c, 0x56315382, 0x570300b0, 0x58030090, 0x59030070, 0x5a030084, 0x24038288, 0x5b0300d4, 0x8203821c, 0x405c246f, 0x825c0300, 0x825c2017, 
-    0x825d20f3, 0x825d2053, 0xb85e284b, 0xa45f0300, 0x82600300, 0x82602023, 0x8261204f, 0x8262206f, 0x8263203f, 0x60642427, 0x82650300, 0x10662427, 
-    0x82660300, 0x826720fb, 0xbc6724bb, 0x82680300, 0x82682047, 0x24692443, 0x82690300, 0x9c6a2427, 0x826b0300, 0x826c205f, 0x826e204f, 0x826f20a3, 
-    0x82702077, 0xd0712527, 0x68720300, 0xd8230382, 0x82730300, 0xe4732557, 0x48740300, 0x2b820382, 0xdb827520, 0x47827520, 0x17827520, 0xdb827520, 
-    0xd3827620, 0x00187724, 0x4f827703, 0x00387824, 0x17827803, 0x43827820, 0x007c7928, 0x00e07903, 0x87827a03, 0x7f827b20, 0x03837c20, 0x7d20d382, 
-    0x7d20f382, 0x7e29bb82, 0x7e030028, 0x7f0300a8, 0x2303822c, 0x800300ec, 0x8120c382, 0x81202b82, 0x8220af82, 0x83201782, 0x84205782, 0x85206782, 
-    0x86252782, 0x87030034, 0x8203823c, 0x08882497, 0x82880300, 0x78882117, 0xb0230782, 0x82890300, 0x8289201b, 0xfc8925b7, 0x808a0300, 0x63820382, 
-    0xab828b20, 0xdb828b20, 0x00f08b24, 0x53828c03, 0x82988c21, 0x20638207, 0x2037828d, 0x2467828d, 0x0300608e, 0x20db828e, 0x207b828f, 0x2033828f, 
-    0x20938290, 0x20938290, 0x24db8291, 0x0300c891, 0x20538292, 0x207f8292, 0x20738293, 0x244b8294, 0x03001495, 0x24338295, 0x03005096, 0x20df8297, 
-    0x20cb8298, 0x20f38299, 0x20578299, 0x251b829a, 0x03006c9a, 0x0382009b, 0x9c20f382, 0x9c244382, 0x9c030064, 0x9d24fb82, 0x9d030054, 0x9e207782, 
-    0x9f208b82, 0x9f242782, 0xa003008c, 0xa020bf82, 0xa124af82, 0xa103001c, 0xa220bf82, 0xa2245f82, 0xa30300dc, 0xa4201b82, 0xa620fb82, 0xa7242782, 
-    0xa7030068, 0xa8203f82, 0xa8204f82, 0xa9241382, 0xa9030090, 0xaa20df82, 0xaa201782, 0xab20b782, 0xab248382, 0xac0300e8, 0xad20bb82, 0xad24ab82, 
-    0xae0300a8, 0xaf208f82, 0xaf207b82, 0xb0205382, 0xb1209f82, 0xb224eb82, 0xb2030028, 0xb3282b82, 0xb3030010, 0xb40300ac, 0xb4200782, 0xb5200f82, 
-    0xb5208382, 0xb62c6f82, 0xb6030030, 0xb70300d4, 0xb8030070, 0xb9200382, 0xba200382, 0xbb241782, 0xbb0300a4, 0xbc20b782, 0xbc205b82, 0xbd200b82, 
-    0xbd249382, 0xbd03005c, 0xbe200b82, 0xbe200b82, 0xbe207782, 0xbf209782, 0xbf20e782, 0xc0200782, 0xc1201782, 0xc1202b82, 0xc2209b82, 0xc2202782, 
-    0xc320ab82, 0xc420bb82, 0xc4248f82, 0xc50300a0, 0xc5253382, 0xc60300c0, 0x8203824c, 0x82c7202f, 0xf8c72837, 0x94c80300, 0x82c90300, 0xf0c924ff, 
-    0x82ca0300, 0x6ccb241f, 0x82cb0300, 0x82cc20d7, 0x82cc201f, 0x78cd247f, 0x82cd0300, 0xc4ce242f, 0x82cf0300, 0x82d020cf, 0x82d0204f, 0x82d1204f, 
-    0x98d125c7, 0x04d20300, 0x37820382, 0xff82d320, 0x6f82d420, 0xf782d520, 0x0060d624, 0x1782d703, 0x0088d728, 0x0090d803, 0x0782d903, 0x00e4d924, 
-    0x3f82da03, 0x82b8da21, 0x206b8207, 0x20e782db, 0x20b382db, 0x248382db, 0x03002cdc, 0x20cf82dc, 0x253f82dd, 0x0300ccdd, 0x03821cde, 0xdf256382, 
-    0xdf030028, 0x20038268, 0x820382b4, 0x82e02033, 0x82e02027, 0xace0240f, 0x82e00300, 0x82e12093, 0x9ce124cb, 0x82e10300, 0x82e2205b, 0x50e2242b, 
-    0x82e20300, 0x20e3245f, 0x82e30300, 0x82e3205f, 0x82e420b3, 0x82e520bf, 0x82e52037, 0x82e620cb, 0x5ce72c37, 0x34e80300, 0x18e90300, 0x82ea0300, 
-    0x82eb2017, 0x82ec2037, 0x82ed2053, 0x8ced2cd7, 0x14ee0300, 0x00ef0300, 0x82f00300, 0x82f1205b, 0x48f224e3, 0x82f30300, 0x82f4200f, 0x82f52027, 
-    0x64f628db, 0xbcf60300, 0x82f70300, 0x82f72027, 0xd8f724d7, 0x82f80300, 0x82f8206f, 0xb0f82143, 0xcf820b82, 0xe782f920, 0x0084f929, 0x00dcf903, 
-    0x823cfa03, 0x200b8203, 0x20d782fa, 0x202782fb, 0x248f82fb, 0x0300d0fb, 0x204f82fc, 0x20f382fc, 0x243f82fc, 0x030030fd, 0x204b82fd, 0x242f82fd, 
-    0x030024fe, 0x20bb82fe, 0x20c782fe, 0x252382ff, 0x0400acff, 0x03822000, 0x03829420, 0x0400e024, 0x03826801, 0x0400d830, 0x04009803, 0x04008006, 
-    0x04006c08, 0x03820009, 0x0400f023, 0x2417820a, 0x0400a40b, 0x2523820c, 0x0400340d, 0x0382080e, 0x03827820, 0x0400d423, 0x081f820f, 0x00b41024, 
-    0x00c41104, 0x00f41204, 0x001c1404, 0x00301504, 0x00901604, 0x00ec1704, 0x00381904, 0x00d01a04, 0x2f821b04, 0x00141c24, 0x07821d04, 0x002c1e24, 
-    0x2b821e04, 0x007c1f28, 0x00f81f04, 0x57822004, 0x4b822020, 0x8f822120, 0x13822120, 0x6b822120, 0x93822120, 0x00182225, 0x82502204, 0x20a38203, 
-    0x200f8222, 0x20578223, 0x209f8223, 0x252b8223, 0x04000c24, 0x03826424, 0x0382b020, 0x0400e423, 0x20678225, 0x25d38225, 0x04000426, 0x03825c26, 
-    0x27209382, 0x27202382, 0x28204b82, 0x28201382, 0x28242b82, 0x290400e8, 0x2921d782, 0x820782a0, 0x9c2a247f, 0x822b0400, 0x822b2037, 0x822c200f, 
-    0x822c209b, 0x442d24e7, 0x822d0400, 0x822e20cb, 0x822e2007, 0x822f204f, 0xc82f2493, 0x82300400, 0x8230203f, 0x82312067, 0x82312007, 0x823220b3, 
-    0x823320df, 0x8233209b, 0x8834248f, 0x82350400, 0x74352163, 0x57820782, 0x23823620, 0x00cc3625, 0x82403704, 0x28878203, 0x04001c38, 0x0400dc38, 
-    0x204f8239, 0x201f8239, 0x20ef823a, 0x2703833b, 0x3e0400fc, 0x3f040010, 0x40241f82, 0x43040000, 0x44204382, 0x4520f382, 0x47207382, 0x47205f82, 
-    0x48208782, 0x48240f82, 0x4904008c, 0x49211f82, 0x82078270, 0x824a20a3, 0x824b203b, 0x824b2037, 0x584c245b, 0x824c0400, 0x824d2047, 0xb84d241b, 
-    0x824e0400, 0x824e20f3, 0x824e2077, 0x824e2023, 0x824e2037, 0x824e2043, 0x344f24b7, 0x824f0400, 0x824f2013, 0x824f200f, 0x825020bf, 0x8250201b, 
-    0x2451254b, 0x48510400, 0x1b820382, 0x829c5121, 0x20b78207, 0x20a38251, 0x24778252, 0x04004452, 0x21cb8252, 0x0782b052, 0x53244382, 0x53040028, 
-    0x53206f82, 0x53209b82, 0x53206b82, 0x54201382, 0x5424bb82, 0x54040078, 0x55205782, 0x55259382, 0x5504006c, 0x820382a0, 0x50562463, 0x82560400, 
-    0x8257203b, 0xbc57247b, 0x82580400, 0x825820d7, 0x2c592877, 0xd4590400, 0x825a0400, 0x845a2107, 0xdc230782, 0x825b0400, 0x825b2023, 0x825b201b, 
-    0x3c5c2553, 0x945c0400, 0xec230382, 0x825d0400, 0x825d2083, 0x825d2097, 0x825e2093, 0x825f2067, 0x825f20df, 0x8260200f, 0x8260204b, 0x826120ff, 
-    0x8261201f, 0x826220b3, 0x8262206b, 0x82632047, 0xf063287f, 0x80640400, 0x82650400, 0x9865248f, 0x82660400, 0x82662033, 0xe066250f, 0x40670400, 
-    0x37820382, 0xcb826820, 0x6f826820, 0x00006925, 0x82746904, 0x208f8203, 0x2483826a, 0x0400a86a, 0x24d3826b, 0x04007c6b, 0x2023826c, 0x2517826c, 
-    0x0400706d, 0x0382086e, 0x6f20d782, 0x6f209b82, 0x70295f82, 0x710400ac, 0x72040060, 0x82038214, 0x4c7324e3, 0x82730400, 0xa47424f3, 0x82750400, 
-    0x88752163, 0xd0240782, 0x18760400, 0x64200382, 0xa3820382, 0x5f827720, 0xbb827720, 0x97827820, 0x23827820, 0x57827820, 0x23827820, 0x00047924, 
-    0x3f827904, 0xa3827920, 0x00c87924, 0x0f827a04, 0xcf827a20, 0x82847a21, 0x201f820b, 0x2943827b, 0x0400907b, 0x0400d87b, 0x0382547c, 0x7c201782, 
-    0x7e204f82, 0x81208f82, 0x8124a782, 0x840400fc, 0x8628e382, 0x87040048, 0x880400dc, 0x89202b82, 0x89202382, 0x8a200b82, 0x8b20eb82, 0x8c203782, 
-    0x8d249b82, 0x8d040030, 0x8d206382, 0x8e20af82, 0x8e254782, 0x8f0400f4, 0x82038224, 0xe88f24b3, 0x82900400, 0x829020d3, 0x82912007, 0x8291201b, 
-    0xd49125a7, 0x1c920400, 0x8c230382, 0x82930400, 0x8293205b, 0x8294208b, 0x8295200b, 0xb895256b, 0x44960400, 0x4b820382, 0x00789728, 0x00f09704, 
-    0x0f829804, 0x4b829820, 0xc3829820, 0x007c9924, 0x73829904, 0x005c9a25, 0x82009b04, 0x00882303, 0x13829c04, 0x57829c20, 0xbb829c20, 0x2f829c20, 
-    0x00209d24, 0x0b829d04, 0xa7829e20, 0xff829f20, 0x8f829f20, 0x5f82a020, 0x1782a120, 0x0038a224, 0x6f82a204, 0x3f82a320, 0x2382a320, 0x0074a424, 
-    0x4f82a404, 0x00a8a529, 0x0094a604, 0x8210a704, 0x2d178203, 0x040070a8, 0x0400eca8, 0x040058aa, 0x038268ab, 0x0400fc23, 0x201782ac, 0x283b82ad, 
-    0x0400bcae, 0x040090af, 0x24cf82b0, 0x040018b1, 0x20fb82b2, 0x204782b4, 0x203f82b5, 0x20f782b7, 0x2c8b82b9, 0x04006cbb, 0x0400c4bc, 0x04003cbd, 
-    0x282b82be, 0x0400d8bf, 0x040084c0, 0x20d382c1, 0x208b82c2, 0x2c5782c3, 0x0400e4c3, 0x040064c4, 0x040004c5, 0x24a782c6, 0x040014c7, 0x242f82c8, 
-    0x04001cc9, 0x244782ca, 0x04000ccb, 0x206b82cb, 0x2c4f82cc, 0x0400b8cd, 0x040060ce, 0x04002ccf, 0x209b82d0, 0x206f82d1, 0x281382d2, 0x040034d4, 
-    0x040044d5, 0x207b82d6, 0x203782d8, 0x244382d9, 0x040088da, 0x24cf82dc, 0x040028de, 0x203382df, 0x24f382e0, 0x0400ace0, 0x20f382e1, 0x203b82e2, 
-    0x20cb82e2, 0x205382e3, 0x248b82e4, 0x0400dce4, 0x24e782e5, 0x040098e6, 0x209782e7, 0x286f82e8, 0x040020ea, 0x0400b0eb, 0x200382ec, 0x202b82ed, 
-    0x205b82ee, 0x20f782ef, 0x20bf82f0, 0x281b82f1, 0x0400f0f1, 0x0400ccf2, 0x246b82f3, 0x04007cf4, 0x21cb82f5, 0x0782a4f5, 0x0400f423, 0x21bf82f7, 
-    0x0782b4f7, 0xf820db82, 0x0384f782, 0x0400e823, 0x2cb782f9, 0x01002efa, 0xfe050000, 0x1e00a900, 0x2c008300, 0x009a0002, 0x007700aa, 0x0b620100, 
-    0x82108388, 0x011b2203, 0x8225834a, 0x00002209, 0x82058264, 0x20058431, 0x850d8204, 0x0002240b, 0x86680007, 0x00032423, 0x866f001f, 0x0004240b, 
-    0x868e000c, 0x0005220b, 0x855b8260, 0x8206202f, 0x86fa2017, 0x00082417, 0x86060114, 0x8209200b, 0x861a200b, 0x000b230b, 0x9d840125, 0x0c206b82, 
-    0x53200b82, 0x0d241786, 0x7801a715, 0x0e240b86, 0x1f173c00, 0x122a0b86, 0x5b170c00, 0x01000300, 0x31820904, 0x6717c822, 0x01240b86, 0x2f180800, 
-    0x02240b86, 0x37180e00, 0x03240b86, 0x45183e00, 0x04240b86, 0x83181800, 0x05240b86, 0x9b18c000, 0x06230b86, 0x87191800, 0x00082453, 0x86731928, 
-    0x82092017, 0x2423870b, 0x194a000b, 0x241786c3, 0x1a4a000c, 0x240b860d, 0x1a4e2b0d, 0x080b8657, 0x78000e2e, 0x6f43a545, 0x69727970, 0x20746867, 
-    0x20296328, 0x35313032, 0x72684320, 0x6f747369, 0x72656870, 0x6d695320, 0x6e696b70, 0x202f2073, 0x303a298f, 0x79622033, 0x74694220, 0x65727473, 
-    0x202c6d61, 0x2e636e49, 0x6c6c4120, 0x4f835220, 0x52207335, 0x72657365, 0x2e646576, 0x6b636148, 0x75676552, 0x8a72616c, 0x215a875b, 0x1f83203a, 
-    0x7b843a20, 0x37820983, 0x56292a84, 0x69737265, 0x32206e6f, 0x2b94822e, 0x7474203b, 0x74756166, 0x6e69686f, 0x7635aa82, 0x29332e31, 0x206c2d20, 
-    0x722d2034, 0x20303820, 0x3320472d, 0x21068235, 0x04822078, 0x3120482f, 0x2d203138, 0x616c2044, 0x2d206e74, 0x2e078666, 0x20472077, 0x2d20572d, 
-    0x582d2074, 0x83222220, 0x912d206b, 0x41f28896, 0x68381306, 0x73707474, 0x672f2f3a, 0x75687469, 0x6f632e62, 0x68632f6d, 0x73736972, 0x20062641, 
-    0xa454832f, 0x41e98424, 0x32200952, 0x2c20e382, 0x20157941, 0x416b8277, 0x2022084b, 0xff826f46, 0x6d614e24, 0xc0842065, 0x0a2e2223, 0x0882410a, 
-    0x6556202e, 0x53206172, 0x20736e61, 0x6f6e6f4d, 0x230ab141, 0x33303032, 0x4109aa41, 0x613505a9, 0x6c20646e, 0x6e656369, 0x20646573, 0x65646e75, 
-    0x68742072, 0x84258a65, 0x854c204d, 0x96202021, 0x20732285, 0x217e8822, 0x52832022, 0x36832220, 0x0a0a2234, 0x616a6544, 0x6d207556, 0x6669646f, 
-    0x74616369, 0x96826f69, 0x84666f21, 0x726f2763, 0x6e696769, 0x6c8f6c61, 0x7439ba89, 0x66657079, 0x20656361, 0x65766168, 0x65656220, 0x6f63206e, 
-    0x74696d6d, 0x21ac8274, 0x45846f74, 0x62757022, 0x202ebf82, 0x616d6f64, 0x0a2e6e69, 0x68540a0a, 0x20417369, 0x6f532805, 0x61777466, 0x82206572, 
-    0x26e39210, 0x6b636148, 0x82704f20, 0x6f462454, 0x8720746e, 0x327623e3, 0xc384302e, 0x82190741, 0x68542466, 0x41657365, 0x73210739, 0x23658320, 
-    0x69706f63, 0x62249782, 0x776f6c65, 0x0a372182, 0x4b434148, 0x45504f20, 0x4f46204e, 0x4c20544e, 0x4e454349, 0x83204553, 0x0a0a225f, 0x07d84228, 
-    0x6d823120, 0x30202d33, 0x65532036, 0x6d657470, 0x20726562, 0x35313032, 0x83228a29, 0x202d2390, 0x22913732, 0x220d3a42, 0x42796220, 0x8f43143c, 
-    0x0a350815, 0x4645440a, 0x54494e49, 0x534e4f49, 0x41220a0a, 0x6f687475, 0x72202272, 0x72656665, 0x6f742073, 0x796e6120, 0x73656420, 0x656e6769, 
-    0x65202c72, 0x6e69676e, 0x27098365, 0x676f7270, 0x6d6d6172, 0x742d0b83, 0x6e686365, 0x6c616369, 0x69727720, 0x25bc8274, 0x6f20726f, 0x08826874, 
-    0x45827020, 0x206e6f2e, 0x206f6877, 0x746e6f63, 0x75626972, 0x200ab641, 0x20128246, 0x07a04120, 0x0a0a2e29, 0x4d524550, 0x82535349, 0x4120288b, 
-    0x4320444e, 0x87444e4f, 0x65502799, 0x73696d72, 0x4c826973, 0x20736922, 0x65205a82, 0x8082e782, 0x4e826e20, 0x66202c30, 0x20656572, 0x6320666f, 
-    0x67726168, 0xb7872c65, 0x6f2a7d86, 0x69617462, 0x676e696e, 0x85826120, 0x83797021, 0x219d8229, 0x7e826620, 0x61207327, 0x6d6f6363, 0x83e68270, 
-    0x68742120, 0x22092642, 0x83222820, 0x227338a0, 0x6e612029, 0x73612064, 0x69636f73, 0x64657461, 0x756f7320, 0x82656372, 0x8264204b, 0x6f64296b, 
-    0x656d7563, 0x7461746e, 0x2c209c82, 0x622d2a84, 0x72616e69, 0x69662079, 0x2073656c, 0x846a8328, 0x21ea8849, 0xa2842922, 0x70657228, 0x75646f72, 
-    0x34846563, 0x73696422, 0x20061f41, 0x43318320, 0xe7420d2d, 0x0edf4306, 0x270c3f41, 0x6e69202c, 0x64756c63, 0x772bc683, 0x6f687469, 0x6c207475, 
-    0x85696d69, 0x20538498, 0x058d4572, 0x75214c82, 0x25b98273, 0x64757473, 0xc6822c79, 0x05827020, 0x72656d23, 0x25138267, 0x65626d65, 0xab432c64, 
-    0x21158205, 0x96896572, 0x2f27db84, 0x7320726f, 0x856c6c65, 0x65692321, 0x10822064, 0x856e7521, 0x230d82ad, 0x69706f63, 0xdd43f482, 0x23a08e06, 
-    0x20646e61, 0x70227c82, 0x96827265, 0x9d412020, 0x83732005, 0x68772311, 0xa1846d6f, 0x202a308c, 0x66207369, 0x696e7275, 0xea436873, 0x6f642d05, 
-    0x2c6f7320, 0x62757320, 0x7463656a, 0xc6413883, 0x6c6c2305, 0xf683776f, 0x6e6f6339, 0x69746964, 0x3a736e6f, 0x31280a0a, 0x68542029, 0x62612065, 
-    0x8465766f, 0x24fe84e4, 0x746f6e20, 0x06724169, 0x82687421, 0x428d8461, 0x1a860559, 0x61687322, 0x6221e082, 0x06504165, 0x69227b82, 0x1283206e, 
-    0xc883e588, 0x2020f4a5, 0x2107be44, 0x8d832e73, 0x86657321, 0x2073257f, 0x206e6163, 0x6521638b, 0x26cc8269, 0x73612072, 0x82747320, 0x612d2a5f, 
-    0x656e6f6c, 0x78657420, 0x05484274, 0x68202c31, 0x6e616d75, 0x6165722d, 0x6c626164, 0x82682065, 0x72652508, 0x726f2073, 0x2020a882, 0x20333c82, 
-    0x72707061, 0x6972706f, 0x20657461, 0x6863616d, 0x89656e69, 0x656d222e, 0x21388274, 0x4d826174, 0x646c6525, 0x82772073, 0x84d7826f, 0x42428260, 
-    0x84820cb3, 0x67217d82, 0x22078220, 0x826f6874, 0x696621b4, 0xb3863384, 0x7361652f, 0x20796c69, 0x77656976, 0x62206465, 0x287c8479, 0x72657375, 
-    0x280a0a2e, 0x05764132, 0x220dc941, 0x8379616d, 0x074041ec, 0x61202c29, 0x7265746c, 0x832c6465, 0x646122bd, 0x21468264, 0x15826f74, 0x83646e21, 
-    0x617028cb, 0x63697472, 0x46616c75, 0x7e440587, 0x20732905, 0x6720666f, 0x6870796c, 0x6325f284, 0x61726168, 0x20448263, 0x83fd8773, 0x82732071, 
-    0x21698cf7, 0x52826120, 0x69266082, 0x6e6f6974, 0x40956c61, 0x87879d86, 0x20088942, 0x209e8273, 0x20e8826e, 0x05ab4669, 0x27062f44, 0x72206572, 
-    0x6d616e65, 0x2020b384, 0x73280883, 0x746f6e20, 0x6e6f6320, 0x27076744, 0x20656874, 0x64726f77, 0x24099947, 0x20293328, 0x06e2414e, 0x1e411d83, 
-    0x6f6e220d, 0x20a88272, 0x21e18379, 0xd0837469, 0x76696425, 0x82756469, 0x6f6328af, 0x6e6f706d, 0x82746e65, 0x6e69228b, 0x082e4720, 0x8d423082, 
-    0x65762308, 0xdd827372, 0xc8862182, 0x6c6f7327, 0x79622064, 0x304b8220, 0x2e666c65, 0x45540a0a, 0x4e494d52, 0x4f495441, 0x061b474e, 0x22060a47, 
-    0x82656220, 0x82652061, 0x6c7522c0, 0x2682826c, 0x6f762064, 0x82206469, 0x6e6121f0, 0x43082745, 0x5c430741, 0x61202307, 0xf1846572, 0x74656d22, 
-    0x48215c83, 0x05dc4645, 0x464f5337, 0x52415754, 0x53492045, 0x4f525020, 0x45444956, 0x41222044, 0x2a0f8253, 0x57202c22, 0x4f485449, 0x82205455, 
-    0x52230821, 0x59544e41, 0x20464f20, 0x20594e41, 0x444e494b, 0x5845202c, 0x53455250, 0x524f2053, 0x504d4920, 0x8245494c, 0x4e492a13, 0x44554c43, 
-    0x20474e49, 0x28378242, 0x20544f4e, 0x494d494c, 0x21548254, 0x3a844f54, 0x49214a86, 0x26378245, 0x454d2046, 0x82484352, 0x42412c59, 0x54494c49, 
-    0x46202c59, 0x834e5449, 0x82462053, 0x20413354, 0x54524150, 0x4c554349, 0x50205241, 0x4f505255, 0x43824553, 0x4e204428, 0x4e494e4f, 0x65825246, 
-    0x454d4524, 0x9583544e, 0x504f4329, 0x47495259, 0x822c5448, 0x82542034, 0x202c2b14, 0x44415254, 0x52414d45, 0xa1832c4b, 0x48544f25, 0x84205245, 
-    0x202e2322, 0x43824e49, 0x56452022, 0x20262782, 0x4c414853, 0x1d82204c, 0x43882020, 0x4f482024, 0x2d82444c, 0x82454221, 0x424124bd, 0x8420454c, 
-    0x2bf8828e, 0x49414c43, 0x44202c4d, 0x47414d41, 0x5221c183, 0x21578520, 0xc188494c, 0x20090141, 0x2d308241, 0x454e4547, 0x2c4c4152, 0x45505320, 
-    0x08834943, 0x444e4926, 0x43455249, 0x2982a882, 0x82444921, 0x82158382, 0x4f4326ee, 0x5145534e, 0x82108255, 0x24628727, 0x4857202c, 0x82ba8445, 
-    0x4e4128b3, 0x54434120, 0x854e4f49, 0x824e20f1, 0x234783e1, 0x54524f54, 0x5730e288, 0x2c455349, 0x49524120, 0x474e4953, 0x4f524620, 0x4f21ae82, 
-    0x201f8255, 0x22e38446, 0x83455355, 0x4e49212a, 0x2023af86, 0x83204f54, 0x42628213, 0x91820e10, 0xe0863d83, 0x41454423, 0x2150824c, 0x86822053, 
-    0x2e2b2b90, 0x78450a0a, 0x74706563, 0x43736120, 0x81450752, 0x68742305, 0x3d457369, 0x202c2406, 0x43656874, 0x6f21067a, 0x14ef4866, 0x4808bd49, 
-    0x282205d2, 0xf6472973, 0x0d7a4307, 0x2805ec45, 0x20746f6e, 0x75206562, 0x05d44373, 0x6f72702f, 0x65746f6d, 0x6e65202c, 0x73726f64, 0x05a54465, 
-    0x72657624, 0x0c826974, 0x796e6122, 0x4309fe46, 0x2a82067c, 0x742db585, 0x6361206f, 0x776f6e6b, 0x6764656c, 0x48a78465, 0x692208f9, 0x87866e6f, 
-    0x9313514c, 0x207225b1, 0x68746977, 0x69334583, 0x78652072, 0x63696c70, 0x77207469, 0x74746972, 0x46206e65, 0x2e3409ba, 0x6f462020, 0x75662072, 
-    0x65687472, 0x6e692072, 0x6d726f66, 0x83069148, 0x63612c7e, 0x63203a74, 0x73697268, 0x48746120, 0x662806bf, 0x646e756f, 0x64207972, 0x6f24fb82, 
-    0x0a2e6772, 0x422d0082, 0x54535449, 0x4d414552, 0x52455620, 0x07ae4a41, 0x4d0a0a21, 0xd84b39f1, 0x2c81830f, 0x61727420, 0x616d6564, 0x6f206b72, 
-    0x0f374e66, 0x490a0a21, 0xde498ceb, 0x3dd2490c, 0x490c7842, 0x632131ae, 0x0aa7496f, 0x62757028, 0x6873696c, 0x9f49202c, 0x89884917, 0x22138449, 
-    0x42646e61, 0x6e260a04, 0x6369746f, 0x00437365, 0x2d934906, 0x6f29e789, 0x6f20656e, 0x6f6d2072, 0x47078272, 0x714105b1, 0x0a8a490c, 0x830a0a21, 
-    0x481d8d94, 0x8b48eea2, 0x6f77230a, 0xbd4f6472, 0x496f200d, 0xc2480578, 0x65562505, 0x2e226172, 0x4f063748, 0x37480720, 0x06a64c15, 0x74786531, 
-    0x20746e65, 0x6c707061, 0x62616369, 0x8220656c, 0x059e4918, 0x76415982, 0x6874270d, 0x68207461, 0xd94f7361, 0x0c614b05, 0x42736921, 0x98500add, 
-    0x0968500b, 0x9c842020, 0x84050946, 0x4f6520a2, 0x11490ef5, 0x3164820b, 0x74726170, 0x20666f20, 0x616c2061, 0x72656772, 0x1e507320, 0x61702d07, 
-    0x67616b63, 0x75622065, 0x6f6e2074, 0x4208274e, 0x794a2954, 0x117c4907, 0x011f0910, 0x0964460f, 0x20524f37, 0x20454854, 0x4d4f4e47, 0x4f462045, 
-    0x41444e55, 0x4e4f4954, 0x2c091020, 0x47245b01, 0x656d6f6e, 0x84054049, 0x4620250a, 0x646e756f, 0x500abd50, 0x49250964, 0x2c2e636e, 0x11214920, 
-    0x206e6924, 0x0d496461, 0x6e692405, 0x516f2067, 0x772706ed, 0x20657369, 0x49206f74, 0x2027063d, 0x20656874, 0x826c6173, 0x4975206c, 0x13520542, 
-    0x65642305, 0x36826c61, 0x5306b74d, 0xbb5010a7, 0x72702207, 0x48588269, 0x612707ea, 0x6f687475, 0x847a6972, 0x662022a7, 0x062f5072, 0x8b83c18f, 
-    0x722cbf8f, 0x65707365, 0x76697463, 0x2e796c65, 0x4d222649, 0x742606e6, 0x6f6e6720, 0x1e49656d, 0x24cb5508, 0x6c622f2c, 0x6d2f626f, 0x65747361, 
-    0xec532f72, 0x6d2e2206, 0x0bcc5664, 0x00430039, 0x0070006f, 0x00720079, 0x00670069, 0x00740068, 0x00280020, 0x82290063, 0x00322607, 0x00310030, 
-    0x20098235, 0x83198243, 0x82732021, 0x222f831f, 0x82650068, 0x00202231, 0x20358253, 0x203f826d, 0x2207826b, 0x8273006e, 0x842f2029, 0x22539d2d, 
-    0x82330030, 0x82622025, 0x00202275, 0x20398242, 0x20398274, 0x264f8274, 0x00610065, 0x822c006d, 0x0049221b, 0x2083826e, 0x2209822e, 0x826c0041, 
-    0x00202201, 0x839f8852, 0x82522065, 0x8473207f, 0x82762083, 0x00642405, 0x8248002e, 0x0063223b, 0x2027826b, 0x20c78265, 0x20338275, 0x95518261, 
-    0x20b58fb7, 0x8767823a, 0x870b833f, 0x831387f7, 0x20558b7d, 0x20798456, 0x20918273, 0x22a7826f, 0x82320020, 0x0529417f, 0x49823b20, 0x74007424, 
-    0x8d826600, 0x07827520, 0x68006f22, 0x6e202582, 0x20260982, 0x76002800, 0x29823100, 0x29003322, 0x2d202582, 0x3420d584, 0x72200984, 0x38220582, 
-    0x0b843000, 0x05824720, 0x35003322, 0x78200d86, 0x17850d82, 0x09824820, 0x38003122, 0x20244182, 0x44002d00, 0x6c200d82, 0x74206382, 0x2d207f84, 
-    0x20206f82, 0x61214f82, 0x200f8700, 0x831f8277, 0x002d2249, 0x20098257, 0x227f842d, 0x8258002d, 0x0022220b, 0x082b4122, 0x2d412d20, 0x11e54124, 
-    0x91155541, 0x82682027, 0x00742877, 0x00730070, 0x822f003a, 0x00672201, 0x2c118269, 0x00750068, 0x002e0062, 0x006f0063, 0x2015826d, 0x085b4263, 
-    0x4d427320, 0x882f200e, 0x4149c9a9, 0xf94209d3, 0x07f94113, 0xf3422c20, 0x8677202c, 0x052742d7, 0x220b9742, 0x82460020, 0x05ff41e5, 0x61004e22, 
-    0x6520ef82, 0x81415982, 0x00222409, 0x820a002e, 0x11054301, 0x42002021, 0x61200565, 0x53202f82, 0x5d433982, 0x844d2005, 0x436f204d, 0xbd831663, 
-    0x33003022, 0x4f931d82, 0x24095343, 0x006e0061, 0x20258264, 0x22b7826c, 0x82650063, 0x83b3830d, 0x84752011, 0x05db4319, 0x68007422, 0xa1431b82, 
-    0x209b8b13, 0x21438c4c, 0x0b410020, 0x8273202d, 0x44222085, 0x22201203, 0xa5871782, 0x09412220, 0x00222208, 0x2001820a, 0x22958244, 0x8261006a, 
-    0x82752015, 0x006d2225, 0x22cb826f, 0x84660069, 0x00612287, 0x06954374, 0x6f205983, 0x20201582, 0xc7851182, 0xe3446f20, 0x82692006, 0x006122e3, 
-    0x1625416c, 0x241d7541, 0x00790074, 0x207f8270, 0x207f8266, 0x22078263, 0x82680020, 0x84762009, 0x82622009, 0x82652005, 0x4220205b, 0x6d2006d9, 
-    0x74208982, 0x65207d82, 0x85839f82, 0x71826f20, 0x24075341, 0x00750070, 0x20838262, 0x202b8269, 0x221f8220, 0x826d006f, 0x82692047, 0x050f423d, 
-    0x54000a22, 0x69215982, 0x42c58300, 0x53200941, 0x6620eb82, 0x77205182, 0x72202b82, 0x21857384, 0x4225c741, 0x4f2009f9, 0x6e20c384, 0x5b898f82, 
-    0x200fc741, 0x06d54476, 0x6b822020, 0x42052d42, 0xcd85330f, 0x6520cb83, 0x6520cb82, 0x83107342, 0x006121df, 0x6320cb85, 0x7022dd82, 0xd7826900, 
-    0x27826420, 0x07826220, 0x11826c20, 0x21437720, 0x000a2806, 0x00410048, 0x824b0043, 0x004f261b, 0x00450050, 0x2609824e, 0x004f0046, 0x8254004e, 
-    0x004c2209, 0x831d8249, 0x82532015, 0x0020211b, 0x0a24bf87, 0x28000a00, 0x45064142, 0x312009b1, 0x57455582, 0x00202405, 0x82360030, 0x8253203f, 
-    0x0070226f, 0x21058274, 0x7b83006d, 0xff467220, 0x8229200a, 0x45459343, 0x202205f7, 0x2b842d00, 0x45a43720, 0x201b7544, 0x20798220, 0x2a794479, 
-    0x432b1f47, 0x45260539, 0x49004600, 0x03824e00, 0x03825420, 0x09824f20, 0xdb845320, 0x41002224, 0xfd827500, 0x6f006826, 0x22007200, 0x72248382, 
-    0x66006500, 0x2006e746, 0x20198220, 0x2313826f, 0x006e0061, 0x64209f83, 0x73241782, 0x67006900, 0x65200f82, 0x2c202f82, 0x65201b82, 0x67200b82, 
-    0x6e201382, 0x13871b82, 0x1b827020, 0x25826f20, 0x61007224, 0x01826d00, 0x74201787, 0x63222382, 0x31826800, 0x63006922, 0x6c201b82, 0x77203f82, 
-    0x69202b82, 0x23836782, 0x85842020, 0x74200583, 0x11852582, 0x8b867020, 0x20057147, 0x83178277, 0x82632091, 0x826e2029, 0x82722035, 0x84622079, 
-    0x136d43c1, 0x42194143, 0x502a059f, 0x52004500, 0x49004d00, 0x01825300, 0x4f004924, 0x91824e00, 0x05824120, 0x07824420, 0x0f844320, 0x33414420, 
-    0x84502010, 0x826d2091, 0x00732179, 0x20095942, 0x200b8269, 0x20b58620, 0x06cf4165, 0xdb826720, 0xed826120, 0x6422f783, 0x53822c00, 0x11826620, 
-    0x3f826520, 0x6620e383, 0x63200f82, 0x61203182, 0x67201382, 0x1f831382, 0xd7827420, 0x20057943, 0x8d1d8279, 0x826f20fb, 0x00742255, 0x20778261, 
-    0x2003846e, 0x20218267, 0x49438461, 0x53870575, 0x85847420, 0x66002022, 0x43062341, 0x6322056b, 0x0f826300, 0x70006d22, 0x6e224182, 0x41887900, 
-    0x4d442d83, 0x00202413, 0x46220028, 0x732008c5, 0x29200b82, 0x200a9b45, 0x20ed8261, 0x224f8273, 0x82690063, 0x20df854f, 0x22138220, 0x8275006f, 
-    0x052145cd, 0x1f826320, 0xd7866420, 0x2b846420, 0x6d007522, 0x6e220f82, 0x33847400, 0x9f846920, 0x6121f583, 0x05694400, 0x95846220, 0x41826120, 
-    0x6b827920, 0x0d826620, 0x2f826c20, 0x2820bf83, 0x8908cd45, 0x00202193, 0x230f1745, 0x00290022, 0x20094541, 0x423b8272, 0x64200589, 0x93859582, 
-    0x64206987, 0x73205b82, 0x460e3f42, 0x5b460931, 0x05a1411b, 0x42251345, 0xa583197f, 0x6e006926, 0x6c006300, 0x8d839b82, 0x67006e22, 0x7720f382, 
-    0x5b839782, 0x15826f20, 0x0f827420, 0x0f826c20, 0x46054f46, 0xa78909e1, 0x2009bb4b, 0x852b8273, 0x00752299, 0x06734173, 0x74007322, 0x79215b84, 
-    0x456d8300, 0x0b850565, 0x21826d20, 0x6f827220, 0x19846520, 0x6d006524, 0x11826200, 0x8905a142, 0x202b85fb, 0x20198472, 0x06a94b69, 0x29826920, 
-    0x57827520, 0x61203985, 0x6422c182, 0xb5432f00, 0x20778306, 0x20cf826c, 0x474f8220, 0x9743099b, 0x006f2205, 0x20a18272, 0x892f8275, 0x8469205f, 
-    0x00202159, 0x4709ff45, 0x414111bb, 0x207f851d, 0x06a54420, 0x41052d43, 0x2021052d, 0x0b3b4300, 0x22091d41, 0x82680077, 0x476d20ad, 0x61990a91, 
-    0x43002021, 0x66220517, 0xbd827500, 0x0d846e20, 0xb3866820, 0x20056b41, 0x424b8264, 0x2c2005f5, 0x73205182, 0x62222782, 0x21826a00, 0x91826320, 
-    0x200ff947, 0x212b8266, 0xd946006c, 0x00692105, 0x4405ed41, 0x642005c5, 0xbd485982, 0x003a2109, 0x2205b946, 0x82290031, 0x82542053, 0x826520af, 
-    0x00612207, 0x483f8262, 0x2f41056f, 0x0db94d05, 0x1d826e20, 0xe5424383, 0x4874200d, 0x1b41084b, 0x0bb34409, 0x7320358d, 0x61202d82, 0x2006754d, 
-    0x83c58262, 0x09a142ff, 0x8305c741, 0x002021b9, 0xcb412587, 0x82612011, 0x416420d9, 0x20214ee9, 0x0f7d4900, 0x2e007322, 0x20081b41, 0x8ba98473, 
-    0x827320c9, 0x8263201b, 0x826e20a3, 0x21c79707, 0x914c0065, 0x00652205, 0x21258272, 0x33830061, 0x67827320, 0x2d20bf85, 0x6f20e184, 0x6520cb82, 
-    0x74201d82, 0x78206182, 0x20211b82, 0x09914400, 0x17822c20, 0x75006824, 0x67846d00, 0x45822d20, 0x09826520, 0x03826420, 0x6c006222, 0x68209184, 
-    0x61220582, 0x49476400, 0x05014308, 0x20053f41, 0x08d54174, 0x44007021, 0x058305a1, 0x20074945, 0x20558420, 0x83238263, 0x0065212d, 0x6d205d93, 
-    0x74205782, 0x71836d82, 0x9b850783, 0x7b826520, 0xcb846420, 0x87074744, 0x0065216f, 0x8585c185, 0x41196745, 0x6c210509, 0x46fb8300, 0x3b43055f, 
-    0x82682005, 0x05694111, 0x69006622, 0x6c207b82, 0x6741d982, 0x82652011, 0x82732091, 0x006c261f, 0x00200079, 0x20298476, 0x08d74977, 0xf9871383, 
-    0xa5827520, 0x72006522, 0x2206e349, 0x42320028, 0x93430ced, 0x826d201b, 0x41498363, 0x814205d9, 0x054d460f, 0x74006c22, 0x72207582, 0x8508d344, 
-    0x826120f5, 0x436420b3, 0x79460abf, 0x0527410b, 0x5b827020, 0x3b827220, 0x63006926, 0x6c007500, 0x6d450d84, 0x0bfd4809, 0x6f22fb83, 0xe5826600, 
-    0x27826720, 0x70007924, 0xd1826800, 0x85002021, 0x07d54769, 0x47826120, 0x2f838985, 0x870dfb41, 0x9d1983e3, 0x09894bd3, 0x6920c185, 0x2008eb4c, 
-    0x217b8261, 0x81a90020, 0x0f41678d, 0x89e9890f, 0x822c209b, 0x006f22e1, 0x22e3846e, 0x4d690020, 0x5f480c57, 0x05cb4b0d, 0x6e240583, 0x6d006100, 
-    0x870c2745, 0x43eb8311, 0xf54505a9, 0x826e2005, 0x0dcf48c9, 0x26071f42, 0x006f0077, 0x4f640072, 0x28211433, 0x05495100, 0x63824e20, 0x870bc543, 
-    0x1b3d423b, 0xf1437d83, 0x05d14a05, 0x8305c341, 0x07a14145, 0xe5826420, 0x03827620, 0x75006422, 0x6c20c782, 0x37498182, 0x006f2207, 0x8371826e, 
-    0x007321b3, 0x4107bf47, 0x692205f1, 0xb9486700, 0x422f8306, 0x99420503, 0x0020220f, 0x0c3d5276, 0x91414385, 0x8273200d, 0x846c20f5, 0x052353f5, 
-    0x65249785, 0x66006c00, 0x20062943, 0x08b14a54, 0x41004e23, 0x07cb4b00, 0x4e000a21, 0x154e0b37, 0x0020220d, 0x85778262, 0x006521c3, 0x20058141, 
-    0x06e54575, 0xad456120, 0x82762006, 0x84692077, 0x82692077, 0x056f4269, 0xf9827920, 0x460d474f, 0x6e200f83, 0x8b423182, 0x0bd14d09, 0x4407e341, 
-    0x6b4b05a5, 0x00542205, 0x21bb8248, 0xb94d0020, 0x00532209, 0x220d824f, 0x82570054, 0x845220c9, 0x0049221b, 0x22758253, 0x82520050, 0x00562419, 
-    0x82440049, 0x82442015, 0x82222011, 0x83198321, 0x0022221f, 0x2011822c, 0x831d8257, 0x004f2451, 0x84540055, 0x8241200f, 0x82522035, 0x824e2027, 
-    0x8259200f, 0x205b8311, 0x830f8420, 0x824b200d, 0x824e202f, 0x243b834f, 0x00580045, 0x202d8250, 0x836d8245, 0x824f2055, 0x8220200b, 0x824d201f, 
-    0x824c2015, 0x86452007, 0x00492627, 0x0043004e, 0x2061824c, 0x203d8444, 0x20558247, 0x206f8642, 0x83a1824e, 0x202f8377, 0x838b844d, 0x82202035, 
-    0x824f207b, 0x82412025, 0x85758339, 0x209587d9, 0x85cd8249, 0x8246206f, 0x824d2023, 0x8252200d, 0x8448205f, 0x825420a3, 0x00422205, 0x206d8249, 
-    0x83bf8449, 0x844620a7, 0x844e2057, 0x20378335, 0x20738246, 0x20398252, 0x20038241, 0x202f8250, 0x20298252, 0x20418249, 0x20358255, 0x22c38441, 
-    0x82550050, 0x82502007, 0x050b4f27, 0x8307c94c, 0x844e20ad, 0x824620c3, 0x20d7831f, 0x83558247, 0x05434f81, 0x20052b41, 0x22378243, 0x84590050, 
-    0x00472521, 0x00540048, 0x69838583, 0x2d825420, 0x0f832983, 0x1f825420, 0x44004122, 0x75833f84, 0x25844b20, 0x20054341, 0x2033824f, 0x20d78448, 
-    0x20458a20, 0x83af822e, 0x00202273, 0x2061824e, 0x201f8220, 0x224f8656, 0x82530020, 0x82412067, 0x824c20bf, 0x82542023, 0x4d45200b, 0x878d0677, 
-    0x19822020, 0x25824f20, 0x5b864420, 0x07824220, 0x0f822020, 0x41004924, 0x07824200, 0x1d413583, 0x824e2009, 0x002022c3, 0x20178243, 0x20f38241, 
-    0x209f844d, 0x20298244, 0x8303824d, 0x09f341f7, 0x4c20af8b, 0x4d832b82, 0x420d8341, 0xdd411303, 0x204b8307, 0x2091844e, 0x206b8241, 0x22b9822c, 
-    0x82500053, 0x8443200f, 0x844c2049, 0x203f8377, 0x200f8244, 0x41178452, 0x53850551, 0x83004921, 0x004e22cd, 0x85958254, 0x0543412b, 0x2005754e, 
-    0x222f8253, 0x82550051, 0x83218305, 0x824c20e7, 0x83c58d5f, 0x00572271, 0x41238248, 0x52200539, 0x83086741, 0x822020a1, 0x44432057, 0x20210821, 
-    0x09e34100, 0x52205183, 0x43831d86, 0x1b825420, 0x29825220, 0x43832383, 0x20091541, 0x20b98257, 0x835f8253, 0x00412225, 0x420d8452, 0x2022053d, 
-    0x0f824600, 0x41004f21, 0x8543055d, 0x85638507, 0x8220208d, 0x058542bd, 0x4922d785, 0xe3424e00, 0x4320200e, 0x5521062d, 0x44278500, 0x4b852321, 
-    0xb1837b87, 0x4420fb89, 0x4122a982, 0xa5824c00, 0x47004e22, 0x20205382, 0x20200984, 0x44069342, 0xa1441b79, 0x00452a05, 0x00630078, 0x00700065, 
-    0x08134a74, 0x6f006323, 0x09a54600, 0x4b0b034b, 0x7b4a095b, 0x822c200b, 0x20198339, 0x46078265, 0x49450bf5, 0x273f5705, 0x51117b53, 0x28240ba5, 
-    0x29007300, 0x46109d45, 0xd94b1bf5, 0x21ad850b, 0x3f490020, 0x05874905, 0x3d4e6420, 0x00702208, 0x20f18272, 0x2003826d, 0x06454e74, 0xff826520, 
-    0x0f826420, 0x75827220, 0x4b49d583, 0x05cf4609, 0x69007422, 0x25521986, 0x1ff94607, 0x41053552, 0x74200b6b, 0xf3835f82, 0x6b006322, 0x6f246d82, 
-    0x6c007700, 0x64227d82, 0x05826700, 0x51099548, 0x692011f3, 0x6e213782, 0x0d0f4100, 0x204f6341, 0x0a954f72, 0x69218b87, 0x24158300, 0x00780065, 
-    0x26a98270, 0x00630069, 0x52740069, 0x74200acb, 0x6e20b782, 0x5208bf51, 0x2e200d29, 0x20221782, 0xb9824600, 0x5b4e4383, 0x09ed5205, 0xff826920, 
-    0x1b846620, 0x23516d20, 0x0989420e, 0x6b826320, 0x45823a20, 0x20093f59, 0x4e2b8420, 0x75200589, 0x63209b82, 0x45837f82, 0x4d827520, 0x4d516420, 
-    0x82642006, 0x20a38355, 0x200f826f, 0x085b5567, 0x42000a28, 0x54004900, 0x03825300, 0x45005226, 0x4d004100, 0x56205982, 0x52200982, 0x20210b82, 
-    0x0d5d5500, 0x0a000a22, 0x5b20375c, 0x8b5853e3, 0x0069211f, 0x22057d48, 0x82740020, 0x006122dd, 0x22ff8264, 0x8261006d, 0x436b200b, 0x19590827, 
-    0x5c2c2011, 0xd9830a6f, 0x01d71310, 0x19bd5319, 0x210b134f, 0xa5530020, 0x19f1446d, 0x53635d53, 0x702d194f, 0x62007500, 0x69006c00, 0x68007300, 
-    0x548b8300, 0x7d4e136d, 0x113f5309, 0x01111310, 0x27095313, 0x21091354, 0x09440072, 0x0f25520f, 0x68212b89, 0x05434400, 0x41552753, 0x4d4e13cf, 
-    0x053f4e05, 0x4f053155, 0x734d0541, 0x19e3420d, 0x21151553, 0x094e000a, 0x5b652005, 0x27570ce3, 0x216f830f, 0x11100061, 0x54d90145, 0x53510ddd, 
-    0x1b7b5f0f, 0x8f05dd49, 0x00202231, 0x06495d22, 0x09826120, 0x4309db5d, 0x415e0533, 0x2b6f500f, 0x540d4d59, 0x652305a5, 0x4b006e00, 0x70200581, 
-    0x24085f49, 0x00620061, 0x060d4a6c, 0xdb426f20, 0x85cb830a, 0x1d2943b3, 0x21496820, 0x83078306, 0x09b35f33, 0x2011ad4a, 0x207f8261, 0x85638264, 
-    0x13bb45dd, 0x60173161, 0x202013d1, 0x200a3941, 0x22598220, 0x826d0061, 0x517320c7, 0x682008cf, 0xbd9bd584, 0x21172352, 0xc9830061, 0xd9827020, 
-    0x74007222, 0x2008e748, 0x20098261, 0x2013846c, 0x20598267, 0x200d8272, 0x103d6073, 0x63223383, 0x25826b00, 0x2205614b, 0x84750062, 0x826e2041, 
-    0x00202129, 0x5105ad44, 0xa94409ff, 0x0f814453, 0x1023f952, 0x1f023f12, 0x5013c94c, 0x2350052f, 0x00202805, 0x004e0047, 0x544d004f, 0x55200887, 
-    0x44200f82, 0x210a4755, 0x12100020, 0x26b70259, 0x006e0047, 0x516d006f, 0xbf4706b3, 0x50158907, 0x75200571, 0x315c2582, 0x117b6105, 0x22111f4f, 
-    0x82490020, 0x0063272f, 0x002c002e, 0x43520020, 0x82692023, 0x0020242f, 0x58640061, 0x1b5206eb, 0x82692005, 0x82672015, 0x05a74741, 0xc9616f20, 
-    0x00722206, 0x08395277, 0x52050548, 0xf7510d7b, 0x82732009, 0x866c2051, 0x527520d9, 0x4b890c85, 0x73822020, 0x27846520, 0x6f5b6d85, 0x214f670d, 
-    0x830f7761, 0x0069218b, 0x7720b185, 0x2006a164, 0x06d55174, 0x31656120, 0x0069220a, 0x0aa7517a, 0x66002022, 0x6f212b82, 0x0b5f6000, 0x4c1f8341, 
-    0x7f410701, 0x8272201f, 0x0073227d, 0x26058270, 0x00740063, 0x82760069, 0x006c2509, 0x002e0079, 0x5b454d52, 0x74200dcd, 0x67205582, 0x21085342, 
-    0x3d520020, 0x49976b0f, 0x62002f26, 0x6f006c00, 0x2f260582, 0x61006d00, 0xdd827300, 0x72006524, 0x7b522f00, 0x822e200e, 0x0064241d, 0x84000200, 
-    0x24ff2300, 0x47185a00, 0x08820863, 0x052d0287, 0x010000fe, 0x00030102, 0x00040103, 0x075482c7, 0x01ad280c, 0x00060105, 0x00ae0063, 0x00250090, 
-    0x00fd0026, 0x016400ff, 0x00270007, 0x010801e9, 0x00280009, 0x000a0165, 0x01ca00c8, 0x01cb000b, 0x000d010c, 0x002a0029, 0x010e01f8, 0x0010010f, 
-    0x0011012b, 0x00cc002c, 0x01ce00cd, 0x01cf0012, 0x01140113, 0x002d0015, 0x0016012e, 0x0117012f, 0x00190118, 0x003000e2, 0x011a0131, 0x011c011b, 
-    0x0066001d, 0x00d00032, 0x006700d1, 0x011e01d3, 0x0020011f, 0x00210191, 0x00b000af, 0x00ed0033, 0x01350034, 0x01230122, 0x01360024, 0x00e40025, 
-    0x002601fb, 0x01270137, 0x00290128, 0x00d40038, 0x006800d5, 0x012a01d6, 0x012c012b, 0x012e012d, 0x0039002f, 0x0130013a, 0x01320131, 0x003b0033, 
-    0x01eb003c, 0x01bb0034, 0x013d0035, 0x01e60036, 0x00440037, 0x00380169, 0x006c006b, 0x0139016a, 0x006e003a, 0x00a0006d, 0x00460045, 0x000001fe, 
-    0x003b016f, 0x01ea0047, 0x003d013c, 0x01700048, 0x0072003e, 0x003f0173, 0x01400171, 0x00490041, 0x01f9004a, 0x01430142, 0x014b0044, 0x004c0045, 
-    0x007400d7, 0x00770076, 0x01460175, 0x00480147, 0x014e004d, 0x014f0049, 0x014b014a, 0x00e3004c, 0x01510050, 0x014e014d, 0x0050014f, 0x00520078, 
-    0x007b0079, 0x017a007c, 0x01520151, 0x01a10053, 0x007d0054, 0x005300b1, 0x005400ee, 0x01550155, 0x00570156, 0x00580156, 0x01fc00e5, 0x00890059, 
-    0x015a0157, 0x005c015b, 0x007e0058, 0x00810080, 0x015d017f, 0x015f015e, 0x01610160, 0x00590062, 0x0163015a, 0x01650164, 0x005b0066, 0x01ec005c, 
-    0x01ba0067, 0x015d0068, 0x01e70069, 0x009d006a, 0x016b019e, 0x016d016c, 0x016f016e, 0x01710170, 0x01730172, 0x01750174, 0x01770176, 0x01790178, 
-    0x017b017a, 0x017d017c, 0x017f017e, 0x01810180, 0x01830182, 0x01850184, 0x01870186, 0x01890188, 0x018b018a, 0x018d018c, 0x018f018e, 0x01910190, 
-    0x01930192, 0x01950194, 0x01970196, 0x01990198, 0x019b019a, 0x019d019c, 0x019f019e, 0x01a101a0, 0x01a301a2, 0x01a501a4, 0x01a701a6, 0x01a901a8, 
-    0x01ab01aa, 0x01ad01ac, 0x01af01ae, 0x01b101b0, 0x01b301b2, 0x01b501b4, 0x01b701b6, 0x01b901b8, 0x01bb01ba, 0x01bd01bc, 0x01bf01be, 0x01c101c0, 
-    0x01c301c2, 0x01c501c4, 0x01c701c6, 0x01c901c8, 0x01cb01ca, 0x01cd01cc, 0x01cf01ce, 0x01d101d0, 0x01d301d2, 0x01d501d4, 0x01d701d6, 0x01d901d8, 
-    0x01db01da, 0x01dd01dc, 0x01df01de, 0x01e101e0, 0x01e301e2, 0x01e501e4, 0x01e701e6, 0x01e901e8, 0x01eb01ea, 0x01ed01ec, 0x01ef01ee, 0x01f101f0, 
-    0x01f301f2, 0x01f501f4, 0x01f701f6, 0x01f901f8, 0x01fb01fa, 0x01fd01fc, 0x02ff01fe, 0x02010200, 0x02030202, 0x02050204, 0x02070206, 0x02090208, 
-    0x020b020a, 0x020d020c, 0x020f020e, 0x02110210, 0x02130212, 0x02150214, 0x02170216, 0x02190218, 0x021b021a, 0x021d021c, 0x021f021e, 0x02210220, 
-    0x02230222, 0x02250224, 0x02270226, 0x02290228, 0x022b022a, 0x022d022c, 0x022f022e, 0x02310230, 0x02330232, 0x02350234, 0x02370236, 0x02390238, 
-    0x023b023a, 0x023d023c, 0x023f023e, 0x02410240, 0x02430242, 0x02450244, 0x02470246, 0x02490248, 0x024b024a, 0x024d024c, 0x024f024e, 0x02510250, 
-    0x02530252, 0x02550254, 0x02570256, 0x02590258, 0x025b025a, 0x025d025c, 0x025f025e, 0x02610260, 0x02630262, 0x02650264, 0x02670266, 0x02690268, 
-    0x026b026a, 0x026d026c, 0x026f026e, 0x02710270, 0x02730272, 0x02750274, 0x02770276, 0x02790278, 0x027b027a, 0x027d027c, 0x027f027e, 0x02810280, 
-    0x02830282, 0x02850284, 0x02870286, 0x02890288, 0x028b028a, 0x028d028c, 0x028f028e, 0x02910290, 0x02930292, 0x02950294, 0x02970296, 0x02990298, 
-    0x029b029a, 0x029d029c, 0x029f029e, 0x001300a0, 0x00150014, 0x00170016, 0x00190018, 0x001b001a, 0x02a1021c, 0x02f400a2, 0x00a402a3, 0x02f600f5, 
-    0x02a602a5, 0x00a802a7, 0x00f200f1, 0x000d00f3, 0x00a9023f, 0x001d0087, 0x00ab000f, 0x00aa0204, 0x000600a3, 0x02220011, 0x00a200ab, 0x000a0005, 
-    0x0012001e, 0x02ac0242, 0x02ae02ad, 0x02b002af, 0x02b202b1, 0x02b402b3, 0x02b602b5, 0x02b802b7, 0x02ba02b9, 0x02bc02bb, 0x00be02bd, 0x0060005e, 
-    0x0240003e, 0x02c002bf, 0x00c202c1, 0x020c000b, 0x02c402c3, 0x02c602c5, 0x02c802c7, 0x02ca02c9, 0x02cc02cb, 0x02ce02cd, 0x02d002cf, 0x02d202d1, 
-    0x02d402d3, 0x02d602d5, 0x00d802d7, 0x02b200b3, 0x021000d9, 0x02db02da, 0x00dd02dc, 0x00bf00be, 0x00b400c5, 0x02b600b5, 0x00b700de, 0x02df02c4, 
-    0x02e102e0, 0x02e302e2, 0x02e502e4, 0x02e702e6, 0x02e902e8, 0x02eb02ea, 0x02ed02ec, 0x02ef02ee, 0x02f102f0, 0x02f302f2, 0x02f502f4, 0x02f702f6, 
-    0x02f902f8, 0x02fb02fa, 0x02fd02fc, 0x03ff02fe, 0x03020000, 0x03840001, 0x00bd0002, 0x03030307, 0x00a60004, 0x030503f7, 0x03850006, 0x03080307, 
-    0x030a0309, 0x030c030b, 0x030e030d, 0x0310030f, 0x03120311, 0x03140313, 0x03160315, 0x03180317, 0x03960019, 0x03a7001a, 0x0361001b, 0x031d031c, 
-    0x03b8001e, 0x0320031f, 0x03200021, 0x03230322, 0x00210024, 0x00920095, 0x0325039c, 0x00270326, 0x0394001f, 0x03a40028, 0x00ef0029, 0x002a03f0, 
-    0x032b038f, 0x0098002c, 0x002d0308, 0x000e00c6, 0x039a0093, 0x032f032e, 0x03a50030, 0x03320331, 0x03340333, 0x03990035, 0x03370336, 0x03390338, 
-    0x033b033a, 0x003d033c, 0x033e039f, 0x0340033f, 0x03420341, 0x03440343, 0x03460345, 0x03480347, 0x034a0349, 0x034c034b, 0x034e034d, 0x0350034f, 
-    0x03520351, 0x03540353, 0x03560355, 0x03580357, 0x035a0359, 0x035c035b, 0x035e035d, 0x0360035f, 0x03620361, 0x03640363, 0x03660365, 0x03680367, 
-    0x036a0369, 0x036c036b, 0x036e036d, 0x0370036f, 0x03720371, 0x03740373, 0x03760375, 0x03780377, 0x037a0379, 0x037c037b, 0x037e037d, 0x0380037f, 
-    0x03820381, 0x03840383, 0x03860385, 0x03880387, 0x038a0389, 0x038c038b, 0x038e038d, 0x0390038f, 0x03920391, 0x03940393, 0x03960395, 0x03980397, 
-    0x039a0399, 0x039c039b, 0x039e039d, 0x03a0039f, 0x03a203a1, 0x03a403a3, 0x03a603a5, 0x03a803a7, 0x03aa03a9, 0x03ac03ab, 0x03ae03ad, 0x03b003af, 
-    0x03b203b1, 0x03b403b3, 0x03b603b5, 0x03b803b7, 0x03ba03b9, 0x03bc03bb, 0x03be03bd, 0x03c003bf, 0x03c203c1, 0x03c403c3, 0x03c603c5, 0x03c803c7, 
-    0x03ca03c9, 0x03cc03cb, 0x03ce03cd, 0x03d003cf, 0x03d203d1, 0x03d403d3, 0x03d603d5, 0x03d803d7, 0x03da03d9, 0x03dc03db, 0x03de03dd, 0x03e003df, 
-    0x03e203e1, 0x03e403e3, 0x03e603e5, 0x03e803e7, 0x03ea03e9, 0x03ec03eb, 0x03ee03ed, 0x03f003ef, 0x03f203f1, 0x03f403f3, 0x03f603f5, 0x03f803f7, 
-    0x03fa03f9, 0x03fc03fb, 0x03fe03fd, 0x040004ff, 0x04020401, 0x04040403, 0x04060405, 0x04080407, 0x040a0409, 0x040c040b, 0x040e040d, 0x0410040f, 
-    0x04120411, 0x04140413, 0x04160415, 0x04180417, 0x041a0419, 0x041c041b, 0x041e041d, 0x0420041f, 0x04220421, 0x04240423, 0x04260425, 0x04280427, 
-    0x042a0429, 0x042c042b, 0x042e042d, 0x0430042f, 0x04320431, 0x04340433, 0x04360435, 0x04380437, 0x043a0439, 0x043c043b, 0x043e043d, 0x0440043f, 
-    0x04420441, 0x04440443, 0x04460445, 0x04480447, 0x044a0449, 0x044c044b, 0x044e044d, 0x0450044f, 0x04520451, 0x04540453, 0x04560455, 0x04580457, 
-    0x045a0459, 0x045c045b, 0x045e045d, 0x0460045f, 0x04620461, 0x04640463, 0x04660465, 0x04680467, 0x046a0469, 0x046c046b, 0x046e046d, 0x0470046f, 
-    0x04720471, 0x04740473, 0x04760475, 0x04780477, 0x047a0479, 0x047c047b, 0x047e047d, 0x0480047f, 0x04820481, 0x04840483, 0x04860485, 0x04880487, 
-    0x048a0489, 0x048c048b, 0x048e048d, 0x0490048f, 0x04920491, 0x04940493, 0x04960495, 0x04980497, 0x049a0499, 0x049c049b, 0x049e049d, 0x04a0049f, 
-    0x04a204a1, 0x04a404a3, 0x04a604a5, 0x04a804a7, 0x04aa04a9, 0x04ac04ab, 0x04ae04ad, 0x04b004af, 0x04b204b1, 0x04b404b3, 0x04b604b5, 0x04b804b7, 
-    0x04ba04b9, 0x04bc04bb, 0x04be04bd, 0x04c004bf, 0x04c204c1, 0x04c404c3, 0x04c604c5, 0x04c804c7, 0x04ca04c9, 0x04cc04cb, 0x04ce04cd, 0x04b900cf, 
-    0x04d104d0, 0x04d304d2, 0x04d504d4, 0x04d704d6, 0x04d904d8, 0x04db04da, 0x04dd04dc, 0x04df04de, 0x04e104e0, 0x04e304e2, 0x04e504e4, 0x04e704e6, 
-    0x04e904e8, 0x04eb04ea, 0x04ed04ec, 0x04ef04ee, 0x04f104f0, 0x04f304f2, 0x04f504f4, 0x04f704f6, 0x04f904f8, 0x04fb04fa, 0x04fd04fc, 0x05ff04fe, 
-    0x05010500, 0x05030502, 0x05050504, 0x05070506, 0x05090508, 0x050b050a, 0x050d050c, 0x050f050e, 0x05110510, 0x05130512, 0x05150514, 0x05170516, 
-    0x05190518, 0x051b051a, 0x051d051c, 0x051f051e, 0x05210520, 0x05230522, 0x05250524, 0x05270526, 0x05290528, 0x052b052a, 0x052d052c, 0x052f052e, 
-    0x05310530, 0x05330532, 0x05350534, 0x05370536, 0x05390538, 0x053b053a, 0x053d053c, 0x053f053e, 0x05410540, 0x05430542, 0x05450544, 0x05470546, 
-    0x05490548, 0x054b054a, 0x054d054c, 0x054f054e, 0x05510550, 0x05530552, 0x05550554, 0x05570556, 0x05590558, 0x055b055a, 0x055d055c, 0x055f055e, 
-    0x05610560, 0x05630562, 0x05650564, 0x05670566, 0x05690568, 0x056b056a, 0x056d056c, 0x056f056e, 0x05710570, 0x05730572, 0x05750574, 0x05770576, 
-    0x05790578, 0x057b057a, 0x057d057c, 0x057f057e, 0x05810580, 0x05830582, 0x05850584, 0x05870586, 0x05890588, 0x058b058a, 0x058d058c, 0x005f008e, 
-    0x002300e8, 0x00880009, 0x008a008b, 0x008c0086, 0x00410083, 0x05c20082, 0x0590058f, 0x05920591, 0x00940593, 0x00db008d, 0x00de00e1, 0x008e00d8, 
-    0x004300dc, 0x009505df, 0x00dd00e0, 0x009605d9, 0x05970524, 0x05990598, 0x059b059a, 0x059d059c, 0x059f059e, 0x05a105a0, 0x05a305a2, 0x05a505a4, 
-    0x05a705a6, 0x05a905a8, 0x05ab05aa, 0x05ad05ac, 0x05af05ae, 0x05b105b0, 0x05b305b2, 0x05b505b4, 0x05b705b6, 0x05b905b8, 0x05bb05ba, 0x05bd05bc, 
-    0x05bf05be, 0x05c105c0, 0x05c305c2, 0x05c505c4, 0x05c705c6, 0x05c905c8, 0x05cb05ca, 0x05cd05cc, 0x05cf05ce, 0x05d105d0, 0x05d305d2, 0x00d505d4, 
-    0x05d6059b, 0x05d805d7, 0x05da05d9, 0x05dc05db, 0x05de05dd, 0x05e005df, 0x05e205e1, 0x05e405e3, 0x05e605e5, 0x05e805e7, 0x05ea05e9, 0x05ec05eb, 
-    0x05ee05ed, 0x05f005ef, 0x05f205f1, 0x05f405f3, 0x05f605f5, 0x05f805f7, 0x05fa05f9, 0x05fc05fb, 0x05fe05fd, 0x060006ff, 0x00020601, 0x00aa00a9, 
-    0x06030697, 0x06050604, 0x00070606, 0x04c900bc, 0x4c4c554e, 0x6e6f6e10, 0x6b72616d, 0x72676e69, 0x72757465, 0x6241066e, 0x65766572, 0x616d4107, 
-    0x6e6f7263, 0x676f4107, 0x6b656e6f, 0x6f64430a, 0x63636174, 0x06746e65, 0x82616344, 0x25068219, 0x74616f72, 0x0d844506, 0x88450a21, 0x4507211f, 
-    0x45203a86, 0x06213a85, 0x29218447, 0x696e7507, 0x32323130, 0x2988470a, 0x62480426, 0x490a7261, 0x07210f88, 0x20398649, 0x25398649, 0x6c697449, 
-    0x39856564, 0x0636332a, 0x7563614c, 0x4c066574, 0x33234f8a, 0x854e0642, 0x8a4e2015, 0x35343b15, 0x676e4503, 0x6f684f05, 0x4f0d6e72, 0x676e7568, 
-    0x6d757261, 0x7475616c, 0x62854f07, 0x734f0b26, 0x6873616c, 0x52203a85, 0x418a0686, 0x06363523, 0x84158453, 0x3132247c, 0x82540438, 0x540621ab, 
-    0x32242289, 0x55054131, 0x55206084, 0x5520608c, 0x07216085, 0x27c38555, 0x69725505, 0x5506676e, 0x0621c984, 0x3e538457, 0x6963570b, 0x6d756372, 
-    0x78656c66, 0x69645709, 0x73657265, 0x57067369, 0x76617267, 0x89590b65, 0x5906211c, 0x06211284, 0x2136845a, 0x29415a0a, 0x61062108, 0x2005a541, 
-    0x206c8661, 0x216c8561, 0x2189630a, 0xaa846420, 0x63640628, 0x74616f72, 0x0d846506, 0x88650a21, 0x6507211f, 0x65203a86, 0x06213a85, 0x24da8967, 
-    0x0a333231, 0x21298867, 0xf9826804, 0x86690721, 0x8669202e, 0x4169202e, 0x37220b9a, 0xa1846c06, 0x8a6c0621, 0x43332344, 0x15856e06, 0x158a6e20, 
-    0x0336342d, 0x05676e65, 0x726f686f, 0x416f0d6e, 0x6f200c39, 0x0b216285, 0x0a9a416f, 0x41857220, 0x418a7220, 0x06373523, 0x0b9a4173, 0x74043922, 
-    0x0621a082, 0x24228974, 0x05423132, 0x20608475, 0x20608c75, 0x21608575, 0xc3857507, 0x72750527, 0x06676e69, 0x21c98475, 0x53847706, 0x41770b21, 
-    0x0921097d, 0x089a4177, 0x72677727, 0x0b657661, 0x211c8979, 0x12847906, 0x417a0621, 0x7a20059a, 0x27082e41, 0x696e7507, 0x30313430, 0x31200786, 
-    0x32200786, 0x33200786, 0x30200785, 0x39200786, 0x34202787, 0x31211785, 0x20078535, 0x20178630, 0x203f8730, 0x21178536, 0x07863731, 0x07863820, 
-    0x07853920, 0x85443021, 0x41312107, 0x30210785, 0x21078543, 0x07864231, 0x27870f87, 0x17864520, 0x07854620, 0x6f863220, 0x6f863220, 0xaf863220, 
-    0xa7863220, 0x2f863020, 0xa7863220, 0xa7863220, 0x8f863220, 0x9f863220, 0x97863220, 0x97873220, 0x07875f87, 0x32208786, 0x3220a786, 0x30209f86, 
-    0x17862f87, 0x5f863020, 0x6f873020, 0x3020b786, 0x30206786, 0x30207786, 0x30206f86, 0x32204786, 0x3020a786, 0x3620bf86, 0x37200786, 0x39200786, 
-    0x57860787, 0x4f863920, 0x47863920, 0x7f863920, 0x27864120, 0x0f874120, 0x4120b786, 0x42215f86, 0x05374130, 0x27864220, 0x27864220, 0x17864320, 
-    0x85314321, 0x4143201f, 0x4320063f, 0x4320af86, 0x4420a786, 0x44202786, 0x44203f86, 0x44208786, 0x44208786, 0x44204f86, 0x44207786, 0x45217786, 
-    0x20578530, 0x20378645, 0x20c78645, 0x203f8645, 0x203f8645, 0x203f8645, 0x203f8645, 0x213f8645, 0x3f853046, 0x3f864620, 0x3f864620, 0x3f864620, 
-    0x3f854620, 0xbf423520, 0x42352006, 0x3521064f, 0x21478631, 0x3f853033, 0xdf863320, 0x47863320, 0xe7863320, 0x07863520, 0x1f873920, 0x33205f86, 
-    0x2006cf41, 0x203f8635, 0x861f8735, 0x41332077, 0x3320061f, 0x34217f85, 0x060f4233, 0xf7413520, 0x86332006, 0x873520cf, 0x06474187, 0x0f873320, 
-    0xe7862787, 0x6f423320, 0x86342006, 0x8634206f, 0x8634206f, 0x863420af, 0x863520a7, 0x8634202f, 0x863420a7, 0x863420a7, 0x8634208f, 0x8634209f, 
-    0x87342097, 0x875f8797, 0x20878607, 0x20a78634, 0x209f8634, 0x862f8735, 0x86352017, 0x8735205f, 0x20b7866f, 0x20678635, 0x20778635, 0x206f8635, 
-    0x20478635, 0x20a78634, 0x20bf8635, 0x20bf8636, 0x20078637, 0x86078739, 0x8639205f, 0x86392047, 0x8639207f, 0x86412047, 0x87412027, 0x207f860f, 
-    0x21c78641, 0xdf413142, 0x86422005, 0x86422027, 0x86432027, 0x8643201f, 0x8643207f, 0x864320bf, 0x864320a7, 0x864420ff, 0x8644203f, 0x8644203f, 
-    0x86442087, 0x86442087, 0x8644204f, 0x86442077, 0x31452157, 0x45207785, 0x45203786, 0x4520c786, 0x45203f86, 0x45203f86, 0x45203f86, 0x45203f86, 
-    0x46213f86, 0x203f8531, 0x203f8646, 0x203f8646, 0x203f8646, 0x223f8546, 0x84313135, 0x31352127, 0x35214785, 0x20478631, 0x20cf8641, 0x20378641, 
-    0x200f8644, 0x210f8544, 0x0f853933, 0x2f433320, 0x42332106, 0x3520ef85, 0x20060743, 0x06074335, 0x07433520, 0x33352106, 0x35202f85, 0x2106f742, 
-    0xdf413335, 0x42352005, 0x352006e7, 0x2006e742, 0x06e74235, 0xdf423520, 0x33352106, 0xd7429786, 0x33352106, 0x35219f85, 0x05ff4133, 0xd7423520, 
-    0x42352006, 0x352006d7, 0x2006d742, 0x06d74235, 0xd7423520, 0x42352006, 0x352006cf, 0x2006cf42, 0x06c74235, 0xd7423520, 0x42352006, 0x352006cf, 
-    0x2006cf42, 0x06b74235, 0xb7423520, 0x34352106, 0x3420df86, 0x7f427f86, 0x34352106, 0x20056f41, 0x06c74335, 0xc7433520, 0x42352006, 0x35200697, 
-    0x2006ff43, 0x06df4235, 0xef423520, 0x42352006, 0x352106df, 0x067f4136, 0x20069745, 0x06c74235, 0x41363521, 0x3620062f, 0x21056f41, 0x2f413635, 
-    0x41362006, 0x352105bf, 0x05674236, 0x41363521, 0x362006c7, 0x21054f43, 0x2f413635, 0x86362006, 0x863620af, 0x413620af, 0x3620062f, 0x3721af86, 
-    0x05f74130, 0x7f863720, 0x20060f46, 0x063f4335, 0x86373521, 0x8637207f, 0x8637207f, 0x8637207f, 0x8637207f, 0x8637207f, 0x8637207f, 0x8637207f, 
-    0x8637207f, 0x4437217f, 0x7f866786, 0x7f863720, 0x7f863820, 0x7f863820, 0x47433820, 0x38352105, 0x2105af42, 0x7f863835, 0x7f863820, 0x7f863820, 
-    0x7f843820, 0x46303121, 0x0782052f, 0x07823f84, 0x07823f84, 0x07823f84, 0x07823f84, 0x07823f84, 0x07823f84, 0xbf843f87, 0xbf840f82, 0xbf840782, 
-    0xbf840782, 0xbf840782, 0xbf840782, 0xbf840782, 0xbf840782, 0x46303121, 0x07820577, 0xdf833120, 0x7f860782, 0x8205af43, 0x437f860f, 0x0f8205b7, 
-    0xbf437f86, 0x860f8205, 0x05c7437f, 0x7f860f82, 0x8205cf43, 0x437f860f, 0x0f8205d7, 0xdf437f86, 0x30312105, 0x8205b746, 0x467f8607, 0x0f8205bf, 
-    0x9743ff86, 0x860f8205, 0x05cf46ff, 0xff860f82, 0x8205d746, 0x20ff860f, 0x207f8646, 0x21778446, 0x77493232, 0x2d068205, 0x6e6f0846, 0x69687465, 
-    0x74096472, 0x08846f77, 0x82097321, 0x69652b12, 0x68746867, 0x7268740c, 0x0b856565, 0x660b7324, 0x0b877669, 0x65730c25, 0x866e6576, 0x75072318, 
-    0x5282696e, 0x6509392a, 0x616c6378, 0x6c62646d, 0x302d1184, 0x750d3734, 0x7265646e, 0x726f6373, 0x21158865, 0x1d853631, 0x21056a49, 0xf2433032, 
-    0x20078205, 0x43178545, 0x322105f2, 0x05ca4330, 0x2f860782, 0x8205c243, 0x82d2840f, 0x84422007, 0x3145222f, 0x20078638, 0x22078546, 0x860f4532, 
-    0x776f2887, 0x61632e6e, 0x830c6573, 0x8427829f, 0x7111290c, 0x74736575, 0x646e6f69, 0x36841e87, 0x44383022, 0x86850786, 0xf9494520, 0x45322105, 
-    0x8205f949, 0x84322007, 0x8745201f, 0x05f942b6, 0x37303222, 0x37202f85, 0x2105b143, 0xb1433732, 0x20078205, 0x202f8441, 0x05b14337, 0x79410f82, 
-    0x43372005, 0x0f8205b1, 0xb6853787, 0xb1433720, 0x37322105, 0x8205b143, 0x206f8507, 0x05b14337, 0x34200f82, 0xb1434f85, 0x37322305, 0x0f853543, 
-    0x1e414320, 0x43392005, 0x32220539, 0x0e413839, 0x47392005, 0x322e0511, 0x0a383939, 0x75676966, 0x61646572, 0x32836873, 0x41303022, 0xf448ea86, 
-    0x30322105, 0x82052446, 0x0d352e07, 0x746f7571, 0x76657265, 0x65737265, 0x058f4164, 0xa0853120, 0xe2453020, 0x30322105, 0x8205e245, 0x20788507, 
-    0x05e24530, 0x45373222, 0x37200f85, 0x82050243, 0x2088850f, 0x05024337, 0x10410f82, 0x07024306, 0x84424621, 0x3535218d, 0x30211784, 0x06fa4735, 
-    0xf2483520, 0x49352006, 0x3520060a, 0x2106b248, 0x87843535, 0x38353023, 0x20378539, 0x21378438, 0x17863032, 0x30413022, 0x3020af85, 0x31200787, 
-    0x48410f86, 0x30302205, 0x410f8633, 0x30210548, 0x05404130, 0x624b3020, 0x30322105, 0x8205624b, 0x20b78507, 0x05a24b30, 0x67860f82, 0x7f843220, 
-    0x45462408, 0x630d4646, 0x6e6f6c6f, 0x656e6f6d, 0x79726174, 0x6e6f6404, 0x75450467, 0x6c046f72, 0x06617269, 0x82736570, 0x20a38417, 0x07cb4245, 
-    0x664b9b87, 0x30322105, 0x82057647, 0x05334107, 0x86413021, 0x84412073, 0x861782db, 0x07a94173, 0x8205864b, 0x21838417, 0x8e4b3032, 0x20078205, 
-    0x4bd38531, 0x0f820596, 0x4220e386, 0x4220e386, 0x4220e386, 0x24085f86, 0x61053942, 0x656c676e, 0x7473610c, 0x73697265, 0x74616d6b, 0x69630e68, 
-    0x656c6372, 0x746c756d, 0x796c7069, 0x250e850a, 0x73756c70, 0xda826309, 0x65757228, 0x6407746e, 0x2b83746f, 0x82650721, 0x250f8228, 0x706d6508, 
-    0xe8827974, 0x71650b2f, 0x61766975, 0x636e656c, 0x78650b65, 0x2a578269, 0x6169746e, 0x7267086c, 0x82696461, 0x690a2429, 0x8265746e, 0x626c220c, 
-    0x220a8874, 0x830c7074, 0x73723315, 0x69746365, 0x6c0a6e6f, 0x6369676f, 0x6e616c61, 0x0a860964, 0x0a726f25, 0x86746f6e, 0x8209206c, 0x7573220a, 
-    0x296d8262, 0x74726f0a, 0x6f676f68, 0x6244616e, 0x43372905, 0x72700c32, 0x7265706f, 0x0e201f85, 0x11830c87, 0x84746521, 0x8232821b, 0x6c612863, 
-    0x6665720c, 0x8678656c, 0x850c8728, 0x720d2328, 0x79867665, 0x07346b82, 0x696d6973, 0x0872616c, 0x68637573, 0x74616874, 0x65687409, 0x6f223082, 
-    0x6e416572, 0x05054905, 0x37303222, 0x4706a641, 0x0f820515, 0x2005e343, 0x079a4230, 0x85423821, 0x8538202f, 0x30322117, 0x2105ae41, 0x9e413032, 
-    0x30322105, 0x32213f85, 0x431f8730, 0x32200598, 0x21057d4e, 0xa0433232, 0x31322106, 0x2005d641, 0x06ea4432, 0xcd493220, 0x861f8205, 0x06934437, 
-    0x87323221, 0x4347860f, 0x322006aa, 0x21058d49, 0xaa433232, 0x49322006, 0x0f82058d, 0x20056e42, 0x058d4932, 0xaf850f82, 0x92453220, 0x49322006, 
-    0x3221056d, 0x056d4932, 0x87860782, 0x82056d49, 0x05be420f, 0x65493220, 0x860f8205, 0x8634204f, 0x055d49d7, 0x97861782, 0x82055d49, 0x05fb440f, 
-    0x5d493220, 0x32322105, 0x82055d49, 0x07312407, 0x82696e75, 0x05b24307, 0x5d493220, 0x410f8205, 0x5d49062f, 0x860f8205, 0x053d4c77, 0xde420f82, 
-    0x4c322005, 0x0f82057d, 0x52447f86, 0x860f8205, 0x0552447f, 0x7f860f82, 0x21053a44, 0x9d493232, 0x86078205, 0x058d49df, 0x37200f82, 0xdb458f85, 
-    0x45322006, 0x322006db, 0x2006c345, 0x05754932, 0x96432782, 0x45322005, 0x322006c3, 0x2006c345, 0x05754932, 0x45323221, 0x322006c3, 0x82057549, 
-    0x0596430f, 0x75493220, 0x860f8205, 0x05754967, 0x47410f82, 0x065f4206, 0x5f423220, 0x49322006, 0x1f820575, 0x4606df41, 0x3220067b, 0x21057549, 
-    0x75493232, 0x20078205, 0x49b78531, 0x0f82055d, 0x20061f41, 0x42578638, 0x3220069f, 0x20069f42, 0x06fb4632, 0x41383221, 0x38200617, 0xad51cf86, 
-    0x32322105, 0x8205dd4e, 0x06974107, 0x82057d4d, 0x0697410f, 0x82055550, 0x4d67860f, 0x0f820585, 0x4d068741, 0x0f82058d, 0x20068741, 0x20bf8639, 
-    0x206f8639, 0x456f8639, 0x32210626, 0x45bf8641, 0x3220062e, 0x2105c54d, 0xb54c3232, 0x32322105, 0x2006ee44, 0x05b54d32, 0x87860f82, 0x2006ee44, 
-    0x06ee4432, 0xbd4d3220, 0x32322105, 0x82059550, 0x47278607, 0x32210633, 0x20878643, 0x4d878643, 0x322105f5, 0x057d4a32, 0x87860782, 0xc7864420, 
-    0x8205cd4d, 0x4dc78617, 0x0f8205d5, 0xdd4d3f86, 0x32322105, 0x82053d4a, 0x503f8607, 0x0f8205bd, 0x50065f42, 0x0f8205c5, 0x47060742, 0x3220063a, 
-    0x20063a47, 0x05d55032, 0xaf411f82, 0x05154a06, 0x51333221, 0x078205fd, 0x33201785, 0x21063f44, 0xb7433033, 0x41332005, 0x33210667, 0x209f8539, 
-    0x06674133, 0x67413320, 0x41332006, 0x33200667, 0x20066741, 0x06674133, 0x67413320, 0x41332006, 0x33200667, 0x20066741, 0x06a64633, 0x43413321, 
-    0x3321056f, 0x05a74241, 0xae463320, 0x46332006, 0x332006ae, 0x21053552, 0x654f3332, 0x86078205, 0x06be467f, 0xbe463320, 0x51372006, 0x322105dd, 
-    0x061f4137, 0x0a483920, 0x39322205, 0x055f4146, 0x85463921, 0x304128c7, 0x6e750730, 0x47413269, 0x32210572, 0x05fd4c41, 0x42210782, 0x22178205, 
-    0x82096e6f, 0x65762d05, 0x6c617372, 0x72726107, 0x7075776f, 0x31232f84, 0x840a3739, 0x6972240f, 0x86746867, 0x09382112, 0x64231284, 0x866e776f, 
-    0x85392011, 0x656c2211, 0x20238766, 0x23118536, 0x68746f62, 0x75220985, 0x2d866470, 0xa2414620, 0x53312005, 0x32210528, 0x06624131, 0x684f3120, 
-    0x31322105, 0x8205684b, 0x05924107, 0xca863120, 0xca863120, 0xfa863120, 0x784b3120, 0x41312006, 0x3120069a, 0x20069a41, 0x06224131, 0xa2413120, 
-    0x41312006, 0x312006a2, 0x2006a241, 0x06a24131, 0xa2413120, 0x41312006, 0x312006a2, 0x2006a241, 0x06a24131, 0xa2413120, 0x41312306, 0xef840c37, 
-    0x6221c183, 0x05af4673, 0x6f423120, 0x4c312006, 0x322205ad, 0xac864231, 0x2006bf41, 0x06bf4131, 0xbf413120, 0x41312106, 0x2005bf41, 0x05255131, 
-    0x8f412f82, 0x51312005, 0x0f82052d, 0x20050744, 0x067f4331, 0x34423124, 0x7582630e, 0x67616923, 0x05555965, 0x20056941, 0x05364242, 0x42423121, 
-    0x31200536, 0x22069643, 0x85314631, 0x05d44c1f, 0xfe414e82, 0x51312005, 0x0f82057c, 0x42207e86, 0x21059e43, 0x5e434231, 0x42312105, 0x20052644, 
-    0x05745431, 0x54313221, 0x07820574, 0xe6438e86, 0x43312106, 0x20054642, 0x05a45131, 0xf6431f82, 0x4b312005, 0x31200632, 0x2006fe43, 0x05cc5131, 
-    0x0e411f82, 0x86432006, 0x42432087, 0x64220646, 0x59426c62, 0x37442207, 0x21e0820d, 0x1282776f, 0x210a5c42, 0x6c413844, 0x42158205, 0x4421095f, 
-    0x42148839, 0x44210962, 0x23148836, 0x68746f62, 0x6c51ff85, 0x867f8205, 0x068644e7, 0x86443120, 0x44312006, 0x31200676, 0x20067644, 0x063e4331, 
-    0x76443120, 0x43312006, 0x31200646, 0x21054c52, 0x66443132, 0x4e312006, 0x0f8205a4, 0x44067741, 0x3120064e, 0x2006894b, 0x066e4431, 0x7e433120, 
-    0x55312006, 0x2f820534, 0x3c558786, 0x410f8205, 0x8c4e066f, 0x31322105, 0x82056c52, 0x064f4107, 0x8205744e, 0x2037860f, 0x06a74146, 0x37854620, 
-    0xe6483320, 0x52372006, 0x3222054c, 0x1e463937, 0x46372005, 0x3720061e, 0x20065343, 0x06534337, 0x1b433720, 0x43372006, 0x3720061b, 0x20061343, 
-    0x06134337, 0x13433720, 0x4b422006, 0x422006b1, 0x20060e45, 0x06064542, 0xc14b4220, 0x45422006, 0x4220060e, 0x2006e14b, 0x06c94b42, 0x66494220, 
-    0x30422106, 0x3720af85, 0x20065343, 0x06534337, 0x53433720, 0x43372006, 0x37200653, 0x20065343, 0x06f64437, 0xf6443720, 0x43372006, 0x37200636, 
-    0x20063643, 0x06364337, 0x36433720, 0x43372006, 0x372006d3, 0x2006fb43, 0x06464337, 0x3e433720, 0x46372006, 0x372006be, 0x20063e43, 0x06274337, 
-    0xbe463720, 0x4b372006, 0x372006bd, 0x2006a643, 0x06374337, 0x47433720, 0x57372006, 0x3221057c, 0x062f4337, 0x43423721, 0x3720052f, 0x20062f43, 
-    0x062f4337, 0xbb443720, 0x41372006, 0x372006a7, 0x2006b344, 0x06534437, 0x9c513520, 0x35322105, 0x82059c51, 0x07332c07, 0x6c626e64, 0x076b636f, 
-    0x82696e75, 0x05fb440f, 0x9c513520, 0x210f8205, 0x1d860537, 0x258a7020, 0x2006dd41, 0x06344835, 0x44483520, 0x38352506, 0x666c0744, 0x6c48278a, 
-    0x48352006, 0x3525067c, 0x72073938, 0x201f8a74, 0x486d8639, 0x3520064c, 0x2006c04e, 0x06354235, 0x35423520, 0x42352006, 0x35200635, 0x20063542, 
-    0x06354235, 0x35423520, 0x42352006, 0x352b0635, 0x6c074639, 0x61687374, 0x84056564, 0x64072205, 0x2707846b, 0x38314806, 0x06333335, 0x8505e64c, 
-    0x066047e9, 0xf8473520, 0x44352106, 0x2005a144, 0x05ae5835, 0x55353221, 0x078205de, 0x2005d144, 0x05e65535, 0x09430f82, 0x43352005, 0x352006c9, 
-    0x21059651, 0x79413532, 0x41352006, 0x35200679, 0x20067941, 0x06704835, 0x99443520, 0x43352106, 0x31057944, 0x0a454335, 0x6e65706f, 0x6c6c7562, 
-    0x69097465, 0x0989766e, 0x1044a68b, 0x44352006, 0x35200610, 0x20060044, 0x06004435, 0x20443520, 0x44352006, 0x35200620, 0x82054559, 0x059043a6, 
-    0xf8443520, 0x59352006, 0x3222059d, 0xce853142, 0x44314221, 0x42210528, 0x05a04331, 0x87314221, 0x200f8596, 0x05cd5437, 0x4e353221, 0x35200676, 
-    0x2506c842, 0x0a454135, 0xb2826966, 0x65726423, 0x054b4763, 0xfb423520, 0x41352806, 0x46530846, 0x82303130, 0x20088300, 0x20088732, 0x20088733, 
-    0x20088734, 0x20088735, 0x20088736, 0x20088737, 0x20088738, 0x20088639, 0x20078331, 0x20508230, 0x83098431, 0x841a8708, 0x201a8361, 0x201a8732, 
-    0x82128432, 0x87322023, 0x87322074, 0x87322074, 0x87322074, 0x87322074, 0x87322074, 0x87332074, 0x8733201a, 0x8833201a, 0x8474871a, 0x2174834f, 
-    0xa1863134, 0x74873420, 0x74873420, 0x24843420, 0x34208682, 0x34207487, 0x34205987, 0x34205987, 0x34205987, 0x2b845987, 0x35215983, 0x20598631, 
-    0x20598735, 0x20598735, 0x20598435, 0x05824109, 0x786f6224, 0xf2824806, 0x20066b4c, 0x06dc4435, 0xdc443520, 0x31422106, 0x2005dc46, 0x06e44435, 
-    0xe4443520, 0x44352006, 0x352006e4, 0x2006e444, 0x06e44435, 0x39413529, 0x38314806, 0x84333435, 0x05f75606, 0x4a353221, 0x352006a1, 0x20065246, 
-    0x06524635, 0x7f5b3520, 0x471f8205, 0x3520057a, 0x20063246, 0x06ea4735, 0xea473520, 0x46352006, 0x35200642, 0x20061e49, 0x06164935, 0x45463521, 
-    0x35280592, 0x74074546, 0x67616972, 0x22067747, 0x85364235, 0x068e490f, 0xfa473520, 0x45352006, 0x3520063a, 0x20061245, 0x06fa4435, 0x12483520, 
-    0x46352006, 0x352006d2, 0x82055f55, 0x21578697, 0x4f857472, 0x43666c21, 0x424505f8, 0x48352006, 0x3520061a, 0x20067a45, 0x06724535, 0x4a453520, 
-    0x4c352006, 0x35200649, 0x2006a245, 0x069a4535, 0x92483520, 0x48352006, 0x3520067a, 0x20066149, 0x068a4735, 0x8a473520, 0x49352006, 0x35200681, 
-    0x21059759, 0x22473532, 0x4a352006, 0x3520062e, 0x2006464a, 0x06215035, 0xac523520, 0x47352006, 0x35200642, 0x2006ca46, 0x06fa4635, 0xea463520, 
-    0x47352006, 0x35200602, 0x2006e246, 0x060a4735, 0x41303521, 0xea460687, 0x50352006, 0x35210651, 0x06094430, 0x2205175a, 0x49313532, 0x3520053a, 
-    0x21066150, 0x84453135, 0x06194406, 0x19443520, 0x44352006, 0x45420711, 0x86312007, 0x4131205f, 0x312006b7, 0x2105fa47, 0x5f863135, 0x22055f5f, 
-    0x45323532, 0x5f5f0648, 0x4d0f8205, 0x35200501, 0x20065555, 0x05475f35, 0x81441782, 0x32352105, 0x20057144, 0x054f5f35, 0xb5421782, 0x05375f06, 
-    0x6f860f82, 0x8205f75e, 0x5d6f860f, 0x322105a7, 0x06995135, 0x82069f5a, 0x5a6f860f, 0x0f820597, 0x5a05f144, 0x0f820697, 0x33206f86, 0x5106f144, 
-    0x975a0609, 0x861f8206, 0x8633206f, 0x06d053df, 0x8f5a3520, 0x5a322005, 0x0782068f, 0x5a064741, 0x0f82058f, 0x56061846, 0x8f5a06c4, 0x86178206, 
-    0x863420e7, 0x058f5a77, 0xe7861782, 0x5a063151, 0x1782068f, 0x8f5a7f86, 0x860f8205, 0x068150ef, 0x81503520, 0x59352006, 0x322105f7, 0x06815035, 
-    0x81503520, 0x50352006, 0x35200681, 0x50071544, 0x35200681, 0x20064556, 0x06815035, 0xf7593520, 0x863f8205, 0x05f75997, 0x97860f82, 0x20068150, 
-    0x06815035, 0x86373521, 0x06815097, 0x81503520, 0x33303605, 0x61093646, 0x65747563, 0x626d6f63, 0x746f640c, 0x6f6c6562, 0x240c8377, 0x61726709, 
-    0x27168476, 0x6f6f680d, 0x6f62616b, 0x09240d85, 0x646c6974, 0x06201784, 0x2907ad62, 0x3530696e, 0x63053935, 0x05853436, 0x83303621, 0x3136210b, 
-    0x38200584, 0x37200583, 0x37211184, 0x200b8432, 0x85058437, 0x84352017, 0x0736250b, 0x45696e75, 0x82061056, 0x86312007, 0x8532200f, 0x05c54607, 
-    0x46304521, 0x078205c5, 0x333b1787, 0x706c4105, 0x42046168, 0x05617465, 0x6d6d6147, 0x70450761, 0x6f6c6973, 0x825a046e, 0x45032112, 0x54211682, 
-    0x22098268, 0x826f4904, 0x4b2f080a, 0x61707061, 0x6d614c06, 0x02616462, 0x4e02754d, 0x69580275, 0x696d4f07, 0x6e6f7263, 0x03695002, 0x056f6852, 
-    0x6d676953, 0x61540361, 0x85550775, 0x5003254a, 0x43036968, 0x50220382, 0x8f836973, 0x41333024, 0x77840a39, 0x6e6f7425, 0x860c736f, 0x200c8471, 
-    0x84718208, 0x83092008, 0x20098470, 0x855f860c, 0x8453860c, 0x4f0a250c, 0x6167656d, 0x0c200a84, 0x64212e83, 0x05676569, 0x24860f20, 0x05210f87, 
-    0x20e48461, 0x21c78262, 0xe4836705, 0x65640527, 0x0761746c, 0x219f8565, 0x18827a04, 0x03820320, 0x84740521, 0x836920ea, 0x846b20ea, 0x856c20ea, 
-    0x756e26ea, 0x07697802, 0x25e7856f, 0x6f687203, 0xe4837306, 0x84053121, 0x74032106, 0x7520eb82, 0x03214b85, 0x20e78270, 0x82038263, 0x6f05210e, 
-    0x09209e83, 0xa3854e83, 0x93870983, 0x0c8b1120, 0x42861e85, 0x0f200c84, 0x2e870c86, 0x0f8e1420, 0x0c202484, 0x0c849186, 0x6d840a20, 0xef840a85, 
-    0x86055c41, 0x055c41e3, 0x0884e382, 0x657a092d, 0x732e6f72, 0x08736275, 0x85656e6f, 0x77742108, 0x0a241185, 0x65726874, 0x09241385, 0x72756f66, 
-    0x09231d84, 0x85766966, 0x73082313, 0x12847869, 0x65730a25, 0x856e6576, 0x6965240a, 0x84746867, 0x6e09220a, 0x25508669, 0x696e7507, 0xbf543132, 
-    0x49312006, 0x3120064f, 0x2006bf54, 0x05fd6031, 0x85441f82, 0x59312005, 0x0f820512, 0x37863020, 0x07843120, 0xdd433020, 0x43302006, 0x302006c5, 
-    0x2006c543, 0x06c54330, 0xc5433020, 0x54302006, 0x30290647, 0x44053937, 0x61746c65, 0x20e78405, 0x073e410d, 0x053e0d84, 0x3335315f, 0x65700e31, 
-    0x646f6972, 0x746e6563, 0x64657265, 0x01000000, 0xffff0100, 0x09820f00, 0xc33c029b, 0x9c00c300, 0xd5059c00, 0x60040000, 0x56fe0000, 0x1dfe6d07, 
-    0xe3fff005, 0xe3ff7b04, 0x21820d85, 0x06252388, 0xff600414, 0x212589e7, 0x27822106, 0x278e0f86, 0x4d8b6220, 0x4f893782, 0xb0002d08, 0xb0202c00, 
-    0x45585500, 0xb0202059, 0x20666028, 0xb058558a, 0xb9612502, 0x00080008, 0x62236363, 0xb021211b, 0x00b05900, 0xb2442343, 0x3608c882, 0x2d426043, 
-    0xb02c01b0, 0x2d666020, 0x202c02b0, 0xc0b02064, 0x2604b050, 0x0128b25a, 0x6345430a, 0x585b5245, 0x1b212321, 0xb020588a, 0x21585050, 0x1b5940b0, 
-    0x8338b020, 0x59382409, 0x85b12059, 0x64612324, 0x128228b0, 0x20220d86, 0x0c8230b0, 0x8330b021, 0x50c02329, 0x84822058, 0x20618a27, 0x58500ab0, 
-    0x203b8260, 0x201b8320, 0x2009830a, 0x3f098336, 0x601b6036, 0x1b595959, 0x592b01b0, 0x00b02359, 0x59655850, 0x03b02d59, 0x2045202c, 0x612504b0, 
-    0x052b9082, 0xb0585043, 0xb0422305, 0x82422306, 0xb05928be, 0xb02d6001, 0x82232c04, 0x64202697, 0x426205b1, 0x85198320, 0x2805837c, 0x456003b0, 
-    0x2a03b063, 0x24178221, 0x208a2043, 0x235b828a, 0x250530b1, 0x512ad682, 0x1b506058, 0x58595261, 0x1d825923, 0x58534022, 0x1b201a82, 0x7986d483, 
-    0x05b02d31, 0x4307b02c, 0x0200b22b, 0x42604300, 0x8206b02d, 0x42232f0e, 0x00b02023, 0xb0614223, 0xb0666202, 0x7f826301, 0x2a05b027, 0x2c07b02d, 
-    0x26a48320, 0xb863430b, 0x82620004, 0x22a68222, 0x83596040, 0x44602122, 0x082aa484, 0x0b07b22c, 0x42454300, 0x6c41212a, 0x2c092108, 0x200d7c41, 
-    0x2145850a, 0x82822b01, 0xf1824320, 0x45206026, 0x2061238a, 0x2028f782, 0xb0215850, 0x30b01b00, 0x20235782, 0x4140b01b, 0xb025081f, 0x61232503, 
-    0x20628544, 0x213e960b, 0x358224b0, 0x40203c82, 0x8b075441, 0x2c0c2134, 0xb23cd084, 0x45030a0b, 0x231b2158, 0x212a5921, 0x2c0db02d, 0x450202b1, 
-    0x446164b0, 0x2c0eb02d, 0x2029c082, 0x430cb020, 0x5000b04a, 0x24088258, 0xb0594223, 0x200d830d, 0x200d8252, 0x220d820d, 0x820fb02d, 0x62102146, 
-    0x2024ef83, 0x630004b8, 0x2708b682, 0x60430eb0, 0x20608a20, 0x42230eb0, 0x10b02d23, 0x58544b2c, 0x446404b1, 0x0db02459, 0x2d782365, 0x4b2c11b0, 
-    0x534b5851, 0x1b211485, 0x20178221, 0x3c178413, 0x00b12c12, 0x5855430f, 0x430f0fb1, 0x426101b0, 0x592b0fb0, 0xb04300b0, 0xb1422502, 0x2004830c, 
-    0x2404820d, 0x231601b0, 0x2dc78220, 0x01b15850, 0xb0604300, 0x8a422504, 0x7684208a, 0x23212a22, 0x0b873682, 0x1f851b20, 0x02273283, 0x0eb06125, 
-    0x8259212a, 0x824720c9, 0x604723bf, 0xaa4102b0, 0xb020210d, 0x0814c041, 0x0000b130, 0xb0442313, 0x00b04301, 0x0101b23e, 0x42604301, 0x2c13b02d, 
-    0x0200b100, 0xb0585445, 0x2042230f, 0x230bb045, 0x230ab042, 0x426003b0, 0x7e826020, 0x1010b537, 0x000e0001, 0x608a4242, 0x2b0612b1, 0x1b2b75b0, 
-    0xb02d5922, 0x27db8214, 0xb02d2b13, 0x01b12c15, 0x16230783, 0x8302b12c, 0x2c172307, 0x078303b1, 0xb12c1823, 0x23078304, 0x05b12c19, 0x1a230783, 
-    0x8306b12c, 0x2c1b2307, 0x078307b1, 0xb12c1c23, 0x23078308, 0x09b12c1d, 0x29290783, 0xb02e202c, 0xb02d5d01, 0x2308842a, 0x2bb02d71, 0x72280884, 
-    0x2c1eb02d, 0x2b0db000, 0x1f20a3b2, 0x1e20a382, 0x2020a382, 0x0783a382, 0xa3822120, 0x22200783, 0x0783a382, 0xa3822320, 0x24200783, 0x0783a382, 
-    0xa3822520, 0x26200783, 0x0783a382, 0xa3822720, 0x28200783, 0x0783a382, 0x202c2c32, 0x6001b03c, 0x2c2db02d, 0x10b06020, 0x23432060, 0x43240e82, 
-    0x612502b0, 0xb0350782, 0x2d212a2c, 0xb02c2eb0, 0x2db02b2d, 0x2fb02d2a, 0x4720202c, 0x16894120, 0x38612327, 0x558a2023, 0x25219c58, 0x2d59211b, 
-    0x9e4130b0, 0x16012e08, 0xb12a2fb0, 0x45150105, 0x1b593058, 0x201b8222, 0x0b194131, 0x32231e91, 0x8435202c, 0x823320af, 0x45012127, 0x2211d143, 
-    0x422b01b0, 0x17831428, 0xb4160023, 0x27008300, 0x38233e44, 0x150132b1, 0x3420d182, 0xb082ff82, 0x602f3294, 0x614300b0, 0x35b02d38, 0x3c172e2c, 
-    0x9f36b02d, 0x01b0232a, 0x2e826343, 0xb12c373c, 0x25160002, 0x47202e20, 0x422300b0, 0x492502b0, 0x23478a8a, 0x20612347, 0xff826258, 0x2301b029, 
-    0x0136b242, 0x82141501, 0x2c38277f, 0xb01600b0, 0x02822504, 0xb02b2284, 0x652b4309, 0x20232e8a, 0x828a3c20, 0x8939204b, 0x2e20211e, 0x20222084, 
-    0x538204b0, 0x203e2582, 0x585060b0, 0x5140b020, 0x2002b358, 0xb31b2003, 0x1a032602, 0x23424259, 0x4308b020, 0x6f828a20, 0x23257182, 0x04b06046, 
-    0x0f4a4343, 0xb0206036, 0x8a202b01, 0xb020618a, 0x64604302, 0x4303b023, 0x58506461, 0x61210c82, 0x240b821b, 0x03b05960, 0x20338f25, 0x28928261, 
-    0x232604b0, 0x1b386146, 0x20618223, 0x82d78246, 0x82938406, 0x8264924f, 0x2b012288, 0x207e8223, 0x236d8260, 0x612505b0, 0x558f0382, 0x84825182, 
-    0x84250421, 0x20058284, 0x05e54450, 0x592d6b89, 0x2c3ab02d, 0x201600b0, 0x05b02020, 0x06034126, 0x383c2325, 0x843bb02d, 0x08b02316, 0x1b824223, 
-    0x47234622, 0x23216482, 0x20178261, 0x8417833c, 0x842520c0, 0x00b0299c, 0x202e5854, 0x1b21233c, 0x0220b183, 0x4c821485, 0x21097241, 0x99822506, 
-    0x7d474920, 0x05a8410b, 0x21115c42, 0x99412360, 0x21232106, 0x3d209882, 0x43208186, 0x20259686, 0x6020b060, 0x41e28f66, 0x3e2507ca, 0x2e20232c, 
-    0x2e658246, 0x20585246, 0xb12e593c, 0x2b14012e, 0x883fb02d, 0x8b502016, 0x8d402016, 0x8c3a872d, 0x2c412423, 0x942b38b0, 0x2c422e54, 0x8a2b39b0, 
-    0xb03c2020, 0x8a422304, 0x25239238, 0x2e4304b0, 0x7f822eb0, 0x61424320, 0x075d4108, 0x4309b022, 0x3c245582, 0x38232e20, 0x4426a386, 0x0408b12c, 
-    0xa9424225, 0x298a4208, 0x7d424720, 0x02b02447, 0x82614625, 0x233c26c8, 0x20211b38, 0x08ef4120, 0x86592121, 0x2c4524a3, 0x412b38b0, 0x46200754, 
-    0x2121ff83, 0x06004123, 0xf288c786, 0xf2824720, 0x9c431520, 0x00b22d05, 0x14150101, 0x34b02e13, 0x48b02d2a, 0x49281796, 0x0100b12c, 0x35b01314, 
-    0x4a232382, 0x8237b02c, 0x824b2006, 0x4516292a, 0x202e2023, 0x61238a46, 0x30072741, 0x08b02c4c, 0x4bb04223, 0x4db02d2b, 0x0000b22c, 0x20088244, 
-    0x2008824e, 0x23088301, 0x01b22c4f, 0x50201184, 0x11840882, 0x1a825120, 0x82450021, 0x82522023, 0x83012008, 0x82532008, 0x2011841a, 0x84088254, 
-    0x82552011, 0x4100211a, 0x56202382, 0x01200882, 0x57200883, 0x11841a82, 0x08825820, 0x59201184, 0x00211a82, 0x20238243, 0x2008825a, 0x20088301, 
-    0x841a825b, 0x825c2011, 0x20118408, 0x211a825d, 0x23824600, 0x08825e20, 0x08830120, 0x1a825f20, 0x60201184, 0x11840882, 0x1a826120, 0x82420021, 
-    0x82622023, 0x83012008, 0x82632008, 0x2011841a, 0x84088264, 0x2c652311, 0x66413ab0, 0x83662008, 0x3eb0210c, 0x67203182, 0x3f200984, 0x68240982, 
-    0x1600b02c, 0xb0212382, 0x230c8240, 0x3bb02c69, 0x6a202d88, 0x2d840c83, 0x09846b20, 0x20823f20, 0x09846c20, 0x6d232a83, 0x883cb02c, 0x836e202a, 
-    0x202a840c, 0x8309846f, 0x8470202a, 0x82402009, 0x2c712334, 0x2a883db0, 0x0c837220, 0x73202a84, 0x2a830984, 0x09847420, 0x75252a83, 0x0409b32c, 
-    0x073c4902, 0xb02b4229, 0x03b06508, 0x46785024, 0x2d2e0772, 0x01b84b00, 0xb158525e, 0x598e0101, 0x7d4b01b0, 0xb1702b05, 0xb4420600, 0x031c3044, 
-    0x0a832a00, 0x0837b728, 0x07110823, 0x0d850803, 0x2d064125, 0x84051a06, 0x42092c0d, 0x09000ebc, 0x00800400, 0x82090003, 0x420c241d, 0x844000bc, 
-    0x320f8401, 0xb1440003, 0x51880124, 0x8840b058, 0x6403b158, 0x8326b144, 0x08ba290d, 0x04010080, 0x54638840, 0x00221482, 0x00825944, 0x0839b732, 
-    0x07130825, 0xb82a0c03, 0xb085ff01, 0x02b18d04, 0x053d3b82, 0x64614464, 0x7473756a, 0x6275732d, 0x70796c67, 0x3d207368, 0x640a3020, 0x75616665, 
-    0x2415826c, 0x70697263, 0x37128274, 0x6e74616c, 0x2d77640a, 0x61656c63, 0x70797472, 0x74732d65, 0x676e6f72, 0x65270682, 0x69772d6d, 0x84687464, 
-    0x61662938, 0x61626c6c, 0x732d6b63, 0x1689398c, 0x2e8a7420, 0x31383126, 0x6964670a, 0x2382549e, 0x79617222, 0x68246f96, 0x69746e69, 0x6c238682, 
-    0x83696d69, 0x353323a7, 0x13870a30, 0x6e617228, 0x6d2d6567, 0x99827861, 0x16903820, 0x826e6921, 0x84342016, 0x632d292c, 0x6f706d6f, 0x65746973, 
-    0x6928fd85, 0x726f6e67, 0x65722d65, 0x6925e382, 0x6f697463, 0x2e17866e, 0x6572636e, 0x2d657361, 0x65682d78, 0x83686769, 0x0a302770, 0x626d7973, 
-    0xfd846c6f, 0x46545428, 0x6e692d41, 0x0d826f66, 0x770a3128, 0x6f646e69, 0x5d847377, 0x69746128, 0x696c6962, 0x19847974, 0x2d253f87, 0x70616e73, 
-    0x24bf8370, 0x65637865, 0x27698770, 0x6e6f630a, 0x6c6f7274, 0x73234a82, 0x88757274, 0x0a0a2481, 0x05000000, 0x8a1428fa, 0x0000009d, 
-};
-
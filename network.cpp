@@ -26,15 +26,37 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 #include "network.hpp"
 #include "app_logger.hpp"
 #include "thread.hpp"
+#include "trace.hpp"
 
 #include <boost/asio/ssl.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <ranges>
 #include <string>
+#include <thread>
 #include <fstream>
 #include <sstream>
 #include <utility>
 #include <filesystem>
 #include <bits/fs_path.h>
+#if defined(__AVX2__) || defined(__SSE2__) || defined(__SSSE3__) || (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#include <immintrin.h>
+#endif
+#include <zlib.h>
+#ifdef EASYAPPBASE_BROTLI
+#include <brotli/decode.h>
+#endif
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 #include <boost/beast/version.hpp>
 
 namespace Network
@@ -116,59 +138,410 @@ namespace Network
 		#endif
 	}
 
-	std::string URLEncode(const std::string &in)
+	// The pshufb loops are built for SSSE3 and AVX2 whatever the compile flags and picked at run time, since the
+	// default x86-64 target has neither.  Compilers without target attributes only get what their flags allow.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SWAP_DISPATCH 1
+#define SWAP_TARGET(sTarget) __attribute__((target(sTarget)))
+#else
+#define SWAP_TARGET(sTarget)
+#endif
+#if defined(SWAP_DISPATCH) || defined(__AVX2__) || defined(__SSSE3__)
+	// Reverses the bytes inside every iSize-byte lane.
+	template <size_t iSize>
+	static constexpr auto aSwapShuffle = []
+	{
+		std::array<char, 32> ret{};
+		for (size_t i = 0; i < ret.size(); ++i) {
+			ret[i] = static_cast<char>((i % 16) / iSize * iSize + (iSize - 1 - i % iSize));
+		}
+		return ret;
+	}();
+
+	template <size_t iSize>
+	SWAP_TARGET("ssse3") static char * SwapSSSE3(char * p, const char * end)
+	{
+		auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aSwapShuffle<iSize>.data()));
+		for (; end - p >= 16; p += 16) {
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), mask));
+		}
+		return p;
+	}
+#endif
+#if defined(SWAP_DISPATCH) || defined(__AVX2__)
+	template <size_t iSize>
+	SWAP_TARGET("avx2") static char * SwapAVX2(char * p, const char * end)
+	{
+		auto mask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(aSwapShuffle<iSize>.data()));
+		for (; end - p >= 32; p += 32) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(p), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), mask));
+		}
+		return p;
+	}
+#endif
+
+	template <size_t iSize>
+	static void SwapRun(void * pData, size_t iCount)
+	{
+		auto p = static_cast<char *>(pData);
+		auto end = p + iCount * iSize;
+#if defined(SWAP_DISPATCH)
+		static const bool bAVX2 = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+		static const bool bSSSE3 = (__builtin_cpu_init(), __builtin_cpu_supports("ssse3"));
+		if (bAVX2) {
+			p = SwapAVX2<iSize>(p, end);
+		}
+		if (bSSSE3) {
+			p = SwapSSSE3<iSize>(p, end);
+		}
+#else
+#if defined(__AVX2__)
+		p = SwapAVX2<iSize>(p, end);
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+		p = SwapSSSE3<iSize>(p, end);
+#endif
+#endif
+		using uint_t = std::conditional_t<iSize == 2, uint16_t, std::conditional_t<iSize == 4, uint32_t, uint64_t>>;
+		for (; p < end; p += iSize) {
+			uint_t value;
+			std::memcpy(&value, p, iSize);
+			value = std::byteswap(value);
+			std::memcpy(p, &value, iSize);
+		}
+	}
+
+	void swapEndianness16(void * pData, size_t iCount)
+	{
+		SwapRun<2>(pData, iCount);
+	}
+
+	void swapEndianness32(void * pData, size_t iCount)
+	{
+		SwapRun<4>(pData, iCount);
+	}
+
+	void swapEndianness64(void * pData, size_t iCount)
+	{
+		SwapRun<8>(pData, iCount);
+	}
+
+	// URL coding copies runs of bytes that need no work in bulk and only handles the remaining bytes one at a time.
+	// The run scanners classify 32 (AVX2) or 16 (SSE2) bytes per step, with a scalar tail and fallback.
+	static constexpr auto aUnreserved = []
+	{
+		std::array<bool, 256> ret{};
+		for (int c = 0; c < 256; ++c) {
+			ret[c] = (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '-' || c == '_' || c == '.' || c == '~';
+		}
+		return ret;
+	}();
+
+	static constexpr int HexValue(char c)
+	{
+		return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+	}
+
+#if defined(__AVX2__)
+	static inline __m256i InRange(__m256i v, char lo, char hi)
+	{
+		// Signed compares, so bytes >= 0x80 never fall inside an ASCII range.
+		return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(static_cast<char>(lo - 1))), _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), v));
+	}
+#elif defined(__SSE2__)
+	static inline __m128i InRange(__m128i v, char lo, char hi)
+	{
+		return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(lo - 1))), _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(hi + 1)), v));
+	}
+#endif
+
+	// Number of leading bytes of [p, end) that URLEncode copies unchanged.
+	static size_t UnreservedRun(const char * p, const char * end)
+	{
+		const char * start = p;
+#if defined(__AVX2__)
+		for (; end - p >= 32; p += 32) {
+			auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+			auto ok = _mm256_or_si256(_mm256_or_si256(InRange(v, '0', '9'), InRange(v, 'A', 'Z')), InRange(v, 'a', 'z'));
+			ok = _mm256_or_si256(ok, _mm256_or_si256(InRange(v, '-', '.'), _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('~')))));
+			auto iMask = static_cast<uint32_t>(_mm256_movemask_epi8(ok));
+			if (iMask != 0xFFFFFFFFu) {
+				return static_cast<size_t>(p - start) + std::countr_one(iMask);
+			}
+		}
+#elif defined(__SSE2__)
+		for (; end - p >= 16; p += 16) {
+			auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+			auto ok = _mm_or_si128(_mm_or_si128(InRange(v, '0', '9'), InRange(v, 'A', 'Z')), InRange(v, 'a', 'z'));
+			ok = _mm_or_si128(ok, _mm_or_si128(InRange(v, '-', '.'), _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')), _mm_cmpeq_epi8(v, _mm_set1_epi8('~')))));
+			auto iMask = static_cast<uint32_t>(_mm_movemask_epi8(ok));
+			if (iMask != 0xFFFFu) {
+				return static_cast<size_t>(p - start) + std::countr_one(iMask);
+			}
+		}
+#endif
+		while (p < end && aUnreserved[static_cast<unsigned char>(*p)]) {
+			++p;
+		}
+		return static_cast<size_t>(p - start);
+	}
+
+	// Number of leading bytes of [p, end) that URLDecode copies unchanged (anything but '%' and '+').
+	static size_t PlainRun(const char * p, const char * end)
+	{
+		const char * start = p;
+#if defined(__AVX2__)
+		for (; end - p >= 32; p += 32) {
+			auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+			auto special = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('%')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('+')));
+			auto iMask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+			if (iMask) {
+				return static_cast<size_t>(p - start) + std::countr_zero(iMask);
+			}
+		}
+#elif defined(__SSE2__)
+		for (; end - p >= 16; p += 16) {
+			auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+			auto special = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('%')), _mm_cmpeq_epi8(v, _mm_set1_epi8('+')));
+			auto iMask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+			if (iMask) {
+				return static_cast<size_t>(p - start) + std::countr_zero(iMask);
+			}
+		}
+#endif
+		while (p < end && *p != '%' && *p != '+') {
+			++p;
+		}
+		return static_cast<size_t>(p - start);
+	}
+
+	std::string URLEncode(std::string_view in)
 	{
+		static constexpr char szHex[] = "0123456789ABCDEF";
 		std::string out;
+		out.resize(in.size() * 3); // Worst case, trimmed at the end.
+		char * pOut = out.data();
+		const char * p = in.data();
+		const char * end = p + in.size();
 
-		for (size_t i = 0; i < in.size(); ++i) {
-			auto & c = in[i];
-			if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
-				out += c;
-			} else if (c == '%') {
-				if (i + 2 < in.size()) {
-					if (std::isxdigit(in[i + 1]) && std::isxdigit(in[i + 2])) {
-						out += in.substr(i, 3);
-						i += 2;
-						continue;
-					}
+		while (p < end) {
+			auto iRun = UnreservedRun(p, end);
+			std::memcpy(pOut, p, iRun);
+			pOut += iRun;
+			p += iRun;
+			if (p == end) {
+				break;
+			}
+			auto c = *p++;
+			if (c == '%') {
+				if (end - p >= 2 && HexValue(p[0]) >= 0 && HexValue(p[1]) >= 0) {
+					// Already escaped.
+					*pOut++ = '%';
+					*pOut++ = *p++;
+					*pOut++ = *p++;
+				} else {
+					*pOut++ = '%';
+					*pOut++ = '2';
+					*pOut++ = '5';
 				}
-				out += "%25";
 			} else if (c == ' ') {
-				out += '+';
+				*pOut++ = '+';
 			} else {
-				out += '%';
-				out += "0123456789ABCDEF"[static_cast<unsigned char>(c) >> 4];
-				out += "0123456789ABCDEF"[static_cast<unsigned char>(c) & 15];
+				*pOut++ = '%';
+				*pOut++ = szHex[static_cast<unsigned char>(c) >> 4];
+				*pOut++ = szHex[static_cast<unsigned char>(c) & 15];
 			}
 		}
 
+		out.resize(static_cast<size_t>(pOut - out.data()));
 		return out;
 	}
 
-	std::string URLDecode(const std::string &in)
+	size_t URLDecodeInPlace(std::span<char> data)
 	{
-		std::string out;
+		// The output never outgrows the input, so writing behind the read position is safe.
+		char * pOut = data.data();
+		const char * p = data.data();
+		const char * end = p + data.size();
 
-		for (size_t i = 0; i < in.size(); ++i) {
-			if (in[i] == '%') {
-				if (i + 2 < in.size()) {
-					auto c = std::stoi(in.substr(i + 1, 2), nullptr, 16);
-					out += static_cast<char>(c);
-					i += 2;
-				}
-			} else if (in[i] == '+') {
-				out += ' ';
+		while (p < end) {
+			auto iRun = PlainRun(p, end);
+			if (pOut != p) {
+				std::memmove(pOut, p, iRun);
+			}
+			pOut += iRun;
+			p += iRun;
+			if (p == end) {
+				break;
+			}
+			if (*p == '+') {
+				*pOut++ = ' ';
+				++p;
+			} else if (end - p >= 3 && HexValue(p[1]) >= 0 && HexValue(p[2]) >= 0) {
+				*pOut++ = static_cast<char>(HexValue(p[1]) << 4 | HexValue(p[2]));
+				p += 3;
 			} else {
-				out += in[i];
+				*pOut++ = *p++; // A '%' that is not an escape is kept as is.
 			}
 		}
 
+		return static_cast<size_t>(pOut - data.data());
+	}
+
+	void URLDecodeInPlace(std::string & in)
+	{
+		in.resize(URLDecodeInPlace(std::span<char>(in.data(), in.size())));
+	}
+
+	std::string URLDecode(std::string_view in)
+	{
+		std::string out(in);
+		URLDecodeInPlace(out);
 		return out;
 	}
 
+	Buffer Buffer::Slice(size_t iOffsetIn, size_t iSizeIn) const
+	{
+		Buffer ret = *this;
+		iOffsetIn = std::min(iOffsetIn, iSize);
+		ret.iOffset += iOffsetIn;
+		ret.iSize = std::min(iSizeIn, iSize - iOffsetIn);
+		return ret;
+	}
+
+	Buffer Buffer::Slice(std::string_view sPart) const
+	{
+		return Slice(static_cast<size_t>(sPart.data() - data()), sPart.size());
+	}
+
+	struct BufferPool::State
+	{
+		mutable std::mutex mtx;
+		size_t iSlabSize;
+		size_t iMaxFreeBytes;
+		std::map<size_t, std::vector<char *>> mFree; // By slab size.
+		BufferPoolStats stats;
+
+		void Release(char * pSlab, size_t iSize)
+		{
+			std::lock_guard lock(mtx);
+			--stats.iSlabsInUse;
+			stats.iBytesInUse -= iSize;
+			if (stats.iBytesFree + iSize <= iMaxFreeBytes) {
+				mFree[iSize].push_back(pSlab);
+				++stats.iSlabsFree;
+				stats.iBytesFree += iSize;
+			} else {
+				delete[] pSlab;
+			}
+		}
+
+		void Clear()
+		{
+			for (auto & [iSize, vSlabs] : mFree) {
+				for (auto pSlab : vSlabs) {
+					delete[] pSlab;
+				}
+			}
+			mFree.clear();
+			stats.iSlabsFree = 0;
+			stats.iBytesFree = 0;
+		}
+	};
+
+	BufferPool::BufferPool(size_t iSlabSizeIn, size_t iMaxFreeBytesIn) :
+		state(std::make_shared<State>())
+	{
+		state->iSlabSize = std::bit_ceil(std::max<size_t>(iSlabSizeIn, 256));
+		state->iMaxFreeBytes = iMaxFreeBytesIn;
+		state->stats.iSlabSize = state->iSlabSize;
+	}
+
+	BufferPool::~BufferPool()
+	{
+		// Slabs still held by handlers free themselves once the state is gone.
+		std::lock_guard lock(state->mtx);
+		state->Clear();
+	}
+
+	Buffer BufferPool::Acquire(size_t iMinSize)
+	{
+		size_t iSize = std::max(state->iSlabSize, std::bit_ceil(iMinSize));
+		char * pSlab = nullptr;
+		{
+			std::lock_guard lock(state->mtx);
+			auto & stats = state->stats;
+			++stats.iAcquired;
+			auto it = state->mFree.find(iSize);
+			if (it != state->mFree.end() && !it->second.empty()) {
+				pSlab = it->second.back();
+				it->second.pop_back();
+				--stats.iSlabsFree;
+				stats.iBytesFree -= iSize;
+			} else {
+				++stats.iAllocated;
+			}
+			++stats.iSlabsInUse;
+			stats.iBytesInUse += iSize;
+			stats.iHighWaterSlabs = std::max(stats.iHighWaterSlabs, stats.iSlabsInUse);
+			stats.iHighWaterBytes = std::max(stats.iHighWaterBytes, stats.iBytesInUse);
+		}
+		if (!pSlab) {
+			pSlab = new char[iSize];
+		}
+		Buffer ret;
+		ret.pSlab = std::shared_ptr<char>(pSlab, [weak = std::weak_ptr<State>(state), iSize](char * pSlab)
+		{
+			if (auto pState = weak.lock()) {
+				pState->Release(pSlab, iSize);
+			} else {
+				delete[] pSlab;
+			}
+		});
+		ret.iSize = iSize;
+		return ret;
+	}
+
+	size_t BufferPool::SlabSize() const
+	{
+		return state->iSlabSize;
+	}
+
+	void BufferPool::MaxFree(size_t iMaxFreeBytesIn)
+	{
+		std::lock_guard lock(state->mtx);
+		state->iMaxFreeBytes = iMaxFreeBytesIn;
+		if (state->stats.iBytesFree > iMaxFreeBytesIn) {
+			state->Clear();
+		}
+	}
+
+	void BufferPool::Trim()
+	{
+		std::lock_guard lock(state->mtx);
+		state->Clear();
+	}
+
+	BufferPoolStats BufferPool::Stats() const
+	{
+		std::lock_guard lock(state->mtx);
+		return state->stats;
+	}
+
+	void BufferPool::ResetHighWater()
+	{
+		std::lock_guard lock(state->mtx);
+		state->stats.iHighWaterSlabs = state->stats.iSlabsInUse;
+		state->stats.iHighWaterBytes = state->stats.iBytesInUse;
+	}
+
 	CoreBase::CoreBase(int threadCountIn) :
 		ioc(threadCountIn),
-		sCertificates(getCertificates())
+		certificates(std::async(std::launch::async, []()
+		{
+			TRACE_ZONE_CAT("Load CA Certificates", "network");
+			return getCertificates();
+		}).share())
 	{
 		if (threadCountIn) {
 			Log(AppLogger::DEBUG) << "Network::CoreBase::CoreBase " << threadCountIn << std::endl;
@@ -225,7 +598,139 @@ namespace Network
 
 	const std::string &CoreBase::Certificates() const
 	{
-		return sCertificates;
+		return certificates.get();
+	}
+
+	void CoreBase::Resolve(const std::string &sHost, int iPort, resolve_handler_t handler)
+	{
+		auto to_endpoints = [iPort](const std::vector<net::ip::address> & vAddresses)
+		{
+			endpoints_t vRet;
+			vRet.reserve(vAddresses.size());
+			for (auto & address : vAddresses) {
+				vRet.emplace_back(address, static_cast<unsigned short>(iPort));
+			}
+			return vRet;
+		};
+
+		boost::system::error_code ec;
+		auto literal = net::ip::make_address(sHost, ec);
+		if (!ec) {
+			net::post(ioc, [handler = std::move(handler), vEndpoints = to_endpoints({literal})] { handler({}, vEndpoints); });
+			WakeUp();
+			return;
+		}
+
+		std::unique_lock lock(mtxDNS);
+		auto & entry = mDNS[sHost];
+		auto now = SteadyNow();
+		if (!entry.vAddresses.empty() && (entry.bPinned || entry.expires > now)) {
+			if (!entry.bPinned && !entry.bResolving && entry.expires - now < dnsRefresh) {
+				// Hot entry about to expire; refresh it while callers keep using the current answer.
+				entry.bResolving = true;
+				lock.unlock();
+				DNSLookup(sHost);
+				lock.lock();
+			}
+			auto vEndpoints = to_endpoints(mDNS[sHost].vAddresses);
+			lock.unlock();
+			net::post(ioc, [handler = std::move(handler), vEndpoints = std::move(vEndpoints)] { handler({}, vEndpoints); });
+			WakeUp();
+			return;
+		}
+
+		entry.vWaiters.push_back([handler = std::move(handler), to_endpoints](const boost::system::error_code & ec, const std::vector<net::ip::address> & vAddresses)
+		{
+			handler(ec, to_endpoints(vAddresses));
+		});
+		if (!entry.bResolving) {
+			entry.bResolving = true;
+			lock.unlock();
+			DNSLookup(sHost);
+		}
+	}
+
+	void CoreBase::DNSLookup(const std::string &sHost)
+	{
+		Log(AppLogger::DEBUG) << "Network::CoreBase::DNSLookup " << sHost << std::endl;
+		auto resolver = std::make_shared<tcp::resolver>(ioc);
+		resolver->async_resolve(sHost, "", [this, resolver, sHost](const boost::system::error_code & ec, tcp::resolver::results_type results)
+		{
+			std::vector<net::ip::address> vV6;
+			std::vector<net::ip::address> vV4;
+			for (auto & result : results) {
+				auto address = result.endpoint().address();
+				auto & vFamily = address.is_v6() ? vV6 : vV4;
+				if (std::ranges::find(vFamily, address) == vFamily.end()) {
+					vFamily.push_back(address);
+				}
+			}
+			std::vector<net::ip::address> vAddresses;
+			vAddresses.reserve(vV6.size() + vV4.size());
+			for (size_t i = 0; i < std::max(vV6.size(), vV4.size()); ++i) {
+				if (i < vV6.size()) {
+					vAddresses.push_back(vV6[i]);
+				}
+				if (i < vV4.size()) {
+					vAddresses.push_back(vV4[i]);
+				}
+			}
+
+			decltype(DNSEntry::vWaiters) vWaiters;
+			{
+				std::lock_guard lock(mtxDNS);
+				auto & entry = mDNS[sHost];
+				entry.bResolving = false;
+				vWaiters.swap(entry.vWaiters);
+				if (!ec && !vAddresses.empty() && !entry.bPinned) {
+					entry.vAddresses = vAddresses;
+					entry.expires = SteadyNow() + dnsTTL;
+				} else if (!entry.vAddresses.empty()) {
+					// Serve the last good answer rather than failing a host that was reachable a moment ago.
+					vAddresses = entry.vAddresses;
+				}
+			}
+			if (ec) {
+				Log(AppLogger::ERROR) << "Network::CoreBase::DNSLookup Error: " << ec.message() << ": " << sHost << std::endl;
+			}
+			auto ecOut = vAddresses.empty() ? (ec ? ec : net::error::host_not_found) : boost::system::error_code();
+			for (auto & waiter : vWaiters) {
+				waiter(ecOut, vAddresses);
+			}
+		});
+		WakeUp();
+	}
+
+	void CoreBase::DNSCacheTTL(std::chrono::seconds ttlIn, std::chrono::seconds refreshIn)
+	{
+		std::lock_guard lock(mtxDNS);
+		dnsTTL = ttlIn;
+		dnsRefresh = std::min(refreshIn, ttlIn);
+	}
+
+	void CoreBase::DNSOverride(const std::string &sHost, std::vector<net::ip::address> vAddresses)
+	{
+		std::lock_guard lock(mtxDNS);
+		auto & entry = mDNS[sHost];
+		entry.bPinned = !vAddresses.empty();
+		entry.vAddresses = std::move(vAddresses);
+		entry.expires = {};
+	}
+
+	BufferPool & CoreBase::Buffers()
+	{
+		return bufferPool;
+	}
+
+	void CoreBase::DNSCacheClear()
+	{
+		std::lock_guard lock(mtxDNS);
+		std::erase_if(mDNS, [](const auto & item) { return !item.second.bPinned && !item.second.bResolving; });
+		for (auto & [sHost, entry] : mDNS) {
+			if (!entry.bPinned) {
+				entry.vAddresses.clear();
+			}
+		}
 	}
 
 	core_t & Core(int iThreadCountInit) // calling this with <= 0 will not create an instance if one does not exist. Only the first call to this > 0 will create the instance.
@@ -241,12 +746,188 @@ namespace Network
 
 	void ExitAll()
 	{
+		HTTP::ServerBase::StopAll();
+		WebSocket::ServerBase::StopAll();
+		TCP::ServerBase::StopAll();
 		auto core = Core();
 		if (core) {
 			core->Exit();
 		}
 	}
 
+	DelimiterFramer::DelimiterFramer(std::string sDelimiterIn, bool bIncludeDelimiterIn) :
+		sDelimiter(std::move(sDelimiterIn)),
+		bIncludeDelimiter(bIncludeDelimiterIn)
+	{
+	}
+
+	size_t DelimiterFramer::Frame(std::span<char> data, const frame_handler_t &onFrame)
+	{
+		std::string_view sData(data.data(), data.size());
+		if (sDelimiter.empty()) {
+			onFrame(sData);
+			return sData.size();
+		}
+		size_t iStart = 0;
+		for (auto iPos = sData.find(sDelimiter); iPos != std::string_view::npos; iPos = sData.find(sDelimiter, iStart)) {
+			auto iEnd = iPos + sDelimiter.size();
+			onFrame(sData.substr(iStart, (bIncludeDelimiter ? iEnd : iPos) - iStart));
+			iStart = iEnd;
+		}
+		return iStart;
+	}
+
+	LengthPrefixFramer::LengthPrefixFramer(size_t iPrefixBytesIn, bool bBigEndianIn, size_t iMaxFrameIn) :
+		iPrefixBytes(iPrefixBytesIn == 1 || iPrefixBytesIn == 2 ? iPrefixBytesIn : 4),
+		bBigEndian(bBigEndianIn),
+		iMaxFrame(iMaxFrameIn)
+	{
+	}
+
+	size_t LengthPrefixFramer::Frame(std::span<char> data, const frame_handler_t &onFrame)
+	{
+		size_t iStart = 0;
+		while (data.size() - iStart >= iPrefixBytes) {
+			auto pPrefix = reinterpret_cast<const unsigned char *>(data.data() + iStart);
+			size_t iLength = 0;
+			for (size_t i = 0; i < iPrefixBytes; ++i) {
+				iLength |= static_cast<size_t>(pPrefix[bBigEndian ? i : iPrefixBytes - 1 - i]) << (8 * (iPrefixBytes - 1 - i));
+			}
+			if (iLength > iMaxFrame) {
+				// No way to resynchronise a length-prefixed stream, so drop what we have.
+				Log(AppLogger::ERROR) << "LengthPrefixFramer::Frame Length " << iLength << " exceeds " << iMaxFrame << std::endl;
+				return data.size();
+			}
+			if (data.size() - iStart - iPrefixBytes < iLength) {
+				break;
+			}
+			onFrame(std::string_view(data.data() + iStart + iPrefixBytes, iLength));
+			iStart += iPrefixBytes + iLength;
+		}
+		return iStart;
+	}
+
+	size_t SlipFramer::Frame(std::span<char> data, const frame_handler_t &onFrame)
+	{
+		static constexpr char END = '\xC0', ESC = '\xDB', ESC_END = '\xDC', ESC_ESC = '\xDD';
+		size_t iStart = 0;
+		for (auto it = std::ranges::find(data, END); it != data.end(); it = std::ranges::find(data.subspan(iStart), END)) {
+			auto iEnd = static_cast<size_t>(it - data.begin());
+			size_t iOut = iStart;
+			for (size_t i = iStart; i < iEnd; ++i) {
+				char c = data[i];
+				if (c == ESC && i + 1 < iEnd) {
+					c = data[++i] == ESC_END ? END : data[i] == ESC_ESC ? ESC : data[i];
+				}
+				data[iOut++] = c;
+			}
+			if (iOut > iStart) { // Back to back END bytes are legal and carry no frame.
+				onFrame(std::string_view(data.data() + iStart, iOut - iStart));
+			}
+			iStart = iEnd + 1;
+		}
+		return iStart;
+	}
+
+	size_t CobsFramer::Frame(std::span<char> data, const frame_handler_t &onFrame)
+	{
+		size_t iStart = 0;
+		for (auto it = std::ranges::find(data.subspan(iStart), '\0'); it != data.end(); it = std::ranges::find(data.subspan(iStart), '\0')) {
+			auto iEnd = static_cast<size_t>(it - data.begin());
+			size_t iOut = iStart;
+			bool bValid = true;
+			for (size_t i = iStart; i < iEnd;) {
+				auto iCode = static_cast<unsigned char>(data[i++]);
+				if (i + iCode - 1 > iEnd) {
+					bValid = false;
+					break;
+				}
+				for (size_t j = 1; j < iCode; ++j) {
+					data[iOut++] = data[i++];
+				}
+				if (iCode != 0xFF && i < iEnd) {
+					data[iOut++] = '\0';
+				}
+			}
+			if (!bValid) {
+				Log(AppLogger::ERROR) << "CobsFramer::Frame Invalid frame of " << iEnd - iStart << " bytes" << std::endl;
+			} else if (iEnd > iStart) {
+				onFrame(std::string_view(data.data() + iStart, iOut - iStart));
+			}
+			iStart = iEnd + 1;
+		}
+		return iStart;
+	}
+
+	FixedFramer::FixedFramer(size_t iSizeIn) :
+		iSize(std::max<size_t>(iSizeIn, 1))
+	{
+	}
+
+	size_t FixedFramer::Frame(std::span<char> data, const frame_handler_t &onFrame)
+	{
+		size_t iStart = 0;
+		for (; data.size() - iStart >= iSize; iStart += iSize) {
+			onFrame(std::string_view(data.data() + iStart, iSize));
+		}
+		return iStart;
+	}
+
+	size_t FrameBuffer(const framer_t &framer, const Buffer &rx, size_t &iStart, size_t iFill, const buffer_handler_t &onFrame)
+	{
+		if (iStart >= iFill) {
+			return 0;
+		}
+		if (!framer) {
+			onFrame(rx.Slice(iStart, iFill - iStart));
+			iStart = iFill;
+			return 1;
+		}
+		size_t iFrames = 0;
+		std::span<char> data(rx.data() + iStart, iFill - iStart);
+		auto iUsed = framer->Frame(data, [&](std::string_view sFrame)
+		{
+			++iFrames;
+			onFrame(rx.Slice(sFrame));
+		});
+		iStart += std::min(iUsed, data.size());
+		return iFrames;
+	}
+
+	bool ReserveBuffer(BufferPool &pool, Buffer &rx, size_t &iStart, size_t &iFill, size_t iMaxSize)
+	{
+		if (rx.empty()) {
+			rx = pool.Acquire();
+			iStart = iFill = 0;
+			return true;
+		}
+		if (iStart == iFill && rx.Unique()) {
+			iStart = iFill = 0;
+			return true;
+		}
+		if (iFill < rx.size()) {
+			return true;
+		}
+		bool bKept = true;
+		size_t iPending = iFill - iStart;
+		if (iPending >= iMaxSize) {
+			bKept = false;
+			iStart = iFill;
+			iPending = 0;
+		}
+		if (rx.Unique() && iPending < rx.size()) {
+			std::memmove(rx.data(), rx.data() + iStart, iPending);
+		} else {
+			// Handlers still hold frames from this slab (or the frame needs a bigger one); leave it to them.
+			auto next = pool.Acquire(iPending + 1);
+			std::memcpy(next.data(), rx.data() + iStart, iPending);
+			rx = std::move(next);
+		}
+		iStart = 0;
+		iFill = iPending;
+		return bKept;
+	}
+
 	Serial::Serial(const std::string &sPortIn, int iBaudRateIn, int iDataBitsIn, int iStopBitsIn, int iParityIn, int iFlowControlIn, int iTimeoutIn) :
 		core(Core()),
 		sPort(sPortIn),
@@ -271,8 +952,41 @@ namespace Network
 
 	Serial::~Serial()
 	{
-		std::lock_guard lock(mtx);
 		Close();
+		// Closing aborts the outstanding operations, but their handlers still have to run.
+		auto & ioc = core->IOContext();
+		while (pending->load() && !ioc.stopped()) {
+			if (ioc.get_executor().running_in_this_thread()) {
+				ioc.poll_one();
+			} else {
+				std::this_thread::sleep_for(1ms);
+			}
+		}
+	}
+
+	Serial::PendingOp::PendingOp(std::shared_ptr<std::atomic<size_t>> counterIn) :
+		counter(std::move(counterIn))
+	{
+		if (counter) {
+			++*counter;
+		}
+	}
+
+	Serial::PendingOp::PendingOp(const PendingOp & other) :
+		PendingOp(other.counter)
+	{
+	}
+
+	Serial::PendingOp::~PendingOp()
+	{
+		if (counter) {
+			--*counter;
+		}
+	}
+
+	Serial::PendingOp Serial::Pending(const std::shared_ptr<Serial> & self)
+	{
+		return PendingOp(self ? nullptr : pending);
 	}
 
 	bool Serial::IsOpen() const
@@ -305,318 +1019,4052 @@ namespace Network
 			if (ec) {
 				Log(AppLogger::ERROR) << "Serial::Close Error: " << ec.message() << ": " << sPort << std::endl;
 			}
+			FailWrites(boost::asio::error::operation_aborted);
 		}
 		return !port.is_open();
 	}
 
-	void Serial::Write(const std::string &sData)
+	bool Serial::Write(std::string sData, write_callback_t callback)
 	{
-		std::lock_guard lock(mtx);
-		Log(AppLogger::DEBUG) << "Serial::Write " << sPort << std::endl;
-		boost::asio::write(port, boost::asio::buffer(sData));
+		return Write(std::make_shared<const std::string>(std::move(sData)), std::move(callback));
 	}
 
-	void Serial::DoRead()
+	bool Serial::Write(std::shared_ptr<const std::string> data, write_callback_t callback)
 	{
-		std::lock_guard lock(mtx);
-		// Log(AppLogger::DEBUG) << "Serial::DoRead " << sPort << std::endl;
-		static char szBuffer[2] = "\0";
-		szBuffer[0] = 0;
-		boost::asio::async_read(port, boost::asio::buffer(&szBuffer, 1), [&](const boost::system::error_code &ec, std::size_t bytesIn)
 		{
+			std::lock_guard lock(mtxWrite);
+			if (iWriteQueued + data->size() > iWriteLimit) {
+				Log(AppLogger::ERROR) << "Serial::Write Queue full (" << iWriteQueued << " bytes): " << sPort << std::endl;
+				return false;
+			}
+			iWriteQueued += data->size();
+			dqWrites.push_back({std::move(data), std::move(callback), SteadyNow()});
+			if (iWriteQueued > iWriteHigh) {
+				EventHandlerSet(eWriteBackpressure);
+			}
+		}
+		auto self = weak_from_this().lock();
+		boost::asio::post(port.get_executor(), [this, self, op = Pending(self)] { DoWrite(); });
+		core->WakeUp();
+		return true;
+	}
+
+	std::future<boost::system::error_code> Serial::WriteFuture(std::string sData)
+	{
+		auto promise = std::make_shared<std::promise<boost::system::error_code>>();
+		auto ret = promise->get_future();
+		if (!Write(std::move(sData), [promise](const boost::system::error_code &ec, size_t) { promise->set_value(ec); })) {
+			promise->set_value(boost::asio::error::no_buffer_space);
+		}
+		return ret;
+	}
+
+	void Serial::WriteWatermarks(size_t iHighIn, size_t iLowIn, size_t iLimitIn)
+	{
+		std::lock_guard lock(mtxWrite);
+		iWriteLimit = iLimitIn;
+		iWriteHigh = std::min(iHighIn, iWriteLimit);
+		iWriteLow = std::min(iLowIn, iWriteHigh);
+	}
+
+	EventHandler::Event Serial::WriteBackpressure() const
+	{
+		return eWriteBackpressure;
+	}
+
+	size_t Serial::WriteQueued()
+	{
+		std::lock_guard lock(mtxWrite);
+		return iWriteQueued;
+	}
+
+	void Serial::DoWrite()
+	{
+		std::lock_guard lockPort(mtx);
+		std::unique_lock lock(mtxWrite);
+		if (bWriting || (vWriting.empty() && dqWrites.empty())) {
+			return;
+		}
+		if (!port.is_open()) {
+			lock.unlock();
+			CompleteWrites(boost::asio::error::not_connected);
+			FailWrites(boost::asio::error::not_connected);
+			return;
+		}
+		if (vWriting.empty()) {
+			while (!dqWrites.empty() && vWriting.size() < iMaxGather) {
+				iWritingBytes += dqWrites.front().data->size();
+				vWriting.push_back(std::move(dqWrites.front()));
+				dqWrites.pop_front();
+			}
+		}
+		// async_write would issue its follow-up writes outside mtx, so partial writes are continued from here.
+		std::vector<boost::asio::const_buffer> vBuffers;
+		vBuffers.reserve(vWriting.size());
+		size_t iSkip = iWriteOffset;
+		for (auto & write : vWriting) {
+			if (iSkip >= write.data->size()) {
+				iSkip -= write.data->size();
+				continue;
+			}
+			vBuffers.push_back(boost::asio::buffer(*write.data) + iSkip);
+			iSkip = 0;
+		}
+		bWriting = true;
+		// Holding a reference keeps a Serial owned by a shared_ptr alive until the operation completes.
+		auto self = weak_from_this().lock();
+		port.async_write_some(vBuffers, [this, self, op = Pending(self)](const boost::system::error_code &ec, std::size_t bytesOut)
+		{
+			bool bBatchDone;
+			{
+				std::lock_guard lock(mtxWrite);
+				bWriting = false;
+				iWriteOffset += bytesOut;
+				bBatchDone = iWriteOffset >= iWritingBytes;
+			}
+			{
+				std::lock_guard lock(mtxStats);
+				stats.iBytesWritten += bytesOut;
+			}
+			if (ec) {
+				Log(AppLogger::ERROR) << "Serial::HandleWrite Error: " << ec.message() << ": " << sPort << std::endl;
+				CompleteWrites(ec);
+				FailWrites(ec);
+				return;
+			}
+			if (bBatchDone) {
+				CompleteWrites(ec);
+			}
+			DoWrite();
+		});
+		core->WakeUp();
+	}
+
+	void Serial::CompleteWrites(const boost::system::error_code &ec)
+	{
+		std::vector<PendingWrite> vDone;
+		{
+			std::lock_guard lock(mtxWrite);
+			vDone.swap(vWriting);
+			iWritingBytes = 0;
+			iWriteOffset = 0;
+			for (auto & write : vDone) {
+				iWriteQueued -= std::min(write.data->size(), iWriteQueued);
+			}
+			if (iWriteQueued <= iWriteLow) {
+				EventHandlerReset(eWriteBackpressure);
+			}
+		}
+		if (vDone.empty()) {
+			return;
+		}
+		{
+			auto now = SteadyNow();
+			std::lock_guard lock(mtxStats);
+			if (ec) {
+				++stats.iWriteErrors;
+			} else {
+				for (auto & write : vDone) {
+					auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - write.queued);
+					writeLatencyTotal += latency;
+					stats.writeLatencyMax = std::max(stats.writeLatencyMax, latency);
+				}
+				stats.iWrites += vDone.size();
+				if (stats.iWrites) {
+					stats.writeLatencyAvg = writeLatencyTotal / stats.iWrites;
+				}
+			}
+		}
+		for (auto & write : vDone) {
+			if (write.callback) {
+				write.callback(ec, ec ? 0 : write.data->size());
+			}
+		}
+	}
+
+	void Serial::FailWrites(const boost::system::error_code &ec)
+	{
+		std::deque<PendingWrite> dqFailed;
+		{
+			std::lock_guard lock(mtxWrite);
+			dqFailed.swap(dqWrites);
+			for (auto & write : dqFailed) {
+				iWriteQueued -= std::min(write.data->size(), iWriteQueued);
+			}
+			if (iWriteQueued <= iWriteLow) {
+				EventHandlerReset(eWriteBackpressure);
+			}
+		}
+		for (auto & write : dqFailed) {
+			if (write.callback) {
+				write.callback(ec, 0);
+			}
+		}
+	}
+
+	void Serial::DoRead()
+	{
+		std::lock_guard lock(mtx);
+		if (bReading || !port.is_open()) {
+			return;
+		}
+		if (!ReserveBuffer(core->Buffers(), rxBuffer, iReadStart, iReadFill, iMaxReadBufferSize)) {
+			Log(AppLogger::ERROR) << "Serial::DoRead Frame exceeds " << iMaxReadBufferSize << " bytes, discarding: " << sPort << std::endl;
+		}
+		bReading = true;
+		auto self = weak_from_this().lock();
+		port.async_read_some(boost::asio::buffer(rxBuffer.data() + iReadFill, rxBuffer.size() - iReadFill), [this, self, op = Pending(self)](const boost::system::error_code &ec, std::size_t bytesIn)
+		{
+			HandleRead(ec, bytesIn);
+		});
+		core->WakeUp();
+	}
+
+	void Serial::HandleRead(const boost::system::error_code &ec, std::size_t bytesIn)
+	{
+		TRACE_ZONE_CAT("Serial::HandleRead", "serial");
+		{
+			std::lock_guard lock(mtx);
+			bReading = false;
+			if (ec) {
+				if (ec == boost::asio::error::operation_aborted || !port.is_open()) {
+					return;
+				}
+				Log(AppLogger::ERROR) << "Serial::HandleRead Error: " << ec.message() << ": " << sPort << std::endl;
+				std::lock_guard lockStats(mtxStats);
+				++stats.iReadErrors;
+			} else {
+				iReadFill += bytesIn;
+				if (frameCallback) {
+					auto iFrames = FrameBuffer(framer, rxBuffer, iReadStart, iReadFill, frameCallback);
+					std::lock_guard lockStats(mtxStats);
+					stats.iBytesRead += bytesIn;
+					stats.iFrames += iFrames;
+				}
+			}
+			if (!frameCallback) {
+				return;
+			}
+		}
+		DoRead();
+	}
+
+	void Serial::SetReadCalback(std::function<void(const std::string &sData)> callback)
+	{
+		if (!callback) {
+			SetFrameCallback(nullptr, nullptr);
+			return;
+		}
+		SetFrameCallback(std::make_shared<DelimiterFramer>("~"), [callback = std::move(callback)](std::string_view sFrame)
+		{
+			callback(std::string(sFrame));
+		});
+	}
+
+	void Serial::SetFrameCallback(framer_t framerIn, frame_handler_t callback)
+	{
+		if (!callback) {
+			SetBufferCallback(std::move(framerIn), nullptr);
+			return;
+		}
+		SetBufferCallback(std::move(framerIn), [callback = std::move(callback)](const Buffer & frame)
+		{
+			callback(frame.View());
+		});
+	}
+
+	void Serial::SetBufferCallback(framer_t framerIn, buffer_handler_t callback)
+	{
+		std::lock_guard lock(mtx);
+		framer = std::move(framerIn);
+		frameCallback = std::move(callback);
+		iReadStart = iReadFill; // A read may still be landing in rxBuffer; just drop what the old framer left.
+		if (frameCallback) {
+			DoRead();
+		}
+	}
+
+	std::deque<std::string> Serial::ListPorts()
+	{
+		std::deque<std::string> sPorts;
+		#ifdef _WIN32
+		HKEY hKey;
+		if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, "HARDWARE\\DEVICEMAP\\SERIALCOMM", 0, KEY_READ, &hKey) == ERROR_SUCCESS) {
+			char szName[256];
+			char szData[256];
+			DWORD dwName, dwData, dwIndex = 0;
+			while (RegEnumValue(hKey, dwIndex++, szName, &dwName, NULL, NULL, (LPBYTE)szData, &dwData) == ERROR_SUCCESS) {
+				sPorts.push_back(szData);
+			}
+			RegCloseKey(hKey);
+		}
+		#else
+		// Linux and macOS
+		// use std::filesystem to scan the /dev directory for "ttyS*", "ttyUSB*", "ttyACM*" devices and "ttyAMA*" devices
+		auto path = std::filesystem::path("/dev");
+		for (const auto &entry : std::filesystem::directory_iterator(path)) {
+			auto filename = entry.path().filename().string();
+			if (IsSerialName(filename)) {
+				sPorts.push_back(entry.path().string());
+			}
+		}
+		#endif
+		return sPorts;
+	}
+
+	bool Serial::IsSerialName(std::string_view sFilename)
+	{
+		return sFilename.starts_with("ttyS") || sFilename.starts_with("ttyUSB") || sFilename.starts_with("ttyACM") || sFilename.starts_with("ttyAMA");
+	}
+
+	const std::string &Serial::Port() const
+	{
+		return sPort;
+	}
+
+	SerialStats Serial::Stats()
+	{
+		std::lock_guard lock(mtxStats);
+		return stats;
+	}
+
+	void Serial::ResetStats()
+	{
+		std::lock_guard lock(mtxStats);
+		stats = {};
+		writeLatencyTotal = {};
+	}
+
+	SerialHub::SerialHub(int iBaudRateIn, int iDataBitsIn, int iStopBitsIn, int iParityIn, int iFlowControlIn) :
+		core(Core()),
+		iBaudRate(iBaudRateIn),
+		iDataBits(iDataBitsIn),
+		iStopBits(iStopBitsIn),
+		iParity(iParityIn),
+		iFlowControl(iFlowControlIn)
+	{
+		Log(AppLogger::DEBUG) << "SerialHub::SerialHub " << iBaudRate << std::endl;
+	}
+
+	SerialHub::~SerialHub()
+	{
+		StopWatching();
+		// Hotplug handlers already running can still add or remove ports; take the map over under the lock and close
+		// the ports outside it, since closing runs write callbacks.
+		std::map<std::string, std::shared_ptr<Serial>> mClosing;
+		{
+			std::lock_guard lock(mtx);
+			mClosing.swap(mPorts);
+		}
+		for (auto & [sPort, serial] : mClosing) {
+			serial->Close();
+		}
+	}
+
+	void SerialHub::OnFrame(framer_factory_t framerFactoryIn, hub_frame_handler_t handlerIn)
+	{
+		std::lock_guard lock(mtx);
+		framerFactory = std::move(framerFactoryIn);
+		onFrame = std::move(handlerIn);
+	}
+
+	bool SerialHub::Add(const std::string &sPort)
+	{
+		std::unique_lock lock(mtx);
+		if (mPorts.contains(sPort)) {
+			return true;
+		}
+		std::shared_ptr<Serial> serial;
+		try {
+			serial = std::make_shared<Serial>(sPort, iBaudRate, iDataBits, iStopBits, iParity, iFlowControl);
+		} catch (const boost::system::system_error & e) {
+			Log(AppLogger::ERROR) << "SerialHub::Add Error: " << e.what() << ": " << sPort << std::endl;
+			return false;
+		}
+		if (framerFactory && onFrame) {
+			serial->SetFrameCallback(framerFactory(), [onFrame = onFrame, sPort](std::string_view sFrame)
+			{
+				onFrame(sPort, sFrame);
+			});
+		}
+		mPorts[sPort] = serial;
+		auto handler = onChange;
+		lock.unlock();
+		Log(AppLogger::INFO) << "SerialHub::Add " << sPort << std::endl;
+		if (handler) {
+			handler(sPort, true);
+		}
+		return true;
+	}
+
+	void SerialHub::Remove(const std::string &sPort)
+	{
+		std::shared_ptr<Serial> serial;
+		port_handler_t handler;
+		{
+			std::lock_guard lock(mtx);
+			auto it = mPorts.find(sPort);
+			if (it == mPorts.end()) {
+				return;
+			}
+			serial = std::move(it->second);
+			mPorts.erase(it);
+			handler = onChange;
+		}
+		Log(AppLogger::INFO) << "SerialHub::Remove " << sPort << std::endl;
+		serial->Close();
+		if (handler) {
+			handler(sPort, false);
+		}
+	}
+
+	std::shared_ptr<Serial> SerialHub::Get(const std::string &sPort)
+	{
+		std::lock_guard lock(mtx);
+		auto it = mPorts.find(sPort);
+		return it == mPorts.end() ? nullptr : it->second;
+	}
+
+	std::vector<std::string> SerialHub::Ports()
+	{
+		std::lock_guard lock(mtx);
+		std::vector<std::string> vRet;
+		vRet.reserve(mPorts.size());
+		for (auto & [sPort, serial] : mPorts) {
+			vRet.push_back(sPort);
+		}
+		return vRet;
+	}
+
+	bool SerialHub::Write(const std::string &sPort, std::string sData, Serial::write_callback_t callback)
+	{
+		auto serial = Get(sPort);
+		return serial && serial->Write(std::move(sData), std::move(callback));
+	}
+
+	std::map<std::string, SerialStats> SerialHub::Stats()
+	{
+		std::map<std::string, std::shared_ptr<Serial>> mCopy;
+		{
+			std::lock_guard lock(mtx);
+			mCopy = mPorts;
+		}
+		std::map<std::string, SerialStats> mRet;
+		for (auto & [sPort, serial] : mCopy) {
+			mRet[sPort] = serial->Stats();
+		}
+		return mRet;
+	}
+
+	bool SerialHub::Watch(port_filter_t filterIn, port_handler_t onChangeIn)
+	{
+		{
+			std::lock_guard lock(mtx);
+			filter = std::move(filterIn);
+			onChange = std::move(onChangeIn);
+		}
+		#ifdef __linux__
+		{
+			std::lock_guard lock(mtx);
+			if (!inotify) {
+				int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				if (fd < 0 || inotify_add_watch(fd, "/dev", IN_CREATE | IN_DELETE | IN_ATTRIB) < 0) {
+					Log(AppLogger::ERROR) << "SerialHub::Watch inotify Error: " << std::strerror(errno) << std::endl;
+					if (fd >= 0) {
+						::close(fd);
+					}
+					return false;
+				}
+				inotify = std::make_unique<boost::asio::posix::stream_descriptor>(core->IOContext(), fd);
+				do_watch();
+			}
+		}
+		for (auto & sPort : Serial::ListPorts()) {
+			on_created(sPort);
+		}
+		return true;
+		#else
+		// No hotplug notification here; take what is present now.
+		for (auto & sPort : Serial::ListPorts()) {
+			on_created(sPort);
+		}
+		return false;
+		#endif
+	}
+
+	void SerialHub::StopWatching()
+	{
+		#ifdef __linux__
+		std::lock_guard lock(mtx);
+		if (inotify) {
+			boost::system::error_code ec;
+			inotify->close(ec);
+			inotify.reset();
+		}
+		#endif
+	}
+
+	void SerialHub::on_created(const std::string &sPort)
+	{
+		port_filter_t filterCopy;
+		{
+			std::lock_guard lock(mtx);
+			if (mPorts.contains(sPort)) {
+				return;
+			}
+			filterCopy = filter;
+		}
+		if (filterCopy ? filterCopy(sPort) : Serial::IsSerialName(std::filesystem::path(sPort).filename().string())) {
+			Add(sPort);
+		}
+	}
+
+	void SerialHub::do_watch()
+	{
+		#ifdef __linux__
+		inotify->async_read_some(boost::asio::buffer(aEvents), [this, self = weak_from_this().lock()](const boost::system::error_code &ec, std::size_t bytesIn)
+		{
+			if (ec) {
+				if (ec != boost::asio::error::operation_aborted) {
+					Log(AppLogger::ERROR) << "SerialHub::do_watch Error: " << ec.message() << std::endl;
+				}
+				return;
+			}
+			for (size_t i = 0; i + sizeof(inotify_event) <= bytesIn;) {
+				auto pEvent = reinterpret_cast<const inotify_event *>(aEvents.data() + i);
+				i += sizeof(inotify_event) + pEvent->len;
+				if (!pEvent->len) {
+					continue;
+				}
+				auto sPort = "/dev/" + std::string(pEvent->name);
+				if (pEvent->mask & IN_DELETE) {
+					Remove(sPort);
+				} else {
+					// udev usually fixes permissions after the node appears, so IN_ATTRIB retries a failed open.
+					on_created(sPort);
+				}
+			}
+			std::lock_guard lock(mtx);
+			if (inotify) {
+				do_watch();
+			}
+		});
+		core->WakeUp();
+		#endif
+	}
+
+	void Histogram::Record(std::chrono::microseconds value)
+	{
+		auto iValue = static_cast<uint64_t>(std::max<int64_t>(value.count(), 0));
+		if (vCounts.empty()) {
+			vCounts.resize(Index(iHighestValue) + 1);
+		}
+		++vCounts[Index(iValue)];
+		++iCount;
+		iTotal += iValue;
+		iMax = std::max(iMax, iValue);
+	}
+
+	void Histogram::Merge(const Histogram &other)
+	{
+		if (other.vCounts.empty()) {
+			return;
+		}
+		if (vCounts.empty()) {
+			vCounts.resize(other.vCounts.size());
+		}
+		for (size_t i = 0; i < vCounts.size(); ++i) {
+			vCounts[i] += other.vCounts[i];
+		}
+		iCount += other.iCount;
+		iTotal += other.iTotal;
+		iMax = std::max(iMax, other.iMax);
+	}
+
+	void Histogram::Reset()
+	{
+		std::ranges::fill(vCounts, 0);
+		iCount = 0;
+		iTotal = 0;
+		iMax = 0;
+	}
+
+	uint64_t Histogram::Count() const
+	{
+		return iCount;
+	}
+
+	std::chrono::microseconds Histogram::Percentile(double dPercentile) const
+	{
+		if (!iCount) {
+			return {};
+		}
+		auto iTarget = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::clamp(dPercentile, 0.0, 100.0) / 100.0 * static_cast<double>(iCount))));
+		uint64_t iSeen = 0;
+		for (size_t i = 0; i < vCounts.size(); ++i) {
+			iSeen += vCounts[i];
+			if (iSeen >= iTarget) {
+				return std::chrono::microseconds(std::min(Value(i), iMax));
+			}
+		}
+		return std::chrono::microseconds(iMax);
+	}
+
+	std::chrono::microseconds Histogram::Mean() const
+	{
+		return std::chrono::microseconds(iCount ? iTotal / iCount : 0);
+	}
+
+	std::chrono::microseconds Histogram::Max() const
+	{
+		return std::chrono::microseconds(iMax);
+	}
+
+	size_t Histogram::Index(uint64_t iValue)
+	{
+		// Values below 2^iSubBucketBits are exact; above that each power of two is split into 64 linear buckets.
+		static constexpr uint64_t iHalf = uint64_t(1) << (iSubBucketBits - 1);
+		iValue = std::min(iValue, iHighestValue);
+		if (iValue < 2 * iHalf) {
+			return static_cast<size_t>(iValue);
+		}
+		auto iShift = static_cast<unsigned>(std::bit_width(iValue)) - iSubBucketBits;
+		return static_cast<size_t>(2 * iHalf + (iShift - 1) * iHalf + ((iValue >> iShift) - iHalf));
+	}
+
+	uint64_t Histogram::Value(size_t iIndex)
+	{
+		static constexpr uint64_t iHalf = uint64_t(1) << (iSubBucketBits - 1);
+		if (iIndex < 2 * iHalf) {
+			return iIndex;
+		}
+		auto k = iIndex - 2 * iHalf;
+		auto iShift = k / iHalf + 1;
+		return (((k % iHalf) + iHalf) << iShift) + ((uint64_t(1) << iShift) - 1); // Highest value in the bucket.
+	}
+
+	// Accept errors other than a close are mostly EMFILE or ENFILE, which only clear as connections close, so servers
+	// wait this long before accepting again rather than spinning on the error.
+	static constexpr std::chrono::milliseconds acceptRetryDelay = 100ms;
+
+	namespace HTTP
+	{
+		// Incremental Content-Encoding decoder for response bodies.
+		class ContentDecoder
+		{
+			public:
+				using sink_t = std::function<bool(std::string_view sChunk)>;
+
+				static std::unique_ptr<ContentDecoder> Create(beast::string_view sEncoding)
+				{
+					auto eq = [&](const char * s) { return beast::iequals(sEncoding, s); };
+					if (eq("gzip") || eq("x-gzip")) {
+						return std::unique_ptr<ContentDecoder>(new ContentDecoder(GZIP));
+					} else if (eq("deflate")) {
+						return std::unique_ptr<ContentDecoder>(new ContentDecoder(DEFLATE));
+					}
+					#ifdef EASYAPPBASE_BROTLI
+					if (eq("br")) {
+						return std::unique_ptr<ContentDecoder>(new ContentDecoder(BROTLI));
+					}
+					#endif
+					return nullptr;
+				}
+
+				static const char * AcceptEncoding()
+				{
+					#ifdef EASYAPPBASE_BROTLI
+					return "gzip, deflate, br";
+					#else
+					return "gzip, deflate";
+					#endif
+				}
+
+				~ContentDecoder()
+				{
+					if (eType == BROTLI) {
+						#ifdef EASYAPPBASE_BROTLI
+						BrotliDecoderDestroyInstance(brotli);
+						#endif
+					} else {
+						inflateEnd(&zs);
+					}
+				}
+
+				// Returns false on corrupt input or when the sink asks to stop.
+				bool Feed(std::string_view sIn, const sink_t & sink)
+				{
+					if (bFinished || sIn.empty()) {
+						return true;
+					}
+					auto start = SteadyNow();
+					bool bRet = eType == BROTLI ? FeedBrotli(sIn, sink) : FeedZlib(sIn, sink);
+					elapsed += std::chrono::duration_cast<std::chrono::microseconds>(SteadyNow() - start);
+					return bRet;
+				}
+
+				bool Finished() const
+				{
+					return bFinished;
+				}
+
+				std::chrono::microseconds Elapsed() const
+				{
+					return elapsed;
+				}
+
+			private:
+				enum type_t { GZIP, DEFLATE, BROTLI };
+
+				explicit ContentDecoder(type_t eTypeIn) :
+					eType(eTypeIn)
+				{
+					if (eType == BROTLI) {
+						#ifdef EASYAPPBASE_BROTLI
+						brotli = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+						#endif
+					} else {
+						// 15 + 32 detects a gzip or zlib header; "deflate" is meant to be zlib wrapped.
+						inflateInit2(&zs, 15 + 32);
+					}
+				}
+
+				bool FeedZlib(std::string_view sIn, const sink_t & sink)
+				{
+					if (bFinished) {
+						return true;
+					}
+					zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(sIn.data()));
+					zs.avail_in = static_cast<uInt>(sIn.size());
+					bool bRestarted;
+					// A full output buffer can leave decoded bytes inside zlib even once all input is consumed, so go
+					// round again whenever inflate filled it.
+					do {
+						bRestarted = false;
+						zs.next_out = reinterpret_cast<Bytef *>(aOut.data());
+						zs.avail_out = static_cast<uInt>(aOut.size());
+						int iResult = inflate(&zs, Z_NO_FLUSH);
+						if (iResult == Z_DATA_ERROR && eType == DEFLATE && !bOutput && zs.total_in <= sIn.size()) {
+							// Some servers send raw deflate without the zlib wrapper.
+							inflateEnd(&zs);
+							zs = {};
+							inflateInit2(&zs, -15);
+							zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(sIn.data()));
+							zs.avail_in = static_cast<uInt>(sIn.size());
+							bOutput = true; // Only try once.
+							bRestarted = true;
+							continue;
+						}
+						if (iResult != Z_OK && iResult != Z_STREAM_END && iResult != Z_BUF_ERROR) {
+							Log(AppLogger::ERROR) << "ContentDecoder::Feed inflate Error: " << (zs.msg ? zs.msg : std::to_string(iResult)) << std::endl;
+							return false;
+						}
+						size_t iOut = aOut.size() - zs.avail_out;
+						if (iOut) {
+							bOutput = true;
+							if (!sink(std::string_view(aOut.data(), iOut))) {
+								return false;
+							}
+						}
+						bFinished = iResult == Z_STREAM_END;
+					} while (bRestarted || (zs.avail_out == 0 && !bFinished));
+					return true;
+				}
+
+				bool FeedBrotli(std::string_view sIn, const sink_t & sink)
+				{
+					#ifdef EASYAPPBASE_BROTLI
+					auto pIn = reinterpret_cast<const uint8_t *>(sIn.data());
+					size_t iAvailIn = sIn.size();
+					for (;;) {
+						auto pOut = reinterpret_cast<uint8_t *>(aOut.data());
+						size_t iAvailOut = aOut.size();
+						auto result = BrotliDecoderDecompressStream(brotli, &iAvailIn, &pIn, &iAvailOut, &pOut, nullptr);
+						if (result == BROTLI_DECODER_RESULT_ERROR) {
+							Log(AppLogger::ERROR) << "ContentDecoder::Feed brotli Error: " << BrotliDecoderErrorString(BrotliDecoderGetErrorCode(brotli)) << std::endl;
+							return false;
+						}
+						size_t iOut = aOut.size() - iAvailOut;
+						if (iOut && !sink(std::string_view(aOut.data(), iOut))) {
+							return false;
+						}
+						if (result == BROTLI_DECODER_RESULT_SUCCESS) {
+							bFinished = true;
+							return true;
+						}
+						if (result == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT) {
+							return true;
+						}
+					}
+					#else
+					boost::ignore_unused(sIn, sink);
+					return false;
+					#endif
+				}
+
+				type_t eType;
+				z_stream zs{};
+				#ifdef EASYAPPBASE_BROTLI
+				BrotliDecoderState * brotli = nullptr;
+				#endif
+				std::array<char, 64 * 1024> aOut;
+				bool bOutput = false;
+				bool bFinished = false;
+				std::chrono::microseconds elapsed{0};
+		};
+
+		std::chrono::microseconds Timing::Span(time_point from, time_point to)
+		{
+			if (from == time_point() || to == time_point() || to < from) {
+				return {};
+			}
+			return std::chrono::duration_cast<std::chrono::microseconds>(to - from);
+		}
+
+		std::chrono::microseconds Timing::Queue() const
+		{
+			return Span(queued, writeStart) - (bReused ? std::chrono::microseconds() : Span(resolveStart, handshaken == time_point() ? connected : handshaken));
+		}
+
+		std::chrono::microseconds Timing::DNS() const
+		{
+			return Span(resolveStart, resolved);
+		}
+
+		std::chrono::microseconds Timing::Connect() const
+		{
+			return Span(resolved, connected);
+		}
+
+		std::chrono::microseconds Timing::TLS() const
+		{
+			return Span(connected, handshaken);
+		}
+
+		std::chrono::microseconds Timing::Send() const
+		{
+			return Span(writeStart, written);
+		}
+
+		std::chrono::microseconds Timing::Wait() const
+		{
+			return Span(written, firstByte);
+		}
+
+		std::chrono::microseconds Timing::Receive() const
+		{
+			return Span(firstByte, complete);
+		}
+
+		std::chrono::microseconds Timing::Total() const
+		{
+			return Span(queued, complete);
+		}
+
+		static std::mutex & TimingMutex()
+		{
+			static std::mutex ret;
+			return ret;
+		}
+
+		static std::map<std::string, HostTimings> & TimingRegistry()
+		{
+			static std::map<std::string, HostTimings> ret;
+			return ret;
+		}
+
+		std::map<std::string, HostTimings> Timings()
+		{
+			std::lock_guard lock(TimingMutex());
+			return TimingRegistry();
+		}
+
+		std::chrono::microseconds TimingPercentile(const std::string &sHost, double dPercentile, uint64_t iMinSamples)
+		{
+			std::lock_guard lock(TimingMutex());
+			auto it = TimingRegistry().find(sHost);
+			if (it == TimingRegistry().end() || it->second.total.Count() < std::max<uint64_t>(iMinSamples, 1)) {
+				return {};
+			}
+			return it->second.total.Percentile(dPercentile);
+		}
+
+		struct BreakerState
+		{
+			int iFailures = 0;
+			std::chrono::steady_clock::time_point openUntil;
+			const void * pTrial = nullptr; // The request let through while half open.
+		};
+
+		static std::mutex & BreakerMutex()
+		{
+			static std::mutex ret;
+			return ret;
+		}
+
+		static std::map<std::string, BreakerState> & BreakerRegistry()
+		{
+			static std::map<std::string, BreakerState> ret;
+			return ret;
+		}
+
+		void ResetTimings()
+		{
+			std::lock_guard lock(TimingMutex());
+			TimingRegistry().clear();
+		}
+
+		void RecordTiming(const std::string &sHost, const Timing &timing)
+		{
+			if (Trace::Active()) {
+				auto sDetail = Trace::Intern(sHost);
+				auto Span = [&](const char * sName, Timing::time_point from, Timing::time_point to)
+				{
+					if (from != Timing::time_point() && to != Timing::time_point() && to >= from) {
+						Trace::Complete(sName, "http", Trace::ToTrace(from), Trace::ToTrace(to) - Trace::ToTrace(from), sDetail);
+					}
+				};
+				Span("HTTP::Request", timing.queued, timing.complete);
+				Span("HTTP::DNS", timing.resolveStart, timing.resolved);
+				Span("HTTP::Connect", timing.resolved, timing.connected);
+				Span("HTTP::TLS", timing.connected, timing.handshaken);
+				Span("HTTP::Send", timing.writeStart, timing.written);
+				Span("HTTP::Wait", timing.written, timing.firstByte);
+				Span("HTTP::Receive", timing.firstByte, timing.complete);
+			}
+			std::lock_guard lock(TimingMutex());
+			auto & host = TimingRegistry()[sHost];
+			if (!timing.bReused) {
+				host.dns.Record(timing.DNS());
+				host.connect.Record(timing.Connect());
+				if (timing.handshaken != Timing::time_point()) {
+					host.tls.Record(timing.TLS());
+				}
+			}
+			host.wait.Record(timing.Wait());
+			host.total.Record(timing.Total());
+		}
+
+		ClientBase::ClientBase(std::string sAddressIn, int iPortIn, bool bSSLIn, bool bAllowSelfSignedIn) :
+			core(Core()),
+			sAddress(std::move(sAddressIn)),
+			iPort(iPortIn),
+			strand(net::make_strand(core->IOContext())),
+			bSSL(bSSLIn),
+			bAllowSelfSigned(bAllowSelfSignedIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::ClientTCP " << sAddress << ":" << iPort << std::endl;
+		}
+
+		ClientBase::~ClientBase()
+		{
+			if (stream && tcp_stream().socket().is_open()) {
+				boost::system::error_code ec;
+				tcp_stream().socket().close(ec);
+			}
+			Log(AppLogger::DEBUG) << "ClientTCP::~ClientTCP " << sAddress << ":" << iPort << std::endl;
+		}
+
+		void ClientBase::KeepAlive(bool bKeepAliveIn)
+		{
+			bKeepAlive = bKeepAliveIn;
+		}
+
+		bool ClientBase::KeepAlive() const
+		{
+			return bKeepAlive;
+		}
+
+		void ClientBase::Pipelining(bool bPipeliningIn, size_t iMaxDepthIn)
+		{
+			std::lock_guard lock(mtx);
+			bPipelining = bPipeliningIn;
+			iMaxDepth = std::max<size_t>(iMaxDepthIn, 1);
+		}
+
+		bool ClientBase::Pipelining() const
+		{
+			return bPipelining;
+		}
+
+		void ClientBase::Decompress(bool bDecompressIn)
+		{
+			std::lock_guard lock(mtx);
+			bDecompress = bDecompressIn;
+		}
+
+		bool ClientBase::Decompress() const
+		{
+			return bDecompress;
+		}
+
+		void ClientBase::BodyLimit(uint64_t iLimitIn)
+		{
+			std::lock_guard lock(mtx);
+			iBodyLimit = iLimitIn;
+		}
+
+		uint64_t ClientBase::BodyLimit() const
+		{
+			return iBodyLimit;
+		}
+
+		void ClientBase::Retry(const RetryPolicy &policyIn)
+		{
+			std::lock_guard lock(mtx);
+			retryPolicy = policyIn;
+			retryPolicy.iMaxAttempts = std::max(retryPolicy.iMaxAttempts, 1);
+		}
+
+		void ClientBase::Hedge(const HedgePolicy &policyIn)
+		{
+			std::lock_guard lock(mtx);
+			hedgePolicy = policyIn;
+		}
+
+		void ClientBase::CircuitBreaker(const CircuitBreakerPolicy &policyIn)
+		{
+			std::lock_guard lock(mtx);
+			breakerPolicy = policyIn;
+		}
+
+		size_t ClientBase::Pending()
+		{
+			std::lock_guard lock(mtx);
+			return dqQueued.size() + dqInFlight.size();
+		}
+
+		bool ClientBase::Connected()
+		{
+			return stream && tcp_stream().socket().is_open();
+		}
+
+		void ClientBase::Close()
+		{
+			if (stream) {
+				Log(AppLogger::DEBUG) << "ClientTCP::Close " << sAddress << ":" << iPort << std::endl;
+				boost::system::error_code ec;
+				tcp_stream().socket().close(ec);
+			}
+		}
+
+		void ClientBase::Request(request_t reqIn, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Stream(std::move(reqIn), nullptr, std::move(handlerIn), nullptr, timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Stream(request_t reqIn, chunk_handler_t chunkIn, handler_t handlerIn, progress_handler_t progressIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			auto pending = std::make_shared<PendingRequest>();
+			pending->req = std::move(reqIn);
+			pending->onChunk = std::move(chunkIn);
+			pending->onProgress = std::move(progressIn);
+			pending->handler = std::move(handlerIn);
+			Enqueue(std::move(pending), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Enqueue(pending_t pending, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Request " << sAddress << ":" << iPort << std::endl;
+			pending->res = std::make_shared<Response>();
+			pending->res->timing.queued = SteadyNow();
+			if (pending->req->target().empty()) {
+				pending->req->target("/");
+			}
+			pending->timeout = timeout;
+			pending->deadline = SteadyNow() + timeout;
+
+			if (!BreakerAllows(pending)) {
+				Log(AppLogger::WARNING) << "ClientBase::Request Circuit open: " << sAddress << ":" << iPort << std::endl;
+				net::post(strand, [self = shared_from_this(), pending] { self->complete(pending, net::error::try_again); });
+				core->WakeUp();
+				return;
+			}
+			Hedged(pending);
+
+			{
+				std::lock_guard lock(mtx);
+				bKeepAlive = bKeepAliveIn;
+				pending->req->keep_alive(bKeepAlive);
+				pending->bDecompress = bDecompress;
+				pending->iBodyLimit = iBodyLimit;
+				if (bDecompress && pending->req->find(http::field::accept_encoding) == pending->req->end()) {
+					pending->req->set(http::field::accept_encoding, ContentDecoder::AcceptEncoding());
+				}
+				dqQueued.push_back(std::move(pending));
+			}
+			net::post(strand, beast::bind_front_handler(&ClientBase::do_next, shared_from_this()));
+			core->WakeUp();
+		}
+
+		request_t ClientBase::MakeRequest(verb method, const std::string &sPath, const std::string &sContentType) const
+		{
+			auto req = std::make_shared<http::request<http::string_body>>(method, sPath, 11);
+			req->set(http::field::host, sAddress/* + ":" + std::to_string(iPort)*/);
+			req->set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
+			if (!sContentType.empty()) {
+				req->set(http::field::content_type, sContentType);
+			}
+			return req;
+		}
+
+		void ClientBase::Head(const std::string &sPath, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Head " << sAddress << ":" << iPort << std::endl;
+			Request(MakeRequest(http::verb::head, sPath), std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Get(const std::string &sPath, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Get " << sAddress << ":" << iPort << std::endl;
+			Request(MakeRequest(http::verb::get, sPath), std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Put(const std::string &sPath, const std::string &sBody, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Put(sPath, std::string(sBody), sContentType, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Post(const std::string &sPath, const std::string &sBody, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Post(sPath, std::string(sBody), sContentType, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Put(const std::string &sPath, std::string &&sBody, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Put " << sAddress << ":" << iPort << std::endl;
+			auto req = MakeRequest(http::verb::put, sPath, sContentType);
+			req->body() = std::move(sBody);
+			req->prepare_payload();
+			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Post(const std::string &sPath, std::string &&sBody, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Post " << sAddress << ":" << iPort << std::endl;
+			auto req = MakeRequest(http::verb::post, sPath, sContentType);
+			req->body() = std::move(sBody);
+			req->prepare_payload();
+			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Delete(const std::string &sPath, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Delete " << sAddress << ":" << iPort << std::endl;
+			Request(MakeRequest(http::verb::delete_, sPath), std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		ClientBase::body_writer_t ClientBase::SpanWriter(std::span<const std::byte> body, std::shared_ptr<const void> owner)
+		{
+			return [body, owner](ClientBase & client, const request_t & header, write_handler_t handler)
+			{
+				// span_body only reads through the pointer when serialising.
+				auto msg = std::make_shared<http::request<http::span_body<char>>>(header->base());
+				msg->body() = beast::span<char>(reinterpret_cast<char *>(const_cast<std::byte *>(body.data())), body.size());
+				msg->prepare_payload();
+				client.write_message(msg, std::move(handler));
+			};
+		}
+
+		void ClientBase::Put(const std::string &sPath, std::span<const std::byte> body, std::shared_ptr<const void> owner, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Put " << sAddress << ":" << iPort << " (" << body.size() << " bytes)" << std::endl;
+			SendBody(http::verb::put, sPath, sContentType, SpanWriter(body, std::move(owner)), true, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::Post(const std::string &sPath, std::span<const std::byte> body, std::shared_ptr<const void> owner, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Post " << sAddress << ":" << iPort << " (" << body.size() << " bytes)" << std::endl;
+			SendBody(http::verb::post, sPath, sContentType, SpanWriter(body, std::move(owner)), true, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		ClientBase::body_writer_t ClientBase::FileWriter(const std::string & sFile)
+		{
+			return [sFile](ClientBase & client, const request_t & header, write_handler_t handler)
+			{
+				// The file is opened on every attempt, so the request can be sent again.
+				auto msg = std::make_shared<http::request<http::file_body>>(header->base());
+				beast::error_code ec;
+				msg->body().open(sFile.c_str(), beast::file_mode::scan, ec);
+				if (ec) {
+					Log(AppLogger::ERROR) << "ClientBase::FileWriter Error: " << ec.message() << ": " << sFile << std::endl;
+					handler(ec, 0);
+					return;
+				}
+				msg->prepare_payload();
+				client.write_message(msg, std::move(handler));
+			};
+		}
+
+		void ClientBase::PutFile(const std::string &sPath, const std::string &sFile, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::PutFile " << sAddress << ":" << iPort << " <- " << sFile << std::endl;
+			SendBody(http::verb::put, sPath, sContentType, FileWriter(sFile), true, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::PostFile(const std::string &sPath, const std::string &sFile, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::PostFile " << sAddress << ":" << iPort << " <- " << sFile << std::endl;
+			SendBody(http::verb::post, sPath, sContentType, FileWriter(sFile), true, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		ClientBase::body_writer_t ClientBase::ChunkedWriter(chunk_generator_t generator)
+		{
+			return [generator](ClientBase & client, const request_t & header, write_handler_t handler)
+			{
+				auto msg = std::make_shared<http::request<http::empty_body>>(header->base());
+				msg->chunked(true);
+				auto sr = std::make_shared<http::request_serializer<http::empty_body>>(*msg);
+				client.write_chunks(sr, msg, generator, std::move(handler));
+			};
+		}
+
+		void ClientBase::PutChunked(const std::string &sPath, chunk_generator_t generator, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::PutChunked " << sAddress << ":" << iPort << std::endl;
+			SendBody(http::verb::put, sPath, sContentType, ChunkedWriter(std::move(generator)), false, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::PostChunked(const std::string &sPath, chunk_generator_t generator, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::PostChunked " << sAddress << ":" << iPort << std::endl;
+			SendBody(http::verb::post, sPath, sContentType, ChunkedWriter(std::move(generator)), false, std::move(handlerIn), timeout, bKeepAliveIn);
+		}
+
+		void ClientBase::SendBody(verb method, const std::string &sPath, const std::string &sContentType, body_writer_t fnWrite, bool bReplayable, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			auto pending = std::make_shared<PendingRequest>();
+			pending->req = MakeRequest(method, sPath, sContentType);
+			pending->fnWrite = std::move(fnWrite);
+			pending->bReplayable = bReplayable;
+			pending->handler = std::move(handlerIn);
+			Enqueue(std::move(pending), timeout, bKeepAliveIn);
+		}
+
+		template <class Message>
+		void ClientBase::write_message(std::shared_ptr<Message> msg, write_handler_t handler)
+		{
+			auto done = [msg, handler = std::move(handler)] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				handler(ec, bytes_transferred);
+			};
+			if (bSSL) {
+				http::async_write(ssl_stream(), *msg, std::move(done));
+			} else {
+				http::async_write(tcp_stream(), *msg, std::move(done));
+			}
+			core->WakeUp();
+		}
+
+		template <class Buffers>
+		void ClientBase::write_buffers(const Buffers & buffers, write_handler_t handler)
+		{
+			if (bSSL) {
+				net::async_write(ssl_stream(), buffers, std::move(handler));
+			} else {
+				net::async_write(tcp_stream(), buffers, std::move(handler));
+			}
+			core->WakeUp();
+		}
+
+		void ClientBase::write_chunks(std::shared_ptr<http::request_serializer<http::empty_body>> sr, std::shared_ptr<http::request<http::empty_body>> msg, chunk_generator_t generator, write_handler_t handler)
+		{
+			auto self = shared_from_this();
+			if (!sr->is_header_done()) {
+				auto header_handler = [self, sr, msg, generator, handler] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+				{
+					if (ec) {
+						handler(ec, bytes_transferred);
+						return;
+					}
+					self->write_chunks(sr, msg, generator, handler);
+				};
+				if (bSSL) {
+					http::async_write_header(ssl_stream(), *sr, std::move(header_handler));
+				} else {
+					http::async_write_header(tcp_stream(), *sr, std::move(header_handler));
+				}
+				core->WakeUp();
+				return;
+			}
+
+			auto sChunk = std::make_shared<std::string>();
+			while (generator(*sChunk)) {
+				if (!sChunk->empty()) {
+					// An empty chunk would read as the end of the body, so those are skipped.
+					write_buffers(http::make_chunk(net::buffer(*sChunk)), [self, sr, msg, generator, handler, sChunk] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+					{
+						if (ec) {
+							handler(ec, bytes_transferred);
+							return;
+						}
+						self->write_chunks(sr, msg, generator, handler);
+					});
+					return;
+				}
+			}
+			write_buffers(http::make_chunk_last(), [sr, msg, handler] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				handler(ec, bytes_transferred);
+			});
+		}
+
+		void ClientBase::Download(const std::string &sPath, const std::string &sFile, handler_t handlerIn, progress_handler_t progressIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::Download " << sAddress << ":" << iPort << " -> " << sFile << std::endl;
+			auto file = std::make_shared<beast::file>();
+			beast::error_code ec;
+			file->open(sFile.c_str(), beast::file_mode::write, ec);
+			if (ec) {
+				Log(AppLogger::ERROR) << "ClientBase::Download Error: " << ec.message() << ": " << sFile << std::endl;
+				if (handlerIn) {
+					auto res = std::make_shared<Response>();
+					res->ec = ec;
+					handlerIn(MakeRequest(http::verb::get, sPath), res, sAddress, iPort);
+				}
+				return;
+			}
+			auto req = MakeRequest(http::verb::get, sPath);
+			// Whatever body the server sends is written, so check res->result() before trusting the file.
+			Stream(req, [file](std::string_view sChunk)
+			{
+				beast::error_code ec;
+				file->write(sChunk.data(), sChunk.size(), ec);
+				return !ec;
+			}, [file, handlerIn = std::move(handlerIn)](request_t req, response_t res, const std::string & sRemoteAddr, int iRemotePort)
+			{
+				beast::error_code ec;
+				file->close(ec);
+				if (handlerIn) {
+					handlerIn(req, res, sRemoteAddr, iRemotePort);
+				}
+			}, std::move(progressIn), timeout, bKeepAliveIn);
+		}
+
+		beast::tcp_stream &ClientBase::tcp_stream() const
+		{
+			return stream->next_layer();
+		}
+
+		beast::ssl_stream<beast::tcp_stream> &ClientBase::ssl_stream() const
+		{
+			return *stream;
+		}
+
+		void ClientBase::PrepStream()
+		{
+			if (!stream) {
+				Log(AppLogger::DEBUG) << "ClientTCP::PrepStream " << sAddress << ":" << iPort << std::endl;
+				stream = std::make_shared<beast::ssl_stream<beast::tcp_stream>>(strand, ssl_ctx);
+			}
+		}
+
+		bool ClientBase::Idempotent(verb method)
+		{
+			switch (method) {
+				case verb::get:
+				case verb::head:
+				case verb::put:
+				case verb::delete_:
+				case verb::options:
+				case verb::trace:
+					return true;
+
+				default:
+					return false;
+			}
+		}
+
+		bool ClientBase::CanWrite(const pending_t & next) const
+		{
+			// Must be called with mtx held.
+			if (dqInFlight.empty()) {
+				return true;
+			}
+			if (!bPipelining || dqInFlight.size() >= iMaxDepth || !Idempotent(next->req->method())) {
+				return false;
+			}
+			return std::ranges::all_of(dqInFlight, [](const pending_t & p) { return p->req->keep_alive() && Idempotent(p->req->method()); });
+		}
+
+		void ClientBase::ArmTimeout()
+		{
+			// Must be called with mtx held. The stream has a single timer, so it tracks the oldest outstanding deadline.
+			auto deadline = std::chrono::steady_clock::time_point::max();
+			for (auto & pending : dqInFlight) {
+				deadline = std::min(deadline, pending->deadline);
+			}
+			if (dqInFlight.empty() && !dqQueued.empty()) {
+				deadline = dqQueued.front()->deadline;
+			}
+			if (deadline != std::chrono::steady_clock::time_point::max()) {
+				tcp_stream().expires_at(deadline);
+			}
+		}
+
+		void ClientBase::fail(const std::string & sWhere, const boost::system::error_code & ec)
+		{
+			if (ec != net::error::operation_aborted) {
+				Log(AppLogger::ERROR) << "ClientBase::" << sWhere << " Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
+			}
+			std::vector<pending_t> vFailed;
+			{
+				std::lock_guard lock(mtx);
+				if (stream) {
+					boost::system::error_code ecClose;
+					tcp_stream().socket().close(ecClose);
+				}
+				if (bConnecting) {
+					// Nothing can be sent to this host right now.
+					bConnecting = false;
+					vFailed.insert(vFailed.end(), dqQueued.begin(), dqQueued.end());
+					dqQueued.clear();
+				}
+				if (!dqInFlight.empty()) {
+					// The oldest request gets the blame, unanswered pipelined requests behind it are sent again once.
+					vFailed.push_back(dqInFlight.front());
+					dqInFlight.pop_front();
+					for (auto it = dqInFlight.rbegin(); it != dqInFlight.rend(); ++it) {
+						if ((*it)->bReplayable && (*it)->iAttempts++ == 0) {
+							(*it)->bWritten = false;
+							dqQueued.push_front(*it);
+						} else {
+							vFailed.push_back(*it);
+						}
+					}
+					dqInFlight.clear();
+				}
+			}
+			if (!vFailed.empty() && ec != net::error::operation_aborted) {
+				BreakerRecord(true);
+			}
+			for (auto & pending : vFailed) {
+				complete(pending, ec);
+			}
+			do_next();
+		}
+
+		void ClientBase::complete(const pending_t &pending, const boost::system::error_code &ecIn)
+		{
+			auto ec = ecIn;
+			if (ShouldRetry(pending, ec)) {
+				if (BreakerAllows(pending)) {
+					std::chrono::milliseconds delay;
+					{
+						// Exponential backoff with full jitter.
+						std::lock_guard lock(mtx);
+						static thread_local std::mt19937 rng(std::random_device{}());
+						auto ceiling = std::min<int64_t>(retryPolicy.maxDelay.count(), retryPolicy.baseDelay.count() << std::min(pending->iRetries, 20));
+						delay = std::chrono::milliseconds(std::uniform_int_distribution<int64_t>(0, std::max<int64_t>(ceiling, 0))(rng));
+					}
+					++pending->iRetries;
+					Log(AppLogger::WARNING) << "ClientBase::Retry " << pending->iRetries << " in " << delay.count() << "ms: " << sAddress << ":" << iPort << pending->req->target() << std::endl;
+					auto queued = pending->res->timing.queued;
+					pending->res = std::make_shared<Response>();
+					pending->res->timing.queued = queued;
+					pending->bWritten = false;
+					pending->iAttempts = 0;
+					auto timer = std::make_shared<net::steady_timer>(strand, delay);
+					timer->async_wait([self = shared_from_this(), pending, timer] (const boost::system::error_code &)
+					{
+						{
+							std::lock_guard lock(self->mtx);
+							pending->deadline = SteadyNow() + pending->timeout;
+							self->dqQueued.push_back(pending);
+						}
+						self->do_next();
+					});
+					core->WakeUp();
+					return;
+				}
+				Log(AppLogger::WARNING) << "ClientBase::Retry Circuit open: " << sAddress << ":" << iPort << pending->req->target() << std::endl;
+				ec = net::error::try_again;
+			}
+			if (pending->bBreakerTrial) {
+				// Aborted trials never reach BreakerRecord(), and would otherwise keep the circuit shut for good.
+				BreakerRelease(pending);
+			}
+			if (ec) {
+				pending->res->ec = ec;
+				pending->res->timing.complete = SteadyNow();
+			}
+			if (pending->handler) {
+				pending->handler(pending->req, pending->res, sAddress, iPort);
+			}
+		}
+
+		bool ClientBase::ShouldRetry(const pending_t &pending, const boost::system::error_code &ec)
+		{
+			std::lock_guard lock(mtx);
+			auto status = pending->res->result_int();
+			bool bRetryable = ec ? ec != net::error::operation_aborted && ec != net::error::try_again : retryPolicy.bRetryStatus && (status == 502 || status == 503 || status == 504);
+			return bRetryable
+				&& pending->iRetries + 1 < retryPolicy.iMaxAttempts
+				&& pending->bReplayable
+				&& (Idempotent(pending->req->method()) || retryPolicy.bRetryNonIdempotent)
+				&& (!pending->onChunk || pending->res->timing.firstByte == Timing::time_point()); // Chunks already handed out cannot be taken back.
+		}
+
+		void ClientBase::Hedged(const pending_t &pending)
+		{
+			HedgePolicy policy;
+			{
+				std::lock_guard lock(mtx);
+				policy = hedgePolicy;
+			}
+			if (!policy.bEnabled || pending->onChunk || pending->fnWrite || !Idempotent(pending->req->method())) {
+				return;
+			}
+			auto delay = TimingPercentile(HostKey(), policy.dPercentile, policy.iMinSamples);
+			if (delay == std::chrono::microseconds()) {
+				return;
+			}
+			delay = std::max<std::chrono::microseconds>(delay, policy.minDelay);
+
+			// Whichever copy succeeds first wins.  A failure, including a 502, 503 or 504, only counts once the other
+			// copy has failed too, and then the later failure is the one reported.
+			struct HedgeState
+			{
+				std::mutex mtx;
+				bool bDone = false;
+				int iOutstanding = 1;
+				handler_t handler;
+				std::weak_ptr<net::steady_timer> timer;
+			};
+			auto state = std::make_shared<HedgeState>();
+			state->handler = std::move(pending->handler);
+			auto handler = [state] (request_t req, response_t res, const std::string & sRemoteAddr, int iRemotePort)
+			{
+				auto status = res->result_int();
+				bool bFailed = res->ec || status == 502 || status == 503 || status == 504;
+				std::shared_ptr<net::steady_timer> timer;
+				{
+					std::lock_guard lock(state->mtx);
+					if (state->bDone) {
+						return;
+					}
+					if (bFailed && --state->iOutstanding > 0) {
+						return;
+					}
+					state->bDone = true;
+					timer = state->timer.lock();
+				}
+				if (timer) {
+					// The hedge is no longer needed.  Timers are not thread safe, so cancel it on its own strand.
+					net::post(timer->get_executor(), [timer] { timer->cancel(); });
+				}
+				if (state->handler) {
+					state->handler(req, res, sRemoteAddr, iRemotePort);
+				}
+			};
+			pending->handler = handler;
+
+			auto timer = std::make_shared<net::steady_timer>(strand, delay);
+			state->timer = timer;
+			timer->async_wait([self = shared_from_this(), pending, state, handler, timer] (const boost::system::error_code & ec)
+			{
+				{
+					std::lock_guard lock(state->mtx);
+					if (ec || state->bDone) {
+						return;
+					}
+					++state->iOutstanding;
+				}
+				std::shared_ptr<ClientBase> hedge;
+				{
+					std::lock_guard lock(self->mtx);
+					if (!self->hedgeClient) {
+						self->hedgeClient = std::make_shared<ClientBase>(self->sAddress, self->iPort, self->bSSL, self->bAllowSelfSigned);
+						self->hedgeClient->retryPolicy = self->retryPolicy;
+						self->hedgeClient->breakerPolicy = self->breakerPolicy;
+						self->hedgeClient->bDecompress = self->bDecompress;
+						self->hedgeClient->iBodyLimit = self->iBodyLimit;
+					}
+					hedge = self->hedgeClient;
+				}
+				Log(AppLogger::DEBUG) << "ClientBase::Hedge " << self->sAddress << ":" << self->iPort << pending->req->target() << std::endl;
+				hedge->Request(std::make_shared<http::request<http::string_body>>(*pending->req), handler, pending->timeout, pending->req->keep_alive());
+			});
+			core->WakeUp();
+		}
+
+		bool ClientBase::BreakerAllows(const pending_t &pending)
+		{
+			{
+				std::lock_guard lock(mtx);
+				if (!breakerPolicy.bEnabled) {
+					return true;
+				}
+			}
+			std::lock_guard lock(BreakerMutex());
+			auto & breaker = BreakerRegistry()[HostKey()];
+			if (breaker.openUntil == std::chrono::steady_clock::time_point()) {
+				return true;
+			}
+			if (breaker.pTrial == pending.get()) {
+				return true;
+			}
+			if (SteadyNow() < breaker.openUntil || breaker.pTrial) {
+				return false;
+			}
+			// Half open: let one request through to test the host.
+			breaker.pTrial = pending.get();
+			pending->bBreakerTrial = true;
+			return true;
+		}
+
+		void ClientBase::BreakerRecord(bool bFailure)
+		{
+			CircuitBreakerPolicy policy;
+			{
+				std::lock_guard lock(mtx);
+				policy = breakerPolicy;
+			}
+			if (!policy.bEnabled) {
+				return;
+			}
+			std::lock_guard lock(BreakerMutex());
+			auto & breaker = BreakerRegistry()[HostKey()];
+			if (!bFailure) {
+				breaker = {};
+				return;
+			}
+			if (++breaker.iFailures >= policy.iFailureThreshold || breaker.pTrial) {
+				if (breaker.openUntil == std::chrono::steady_clock::time_point() || breaker.pTrial) {
+					Log(AppLogger::WARNING) << "ClientBase::CircuitBreaker Open for " << policy.openTime.count() << "s: " << HostKey() << std::endl;
+				}
+				breaker.openUntil = SteadyNow() + policy.openTime;
+				breaker.pTrial = nullptr;
+			}
+		}
+
+		void ClientBase::BreakerRelease(const pending_t &pending)
+		{
+			pending->bBreakerTrial = false;
+			std::lock_guard lock(BreakerMutex());
+			auto it = BreakerRegistry().find(HostKey());
+			if (it != BreakerRegistry().end() && it->second.pTrial == pending.get()) {
+				it->second.pTrial = nullptr;
+			}
+		}
+
+		void ClientBase::do_next()
+		{
+			std::unique_lock lock(mtx);
+			if (bConnecting) {
+				return;
+			}
+			if (!Connected()) {
+				if (bWriting || bReading || dqQueued.empty()) {
+					// Operations on a closed connection are still unwinding; the last one out calls do_next again.
+					return;
+				}
+				bConnecting = true;
+				stream.reset();
+				PrepStream();
+				connTiming = {};
+				connTiming.resolveStart = SteadyNow();
+				bConnTimingUsed = false;
+				lock.unlock();
+				do_resolve();
+				return;
+			}
+			if (!bWriting && !dqQueued.empty() && CanWrite(dqQueued.front())) {
+				std::vector<pending_t> vBatch;
+				auto now = SteadyNow();
+				do {
+					auto & timing = dqQueued.front()->res->timing;
+					timing.writeStart = now;
+					timing.bReused = bConnTimingUsed;
+					if (!bConnTimingUsed) {
+						timing.resolveStart = connTiming.resolveStart;
+						timing.resolved = connTiming.resolved;
+						timing.connected = connTiming.connected;
+						timing.handshaken = connTiming.handshaken;
+						bConnTimingUsed = true;
+					}
+					vBatch.push_back(dqQueued.front());
+					dqInFlight.push_back(dqQueued.front());
+					dqQueued.pop_front();
+				} while (!vBatch.back()->fnWrite && !dqQueued.empty() && !dqQueued.front()->fnWrite && CanWrite(dqQueued.front()));
+				bWriting = true;
+				ArmTimeout();
+				do_write(std::move(vBatch));
+			}
+			if (!bReading && !dqInFlight.empty() && dqInFlight.front()->bWritten) {
+				bReading = true;
+				ArmTimeout();
+				do_read(dqInFlight.front());
+			}
+		}
+
+		void ClientBase::do_resolve()
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::do_resolve " << sAddress << ":" << iPort << std::endl;
+			auto self = shared_from_this();
+			core->Resolve(sAddress, iPort, [&, self] (const boost::system::error_code & ec, const CoreBase::endpoints_t & vResolved)
+			{
+				net::dispatch(strand, [&, self, ec, vResolved]
+				{
+					if (ec) {
+						self->fail("on_resolve", ec);
+						return;
+					}
+
+					vEndpoints = vResolved;
+					{
+						std::lock_guard lock(mtx);
+						connTiming.resolved = SteadyNow();
+					}
+					self->do_connect();
+				});
+			});
+			core->WakeUp();
+		}
+
+		void ClientBase::do_connect()
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::do_connect " << sAddress << ":" << iPort << std::endl;
+			auto self = shared_from_this();
+			{
+				std::lock_guard lock(mtx);
+				ArmTimeout();
+			}
+			tcp_stream().async_connect(vEndpoints, beast::bind_front_handler([&, self] (const boost::system::error_code & ec, const tcp::endpoint&)
+			{
+				if (ec) {
+					self->fail("on_connect", ec);
+					return;
+				}
+				{
+					std::lock_guard lock(mtx);
+					connTiming.connected = SteadyNow();
+				}
+				if (bSSL) {
+					self->do_handshake();
+				} else {
+					{
+						std::lock_guard lock(mtx);
+						bConnecting = false;
+					}
+					self->do_next();
+				}
+			}));
+			core->WakeUp();
+		}
+
+		void ClientBase::do_handshake()
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::do_handshake " << sAddress << ":" << iPort << std::endl;
+			auto self = shared_from_this();
+			ssl_stream().async_handshake(ssl::stream_base::client, beast::bind_front_handler([&, self] (const boost::system::error_code & ec)
+			{
+				if (ec) {
+					self->fail("on_handshake", ec);
+					return;
+				}
+				{
+					std::lock_guard lock(mtx);
+					connTiming.handshaken = SteadyNow();
+					bConnecting = false;
+				}
+				self->do_next();
+			}));
+			core->WakeUp();
+		}
+
+		void ClientBase::do_write(std::vector<pending_t> vBatch)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::do_write " << sAddress << ":" << iPort << " (" << vBatch.size() << ")" << std::endl;
+			auto self          = shared_from_this();
+			auto write_handler = [&, self, vBatch] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				boost::ignore_unused(bytes_transferred);
+				{
+					std::lock_guard lock(mtx);
+					bWriting = false;
+					if (!ec) {
+						auto now = SteadyNow();
+						for (auto & pending : vBatch) {
+							if (std::ranges::find(dqInFlight, pending) != dqInFlight.end()) {
+								pending->bWritten = true;
+								pending->res->timing.written = now;
+							}
+						}
+					}
+				}
+				if (ec) {
+					self->fail("on_write", ec);
+					return;
+				}
+				self->do_next();
+			};
+			if (vBatch.front()->fnWrite) {
+				vBatch.front()->fnWrite(*this, vBatch.front()->req, write_handler);
+			} else if (vBatch.size() == 1) {
+				if (bSSL) {
+					http::async_write(ssl_stream(), *vBatch.front()->req, beast::bind_front_handler(write_handler));
+				} else {
+					http::async_write(tcp_stream(), *vBatch.front()->req, beast::bind_front_handler(write_handler));
+				}
+			} else {
+				// Pipelined requests go out back-to-back in a single write.
+				auto batch = std::make_shared<std::string>();
+				for (auto & pending : vBatch) {
+					std::ostringstream oss;
+					oss << *pending->req;
+					*batch += oss.str();
+				}
+				auto batch_handler = [write_handler, batch] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+				{
+					write_handler(ec, bytes_transferred);
+				};
+				if (bSSL) {
+					net::async_write(ssl_stream(), net::buffer(*batch), batch_handler);
+				} else {
+					net::async_write(tcp_stream(), net::buffer(*batch), batch_handler);
+				}
+			}
+
+			core->WakeUp();
+		}
+
+		void ClientBase::do_read(pending_t pending)
+		{
+			if (pending->onChunk || pending->bDecompress) {
+				do_read_stream(std::move(pending));
+				return;
+			}
+			Log(AppLogger::DEBUG) << "ClientTCP::do_read " << sAddress << ":" << iPort << std::endl;
+			auto self         = shared_from_this();
+			auto parser       = std::make_shared<http::response_parser<http::string_body>>();
+			parser->body_limit(pending->iBodyLimit);
+			if (pending->req->method() == verb::head) {
+				parser->skip(true);
+			}
+			auto read_handler = [&, self, pending, parser] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				boost::ignore_unused(bytes_transferred);
+				{
+					std::lock_guard lock(mtx);
+					bReading = false;
+				}
+				if (ec) {
+					self->fail("on_read", ec);
+					return;
+				}
+				bool bKeepAliveOut = parser->keep_alive();
+				*pending->res = parser->release();
+				pending->res->iWireBytes = pending->res->body().size();
+				self->on_response(pending, bKeepAliveOut);
+			};
+			// The header is read on its own so the first byte of the response can be timed.
+			auto header_handler = [&, self, pending, parser, read_handler] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				boost::ignore_unused(bytes_transferred);
+				if (ec) {
+					read_handler(ec, 0);
+					return;
+				}
+				pending->res->timing.firstByte = SteadyNow();
+				if (bSSL) {
+					http::async_read(ssl_stream(), buffer, *parser, beast::bind_front_handler(read_handler));
+				} else {
+					http::async_read(tcp_stream(), buffer, *parser, beast::bind_front_handler(read_handler));
+				}
+			};
+			if (bSSL) {
+				http::async_read_header(ssl_stream(), buffer, *parser, beast::bind_front_handler(header_handler));
+			} else {
+				http::async_read_header(tcp_stream(), buffer, *parser, beast::bind_front_handler(header_handler));
+			}
+			core->WakeUp();
+		}
+
+		struct ClientBase::StreamState
+		{
+			http::response_parser<http::buffer_body> parser;
+			std::vector<char> vChunk = std::vector<char>(iStreamChunkSize);
+			uint64_t iReceived = 0;
+			std::unique_ptr<ContentDecoder> decoder;
+		};
+
+		void ClientBase::do_read_stream(pending_t pending)
+		{
+			Log(AppLogger::DEBUG) << "ClientTCP::do_read_stream " << sAddress << ":" << iPort << std::endl;
+			auto self  = shared_from_this();
+			auto state = std::make_shared<StreamState>();
+			// A chunk handler takes the body as it comes, so only bodies collected in memory are limited.  Decoded bytes are
+			// checked again as they are appended, as a small compressed body can inflate far past the limit.
+			state->parser.body_limit(pending->onChunk ? std::numeric_limits<std::uint64_t>::max() : pending->iBodyLimit);
+			if (pending->req->method() == verb::head) {
+				state->parser.skip(true);
+			}
+			auto header_handler = [&, self, pending, state] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				boost::ignore_unused(bytes_transferred);
+				if (ec) {
+					{
+						std::lock_guard lock(mtx);
+						bReading = false;
+					}
+					self->fail("on_read_header", ec);
+					return;
+				}
+				pending->res->timing.firstByte = SteadyNow();
+				if (pending->bDecompress) {
+					auto & header = state->parser.get();
+					if (auto it = header.find(http::field::content_encoding); it != header.end()) {
+						state->decoder = ContentDecoder::Create(it->value());
+						if (!state->decoder) {
+							Log(AppLogger::WARNING) << "ClientBase::on_read_header Unsupported Content-Encoding " << it->value() << ": " << sAddress << ":" << iPort << std::endl;
+						}
+					}
+				}
+				self->do_read_chunk(pending, state);
+			};
+			if (bSSL) {
+				http::async_read_header(ssl_stream(), buffer, state->parser, beast::bind_front_handler(header_handler));
+			} else {
+				http::async_read_header(tcp_stream(), buffer, state->parser, beast::bind_front_handler(header_handler));
+			}
+			core->WakeUp();
+		}
+
+		void ClientBase::do_read_chunk(pending_t pending, std::shared_ptr<StreamState> state)
+		{
+			if (state->parser.is_done()) {
+				{
+					std::lock_guard lock(mtx);
+					bReading = false;
+				}
+				pending->res->base() = state->parser.get().base();
+				pending->res->iWireBytes = state->iReceived;
+				if (state->decoder) {
+					if (!state->decoder->Finished()) {
+						Log(AppLogger::WARNING) << "ClientBase::do_read_chunk Truncated compressed body: " << sAddress << ":" << iPort << std::endl;
+						fail("on_read_chunk", http::error::partial_message);
+						return;
+					}
+					// The body handed to the caller is the decoded one.
+					pending->res->erase(http::field::content_encoding);
+					pending->res->erase(http::field::content_length);
+					pending->res->decodeTime = state->decoder->Elapsed();
+				}
+				on_response(pending, state->parser.keep_alive());
+				return;
+			}
+
+			auto self = shared_from_this();
+			state->parser.get().body().data = state->vChunk.data();
+			state->parser.get().body().size = state->vChunk.size();
+			auto chunk_handler = [&, self, pending, state] (boost::system::error_code ec, std::size_t bytes_transferred)
+			{
+				boost::ignore_unused(bytes_transferred);
+				if (ec == http::error::need_buffer) {
+					ec = {};
+				}
+				if (!ec) {
+					size_t iSize = state->vChunk.size() - state->parser.get().body().size;
+					if (iSize) {
+						state->iReceived += iSize;
+						bool bOverLimit = false;
+						auto sink = [&] (std::string_view sChunk)
+						{
+							if (pending->onChunk) {
+								return pending->onChunk(sChunk);
+							}
+							if (pending->res->body().size() + sChunk.size() > pending->iBodyLimit) {
+								bOverLimit = true;
+								return false;
+							}
+							pending->res->body().append(sChunk);
+							return true;
+						};
+						std::string_view sData(state->vChunk.data(), iSize);
+						if (!(state->decoder ? state->decoder->Feed(sData, sink) : sink(sData))) {
+							if (bOverLimit) {
+								Log(AppLogger::WARNING) << "ClientBase::on_read_chunk Body exceeds " << pending->iBodyLimit << " bytes: " << sAddress << ":" << iPort << std::endl;
+								ec = http::error::body_limit;
+							} else {
+								Log(AppLogger::WARNING) << "ClientBase::on_read_chunk Aborted by sink: " << sAddress << ":" << iPort << std::endl;
+								ec = net::error::operation_aborted;
+							}
+						} else if (pending->onProgress) {
+							pending->onProgress(state->iReceived, state->parser.content_length().value_or(0));
+						}
+					}
+				}
+				if (ec) {
+					{
+						std::lock_guard lock(mtx);
+						bReading = false;
+					}
+					self->fail("on_read_chunk", ec);
+					return;
+				}
+				{
+					std::lock_guard lock(mtx);
+					pending->deadline = SteadyNow() + pending->timeout;
+					ArmTimeout();
+				}
+				self->do_read_chunk(pending, state);
+			};
+			if (bSSL) {
+				http::async_read(ssl_stream(), buffer, state->parser, beast::bind_front_handler(chunk_handler));
+			} else {
+				http::async_read(tcp_stream(), buffer, state->parser, beast::bind_front_handler(chunk_handler));
+			}
+			core->WakeUp();
+		}
+
+		void ClientBase::on_response(const pending_t & pending, bool bKeepAliveOut)
+		{
+			std::vector<pending_t> vDropped;
+			{
+				std::lock_guard lock(mtx);
+				if (!dqInFlight.empty() && dqInFlight.front() == pending) {
+					dqInFlight.pop_front();
+				}
+				if (!bKeepAliveOut) {
+					// The server is closing, so anything pipelined behind this response goes out again on a new connection.
+					while (!dqInFlight.empty()) {
+						if (dqInFlight.back()->bReplayable) {
+							dqInFlight.back()->bWritten = false;
+							dqQueued.push_front(dqInFlight.back());
+						} else {
+							Log(AppLogger::ERROR) << "ClientBase::on_response Dropping streamed request the server closed on: " << sAddress << ":" << iPort << std::endl;
+							vDropped.push_back(dqInFlight.back());
+						}
+						dqInFlight.pop_back();
+					}
+					boost::system::error_code ecClose;
+					tcp_stream().socket().close(ecClose);
+				}
+			}
+			pending->res->timing.complete = SteadyNow();
+			RecordTiming(HostKey(), pending->res->timing);
+			BreakerRecord(pending->res->result_int() >= 500);
+			complete(pending, {});
+			for (auto & dropped : vDropped) {
+				complete(dropped, net::error::connection_reset);
+			}
+			if (buffer.capacity() > iMaxIdleBuffer) {
+				// One large response should not pin its read buffer for the life of the connection.
+				buffer.shrink_to_fit();
+			}
+			do_next();
+		}
+
+		std::string ClientBase::HostKey() const
+		{
+			return sAddress + ":" + std::to_string(iPort);
+		}
+
+		client_t Client(const std::string &sAddress, int iPort, bool bSSLIn, bool bAllowSelfSignedIn)
+		{
+			return std::make_shared<ClientBase>(sAddress, iPort, bSSLIn, bAllowSelfSignedIn);
+		}
+
+		class ServerBase::Session : public std::enable_shared_from_this<Session>
+		{
+			public:
+				Session(std::shared_ptr<ServerBase> serverIn, tcp::socket && socket) :
+					server(std::move(serverIn)),
+					stream(std::move(socket), server->ssl_ctx)
+				{
+					boost::system::error_code ec;
+					auto endpoint = tcp_stream().socket().remote_endpoint(ec);
+					if (!ec) {
+						sRemoteAddr = endpoint.address().to_string();
+						iRemotePort = endpoint.port();
+					}
+					Log(AppLogger::DEBUG) << "HTTP::Server::Session " << sRemoteAddr << ":" << iRemotePort << std::endl;
+				}
+
+				~Session()
+				{
+					Log(AppLogger::DEBUG) << "HTTP::Server::~Session " << sRemoteAddr << ":" << iRemotePort << std::endl;
+					server->SessionEnded(this);
+				}
+
+				void Start()
+				{
+					auto self = shared_from_this();
+					if (server->bSSL) {
+						tcp_stream().expires_after(server->keepAliveTimeout);
+						stream.async_handshake(ssl::stream_base::server, [self] (const boost::system::error_code & ec)
+						{
+							if (ec) {
+								Log(AppLogger::DEBUG) << "HTTP::Server::on_handshake " << ec.message() << ": " << self->sRemoteAddr << ":" << self->iRemotePort << std::endl;
+								return;
+							}
+							self->do_read();
+						});
+					} else {
+						net::dispatch(tcp_stream().get_executor(), [self] { self->do_read(); });
+					}
+					server->core->WakeUp();
+				}
+
+				void Drain()
+				{
+					// Idle connections close now, busy ones close after their response goes out.
+					auto self = shared_from_this();
+					net::post(tcp_stream().get_executor(), [self]
+					{
+						if (!self->bBusy) {
+							boost::system::error_code ec;
+							self->tcp_stream().socket().close(ec);
+						}
+					});
+				}
+
+				void Abort()
+				{
+					auto self = shared_from_this();
+					net::post(tcp_stream().get_executor(), [self]
+					{
+						boost::system::error_code ec;
+						self->tcp_stream().socket().close(ec);
+					});
+				}
+
+			private:
+				beast::tcp_stream & tcp_stream()
+				{
+					return stream.next_layer();
+				}
+
+				void do_read()
+				{
+					bBusy = false;
+					parser.emplace();
+					parser->body_limit(server->iBodyLimit);
+					tcp_stream().expires_after(server->keepAliveTimeout);
+					auto self = shared_from_this();
+					auto read_handler = [self] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+					{
+						boost::ignore_unused(bytes_transferred);
+						self->on_read(ec);
+					};
+					if (server->bSSL) {
+						http::async_read(stream, buffer, *parser, std::move(read_handler));
+					} else {
+						http::async_read(tcp_stream(), buffer, *parser, std::move(read_handler));
+					}
+				}
+
+				void on_read(const boost::system::error_code & ec)
+				{
+					if (ec == http::error::end_of_stream || ec == beast::error::timeout || ec == net::error::operation_aborted) {
+						do_close();
+						return;
+					}
+					if (ec == http::error::body_limit || ec == http::error::header_limit || ec == http::error::buffer_overflow) {
+						auto res = std::make_shared<Response>(ec == http::error::body_limit ? http::status::payload_too_large : http::status::request_header_fields_too_large, 11);
+						res->set(http::field::server, BOOST_BEAST_VERSION_STRING);
+						res->keep_alive(false);
+						res->prepare_payload();
+						do_write(res);
+						return;
+					}
+					if (ec) {
+						Log(AppLogger::DEBUG) << "HTTP::Server::on_read " << ec.message() << ": " << sRemoteAddr << ":" << iRemotePort << std::endl;
+						do_close();
+						return;
+					}
+
+					bBusy = true;
+					auto req = std::make_shared<http::request<http::string_body>>(parser->release());
+					auto res = std::make_shared<Response>(http::status::ok, req->version());
+					res->set(http::field::server, BOOST_BEAST_VERSION_STRING);
+					res->keep_alive(req->keep_alive());
+					server->Dispatch(req, res, sRemoteAddr, iRemotePort);
+					if (server->bDraining) {
+						res->keep_alive(false);
+					}
+					res->prepare_payload();
+					do_write(res);
+				}
+
+				void do_write(response_t res)
+				{
+					tcp_stream().expires_after(server->keepAliveTimeout);
+					auto self = shared_from_this();
+					auto write_handler = [self, res] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+					{
+						boost::ignore_unused(bytes_transferred);
+						// keep_alive() was settled before the handler ran, and Stop() may have come since.
+						if (ec || !res->keep_alive() || self->server->bDraining) {
+							self->do_close();
+							return;
+						}
+						self->do_read();
+					};
+					if (server->bSSL) {
+						http::async_write(stream, *res, std::move(write_handler));
+					} else {
+						http::async_write(tcp_stream(), *res, std::move(write_handler));
+					}
+				}
+
+				void do_close()
+				{
+					bBusy = false;
+					if (server->bSSL && tcp_stream().socket().is_open()) {
+						tcp_stream().expires_after(1s);
+						auto self = shared_from_this();
+						stream.async_shutdown([self] (const boost::system::error_code &)
+						{
+							boost::system::error_code ec;
+							self->tcp_stream().socket().close(ec);
+						});
+						return;
+					}
+					boost::system::error_code ec;
+					tcp_stream().socket().shutdown(tcp::socket::shutdown_send, ec);
+					tcp_stream().socket().close(ec);
+				}
+
+				std::shared_ptr<ServerBase> server;
+				beast::ssl_stream<beast::tcp_stream> stream;
+				beast::flat_static_buffer<iParseBufferSize> buffer;
+				std::optional<http::request_parser<http::string_body>> parser;
+				std::string sRemoteAddr;
+				int iRemotePort = 0;
+				bool bBusy = false;
+		};
+
+		ServerBase::ServerBase(std::string sAddressIn, int iPortIn, bool bSSLIn, std::string sCertFileIn, std::string sKeyFileIn) :
+			core(Core()),
+			sAddress(std::move(sAddressIn)),
+			iPort(iPortIn),
+			bSSL(bSSLIn),
+			sCertFile(std::move(sCertFileIn)),
+			sKeyFile(std::move(sKeyFileIn)),
+			strand(net::make_strand(core->IOContext())),
+			acceptor(strand)
+		{
+			Log(AppLogger::DEBUG) << "HTTP::Server::Server " << sAddress << ":" << iPort << std::endl;
+		}
+
+		ServerBase::~ServerBase()
+		{
+			boost::system::error_code ec;
+			acceptor.close(ec);
+			Log(AppLogger::DEBUG) << "HTTP::Server::~Server " << sAddress << ":" << iPort << std::endl;
+		}
+
+		void ServerBase::Route(verb method, const std::string &sPath, handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			RouteEntry entry;
+			entry.method = method;
+			entry.bPrefix = !sPath.empty() && sPath.back() == '*';
+			entry.sPath = entry.bPrefix ? sPath.substr(0, sPath.size() - 1) : sPath;
+			entry.handler = std::move(handlerIn);
+			auto it = std::ranges::find_if(vRoutes, [&](const RouteEntry & route) { return route.method == entry.method && route.sPath == entry.sPath && route.bPrefix == entry.bPrefix; });
+			if (it != vRoutes.end()) {
+				*it = std::move(entry);
+			} else {
+				vRoutes.push_back(std::move(entry));
+			}
+		}
+
+		void ServerBase::MaxConnections(size_t iMaxIn)
+		{
+			std::lock_guard lock(mtx);
+			iMaxConnections = std::max<size_t>(iMaxIn, 1);
+		}
+
+		void ServerBase::KeepAliveTimeout(std::chrono::seconds timeout)
+		{
+			keepAliveTimeout = timeout;
+		}
+
+		void ServerBase::BodyLimit(uint64_t iLimitIn)
+		{
+			iBodyLimit = iLimitIn;
+		}
+
+		size_t ServerBase::Connections()
+		{
+			std::lock_guard lock(mtx);
+			return mSessions.size();
+		}
+
+		int ServerBase::Port() const
+		{
+			boost::system::error_code ec;
+			auto endpoint = acceptor.local_endpoint(ec);
+			return ec ? iPort : endpoint.port();
+		}
+
+		bool ServerBase::Running() const
+		{
+			return bRunning;
+		}
+
+		bool ServerBase::Start()
+		{
+			Log(AppLogger::DEBUG) << "HTTP::Server::Start " << sAddress << ":" << iPort << std::endl;
+			boost::system::error_code ec;
+			if (bSSL) {
+				ssl_ctx.use_certificate_chain_file(sCertFile, ec);
+				if (!ec) {
+					ssl_ctx.use_private_key_file(sKeyFile, ssl::context::pem, ec);
+				}
+				if (ec) {
+					Log(AppLogger::ERROR) << "HTTP::Server::Start Certificate Error: " << ec.message() << ": " << sCertFile << ", " << sKeyFile << std::endl;
+					return false;
+				}
+			}
+
+			auto address = net::ip::make_address(sAddress, ec);
+			if (ec) {
+				Log(AppLogger::ERROR) << "HTTP::Server::Start Address Error: " << ec.message() << ": " << sAddress << std::endl;
+				return false;
+			}
+			tcp::endpoint endpoint(address, static_cast<unsigned short>(iPort));
+			acceptor.open(endpoint.protocol(), ec);
+			if (!ec) {
+				acceptor.set_option(net::socket_base::reuse_address(true), ec);
+			}
+			if (!ec) {
+				acceptor.bind(endpoint, ec);
+			}
+			if (!ec) {
+				acceptor.listen(net::socket_base::max_listen_connections, ec);
+			}
+			if (ec) {
+				Log(AppLogger::ERROR) << "HTTP::Server::Start Listen Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
+				boost::system::error_code ecClose;
+				acceptor.close(ecClose);
+				return false;
+			}
+
+			{
+				std::lock_guard lock(mtx);
+				bRunning = true;
+				bDraining = false;
+				bAccepting = true;
+				EventHandlerReset(eDrained);
+			}
+			{
+				std::lock_guard lock(RegistryMutex());
+				std::erase_if(Registry(), [](const std::weak_ptr<ServerBase> & server) { return server.expired(); });
+				Registry().push_back(weak_from_this());
+			}
+			net::post(strand, beast::bind_front_handler(&ServerBase::do_accept, shared_from_this()));
+			core->WakeUp();
+			return true;
+		}
+
+		void ServerBase::Stop(std::chrono::milliseconds drainTimeout)
+		{
+			std::vector<std::shared_ptr<Session>> vSessions;
+			{
+				std::lock_guard lock(mtx);
+				if (!bRunning) {
+					return;
+				}
+				Log(AppLogger::DEBUG) << "HTTP::Server::Stop " << sAddress << ":" << iPort << " draining " << mSessions.size() << " connection(s)" << std::endl;
+				bRunning = false;
+				bDraining = true;
+				for (auto & session : mSessions | std::views::values) {
+					if (auto pSession = session.lock()) {
+						vSessions.push_back(std::move(pSession));
+					}
+				}
+				if (mSessions.empty()) {
+					EventHandlerSet(eDrained);
+				}
+			}
+			auto self = shared_from_this();
+			net::post(strand, [self]
+			{
+				boost::system::error_code ec;
+				self->acceptor.close(ec);
+			});
+			for (auto & session : vSessions) {
+				session->Drain();
+			}
+			vSessions.clear();
+			core->WakeUp();
+
+			if (EventHandlerWait({eDrained}, drainTimeout) != 0) {
+				// Abort outside the lock: dropping the last reference to a session ends up in SessionEnded(), which takes mtx.
+				{
+					std::lock_guard lock(mtx);
+					Log(AppLogger::WARNING) << "HTTP::Server::Stop " << sAddress << ":" << iPort << " aborting " << mSessions.size() << " connection(s) after drain timeout" << std::endl;
+					for (auto & session : mSessions | std::views::values) {
+						if (auto pSession = session.lock()) {
+							vSessions.push_back(std::move(pSession));
+						}
+					}
+				}
+				for (auto & session : vSessions) {
+					session->Abort();
+				}
+			}
+		}
+
+		void ServerBase::StopAll(std::chrono::milliseconds drainTimeout)
+		{
+			std::vector<std::shared_ptr<ServerBase>> vServers;
+			{
+				std::lock_guard lock(RegistryMutex());
+				for (auto & server : Registry()) {
+					if (auto pServer = server.lock()) {
+						vServers.push_back(std::move(pServer));
+					}
+				}
+				Registry().clear();
+			}
+			for (auto & server : vServers) {
+				server->Stop(drainTimeout);
+			}
+		}
+
+		std::mutex & ServerBase::RegistryMutex()
+		{
+			static std::mutex ret;
+			return ret;
+		}
+
+		std::vector<std::weak_ptr<ServerBase>> & ServerBase::Registry()
+		{
+			static std::vector<std::weak_ptr<ServerBase>> ret;
+			return ret;
+		}
+
+		void ServerBase::do_accept()
+		{
+			auto self = shared_from_this();
+			acceptor.async_accept(net::make_strand(core->IOContext()), [self] (const boost::system::error_code & ec, tcp::socket socket)
+			{
+				if (ec) {
+					std::lock_guard lock(self->mtx);
+					self->bAccepting = false;
+					if (ec != net::error::operation_aborted) {
+						Log(AppLogger::ERROR) << "HTTP::Server::on_accept Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+						if (self->bRunning) {
+							self->bAccepting = true;
+							auto timer = std::make_shared<net::steady_timer>(self->strand, acceptRetryDelay);
+							timer->async_wait([self, timer] (const boost::system::error_code &)
+							{
+								{
+									std::lock_guard lock(self->mtx);
+									if (!self->bRunning) {
+										self->bAccepting = false;
+										return;
+									}
+								}
+								self->do_accept();
+							});
+						}
+					}
+					return;
+				}
+				auto session = std::make_shared<Session>(self, std::move(socket));
+				bool bMore = false;
+				{
+					std::lock_guard lock(self->mtx);
+					self->mSessions[session.get()] = session;
+					bMore = self->bRunning && self->mSessions.size() < self->iMaxConnections;
+					self->bAccepting = bMore;
+				}
+				session->Start();
+				if (bMore) {
+					self->do_accept();
+				}
+			});
+			core->WakeUp();
+		}
+
+		void ServerBase::Dispatch(const request_t &req, const response_t &res, const std::string &sRemoteAddr, int iRemotePort)
+		{
+			std::string_view sTarget(req->target().data(), req->target().size());
+			sTarget = sTarget.substr(0, sTarget.find('?'));
+			handler_t handler;
+			{
+				std::lock_guard lock(mtx);
+				size_t iBest = 0;
+				for (auto & route : vRoutes) {
+					if (route.method != verb::unknown && route.method != req->method()) {
+						continue;
+					}
+					if (route.bPrefix ? sTarget.starts_with(route.sPath) : sTarget == route.sPath) {
+						size_t iScore = route.sPath.size() * 2 + (route.bPrefix ? 0 : 1);
+						if (!handler || iScore > iBest) {
+							handler = route.handler;
+							iBest = iScore;
+						}
+					}
+				}
+			}
+			if (!handler) {
+				res->result(http::status::not_found);
+				res->set(http::field::content_type, "text/plain");
+				res->body() = "Not Found";
+				return;
+			}
+			try {
+				handler(req, res, sRemoteAddr, iRemotePort);
+			} catch (std::exception & e) {
+				Log(AppLogger::ERROR) << "HTTP::Server::Dispatch Handler Error: " << e.what() << ": " << req->target() << std::endl;
+				res->result(http::status::internal_server_error);
+				res->set(http::field::content_type, "text/plain");
+				res->body() = "Internal Server Error";
+			}
+		}
+
+		void ServerBase::SessionEnded(Session * session)
+		{
+			std::lock_guard lock(mtx);
+			mSessions.erase(session);
+			if (bDraining) {
+				if (mSessions.empty()) {
+					EventHandlerSet(eDrained);
+				}
+			} else if (bRunning && !bAccepting && mSessions.size() < iMaxConnections) {
+				bAccepting = true;
+				net::post(strand, beast::bind_front_handler(&ServerBase::do_accept, shared_from_this()));
+				core->WakeUp();
+			}
+		}
+
+		server_t Server(const std::string &sAddress, int iPort, bool bSSLIn, const std::string &sCertFile, const std::string &sKeyFile)
+		{
+			return std::make_shared<ServerBase>(sAddress, iPort, bSSLIn, sCertFile, sKeyFile);
+		}
+	} // namespace HTTP
+
+	namespace WebSocket
+	{
+		ConnectionBase::ConnectionBase(net::strand<net::io_context::executor_type> strandIn, bool bSSLIn, bool bDeflateIn) :
+			core(Core()),
+			strand(std::move(strandIn)),
+			bSSL(bSSLIn),
+			bDeflate(bDeflateIn)
+		{
+		}
+
+		ConnectionBase::~ConnectionBase()
+		{
+			Log(AppLogger::DEBUG) << "WebSocket::~Connection " << sRemoteAddr << ":" << iRemotePort << std::endl;
+		}
+
+		void ConnectionBase::OnMessage(message_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onMessage = std::move(handlerIn);
+		}
+
+		void ConnectionBase::OnClose(close_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onClose = std::move(handlerIn);
+		}
+
+		void ConnectionBase::Send(std::string sMessage, bool bBinary)
+		{
+			Send(std::make_shared<const std::string>(std::move(sMessage)), bBinary);
+		}
+
+		void ConnectionBase::Send(std::shared_ptr<const std::string> message, bool bBinary)
+		{
+			{
+				std::lock_guard lock(mtx);
+				if (bClosing || bClosed) {
+					return;
+				}
+				iQueuedBytes += message->size();
+				dqOutgoing.push_back({std::move(message), bBinary});
+				if (iQueuedBytes > iHighWater) {
+					EventHandlerSet(eBackpressure);
+				}
+			}
+			net::post(strand, beast::bind_front_handler(&ConnectionBase::do_write, shared_from_this()));
+			core->WakeUp();
+		}
+
+		void ConnectionBase::Close(websocket::close_code code)
+		{
+			{
+				std::lock_guard lock(mtx);
+				if (bClosing || bClosed) {
+					return;
+				}
+				bClosing = true;
+				closeCode = code;
+			}
+			// Whatever is already queued goes out before the close frame.
+			net::post(strand, beast::bind_front_handler(&ConnectionBase::do_write, shared_from_this()));
+			core->WakeUp();
+		}
+
+		void ConnectionBase::Coalesce(bool bCoalesceIn, size_t iMaxBytesIn, std::string sSeparatorIn)
+		{
+			std::lock_guard lock(mtx);
+			bCoalesce = bCoalesceIn;
+			iCoalesceMax = iMaxBytesIn;
+			sSeparator = std::move(sSeparatorIn);
+		}
+
+		void ConnectionBase::Watermarks(size_t iHighIn, size_t iLowIn)
+		{
+			std::lock_guard lock(mtx);
+			iHighWater = iHighIn;
+			iLowWater = std::min(iLowIn, iHighIn);
+		}
+
+		EventHandler::Event ConnectionBase::Backpressure() const
+		{
+			return eBackpressure;
+		}
+
+		size_t ConnectionBase::Queued()
+		{
+			std::lock_guard lock(mtx);
+			return iQueuedBytes;
+		}
+
+		bool ConnectionBase::IsOpen()
+		{
+			std::lock_guard lock(mtx);
+			return bOpen;
+		}
+
+		const std::string & ConnectionBase::RemoteAddress() const
+		{
+			return sRemoteAddr;
+		}
+
+		int ConnectionBase::RemotePort() const
+		{
+			return iRemotePort;
+		}
+
+		template <class F>
+		void ConnectionBase::with_stream(F && f)
+		{
+			if (bSSL) {
+				f(*secure);
+			} else {
+				f(*plain);
+			}
+		}
+
+		namespace
+		{
+			// A stream keeps only one decorator, so the client and server sides share it.
+			struct Decorator
+			{
+				void operator()(websocket::request_type & req) const { req.set(http::field::user_agent, BOOST_BEAST_VERSION_STRING); }
+				void operator()(websocket::response_type & res) const { res.set(http::field::server, BOOST_BEAST_VERSION_STRING); }
+			};
+		}
+
+		template <class WS>
+		void ConnectionBase::SetOptions(WS & ws, beast::role_type role)
+		{
+			ws.set_option(websocket::stream_base::timeout::suggested(role));
+			ws.set_option(websocket::stream_base::decorator(Decorator{}));
+			if (bDeflate) {
+				websocket::permessage_deflate pmd;
+				pmd.client_enable = true;
+				pmd.server_enable = true;
+				ws.set_option(pmd);
+			}
+		}
+
+		void ConnectionBase::Accept(tcp::socket && socket, ssl::context & ctx, std::shared_ptr<void> ownerIn, open_handler_t onOpenIn)
+		{
+			owner = std::move(ownerIn);
+			onOpen = std::move(onOpenIn);
+			boost::system::error_code ec;
+			auto endpoint = socket.remote_endpoint(ec);
+			if (!ec) {
+				sRemoteAddr = endpoint.address().to_string();
+				iRemotePort = endpoint.port();
+			}
+			Log(AppLogger::DEBUG) << "WebSocket::Accept " << sRemoteAddr << ":" << iRemotePort << std::endl;
+
+			auto self = shared_from_this();
+			auto accept_handler = [self] (const boost::system::error_code & ec)
+			{
+				if (ec) {
+					self->on_closed(ec);
+					return;
+				}
+				self->Opened();
+			};
+			if (bSSL) {
+				secure = std::make_unique<websocket::stream<beast::ssl_stream<beast::tcp_stream>>>(std::move(socket), ctx);
+				SetOptions(*secure, beast::role_type::server);
+				beast::get_lowest_layer(*secure).expires_after(30s);
+				secure->next_layer().async_handshake(ssl::stream_base::server, [self, accept_handler] (const boost::system::error_code & ec)
+				{
+					if (ec) {
+						self->on_closed(ec);
+						return;
+					}
+					beast::get_lowest_layer(*self->secure).expires_never();
+					self->secure->async_accept(accept_handler);
+				});
+			} else {
+				plain = std::make_unique<websocket::stream<beast::tcp_stream>>(std::move(socket));
+				SetOptions(*plain, beast::role_type::server);
+				plain->async_accept(accept_handler);
+			}
+			core->WakeUp();
+		}
+
+		void ConnectionBase::Opened()
+		{
+			Log(AppLogger::DEBUG) << "WebSocket::Opened " << sRemoteAddr << ":" << iRemotePort << std::endl;
+			open_handler_t handler;
+			{
+				std::lock_guard lock(mtx);
+				bOpen = true;
+				handler = onOpen;
+			}
+			if (handler) {
+				handler(shared_from_this());
+			}
+			do_read();
+			do_write();
+		}
+
+		void ConnectionBase::do_read()
+		{
+			auto self = shared_from_this();
+			with_stream([&] (auto & ws)
+			{
+				ws.async_read(readBuffer, [self, &ws] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+				{
+					boost::ignore_unused(bytes_transferred);
+					if (ec) {
+						self->on_closed(ec);
+						return;
+					}
+					message_handler_t handler;
+					{
+						std::lock_guard lock(self->mtx);
+						handler = self->onMessage;
+					}
+					if (handler) {
+						auto data = self->readBuffer.cdata();
+						handler(self, std::string_view(static_cast<const char *>(data.data()), data.size()), ws.got_binary());
+					}
+					self->readBuffer.consume(self->readBuffer.size());
+					self->do_read();
+				});
+			});
+			core->WakeUp();
+		}
+
+		void ConnectionBase::do_write()
+		{
+			std::unique_lock lock(mtx);
+			if (bWriting || !bOpen) {
+				return;
+			}
+			if (dqOutgoing.empty()) {
+				if (bClosing && !bCloseSent) {
+					bCloseSent = true;
+					auto code = closeCode;
+					lock.unlock();
+					auto self = shared_from_this();
+					with_stream([&] (auto & ws)
+					{
+						// The read loop sees the close complete and reports it.
+						ws.async_close(code, [self] (const boost::system::error_code &) {});
+					});
+					core->WakeUp();
+				}
+				return;
+			}
+
+			auto front = dqOutgoing.front();
+			dqOutgoing.pop_front();
+			size_t iBytes = front.message->size();
+			auto message = front.message;
+			if (bCoalesce && iBytes < iCoalesceMax && !dqOutgoing.empty() && dqOutgoing.front().bBinary == front.bBinary) {
+				auto joined = std::make_shared<std::string>(*front.message);
+				while (!dqOutgoing.empty() && dqOutgoing.front().bBinary == front.bBinary && joined->size() + sSeparator.size() + dqOutgoing.front().message->size() <= iCoalesceMax) {
+					*joined += sSeparator;
+					*joined += *dqOutgoing.front().message;
+					iBytes += dqOutgoing.front().message->size();
+					dqOutgoing.pop_front();
+				}
+				message = std::move(joined);
+			}
+			bWriting = true;
+			lock.unlock();
+
+			auto self = shared_from_this();
+			with_stream([&] (auto & ws)
+			{
+				ws.binary(front.bBinary);
+				ws.async_write(net::buffer(*message), [self, message, iBytes] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+				{
+					boost::ignore_unused(bytes_transferred);
+					{
+						std::lock_guard lock(self->mtx);
+						self->bWriting = false;
+						self->iQueuedBytes -= std::min(iBytes, self->iQueuedBytes);
+						if (self->iQueuedBytes <= self->iLowWater) {
+							EventHandlerReset(self->eBackpressure);
+						}
+					}
+					if (ec) {
+						self->on_closed(ec);
+						return;
+					}
+					self->do_write();
+				});
+			});
+			core->WakeUp();
+		}
+
+		void ConnectionBase::on_closed(const boost::system::error_code & ec)
+		{
+			close_handler_t handler;
+			{
+				std::lock_guard lock(mtx);
+				if (bClosed) {
+					return;
+				}
+				bClosed = true;
+				bOpen = false;
+				dqOutgoing.clear();
+				iQueuedBytes = 0;
+				EventHandlerReset(eBackpressure);
+				handler = std::move(onClose);
+				onMessage = nullptr;
+				onOpen = nullptr;
+			}
+			if (ec && ec != websocket::error::closed && ec != net::error::operation_aborted) {
+				Log(AppLogger::DEBUG) << "WebSocket::on_closed " << ec.message() << ": " << sRemoteAddr << ":" << iRemotePort << std::endl;
+			}
+			if (handler) {
+				handler(shared_from_this(), ec);
+			}
+		}
+
+		ClientBase::ClientBase(std::string sAddressIn, int iPortIn, std::string sPathIn, bool bSSLIn, bool bDeflateIn) :
+			ConnectionBase(net::make_strand(Core()->IOContext()), bSSLIn, bDeflateIn),
+			sAddress(std::move(sAddressIn)),
+			iPort(iPortIn),
+			sPath(std::move(sPathIn))
+		{
+			sRemoteAddr = sAddress;
+			iRemotePort = iPort;
+			Log(AppLogger::DEBUG) << "WebSocket::Client " << sAddress << ":" << iPort << sPath << std::endl;
+		}
+
+		void ClientBase::Connect(open_handler_t onOpenIn)
+		{
+			{
+				std::lock_guard lock(mtx);
+				onOpen = std::move(onOpenIn);
+			}
+			if (bSSL) {
+				secure = std::make_unique<websocket::stream<beast::ssl_stream<beast::tcp_stream>>>(strand, ssl_ctx);
+				SetOptions(*secure, beast::role_type::client);
+			} else {
+				plain = std::make_unique<websocket::stream<beast::tcp_stream>>(strand);
+				SetOptions(*plain, beast::role_type::client);
+			}
+
+			auto self = std::static_pointer_cast<ClientBase>(shared_from_this());
+			core->Resolve(sAddress, iPort, [self] (const boost::system::error_code & ec, const CoreBase::endpoints_t & vResolved)
+			{
+				net::dispatch(self->strand, [self, ec, vResolved]
+				{
+					if (ec) {
+						Log(AppLogger::ERROR) << "WebSocket::on_resolve Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+						self->on_closed(ec);
+						return;
+					}
+					self->with_stream([&] (auto & ws) { self->do_connect(ws, vResolved); });
+				});
+			});
+			core->WakeUp();
+		}
+
+		template <class WS>
+		void ClientBase::do_connect(WS & ws, const CoreBase::endpoints_t & vEndpoints)
+		{
+			auto self = std::static_pointer_cast<ClientBase>(shared_from_this());
+			beast::get_lowest_layer(ws).expires_after(30s);
+			beast::get_lowest_layer(ws).async_connect(vEndpoints, [self, &ws] (const boost::system::error_code & ec, const tcp::endpoint & endpoint)
+			{
+				if (ec) {
+					Log(AppLogger::ERROR) << "WebSocket::on_connect Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+					self->on_closed(ec);
+					return;
+				}
+				auto sHost = self->sAddress + ":" + std::to_string(endpoint.port());
+				auto do_handshake = [self, &ws, sHost]
+				{
+					// The websocket stream has its own timeouts from here on.
+					beast::get_lowest_layer(ws).expires_never();
+					ws.async_handshake(sHost, self->sPath, [self] (const boost::system::error_code & ec)
+					{
+						if (ec) {
+							Log(AppLogger::ERROR) << "WebSocket::on_handshake Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+							self->on_closed(ec);
+							return;
+						}
+						self->Opened();
+					});
+				};
+				if constexpr (std::is_same_v<WS, websocket::stream<beast::ssl_stream<beast::tcp_stream>>>) {
+					SSL_set_tlsext_host_name(ws.next_layer().native_handle(), self->sAddress.c_str());
+					ws.next_layer().async_handshake(ssl::stream_base::client, [self, do_handshake] (const boost::system::error_code & ec)
+					{
+						if (ec) {
+							Log(AppLogger::ERROR) << "WebSocket::on_ssl_handshake Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+							self->on_closed(ec);
+							return;
+						}
+						do_handshake();
+					});
+				} else {
+					do_handshake();
+				}
+			});
+			core->WakeUp();
+		}
+
+		client_t Client(const std::string &sAddress, int iPort, const std::string &sPath, bool bSSLIn)
+		{
+			return std::make_shared<ClientBase>(sAddress, iPort, sPath, bSSLIn);
+		}
+
+		ServerBase::ServerBase(std::string sAddressIn, int iPortIn, bool bSSLIn, std::string sCertFileIn, std::string sKeyFileIn) :
+			core(Core()),
+			sAddress(std::move(sAddressIn)),
+			iPort(iPortIn),
+			bSSL(bSSLIn),
+			sCertFile(std::move(sCertFileIn)),
+			sKeyFile(std::move(sKeyFileIn)),
+			strand(net::make_strand(core->IOContext())),
+			acceptor(strand)
+		{
+			Log(AppLogger::DEBUG) << "WebSocket::Server::Server " << sAddress << ":" << iPort << std::endl;
+		}
+
+		ServerBase::~ServerBase()
+		{
+			boost::system::error_code ec;
+			acceptor.close(ec);
+			Log(AppLogger::DEBUG) << "WebSocket::Server::~Server " << sAddress << ":" << iPort << std::endl;
+		}
+
+		void ServerBase::OnOpen(open_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onOpen = std::move(handlerIn);
+		}
+
+		void ServerBase::OnMessage(message_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onMessage = std::move(handlerIn);
+		}
+
+		void ServerBase::OnClose(close_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onClose = std::move(handlerIn);
+		}
+
+		void ServerBase::Deflate(bool bDeflateIn)
+		{
+			std::lock_guard lock(mtx);
+			bDeflate = bDeflateIn;
+		}
+
+		int ServerBase::Port() const
+		{
+			boost::system::error_code ec;
+			auto endpoint = acceptor.local_endpoint(ec);
+			return ec ? iPort : endpoint.port();
+		}
+
+		bool ServerBase::Start()
+		{
+			Log(AppLogger::DEBUG) << "WebSocket::Server::Start " << sAddress << ":" << iPort << std::endl;
+			boost::system::error_code ec;
+			if (bSSL) {
+				ssl_ctx.use_certificate_chain_file(sCertFile, ec);
+				if (!ec) {
+					ssl_ctx.use_private_key_file(sKeyFile, ssl::context::pem, ec);
+				}
+				if (ec) {
+					Log(AppLogger::ERROR) << "WebSocket::Server::Start Certificate Error: " << ec.message() << ": " << sCertFile << ", " << sKeyFile << std::endl;
+					return false;
+				}
+			}
+
+			auto address = net::ip::make_address(sAddress, ec);
+			if (ec) {
+				Log(AppLogger::ERROR) << "WebSocket::Server::Start Address Error: " << ec.message() << ": " << sAddress << std::endl;
+				return false;
+			}
+			tcp::endpoint endpoint(address, static_cast<unsigned short>(iPort));
+			acceptor.open(endpoint.protocol(), ec);
+			if (!ec) {
+				acceptor.set_option(net::socket_base::reuse_address(true), ec);
+			}
+			if (!ec) {
+				acceptor.bind(endpoint, ec);
+			}
+			if (!ec) {
+				acceptor.listen(net::socket_base::max_listen_connections, ec);
+			}
+			if (ec) {
+				Log(AppLogger::ERROR) << "WebSocket::Server::Start Listen Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
+				boost::system::error_code ecClose;
+				acceptor.close(ecClose);
+				return false;
+			}
+
+			{
+				std::lock_guard lock(mtx);
+				bRunning = true;
+			}
+			{
+				std::lock_guard lock(RegistryMutex());
+				std::erase_if(Registry(), [](const std::weak_ptr<ServerBase> & server) { return server.expired(); });
+				Registry().push_back(weak_from_this());
+			}
+			net::post(strand, beast::bind_front_handler(&ServerBase::do_accept, shared_from_this()));
+			core->WakeUp();
+			return true;
+		}
+
+		void ServerBase::Stop()
+		{
+			{
+				std::lock_guard lock(mtx);
+				if (!bRunning) {
+					return;
+				}
+				bRunning = false;
+			}
+			Log(AppLogger::DEBUG) << "WebSocket::Server::Stop " << sAddress << ":" << iPort << std::endl;
+			auto self = shared_from_this();
+			net::post(strand, [self]
+			{
+				boost::system::error_code ec;
+				self->acceptor.close(ec);
+			});
+			for (auto & conn : Connections()) {
+				conn->Close(websocket::close_code::going_away);
+			}
+			core->WakeUp();
+		}
+
+		std::vector<connection_t> ServerBase::Connections()
+		{
+			std::lock_guard lock(mtx);
+			std::vector<connection_t> vRet;
+			std::erase_if(vConnections, [](const std::weak_ptr<ConnectionBase> & conn) { return conn.expired(); });
+			for (auto & conn : vConnections) {
+				if (auto pConn = conn.lock()) {
+					vRet.push_back(std::move(pConn));
+				}
+			}
+			return vRet;
+		}
+
+		void ServerBase::Broadcast(std::shared_ptr<const std::string> message, bool bBinary)
+		{
+			for (auto & conn : Connections()) {
+				conn->Send(message, bBinary);
+			}
+		}
+
+		void ServerBase::StopAll()
+		{
+			std::vector<std::shared_ptr<ServerBase>> vServers;
+			{
+				std::lock_guard lock(RegistryMutex());
+				for (auto & server : Registry()) {
+					if (auto pServer = server.lock()) {
+						vServers.push_back(std::move(pServer));
+					}
+				}
+				Registry().clear();
+			}
+			for (auto & server : vServers) {
+				server->Stop();
+			}
+		}
+
+		std::mutex & ServerBase::RegistryMutex()
+		{
+			static std::mutex ret;
+			return ret;
+		}
+
+		std::vector<std::weak_ptr<ServerBase>> & ServerBase::Registry()
+		{
+			static std::vector<std::weak_ptr<ServerBase>> ret;
+			return ret;
+		}
+
+		void ServerBase::do_accept()
+		{
+			auto self = shared_from_this();
+			auto strandConn = net::make_strand(core->IOContext());
+			acceptor.async_accept(strandConn, [self, strandConn] (const boost::system::error_code & ec, tcp::socket socket)
+			{
+				if (ec) {
+					if (ec != net::error::operation_aborted) {
+						Log(AppLogger::ERROR) << "WebSocket::Server::on_accept Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+						std::lock_guard lock(self->mtx);
+						if (self->bRunning) {
+							auto timer = std::make_shared<net::steady_timer>(self->strand, acceptRetryDelay);
+							timer->async_wait([self, timer] (const boost::system::error_code &)
+							{
+								{
+									std::lock_guard lock(self->mtx);
+									if (!self->bRunning) {
+										return;
+									}
+								}
+								self->do_accept();
+							});
+						}
+					}
+					return;
+				}
+				open_handler_t handlerOpen;
+				std::shared_ptr<ConnectionBase> conn;
+				{
+					std::lock_guard lock(self->mtx);
+					conn = std::make_shared<ConnectionBase>(strandConn, self->bSSL, self->bDeflate);
+					conn->onMessage = self->onMessage;
+					conn->onClose = self->onClose;
+					handlerOpen = self->onOpen;
+					std::erase_if(self->vConnections, [](const std::weak_ptr<ConnectionBase> & conn) { return conn.expired(); });
+					self->vConnections.push_back(conn);
+				}
+				conn->Accept(std::move(socket), self->ssl_ctx, self, std::move(handlerOpen));
+				self->do_accept();
+			});
+			core->WakeUp();
+		}
+
+		server_t Server(const std::string &sAddress, int iPort, bool bSSLIn, const std::string &sCertFile, const std::string &sKeyFile)
+		{
+			return std::make_shared<ServerBase>(sAddress, iPort, bSSLIn, sCertFile, sKeyFile);
+		}
+	} // namespace WebSocket
+
+#ifdef SO_REUSEPORT
+	using reuse_port = net::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+	namespace TCP
+	{
+		ConnectionBase::ConnectionBase(net::strand<net::io_context::executor_type> strandIn) :
+			core(Core()),
+			strand(std::move(strandIn)),
+			socket(strand)
+		{
+		}
+
+		ConnectionBase::~ConnectionBase()
+		{
+			Log(AppLogger::DEBUG) << "TCP::~Connection " << sRemoteAddr << ":" << iRemotePort << std::endl;
+		}
+
+		void ConnectionBase::OnFrame(framer_t framerIn, frame_handler_t handlerIn)
+		{
+			if (!handlerIn) {
+				OnBuffer(std::move(framerIn), nullptr);
+				return;
+			}
+			OnBuffer(std::move(framerIn), [handlerIn = std::move(handlerIn)](const connection_t & conn, const Buffer & frame)
+			{
+				handlerIn(conn, frame.View());
+			});
+		}
+
+		void ConnectionBase::OnBuffer(framer_t framerIn, buffer_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			framer = std::move(framerIn);
+			onFrame = std::move(handlerIn);
+		}
+
+		void ConnectionBase::OnClose(close_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onClose = std::move(handlerIn);
+		}
+
+		void ConnectionBase::Send(std::string sData)
+		{
+			Send(std::make_shared<const std::string>(std::move(sData)));
+		}
+
+		void ConnectionBase::Send(std::shared_ptr<const std::string> data)
+		{
+			{
+				std::lock_guard lock(mtx);
+				if (bClosed) {
+					return;
+				}
+				iQueuedBytes += data->size();
+				dqOutgoing.push_back(std::move(data));
+				if (iQueuedBytes > iHighWater) {
+					EventHandlerSet(eBackpressure);
+				}
+			}
+			net::post(strand, beast::bind_front_handler(&ConnectionBase::do_write, shared_from_this()));
+			core->WakeUp();
+		}
+
+		void ConnectionBase::Close()
+		{
+			net::post(strand, [self = shared_from_this()]
+			{
+				boost::system::error_code ec;
+				self->socket.shutdown(tcp::socket::shutdown_both, ec);
+				self->socket.close(ec);
+			});
+			core->WakeUp();
+		}
+
+		void ConnectionBase::Watermarks(size_t iHighIn, size_t iLowIn)
+		{
+			std::lock_guard lock(mtx);
+			iHighWater = iHighIn;
+			iLowWater = std::min(iLowIn, iHighIn);
+		}
+
+		EventHandler::Event ConnectionBase::Backpressure() const
+		{
+			return eBackpressure;
+		}
+
+		size_t ConnectionBase::Queued()
+		{
+			std::lock_guard lock(mtx);
+			return iQueuedBytes;
+		}
+
+		bool ConnectionBase::IsOpen()
+		{
+			std::lock_guard lock(mtx);
+			return bOpen;
+		}
+
+		const std::string & ConnectionBase::RemoteAddress() const
+		{
+			return sRemoteAddr;
+		}
+
+		int ConnectionBase::RemotePort() const
+		{
+			return iRemotePort;
+		}
+
+		void ConnectionBase::Opened()
+		{
+			boost::system::error_code ec;
+			auto endpoint = socket.remote_endpoint(ec);
 			if (!ec) {
+				sRemoteAddr = endpoint.address().to_string();
+				iRemotePort = endpoint.port();
+			}
+			Log(AppLogger::DEBUG) << "TCP::Opened " << sRemoteAddr << ":" << iRemotePort << std::endl;
+			open_handler_t handler;
+			{
+				std::lock_guard lock(mtx);
+				bOpen = true;
+				handler = onOpen;
+			}
+			if (handler) {
+				handler(shared_from_this());
+			}
+			do_read();
+			do_write();
+		}
+
+		void ConnectionBase::do_read()
+		{
+			if (!ReserveBuffer(core->Buffers(), rxBuffer, iReadStart, iReadFill, iMaxReadBufferSize)) {
+				Log(AppLogger::ERROR) << "TCP::do_read Frame exceeds " << iMaxReadBufferSize << " bytes, discarding: " << sRemoteAddr << ":" << iRemotePort << std::endl;
+			}
+			auto self = shared_from_this();
+			socket.async_read_some(net::buffer(rxBuffer.data() + iReadFill, rxBuffer.size() - iReadFill), [self] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				if (ec) {
+					self->on_closed(ec);
+					return;
+				}
+				self->iReadFill += bytes_transferred;
+				framer_t framerCopy;
+				buffer_handler_t handler;
+				{
+					std::lock_guard lock(self->mtx);
+					framerCopy = self->framer;
+					handler = self->onFrame;
+				}
+				if (handler) {
+					FrameBuffer(framerCopy, self->rxBuffer, self->iReadStart, self->iReadFill, [&](const Buffer & frame) { handler(self, frame); });
+				} else {
+					self->iReadStart = self->iReadFill;
+				}
+				self->do_read();
+			});
+			core->WakeUp();
+		}
+
+		void ConnectionBase::do_write()
+		{
+			std::vector<net::const_buffer> vBuffers;
+			{
+				std::lock_guard lock(mtx);
+				if (bWriting || !bOpen || dqOutgoing.empty()) {
+					return;
+				}
+				while (!dqOutgoing.empty() && vWriting.size() < iMaxGather) {
+					vBuffers.push_back(net::buffer(*dqOutgoing.front()));
+					vWriting.push_back(std::move(dqOutgoing.front()));
+					dqOutgoing.pop_front();
+				}
+				bWriting = true;
+			}
+			auto self = shared_from_this();
+			net::async_write(socket, vBuffers, [self] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			{
+				{
+					std::lock_guard lock(self->mtx);
+					self->bWriting = false;
+					self->vWriting.clear();
+					self->iQueuedBytes -= std::min(bytes_transferred, self->iQueuedBytes);
+					if (self->iQueuedBytes <= self->iLowWater) {
+						EventHandlerReset(self->eBackpressure);
+					}
+				}
+				if (ec) {
+					self->on_closed(ec);
+					return;
+				}
+				self->do_write();
+			});
+			core->WakeUp();
+		}
+
+		void ConnectionBase::on_closed(const boost::system::error_code & ec)
+		{
+			close_handler_t handler;
+			{
+				std::lock_guard lock(mtx);
+				if (bClosed) {
+					return;
+				}
+				bClosed = true;
+				bOpen = false;
+				dqOutgoing.clear();
+				iQueuedBytes = 0;
+				EventHandlerReset(eBackpressure);
+				handler = std::move(onClose);
+				onFrame = nullptr;
+				onOpen = nullptr;
+			}
+			if (ec && ec != net::error::eof && ec != net::error::operation_aborted) {
+				Log(AppLogger::DEBUG) << "TCP::on_closed " << ec.message() << ": " << sRemoteAddr << ":" << iRemotePort << std::endl;
+			}
+			boost::system::error_code ecClose;
+			socket.close(ecClose);
+			if (handler) {
+				handler(shared_from_this(), ec);
+			}
+		}
+
+		ClientBase::ClientBase(std::string sAddressIn, int iPortIn) :
+			ConnectionBase(net::make_strand(Core()->IOContext())),
+			sAddress(std::move(sAddressIn)),
+			iPort(iPortIn)
+		{
+			sRemoteAddr = sAddress;
+			iRemotePort = iPort;
+			Log(AppLogger::DEBUG) << "TCP::Client " << sAddress << ":" << iPort << std::endl;
+		}
+
+		void ClientBase::NoDelay(bool bNoDelayIn)
+		{
+			std::lock_guard lock(mtx);
+			bNoDelay = bNoDelayIn;
+		}
+
+		void ClientBase::Connect(open_handler_t onOpenIn)
+		{
+			{
 				std::lock_guard lock(mtx);
-				sReadData += szBuffer;
-				Log(AppLogger::TRACE) << "Serial::HandleRead " << sPort << ": " << szBuffer[0] << std::endl;
-				if (szBuffer[0] == '~') {
-					Log(AppLogger::TRACE) << "Serial::HandleRead " << sPort << ": " << sReadData << std::endl;
-					readCallback(sReadData);
-					sReadData.clear();
+				onOpen = std::move(onOpenIn);
+			}
+			auto self = std::static_pointer_cast<ClientBase>(shared_from_this());
+			core->Resolve(sAddress, iPort, [self] (const boost::system::error_code & ec, const CoreBase::endpoints_t & vResolved)
+			{
+				net::dispatch(self->strand, [self, ec, vResolved]
+				{
+					if (ec) {
+						Log(AppLogger::ERROR) << "TCP::on_resolve Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+						self->on_closed(ec);
+						return;
+					}
+					net::async_connect(self->socket, vResolved, [self] (const boost::system::error_code & ec, const tcp::endpoint &)
+					{
+						if (ec) {
+							Log(AppLogger::ERROR) << "TCP::on_connect Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+							self->on_closed(ec);
+							return;
+						}
+						boost::system::error_code ecOption;
+						self->socket.set_option(tcp::no_delay(self->bNoDelay), ecOption);
+						self->Opened();
+					});
+				});
+			});
+			core->WakeUp();
+		}
+
+		client_t Client(const std::string &sAddress, int iPort)
+		{
+			return std::make_shared<ClientBase>(sAddress, iPort);
+		}
+
+		ServerBase::ServerBase(std::string sAddressIn, int iPortIn) :
+			core(Core()),
+			sAddress(std::move(sAddressIn)),
+			iPort(iPortIn)
+		{
+			Log(AppLogger::DEBUG) << "TCP::Server::Server " << sAddress << ":" << iPort << std::endl;
+		}
+
+		ServerBase::~ServerBase()
+		{
+			for (auto & acceptor : vAcceptors) {
+				boost::system::error_code ec;
+				acceptor->close(ec);
+			}
+			Log(AppLogger::DEBUG) << "TCP::Server::~Server " << sAddress << ":" << iPort << std::endl;
+		}
+
+		void ServerBase::OnOpen(open_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onOpen = std::move(handlerIn);
+		}
+
+		void ServerBase::OnFrame(framer_factory_t framerFactoryIn, frame_handler_t handlerIn)
+		{
+			if (!handlerIn) {
+				OnBuffer(std::move(framerFactoryIn), nullptr);
+				return;
+			}
+			OnBuffer(std::move(framerFactoryIn), [handlerIn = std::move(handlerIn)](const connection_t & conn, const Buffer & frame)
+			{
+				handlerIn(conn, frame.View());
+			});
+		}
+
+		void ServerBase::OnBuffer(framer_factory_t framerFactoryIn, buffer_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			framerFactory = std::move(framerFactoryIn);
+			onFrame = std::move(handlerIn);
+		}
+
+		void ServerBase::OnClose(close_handler_t handlerIn)
+		{
+			std::lock_guard lock(mtx);
+			onClose = std::move(handlerIn);
+		}
+
+		void ServerBase::Shards(int iShardsIn)
+		{
+			std::lock_guard lock(mtx);
+			iShards = std::max(iShardsIn, 1);
+		}
+
+		int ServerBase::Port() const
+		{
+			if (vAcceptors.empty()) {
+				return iPort;
+			}
+			boost::system::error_code ec;
+			auto endpoint = vAcceptors.front()->local_endpoint(ec);
+			return ec ? iPort : endpoint.port();
+		}
+
+		bool ServerBase::Start()
+		{
+			Log(AppLogger::DEBUG) << "TCP::Server::Start " << sAddress << ":" << iPort << " (" << iShards << ")" << std::endl;
+			boost::system::error_code ec;
+			auto address = net::ip::make_address(sAddress, ec);
+			if (ec) {
+				Log(AppLogger::ERROR) << "TCP::Server::Start Address Error: " << ec.message() << ": " << sAddress << std::endl;
+				return false;
+			}
+			std::lock_guard lock(mtx);
+			int iBindPort = iPort;
+			for (int i = 0; i < iShards && !ec; ++i) {
+				auto acceptor = std::make_unique<tcp::acceptor>(net::make_strand(core->IOContext()));
+				tcp::endpoint endpoint(address, static_cast<unsigned short>(iBindPort));
+				acceptor->open(endpoint.protocol(), ec);
+				if (!ec) {
+					acceptor->set_option(net::socket_base::reuse_address(true), ec);
+				}
+				#ifdef SO_REUSEPORT
+				if (!ec && iShards > 1) {
+					acceptor->set_option(reuse_port(true), ec);
+				}
+				#endif
+				if (!ec) {
+					acceptor->bind(endpoint, ec);
+				}
+				if (!ec) {
+					acceptor->listen(net::socket_base::max_listen_connections, ec);
+				}
+				if (!ec) {
+					// Shards after the first share whatever port the first one got.
+					iBindPort = acceptor->local_endpoint().port();
+					vAcceptors.push_back(std::move(acceptor));
+				}
+			}
+			if (ec) {
+				Log(AppLogger::ERROR) << "TCP::Server::Start Listen Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
+				for (auto & acceptor : vAcceptors) {
+					boost::system::error_code ecClose;
+					acceptor->close(ecClose);
 				}
-			} else {
+				vAcceptors.clear();
+				return false;
+			}
+			bRunning = true;
+			{
+				std::lock_guard lockRegistry(RegistryMutex());
+				std::erase_if(Registry(), [](const std::weak_ptr<ServerBase> & server) { return server.expired(); });
+				Registry().push_back(weak_from_this());
+			}
+			for (size_t i = 0; i < vAcceptors.size(); ++i) {
+				net::post(vAcceptors[i]->get_executor(), beast::bind_front_handler(&ServerBase::do_accept, shared_from_this(), i));
+			}
+			core->WakeUp();
+			return true;
+		}
+
+		void ServerBase::Stop()
+		{
+			{
 				std::lock_guard lock(mtx);
-				Log(AppLogger::ERROR) << "Serial::HandleRead Error: " << ec.message() << ": " << sPort << std::endl;
+				if (!bRunning) {
+					return;
+				}
+				bRunning = false;
+				for (auto & acceptor : vAcceptors) {
+					net::post(acceptor->get_executor(), [self = shared_from_this(), pAcceptor = acceptor.get()]
+					{
+						boost::system::error_code ec;
+						pAcceptor->close(ec);
+					});
+				}
 			}
-			DoRead();
-		});
-		core->WakeUp();
-	}
+			Log(AppLogger::DEBUG) << "TCP::Server::Stop " << sAddress << ":" << iPort << std::endl;
+			for (auto & conn : Connections()) {
+				conn->Close();
+			}
+			core->WakeUp();
+		}
 
-	void Serial::SetReadCalback(std::function<void(const std::string &sData)> callback)
-	{
-		std::lock_guard lock(mtx);
-		readCallback = std::move(callback);
-		if (readCallback) {
-			DoRead();
+		std::vector<connection_t> ServerBase::Connections()
+		{
+			std::lock_guard lock(mtx);
+			std::vector<connection_t> vRet;
+			std::erase_if(vConnections, [](const std::weak_ptr<ConnectionBase> & conn) { return conn.expired(); });
+			for (auto & conn : vConnections) {
+				if (auto pConn = conn.lock()) {
+					vRet.push_back(std::move(pConn));
+				}
+			}
+			return vRet;
 		}
-	}
 
-	std::deque<std::string> Serial::ListPorts()
-	{
-		std::deque<std::string> sPorts;
-		#ifdef _WIN32
-		HKEY hKey;
-		if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, "HARDWARE\\DEVICEMAP\\SERIALCOMM", 0, KEY_READ, &hKey) == ERROR_SUCCESS) {
-			char szName[256];
-			char szData[256];
-			DWORD dwName, dwData, dwIndex = 0;
-			while (RegEnumValue(hKey, dwIndex++, szName, &dwName, NULL, NULL, (LPBYTE)szData, &dwData) == ERROR_SUCCESS) {
-				sPorts.push_back(szData);
+		void ServerBase::Broadcast(std::shared_ptr<const std::string> data)
+		{
+			for (auto & conn : Connections()) {
+				conn->Send(data);
 			}
-			RegCloseKey(hKey);
 		}
-		#else
-		// Linux and macOS
-		// use std::filesystem to scan the /dev directory for "ttyS*", "ttyUSB*", "ttyACM*" devices and "ttyAMA*" devices
-		auto path = std::filesystem::path("/dev");
-		for (const auto &entry : std::filesystem::directory_iterator(path)) {
-			auto filename = entry.path().filename().string();
-			if (filename.compare(0, 4, "ttyS") == 0 || filename.compare(0, 6, "ttyUSB") == 0 || filename.compare(0, 6, "ttyACM") == 0 || filename.compare(0, 6, "ttyAMA") == 0) {
-				sPorts.push_back(entry.path().string());
+
+		void ServerBase::StopAll()
+		{
+			std::vector<std::shared_ptr<ServerBase>> vServers;
+			{
+				std::lock_guard lock(RegistryMutex());
+				for (auto & server : Registry()) {
+					if (auto pServer = server.lock()) {
+						vServers.push_back(std::move(pServer));
+					}
+				}
+				Registry().clear();
+			}
+			for (auto & server : vServers) {
+				server->Stop();
 			}
 		}
-		#endif
-		return sPorts;
-	}
 
-	namespace HTTP
+		std::mutex & ServerBase::RegistryMutex()
+		{
+			static std::mutex ret;
+			return ret;
+		}
+
+		std::vector<std::weak_ptr<ServerBase>> & ServerBase::Registry()
+		{
+			static std::vector<std::weak_ptr<ServerBase>> ret;
+			return ret;
+		}
+
+		void ServerBase::do_accept(size_t iAcceptor)
+		{
+			auto self = shared_from_this();
+			auto strandConn = net::make_strand(core->IOContext());
+			vAcceptors[iAcceptor]->async_accept(strandConn, [self, strandConn, iAcceptor] (const boost::system::error_code & ec, tcp::socket socket)
+			{
+				if (ec) {
+					if (ec != net::error::operation_aborted) {
+						Log(AppLogger::ERROR) << "TCP::Server::on_accept Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+						std::lock_guard lock(self->mtx);
+						if (self->bRunning) {
+							auto timer = std::make_shared<net::steady_timer>(self->vAcceptors[iAcceptor]->get_executor(), acceptRetryDelay);
+							timer->async_wait([self, timer, iAcceptor] (const boost::system::error_code &)
+							{
+								{
+									std::lock_guard lock(self->mtx);
+									if (!self->bRunning) {
+										return;
+									}
+								}
+								self->do_accept(iAcceptor);
+							});
+						}
+					}
+					return;
+				}
+				auto conn = std::make_shared<ConnectionBase>(strandConn);
+				{
+					std::lock_guard lock(self->mtx);
+					conn->socket = std::move(socket);
+					conn->owner = self;
+					conn->onOpen = self->onOpen;
+					conn->onFrame = self->onFrame;
+					conn->onClose = self->onClose;
+					if (self->framerFactory) {
+						conn->framer = self->framerFactory();
+					}
+					std::erase_if(self->vConnections, [](const std::weak_ptr<ConnectionBase> & conn) { return conn.expired(); });
+					self->vConnections.push_back(conn);
+				}
+				boost::system::error_code ecOption;
+				conn->socket.set_option(tcp::no_delay(true), ecOption);
+				net::dispatch(strandConn, [conn] { conn->Opened(); });
+				self->do_accept(iAcceptor);
+			});
+			core->WakeUp();
+		}
+
+		server_t Server(const std::string &sAddress, int iPort)
+		{
+			return std::make_shared<ServerBase>(sAddress, iPort);
+		}
+	} // namespace TCP
+
+	namespace UDP
 	{
-		ClientBase::ClientBase(std::string sAddressIn, int iPortIn, bool bSSLIn, bool bAllowSelfSignedIn) :
+		SocketBase::SocketBase(std::string sAddressIn, int iPortIn, bool bReusePortIn) :
 			core(Core()),
 			sAddress(std::move(sAddressIn)),
 			iPort(iPortIn),
-			resolver(core->IOContext()),
-			bSSL(bSSLIn),
-			bAllowSelfSigned(bAllowSelfSignedIn)
+			bReusePort(bReusePortIn),
+			strand(net::make_strand(core->IOContext())),
+			socket(strand)
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::ClientTCP " << sAddress << ":" << iPort << std::endl;
+			Log(AppLogger::DEBUG) << "UDP::Socket " << sAddress << ":" << iPort << std::endl;
 		}
 
-		ClientBase::~ClientBase()
+		SocketBase::~SocketBase()
 		{
-			if (stream && tcp_stream().socket().is_open()) {
-				boost::system::error_code ec;
-				tcp_stream().socket().close(ec);
-			}
-			Log(AppLogger::DEBUG) << "ClientTCP::~ClientTCP " << sAddress << ":" << iPort << std::endl;
+			boost::system::error_code ec;
+			socket.close(ec);
 		}
 
-		void ClientBase::KeepAlive(bool bKeepAliveIn)
+		void SocketBase::OnDatagram(datagram_handler_t handlerIn)
 		{
-			bKeepAlive = bKeepAliveIn;
+			OnFrame(nullptr, std::move(handlerIn));
 		}
 
-		bool ClientBase::KeepAlive() const
+		void SocketBase::OnFrame(framer_t framerIn, datagram_handler_t handlerIn)
 		{
-			return bKeepAlive;
+			if (!handlerIn) {
+				OnBuffer(std::move(framerIn), nullptr);
+				return;
+			}
+			OnBuffer(std::move(framerIn), [handlerIn = std::move(handlerIn)](const endpoint_t & from, const Buffer & data)
+			{
+				handlerIn(from, data.View());
+			});
 		}
 
-		bool ClientBase::Connected()
+		void SocketBase::OnBuffer(framer_t framerIn, buffer_handler_t handlerIn)
 		{
-			if (!stream) {
-				PrepStream();
-			}
-			return tcp_stream().socket().is_open();
+			std::lock_guard lock(mtx);
+			onDatagram = std::move(handlerIn);
+			framer = std::move(framerIn);
 		}
 
-		void ClientBase::Close()
+		void SocketBase::Batch(size_t iBatchIn, size_t iMaxDatagramIn)
 		{
-			if (stream) {
-				Log(AppLogger::DEBUG) << "ClientTCP::Close " << sAddress << ":" << iPort << std::endl;
-				boost::system::error_code ec;
-				tcp_stream().socket().close(ec);
-			}
+			std::lock_guard lock(mtx);
+			iBatch = std::max<size_t>(iBatchIn, 1);
+			iMaxDatagram = std::clamp<size_t>(iMaxDatagramIn, 1, 65536);
 		}
 
-		void ClientBase::Request(request_t reqIn, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		bool SocketBase::Open()
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::Request " << sAddress << ":" << iPort << std::endl;
-			req = std::move(reqIn);
-			res = std::make_shared<http::response<http::string_body>>();
-			req->target() = URLEncode(req->target());
-			if (req->target().empty()) {
-				req->target("/");
+			boost::system::error_code ec;
+			auto address = net::ip::make_address(sAddress, ec);
+			if (ec) {
+				Log(AppLogger::ERROR) << "UDP::Open Address Error: " << ec.message() << ": " << sAddress << std::endl;
+				return false;
+			}
+			endpoint_t endpoint(address, static_cast<unsigned short>(iPort));
+			socket.open(endpoint.protocol(), ec);
+			if (!ec) {
+				socket.set_option(net::socket_base::reuse_address(true), ec);
+			}
+			#ifdef SO_REUSEPORT
+			if (!ec && bReusePort) {
+				socket.set_option(reuse_port(true), ec);
+			}
+			#endif
+			if (!ec) {
+				socket.bind(endpoint, ec);
+			}
+			if (ec) {
+				Log(AppLogger::ERROR) << "UDP::Open Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
+				boost::system::error_code ecClose;
+				socket.close(ecClose);
+				return false;
 			}
 
-			handler = std::move(handlerIn);
-			bKeepAlive = bKeepAliveIn;
-			req->keep_alive(bKeepAlive);
-			bool bConnected = Connected();
-			tcp_stream().expires_after(timeout);
-			if (bConnected) {
-				do_write();
-			} else {
-				do_resolve();
+			{
+				std::lock_guard lock(mtx);
+				vFrom.resize(iBatch);
+				#ifdef __linux__
+				vMsgs.assign(iBatch, mmsghdr{});
+				vIov.resize(iBatch);
+				#endif
+				PrepareSlots();
 			}
+			net::post(strand, beast::bind_front_handler(&SocketBase::do_receive, shared_from_this()));
 			core->WakeUp();
+			return true;
 		}
 
-		void ClientBase::Head(const std::string &sPath, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		void SocketBase::Close()
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::Head " << sAddress << ":" << iPort << std::endl;
-			auto req = std::make_shared<http::request<http::string_body>>(http::verb::head, sPath, 11);
-			req->set(http::field::host, sAddress/* + ":" + std::to_string(iPort)*/);
-			req->set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+			net::post(strand, [self = shared_from_this()]
+			{
+				boost::system::error_code ec;
+				self->socket.close(ec);
+			});
+			core->WakeUp();
 		}
 
-		void ClientBase::Get(const std::string &sPath, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		int SocketBase::Port() const
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::Get " << sAddress << ":" << iPort << std::endl;
-			auto req = std::make_shared<http::request<http::string_body>>(http::verb::get, sPath, 11);
-			req->set(http::field::host, sAddress/* + ":" + std::to_string(iPort)*/);
-			req->set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+			boost::system::error_code ec;
+			auto endpoint = socket.local_endpoint(ec);
+			return ec ? iPort : endpoint.port();
 		}
 
-		void ClientBase::Put(const std::string &sPath, const std::string &sBody, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		bool SocketBase::SendTo(const endpoint_t &to, std::string sData)
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::Put " << sAddress << ":" << iPort << std::endl;
-			auto req = std::make_shared<http::request<http::string_body>>(http::verb::put, sPath, 11);
-			req->set(http::field::host, sAddress/* + ":" + std::to_string(iPort)*/);
-			req->set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-			req->set(http::field::content_type, sContentType);
-			req->body() = sBody;
-			req->prepare_payload();
-			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+			return SendTo(to, std::make_shared<const std::string>(std::move(sData)));
 		}
 
-		void ClientBase::Post(const std::string &sPath, const std::string &sBody, const std::string &sContentType, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		bool SocketBase::SendTo(const endpoint_t &to, std::shared_ptr<const std::string> data)
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::Post " << sAddress << ":" << iPort << std::endl;
-			auto req = std::make_shared<http::request<http::string_body>>(http::verb::post, sPath, 11);
-			req->set(http::field::host, sAddress/* + ":" + std::to_string(iPort)*/);
-			req->set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-			req->set(http::field::content_type, sContentType);
-			req->body() = sBody;
-			req->prepare_payload();
-			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+			{
+				std::lock_guard lock(mtx);
+				if (iQueuedBytes + data->size() > iLimit) {
+					++iDropped;
+					return false;
+				}
+				iQueuedBytes += data->size();
+				dqOutgoing.push_back({to, std::move(data)});
+				if (iQueuedBytes > iHighWater) {
+					EventHandlerSet(eBackpressure);
+				}
+				if (bSending) {
+					return true;
+				}
+				bSending = true;
+			}
+			net::post(strand, beast::bind_front_handler(&SocketBase::do_send, shared_from_this()));
+			core->WakeUp();
+			return true;
 		}
 
-		void ClientBase::Delete(const std::string &sPath, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn)
+		void SocketBase::Watermarks(size_t iHighIn, size_t iLimitIn)
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::Delete " << sAddress << ":" << iPort << std::endl;
-			auto req = std::make_shared<http::request<http::string_body>>(http::verb::delete_, sPath, 11);
-			req->set(http::field::host, sAddress/* + ":" + std::to_string(iPort)*/);
-			req->set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
-			Request(req, std::move(handlerIn), timeout, bKeepAliveIn);
+			std::lock_guard lock(mtx);
+			iLimit = iLimitIn;
+			iHighWater = std::min(iHighIn, iLimitIn);
 		}
 
-		beast::tcp_stream &ClientBase::tcp_stream() const
+		EventHandler::Event SocketBase::Backpressure() const
 		{
-			return stream->next_layer();
+			return eBackpressure;
 		}
 
-		beast::ssl_stream<beast::tcp_stream> &ClientBase::ssl_stream() const
+		uint64_t SocketBase::Received() const
 		{
-			return *stream;
+			return iReceived;
 		}
 
-		void ClientBase::PrepStream()
+		uint64_t SocketBase::Sent() const
 		{
-			if (!stream) {
-				Log(AppLogger::DEBUG) << "ClientTCP::PrepStream " << sAddress << ":" << iPort << std::endl;
-				stream = std::make_shared<beast::ssl_stream<beast::tcp_stream>>(core->IOContext(), ssl_ctx);
-			}
+			return iSent;
 		}
 
-		void ClientBase::do_resolve()
+		uint64_t SocketBase::Dropped() const
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::do_resolve " << sAddress << ":" << iPort << std::endl;
-			auto self = shared_from_this();
-			resolver.async_resolve(sAddress, std::to_string(iPort), beast::bind_front_handler([&, self] (const boost::system::error_code & ec, tcp::resolver::results_type results)
-			{
-				if (ec) {
-					Log(AppLogger::ERROR) << "ClientBase::on_resolve Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
-					return;
-				}
+			return iDropped;
+		}
 
-				resolve_results = std::move(results);
-				self->do_connect();
-			}));
-			core->WakeUp();
+		std::vector<socket_t> SocketBase::Shards(const std::string &sAddress, int iPort, int iShards)
+		{
+			std::vector<socket_t> vRet;
+			for (int i = 0; i < std::max(iShards, 1); ++i) {
+				vRet.push_back(std::make_shared<SocketBase>(sAddress, iPort, true));
+			}
+			return vRet;
 		}
 
-		void ClientBase::do_connect()
+		void SocketBase::PrepareSlots()
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::do_connect " << sAddress << ":" << iPort << std::endl;
-			auto self = shared_from_this();
-			tcp_stream().async_connect(resolve_results, beast::bind_front_handler([&, self] (const boost::system::error_code & ec, const tcp::resolver::results_type::endpoint_type&)
+			// Slots stay put until a handler keeps one of their Buffers, then the next batch gets a fresh slab.
+			rxSlots = core->Buffers().Acquire(iBatch * iMaxDatagram);
+			#ifdef __linux__
+			for (size_t i = 0; i < iBatch; ++i) {
+				vIov[i] = {rxSlots.data() + i * iMaxDatagram, iMaxDatagram};
+				vMsgs[i].msg_hdr.msg_iov = &vIov[i];
+				vMsgs[i].msg_hdr.msg_iovlen = 1;
+			}
+			#endif
+		}
+
+		void SocketBase::Deliver()
+		{
+			// Handlers may call SendTo() or OnBuffer(), so they run without mtx.  rxSlots is only replaced here, after
+			// the batch is delivered, and the next receive is not armed until then, so the slots hold still meanwhile.
+			framer_t framerCopy;
+			buffer_handler_t handler;
+			size_t iSlotSize;
 			{
-				if (ec) {
-					Log(AppLogger::ERROR) << "ClientBase::on_connect Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
-					return;
-				}
-				if (bSSL) {
-					self->do_handshake();
-				} else {
-					self->do_write();
+				std::lock_guard lock(mtx);
+				framerCopy = framer;
+				handler = onDatagram;
+				iSlotSize = iMaxDatagram;
+			}
+			if (handler) {
+				for (auto & inbound : vInbound) {
+					auto datagram = rxSlots.Slice(inbound.iSlot * iSlotSize, inbound.iSize);
+					size_t iStart = 0;
+					FrameBuffer(framerCopy, datagram, iStart, datagram.size(), [&](const Buffer & frame) { handler(inbound.from, frame); });
 				}
-			}));
-			core->WakeUp();
+			}
+			vInbound.clear();
+			std::lock_guard lock(mtx);
+			if (!rxSlots.Unique()) {
+				PrepareSlots();
+			}
 		}
 
-		void ClientBase::do_handshake()
+		void SocketBase::do_receive()
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::do_handshake " << sAddress << ":" << iPort << std::endl;
 			auto self = shared_from_this();
-			ssl_stream().async_handshake(ssl::stream_base::client, beast::bind_front_handler([&, self] (const boost::system::error_code & ec)
+			#ifdef __linux__
+			socket.async_wait(net::socket_base::wait_read, [self] (const boost::system::error_code & ec)
 			{
 				if (ec) {
-					Log(AppLogger::ERROR) << "ClientBase::on_handshake Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
+					if (ec != net::error::operation_aborted) {
+						Log(AppLogger::ERROR) << "UDP::on_receive Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+					}
 					return;
 				}
-				self->do_write();
-			}));
-			core->WakeUp();
-		}
-
-		void ClientBase::do_write()
-		{
-			Log(AppLogger::DEBUG) << "ClientTCP::do_write " << sAddress << ":" << iPort << std::endl;
-			auto self          = shared_from_this();
-			auto write_handler = [&, self] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+				for (;;) {
+					int iCount;
+					int iError = 0;
+					size_t iBatchNow;
+					{
+						std::lock_guard lock(self->mtx);
+						iBatchNow = self->iBatch;
+						for (size_t i = 0; i < iBatchNow; ++i) {
+							self->vMsgs[i].msg_hdr.msg_name = self->vFrom[i].data();
+							self->vMsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(self->vFrom[i].capacity());
+							self->vMsgs[i].msg_hdr.msg_flags = 0;
+						}
+						iCount = recvmmsg(self->socket.native_handle(), self->vMsgs.data(), static_cast<unsigned int>(iBatchNow), MSG_DONTWAIT, nullptr);
+						iError = errno;
+						for (int i = 0; i < iCount; ++i) {
+							auto & msg = self->vMsgs[i];
+							if (msg.msg_hdr.msg_flags & MSG_TRUNC) {
+								++self->iDropped;
+								continue;
+							}
+							self->vFrom[i].resize(msg.msg_hdr.msg_namelen);
+							self->vInbound.push_back({self->vFrom[i], static_cast<size_t>(i), msg.msg_len});
+						}
+					}
+					if (iCount <= 0) {
+						if (iCount < 0 && iError != EAGAIN && iError != EWOULDBLOCK && iError != EINTR) {
+							Log(AppLogger::ERROR) << "UDP::on_receive recvmmsg Error: " << std::strerror(iError) << ": " << self->sAddress << ":" << self->iPort << std::endl;
+						}
+						break;
+					}
+					self->iReceived += static_cast<uint64_t>(iCount);
+					self->Deliver();
+					if (static_cast<size_t>(iCount) < iBatchNow) {
+						break;
+					}
+				}
+				self->do_receive();
+			});
+			#else
+			socket.async_receive_from(net::buffer(rxSlots.data(), iMaxDatagram), vFrom[0], [self] (const boost::system::error_code & ec, std::size_t bytes_transferred)
 			{
-				boost::ignore_unused(bytes_transferred);
 				if (ec) {
-					Log(AppLogger::ERROR) << "ClientBase::on_write Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl;
-					return;
+					if (ec != net::error::operation_aborted) {
+						Log(AppLogger::ERROR) << "UDP::on_receive Error: " << ec.message() << ": " << self->sAddress << ":" << self->iPort << std::endl;
+					}
+					if (ec == net::error::operation_aborted || !self->socket.is_open()) {
+						return;
+					}
+				} else {
+					++self->iReceived;
+					self->vInbound.push_back({self->vFrom[0], 0, bytes_transferred});
+					self->Deliver();
 				}
-				self->do_read();
-			};
-			if (bSSL) {
-				http::async_write(ssl_stream(), *req, beast::bind_front_handler(write_handler));
-			} else {
-				http::async_write(tcp_stream(), *req, beast::bind_front_handler(write_handler));
-			}
-
+				self->do_receive();
+			});
+			#endif
 			core->WakeUp();
 		}
 
-		void ClientBase::do_read()
+		void SocketBase::do_send()
 		{
-			Log(AppLogger::DEBUG) << "ClientTCP::do_read " << sAddress << ":" << iPort << std::endl;
-			auto self         = shared_from_this();
-			auto read_handler = [&, self] (const boost::system::error_code & ec, std::size_t bytes_transferred)
+			auto self = shared_from_this();
+			std::unique_lock lock(mtx);
+			auto finish = [&] (size_t iCount)
 			{
-				if (ec) {
-					Log(AppLogger::ERROR) << "ClientBase::on_read Error: " << ec.message() << ": " << sAddress << ":" << iPort << std::endl << *res << std::endl;
-					return;
+				for (size_t i = 0; i < iCount; ++i) {
+					iQueuedBytes -= std::min(dqOutgoing.front().data->size(), iQueuedBytes);
+					dqOutgoing.pop_front();
+				}
+				if (iQueuedBytes <= iHighWater / 2) {
+					EventHandlerReset(eBackpressure);
 				}
-				boost::ignore_unused(self);
-				handler(req, res, sAddress, iPort);
 			};
-			if (bSSL) {
-				http::async_read(ssl_stream(), buffer, *res, beast::bind_front_handler(read_handler));
-			} else {
-				http::async_read(tcp_stream(), buffer, *res, beast::bind_front_handler(read_handler));
+			#ifdef __linux__
+			std::vector<mmsghdr> vSend;
+			std::vector<iovec> vSendIov;
+			while (!dqOutgoing.empty()) {
+				size_t iCount = std::min(dqOutgoing.size(), iBatch);
+				vSend.assign(iCount, mmsghdr{});
+				vSendIov.resize(iCount);
+				for (size_t i = 0; i < iCount; ++i) {
+					auto & out = dqOutgoing[i];
+					vSendIov[i] = {const_cast<char *>(out.data->data()), out.data->size()};
+					vSend[i].msg_hdr.msg_name = const_cast<void *>(static_cast<const void *>(out.to.data()));
+					vSend[i].msg_hdr.msg_namelen = static_cast<socklen_t>(out.to.size());
+					vSend[i].msg_hdr.msg_iov = &vSendIov[i];
+					vSend[i].msg_hdr.msg_iovlen = 1;
+				}
+				int iSentNow = sendmmsg(socket.native_handle(), vSend.data(), static_cast<unsigned int>(iCount), MSG_DONTWAIT);
+				if (iSentNow < 0) {
+					if (errno == EAGAIN || errno == EWOULDBLOCK) {
+						// Socket buffer is full; carry on once it drains.
+						socket.async_wait(net::socket_base::wait_write, [self] (const boost::system::error_code & ec)
+						{
+							if (ec) {
+								std::lock_guard lock(self->mtx);
+								self->bSending = false;
+								return;
+							}
+							self->do_send();
+						});
+						core->WakeUp();
+						return;
+					}
+					if (errno != EINTR) {
+						Log(AppLogger::ERROR) << "UDP::do_send sendmmsg Error: " << std::strerror(errno) << ": " << sAddress << ":" << iPort << std::endl;
+						++iDropped;
+						finish(1);
+					}
+					continue;
+				}
+				iSent += static_cast<uint64_t>(iSentNow);
+				finish(static_cast<size_t>(iSentNow));
+			}
+			bSending = false;
+			#else
+			if (dqOutgoing.empty()) {
+				bSending = false;
+				return;
 			}
+			auto out = dqOutgoing.front();
+			lock.unlock();
+			socket.async_send_to(net::buffer(*out.data), out.to, [self, out] (const boost::system::error_code & ec, std::size_t)
+			{
+				{
+					std::lock_guard lock(self->mtx);
+					if (ec) {
+						++self->iDropped;
+					} else {
+						++self->iSent;
+					}
+					self->iQueuedBytes -= std::min(out.data->size(), self->iQueuedBytes);
+					self->dqOutgoing.pop_front();
+					if (self->iQueuedBytes <= self->iHighWater / 2) {
+						EventHandlerReset(self->eBackpressure);
+					}
+				}
+				self->do_send();
+			});
 			core->WakeUp();
+			#endif
 		}
 
-		client_t Client(const std::string &sAddress, int iPort, bool bSSLIn, bool bAllowSelfSignedIn)
+		socket_t Socket(const std::string &sAddress, int iPort, bool bReusePort)
 		{
-			return std::make_shared<ClientBase>(sAddress, iPort, bSSLIn, bAllowSelfSignedIn);
+			return std::make_shared<SocketBase>(sAddress, iPort, bReusePort);
 		}
-	} // namespace HTTP
+	} // namespace UDP
 } // namespace Network
@@ -28,11 +28,21 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
 #include <boost/asio/serial_port.hpp>
 
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <map>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "eventhandler.hpp"
@@ -42,6 +52,7 @@ namespace beast = boost::beast;         // from <boost/beast.hpp>
 namespace http = beast::http;           // from <boost/beast/http.hpp>
 namespace net = boost::asio;            // from <boost/asio.hpp>
 namespace ssl = boost::asio::ssl;       // from <boost/asio/ssl.hpp>
+namespace websocket = beast::websocket; // from <boost/beast/websocket.hpp>
 using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
 
 using namespace std::chrono_literals;
@@ -49,25 +60,155 @@ using namespace std::chrono_literals;
 namespace Network
 {
 	template <typename T>
-	T swapEndianness(T value)
+	constexpr T swapEndianness(T value)
 	{
 		static_assert(std::is_arithmetic<T>::value, "Only arithmatic types are supported");
-		union {
-			T value;
-			uint8_t bytes[sizeof(T)];
-		} src, dest;
+		if constexpr (sizeof(T) == 1) {
+			return value;
+		} else if constexpr (std::is_integral<T>::value) {
+			return std::byteswap(value);
+		} else if constexpr (sizeof(T) == 4) {
+			return std::bit_cast<T>(std::byteswap(std::bit_cast<uint32_t>(value)));
+		} else {
+			static_assert(sizeof(T) == 8, "Unsupported floating point size");
+			return std::bit_cast<T>(std::byteswap(std::bit_cast<uint64_t>(value)));
+		}
+	}
 
-		src.value = value;
+	// Bulk swaps, vectorised (pshufb) where the build allows.
+	void swapEndianness16(void * pData, size_t iCount);
+	void swapEndianness32(void * pData, size_t iCount);
+	void swapEndianness64(void * pData, size_t iCount);
 
-		for (size_t i = 0; i < sizeof(T); ++i) {
-			dest.bytes[i] = src.bytes[sizeof(T) - i - 1];
+	template <typename T>
+	void swapEndiannessInPlace(std::span<T> data)
+	{
+		static_assert(std::is_arithmetic<T>::value, "Only arithmatic types are supported");
+		if constexpr (sizeof(T) == 2) {
+			swapEndianness16(data.data(), data.size());
+		} else if constexpr (sizeof(T) == 4) {
+			swapEndianness32(data.data(), data.size());
+		} else if constexpr (sizeof(T) == 8) {
+			swapEndianness64(data.data(), data.size());
 		}
+	}
 
-		return dest.value;
+	// Unaligned big-endian loads and stores, for pulling fields straight out of a receive buffer.
+	template <typename T>
+	T load_be(const void * p)
+	{
+		T value;
+		std::memcpy(&value, p, sizeof(T));
+		if constexpr (std::endian::native == std::endian::little) {
+			value = swapEndianness(value);
+		}
+		return value;
 	}
 
-	std::string URLEncode(const std::string & in);
-	std::string URLDecode(const std::string & in);
+	template <typename T>
+	void store_be(void * p, T value)
+	{
+		if constexpr (std::endian::native == std::endian::little) {
+			value = swapEndianness(value);
+		}
+		std::memcpy(p, &value, sizeof(T));
+	}
+
+	// Describes which members of a (possibly packed) struct are multi-byte numbers, so whole structs and arrays
+	// of them can be converted in one pass:
+	//     using HeaderFields = Network::EndianFields<Header, &Header::iLength, &Header::iSequence>;
+	//     HeaderFields::FromBigEndian(std::span(vHeaders));
+	template <typename T, auto... Members>
+	struct EndianFields
+	{
+		static constexpr void Swap(T & value)
+		{
+			((value.*Members = swapEndianness(value.*Members)), ...);
+		}
+
+		static void Swap(std::span<T> values)
+		{
+			for (auto & value : values) {
+				Swap(value);
+			}
+		}
+
+		static void FromBigEndian(std::span<T> values)
+		{
+			if constexpr (std::endian::native == std::endian::little) {
+				Swap(values);
+			}
+		}
+
+		static void ToBigEndian(std::span<T> values)
+		{
+			FromBigEndian(values);
+		}
+	};
+
+	std::string URLEncode(std::string_view in);
+	std::string URLDecode(std::string_view in);
+	size_t      URLDecodeInPlace(std::span<char> data); // Returns the decoded length.
+	void        URLDecodeInPlace(std::string & in);
+
+	// A reference-counted view into a pooled slab.  Copies and Slice()s share the slab, which goes back to its
+	// pool when the last view is dropped, so a handler can keep received data by keeping the Buffer.
+	class Buffer
+	{
+		public:
+			Buffer() = default;
+
+			char *           data() const { return pSlab.get() + iOffset; }
+			size_t           size() const { return iSize; }
+			bool             empty() const { return iSize == 0; }
+			std::string_view View() const { return std::string_view(data(), iSize); }
+			operator std::string_view() const { return View(); }
+			std::string      str() const { return std::string(data(), iSize); }
+
+			Buffer           Slice(size_t iOffsetIn, size_t iSizeIn) const;
+			Buffer           Slice(std::string_view sPart) const; // sPart must lie inside this Buffer.
+			bool             Unique() const { return pSlab.use_count() == 1; } // No other view shares the slab.
+
+		private:
+			friend class BufferPool;
+
+			std::shared_ptr<char> pSlab;
+			size_t iOffset = 0;
+			size_t iSize = 0;
+	};
+
+	struct BufferPoolStats
+	{
+		size_t iSlabSize = 0;
+		size_t iSlabsInUse = 0;
+		size_t iSlabsFree = 0;
+		size_t iBytesInUse = 0;
+		size_t iBytesFree = 0;
+		size_t iHighWaterSlabs = 0;
+		size_t iHighWaterBytes = 0;
+		uint64_t iAcquired = 0;
+		uint64_t iAllocated = 0; // Acquires the free lists could not satisfy.
+	};
+
+	// Receive slabs for every transport on a core.  Slabs are iSlabSize bytes, or the next power of two for larger
+	// requests, and are kept on per-size free lists up to iMaxFreeBytes.
+	class BufferPool
+	{
+		public:
+			explicit BufferPool(size_t iSlabSizeIn = 64 * 1024, size_t iMaxFreeBytesIn = 16 * 1024 * 1024);
+			~BufferPool();
+
+			Buffer          Acquire(size_t iMinSize = 0); // size() is the whole slab.
+			size_t          SlabSize() const;
+			void            MaxFree(size_t iMaxFreeBytesIn);
+			void            Trim(); // Frees every idle slab.
+			BufferPoolStats Stats() const;
+			void            ResetHighWater();
+
+		private:
+			struct State;
+			std::shared_ptr<State> state;
+	};
 
 	class CoreBase
 	{
@@ -78,22 +219,131 @@ namespace Network
 			void                Exit();
 			void                WakeUp() const;
 			net::io_context &   IOContext();
-			const std::string & Certificates() const;
+			const std::string & Certificates() const; // Waits for the background read started by the constructor.
+
+			// Cached host lookups shared by every client on this core.  Concurrent lookups of one host share a
+			// single query, entries used close to expiry are refreshed in the background, and addresses come back
+			// with IPv6 and IPv4 interleaved (RFC 8305) so a failed family does not stall the connect.
+			using endpoints_t = std::vector<tcp::endpoint>;
+			using resolve_handler_t = std::function<void(const boost::system::error_code & ec, const endpoints_t & vEndpoints)>;
+			void                Resolve(const std::string & sHost, int iPort, resolve_handler_t handler);
+			void                DNSCacheTTL(std::chrono::seconds ttlIn, std::chrono::seconds refreshIn = 10s); // getaddrinfo() does not report record TTLs.
+			void                DNSOverride(const std::string & sHost, std::vector<net::ip::address> vAddresses); // Pinned, never expires.  Empty removes.
+			void                DNSCacheClear();
+
+			BufferPool &        Buffers(); // Receive slabs shared by the Serial, TCP and UDP transports.
 
 		protected:
+			struct DNSEntry
+			{
+				std::vector<net::ip::address> vAddresses;
+				std::chrono::steady_clock::time_point expires;
+				bool bPinned = false;
+				bool bResolving = false;
+				std::vector<std::function<void(const boost::system::error_code & ec, const std::vector<net::ip::address> & vAddresses)>> vWaiters;
+			};
+			void                DNSLookup(const std::string & sHost);
+
 			net::io_context ioc;
 			EventHandler::Event eWakeUp = EventHandler::CreateEvent("HTTP::Core::WakeUp", EventHandler::auto_reset);
 			EventHandler::Event eExit = EventHandler::CreateEvent("HTTP::Core::Exit", EventHandler::manual_reset);
 			std::vector<Thread> vThreads;
-			std::string sCertificates;
+			std::shared_future<std::string> certificates; // The CA bundle is large; reading it must not hold up startup.
 			bool bExit = false;
+
+			std::mutex mtxDNS;
+			std::map<std::string, DNSEntry> mDNS;
+			std::chrono::seconds dnsTTL = 60s;
+			std::chrono::seconds dnsRefresh = 10s;
+
+			BufferPool bufferPool;
 	};
 
 	using core_t = std::shared_ptr<CoreBase>;
 	core_t & Core(int iThreadCountInit = 0);  // calling this with <= 0 will not create an instance if one does not exist. Only the first call to this > 0 will create the instance.
 	void ExitAll();
 
-	class Serial
+	// Framers split a byte stream into messages.  Frame() is handed everything received but not yet consumed,
+	// calls onFrame for each complete frame, and returns how many bytes it used.  Frames are views over the
+	// caller's buffer and are only valid during the callback.  Framers that decode (SLIP, COBS) do so in place.
+	using frame_handler_t = std::function<void(std::string_view sFrame)>;
+
+	class Framer
+	{
+		public:
+			virtual ~Framer() = default;
+			virtual size_t Frame(std::span<char> data, const frame_handler_t & onFrame) = 0;
+	};
+	using framer_t = std::shared_ptr<Framer>;
+	using buffer_handler_t = std::function<void(const Buffer & frame)>;
+
+	// Runs framer over the unconsumed bytes [iStart, iFill) of rx, handing each frame out as a slice of rx, and
+	// advances iStart.  With no framer the whole range is one frame.  Returns the number of frames.
+	size_t FrameBuffer(const framer_t & framer, const Buffer & rx, size_t & iStart, size_t iFill, const buffer_handler_t & onFrame);
+
+	// Makes room in rx for the next read.  The unconsumed tail moves to the front when no handler still holds
+	// frames from rx and to a fresh slab when one does; a frame that fills iMaxSize is dropped (returns false).
+	bool ReserveBuffer(BufferPool & pool, Buffer & rx, size_t & iStart, size_t & iFill, size_t iMaxSize);
+
+	class DelimiterFramer : public Framer
+	{
+		public:
+			explicit DelimiterFramer(std::string sDelimiterIn = "~", bool bIncludeDelimiterIn = true);
+			size_t Frame(std::span<char> data, const frame_handler_t & onFrame) override;
+
+		private:
+			std::string sDelimiter;
+			bool bIncludeDelimiter;
+	};
+
+	class LengthPrefixFramer : public Framer
+	{
+		public:
+			// iPrefixBytes is 1, 2 or 4.  Frames longer than iMaxFrame are treated as corrupt and the data is dropped.
+			explicit LengthPrefixFramer(size_t iPrefixBytesIn = 2, bool bBigEndianIn = true, size_t iMaxFrameIn = 64 * 1024);
+			size_t Frame(std::span<char> data, const frame_handler_t & onFrame) override;
+
+		private:
+			size_t iPrefixBytes;
+			bool bBigEndian;
+			size_t iMaxFrame;
+	};
+
+	class SlipFramer : public Framer // RFC 1055
+	{
+		public:
+			size_t Frame(std::span<char> data, const frame_handler_t & onFrame) override;
+	};
+
+	class CobsFramer : public Framer // Consistent Overhead Byte Stuffing, 0x00 terminated.
+	{
+		public:
+			size_t Frame(std::span<char> data, const frame_handler_t & onFrame) override;
+	};
+
+	class FixedFramer : public Framer
+	{
+		public:
+			explicit FixedFramer(size_t iSizeIn);
+			size_t Frame(std::span<char> data, const frame_handler_t & onFrame) override;
+
+		private:
+			size_t iSize;
+	};
+
+	struct SerialStats
+	{
+		uint64_t iBytesRead = 0;
+		uint64_t iBytesWritten = 0;
+		uint64_t iFrames = 0;
+		uint64_t iWrites = 0;
+		uint64_t iReadErrors = 0;
+		uint64_t iWriteErrors = 0;
+		std::chrono::microseconds writeLatencyAvg{0}; // Queued to written, per Write().
+		std::chrono::microseconds writeLatencyMax{0};
+	};
+
+	class Serial : public std::enable_shared_from_this<Serial>
 	{
 		public:
 			// Serial port class using Boost::asio:
@@ -105,13 +355,57 @@ namespace Network
 			bool Open();
 			bool Close();
 
-			void Write(const std::string & sData);
-			void SetReadCalback(std::function<void(const std::string & sData)> callback);
+			// Writes are queued and sent asynchronously; queued writes are gathered into a single async_write.
+			// Returns false without queueing when the queue is at its limit.  The callback runs on a network thread.
+			using write_callback_t = std::function<void(const boost::system::error_code & ec, size_t iBytes)>;
+			bool Write(std::string sData, write_callback_t callback = nullptr);
+			bool Write(std::shared_ptr<const std::string> data, write_callback_t callback = nullptr);
+			std::future<boost::system::error_code> WriteFuture(std::string sData);
+			void WriteWatermarks(size_t iHighIn, size_t iLowIn, size_t iLimitIn);
+			EventHandler::Event WriteBackpressure() const; // Set while more than the high watermark is queued.
+			size_t WriteQueued();
+
+			void SetReadCalback(std::function<void(const std::string & sData)> callback); // '~' delimited, frames copied.
+			void SetFrameCallback(framer_t framerIn, frame_handler_t callback);
+			void SetBufferCallback(framer_t framerIn, buffer_handler_t callback); // Frames are pooled; keep the Buffer to keep the data.
+
+			const std::string & Port() const;
+			SerialStats Stats();
+			void ResetStats();
 
 			static std::deque<std::string> ListPorts();
+			static bool IsSerialName(std::string_view sFilename);
+
+			static constexpr size_t iMaxReadBufferSize = 1024 * 1024;
 
 		private:
 			void DoRead();
+			void HandleRead(const boost::system::error_code & ec, std::size_t bytesIn);
+			void DoWrite();
+			void CompleteWrites(const boost::system::error_code & ec); // The batch in vWriting.
+			void FailWrites(const boost::system::error_code & ec);     // Everything still queued.
+
+			// Held by each handler of a Serial not owned by a shared_ptr, which has no other way to keep it alive;
+			// ~Serial() waits for the count to drop to zero.  A null counter counts nothing.
+			struct PendingOp
+			{
+				explicit PendingOp(std::shared_ptr<std::atomic<size_t>> counterIn);
+				PendingOp(const PendingOp & other);
+				PendingOp(PendingOp && other) noexcept = default;
+				PendingOp & operator=(const PendingOp &) = delete;
+				~PendingOp();
+
+				std::shared_ptr<std::atomic<size_t>> counter;
+			};
+			PendingOp Pending(const std::shared_ptr<Serial> & self);
+
+			struct PendingWrite
+			{
+				std::shared_ptr<const std::string> data;
+				write_callback_t callback;
+				std::chrono::steady_clock::time_point queued;
+			};
+			static constexpr size_t iMaxGather = 64;
 
 			core_t core;
 			std::string sPort;
@@ -122,17 +416,194 @@ namespace Network
 			int iFlowControl;
 			int iTimeout;
 			boost::asio::serial_port port;
-			std::function<void(const std::string & sData)> readCallback;
-			std::string sReadData;
-			mutable std::recursive_mutex mtx;
+			framer_t framer;
+			buffer_handler_t frameCallback;
+			Buffer rxBuffer;
+			size_t iReadStart = 0;
+			size_t iReadFill = 0;
+			bool bReading = false;
+			mutable std::recursive_mutex mtx; // Also guards port: every operation on it starts under this lock.
+			std::shared_ptr<std::atomic<size_t>> pending = std::make_shared<std::atomic<size_t>>(0);
+
+			std::mutex mtxWrite; // Separate from mtx so Write() never waits on a read callback.
+			std::deque<PendingWrite> dqWrites;
+			std::vector<PendingWrite> vWriting;
+			size_t iWritingBytes = 0;
+			size_t iWriteOffset = 0; // Bytes of vWriting already sent.
+			size_t iWriteQueued = 0;
+			size_t iWriteHigh = 64 * 1024;
+			size_t iWriteLow = 16 * 1024;
+			size_t iWriteLimit = 1024 * 1024;
+			bool bWriting = false;
+			EventHandler::Event eWriteBackpressure = EventHandler::CreateEvent("Serial::WriteBackpressure", EventHandler::manual_reset);
+
+			std::mutex mtxStats;
+			SerialStats stats;
+			std::chrono::microseconds writeLatencyTotal{0};
+	};
+
+	class SerialHub : public std::enable_shared_from_this<SerialHub>
+	{
+		public:
+			// Owns many serial ports on the shared Network core.  Watch() follows hotplug through inotify on /dev
+			// (Linux only) instead of rescanning the directory.
+			using port_filter_t = std::function<bool(const std::string & sPort)>;
+			using port_handler_t = std::function<void(const std::string & sPort, bool bAdded)>;
+			using framer_factory_t = std::function<framer_t()>;
+			using hub_frame_handler_t = std::function<void(const std::string & sPort, std::string_view sFrame)>;
+
+			SerialHub(int iBaudRateIn, int iDataBitsIn = 8, int iStopBitsIn = 1, int iParityIn = 0, int iFlowControlIn = 0);
+			~SerialHub();
+
+			void OnFrame(framer_factory_t framerFactoryIn, hub_frame_handler_t handlerIn); // Applies to ports added afterwards.
+			bool Add(const std::string & sPort);
+			void Remove(const std::string & sPort);
+			std::shared_ptr<Serial> Get(const std::string & sPort);
+			std::vector<std::string> Ports();
+			bool Write(const std::string & sPort, std::string sData, Serial::write_callback_t callback = nullptr);
+
+			// Adds present and future ports matching the filter (default: Serial::IsSerialName).  A watching hub
+			// stays alive until StopWatching().
+			bool Watch(port_filter_t filterIn = nullptr, port_handler_t onChangeIn = nullptr);
+			void StopWatching();
+
+			std::map<std::string, SerialStats> Stats();
+
+		private:
+			void do_watch();
+			void on_created(const std::string & sPort);
+
+			core_t core;
+			int iBaudRate;
+			int iDataBits;
+			int iStopBits;
+			int iParity;
+			int iFlowControl;
+			std::mutex mtx;
+			std::map<std::string, std::shared_ptr<Serial>> mPorts;
+			framer_factory_t framerFactory;
+			hub_frame_handler_t onFrame;
+			port_filter_t filter;
+			port_handler_t onChange;
+#ifdef __linux__
+			std::unique_ptr<boost::asio::posix::stream_descriptor> inotify;
+			std::array<char, 4096> aEvents{};
+#endif
+	};
+	using serial_hub_t = std::shared_ptr<SerialHub>;
+
+	// Log-linear latency histogram in the manner of HdrHistogram: fixed memory, values within 1.6% from 1us
+	// to a little over an hour.  Not thread safe; callers lock.
+	class Histogram
+	{
+		public:
+			void                      Record(std::chrono::microseconds value);
+			void                      Merge(const Histogram & other);
+			void                      Reset();
+			uint64_t                  Count() const;
+			std::chrono::microseconds Percentile(double dPercentile) const; // 0 to 100
+			std::chrono::microseconds Mean() const;
+			std::chrono::microseconds Max() const;
+
+		private:
+			static size_t   Index(uint64_t iValue);
+			static uint64_t Value(size_t iIndex);
+
+			static constexpr unsigned iSubBucketBits = 7;
+			static constexpr uint64_t iHighestValue = (uint64_t(1) << 32) - 1;
+
+			std::vector<uint64_t> vCounts;
+			uint64_t iCount = 0;
+			uint64_t iTotal = 0;
+			uint64_t iMax = 0;
 	};
 
 	namespace HTTP
 	{
 		using verb = http::verb;
+
+		// Phase timestamps for one request.  Connection phases are only set for the request that opened the
+		// connection; later requests on it have bReused set and those phases read as zero.
+		struct Timing
+		{
+			using time_point = std::chrono::steady_clock::time_point;
+			time_point queued;
+			time_point resolveStart;
+			time_point resolved;
+			time_point connected;
+			time_point handshaken;
+			time_point writeStart;
+			time_point written;
+			time_point firstByte;
+			time_point complete;
+			bool bReused = false;
+
+			static std::chrono::microseconds Span(time_point from, time_point to);
+			std::chrono::microseconds Queue() const;   // queued to first byte written, less connection setup
+			std::chrono::microseconds DNS() const;     // resolveStart to resolved
+			std::chrono::microseconds Connect() const; // resolved to connected
+			std::chrono::microseconds TLS() const;     // connected to handshaken
+			std::chrono::microseconds Send() const;    // writeStart to written
+			std::chrono::microseconds Wait() const;    // written to first byte read (server time)
+			std::chrono::microseconds Receive() const; // first byte read to complete
+			std::chrono::microseconds Total() const;   // queued to complete
+		};
+
+		struct Response : public http::response<http::string_body>
+		{
+			using base_t = http::response<http::string_body>;
+			using base_t::base_t;
+			using base_t::operator=;
+			Timing timing;
+			uint64_t iWireBytes = 0;                  // Body bytes as received, before any content decoding.
+			std::chrono::microseconds decodeTime{0}; // Time spent decoding the body.
+			boost::system::error_code ec;            // Set when the request failed; result_int() is then 0.
+		};
+
+		// Per host:port histograms of every completed client request.
+		struct HostTimings
+		{
+			Histogram dns;
+			Histogram connect;
+			Histogram tls;
+			Histogram wait;
+			Histogram total;
+		};
+		std::map<std::string, HostTimings> Timings();
+		std::chrono::microseconds TimingPercentile(const std::string & sHost, double dPercentile, uint64_t iMinSamples = 1); // Total time; 0 with too few samples.
+		void ResetTimings();
+		void RecordTiming(const std::string & sHost, const Timing & timing);
+
 		using request_t = std::shared_ptr<http::request<http::string_body>>;
-		using response_t = std::shared_ptr<http::response<http::string_body>>;
+		using response_t = std::shared_ptr<Response>;
 		using handler_t = std::function<void(request_t req, response_t res, const std::string & sRremoteAddr, int iRemotePort)>;
+		using chunk_handler_t = std::function<bool(std::string_view sChunk)>; // Return false to abort the transfer.
+		using progress_handler_t = std::function<void(uint64_t iReceived, uint64_t iTotal)>; // iTotal is 0 when the server did not send a Content-Length.
+		using chunk_generator_t = std::function<bool(std::string & sChunk)>; // Fill sChunk and return true, or return false when the body is complete.
+
+		struct RetryPolicy
+		{
+			int iMaxAttempts = 1;                                  // 1 disables retries.
+			std::chrono::milliseconds baseDelay = 100ms;           // Backoff is random in [0, min(maxDelay, baseDelay * 2^retry)].
+			std::chrono::milliseconds maxDelay = 5s;
+			bool bRetryStatus = true;                              // Retry 502, 503 and 504 responses as well as transport errors.
+			bool bRetryNonIdempotent = false;                      // POST and PATCH are only retried when this is set.
+		};
+
+		struct HedgePolicy
+		{
+			bool bEnabled = false;                                 // Idempotent, non-streamed requests only.
+			double dPercentile = 95.0;                             // Send a second copy once the request is slower than this percentile for the host.
+			uint64_t iMinSamples = 20;                             // No hedging until the host has this many completed requests.
+			std::chrono::milliseconds minDelay = 5ms;
+		};
+
+		struct CircuitBreakerPolicy
+		{
+			bool bEnabled = false;
+			int iFailureThreshold = 5;                             // Consecutive failures (transport errors and 5xx) that open the circuit.
+			std::chrono::seconds openTime = 30s;                   // Requests fail at once for this long, then one trial request is let through.
+		};
 
 		class ClientBase : public std::enable_shared_from_this<ClientBase>
 		{
@@ -143,6 +614,24 @@ namespace Network
 				void KeepAlive(bool bKeepAliveIn);
 				bool KeepAlive() const;
 
+				void Pipelining(bool bPipeliningIn, size_t iMaxDepthIn = 8); // Send idempotent keep-alive requests back-to-back without waiting for each response.
+				bool Pipelining() const;
+				// Send Accept-Encoding and inflate gzip/deflate (and br when built with EASYAPPBASE_BROTLI) bodies as they
+				// arrive.  Streamed requests get decoded chunks; res->iWireBytes and res->decodeTime show what it cost.
+				void Decompress(bool bDecompressIn);
+				bool Decompress() const;
+				// Largest body collected into res->body(), counted after decoding.  Bodies handed to a chunk handler or written
+				// to a file are never held, so are not limited.  A response over the limit fails with http::error::body_limit.
+				void BodyLimit(uint64_t iLimitIn);
+				uint64_t BodyLimit() const;
+
+				// Every request calls its handler exactly once; on failure res->ec is set.  The circuit breaker state is shared
+				// by all clients of the same host:port.
+				void Retry(const RetryPolicy & policyIn);
+				void Hedge(const HedgePolicy & policyIn);
+				void CircuitBreaker(const CircuitBreakerPolicy & policyIn);
+				size_t Pending(); // Requests queued or awaiting a response.
+
 				virtual bool Connected();
 				virtual void Close();
 
@@ -152,31 +641,112 @@ namespace Network
 				void Get(const std::string & sPath, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
 				void Put(const std::string & sPath, const std::string & sBody, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
 				void Post(const std::string & sPath, const std::string & sBody, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+
+				// Upload bodies that are never copied into the request: a moved string, caller-owned memory kept alive by owner,
+				// a file read as it is sent, or chunks pulled from a generator with chunked transfer encoding.
+				void Put(const std::string & sPath, std::string && sBody, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void Post(const std::string & sPath, std::string && sBody, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void Put(const std::string & sPath, std::span<const std::byte> body, std::shared_ptr<const void> owner, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void Post(const std::string & sPath, std::span<const std::byte> body, std::shared_ptr<const void> owner, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void PutFile(const std::string & sPath, const std::string & sFile, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void PostFile(const std::string & sPath, const std::string & sFile, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void PutChunked(const std::string & sPath, chunk_generator_t generator, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void PostChunked(const std::string & sPath, chunk_generator_t generator, const std::string & sContentType, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
 				void Delete(const std::string & sPath, handler_t handlerIn, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
 
+				// Streamed responses hand the body to chunkIn as it arrives instead of buffering it in res->body(). The next read is
+				// not issued until chunkIn returns, and timeout is an idle timeout that restarts with every chunk.
+				void Stream(request_t reqIn, chunk_handler_t chunkIn, handler_t handlerIn, progress_handler_t progressIn = nullptr, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+				void Download(const std::string & sPath, const std::string & sFile, handler_t handlerIn, progress_handler_t progressIn = nullptr, std::chrono::seconds timeout = 30s, bool bKeepAliveIn = false);
+
+				static constexpr size_t iStreamChunkSize = 64 * 1024;
+
 			protected:
+				using write_handler_t = std::function<void(const boost::system::error_code & ec, std::size_t bytes_transferred)>;
+				using body_writer_t = std::function<void(ClientBase & client, const request_t & header, write_handler_t handler)>;
+
+				struct PendingRequest
+				{
+					request_t req;
+					body_writer_t fnWrite; // Set when the body is not in req->body(); req then only carries the header.
+					bool bReplayable = true;
+					response_t res;
+					handler_t handler;
+					chunk_handler_t onChunk;
+					progress_handler_t onProgress;
+					std::chrono::seconds timeout = 30s;
+					std::chrono::steady_clock::time_point deadline;
+					bool bWritten = false;
+					bool bDecompress = false;
+					uint64_t iBodyLimit = 0;
+					int iAttempts = 0; // Pipelined replays after a connection loss.
+					int iRetries = 0;  // Policy retries.
+					bool bBreakerTrial = false; // This request is the one let through a half-open circuit.
+				};
+				using pending_t = std::shared_ptr<PendingRequest>;
+				struct StreamState;
+
 				beast::tcp_stream &                    tcp_stream() const;
 				beast::ssl_stream<beast::tcp_stream> & ssl_stream() const;
 				virtual void                           PrepStream();
 
+				request_t MakeRequest(verb method, const std::string & sPath, const std::string & sContentType = "") const;
+				void Enqueue(pending_t pending, std::chrono::seconds timeout, bool bKeepAliveIn);
+				static body_writer_t SpanWriter(std::span<const std::byte> body, std::shared_ptr<const void> owner);
+				static body_writer_t FileWriter(const std::string & sFile);
+				static body_writer_t ChunkedWriter(chunk_generator_t generator);
+				void SendBody(verb method, const std::string & sPath, const std::string & sContentType, body_writer_t fnWrite, bool bReplayable, handler_t handlerIn, std::chrono::seconds timeout, bool bKeepAliveIn);
+				template <class Message> void write_message(std::shared_ptr<Message> msg, write_handler_t handler);
+				template <class Buffers> void write_buffers(const Buffers & buffers, write_handler_t handler);
+				void write_chunks(std::shared_ptr<http::request_serializer<http::empty_body>> sr, std::shared_ptr<http::request<http::empty_body>> msg, chunk_generator_t generator, write_handler_t handler);
+
+				static bool Idempotent(verb method);
+				bool CanWrite(const pending_t & next) const;
+				void ArmTimeout();
+				void fail(const std::string & sWhere, const boost::system::error_code & ec);
+				void complete(const pending_t & pending, const boost::system::error_code & ec);
+				bool ShouldRetry(const pending_t & pending, const boost::system::error_code & ec);
+				void Hedged(const pending_t & pending);
+				bool BreakerAllows(const pending_t & pending);
+				void BreakerRecord(bool bFailure);
+				void BreakerRelease(const pending_t & pending);
+				std::string HostKey() const;
+
+				void do_next();
 				void do_resolve();
 				virtual void do_connect();
 				void do_handshake();
-				void do_write();
-				void do_read();
+				void do_write(std::vector<pending_t> vBatch);
+				void do_read(pending_t pending);
+				void do_read_stream(pending_t pending);
+				void do_read_chunk(pending_t pending, std::shared_ptr<StreamState> state);
+				void on_response(const pending_t & pending, bool bKeepAliveOut);
 
 				core_t core;
 				std::string sAddress;
 				int iPort = 0;
+				net::strand<net::io_context::executor_type> strand;
 				ssl::context ctx{ssl::context::tlsv12_client};
-				tcp::resolver resolver;
-				tcp::resolver::results_type resolve_results;
-				handler_t handler;
+				CoreBase::endpoints_t vEndpoints;
+				Timing connTiming; // Connection phases, handed to the first request written on the connection.
+				bool bConnTimingUsed = true;
 				bool bKeepAlive = false;
 				std::mutex mtx;
-				request_t req;
-				response_t res;
+				std::deque<pending_t> dqQueued;
+				std::deque<pending_t> dqInFlight;
+				bool bConnecting = false;
+				bool bWriting = false;
+				bool bReading = false;
+				bool bPipelining = false;
+				bool bDecompress = false;
+				uint64_t iBodyLimit = 8 * 1024 * 1024; // Beast's own default.
+				size_t iMaxDepth = 8;
+				RetryPolicy retryPolicy;
+				HedgePolicy hedgePolicy;
+				CircuitBreakerPolicy breakerPolicy;
+				std::shared_ptr<ClientBase> hedgeClient; // Second connection that hedged copies go out on.
 				beast::flat_buffer buffer;
+				static constexpr size_t iMaxIdleBuffer = 64 * 1024; // Shrunk back to this between responses.
 				bool bThreadExited = false;
 
 				bool bSSL= true;
@@ -189,6 +759,448 @@ namespace Network
 
 		client_t Client(const std::string & sAddress, int iPort, bool bSSLIn = true, bool bAllowSelfSignedIn = false);
 
+		class ServerBase : public std::enable_shared_from_this<ServerBase>
+		{
+			public:
+				ServerBase(std::string sAddressIn, int iPortIn, bool bSSLIn = false, std::string sCertFileIn = "", std::string sKeyFileIn = "");
+				~ServerBase();
+
+				// The handler fills in res, which starts out as an empty 200. A path ending in '*' matches every target that
+				// starts with the rest of it, and verb::unknown matches any method. The longest matching route wins.
+				void Route(verb method, const std::string & sPath, handler_t handlerIn);
+				void MaxConnections(size_t iMaxIn);
+				void KeepAliveTimeout(std::chrono::seconds timeout);
+				void BodyLimit(uint64_t iLimitIn);
+				size_t Connections();
+				int Port() const;
+
+				bool Start();
+				void Stop(std::chrono::milliseconds drainTimeout = 5s); // Stops accepting, finishes requests in progress and closes idle connections.
+				bool Running() const;
+
+				static void StopAll(std::chrono::milliseconds drainTimeout = 5s);
+
+				static constexpr size_t iParseBufferSize = 16 * 1024; // Per connection, reused for every request. Also the request header limit.
+
+			protected:
+				class Session;
+
+				struct RouteEntry
+				{
+					verb method = verb::unknown;
+					std::string sPath;
+					bool bPrefix = false;
+					handler_t handler;
+				};
+
+				void do_accept();
+				void Dispatch(const request_t & req, const response_t & res, const std::string & sRemoteAddr, int iRemotePort);
+				void SessionEnded(Session * session);
+
+				static std::mutex & RegistryMutex();
+				static std::vector<std::weak_ptr<ServerBase>> & Registry();
+
+				core_t core;
+				std::string sAddress;
+				int iPort = 0;
+				bool bSSL = false;
+				std::string sCertFile;
+				std::string sKeyFile;
+				ssl::context ssl_ctx{ssl::context::tlsv12_server};
+				net::strand<net::io_context::executor_type> strand;
+				tcp::acceptor acceptor;
+				std::mutex mtx;
+				std::vector<RouteEntry> vRoutes;
+				std::map<Session *, std::weak_ptr<Session>> mSessions;
+				size_t iMaxConnections = 256;
+				std::chrono::seconds keepAliveTimeout = 30s;
+				uint64_t iBodyLimit = 1024 * 1024;
+				bool bAccepting = false;
+				bool bRunning = false;
+				std::atomic<bool> bDraining = false;
+				EventHandler::Event eDrained = EventHandler::CreateEvent("HTTP::Server::Drained", EventHandler::manual_reset);
+		};
+
+		using server_t = std::shared_ptr<ServerBase>;
+
+		server_t Server(const std::string & sAddress, int iPort, bool bSSLIn = false, const std::string & sCertFile = "", const std::string & sKeyFile = "");
+
 	} // HTTP
+
+	namespace WebSocket
+	{
+		class ConnectionBase;
+		using connection_t = std::shared_ptr<ConnectionBase>;
+		using open_handler_t = std::function<void(const connection_t & conn)>;
+		using message_handler_t = std::function<void(const connection_t & conn, std::string_view sMessage, bool bBinary)>; // sMessage is only valid during the call.
+		using close_handler_t = std::function<void(const connection_t & conn, const boost::system::error_code & ec)>;
+
+		class ConnectionBase : public std::enable_shared_from_this<ConnectionBase>
+		{
+			public:
+				ConnectionBase(net::strand<net::io_context::executor_type> strandIn, bool bSSLIn, bool bDeflateIn = true);
+				virtual ~ConnectionBase();
+
+				void OnMessage(message_handler_t handlerIn);
+				void OnClose(close_handler_t handlerIn);
+
+				// Messages queue up and go out in order, as text frames unless bBinary is set. The shared_ptr overload sends the
+				// caller's buffer as is, so one payload can go to many connections without a copy.
+				void Send(std::string sMessage, bool bBinary = false);
+				void Send(std::shared_ptr<const std::string> message, bool bBinary = false);
+				void Close(websocket::close_code code = websocket::close_code::normal);
+
+				// With coalescing on, queued messages of the same type smaller than iMaxBytesIn are joined with sSeparatorIn into
+				// one frame. Only use it when the receiver splits them apart again (newline-delimited JSON, for example).
+				void Coalesce(bool bCoalesceIn, size_t iMaxBytesIn = 16 * 1024, std::string sSeparatorIn = "\n");
+
+				// Backpressure() is set while more than iHighIn bytes are queued and reset once the queue drains below iLowIn.
+				void Watermarks(size_t iHighIn, size_t iLowIn);
+				EventHandler::Event Backpressure() const;
+				size_t Queued();
+
+				bool IsOpen();
+				const std::string & RemoteAddress() const;
+				int RemotePort() const;
+
+			protected:
+				friend class ServerBase;
+
+				template <class F> void with_stream(F && f);
+				template <class WS> void SetOptions(WS & ws, beast::role_type role);
+				void Accept(tcp::socket && socket, ssl::context & ctx, std::shared_ptr<void> ownerIn, open_handler_t onOpenIn);
+				void Opened();
+				void do_read();
+				void do_write();
+				void on_closed(const boost::system::error_code & ec);
+
+				struct Outgoing
+				{
+					std::shared_ptr<const std::string> message;
+					bool bBinary = false;
+				};
+
+				core_t core;
+				net::strand<net::io_context::executor_type> strand;
+				bool bSSL = false;
+				bool bDeflate = true;
+				std::shared_ptr<void> owner;
+				std::unique_ptr<websocket::stream<beast::tcp_stream>> plain;
+				std::unique_ptr<websocket::stream<beast::ssl_stream<beast::tcp_stream>>> secure;
+				beast::flat_buffer readBuffer;
+				std::mutex mtx;
+				open_handler_t onOpen;
+				message_handler_t onMessage;
+				close_handler_t onClose;
+				std::deque<Outgoing> dqOutgoing;
+				size_t iQueuedBytes = 0;
+				size_t iHighWater = 4 * 1024 * 1024;
+				size_t iLowWater = 1024 * 1024;
+				bool bCoalesce = false;
+				size_t iCoalesceMax = 16 * 1024;
+				std::string sSeparator = "\n";
+				bool bOpen = false;
+				bool bWriting = false;
+				bool bClosing = false;
+				bool bCloseSent = false;
+				bool bClosed = false;
+				websocket::close_code closeCode = websocket::close_code::normal;
+				EventHandler::Event eBackpressure = EventHandler::CreateEvent("WebSocket::Backpressure", EventHandler::manual_reset);
+				std::string sRemoteAddr;
+				int iRemotePort = 0;
+		};
+
+		class ClientBase : public ConnectionBase
+		{
+			public:
+				ClientBase(std::string sAddressIn, int iPortIn, std::string sPathIn = "/", bool bSSLIn = true, bool bDeflateIn = true);
+
+				void Connect(open_handler_t onOpenIn = nullptr);
+
+			protected:
+				template <class WS> void do_connect(WS & ws, const CoreBase::endpoints_t & vEndpoints);
+
+				std::string sAddress;
+				int iPort = 0;
+				std::string sPath;
+				ssl::context ssl_ctx{ssl::context::tlsv12_client};
+		};
+
+		using client_t = std::shared_ptr<ClientBase>;
+
+		client_t Client(const std::string & sAddress, int iPort, const std::string & sPath = "/", bool bSSLIn = true);
+
+		class ServerBase : public std::enable_shared_from_this<ServerBase>
+		{
+			public:
+				ServerBase(std::string sAddressIn, int iPortIn, bool bSSLIn = false, std::string sCertFileIn = "", std::string sKeyFileIn = "");
+				~ServerBase();
+
+				// Handlers are copied onto each connection as it is accepted.
+				void OnOpen(open_handler_t handlerIn);
+				void OnMessage(message_handler_t handlerIn);
+				void OnClose(close_handler_t handlerIn);
+				void Deflate(bool bDeflateIn);
+
+				bool Start();
+				void Stop();
+				int Port() const;
+
+				std::vector<connection_t> Connections();
+				void Broadcast(std::shared_ptr<const std::string> message, bool bBinary = false);
+
+				static void StopAll();
+
+			protected:
+				void do_accept();
+
+				static std::mutex & RegistryMutex();
+				static std::vector<std::weak_ptr<ServerBase>> & Registry();
+
+				core_t core;
+				std::string sAddress;
+				int iPort = 0;
+				bool bSSL = false;
+				bool bDeflate = true;
+				std::string sCertFile;
+				std::string sKeyFile;
+				ssl::context ssl_ctx{ssl::context::tlsv12_server};
+				net::strand<net::io_context::executor_type> strand;
+				tcp::acceptor acceptor;
+				std::mutex mtx;
+				open_handler_t onOpen;
+				message_handler_t onMessage;
+				close_handler_t onClose;
+				std::vector<std::weak_ptr<ConnectionBase>> vConnections;
+				bool bRunning = false;
+		};
+
+		using server_t = std::shared_ptr<ServerBase>;
+
+		server_t Server(const std::string & sAddress, int iPort, bool bSSLIn = false, const std::string & sCertFile = "", const std::string & sKeyFile = "");
+	} // WebSocket
+
+	namespace TCP
+	{
+		class ConnectionBase;
+		using connection_t = std::shared_ptr<ConnectionBase>;
+		using open_handler_t = std::function<void(const connection_t & conn)>;
+		using frame_handler_t = std::function<void(const connection_t & conn, std::string_view sFrame)>; // sFrame is only valid during the call.
+		using buffer_handler_t = std::function<void(const connection_t & conn, const Buffer & frame)>;
+		using close_handler_t = std::function<void(const connection_t & conn, const boost::system::error_code & ec)>;
+		using framer_factory_t = std::function<framer_t()>;
+
+		// A raw TCP stream.  Received bytes go through a Framer (the same ones Serial uses, raw chunks when none is set)
+		// straight out of pooled receive slabs, so frames reach OnBuffer handlers without a copy.  Sends are queued and
+		// gathered into one write.
+		class ConnectionBase : public std::enable_shared_from_this<ConnectionBase>
+		{
+			public:
+				ConnectionBase(net::strand<net::io_context::executor_type> strandIn);
+				virtual ~ConnectionBase();
+
+				void OnFrame(framer_t framerIn, frame_handler_t handlerIn);
+				void OnBuffer(framer_t framerIn, buffer_handler_t handlerIn);
+				void OnClose(close_handler_t handlerIn);
+
+				void Send(std::string sData);
+				void Send(std::shared_ptr<const std::string> data); // Shared payloads are not copied.
+				void Close();
+
+				void Watermarks(size_t iHighIn, size_t iLowIn);
+				EventHandler::Event Backpressure() const; // Set while more than the high watermark is queued.
+				size_t Queued();
+				bool IsOpen();
+				const std::string & RemoteAddress() const;
+				int RemotePort() const;
+
+				static constexpr size_t iMaxReadBufferSize = 16 * 1024 * 1024;
+				static constexpr size_t iMaxGather = 64;
+
+			protected:
+				friend class ServerBase;
+
+				void Opened();
+				void do_read();
+				void do_write();
+				void on_closed(const boost::system::error_code & ec);
+
+				core_t core;
+				net::strand<net::io_context::executor_type> strand;
+				tcp::socket socket;
+				std::shared_ptr<void> owner; // Keeps the accepting server alive.
+				std::mutex mtx;
+				open_handler_t onOpen;
+				framer_t framer;
+				buffer_handler_t onFrame;
+				close_handler_t onClose;
+				Buffer rxBuffer;
+				size_t iReadStart = 0;
+				size_t iReadFill = 0;
+				std::deque<std::shared_ptr<const std::string>> dqOutgoing;
+				std::vector<std::shared_ptr<const std::string>> vWriting;
+				size_t iQueuedBytes = 0;
+				size_t iHighWater = 4 * 1024 * 1024;
+				size_t iLowWater = 1024 * 1024;
+				bool bOpen = false;
+				bool bWriting = false;
+				bool bClosed = false;
+				EventHandler::Event eBackpressure = EventHandler::CreateEvent("TCP::Backpressure", EventHandler::manual_reset);
+				std::string sRemoteAddr;
+				int iRemotePort = 0;
+		};
+
+		class ClientBase : public ConnectionBase
+		{
+			public:
+				ClientBase(std::string sAddressIn, int iPortIn);
+
+				void Connect(open_handler_t onOpenIn);
+				void NoDelay(bool bNoDelayIn); // TCP_NODELAY, on by default.
+
+			protected:
+				std::string sAddress;
+				int iPort = 0;
+				bool bNoDelay = true;
+		};
+
+		using client_t = std::shared_ptr<ClientBase>;
+
+		client_t Client(const std::string & sAddress, int iPort);
+
+		class ServerBase : public std::enable_shared_from_this<ServerBase>
+		{
+			public:
+				ServerBase(std::string sAddressIn, int iPortIn);
+				~ServerBase();
+
+				// Handlers are copied onto each connection as it is accepted; the framer factory gives each its own framer.
+				void OnOpen(open_handler_t handlerIn);
+				void OnFrame(framer_factory_t framerFactoryIn, frame_handler_t handlerIn);
+				void OnBuffer(framer_factory_t framerFactoryIn, buffer_handler_t handlerIn);
+				void OnClose(close_handler_t handlerIn);
+				void Shards(int iShardsIn); // Listen with this many SO_REUSEPORT acceptors, each on its own strand (Linux).
+
+				bool Start();
+				void Stop();
+				int Port() const;
+
+				std::vector<connection_t> Connections();
+				void Broadcast(std::shared_ptr<const std::string> data);
+
+				static void StopAll();
+
+			protected:
+				void do_accept(size_t iAcceptor);
+
+				static std::mutex & RegistryMutex();
+				static std::vector<std::weak_ptr<ServerBase>> & Registry();
+
+				core_t core;
+				std::string sAddress;
+				int iPort = 0;
+				int iShards = 1;
+				std::vector<std::unique_ptr<tcp::acceptor>> vAcceptors;
+				std::mutex mtx;
+				open_handler_t onOpen;
+				framer_factory_t framerFactory;
+				buffer_handler_t onFrame;
+				close_handler_t onClose;
+				std::vector<std::weak_ptr<ConnectionBase>> vConnections;
+				bool bRunning = false;
+		};
+
+		using server_t = std::shared_ptr<ServerBase>;
+
+		server_t Server(const std::string & sAddress, int iPort);
+	} // TCP
+
+	namespace UDP
+	{
+		using endpoint_t = net::ip::udp::endpoint;
+		using datagram_handler_t = std::function<void(const endpoint_t & from, std::string_view sData)>; // sData is only valid during the call.
+		using buffer_handler_t = std::function<void(const endpoint_t & from, const Buffer & data)>;
+
+		// A UDP socket that receives and sends in batches: on Linux recvmmsg/sendmmsg move up to iBatch datagrams per
+		// system call, elsewhere it falls back to one datagram per operation.  Receive slots are carved from a pooled slab
+		// that is only replaced when a handler keeps one of its Buffers.
+		class SocketBase : public std::enable_shared_from_this<SocketBase>
+		{
+			public:
+				SocketBase(std::string sAddressIn, int iPortIn, bool bReusePortIn = false);
+				~SocketBase();
+
+				void OnDatagram(datagram_handler_t handlerIn);
+				void OnFrame(framer_t framerIn, datagram_handler_t handlerIn); // Split each datagram with a framer.
+				void OnBuffer(framer_t framerIn, buffer_handler_t handlerIn); // framerIn may be null.
+				void Batch(size_t iBatchIn, size_t iMaxDatagramIn); // Set before Open().
+
+				bool Open();
+				void Close();
+				int Port() const;
+
+				bool SendTo(const endpoint_t & to, std::string sData);
+				bool SendTo(const endpoint_t & to, std::shared_ptr<const std::string> data);
+				void Watermarks(size_t iHighIn, size_t iLimitIn); // Sends beyond iLimitIn queued bytes are dropped.
+				EventHandler::Event Backpressure() const;
+
+				uint64_t Received() const;
+				uint64_t Sent() const;
+				uint64_t Dropped() const;
+
+				static std::vector<std::shared_ptr<SocketBase>> Shards(const std::string & sAddress, int iPort, int iShards); // SO_REUSEPORT group, one strand each.
+
+			protected:
+				struct Outgoing
+				{
+					endpoint_t to;
+					std::shared_ptr<const std::string> data;
+				};
+
+				struct Inbound
+				{
+					endpoint_t from;
+					size_t iSlot = 0;
+					size_t iSize = 0;
+				};
+
+				void do_receive();
+				void do_send();
+				void Deliver();
+				void PrepareSlots();
+
+				core_t core;
+				std::string sAddress;
+				int iPort = 0;
+				bool bReusePort = false;
+				net::strand<net::io_context::executor_type> strand;
+				net::ip::udp::socket socket;
+				std::mutex mtx;
+				buffer_handler_t onDatagram;
+				framer_t framer;
+				size_t iBatch = 64;
+				size_t iMaxDatagram = 2048;
+				Buffer rxSlots;
+				std::vector<endpoint_t> vFrom;
+				std::vector<Inbound> vInbound; // The batch waiting for Deliver(); only touched on the strand.
+#ifdef __linux__
+				std::vector<mmsghdr> vMsgs;
+				std::vector<iovec> vIov;
+#endif
+				std::deque<Outgoing> dqOutgoing;
+				size_t iQueuedBytes = 0;
+				size_t iHighWater = 4 * 1024 * 1024;
+				size_t iLimit = 16 * 1024 * 1024;
+				bool bSending = false;
+				EventHandler::Event eBackpressure = EventHandler::CreateEvent("UDP::Backpressure", EventHandler::manual_reset);
+				std::atomic<uint64_t> iReceived = 0;
+				std::atomic<uint64_t> iSent = 0;
+				std::atomic<uint64_t> iDropped = 0;
+		};
+
+		using socket_t = std::shared_ptr<SocketBase>;
+
+		socket_t Socket(const std::string & sAddress, int iPort, bool bReusePort = false);
+	} // UDP
 } // Network
 #define HTTP_HANDLER_LAMBDA [&](Network::HTTP::request_t req, Network::HTTP::response_t res, const std::string & sRremoteAddr, int iRemotePort)
@@ -26,6 +26,7 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 #pragma once
 
 #include "app_logger.hpp"
+#include "trace.hpp"
 #include <map>
 #include <set>
 #include <thread>
@@ -94,7 +95,10 @@ class Thread
 						main_thread_children().insert(pSelf->id);
 					}
 				}
+				const char * sTraceName = Trace::ThreadName(pSelf->sName);
+				Trace::Instant("Thread Start", "thread", sTraceName);
 				__f(stoken);
+				Trace::Instant("Thread Stop", "thread", sTraceName);
 				{
 					std::lock_guard<std::mutex> lock(m_mutex());
 					m_threads().erase(pSelf->id);
@@ -0,0 +1,530 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+#include "trace.hpp"
+#include "app_logger.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace Trace
+{
+	namespace detail
+	{
+		std::atomic<bool> bActive = false;
+	}
+
+	namespace
+	{
+		struct Event
+		{
+			const char * sName;
+			const char * sCategory;
+			const char * sDetail;
+			int64_t iStart;
+			int64_t iDuration; // Negative for instants.
+		};
+
+		// Written only by its own thread; iWritten is published with release so a reader sees whole events.  bBusy is
+		// set around each append so Stop() can wait for appends that began before the capture ended.
+		struct ThreadBuffer
+		{
+			uint64_t iGeneration = 0;
+			uint64_t iTid = 0;
+			std::string sName;
+			std::vector<Event> vEvents;
+			std::atomic<size_t> iWritten = 0;
+			std::atomic<bool> bBusy = false;
+		};
+
+		struct State
+		{
+			std::mutex mtx;
+			std::atomic<uint64_t> iGeneration = 0;
+			size_t iEventsPerThread = 64 * 1024;
+			std::string sFile;
+			std::vector<std::shared_ptr<ThreadBuffer>> vBuffers;
+			std::map<std::string, std::shared_ptr<ThreadBuffer>, std::less<>> mTracks; // Also in vBuffers.
+			std::set<std::string, std::less<>> sInterned; // Node based, so c_str() stays put.
+		};
+
+		State & GetState()
+		{
+			static State ret;
+			return ret;
+		}
+
+		thread_local std::shared_ptr<ThreadBuffer> localBuffer;
+		thread_local std::string sLocalName;
+		thread_local std::map<std::string, const char *, std::less<>> mLocalInterned; // Saves taking State::mtx.
+
+		uint64_t CurrentTid()
+		{
+			#if defined(__linux__)
+			return static_cast<uint64_t>(gettid());
+			#else
+			return static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()) & 0x7fffffff);
+			#endif
+		}
+
+		ThreadBuffer * LocalBuffer()
+		{
+			auto & state = GetState();
+			if (localBuffer && localBuffer->iGeneration == state.iGeneration.load(std::memory_order_acquire)) {
+				return localBuffer.get();
+			}
+			std::lock_guard lock(state.mtx);
+			if (!detail::bActive) {
+				return nullptr;
+			}
+			auto buffer = std::make_shared<ThreadBuffer>();
+			buffer->iGeneration = state.iGeneration;
+			buffer->iTid = CurrentTid();
+			buffer->sName = sLocalName;
+			buffer->vEvents.resize(state.iEventsPerThread);
+			state.vBuffers.push_back(buffer);
+			localBuffer = std::move(buffer);
+			return localBuffer.get();
+		}
+
+		void Append(ThreadBuffer & buffer, const Event & event)
+		{
+			size_t i = buffer.iWritten.load(std::memory_order_relaxed);
+			buffer.vEvents[i % buffer.vEvents.size()] = event;
+			buffer.iWritten.store(i + 1, std::memory_order_release);
+		}
+
+		void Push(const Event & event)
+		{
+			if (!detail::bActive.load(std::memory_order_relaxed)) {
+				return;
+			}
+			auto pBuffer = LocalBuffer();
+			if (!pBuffer) {
+				return;
+			}
+			// Both sequentially consistent: either Stop() sees this buffer busy, or this sees the capture stopped.
+			pBuffer->bBusy.store(true);
+			if (detail::bActive.load()) {
+				Append(*pBuffer, event);
+			}
+			pBuffer->bBusy.store(false, std::memory_order_release);
+		}
+
+		constexpr uint64_t iTrackTid = 0x40000000; // Tracks get made up thread ids above any real one.
+
+		struct Snapshot
+		{
+			uint64_t iTid;
+			std::string sName;
+			std::vector<Event> vEvents;
+		};
+
+		// Copies out every thread's events, oldest first.  Events racing a running capture may be torn; Stop() waits
+		// out the last appends before it writes.
+		std::vector<Snapshot> TakeSnapshot()
+		{
+			auto & state = GetState();
+			std::vector<std::shared_ptr<ThreadBuffer>> vBuffers;
+			std::vector<Snapshot> vRet;
+			{
+				std::lock_guard lock(state.mtx);
+				vBuffers = state.vBuffers;
+				for (auto & buffer : vBuffers) {
+					vRet.push_back({buffer->iTid, buffer->sName, {}});
+				}
+			}
+			for (size_t iBuffer = 0; iBuffer < vBuffers.size(); ++iBuffer) {
+				auto & buffer = vBuffers[iBuffer];
+				size_t iWritten = buffer->iWritten.load(std::memory_order_acquire);
+				size_t iCount = std::min(iWritten, buffer->vEvents.size());
+				auto & snapshot = vRet[iBuffer];
+				snapshot.vEvents.reserve(iCount);
+				for (size_t i = iWritten - iCount; i < iWritten; ++i) {
+					snapshot.vEvents.push_back(buffer->vEvents[i % buffer->vEvents.size()]);
+				}
+			}
+			return vRet;
+		}
+
+		void WriteJSONString(std::ostream & out, std::string_view sIn)
+		{
+			out << '"';
+			for (char c : sIn) {
+				switch (c) {
+					case '"':
+						out << "\\\"";
+						break;
+
+					case '\\':
+						out << "\\\\";
+						break;
+
+					default:
+						if (static_cast<unsigned char>(c) < 0x20) {
+							out << ' ';
+						} else {
+							out << c;
+						}
+						break;
+				}
+			}
+			out << '"';
+		}
+
+		// Just enough protobuf for Perfetto's TracePacket / TrackDescriptor / TrackEvent.
+		void Varint(std::string & out, uint64_t iValue)
+		{
+			while (iValue >= 0x80) {
+				out.push_back(static_cast<char>(iValue | 0x80));
+				iValue >>= 7;
+			}
+			out.push_back(static_cast<char>(iValue));
+		}
+
+		void Field(std::string & out, uint32_t iField, uint64_t iValue)
+		{
+			Varint(out, static_cast<uint64_t>(iField) << 3);
+			Varint(out, iValue);
+		}
+
+		void Field(std::string & out, uint32_t iField, std::string_view sValue)
+		{
+			Varint(out, (static_cast<uint64_t>(iField) << 3) | 2);
+			Varint(out, sValue.size());
+			out.append(sValue);
+		}
+
+		void Packet(std::ostream & out, const std::string & sPacket)
+		{
+			std::string sHeader;
+			Varint(sHeader, (1 << 3) | 2); // Trace.packet
+			Varint(sHeader, sPacket.size());
+			out << sHeader << sPacket;
+		}
+
+		constexpr uint32_t iSequenceId = 1;
+		constexpr uint64_t iProcessUuid = 1;
+	}
+
+	void Start(const std::string & sFileIn, size_t iEventsPerThread)
+	{
+		auto & state = GetState();
+		{
+			std::lock_guard lock(state.mtx);
+			state.sFile = sFileIn;
+			state.iEventsPerThread = std::max<size_t>(iEventsPerThread, 1024);
+			state.vBuffers.clear();
+			state.mTracks.clear();
+			state.iGeneration.fetch_add(1, std::memory_order_release);
+			detail::bActive = true;
+		}
+		Log(AppLogger::INFO) << "Trace::Start Capturing to " << sFileIn << std::endl;
+	}
+
+	bool Stop()
+	{
+		auto & state = GetState();
+		std::string sFile;
+		std::vector<std::shared_ptr<ThreadBuffer>> vBuffers;
+		{
+			std::lock_guard lock(state.mtx);
+			if (!detail::bActive) {
+				return true;
+			}
+			detail::bActive = false;
+			sFile = state.sFile;
+			vBuffers = state.vBuffers; // No buffer is added once bActive is clear.
+		}
+		// Threads that passed the first check in Push() may still be appending.
+		for (auto & buffer : vBuffers) {
+			while (buffer->bBusy.load()) {
+				std::this_thread::yield();
+			}
+		}
+		if (sFile.empty()) {
+			return true;
+		}
+		if (sFile.ends_with(".pftrace") || sFile.ends_with(".perfetto-trace")) {
+			return WritePerfetto(sFile);
+		}
+		return WriteChrome(sFile);
+	}
+
+	bool Active()
+	{
+		return detail::bActive.load(std::memory_order_relaxed);
+	}
+
+	int64_t Now()
+	{
+		return ToTrace(std::chrono::steady_clock::now());
+	}
+
+	int64_t ToTrace(std::chrono::steady_clock::time_point time)
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+	}
+
+	const char * Intern(std::string_view sName)
+	{
+		auto itLocal = mLocalInterned.find(sName);
+		if (itLocal != mLocalInterned.end()) {
+			return itLocal->second;
+		}
+		const char * sRet;
+		{
+			auto & state = GetState();
+			std::lock_guard lock(state.mtx);
+			auto it = state.sInterned.find(sName);
+			if (it == state.sInterned.end()) {
+				it = state.sInterned.emplace(sName).first;
+			}
+			sRet = it->c_str();
+		}
+		mLocalInterned.emplace(sName, sRet);
+		return sRet;
+	}
+
+	const char * ThreadName(std::string_view sName)
+	{
+		sLocalName = sName;
+		if (localBuffer) {
+			auto & state = GetState();
+			std::lock_guard lock(state.mtx);
+			localBuffer->sName = sLocalName;
+		}
+		return Intern(sName);
+	}
+
+	void Complete(const char * sName, const char * sCategory, int64_t iStart, int64_t iDuration, const char * sDetail)
+	{
+		Push({sName, sCategory, sDetail, iStart, std::max<int64_t>(iDuration, 0)});
+	}
+
+	void Instant(const char * sName, const char * sCategory, const char * sDetail)
+	{
+		Push({sName, sCategory, sDetail, Now(), -1});
+	}
+
+	void CompleteOn(const char * sTrack, const char * sName, const char * sCategory, int64_t iStart, int64_t iDuration)
+	{
+		if (!detail::bActive.load(std::memory_order_relaxed)) {
+			return;
+		}
+		auto & state = GetState();
+		std::lock_guard lock(state.mtx);
+		if (!detail::bActive) {
+			return;
+		}
+		auto & buffer = state.mTracks[sTrack];
+		if (!buffer) {
+			buffer = std::make_shared<ThreadBuffer>();
+			buffer->iGeneration = state.iGeneration;
+			buffer->iTid = iTrackTid + state.mTracks.size();
+			buffer->sName = sTrack;
+			buffer->vEvents.resize(state.iEventsPerThread);
+			state.vBuffers.push_back(buffer);
+		}
+		Append(*buffer, {sName, sCategory, nullptr, iStart, std::max<int64_t>(iDuration, 0)});
+	}
+
+	bool WriteChrome(const std::string & sFile)
+	{
+		auto vThreads = TakeSnapshot();
+		std::ofstream out(sFile, std::ios::out | std::ios::trunc);
+		if (!out) {
+			Log(AppLogger::ERROR) << "Trace::WriteChrome Failed to open: " << sFile << std::endl;
+			return false;
+		}
+		size_t iEvents = 0;
+		bool bFirst = true;
+		auto Separator = [&]()
+		{
+			out << (bFirst ? "\n" : ",\n");
+			bFirst = false;
+		};
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		for (auto & thread : vThreads) {
+			if (!thread.sName.empty()) {
+				Separator();
+				out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.iTid << ",\"args\":{\"name\":";
+				WriteJSONString(out, thread.sName);
+				out << "}}";
+			}
+			for (auto & event : thread.vEvents) {
+				Separator();
+				out << "{\"name\":";
+				WriteJSONString(out, event.sName);
+				out << ",\"cat\":";
+				WriteJSONString(out, event.sCategory ? event.sCategory : "");
+				if (event.iDuration < 0) {
+					out << ",\"ph\":\"i\",\"s\":\"t\"";
+				} else {
+					out << ",\"ph\":\"X\",\"dur\":" << event.iDuration;
+				}
+				out << ",\"ts\":" << event.iStart << ",\"pid\":1,\"tid\":" << thread.iTid;
+				if (event.sDetail) {
+					out << ",\"args\":{\"detail\":";
+					WriteJSONString(out, event.sDetail);
+					out << "}";
+				}
+				out << "}";
+				++iEvents;
+			}
+		}
+		out << "\n]}\n";
+		out.close();
+		if (!out) {
+			Log(AppLogger::ERROR) << "Trace::WriteChrome Failed to write: " << sFile << std::endl;
+			return false;
+		}
+		Log(AppLogger::INFO) << "Trace::WriteChrome Saved " << iEvents << " events from " << vThreads.size() << " threads: " << sFile << std::endl;
+		return true;
+	}
+
+	bool WritePerfetto(const std::string & sFile)
+	{
+		auto vThreads = TakeSnapshot();
+		std::ofstream out(sFile, std::ios::out | std::ios::trunc | std::ios::binary);
+		if (!out) {
+			Log(AppLogger::ERROR) << "Trace::WritePerfetto Failed to open: " << sFile << std::endl;
+			return false;
+		}
+
+		std::string sPacket;
+		std::string sMessage;
+		std::string sInner;
+
+		// Process track; sequence_flags = SEQ_INCREMENTAL_STATE_CLEARED on the first packet.
+		sInner.clear();
+		Field(sInner, 1, static_cast<uint64_t>(1));          // ProcessDescriptor.pid
+		Field(sInner, 6, std::string_view("EasyAppBase"));   // ProcessDescriptor.process_name
+		sMessage.clear();
+		Field(sMessage, 1, iProcessUuid);                    // TrackDescriptor.uuid
+		Field(sMessage, 3, sInner);                          // TrackDescriptor.process
+		sPacket.clear();
+		Field(sPacket, 10, static_cast<uint64_t>(iSequenceId)); // trusted_packet_sequence_id
+		Field(sPacket, 13, static_cast<uint64_t>(1));          // sequence_flags
+		Field(sPacket, 60, sMessage);                          // track_descriptor
+		Packet(out, sPacket);
+
+		size_t iEvents = 0;
+		for (size_t iThread = 0; iThread < vThreads.size(); ++iThread) {
+			auto & thread = vThreads[iThread];
+			uint64_t iUuid = 0x10000 + iThread;
+
+			sInner.clear();
+			Field(sInner, 1, static_cast<uint64_t>(1)); // ThreadDescriptor.pid
+			Field(sInner, 2, thread.iTid);              // ThreadDescriptor.tid
+			if (!thread.sName.empty()) {
+				Field(sInner, 5, thread.sName);         // ThreadDescriptor.thread_name
+			}
+			sMessage.clear();
+			Field(sMessage, 1, iUuid);
+			Field(sMessage, 5, iProcessUuid);           // TrackDescriptor.parent_uuid
+			Field(sMessage, 4, sInner);                 // TrackDescriptor.thread
+			sPacket.clear();
+			Field(sPacket, 10, static_cast<uint64_t>(iSequenceId));
+			Field(sPacket, 60, sMessage);
+			Packet(out, sPacket);
+
+			// Slices must arrive as properly nested begin/end pairs in time order, but zones are recorded when they end.
+			// Walk them by start time (outermost first) with a stack of open slices; a slice that only partly overlaps
+			// the next one is cut short where the next begins.
+			std::vector<const Event *> vOrdered;
+			vOrdered.reserve(thread.vEvents.size());
+			for (auto & event : thread.vEvents) {
+				vOrdered.push_back(&event);
+			}
+			std::stable_sort(vOrdered.begin(), vOrdered.end(), [](const Event * a, const Event * b)
+			{
+				return std::make_tuple(a->iStart, -a->iDuration) < std::make_tuple(b->iStart, -b->iDuration);
+			});
+			auto Emit = [&](int64_t iTime, uint64_t iType, const Event * event)
+			{
+				sMessage.clear();
+				Field(sMessage, 9, iType);  // TrackEvent.type: 1 begin, 2 end, 3 instant
+				Field(sMessage, 11, iUuid); // TrackEvent.track_uuid
+				if (event) {
+					Field(sMessage, 23, std::string_view(event->sName)); // TrackEvent.name
+					if (event->sCategory) {
+						Field(sMessage, 22, std::string_view(event->sCategory)); // TrackEvent.categories
+					}
+					if (event->sDetail) {
+						sInner.clear();
+						Field(sInner, 10, std::string_view("detail"));         // DebugAnnotation.name
+						Field(sInner, 6, std::string_view(event->sDetail));    // DebugAnnotation.string_value
+						Field(sMessage, 4, sInner);                            // TrackEvent.debug_annotations
+					}
+					++iEvents;
+				}
+				sPacket.clear();
+				Field(sPacket, 8, static_cast<uint64_t>(iTime) * 1000); // timestamp, ns
+				Field(sPacket, 10, static_cast<uint64_t>(iSequenceId));
+				Field(sPacket, 11, sMessage);                           // track_event
+				Packet(out, sPacket);
+			};
+			std::vector<const Event *> vOpen;
+			auto CloseUntil = [&](int64_t iTime, int64_t iEnd)
+			{
+				while (!vOpen.empty() && vOpen.back()->iStart + vOpen.back()->iDuration < iEnd) {
+					Emit(std::min(vOpen.back()->iStart + vOpen.back()->iDuration, iTime), 2, nullptr);
+					vOpen.pop_back();
+				}
+			};
+			for (auto event : vOrdered) {
+				if (event->iDuration < 0) {
+					CloseUntil(event->iStart, event->iStart);
+					Emit(event->iStart, 3, event);
+				} else {
+					CloseUntil(event->iStart, event->iStart + event->iDuration);
+					Emit(event->iStart, 1, event);
+					vOpen.push_back(event);
+				}
+			}
+			CloseUntil(std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::max());
+		}
+		out.close();
+		if (!out) {
+			Log(AppLogger::ERROR) << "Trace::WritePerfetto Failed to write: " << sFile << std::endl;
+			return false;
+		}
+		Log(AppLogger::INFO) << "Trace::WritePerfetto Saved " << iEvents << " events from " << vThreads.size() << " threads: " << sFile << std::endl;
+		return true;
+	}
+} // Trace
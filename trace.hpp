@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2024 James Baker
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+The official repository for this library is at https://github.com/VA7ODR/EasyAppBase
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// One tracing facility for every subsystem.  TRACE_ZONE("name") times the enclosing scope on the calling thread.
+// Each thread records into its own ring buffer without locks, so a capture costs a clock read and a store per zone,
+// and almost nothing (one relaxed load) while no capture is running.  Captures are saved as Chrome trace JSON
+// (chrome://tracing) or as a Perfetto protobuf trace (ui.perfetto.dev), chosen by the file extension.
+//
+// Names and categories must outlive the capture; use string literals, or Intern() for anything built at runtime.
+// Interned strings live for the rest of the process, so hot paths should intern once and keep the pointer.
+namespace Trace
+{
+	void Start(const std::string & sFileIn, size_t iEventsPerThread = 64 * 1024); // .pftrace / .perfetto-trace for protobuf.
+	bool Stop();  // Stops the capture and writes it.  Returns false when the file could not be written.
+	bool Active();
+	bool WriteChrome(const std::string & sFile);
+	bool WritePerfetto(const std::string & sFile);
+
+	int64_t Now(); // Microseconds on the trace clock (steady_clock).
+	int64_t ToTrace(std::chrono::steady_clock::time_point time);
+	const char * Intern(std::string_view sName);      // Lock free after the calling thread's first use of sName.
+	const char * ThreadName(std::string_view sName); // Label the calling thread in captures.  Returns sName interned.
+
+	void Complete(const char * sName, const char * sCategory, int64_t iStart, int64_t iDuration, const char * sDetail = nullptr);
+	void Instant(const char * sName, const char * sCategory, const char * sDetail = nullptr);
+	// For work that runs on no thread of ours, such as GPU time: the span goes on its own track named sTrack.  Takes a
+	// lock, so keep it to a few events per frame.
+	void CompleteOn(const char * sTrack, const char * sName, const char * sCategory, int64_t iStart, int64_t iDuration);
+
+	namespace detail
+	{
+		extern std::atomic<bool> bActive;
+	}
+
+	class Zone
+	{
+		public:
+			Zone(const char * sNameIn, const char * sCategoryIn = "app", const char * sDetailIn = nullptr)
+			{
+				if (detail::bActive.load(std::memory_order_relaxed)) {
+					sName = sNameIn;
+					sCategory = sCategoryIn;
+					sDetail = sDetailIn;
+					iStart = Now();
+				}
+			}
+
+			~Zone()
+			{
+				if (sName) {
+					Complete(sName, sCategory, iStart, Now() - iStart, sDetail);
+				}
+			}
+
+			Zone(const Zone &) = delete;
+			Zone & operator=(const Zone &) = delete;
+
+		private:
+			const char * sName = nullptr;
+			const char * sCategory = nullptr;
+			const char * sDetail = nullptr;
+			int64_t iStart = 0;
+	};
+} // Trace
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_ZONE(sName) Trace::Zone TRACE_CONCAT(traceZone, __LINE__)(sName)
+#define TRACE_ZONE_CAT(sName, sCategory) Trace::Zone TRACE_CONCAT(traceZone, __LINE__)(sName, sCategory)
@@ -24,9 +24,21 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 */
 
 #include "utils.hpp"
+#include <algorithm>
+#include <filesystem>
 #include <string>
 #include <vector>
 
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 std::string PrettyHex(const std::vector<unsigned char> &in)
 {
 	std::string sRet;
@@ -66,6 +78,71 @@ std::string GetAppDataFolder()
 #endif
 }
 
+bool WriteFileAtomic(const std::string & sPath, std::string_view sData)
+{
+	std::string sTemp = sPath + ".tmp";
+#if defined(_WIN32)
+	HANDLE hFile = CreateFileA(sTemp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	size_t iDone = 0;
+	while (iDone < sData.size()) {
+		DWORD iWritten = 0;
+		DWORD iChunk = static_cast<DWORD>(std::min<size_t>(sData.size() - iDone, 1u << 30));
+		if (!WriteFile(hFile, sData.data() + iDone, iChunk, &iWritten, nullptr)) {
+			CloseHandle(hFile);
+			DeleteFileA(sTemp.c_str());
+			return false;
+		}
+		iDone += iWritten;
+	}
+	// The Windows equivalent of fsync; without it the rename can land before the data does.
+	bool bSynced = FlushFileBuffers(hFile) != 0;
+	if (!CloseHandle(hFile) || !bSynced || !MoveFileExA(sTemp.c_str(), sPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+		DeleteFileA(sTemp.c_str());
+		return false;
+	}
+	return true;
+#else
+	int fd = open(sTemp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0) {
+		return false;
+	}
+	size_t iDone = 0;
+	while (iDone < sData.size()) {
+		ssize_t iWritten = write(fd, sData.data() + iDone, sData.size() - iDone);
+		if (iWritten < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			close(fd);
+			unlink(sTemp.c_str());
+			return false;
+		}
+		iDone += static_cast<size_t>(iWritten);
+	}
+#if defined(__APPLE__)
+	// fsync on macOS only reaches the drive's cache.
+	bool bSynced = fcntl(fd, F_FULLFSYNC) == 0 || fsync(fd) == 0;
+#else
+	bool bSynced = fsync(fd) == 0;
+#endif
+	if (close(fd) != 0 || !bSynced || rename(sTemp.c_str(), sPath.c_str()) != 0) {
+		unlink(sTemp.c_str());
+		return false;
+	}
+	// Sync the directory too, or the rename itself can be lost on power failure.
+	std::string sDir = std::filesystem::path(sPath).parent_path().string();
+	int dirFd = open(sDir.empty() ? "." : sDir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (dirFd >= 0) {
+		fsync(dirFd);
+		close(dirFd);
+	}
+	return true;
+#endif
+}
+
 void ShowJsonWindow(const std::string & sTitle, json::value & jData, bool & bShow)
 {
 	ImGui::Begin(sTitle.c_str(), &bShow);
@@ -28,6 +28,8 @@ The official repository for this library is at https://github.com/VA7ODR/EasyApp
 #include "data.hpp"
 #include <boost/core/demangle.hpp>
 #include <boost/stacktrace/stacktrace.hpp>
+#include <array>
+#include <atomic>
 #include <functional>
 #include <string>
 #include <string>
@@ -410,6 +412,66 @@ class refTSEx
 		T & ref;
 };
 
+// Triple buffer for handing state from one worker thread to the render thread without either side taking a lock.
+// The worker fills Back() and calls Publish() (or just Publish(value)); Render calls Latest() and always gets the most
+// recent complete value.  Neither call ever waits on the other side.  Only one thread may publish and only one may read;
+// guard Publish with your own mutex if several workers share a snapshot.
+template <typename T>
+class Snapshot
+{
+	public:
+		Snapshot() = default;
+		explicit Snapshot(const T & initial) :
+			vSlots{initial, initial, initial}
+		{
+
+		}
+
+		Snapshot(const Snapshot &) = delete;
+		Snapshot & operator=(const Snapshot &) = delete;
+
+		// Worker side.  Back() is private to the worker until the next Publish().
+		T & Back()
+		{
+			return vSlots[iBack];
+		}
+
+		void Publish()
+		{
+			iBack = iMiddle.exchange(iBack | iFresh, std::memory_order_acq_rel) & iIndexMask;
+		}
+
+		void Publish(T value)
+		{
+			Back() = std::move(value);
+			Publish();
+		}
+
+		// Render side.  The returned reference stays valid until the next call to Latest().
+		const T & Latest()
+		{
+			if (iMiddle.load(std::memory_order_relaxed) & iFresh) {
+				iFront = iMiddle.exchange(iFront, std::memory_order_acq_rel) & iIndexMask;
+			}
+			return vSlots[iFront];
+		}
+
+		// True if something was published since the render side last called Latest().
+		bool Changed() const
+		{
+			return (iMiddle.load(std::memory_order_relaxed) & iFresh) != 0;
+		}
+
+	private:
+		static constexpr uint8_t iIndexMask = 0x03;
+		static constexpr uint8_t iFresh = 0x04;
+
+		std::array<T, 3> vSlots{};
+		uint8_t iBack = 0;
+		std::atomic<uint8_t> iMiddle = 1;
+		uint8_t iFront = 2;
+};
+
 
 
 #define ASSERT(bCondition) Asserter(bCondition, #bCondition, SOURCE_FILE, __FUNCTION__, __LINE__)
@@ -417,4 +479,5 @@ class refTSEx
 
 
 std::string GetAppDataFolder();
+bool WriteFileAtomic(const std::string & sPath, std::string_view sData); // Temp file, fsync, rename.  Readers see the old file or the new one, never a torn one.
 std::string PrettyHex(const std::vector<unsigned char> &in);